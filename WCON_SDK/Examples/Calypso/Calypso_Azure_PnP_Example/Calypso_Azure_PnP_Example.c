@@ -39,7 +39,8 @@
 #include <Calypso/Calypso_Azure_PnP_Example/Calypso_Azure_PnP_Example.h>
 #include <Calypso/Calypso_Examples.h>
 #include <stdio.h>
-#include <utils/json-builder.h>
+#include <utils/json-writer.h>
+#include <utils/json.h>
 
 /**
  * @brief Contains information on last startup event (if any)
@@ -76,6 +77,16 @@ static uint8_t reqID = 0;
  */
 static char iotHubAddress[CALYPSO_MAX_HOST_NAME_LENGTH] = {0};
 
+/**
+ * @brief Buffer of the arena used for parsing JSON responses
+ */
+static uint8_t jsonArenaBuffer[CALYPSO_AZURE_PNP_JSON_ARENA_SIZE];
+
+/**
+ * @brief Arena used for parsing JSON responses (strings are parsed in situ, i.e. point into recvEvent.data)
+ */
+static json_arena jsonArena;
+
 static bool Calypso_Azure_PnP_WaitForMqttOpEvent(uint32_t timeoutMs);
 static bool Calypso_Azure_PnP_WaitForStartup(uint32_t timeoutMs);
 static bool Calypso_Azure_PnP_WaitForMqttRecvEvent(uint32_t timeoutMs);
@@ -103,7 +114,7 @@ static bool Calypso_Azure_PnP_readFile(const char* path, char* data, uint16_t da
 
 static bool Calypso_Azure_PnP_MQTT_Publish(uint8_t mqttIndex, char* topic, uint8_t retain, char* data, int length, bool encode);
 
-static char* Calypso_Azure_PnP_Serialize_Prov_Req();
+static bool Calypso_Azure_PnP_Serialize_Prov_Req(char* buffer, size_t size, size_t* lengthP);
 
 /**
  * @brief MQTT example.
@@ -281,20 +292,25 @@ bool Calypso_Azure_PnP_Publish_MAC_Adr(uint8_t mqttIndex)
 
     sprintf(macAdrString, "%02X:%02X:%02X:%02X:%02X:%02X\r\n", macAddress[0], macAddress[1], macAddress[2], macAddress[3], macAddress[4], macAddress[5]);
 
-    json_value* payload = json_object_new(1);
-    json_object_push(payload, "MACAddress", json_string_new(macAdrString));
+    char payload[CALYPSO_AZURE_PNP_PROPERTY_PAYLOAD_SIZE];
+    size_t payloadLength;
+    JsonWriter_t writer;
+    JsonWriter_Init(&writer, payload, sizeof(payload));
+    JsonWriter_BeginObject(&writer);
+    JsonWriter_Key(&writer, "MACAddress");
+    JsonWriter_String(&writer, macAdrString);
+    JsonWriter_EndObject(&writer);
+    if (!JsonWriter_Finish(&writer, &payloadLength))
+    {
+        return false;
+    }
 
     reqID++;
     sprintf(topic, "%s%" PRIu32, DEVICE_TWIN_MESSAGE_PATCH, (uint32_t)reqID);
-    char* buf = malloc(json_measure(payload));
-    json_serialize(buf, payload);
-    json_builder_free(payload);
-    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, buf, strlen(buf), true))
+    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, payload, payloadLength, true))
     {
-        free(buf);
         return false;
     }
-    free(buf);
     return Calypso_Azure_PnP_WaitForMqttRecvEvent(2000);
 }
 
@@ -313,20 +329,25 @@ bool Calypso_Azure_PnP_Publish_Version(uint8_t mqttIndex)
         return false;
     }
 
-    json_value* payload = json_object_new(1);
-    json_object_push(payload, "swVersion", json_string_new(deviceValue.general.version.calypsoFirmwareVersion));
+    char payload[CALYPSO_AZURE_PNP_PROPERTY_PAYLOAD_SIZE];
+    size_t payloadLength;
+    JsonWriter_t writer;
+    JsonWriter_Init(&writer, payload, sizeof(payload));
+    JsonWriter_BeginObject(&writer);
+    JsonWriter_Key(&writer, "swVersion");
+    JsonWriter_String(&writer, deviceValue.general.version.calypsoFirmwareVersion);
+    JsonWriter_EndObject(&writer);
+    if (!JsonWriter_Finish(&writer, &payloadLength))
+    {
+        return false;
+    }
 
     reqID++;
     sprintf(topic, "%s%" PRIu32, DEVICE_TWIN_MESSAGE_PATCH, (uint32_t)reqID);
-    char* buf = malloc(json_measure(payload));
-    json_serialize(buf, payload);
-    json_builder_free(payload);
-    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, buf, strlen(buf), true))
+    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, payload, payloadLength, true))
     {
-        free(buf);
         return false;
     }
-    free(buf);
     return Calypso_Azure_PnP_WaitForMqttRecvEvent(2000);
 }
 
@@ -345,22 +366,27 @@ bool Calypso_Azure_PnP_Publish_UDID(uint8_t mqttIndex)
         return false;
     }
 
-    json_value* payload = json_object_new(1);
-    json_object_push(payload, "UDID", json_string_new(deviceValue.iot.udid));
+    char payload[CALYPSO_AZURE_PNP_PROPERTY_PAYLOAD_SIZE];
+    size_t payloadLength;
+    JsonWriter_t writer;
+    JsonWriter_Init(&writer, payload, sizeof(payload));
+    JsonWriter_BeginObject(&writer);
+    JsonWriter_Key(&writer, "UDID");
+    JsonWriter_String(&writer, deviceValue.iot.udid);
+    JsonWriter_EndObject(&writer);
+    if (!JsonWriter_Finish(&writer, &payloadLength))
+    {
+        return false;
+    }
 
     reqID++;
     sprintf(topic, "%s%" PRIu32, DEVICE_TWIN_MESSAGE_PATCH, (uint32_t)reqID);
-    char* buf = malloc(json_measure(payload));
-    json_serialize(buf, payload);
-    json_builder_free(payload);
 
-    WE_APP_PRINT("%s\r\n", buf);
-    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, buf, strlen(buf), true))
+    WE_APP_PRINT("%s\r\n", payload);
+    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, topic, 1, payload, payloadLength, true))
     {
-        free(buf);
         return false;
     }
-    free(buf);
     return Calypso_Azure_PnP_WaitForMqttRecvEvent(2000);
 }
 
@@ -494,17 +520,29 @@ bool Calypso_Azure_PnP_Provision()
     /*Poll for provisioning complete response (status = "assigned")*/
     if (Calypso_Azure_PnP_WaitForMqttRecvEvent(3000))
     {
-        json_value* response = NULL;
-        response = json_parse(recvEvent.data, recvEvent.dataLength - 1);
+        json_settings jsonSettings = {0};
+        jsonSettings.settings = json_in_situ;
+        json_arena_init(&jsonArena, jsonArenaBuffer, sizeof(jsonArenaBuffer));
+        json_arena_settings(&jsonSettings, &jsonArena);
+
+        /* The response is parsed in situ, so the operation ID has to be copied before recvEvent.data is overwritten */
+        char operationID[CALYPSO_AZURE_PNP_OPERATION_ID_MAX_LENGTH] = {0};
+        json_value* response = json_parse_ex(&jsonSettings, recvEvent.data, recvEvent.dataLength - 1, NULL);
+        if (NULL != response)
+        {
+            strncpy(operationID, response->u.object.values[0].value->u.string.ptr, sizeof(operationID) - 1);
+        }
+        json_arena_reset(&jsonArena);
+
         while (!provDone)
         {
             WE_Delay(2000);
-            ret = Calypso_Azure_PnP_Publish_Status_Req(mqttIndex, response->u.object.values[0].value->u.string.ptr);
+            ret = Calypso_Azure_PnP_Publish_Status_Req(mqttIndex, operationID);
             if (Calypso_Azure_PnP_WaitForMqttRecvEvent(3000))
             {
                 json_value* status = NULL;
-                status = json_parse(recvEvent.data, recvEvent.dataLength - 1);
-                if (0 == strncmp(status->u.object.values[1].value->u.string.ptr, "assigned", strlen("assigned")))
+                status = json_parse_ex(&jsonSettings, recvEvent.data, recvEvent.dataLength - 1, NULL);
+                if ((NULL != status) && (0 == strncmp(status->u.object.values[1].value->u.string.ptr, "assigned", strlen("assigned"))))
                 {
                     provDone = true;
                     strcpy(iotHubAddress, status->u.object.values[2].value->u.object.values[3].value->u.string.ptr);
@@ -514,7 +552,7 @@ bool Calypso_Azure_PnP_Provision()
                         Calypso_Azure_PnP_Print("Unable to write hub address to file", false);
                     }
                 }
-                json_value_free(status);
+                json_arena_reset(&jsonArena);
             }
             else
             {
@@ -575,9 +613,14 @@ bool Calypso_Azure_PnP_Publish_Reg_Req(uint8_t mqttIndex)
     reqID++;
     sprintf(provReqTopic, "%s%" PRIu32, PROVISIONING_REG_REQ_TOPIC, (uint32_t)reqID);
 
-    char* provReq = Calypso_Azure_PnP_Serialize_Prov_Req();
+    char provReq[CALYPSO_AZURE_PNP_PROPERTY_PAYLOAD_SIZE];
+    size_t provReqLength;
+    if (!Calypso_Azure_PnP_Serialize_Prov_Req(provReq, sizeof(provReq), &provReqLength))
+    {
+        return false;
+    }
 
-    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, provReqTopic, 1, provReq, strlen(provReq), true))
+    if (!Calypso_Azure_PnP_MQTT_Publish(mqttIndex, provReqTopic, 1, provReq, provReqLength, true))
     {
         ret = false;
     }
@@ -585,7 +628,6 @@ bool Calypso_Azure_PnP_Publish_Reg_Req(uint8_t mqttIndex)
     {
         ret = true;
     }
-    free(provReq);
     return ret;
 }
 /**
@@ -618,25 +660,27 @@ bool Calypso_Azure_PnP_MQTT_Publish(uint8_t mqttIndex, char* topic, uint8_t reta
 
 /**
  * @brief Create a string containing registration data
- * @return JSON string
+ * @param[out]buffer Buffer for the JSON string
+ * @param[in]size Size of the buffer
+ * @param[out]lengthP Length of the JSON string
+ * @return true if successful, false otherwise
  */
-char* Calypso_Azure_PnP_Serialize_Prov_Req()
+bool Calypso_Azure_PnP_Serialize_Prov_Req(char* buffer, size_t size, size_t* lengthP)
 {
-
-    json_value* prov_payload_ = json_object_new(1);
-    json_value* prov_modelID_ = json_object_new(1);
-
-    json_object_push(prov_modelID_, "modelId", json_string_new(MODEL_ID));
-    json_object_push(prov_payload_, "registrationId", json_string_new(CALYPSO_AZURE_PNP_DEVICE_ID));
-    json_object_push(prov_payload_, "payload", prov_modelID_);
-
-    char* buf = malloc(json_measure(prov_payload_));
-    json_serialize(buf, prov_payload_);
-
-    json_builder_free(prov_payload_);
-    json_builder_free(prov_modelID_);
-
-    return buf;
+    JsonWriter_t writer;
+    JsonWriter_Init(&writer, buffer, size);
+
+    JsonWriter_BeginObject(&writer);
+    JsonWriter_Key(&writer, "registrationId");
+    JsonWriter_String(&writer, CALYPSO_AZURE_PNP_DEVICE_ID);
+    JsonWriter_Key(&writer, "payload");
+    JsonWriter_BeginObject(&writer);
+    JsonWriter_Key(&writer, "modelId");
+    JsonWriter_String(&writer, MODEL_ID);
+    JsonWriter_EndObject(&writer);
+    JsonWriter_EndObject(&writer);
+
+    return JsonWriter_Finish(&writer, lengthP);
 }
 
 /**
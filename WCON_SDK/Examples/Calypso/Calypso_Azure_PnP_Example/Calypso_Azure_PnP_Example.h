@@ -110,6 +110,15 @@ MrY=\r\n\
 #define DEVICE_TWIN_MESSAGE_PATCH "$iothub/twin/PATCH/properties/reported/?$rid="
 #define DEVICE_TWIN_GET_TOPIC "$iothub/twin/GET/?$rid="
 
+/*Size of the arena used for parsing JSON responses*/
+#define CALYPSO_AZURE_PNP_JSON_ARENA_SIZE 2048
+
+/*Max. length of the DPS operation ID*/
+#define CALYPSO_AZURE_PNP_OPERATION_ID_MAX_LENGTH 128
+
+/*Size of the buffer used for serializing property and registration payloads*/
+#define CALYPSO_AZURE_PNP_PROPERTY_PAYLOAD_SIZE 256
+
 extern void Calypso_Azure_PnP_Example(void);
 
 #endif /* CALYPSO_AZURE_PNP_EXAMPLE_H_INCLUDED */
@@ -35,6 +35,14 @@
 #include <Calypso/Calypso_Examples.h>
 #include <Calypso/Calypso_HTTP_Client_Example.h>
 #include <stdio.h>
+#include <utils/json-reader.h>
+
+/**
+ * @brief Size of the token buffer used for parsing the JSON response (longest key or string chunk)
+ */
+#define CALYPSO_HTTP_CLIENT_JSON_TOKEN_BUFFER_SIZE 64
+
+static void Calypso_HTTP_Client_PrintJsonEvents(JsonReader_t* readerP);
 
 void Calypso_HTTP_Client_Example(void)
 {
@@ -189,9 +197,14 @@ void Calypso_HTTP_Client_Example(void)
     Calypso_Examples_Print("Send HTTP request", ret);
     WE_APP_PRINT("HTTP status code is %ld (%s)\r\n", status, status == 200 ? "OK" : "NOK");
 
-    /* Read HTTP response body in chunks of length up to rxChunksize */
+    /* Read HTTP response body in chunks of length up to rxChunksize. The chunks
+     * are fed into a pull JSON reader, so the response is parsed without
+     * having to store the complete body. */
     Calypso_ATHTTP_ResponseBody_t body;
     uint16_t chunkIndex = 0;
+    char jsonTokenBuffer[CALYPSO_HTTP_CLIENT_JSON_TOKEN_BUFFER_SIZE];
+    JsonReader_t jsonReader;
+    JsonReader_Init(&jsonReader, jsonTokenBuffer, sizeof(jsonTokenBuffer));
     do
     {
         ret = Calypso_ATHTTP_ReadResponseBody(clientHandle, dataFormat, base64, rxChunkSize, &body);
@@ -199,6 +212,12 @@ void Calypso_HTTP_Client_Example(void)
         if (ret)
         {
             WE_APP_PRINT("Received HTTP response body chunk %d: \"%s\"\r\n", chunkIndex++, body.body);
+            JsonReader_Feed(&jsonReader, body.body, body.length);
+            if (!body.hasMoreData)
+            {
+                JsonReader_Finish(&jsonReader);
+            }
+            Calypso_HTTP_Client_PrintJsonEvents(&jsonReader);
         }
     } while (ret && body.hasMoreData);
 
@@ -212,3 +231,46 @@ void Calypso_HTTP_Client_Example(void)
 
     Calypso_Deinit();
 }
+
+/**
+ * @brief Prints the JSON events available in the current response body chunk.
+ *
+ * @param[in,out] readerP JSON reader
+ */
+static void Calypso_HTTP_Client_PrintJsonEvents(JsonReader_t* readerP)
+{
+    JsonReader_Event_t event;
+    JsonReader_Status_t status;
+    while (JsonReader_Status_Event == (status = JsonReader_Next(readerP, &event)))
+    {
+        switch (event.type)
+        {
+            case JsonReader_EventType_Key:
+                WE_APP_PRINT("JSON %*s\"%s\": ", 2 * event.depth, "", event.text);
+                break;
+            case JsonReader_EventType_String:
+                WE_APP_PRINT("\"%s\"%s", event.text, event.partial ? "" : "\r\n");
+                break;
+            case JsonReader_EventType_Number:
+                WE_APP_PRINT("%.*s\r\n", (int)event.length, event.text);
+                break;
+            case JsonReader_EventType_Boolean:
+                WE_APP_PRINT("%s\r\n", event.boolean ? "true" : "false");
+                break;
+            case JsonReader_EventType_Null:
+                WE_APP_PRINT("null\r\n");
+                break;
+            case JsonReader_EventType_BeginObject:
+            case JsonReader_EventType_BeginArray:
+                WE_APP_PRINT("%c\r\n", (JsonReader_EventType_BeginObject == event.type) ? '{' : '[');
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (JsonReader_Status_Error == status)
+    {
+        WE_APP_PRINT("HTTP response body is not valid JSON\r\n");
+    }
+}
@@ -869,13 +869,15 @@ static void Peripheral_TransparentModeExample()
  */
 bool ConfigureModule()
 {
-    WE_UART_t ProteusIV_uart_configMode;
+    WE_UART_t ProteusIV_uart_configMode = {0};
     ProteusIV_uart_configMode.baudrate = PROTEUSIV_CONFIGMODE_BAUDRATE;
     ProteusIV_uart_configMode.flowControl = WE_FlowControl_NoFlowControl;
     ProteusIV_uart_configMode.parity = WE_Parity_None;
     ProteusIV_uart_configMode.uartInit = ProteusIV_uart.uartInit;
     ProteusIV_uart_configMode.uartDeinit = ProteusIV_uart.uartDeinit;
     ProteusIV_uart_configMode.uartTransmit = ProteusIV_uart.uartTransmit;
+    ProteusIV_uart_configMode.uartTransmitAsync = ProteusIV_uart.uartTransmitAsync;
+    ProteusIV_uart_configMode.uartGetRxOverflowCounts = ProteusIV_uart.uartGetRxOverflowCounts;
 
     /* No callbacks required */
     ProteusIV_CallbackConfig_t callbackConfig = {0};
@@ -0,0 +1,926 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Radio module emulator for the Linux host platform.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "emulator.h"
+
+/**
+ * @brief EZ-Serial packet type of commands and responses.
+ */
+#define WE_EMULATOR_EZS_TYPE_CMDRSP 0xC0
+
+/**
+ * @brief EZ-Serial packet type of events.
+ */
+#define WE_EMULATOR_EZS_TYPE_EVENT 0x80
+
+/**
+ * @brief Mask for the packet type bits of the first byte of an EZ-Serial packet.
+ */
+#define WE_EMULATOR_EZS_TYPE_MASK 0xC0
+
+/**
+ * @brief Mask for the length MSB bits of the first byte of an EZ-Serial packet.
+ */
+#define WE_EMULATOR_EZS_LENGTH_MSB_MASK 0x07
+
+/**
+ * @brief Initial value of the EZ-Serial checksum.
+ */
+#define WE_EMULATOR_EZS_CHECKSUM_INITIAL_VALUE 0x99
+
+/**
+ * @brief Length of the EZ-Serial packet header (type/length MSB, length LSB, group, id).
+ */
+#define WE_EMULATOR_EZS_HEADER_LENGTH 4
+
+/**
+ * @brief Maximum payload length of an EZ-Serial packet.
+ */
+#define WE_EMULATOR_EZS_MAX_PAYLOAD_LENGTH 2047
+
+typedef struct WE_Emulator_QueueEntry_t
+{
+    /**
+	 * @brief Time at which the transfer of the frame is started (CLOCK_MONOTONIC, nanoseconds).
+	 */
+    uint64_t dueTime;
+
+    /**
+	 * @brief Used for sending frames with identical dueTime in the order they have been queued.
+	 */
+    uint32_t sequenceNumber;
+
+    /**
+	 * @brief Number of bytes in data.
+	 */
+    uint16_t length;
+
+    /**
+	 * @brief Encoded frame.
+	 */
+    uint8_t data[WE_EMULATOR_MAX_FRAME_SIZE];
+} WE_Emulator_QueueEntry_t;
+
+static WE_Emulator_Config_t emulatorConfig = {0};
+
+static const WE_Emulator_Rule_t* rules[WE_EMULATOR_MAX_RULES];
+static uint8_t ruleCount = 0;
+
+static WE_Emulator_RequestHandler_t requestHandler = NULL;
+
+static WE_Emulator_Statistics_t statistics = {0};
+
+/**
+ * @brief Protects the queue, the periodic frame and the statistics.
+ */
+static pthread_mutex_t emulatorMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Is signaled when a frame has been queued or sent (uses CLOCK_MONOTONIC).
+ */
+static pthread_cond_t emulatorCondition;
+
+static pthread_once_t emulatorConditionOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Frames waiting to be sent to the driver (unsorted).
+ */
+static WE_Emulator_QueueEntry_t queue[WE_EMULATOR_QUEUE_SIZE];
+static uint16_t queueCount = 0;
+static uint32_t nextSequenceNumber = 0;
+
+/**
+ * @brief Frame currently being transferred to the driver (only accessed by the emulator thread).
+ */
+static WE_Emulator_QueueEntry_t transferEntry;
+
+/**
+ * @brief Is true while transferEntry is being transferred to the driver.
+ */
+static bool transferRunning = false;
+
+/**
+ * @brief Time at which the transfer of the previous frame to the driver has finished.
+ */
+static uint64_t lineFreeTime = 0;
+
+static WE_Emulator_QueueEntry_t periodicEntry;
+static bool periodicActive = false;
+static uint64_t periodicNextTime = 0;
+static uint64_t periodicPeriod = 0;
+static uint32_t periodicRemaining = 0;
+
+/**
+ * @brief Baud rate and number of bits per byte (start, data, parity, stop) used for emulating the transfer time.
+ */
+static uint32_t uartBaudrate = 0;
+static uint8_t uartBitsPerByte = 10;
+
+static WE_UART_HandleRxByte_t* rxByteHandlerP = NULL;
+static pthread_t emulatorThread;
+static bool running = false;
+
+/**
+ * @brief State of the parser for requests received from the driver.
+ */
+static uint8_t requestBuffer[WE_EMULATOR_MAX_FRAME_SIZE];
+static uint16_t requestLength = 0;
+static uint16_t requestExpectedLength = 0;
+
+static void WE_Emulator_InitCondition()
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&emulatorCondition, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static uint64_t WE_Emulator_Now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+static struct timespec WE_Emulator_ToTimespec(uint64_t time)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)(time / 1000000000ull);
+    ts.tv_nsec = (long)(time % 1000000000ull);
+    return ts;
+}
+
+static void WE_Emulator_SleepUntil(uint64_t time)
+{
+    struct timespec ts = WE_Emulator_ToTimespec(time);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    {
+    }
+}
+
+/**
+ * @brief Returns the time needed for transferring the provided number of bytes via UART (0 if pacing is disabled).
+ */
+static uint64_t WE_Emulator_GetTransferTime(uint16_t length)
+{
+    if (!emulatorConfig.pacing || (uartBaudrate == 0))
+    {
+        return 0;
+    }
+    return ((uint64_t)length * uartBitsPerByte * 1000000000ull) / uartBaudrate;
+}
+
+/**
+ * @brief Encodes a frame using the configured protocol.
+ *
+ * @param[in] frame Frame to be encoded
+ * @param[out] entry Queue entry receiving the encoded frame
+ *
+ * @return True if request succeeded, false if the frame is too large
+ */
+static bool WE_Emulator_EncodeFrame(const WE_Emulator_Frame_t* frame, WE_Emulator_QueueEntry_t* entry)
+{
+    uint8_t* out = entry->data;
+
+    switch (emulatorConfig.protocol)
+    {
+        case WE_Emulator_Protocol_Binary:
+        {
+            uint16_t headerLength = 2 + emulatorConfig.lengthBytes;
+            if ((emulatorConfig.lengthBytes == 1 && frame->length > UINT8_MAX) || (headerLength + frame->length + 1 > WE_EMULATOR_MAX_FRAME_SIZE))
+            {
+                return false;
+            }
+
+            out[0] = emulatorConfig.startByte;
+            out[1] = (uint8_t)frame->command;
+            out[2] = (uint8_t)frame->length;
+            if (emulatorConfig.lengthBytes == 2)
+            {
+                out[3] = (uint8_t)(frame->length >> 8);
+            }
+            if (frame->length > 0)
+            {
+                memcpy(&out[headerLength], frame->data, frame->length);
+            }
+
+            uint8_t checksum = 0;
+            for (uint16_t i = 0; i < headerLength + frame->length; i++)
+            {
+                checksum ^= out[i];
+            }
+            out[headerLength + frame->length] = checksum;
+            entry->length = headerLength + frame->length + 1;
+            return true;
+        }
+
+        case WE_Emulator_Protocol_EZSerial:
+        {
+            if ((frame->length > WE_EMULATOR_EZS_MAX_PAYLOAD_LENGTH) || (WE_EMULATOR_EZS_HEADER_LENGTH + frame->length + 1 > WE_EMULATOR_MAX_FRAME_SIZE))
+            {
+                return false;
+            }
+
+            out[0] = (frame->isEvent ? WE_EMULATOR_EZS_TYPE_EVENT : WE_EMULATOR_EZS_TYPE_CMDRSP) | ((frame->length >> 8) & WE_EMULATOR_EZS_LENGTH_MSB_MASK);
+            out[1] = (uint8_t)frame->length;
+            out[2] = (uint8_t)(frame->command >> 8);
+            out[3] = (uint8_t)frame->command;
+            if (frame->length > 0)
+            {
+                memcpy(&out[WE_EMULATOR_EZS_HEADER_LENGTH], frame->data, frame->length);
+            }
+
+            uint8_t checksum = WE_EMULATOR_EZS_CHECKSUM_INITIAL_VALUE;
+            for (uint16_t i = 0; i < WE_EMULATOR_EZS_HEADER_LENGTH + frame->length; i++)
+            {
+                checksum += out[i];
+            }
+            out[WE_EMULATOR_EZS_HEADER_LENGTH + frame->length] = checksum;
+            entry->length = WE_EMULATOR_EZS_HEADER_LENGTH + frame->length + 1;
+            return true;
+        }
+
+        case WE_Emulator_Protocol_AT:
+        {
+            size_t lineLength = (frame->length != 0) ? frame->length : strlen((const char*)frame->data);
+            size_t terminatorLength = strlen(emulatorConfig.lineTerminator);
+            if (lineLength + terminatorLength > WE_EMULATOR_MAX_FRAME_SIZE)
+            {
+                return false;
+            }
+
+            memcpy(out, frame->data, lineLength);
+            memcpy(out + lineLength, emulatorConfig.lineTerminator, terminatorLength);
+            entry->length = (uint16_t)(lineLength + terminatorLength);
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Adds an encoded frame to the queue. Must be called with emulatorMutex locked.
+ */
+static bool WE_Emulator_EnqueueEntryLocked(const WE_Emulator_QueueEntry_t* entry, uint64_t dueTime)
+{
+    if (queueCount >= WE_EMULATOR_QUEUE_SIZE)
+    {
+        statistics.droppedFrameCount++;
+        return false;
+    }
+
+    WE_Emulator_QueueEntry_t* queueEntry = &queue[queueCount];
+    memcpy(queueEntry->data, entry->data, entry->length);
+    queueEntry->length = entry->length;
+    queueEntry->dueTime = dueTime;
+    queueEntry->sequenceNumber = nextSequenceNumber++;
+    queueCount++;
+
+    pthread_cond_broadcast(&emulatorCondition);
+    return true;
+}
+
+/**
+ * @brief Encodes a frame and adds it to the queue. Must be called with emulatorMutex locked.
+ */
+static bool WE_Emulator_EnqueueFrameLocked(const WE_Emulator_Frame_t* frame, uint64_t dueTime)
+{
+    if (queueCount >= WE_EMULATOR_QUEUE_SIZE)
+    {
+        statistics.droppedFrameCount++;
+        return false;
+    }
+
+    WE_Emulator_QueueEntry_t* queueEntry = &queue[queueCount];
+    if (!WE_Emulator_EncodeFrame(frame, queueEntry))
+    {
+        statistics.droppedFrameCount++;
+        return false;
+    }
+    queueEntry->dueTime = dueTime;
+    queueEntry->sequenceNumber = nextSequenceNumber++;
+    queueCount++;
+
+    pthread_cond_broadcast(&emulatorCondition);
+    return true;
+}
+
+/**
+ * @brief Returns the index of the queued frame to be sent next (-1 if the queue is empty). Must be called with emulatorMutex locked.
+ */
+static int WE_Emulator_GetNextEntryLocked()
+{
+    int next = -1;
+    for (uint16_t i = 0; i < queueCount; i++)
+    {
+        if ((next < 0) || (queue[i].dueTime < queue[next].dueTime) || ((queue[i].dueTime == queue[next].dueTime) && ((int32_t)(queue[i].sequenceNumber - queue[next].sequenceNumber) < 0)))
+        {
+            next = i;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Sends queued frames to the driver, emulating the transfer time on the serial line.
+ */
+static void* WE_Emulator_Thread(void* arg)
+{
+    (void)arg;
+
+    pthread_mutex_lock(&emulatorMutex);
+    while (running)
+    {
+        uint64_t now = WE_Emulator_Now();
+
+        if (periodicActive && (periodicNextTime <= now))
+        {
+            WE_Emulator_EnqueueEntryLocked(&periodicEntry, periodicNextTime);
+            periodicNextTime += periodicPeriod;
+            if ((periodicRemaining > 0) && (--periodicRemaining == 0))
+            {
+                periodicActive = false;
+            }
+            continue;
+        }
+
+        uint64_t wakeTime = UINT64_MAX;
+
+        int next = WE_Emulator_GetNextEntryLocked();
+        if (next >= 0)
+        {
+            uint64_t startTime = (queue[next].dueTime > lineFreeTime) ? queue[next].dueTime : lineFreeTime;
+            if (startTime <= now)
+            {
+                /* Take frame from queue and transfer it to the driver */
+                memcpy(transferEntry.data, queue[next].data, queue[next].length);
+                transferEntry.length = queue[next].length;
+                queueCount--;
+                if (next != queueCount)
+                {
+                    memcpy(&queue[next], &queue[queueCount], sizeof(WE_Emulator_QueueEntry_t));
+                }
+
+                uint64_t endTime = startTime + WE_Emulator_GetTransferTime(transferEntry.length);
+                lineFreeTime = endTime;
+                transferRunning = true;
+                pthread_mutex_unlock(&emulatorMutex);
+
+                WE_Emulator_SleepUntil(endTime);
+                if ((rxByteHandlerP != NULL) && (*rxByteHandlerP != NULL))
+                {
+                    (*rxByteHandlerP)(transferEntry.data, transferEntry.length);
+                }
+
+                pthread_mutex_lock(&emulatorMutex);
+                transferRunning = false;
+                statistics.frameCount++;
+                statistics.bytesSent += transferEntry.length;
+                pthread_cond_broadcast(&emulatorCondition);
+                continue;
+            }
+            wakeTime = startTime;
+        }
+
+        if (periodicActive && (periodicNextTime < wakeTime))
+        {
+            wakeTime = periodicNextTime;
+        }
+
+        if (wakeTime == UINT64_MAX)
+        {
+            pthread_cond_wait(&emulatorCondition, &emulatorMutex);
+        }
+        else
+        {
+            struct timespec ts = WE_Emulator_ToTimespec(wakeTime);
+            pthread_cond_timedwait(&emulatorCondition, &emulatorMutex, &ts);
+        }
+    }
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return NULL;
+}
+
+/**
+ * @brief Returns the first rule matching the provided request (NULL if no rule matches).
+ */
+static const WE_Emulator_Rule_t* WE_Emulator_FindRule(uint16_t command, const uint8_t* data)
+{
+    for (uint8_t i = 0; i < ruleCount; i++)
+    {
+        const WE_Emulator_Rule_t* rule = rules[i];
+        if (emulatorConfig.protocol == WE_Emulator_Protocol_AT)
+        {
+            if ((rule->atPrefix != NULL) && (0 == strncmp((const char*)data, rule->atPrefix, strlen(rule->atPrefix))))
+            {
+                return rule;
+            }
+        }
+        else if (rule->command == command)
+        {
+            return rule;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Handles a complete request received from the driver.
+ */
+static void WE_Emulator_HandleRequest(uint16_t command, const uint8_t* data, uint16_t length)
+{
+    uint64_t now = WE_Emulator_Now();
+
+    pthread_mutex_lock(&emulatorMutex);
+    statistics.requestCount++;
+    if ((emulatorConfig.protocol == WE_Emulator_Protocol_AT) && emulatorConfig.echo)
+    {
+        WE_Emulator_Frame_t echoFrame = {.data = data, .length = length};
+        WE_Emulator_EnqueueFrameLocked(&echoFrame, now);
+    }
+    pthread_mutex_unlock(&emulatorMutex);
+
+    WE_Emulator_RequestHandler_t handler = requestHandler;
+    if ((handler != NULL) && handler(command, data, length))
+    {
+        return;
+    }
+
+    const WE_Emulator_Rule_t* rule = WE_Emulator_FindRule(command, data);
+
+    pthread_mutex_lock(&emulatorMutex);
+    if (rule != NULL)
+    {
+        for (uint8_t i = 0; i < rule->responseCount; i++)
+        {
+            WE_Emulator_EnqueueFrameLocked(&rule->responses[i], now + (uint64_t)rule->responses[i].delayUs * 1000ull);
+        }
+    }
+    else
+    {
+        /* No matching rule - send default confirmation */
+        static const uint8_t status[] = {0x00, 0x00};
+        WE_Emulator_Frame_t frame = {0};
+        switch (emulatorConfig.protocol)
+        {
+            case WE_Emulator_Protocol_Binary:
+                frame.command = (command | emulatorConfig.confirmationFlag) & 0xFF;
+                frame.data = status;
+                frame.length = 1;
+                break;
+
+            case WE_Emulator_Protocol_EZSerial:
+                frame.command = command;
+                frame.data = status;
+                frame.length = 2;
+                break;
+
+            case WE_Emulator_Protocol_AT:
+                frame.data = (const uint8_t*)emulatorConfig.okResponse;
+                break;
+
+            default:
+                break;
+        }
+        WE_Emulator_EnqueueFrameLocked(&frame, now + (uint64_t)emulatorConfig.confirmationDelayUs * 1000ull);
+    }
+    pthread_mutex_unlock(&emulatorMutex);
+}
+
+/**
+ * @brief Discards the request currently being parsed.
+ */
+static void WE_Emulator_DiscardRequest(bool invalid)
+{
+    requestLength = 0;
+    requestExpectedLength = 0;
+    if (invalid)
+    {
+        pthread_mutex_lock(&emulatorMutex);
+        statistics.invalidRequestCount++;
+        pthread_mutex_unlock(&emulatorMutex);
+    }
+}
+
+static void WE_Emulator_ParseBinaryByte(uint8_t b)
+{
+    if ((requestLength == 0) && (b != emulatorConfig.startByte))
+    {
+        /* Not the start of a frame (e.g. transparent data) - ignore */
+        return;
+    }
+
+    requestBuffer[requestLength++] = b;
+
+    uint16_t headerLength = 2 + emulatorConfig.lengthBytes;
+    if (requestLength == headerLength)
+    {
+        uint16_t payloadLength = (emulatorConfig.lengthBytes == 1) ? requestBuffer[2] : (requestBuffer[2] | (requestBuffer[3] << 8));
+        requestExpectedLength = headerLength + payloadLength + 1;
+        if (requestExpectedLength > WE_EMULATOR_MAX_FRAME_SIZE)
+        {
+            WE_Emulator_DiscardRequest(true);
+        }
+    }
+    else if ((requestLength > headerLength) && (requestLength == requestExpectedLength))
+    {
+        uint8_t checksum = 0;
+        for (uint16_t i = 0; i < requestLength - 1; i++)
+        {
+            checksum ^= requestBuffer[i];
+        }
+
+        if (checksum == b)
+        {
+            WE_Emulator_HandleRequest(requestBuffer[1], &requestBuffer[headerLength], requestLength - headerLength - 1);
+            WE_Emulator_DiscardRequest(false);
+        }
+        else
+        {
+            WE_Emulator_DiscardRequest(true);
+        }
+    }
+}
+
+static void WE_Emulator_ParseEZSerialByte(uint8_t b)
+{
+    if ((requestLength == 0) && ((b & WE_EMULATOR_EZS_TYPE_MASK) != WE_EMULATOR_EZS_TYPE_CMDRSP))
+    {
+        /* Not the start of a command (e.g. text mode command or transparent data) - ignore */
+        return;
+    }
+
+    requestBuffer[requestLength++] = b;
+
+    if (requestLength == 2)
+    {
+        requestExpectedLength = WE_EMULATOR_EZS_HEADER_LENGTH + (((requestBuffer[0] & WE_EMULATOR_EZS_LENGTH_MSB_MASK) << 8) | requestBuffer[1]) + 1;
+        if (requestExpectedLength > WE_EMULATOR_MAX_FRAME_SIZE)
+        {
+            WE_Emulator_DiscardRequest(true);
+        }
+    }
+    else if ((requestLength > 2) && (requestLength == requestExpectedLength))
+    {
+        uint8_t checksum = WE_EMULATOR_EZS_CHECKSUM_INITIAL_VALUE;
+        for (uint16_t i = 0; i < requestLength - 1; i++)
+        {
+            checksum += requestBuffer[i];
+        }
+
+        if (checksum == b)
+        {
+            WE_Emulator_HandleRequest((requestBuffer[2] << 8) | requestBuffer[3], &requestBuffer[WE_EMULATOR_EZS_HEADER_LENGTH], requestLength - WE_EMULATOR_EZS_HEADER_LENGTH - 1);
+            WE_Emulator_DiscardRequest(false);
+        }
+        else
+        {
+            WE_Emulator_DiscardRequest(true);
+        }
+    }
+}
+
+static void WE_Emulator_ParseATByte(uint8_t b)
+{
+    if ((b == '\r') || (b == '\n'))
+    {
+        if (requestLength > 0)
+        {
+            requestBuffer[requestLength] = '\0';
+            WE_Emulator_HandleRequest(0, requestBuffer, requestLength);
+            WE_Emulator_DiscardRequest(false);
+        }
+        return;
+    }
+
+    if (requestLength >= WE_EMULATOR_MAX_FRAME_SIZE - 1)
+    {
+        WE_Emulator_DiscardRequest(true);
+    }
+    requestBuffer[requestLength++] = b;
+}
+
+bool WE_Emulator_GetDefaultConfig(WE_Emulator_Module_t module, WE_Emulator_Config_t* config)
+{
+    if (config == NULL)
+    {
+        return false;
+    }
+
+    memset(config, 0, sizeof(WE_Emulator_Config_t));
+    config->lineTerminator = "\r\n";
+    config->okResponse = "OK";
+    config->pacing = true;
+
+    switch (module)
+    {
+        case WE_Emulator_Module_ProteusIII:
+        case WE_Emulator_Module_ThyoneI:
+            config->protocol = WE_Emulator_Protocol_Binary;
+            config->startByte = 0x02;
+            config->lengthBytes = 2;
+            config->confirmationFlag = 0x40;
+            break;
+
+        case WE_Emulator_Module_TarvosIII:
+            config->protocol = WE_Emulator_Protocol_Binary;
+            config->startByte = 0x02;
+            config->lengthBytes = 1;
+            config->confirmationFlag = 0x40;
+            break;
+
+        case WE_Emulator_Module_Metis:
+            config->protocol = WE_Emulator_Protocol_Binary;
+            config->startByte = 0xFF;
+            config->lengthBytes = 1;
+            config->confirmationFlag = 0x80;
+            break;
+
+        case WE_Emulator_Module_Skoll_I:
+            config->protocol = WE_Emulator_Protocol_EZSerial;
+            break;
+
+        case WE_Emulator_Module_Calypso:
+        case WE_Emulator_Module_StephanoI:
+        case WE_Emulator_Module_AdrasteaI:
+        case WE_Emulator_Module_DaphnisI:
+            config->protocol = WE_Emulator_Protocol_AT;
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+bool WE_Emulator_Init(const WE_Emulator_Config_t* config)
+{
+    if ((config == NULL) || running)
+    {
+        return false;
+    }
+
+    switch (config->protocol)
+    {
+        case WE_Emulator_Protocol_Binary:
+            if ((config->lengthBytes != 1) && (config->lengthBytes != 2))
+            {
+                return false;
+            }
+            break;
+
+        case WE_Emulator_Protocol_EZSerial:
+            break;
+
+        case WE_Emulator_Protocol_AT:
+            if ((config->lineTerminator == NULL) || (config->okResponse == NULL))
+            {
+                return false;
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    pthread_once(&emulatorConditionOnce, WE_Emulator_InitCondition);
+
+    pthread_mutex_lock(&emulatorMutex);
+    emulatorConfig = *config;
+    ruleCount = 0;
+    requestHandler = NULL;
+    memset(&statistics, 0, sizeof(statistics));
+    queueCount = 0;
+    periodicActive = false;
+    requestLength = 0;
+    requestExpectedLength = 0;
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return true;
+}
+
+bool WE_Emulator_AddRule(const WE_Emulator_Rule_t* rule)
+{
+    if ((rule == NULL) || ((rule->responseCount > 0) && (rule->responses == NULL)) || (ruleCount >= WE_EMULATOR_MAX_RULES))
+    {
+        return false;
+    }
+
+    rules[ruleCount++] = rule;
+    return true;
+}
+
+void WE_Emulator_ClearRules() { ruleCount = 0; }
+
+void WE_Emulator_SetRequestHandler(WE_Emulator_RequestHandler_t handler) { requestHandler = handler; }
+
+bool WE_Emulator_Send(const WE_Emulator_Frame_t* frame)
+{
+    if (frame == NULL)
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&emulatorMutex);
+    bool ret = WE_Emulator_EnqueueFrameLocked(frame, WE_Emulator_Now() + (uint64_t)frame->delayUs * 1000ull);
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return ret;
+}
+
+bool WE_Emulator_StartPeriodicFrame(const WE_Emulator_Frame_t* frame, uint32_t periodUs, uint32_t count)
+{
+    if ((frame == NULL) || (periodUs == 0))
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&emulatorMutex);
+    bool ret = WE_Emulator_EncodeFrame(frame, &periodicEntry);
+    if (ret)
+    {
+        periodicNextTime = WE_Emulator_Now() + (uint64_t)frame->delayUs * 1000ull;
+        periodicPeriod = (uint64_t)periodUs * 1000ull;
+        periodicRemaining = count;
+        periodicActive = true;
+        pthread_cond_broadcast(&emulatorCondition);
+    }
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return ret;
+}
+
+void WE_Emulator_StopPeriodicFrame()
+{
+    pthread_mutex_lock(&emulatorMutex);
+    periodicActive = false;
+    pthread_mutex_unlock(&emulatorMutex);
+}
+
+bool WE_Emulator_WaitIdle(uint32_t timeoutMs)
+{
+    struct timespec ts = WE_Emulator_ToTimespec(WE_Emulator_Now() + (uint64_t)timeoutMs * 1000000ull);
+
+    pthread_mutex_lock(&emulatorMutex);
+    bool idle = true;
+    while ((queueCount > 0) || transferRunning)
+    {
+        if (!running || (pthread_cond_timedwait(&emulatorCondition, &emulatorMutex, &ts) != 0))
+        {
+            idle = (queueCount == 0) && !transferRunning;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return idle;
+}
+
+void WE_Emulator_GetStatistics(WE_Emulator_Statistics_t* statisticsP)
+{
+    if (statisticsP == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&emulatorMutex);
+    *statisticsP = statistics;
+    pthread_mutex_unlock(&emulatorMutex);
+}
+
+void WE_Emulator_ResetStatistics()
+{
+    pthread_mutex_lock(&emulatorMutex);
+    memset(&statistics, 0, sizeof(statistics));
+    pthread_mutex_unlock(&emulatorMutex);
+}
+
+bool WE_Emulator_UART_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandler)
+{
+    (void)flowControl;
+
+    if (running)
+    {
+        return false;
+    }
+
+    pthread_once(&emulatorConditionOnce, WE_Emulator_InitCondition);
+
+    uartBaudrate = baudrate;
+    uartBitsPerByte = (parity == WE_Parity_None) ? 10 : 11;
+    rxByteHandlerP = rxByteHandler;
+    lineFreeTime = 0;
+    transferRunning = false;
+    requestLength = 0;
+    requestExpectedLength = 0;
+
+    running = true;
+    if (0 != pthread_create(&emulatorThread, NULL, WE_Emulator_Thread, NULL))
+    {
+        running = false;
+        return false;
+    }
+
+    return true;
+}
+
+bool WE_Emulator_UART_DeInit()
+{
+    if (!running)
+    {
+        return true;
+    }
+
+    pthread_mutex_lock(&emulatorMutex);
+    running = false;
+    pthread_cond_broadcast(&emulatorCondition);
+    pthread_mutex_unlock(&emulatorMutex);
+
+    pthread_join(emulatorThread, NULL);
+
+    pthread_mutex_lock(&emulatorMutex);
+    queueCount = 0;
+    periodicActive = false;
+    pthread_mutex_unlock(&emulatorMutex);
+
+    return true;
+}
+
+bool WE_Emulator_UART_Transmit(const uint8_t* data, uint16_t length)
+{
+    if (!running || (data == NULL))
+    {
+        return false;
+    }
+
+    uint64_t transferTime = WE_Emulator_GetTransferTime(length);
+    if (transferTime > 0)
+    {
+        WE_Emulator_SleepUntil(WE_Emulator_Now() + transferTime);
+    }
+
+    pthread_mutex_lock(&emulatorMutex);
+    statistics.bytesReceived += length;
+    pthread_mutex_unlock(&emulatorMutex);
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        switch (emulatorConfig.protocol)
+        {
+            case WE_Emulator_Protocol_Binary:
+                WE_Emulator_ParseBinaryByte(data[i]);
+                break;
+
+            case WE_Emulator_Protocol_EZSerial:
+                WE_Emulator_ParseEZSerialByte(data[i]);
+                break;
+
+            case WE_Emulator_Protocol_AT:
+                WE_Emulator_ParseATByte(data[i]);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
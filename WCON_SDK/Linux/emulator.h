@@ -0,0 +1,312 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Radio module emulator for the Linux host platform.
+ *
+ * @details Emulates the serial interface of a radio module, so that the drivers can be run on a workstation
+ * without hardware (e.g. for measuring request/confirmation round-trip times, throughput and the behavior
+ * in case of a large number of events). The emulator implements the functions of a WE_UART_t and understands
+ * the following protocols:
+ * - Binary frames consisting of start byte, command, length, payload and XOR checksum (e.g. ProteusIII, ThyoneI, TarvosIII, Metis)
+ * - The EZ-Serial binary API (Skoll_I)
+ * - Line based AT commands (e.g. Calypso, StephanoI, AdrasteaI, DaphnisI)
+ *
+ * Requests received from the driver are answered using the rules added with WE_Emulator_AddRule(). If no rule
+ * matches, a default confirmation is sent (binary: confirmation with status byte 0x00, EZ-Serial: response with
+ * result 0x0000, AT: "OK"). The transfer time of requests and responses on the serial line is emulated using the
+ * baud rate passed to WE_Emulator_UART_Init().
+ *
+ * Received data is passed to the driver by the emulator's thread (the same context in which the Linux platform
+ * driver's receive thread passes data to the driver if WE_UART_RX_DEFERRED is not defined).
+ *
+ * Usage:
+ * @code
+ * WE_Emulator_Config_t config;
+ * WE_Emulator_GetDefaultConfig(WE_Emulator_Module_ProteusIII, &config);
+ * config.confirmationDelayUs = 2000;
+ * WE_Emulator_Init(&config);
+ *
+ * WE_UART_t uart = {.uartInit = WE_Emulator_UART_Init, .uartDeinit = WE_Emulator_UART_DeInit, .uartTransmit = WE_Emulator_UART_Transmit, .baudrate = 115200};
+ * ProteusIII_Init(&uart, &pins, ProteusIII_OperationMode_CommandMode, callbacks);
+ * @endcode
+ */
+
+#ifndef EMULATOR_H_INCLUDED
+#define EMULATOR_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <global/global_types.h>
+
+#ifndef WE_EMULATOR_MAX_FRAME_SIZE
+/**
+ * @brief Maximum size of a frame (request, response or event) including header and checksum.
+ */
+#define WE_EMULATOR_MAX_FRAME_SIZE 2048
+#endif
+
+#ifndef WE_EMULATOR_QUEUE_SIZE
+/**
+ * @brief Maximum number of frames waiting to be sent to the driver.
+ */
+#define WE_EMULATOR_QUEUE_SIZE 64
+#endif
+
+#ifndef WE_EMULATOR_MAX_RULES
+/**
+ * @brief Maximum number of rules.
+ */
+#define WE_EMULATOR_MAX_RULES 32
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Protocols supported by the emulator.
+ */
+typedef enum WE_Emulator_Protocol_t
+{
+    WE_Emulator_Protocol_Binary = (uint8_t)0,   /**< Start byte, command, length, payload, XOR checksum */
+    WE_Emulator_Protocol_EZSerial = (uint8_t)1, /**< EZ-Serial binary API */
+    WE_Emulator_Protocol_AT = (uint8_t)2        /**< Line based AT commands */
+} WE_Emulator_Protocol_t;
+
+/**
+ * @brief Radio modules for which a default configuration is available (see WE_Emulator_GetDefaultConfig()).
+ */
+typedef enum WE_Emulator_Module_t
+{
+    WE_Emulator_Module_ProteusIII,
+    WE_Emulator_Module_ThyoneI,
+    WE_Emulator_Module_TarvosIII,
+    WE_Emulator_Module_Metis,
+    WE_Emulator_Module_Skoll_I,
+    WE_Emulator_Module_Calypso,
+    WE_Emulator_Module_StephanoI,
+    WE_Emulator_Module_AdrasteaI,
+    WE_Emulator_Module_DaphnisI,
+    WE_Emulator_Module_Count
+} WE_Emulator_Module_t;
+
+/**
+ * @brief Emulator configuration.
+ */
+typedef struct WE_Emulator_Config_t
+{
+    WE_Emulator_Protocol_t protocol; /**< Protocol spoken by the emulated module */
+    uint8_t startByte;               /**< Binary protocol: start byte of a frame */
+    uint8_t lengthBytes;             /**< Binary protocol: number of length bytes (1 or 2, little endian) */
+    uint8_t confirmationFlag;        /**< Binary protocol: bits set in the command byte of a confirmation */
+    const char* lineTerminator;      /**< AT protocol: string appended to each line sent to the driver */
+    const char* okResponse;          /**< AT protocol: line sent if no rule matches a request */
+    bool echo;                       /**< AT protocol: echo each request line before the response */
+    uint32_t confirmationDelayUs;    /**< Delay between the end of a request and the default confirmation in microseconds */
+    bool pacing;                     /**< Emulate the transfer time of each byte on the serial line (10 or 11 bit times per byte) */
+} WE_Emulator_Config_t;
+
+/**
+ * @brief A frame (response or event) to be sent to the driver.
+ */
+typedef struct WE_Emulator_Frame_t
+{
+    uint32_t delayUs;    /**< Delay in microseconds, relative to the end of the request (responses) or the time of sending (events) */
+    uint16_t command;    /**< Binary protocol: command byte, EZ-Serial: (group << 8) | id, AT: unused */
+    bool isEvent;        /**< EZ-Serial: true for an event packet, false for a response packet */
+    const uint8_t* data; /**< Binary/EZ-Serial: payload, AT: line without line terminator */
+    uint16_t length;     /**< Length of data (AT: 0 to use the string length of data) */
+} WE_Emulator_Frame_t;
+
+/**
+ * @brief Rule describing how the emulated module answers a request.
+ */
+typedef struct WE_Emulator_Rule_t
+{
+    uint16_t command;                     /**< Binary protocol: command byte, EZ-Serial: (group << 8) | id of the request */
+    const char* atPrefix;                 /**< AT protocol: prefix of the request line (e.g. "AT+wlanConnect") */
+    const WE_Emulator_Frame_t* responses; /**< Frames sent in response to the request (in order) */
+    uint8_t responseCount;                /**< Number of frames in responses */
+} WE_Emulator_Rule_t;
+
+/**
+ * @brief Is called for each request received from the driver before the rules are evaluated.
+ *
+ * Responses can be sent from within the handler using WE_Emulator_Send().
+ *
+ * @param[in] command Binary protocol: command byte, EZ-Serial: (group << 8) | id, AT: 0
+ * @param[in] data Binary/EZ-Serial: payload of the request, AT: request line (null terminated, without line terminator)
+ * @param[in] length Length of data
+ *
+ * @return True if the request has been handled (no rule is evaluated and no default confirmation is sent), false otherwise
+ */
+typedef bool (*WE_Emulator_RequestHandler_t)(uint16_t command, const uint8_t* data, uint16_t length);
+
+/**
+ * @brief Emulator statistics.
+ */
+typedef struct WE_Emulator_Statistics_t
+{
+    uint32_t requestCount;        /**< Number of valid requests received from the driver */
+    uint32_t invalidRequestCount; /**< Number of requests discarded because of an invalid checksum or size */
+    uint32_t frameCount;          /**< Number of frames sent to the driver */
+    uint32_t droppedFrameCount;   /**< Number of frames dropped because the queue was full */
+    uint64_t bytesReceived;       /**< Number of bytes received from the driver */
+    uint64_t bytesSent;           /**< Number of bytes sent to the driver */
+} WE_Emulator_Statistics_t;
+
+/**
+ * @brief Fills config with the default configuration for the provided radio module.
+ *
+ * @param[in] module Radio module to be emulated
+ * @param[out] config Configuration
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_GetDefaultConfig(WE_Emulator_Module_t module, WE_Emulator_Config_t* config);
+
+/**
+ * @brief Initializes the emulator (removes all rules and resets the statistics).
+ *
+ * Must be called before WE_Emulator_UART_Init().
+ *
+ * @param[in] config Configuration
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_Init(const WE_Emulator_Config_t* config);
+
+/**
+ * @brief Adds a rule describing the response to a request.
+ *
+ * If several rules match a request, the rule added first is used.
+ *
+ * @param[in] rule Rule to be added (the rule and the frames it points to must remain valid while the emulator is used)
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_AddRule(const WE_Emulator_Rule_t* rule);
+
+/**
+ * @brief Removes all rules.
+ */
+extern void WE_Emulator_ClearRules();
+
+/**
+ * @brief Sets a handler to be called for each request received from the driver.
+ *
+ * @param[in] handler Request handler (NULL to remove the handler)
+ */
+extern void WE_Emulator_SetRequestHandler(WE_Emulator_RequestHandler_t handler);
+
+/**
+ * @brief Sends a frame (e.g. an unsolicited event) to the driver.
+ *
+ * @param[in] frame Frame to be sent (the data is copied)
+ *
+ * @return True if the frame has been queued, false otherwise
+ */
+extern bool WE_Emulator_Send(const WE_Emulator_Frame_t* frame);
+
+/**
+ * @brief Periodically sends a frame to the driver (e.g. for testing the behavior in case of a large number of events).
+ *
+ * Replaces a previously started periodic frame.
+ *
+ * @param[in] frame Frame to be sent (the data is copied, frame->delayUs is the delay until the frame is sent for the first time)
+ * @param[in] periodUs Period in microseconds
+ * @param[in] count Number of frames to be sent (0 for no limit)
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_StartPeriodicFrame(const WE_Emulator_Frame_t* frame, uint32_t periodUs, uint32_t count);
+
+/**
+ * @brief Stops sending the periodic frame.
+ */
+extern void WE_Emulator_StopPeriodicFrame();
+
+/**
+ * @brief Waits until all queued frames have been sent to the driver.
+ *
+ * @param[in] timeoutMs Timeout in milliseconds
+ *
+ * @return True if all frames have been sent, false if the timeout has expired
+ */
+extern bool WE_Emulator_WaitIdle(uint32_t timeoutMs);
+
+/**
+ * @brief Returns the emulator statistics.
+ *
+ * @param[out] statistics Statistics
+ */
+extern void WE_Emulator_GetStatistics(WE_Emulator_Statistics_t* statistics);
+
+/**
+ * @brief Resets the emulator statistics.
+ */
+extern void WE_Emulator_ResetStatistics();
+
+/**
+ * @brief Starts the emulated UART (WE_UART_t::uartInit).
+ *
+ * @param[in] baudrate Baud rate used for emulating the transfer time
+ * @param[in] flowControl Flow control (unused)
+ * @param[in] parity Parity bit configuration (used for emulating the transfer time)
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_UART_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP);
+
+/**
+ * @brief Stops the emulated UART (WE_UART_t::uartDeinit).
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_UART_DeInit();
+
+/**
+ * @brief Passes data sent by the driver to the emulated module (WE_UART_t::uartTransmit).
+ *
+ * Blocks for the transfer time of the data if pacing is enabled.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Emulator_UART_Transmit(const uint8_t* data, uint16_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EMULATOR_H_INCLUDED */
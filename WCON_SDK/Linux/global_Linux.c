@@ -0,0 +1,898 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Linux host platform driver.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "global_Linux.h"
+
+#include <global/global.h>
+#include <global_platform.h>
+
+#if defined(WE_UART_RX_DEFERRED)
+#include <ringbuffer.h>
+
+#ifndef WE_UART_RX_RING_SIZE
+/**
+ * @brief Size of the per-UART receive ring buffer used if WE_UART_RX_DEFERRED is defined (must be a power of two).
+ */
+#define WE_UART_RX_RING_SIZE 1024
+#endif
+#endif
+
+/**
+ * @brief Maximum number of bytes read from the device at once.
+ */
+#define WE_UART_RX_CHUNK_SIZE 256
+
+typedef struct
+{
+    /**
+	 * @brief Path of the device to be opened on initialization (NULL if fd has been set by the user).
+	 */
+    const char* devicePath;
+
+    /**
+	 * @brief File descriptor used for communicating with radio module (-1 if not initialized).
+	 */
+    int fd;
+
+    /**
+	 * @brief File descriptor provided by the user via WE_UARTx_SetFileDescriptor() (-1 if not set).
+	 */
+    int userFd;
+
+    /**
+	 * @brief Pipe used to stop the receive thread.
+	 */
+    int stopPipe[2];
+
+    /**
+	 * @brief Thread reading data received from radio module.
+	 */
+    pthread_t rxThread;
+
+    /**
+	 * @brief Pointer to the function to be called when one or several bytes have been received via UART
+	 */
+    WE_UART_HandleRxByte_t* rxByteHandlerP;
+
+#if defined(WE_UART_RX_DEFERRED)
+    /**
+	 * @brief Ring buffer for received data, filled by the receive thread and drained by WE_UART_Process().
+	 */
+    WE_RingBuffer_t rxRing;
+
+    /**
+	 * @brief Storage of rxRing.
+	 */
+    uint8_t rxRingBuffer[WE_UART_RX_RING_SIZE];
+
+    /**
+	 * @brief Is set to true while WE_UART_Process() is passing data to rxByteHandlerP (prevents reentrant processing).
+	 */
+    bool rxProcessing;
+#endif
+
+} WE_UART_Internal_t;
+
+WE_UART_Internal_t WE_UART1_Internal = {
+    .devicePath = NULL,
+    .fd = -1,
+    .userFd = -1,
+    .stopPipe = {-1, -1},
+    .rxByteHandlerP = NULL,
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
+};
+
+WE_UART_Internal_t WE_UART2_Internal = {
+    .devicePath = NULL,
+    .fd = -1,
+    .userFd = -1,
+    .stopPipe = {-1, -1},
+    .rxByteHandlerP = NULL,
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
+};
+
+/**
+ * @brief Protects the signaled flag of events waited for by WE_WaitEvent().
+ */
+static pthread_mutex_t eventMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief Is broadcast when an event has been signaled or (if WE_UART_RX_DEFERRED is defined) data has been received (uses CLOCK_MONOTONIC).
+ */
+static pthread_cond_t eventCondition;
+
+static pthread_once_t eventConditionOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Recursive mutex serializing the critical sections entered using WE_EnterCritical().
+ */
+static pthread_mutex_t criticalMutex;
+
+/**
+ * @brief Used to initialize criticalMutex on first use.
+ */
+static pthread_once_t criticalMutexOnce = PTHREAD_ONCE_INIT;
+
+/**
+ * @brief Time stamp of the first call to one of the tick functions (tick values are relative to this time stamp).
+ */
+static struct timespec startTime = {0, 0};
+
+/**
+ * @brief Function to be called whenever an output pin is set.
+ */
+static WE_Linux_PinChangeCallback_t pinChangeCallback = NULL;
+
+/*              Functions              */
+
+/**
+ * @brief Converts a baud rate to the corresponding termios speed constant.
+ *
+ * @param[in] baudrate Baud rate
+ * @param[out] speedP Speed constant
+ *
+ * @return True if the baud rate is supported, false otherwise
+ */
+static bool WE_UART_GetSpeed(uint32_t baudrate, speed_t* speedP)
+{
+    switch (baudrate)
+    {
+        case 1200:
+            *speedP = B1200;
+            return true;
+        case 2400:
+            *speedP = B2400;
+            return true;
+        case 4800:
+            *speedP = B4800;
+            return true;
+        case 9600:
+            *speedP = B9600;
+            return true;
+        case 19200:
+            *speedP = B19200;
+            return true;
+        case 38400:
+            *speedP = B38400;
+            return true;
+        case 57600:
+            *speedP = B57600;
+            return true;
+        case 115200:
+            *speedP = B115200;
+            return true;
+        case 230400:
+            *speedP = B230400;
+            return true;
+        case 460800:
+            *speedP = B460800;
+            return true;
+        case 921600:
+            *speedP = B921600;
+            return true;
+        case 1000000:
+            *speedP = B1000000;
+            return true;
+        case 2000000:
+            *speedP = B2000000;
+            return true;
+        case 3000000:
+            *speedP = B3000000;
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Applies baud rate, parity and flow control to a terminal device.
+ *
+ * @return True if request succeeded, false otherwise
+ */
+static bool WE_UART_ConfigureTerminal(int fd, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity)
+{
+    struct termios tty;
+    if (tcgetattr(fd, &tty) != 0)
+    {
+        return false;
+    }
+
+    speed_t speed;
+    if (!WE_UART_GetSpeed(baudrate, &speed))
+    {
+        return false;
+    }
+
+    cfmakeraw(&tty);
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+
+    tty.c_cflag |= (CLOCAL | CREAD);
+    tty.c_cflag &= ~CSTOPB;
+
+    switch (parity)
+    {
+        case WE_Parity_None:
+            tty.c_cflag &= ~(PARENB | PARODD);
+            break;
+        case WE_Parity_Odd:
+            tty.c_cflag |= (PARENB | PARODD);
+            break;
+        case WE_Parity_Even:
+            tty.c_cflag |= PARENB;
+            tty.c_cflag &= ~PARODD;
+            break;
+        default:
+            return false;
+    }
+
+    /* Linux only supports RTS and CTS flow control in combination */
+    if (flowControl == WE_FlowControl_NoFlowControl)
+    {
+        tty.c_cflag &= ~CRTSCTS;
+    }
+    else
+    {
+        tty.c_cflag |= CRTSCTS;
+    }
+
+    /* Blocking read returning as soon as at least one byte is available */
+    tty.c_cc[VMIN] = 1;
+    tty.c_cc[VTIME] = 0;
+
+    if (tcsetattr(fd, TCSANOW, &tty) != 0)
+    {
+        return false;
+    }
+
+    tcflush(fd, TCIOFLUSH);
+    return true;
+}
+
+/**
+ * @brief Initializes eventCondition (called once).
+ */
+static void WE_InitEventCondition()
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&eventCondition, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/**
+ * @brief Initializes the (recursive) mutex used by WE_EnterCritical().
+ */
+static void WE_InitCriticalMutex()
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&criticalMutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+}
+
+/**
+ * @brief Is called when one or more bytes have been received from the radio module.
+ *
+ * If WE_UART_RX_DEFERRED is defined, the data is only appended to the UART's receive ring
+ * buffer and handed over to the driver by WE_UART_Process(). Otherwise, the driver's byte
+ * handler is called directly (i.e. in the context of the receive thread).
+ *
+ * @param uartInternal UART that has received the data
+ * @param data Received data
+ * @param size Number of bytes received
+ */
+static void WE_UART_OnDataReceived(WE_UART_Internal_t* uartInternal, uint8_t* data, size_t size)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_RingBuffer_Write(&uartInternal->rxRing, data, size);
+
+    /* Wake up WE_WaitEvent(), which processes the received data */
+    pthread_once(&eventConditionOnce, WE_InitEventCondition);
+    pthread_mutex_lock(&eventMutex);
+    pthread_cond_broadcast(&eventCondition);
+    pthread_mutex_unlock(&eventMutex);
+#else
+    (*uartInternal->rxByteHandlerP)(data, size);
+#endif
+}
+
+/**
+ * @brief Receive thread - reads data from the device until WE_UART_DeInitInternal() is called.
+ *
+ * @param arg UART (WE_UART_Internal_t*)
+ */
+static void* WE_UART_RxThread(void* arg)
+{
+    WE_UART_Internal_t* uartInternal = (WE_UART_Internal_t*)arg;
+    uint8_t buffer[WE_UART_RX_CHUNK_SIZE];
+
+    struct pollfd fds[2] = {
+        {.fd = uartInternal->fd, .events = POLLIN},
+        {.fd = uartInternal->stopPipe[0], .events = POLLIN},
+    };
+
+    while (true)
+    {
+        if (poll(fds, 2, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            break;
+        }
+
+        if (fds[1].revents != 0)
+        {
+            /* Stop requested */
+            break;
+        }
+
+        if (fds[0].revents & POLLIN)
+        {
+            ssize_t count = read(uartInternal->fd, buffer, sizeof(buffer));
+            if (count > 0)
+            {
+                WE_UART_OnDataReceived(uartInternal, buffer, (size_t)count);
+            }
+            else if ((count == 0) || ((errno != EINTR) && (errno != EAGAIN)))
+            {
+                /* Peer has closed the connection */
+                break;
+            }
+        }
+        else if (fds[0].revents & (POLLHUP | POLLERR | POLLNVAL))
+        {
+            break;
+        }
+    }
+
+    return NULL;
+}
+
+static bool WE_UART_InitInternal(WE_UART_Internal_t* uartInternal, uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
+{
+    if ((uartInternal->fd >= 0) || (rxByteHandlerP == NULL))
+    {
+        return false;
+    }
+
+    uartInternal->rxByteHandlerP = rxByteHandlerP;
+
+#if defined(WE_UART_RX_DEFERRED)
+    if (!WE_RingBuffer_Init(&uartInternal->rxRing, uartInternal->rxRingBuffer, WE_UART_RX_RING_SIZE))
+    {
+        return false;
+    }
+#endif
+
+    int fd;
+    if (uartInternal->userFd >= 0)
+    {
+        fd = uartInternal->userFd;
+    }
+    else if (uartInternal->devicePath != NULL)
+    {
+        fd = open(uartInternal->devicePath, O_RDWR | O_NOCTTY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        /* Neither device nor file descriptor have been configured */
+        return false;
+    }
+
+    if (isatty(fd) && !WE_UART_ConfigureTerminal(fd, baudrate, flowControl, parity))
+    {
+        if (fd != uartInternal->userFd)
+        {
+            close(fd);
+        }
+        return false;
+    }
+
+    if (pipe(uartInternal->stopPipe) != 0)
+    {
+        if (fd != uartInternal->userFd)
+        {
+            close(fd);
+        }
+        return false;
+    }
+
+    uartInternal->fd = fd;
+
+    if (pthread_create(&uartInternal->rxThread, NULL, WE_UART_RxThread, uartInternal) != 0)
+    {
+        close(uartInternal->stopPipe[0]);
+        close(uartInternal->stopPipe[1]);
+        uartInternal->stopPipe[0] = -1;
+        uartInternal->stopPipe[1] = -1;
+        if (fd != uartInternal->userFd)
+        {
+            close(fd);
+        }
+        uartInternal->fd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+static bool WE_UART_DeInitInternal(WE_UART_Internal_t* uartInternal)
+{
+    if (uartInternal->fd < 0)
+    {
+        return true;
+    }
+
+    /* Stop receive thread */
+    const uint8_t stop = 0;
+    if (write(uartInternal->stopPipe[1], &stop, 1) == 1)
+    {
+        pthread_join(uartInternal->rxThread, NULL);
+    }
+
+    close(uartInternal->stopPipe[0]);
+    close(uartInternal->stopPipe[1]);
+    uartInternal->stopPipe[0] = -1;
+    uartInternal->stopPipe[1] = -1;
+
+    if (uartInternal->fd != uartInternal->userFd)
+    {
+        close(uartInternal->fd);
+    }
+    uartInternal->fd = -1;
+    uartInternal->rxByteHandlerP = NULL;
+
+    return true;
+}
+
+static bool WE_UART_TransmitInternal(WE_UART_Internal_t* uartInternal, const uint8_t* data, uint16_t length)
+{
+    if (uartInternal->fd < 0)
+    {
+        return false;
+    }
+
+    while (length > 0)
+    {
+        ssize_t written = write(uartInternal->fd, data, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        length -= (uint16_t)written;
+    }
+
+    if (isatty(uartInternal->fd))
+    {
+        /* Wait until all data has been transmitted (same behavior as on target) */
+        tcdrain(uartInternal->fd);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Returns the receive overflow counters of a UART (see WE_UART_GetRxOverflowCounts_t).
+ */
+static void WE_UART_GetRxOverflowCountsInternal(WE_UART_Internal_t* uartInternal, uint32_t* droppedBytesP, uint32_t* dmaOverrunsP)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    *droppedBytesP = uartInternal->rxRing.droppedBytes;
+#else
+    *droppedBytesP = 0;
+#endif
+    *dmaOverrunsP = 0;
+}
+
+bool WE_UART1_SetDevice(const char* devicePath)
+{
+    if (WE_UART1_Internal.fd >= 0)
+    {
+        return false;
+    }
+    WE_UART1_Internal.devicePath = devicePath;
+    WE_UART1_Internal.userFd = -1;
+    return true;
+}
+
+bool WE_UART1_SetFileDescriptor(int fd)
+{
+    if (WE_UART1_Internal.fd >= 0)
+    {
+        return false;
+    }
+    WE_UART1_Internal.devicePath = NULL;
+    WE_UART1_Internal.userFd = fd;
+    return true;
+}
+
+bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP) { return WE_UART_InitInternal(&WE_UART1_Internal, baudrate, flowControl, parity, rxByteHandlerP); }
+
+bool WE_UART1_DeInit() { return WE_UART_DeInitInternal(&WE_UART1_Internal); }
+
+bool WE_UART1_Transmit(const uint8_t* data, uint16_t length) { return WE_UART_TransmitInternal(&WE_UART1_Internal, data, length); }
+
+void WE_UART1_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART1_Internal, droppedBytesP, dmaOverrunsP); }
+
+bool WE_UART2_SetDevice(const char* devicePath)
+{
+    if (WE_UART2_Internal.fd >= 0)
+    {
+        return false;
+    }
+    WE_UART2_Internal.devicePath = devicePath;
+    WE_UART2_Internal.userFd = -1;
+    return true;
+}
+
+bool WE_UART2_SetFileDescriptor(int fd)
+{
+    if (WE_UART2_Internal.fd >= 0)
+    {
+        return false;
+    }
+    WE_UART2_Internal.devicePath = NULL;
+    WE_UART2_Internal.userFd = fd;
+    return true;
+}
+
+bool WE_UART2_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP) { return WE_UART_InitInternal(&WE_UART2_Internal, baudrate, flowControl, parity, rxByteHandlerP); }
+
+bool WE_UART2_DeInit() { return WE_UART_DeInitInternal(&WE_UART2_Internal); }
+
+bool WE_UART2_Transmit(const uint8_t* data, uint16_t length) { return WE_UART_TransmitInternal(&WE_UART2_Internal, data, length); }
+
+void WE_UART2_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART2_Internal, droppedBytesP, dmaOverrunsP); }
+
+#if defined(WE_UART_RX_DEFERRED)
+/**
+ * @brief Passes all data stored in the UART's receive ring buffer to the driver's byte handler.
+ *
+ * @param uartInternal UART to be processed
+ */
+static void WE_UART_ProcessInternal(WE_UART_Internal_t* uartInternal)
+{
+    if (uartInternal->rxProcessing)
+    {
+        /* Called from within the byte handler (e.g. by a blocking function called from a driver callback) */
+        return;
+    }
+
+    uartInternal->rxProcessing = true;
+
+    uint8_t* data;
+    uint32_t length;
+    while ((uartInternal->rxByteHandlerP != NULL) && ((length = WE_RingBuffer_Peek(&uartInternal->rxRing, &data)) > 0))
+    {
+        (*uartInternal->rxByteHandlerP)(data, length);
+        WE_RingBuffer_Release(&uartInternal->rxRing, length);
+    }
+
+    uartInternal->rxProcessing = false;
+}
+
+/**
+ * @brief Returns true if received data is waiting to be passed to the driver by WE_UART_ProcessInternal().
+ */
+static bool WE_UART_IsRxDataPending(WE_UART_Internal_t* uartInternal) { return !uartInternal->rxProcessing && (uartInternal->rxByteHandlerP != NULL) && (WE_RingBuffer_GetCount(&uartInternal->rxRing) > 0); }
+#endif /* defined(WE_UART_RX_DEFERRED) */
+
+void WE_UART_Process()
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_UART_ProcessInternal(&WE_UART1_Internal);
+    WE_UART_ProcessInternal(&WE_UART2_Internal);
+#endif
+}
+
+void WE_Platform_Init(void)
+{
+    if ((startTime.tv_sec == 0) && (startTime.tv_nsec == 0))
+    {
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+    }
+}
+
+void WE_Error_Handler(void)
+{
+    fprintf(stderr, "WE_Error_Handler() called\n");
+    abort();
+}
+
+void WE_Linux_SetPinChangeCallback(WE_Linux_PinChangeCallback_t callback) { pinChangeCallback = callback; }
+
+bool WE_InitPins(WE_Pin_t pins[], uint8_t numPins)
+{
+    for (uint8_t i = 0; i < numPins; i++)
+    {
+        if (IS_WE_PIN_UNDEFINED(pins[i]))
+        {
+            /* Unused */
+            continue;
+        }
+
+        switch (pins[i].type)
+        {
+            case WE_Pin_Type_Output:
+            {
+                if (!WE_SetPin(pins[i], pins[i].initial_value.output))
+                {
+                    return false;
+                }
+                break;
+            }
+            case WE_Pin_Type_Input:
+            {
+                WE_Linux_Pin_t* linuxPin = (WE_Linux_Pin_t*)pins[i].pin_def;
+                switch (pins[i].initial_value.input_pull)
+                {
+                    case WE_Pin_PullType_No:
+                        break;
+                    case WE_Pin_PullType_Up:
+                        linuxPin->level = WE_Pin_Level_High;
+                        break;
+                    case WE_Pin_PullType_Down:
+                        linuxPin->level = WE_Pin_Level_Low;
+                        break;
+                    default:
+                        return false;
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool WE_Reconfigure(WE_Pin_t pin)
+{
+    if (IS_WE_PIN_UNDEFINED(pin))
+    {
+        return false;
+    }
+
+    if (!WE_DeinitPins(&pin, 1))
+    {
+        return false;
+    }
+
+    if (!WE_InitPins(&pin, 1))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool WE_DeinitPins(WE_Pin_t pins[], uint8_t numPins)
+{
+    UNUSED(pins);
+    UNUSED(numPins);
+    return true;
+}
+
+bool WE_SetPin(WE_Pin_t pin, WE_Pin_Level_t out)
+{
+    if (IS_WE_PIN_UNDEFINED(pin) || (pin.type != WE_Pin_Type_Output))
+    {
+        return false;
+    }
+
+    switch (out)
+    {
+        case WE_Pin_Level_High:
+        case WE_Pin_Level_Low:
+            break;
+        default:
+            return false;
+    }
+
+    WE_Linux_Pin_t* linuxPin = (WE_Linux_Pin_t*)pin.pin_def;
+    linuxPin->level = out;
+
+    if (pinChangeCallback != NULL)
+    {
+        pinChangeCallback(linuxPin, out);
+    }
+
+    return true;
+}
+
+bool WE_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP)
+{
+    if (IS_WE_PIN_UNDEFINED(pin) || (pin_levelP == NULL))
+    {
+        return false;
+    }
+
+    *pin_levelP = ((WE_Linux_Pin_t*)pin.pin_def)->level;
+    return true;
+}
+
+/**
+ * @brief Returns the time elapsed since platform initialization in nanoseconds.
+ */
+static uint64_t WE_GetElapsedNanoseconds()
+{
+    WE_Platform_Init();
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)(now.tv_sec - startTime.tv_sec) * 1000000000ull + (uint64_t)now.tv_nsec - (uint64_t)startTime.tv_nsec;
+}
+
+/**
+ * @brief Returns the absolute time (CLOCK_MONOTONIC) at which the given number of nanoseconds have elapsed.
+ */
+static struct timespec WE_GetDeadline(uint64_t delay)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += (time_t)(delay / 1000000000ull);
+    deadline.tv_nsec += (long)(delay % 1000000000ull);
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+/**
+ * @brief Sleeps for the given number of nanoseconds.
+ *
+ * An absolute deadline is used, so the delay is not extended if the sleep is interrupted by a signal.
+ * If WE_UART_RX_DEFERRED is defined, received data is processed while waiting.
+ */
+static void WE_SleepNanoseconds(uint64_t delay)
+{
+    struct timespec deadline = WE_GetDeadline(delay);
+
+#if defined(WE_UART_RX_DEFERRED)
+    /* Poll the receive ring buffers in small steps until the deadline has been reached */
+    while (true)
+    {
+        WE_UART_Process();
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if ((now.tv_sec > deadline.tv_sec) || ((now.tv_sec == deadline.tv_sec) && (now.tv_nsec >= deadline.tv_nsec)))
+        {
+            break;
+        }
+
+        /* Sleep for at most 100us (or the remaining time, if shorter) */
+        struct timespec step = {.tv_sec = 0, .tv_nsec = 100000};
+        if ((now.tv_sec == deadline.tv_sec) && (deadline.tv_nsec - now.tv_nsec < step.tv_nsec))
+        {
+            step.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+        }
+        nanosleep(&step, NULL);
+    }
+#else
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+    {
+    }
+#endif
+}
+
+void WE_Delay(uint32_t delay) { WE_SleepNanoseconds((uint64_t)delay * 1000000ull); }
+
+void WE_DelayMicroseconds(uint32_t delay) { WE_SleepNanoseconds((uint64_t)delay * 1000ull); }
+
+bool WE_WaitEvent(WE_Event_t* event, uint32_t timeoutMs)
+{
+    pthread_once(&eventConditionOnce, WE_InitEventCondition);
+
+    struct timespec deadline = WE_GetDeadline((uint64_t)timeoutMs * 1000000ull);
+
+    pthread_mutex_lock(&eventMutex);
+    while (!event->signaled)
+    {
+#if defined(WE_UART_RX_DEFERRED)
+        if (WE_UART_IsRxDataPending(&WE_UART1_Internal) || WE_UART_IsRxDataPending(&WE_UART2_Internal))
+        {
+            /* Pass received data to the drivers (which might signal the event) */
+            pthread_mutex_unlock(&eventMutex);
+            WE_UART_Process();
+            pthread_mutex_lock(&eventMutex);
+            continue;
+        }
+#endif
+        if (ETIMEDOUT == pthread_cond_timedwait(&eventCondition, &eventMutex, &deadline))
+        {
+            break;
+        }
+    }
+    bool signaled = event->signaled;
+    event->signaled = false;
+    pthread_mutex_unlock(&eventMutex);
+
+    return signaled;
+}
+
+void WE_SignalEvent(WE_Event_t* event)
+{
+    pthread_once(&eventConditionOnce, WE_InitEventCondition);
+
+    pthread_mutex_lock(&eventMutex);
+    event->signaled = true;
+    pthread_cond_broadcast(&eventCondition);
+    pthread_mutex_unlock(&eventMutex);
+}
+
+uint32_t WE_EnterCritical()
+{
+    pthread_once(&criticalMutexOnce, WE_InitCriticalMutex);
+    pthread_mutex_lock(&criticalMutex);
+    return 0;
+}
+
+void WE_ExitCritical(uint32_t state)
+{
+    (void)state;
+    pthread_mutex_unlock(&criticalMutex);
+}
+
+uint32_t WE_GetTick() { return (uint32_t)(WE_GetElapsedNanoseconds() / 1000000ull); }
+
+uint32_t WE_GetTickMicroseconds() { return (uint32_t)(WE_GetElapsedNanoseconds() / 1000ull); }
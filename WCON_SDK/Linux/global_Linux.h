@@ -0,0 +1,160 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Linux host platform driver.
+ *
+ * @details Implements the platform functions of the Wireless Connectivity SDK on a Linux host, so that
+ * the radio module drivers can be built, debugged and profiled on a workstation. The radio module is
+ * connected via a serial device (e.g. /dev/ttyUSB0), a pseudo terminal or any other file descriptor
+ * (e.g. one end of a socketpair connected to an emulated module).
+ */
+
+#ifndef GLOBAL_LINUX_H_INCLUDED
+#define GLOBAL_LINUX_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <global/global_types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Sets the device to be opened by WE_UART1_Init() (e.g. "/dev/ttyUSB0" or the slave side of a pty).
+ *
+ * Must be called before WE_UART1_Init(). Baud rate, parity and flow control are applied to the device if it is a terminal.
+ *
+ * @param[in] devicePath Path of the device (the string must remain valid until the UART is de-initialized)
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_UART1_SetDevice(const char* devicePath);
+
+/**
+ * @brief Sets an already opened file descriptor to be used by WE_UART1_Init() (e.g. one end of a socketpair or the master side of a pty).
+ *
+ * Must be called before WE_UART1_Init(). The file descriptor is not closed by WE_UART1_DeInit().
+ *
+ * @param[in] fd File descriptor to be used
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_UART1_SetFileDescriptor(int fd);
+
+/**
+ * @brief Initialize and start the UART.
+ *
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver. (this function is called by the UART's receive thread on data reception)
+ */
+extern bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP);
+
+/**
+ * @brief Deinitialize and stop the UART.
+ */
+extern bool WE_UART1_DeInit();
+
+/**
+ * @brief Transmit data via UART.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART1_Transmit(const uint8_t* data, uint16_t length);
+
+/**
+ * @brief Returns the receive overflow counters of the UART (can be used as WE_UART_t::uartGetRxOverflowCounts).
+ *
+ * @param[out] droppedBytesP Number of received bytes dropped because the receive ring buffer was full (0 if WE_UART_RX_DEFERRED is not used)
+ * @param[out] dmaOverrunsP Always 0 (no DMA)
+ */
+extern void WE_UART1_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP);
+
+/**
+ * @brief Sets the device to be opened by WE_UART2_Init() (e.g. "/dev/ttyUSB1" or the slave side of a pty).
+ *
+ * Must be called before WE_UART2_Init(). Baud rate, parity and flow control are applied to the device if it is a terminal.
+ *
+ * @param[in] devicePath Path of the device (the string must remain valid until the UART is de-initialized)
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_UART2_SetDevice(const char* devicePath);
+
+/**
+ * @brief Sets an already opened file descriptor to be used by WE_UART2_Init() (e.g. one end of a socketpair or the master side of a pty).
+ *
+ * Must be called before WE_UART2_Init(). The file descriptor is not closed by WE_UART2_DeInit().
+ *
+ * @param[in] fd File descriptor to be used
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_UART2_SetFileDescriptor(int fd);
+
+/**
+ * @brief Initialize and start the UART.
+ *
+ * @param[in] baudrate Baud rate of the serial interface
+ * @param[in] flowControl Enable/disable flow control
+ * @param[in] parity Parity bit configuration
+ * @param[in] rxByteHandlerP Pointer to the handle rx byte function inside the driver. (this function is called by the UART's receive thread on data reception)
+ */
+extern bool WE_UART2_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP);
+
+/**
+ * @brief Deinitialize and stop the UART.
+ */
+extern bool WE_UART2_DeInit();
+
+/**
+ * @brief Transmit data via UART.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ */
+extern bool WE_UART2_Transmit(const uint8_t* data, uint16_t length);
+
+/**
+ * @brief Returns the receive overflow counters of the UART (can be used as WE_UART_t::uartGetRxOverflowCounts).
+ *
+ * @param[out] droppedBytesP Number of received bytes dropped because the receive ring buffer was full (0 if WE_UART_RX_DEFERRED is not used)
+ * @param[out] dmaOverrunsP Always 0 (no DMA)
+ */
+extern void WE_UART2_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GLOBAL_LINUX_H_INCLUDED */
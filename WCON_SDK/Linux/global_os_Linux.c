@@ -0,0 +1,332 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Operating system abstraction (mutexes, semaphores, queues and threads) for the Linux host, based on POSIX threads.
+ */
+
+#define _GNU_SOURCE /* pthread_setname_np() */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <global/global.h>
+
+/**
+ * @brief Counting semaphore.
+ */
+typedef struct WE_OS_Semaphore_t
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t condition;
+    uint32_t count;
+    uint32_t maxCount;
+} WE_OS_Semaphore_t;
+
+/**
+ * @brief Queue (ring buffer of items).
+ */
+typedef struct WE_OS_Queue_t
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+    uint8_t* items;
+    size_t itemSize;
+    uint32_t length;
+    uint32_t count;
+    uint32_t readIndex;
+} WE_OS_Queue_t;
+
+/**
+ * @brief Function and argument passed to the thread started by WE_Thread_Create().
+ */
+typedef struct WE_OS_ThreadStart_t
+{
+    WE_ThreadFunction_t function;
+    void* argument;
+} WE_OS_ThreadStart_t;
+
+/**
+ * @brief Returns the absolute time (measured using the given clock) at which a timeout of timeoutMs milliseconds expires.
+ */
+static struct timespec WE_OS_GetDeadline(clockid_t clock, uint32_t timeoutMs)
+{
+    struct timespec deadline;
+    clock_gettime(clock, &deadline);
+    deadline.tv_sec += (time_t)(timeoutMs / 1000);
+    deadline.tv_nsec += (long)(timeoutMs % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+/**
+ * @brief Initializes a condition variable using CLOCK_MONOTONIC.
+ */
+static void WE_OS_InitCondition(pthread_cond_t* condition)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(condition, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/**
+ * @brief Waits for a condition variable until the deadline (NULL to wait without time limit).
+ *
+ * @return False if the deadline has passed, true otherwise
+ */
+static bool WE_OS_WaitCondition(pthread_cond_t* condition, pthread_mutex_t* mutex, const struct timespec* deadline)
+{
+    if (NULL == deadline)
+    {
+        pthread_cond_wait(condition, mutex);
+        return true;
+    }
+    return ETIMEDOUT != pthread_cond_timedwait(condition, mutex, deadline);
+}
+
+bool WE_Mutex_Create(WE_Mutex_t* mutexP)
+{
+    pthread_mutex_t* mutex = malloc(sizeof(pthread_mutex_t));
+    if (NULL == mutex)
+    {
+        return false;
+    }
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    *mutexP = mutex;
+    return true;
+}
+
+void WE_Mutex_Delete(WE_Mutex_t mutex)
+{
+    pthread_mutex_destroy((pthread_mutex_t*)mutex);
+    free(mutex);
+}
+
+bool WE_Mutex_Lock(WE_Mutex_t mutex, uint32_t timeoutMs)
+{
+    if (WE_WAIT_FOREVER == timeoutMs)
+    {
+        return 0 == pthread_mutex_lock((pthread_mutex_t*)mutex);
+    }
+    /* pthread_mutex_timedlock() uses CLOCK_REALTIME */
+    struct timespec deadline = WE_OS_GetDeadline(CLOCK_REALTIME, timeoutMs);
+    return 0 == pthread_mutex_timedlock((pthread_mutex_t*)mutex, &deadline);
+}
+
+void WE_Mutex_Unlock(WE_Mutex_t mutex) { pthread_mutex_unlock((pthread_mutex_t*)mutex); }
+
+bool WE_Semaphore_Create(WE_Semaphore_t* semaphoreP, uint32_t maxCount, uint32_t initialCount)
+{
+    WE_OS_Semaphore_t* semaphore = malloc(sizeof(WE_OS_Semaphore_t));
+    if (NULL == semaphore)
+    {
+        return false;
+    }
+    pthread_mutex_init(&semaphore->mutex, NULL);
+    WE_OS_InitCondition(&semaphore->condition);
+    semaphore->count = initialCount;
+    semaphore->maxCount = maxCount;
+    *semaphoreP = semaphore;
+    return true;
+}
+
+void WE_Semaphore_Delete(WE_Semaphore_t semaphore)
+{
+    WE_OS_Semaphore_t* s = semaphore;
+    pthread_cond_destroy(&s->condition);
+    pthread_mutex_destroy(&s->mutex);
+    free(s);
+}
+
+bool WE_Semaphore_Take(WE_Semaphore_t semaphore, uint32_t timeoutMs)
+{
+    WE_OS_Semaphore_t* s = semaphore;
+    struct timespec deadline = WE_OS_GetDeadline(CLOCK_MONOTONIC, timeoutMs);
+
+    pthread_mutex_lock(&s->mutex);
+    while (s->count == 0)
+    {
+        if (!WE_OS_WaitCondition(&s->condition, &s->mutex, WE_WAIT_FOREVER == timeoutMs ? NULL : &deadline))
+        {
+            break;
+        }
+    }
+    bool taken = s->count > 0;
+    if (taken)
+    {
+        s->count--;
+    }
+    pthread_mutex_unlock(&s->mutex);
+
+    return taken;
+}
+
+void WE_Semaphore_Give(WE_Semaphore_t semaphore)
+{
+    WE_OS_Semaphore_t* s = semaphore;
+    pthread_mutex_lock(&s->mutex);
+    if (s->count < s->maxCount)
+    {
+        s->count++;
+        pthread_cond_signal(&s->condition);
+    }
+    pthread_mutex_unlock(&s->mutex);
+}
+
+bool WE_Queue_Create(WE_Queue_t* queueP, size_t itemSize, uint32_t length)
+{
+    WE_OS_Queue_t* queue = malloc(sizeof(WE_OS_Queue_t) + itemSize * length);
+    if (NULL == queue)
+    {
+        return false;
+    }
+    pthread_mutex_init(&queue->mutex, NULL);
+    WE_OS_InitCondition(&queue->notEmpty);
+    WE_OS_InitCondition(&queue->notFull);
+    queue->items = (uint8_t*)(queue + 1);
+    queue->itemSize = itemSize;
+    queue->length = length;
+    queue->count = 0;
+    queue->readIndex = 0;
+    *queueP = queue;
+    return true;
+}
+
+void WE_Queue_Delete(WE_Queue_t queue)
+{
+    WE_OS_Queue_t* q = queue;
+    pthread_cond_destroy(&q->notFull);
+    pthread_cond_destroy(&q->notEmpty);
+    pthread_mutex_destroy(&q->mutex);
+    free(q);
+}
+
+bool WE_Queue_Send(WE_Queue_t queue, const void* itemP, uint32_t timeoutMs)
+{
+    WE_OS_Queue_t* q = queue;
+    struct timespec deadline = WE_OS_GetDeadline(CLOCK_MONOTONIC, timeoutMs);
+
+    pthread_mutex_lock(&q->mutex);
+    while (q->count >= q->length)
+    {
+        if ((0 == timeoutMs) || !WE_OS_WaitCondition(&q->notFull, &q->mutex, WE_WAIT_FOREVER == timeoutMs ? NULL : &deadline))
+        {
+            pthread_mutex_unlock(&q->mutex);
+            return false;
+        }
+    }
+    uint32_t writeIndex = (q->readIndex + q->count) % q->length;
+    memcpy(&q->items[writeIndex * q->itemSize], itemP, q->itemSize);
+    q->count++;
+    pthread_cond_signal(&q->notEmpty);
+    pthread_mutex_unlock(&q->mutex);
+
+    return true;
+}
+
+bool WE_Queue_Receive(WE_Queue_t queue, void* itemP, uint32_t timeoutMs)
+{
+    WE_OS_Queue_t* q = queue;
+    struct timespec deadline = WE_OS_GetDeadline(CLOCK_MONOTONIC, timeoutMs);
+
+    pthread_mutex_lock(&q->mutex);
+    while (q->count == 0)
+    {
+        if ((0 == timeoutMs) || !WE_OS_WaitCondition(&q->notEmpty, &q->mutex, WE_WAIT_FOREVER == timeoutMs ? NULL : &deadline))
+        {
+            pthread_mutex_unlock(&q->mutex);
+            return false;
+        }
+    }
+    memcpy(itemP, &q->items[q->readIndex * q->itemSize], q->itemSize);
+    q->readIndex = (q->readIndex + 1) % q->length;
+    q->count--;
+    pthread_cond_signal(&q->notFull);
+    pthread_mutex_unlock(&q->mutex);
+
+    return true;
+}
+
+/**
+ * @brief Start routine of threads created using WE_Thread_Create().
+ */
+static void* WE_OS_ThreadStart(void* arg)
+{
+    WE_OS_ThreadStart_t start = *(WE_OS_ThreadStart_t*)arg;
+    free(arg);
+    start.function(start.argument);
+    return NULL;
+}
+
+bool WE_Thread_Create(WE_Thread_t* threadP, WE_ThreadFunction_t function, void* argument, const char* name, uint32_t stackSize, WE_ThreadPriority_t priority)
+{
+    /* The stack size is managed by the system, priorities are not supported for normal (SCHED_OTHER) threads */
+    UNUSED(stackSize);
+    UNUSED(priority);
+
+    WE_OS_ThreadStart_t* start = malloc(sizeof(WE_OS_ThreadStart_t));
+    if (NULL == start)
+    {
+        return false;
+    }
+    start->function = function;
+    start->argument = argument;
+
+    pthread_t thread;
+    if (0 != pthread_create(&thread, NULL, WE_OS_ThreadStart, start))
+    {
+        free(start);
+        return false;
+    }
+    pthread_detach(thread);
+    if (NULL != name)
+    {
+        /* Thread names are limited to 15 characters */
+        char threadName[16];
+        strncpy(threadName, name, sizeof(threadName) - 1);
+        threadName[sizeof(threadName) - 1] = '\0';
+        pthread_setname_np(thread, threadName);
+    }
+    *threadP = (WE_Thread_t)thread;
+    return true;
+}
+
+WE_Thread_t WE_Thread_GetCurrent() { return (WE_Thread_t)pthread_self(); }
@@ -0,0 +1,77 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief This file contains the platform dependent pin definition used in the Wireless Connectivity SDK (Linux host).
+ *
+ * @details Pins are simulated on the Linux host: The level of each pin is stored in its pin definition,
+ * changes of output pins can be observed using WE_Linux_SetPinChangeCallback().
+ *
+ */
+
+#ifndef GLOBAL_PLATFORM_TYPES_H_
+#define GLOBAL_PLATFORM_TYPES_H_
+
+#include "global_Linux.h"
+
+/**
+ * @brief Configuration of a (simulated) Linux host pin.
+ */
+typedef struct WE_Linux_Pin_t
+{
+    const char* name;             /**< Name of the pin (for debugging purposes) */
+    volatile WE_Pin_Level_t level; /**< Current level of the pin */
+} WE_Linux_Pin_t;
+
+#define WE_LINUX_PIN(NAME) ((WE_Linux_Pin_t){.name = NAME, .level = WE_Pin_Level_Low})
+
+/**
+ * @brief Is called whenever the level of an output pin is set.
+ *
+ * @param[in] pin: Pin that has been set
+ * @param[in] level: New level of the pin
+ */
+typedef void (*WE_Linux_PinChangeCallback_t)(WE_Linux_Pin_t* pin, WE_Pin_Level_t level);
+
+/**
+ * @brief Sets the function to be called whenever the level of an output pin is set (e.g. to emulate a reset of the radio module).
+ *
+ * @param[in] callback: Callback function (NULL to disable)
+ */
+extern void WE_Linux_SetPinChangeCallback(WE_Linux_PinChangeCallback_t callback);
+
+/**
+* @brief Initializes the platform.
+*/
+extern void WE_Platform_Init(void);
+
+/**
+* @brief Is called in case of a critical error.
+*/
+extern void WE_Error_Handler(void);
+
+#endif /* GLOBAL_PLATFORM_TYPES_H_ */
@@ -35,31 +35,50 @@
 #include <global/global.h>
 #include <global_platform.h>
 
+#if defined(WE_UART_RX_DEFERRED)
+#include <ringbuffer.h>
+
+#ifndef WE_UART_RX_RING_SIZE
+/**
+ * @brief Size of the per-UART receive ring buffer used if WE_UART_RX_DEFERRED is defined (must be a power of two).
+ */
+#define WE_UART_RX_RING_SIZE 1024
+#endif
+#endif
+
 #ifdef WE_MICROSECOND_TICK
+#if defined(WE_MICROSECOND_TICK_TIMER)
+/**
+ * @brief 32-bit timer used as microsecond time base if WE_MICROSECOND_TICK_TIMER is defined
+ * (keeps running while the CPU is sleeping, unlike the DWT cycle counter).
+ */
+#define WE_TICK_TIMER TIM5
+#else
 /**
  * @brief Number of data watchpoint trigger (DWT) ticks per microsecond (used for microsecond resolution delay/measurements).
  */
 static uint32_t dwtTicksPerMicrosecond = 1;
+#endif
 #endif /* WE_MICROSECOND_TICK */
 
 #if defined(WE_UART_DMA)
 /**
  * @brief Priority for DMA interrupts (used for receiving data from radio module)
  */
-#define WE_PRIORITY_DMA_RX 0
+#define WE_PRIORITY_DMA_RX (WE_PRIORITY_BASE + 0)
 
+#ifndef WE_DMA_RX_BUFFER_SIZE
 /**
- * @brief Size of DMA receive buffer.
+ * @brief Default size of DMA receive buffer (used if no buffer has been configured via WE_UARTx_ConfigureDmaRx()).
  */
 #define WE_DMA_RX_BUFFER_SIZE 512
+#endif
 
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t* data, size_t size);
 static void WE_DMA_for_UART1_Init();
 static void WE_DMA_for_UART1_DeInit();
 static void WE_UART1_CheckIfDmaDataAvailable();
 static void WE_UART1_CheckIfDmaDataAvailableAsync();
 
-static void WE_DMA_for_UART6_OnDataReceived(uint8_t* data, size_t size);
 static void WE_DMA_for_UART6_Init();
 static void WE_DMA_for_UART6_DeInit();
 static void WE_UART6_CheckIfDmaDataAvailable();
@@ -67,7 +86,22 @@ static void WE_UART6_CheckIfDmaDataAvailableAsync();
 
 #endif
 
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Priority for DMA interrupts (used for transmitting data to radio module)
+ */
+#define WE_PRIORITY_DMA_TX (WE_PRIORITY_BASE + 1)
+
+static void WE_DMA_TX_for_UART1_Init();
+static void WE_DMA_TX_for_UART1_DeInit();
+
+static void WE_DMA_TX_for_UART6_Init();
+static void WE_DMA_TX_for_UART6_DeInit();
+#endif
+
+#if !defined(WE_UART_DMA_TX)
 static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef* hUart, const uint8_t* data, uint16_t size);
+#endif
 
 typedef struct
 {
@@ -100,7 +134,12 @@ typedef struct
     /**
 	 * @brief Buffer used for dmaRx.
 	 */
-    uint8_t WE_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+    uint8_t* dmaRxBuffer;
+
+    /**
+	 * @brief Size of dmaRxBuffer in bytes.
+	 */
+    uint16_t dmaRxBufferSize;
 
     /**
 	 * @brief Last read position in DMA receive buffer (used only if DMA is enabled).
@@ -108,9 +147,68 @@ typedef struct
 	 */
     size_t dmaLastReadPos;
 
+    /**
+	 * @brief Number of times the DMA has reached the middle or the end of dmaRxBuffer (incremented in DMA interrupt).
+	 */
+    volatile uint32_t dmaRxBoundaryCount;
+
+    /**
+	 * @brief Number of buffer boundaries (middle or end of dmaRxBuffer) that have been passed by dmaLastReadPos.
+	 */
+    uint32_t dmaRxBoundaryCountRead;
+
+    /**
+	 * @brief Number of times the DMA has overwritten data in dmaRxBuffer that has not been processed yet.
+	 */
+    uint32_t dmaRxOverrunCount;
+
     bool triggered;
 #endif
 
+#if defined(WE_UART_DMA_TX)
+    /**
+	 * @brief DMA used for transmitting data to radio module (used only if DMA TX is enabled).
+	 */
+    DMA_TypeDef* dmaTx;
+
+    /**
+	 * @brief DMA stream used for transmitting data to radio module (used only if DMA TX is enabled).
+	 */
+    uint32_t dmaTxStream;
+
+    /**
+	 * @brief Is set to true while a DMA transmission is in progress.
+	 */
+    volatile bool txBusy;
+
+    /**
+	 * @brief Result of the last DMA transmission (true if all bytes have been transferred).
+	 */
+    volatile bool txSuccess;
+
+    /**
+	 * @brief Function to be called when the current DMA transmission has finished.
+	 */
+    WE_UART_TransmitComplete_t txCompleteCb;
+#endif
+
+#if defined(WE_UART_RX_DEFERRED)
+    /**
+	 * @brief Ring buffer for received data, filled in interrupt context and drained by WE_UART_Process().
+	 */
+    WE_RingBuffer_t rxRing;
+
+    /**
+	 * @brief Storage of rxRing.
+	 */
+    uint8_t rxRingBuffer[WE_UART_RX_RING_SIZE];
+
+    /**
+	 * @brief Is set to true while WE_UART_Process() is passing data to rxByteHandlerP (prevents reentrant processing).
+	 */
+    bool rxProcessing;
+#endif
+
     /**
 	 * @brief Last received byte
 	 */
@@ -118,6 +216,18 @@ typedef struct
 
 } WE_UART_Internal_t;
 
+#if defined(WE_UART_DMA)
+/**
+ * @brief Default DMA receive buffer of UART1.
+ */
+static uint8_t WE_UART1_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+
+/**
+ * @brief Default DMA receive buffer of UART6.
+ */
+static uint8_t WE_UART6_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+#endif
+
 WE_UART_Internal_t WE_UART1_Internal = {
     .uart = NULL,
     .flowControl = WE_FlowControl_NoFlowControl,
@@ -125,9 +235,24 @@ WE_UART_Internal_t WE_UART1_Internal = {
 #if defined(WE_UART_DMA)
     .dmaRx = NULL,
     .dmaRxStream = 0,
+    .dmaRxBuffer = WE_UART1_dmaRxBuffer,
+    .dmaRxBufferSize = WE_DMA_RX_BUFFER_SIZE,
     .dmaLastReadPos = 0,
+    .dmaRxBoundaryCount = 0,
+    .dmaRxBoundaryCountRead = 0,
+    .dmaRxOverrunCount = 0,
     .triggered = false,
 #endif
+#if defined(WE_UART_DMA_TX)
+    .dmaTx = NULL,
+    .dmaTxStream = 0,
+    .txBusy = false,
+    .txSuccess = false,
+    .txCompleteCb = NULL,
+#endif
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
 };
 
 WE_UART_Internal_t WE_UART6_Internal = {
@@ -137,11 +262,197 @@ WE_UART_Internal_t WE_UART6_Internal = {
 #if defined(WE_UART_DMA)
     .dmaRx = NULL,
     .dmaRxStream = 0,
+    .dmaRxBuffer = WE_UART6_dmaRxBuffer,
+    .dmaRxBufferSize = WE_DMA_RX_BUFFER_SIZE,
     .dmaLastReadPos = 0,
+    .dmaRxBoundaryCount = 0,
+    .dmaRxBoundaryCountRead = 0,
+    .dmaRxOverrunCount = 0,
     .triggered = false,
 #endif
+#if defined(WE_UART_DMA_TX)
+    .dmaTx = NULL,
+    .dmaTxStream = 0,
+    .txBusy = false,
+    .txSuccess = false,
+    .txCompleteCb = NULL,
+#endif
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
 };
 
+/**
+ * @brief Is called when one or more bytes have been received from the radio module.
+ *
+ * If WE_UART_RX_DEFERRED is defined, the data is only appended to the UART's receive ring
+ * buffer and handed over to the driver by WE_UART_Process() (if running on top of an RTOS, the
+ * thread waiting in WE_WaitEvent() is woken up). Otherwise, the driver's byte handler is called
+ * directly (i.e. in interrupt context).
+ *
+ * @param uartInternal UART that has received the data
+ * @param data Received data
+ * @param size Number of bytes received
+ */
+static void WE_UART_OnDataReceived(WE_UART_Internal_t* uartInternal, uint8_t* data, size_t size)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_RingBuffer_Write(&uartInternal->rxRing, data, size);
+#if defined(WE_OS_RTOS)
+    WE_OS_NotifyDataReceived();
+#endif
+#else
+    (*uartInternal->rxByteHandlerP)(data, size);
+#endif
+}
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Returns the current DMA write position in the receive buffer.
+ *
+ * @param uartInternal UART to be checked
+ *
+ * @return Position in dmaRxBuffer the DMA is going to write the next byte to
+ */
+static size_t WE_DMA_RX_GetWritePos(WE_UART_Internal_t* uartInternal)
+{
+#if defined(WE_UART_DMA_DOUBLE_BUFFER)
+    /* Double buffer mode: Memory 0 is the first half, memory 1 the second half of dmaRxBuffer */
+    size_t halfSize = uartInternal->dmaRxBufferSize / 2;
+    uint32_t targetMem;
+    uint32_t remaining;
+    do
+    {
+        /* Re-read if the DMA has switched buffers while reading the counter */
+        targetMem = LL_DMA_GetCurrentTargetMem(uartInternal->dmaRx, uartInternal->dmaRxStream);
+        remaining = LL_DMA_GetDataLength(uartInternal->dmaRx, uartInternal->dmaRxStream);
+    } while (targetMem != LL_DMA_GetCurrentTargetMem(uartInternal->dmaRx, uartInternal->dmaRxStream));
+
+    size_t pos = halfSize - remaining;
+    if (targetMem == LL_DMA_CURRENTTARGETMEM1)
+    {
+        pos += halfSize;
+    }
+    return pos;
+#else
+    return uartInternal->dmaRxBufferSize - LL_DMA_GetDataLength(uartInternal->dmaRx, uartInternal->dmaRxStream);
+#endif
+}
+
+/**
+ * @brief Passes data that has been written to the DMA receive buffer since the last call to the driver.
+ *
+ * Also detects if the DMA has lapped the last read position (i.e. unprocessed data has been overwritten).
+ * To do so, the number of buffer boundaries (middle and end of buffer) that have been reached by the DMA
+ * (counted in the DMA interrupt) is compared to the number of boundaries between the last and the current
+ * read position. Each additional pair of boundaries corresponds to one full lap of the DMA.
+ *
+ * @param uartInternal UART to be checked
+ */
+static void WE_DMA_RX_CheckIfDataAvailable(WE_UART_Internal_t* uartInternal)
+{
+    size_t size = uartInternal->dmaRxBufferSize;
+    size_t halfSize = size / 2;
+    size_t lastPos = uartInternal->dmaLastReadPos;
+
+    /* Boundary count must be read before write position (a boundary that is reached in between is detected during the next call) */
+    uint32_t boundaryCount = uartInternal->dmaRxBoundaryCount;
+    size_t pos = WE_DMA_RX_GetWritePos(uartInternal);
+    size_t count = (pos >= lastPos) ? (pos - lastPos) : (size - lastPos + pos);
+
+    /* Number of boundaries between last read position and current write position */
+    uint32_t boundariesPassed = 0;
+    if (count > 0)
+    {
+        size_t end = lastPos + count;
+        if ((lastPos < halfSize) && (end >= halfSize))
+        {
+            boundariesPassed++;
+        }
+        if (end >= size)
+        {
+            boundariesPassed++;
+        }
+        if (end >= size + halfSize)
+        {
+            boundariesPassed++;
+        }
+    }
+
+    int32_t missedBoundaries = (int32_t)(boundaryCount - uartInternal->dmaRxBoundaryCountRead - boundariesPassed);
+    if (missedBoundaries >= 2)
+    {
+        /* DMA has lapped the read position at least once - data has been lost */
+        uartInternal->dmaRxOverrunCount += (uint32_t)missedBoundaries / 2;
+        uartInternal->dmaRxBoundaryCountRead += (uint32_t)missedBoundaries & ~(uint32_t)1;
+    }
+    uartInternal->dmaRxBoundaryCountRead += boundariesPassed;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (pos > lastPos)
+    {
+        /* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
+        WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[lastPos], pos - lastPos);
+    }
+    else /* pos < lastPos */
+    {
+        /* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
+		 * Data is split:
+		 * - Bytes between lastPos and the end of the buffer
+		 * - Bytes between start of the buffer and pos
+		 */
+        WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[lastPos], size - lastPos);
+        if (pos > 0)
+        {
+            WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[0], pos);
+        }
+    }
+
+    /* Store DMA write position for next interrupt */
+    uartInternal->dmaLastReadPos = pos;
+}
+#endif /* defined(WE_UART_DMA) */
+
+#if defined(WE_UART_RX_DEFERRED)
+/**
+ * @brief Passes all data stored in the UART's receive ring buffer to the driver's byte handler.
+ *
+ * @param uartInternal UART to be processed
+ */
+static void WE_UART_ProcessInternal(WE_UART_Internal_t* uartInternal)
+{
+    if (uartInternal->rxProcessing)
+    {
+        /* Called from within the byte handler (e.g. by a blocking function called from a driver callback) */
+        return;
+    }
+
+    uartInternal->rxProcessing = true;
+
+    uint8_t* data;
+    uint32_t length;
+    while ((uartInternal->rxByteHandlerP != NULL) && ((length = WE_RingBuffer_Peek(&uartInternal->rxRing, &data)) > 0))
+    {
+        (*uartInternal->rxByteHandlerP)(data, length);
+        WE_RingBuffer_Release(&uartInternal->rxRing, length);
+    }
+
+    uartInternal->rxProcessing = false;
+}
+#endif /* defined(WE_UART_RX_DEFERRED) */
+
+void WE_UART_Process()
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_UART_ProcessInternal(&WE_UART1_Internal);
+    WE_UART_ProcessInternal(&WE_UART6_Internal);
+#endif
+}
+
 void WE_SystemClock_Config()
 {
     RCC_OscInitTypeDef RCC_OscInitStruct = {0};
@@ -181,6 +492,27 @@ void WE_SystemClock_Config()
     }
 
 #ifdef WE_MICROSECOND_TICK
+#if defined(WE_MICROSECOND_TICK_TIMER)
+    /* Enable microsecond tick counter using TIM5 (32-bit, free running at 1 MHz) */
+    __HAL_RCC_TIM5_CLK_ENABLE();
+    __HAL_RCC_TIM5_CLK_SLEEP_ENABLE();
+
+    /* Timer clock is twice the APB1 clock if the APB1 prescaler is not 1 */
+    uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        timerClock *= 2;
+    }
+
+    WE_TICK_TIMER->CR1 = TIM_CR1_URS;
+    WE_TICK_TIMER->PSC = (timerClock / 1000000) - 1;
+    WE_TICK_TIMER->ARR = 0xFFFFFFFF;
+    WE_TICK_TIMER->CNT = 0;
+    /* Load prescaler */
+    WE_TICK_TIMER->EGR = TIM_EGR_UG;
+    WE_TICK_TIMER->SR = 0;
+    WE_TICK_TIMER->CR1 |= TIM_CR1_CEN;
+#else
     /* Enable microsecond tick counter using data watchpoint trigger (DWT) */
 
     /* Disable TRC */
@@ -210,18 +542,234 @@ void WE_SystemClock_Config()
 
     dwtTicksPerMicrosecond = (HAL_RCC_GetHCLKFreq() / 1000000);
 #endif
+#endif
+}
+
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Is called when a DMA transmission has finished (or failed).
+ *
+ * The busy flag is reset before calling the completion callback, so the
+ * callback may directly start the next transfer.
+ *
+ * @param uartInternal UART whose transmission has finished
+ * @param success True if all bytes have been transferred, false in case of a transfer error
+ */
+static void WE_UART_OnDmaTxFinished(WE_UART_Internal_t* uartInternal, bool success)
+{
+    WE_UART_TransmitComplete_t completeCb = uartInternal->txCompleteCb;
+    uartInternal->txCompleteCb = NULL;
+    uartInternal->txSuccess = success;
+    uartInternal->txBusy = false;
+    if (completeCb != NULL)
+    {
+        completeCb(success);
+    }
+}
+
+bool WE_UART1_Transmit(const uint8_t* data, uint16_t length)
+{
+    /* Wait for a previously started asynchronous transfer to finish */
+    while (WE_UART1_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART1_TransmitAsync(data, length, NULL))
+    {
+        return false;
+    }
+
+    while (WE_UART1_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART1_Internal.txSuccess)
+    {
+        return false;
+    }
+
+    /* Wait until the last byte has been shifted out */
+    while (!LL_USART_IsActiveFlag_TC(WE_UART1_Internal.uart))
+    {
+    }
+    return true;
 }
 
+bool WE_UART1_TransmitAsync(const uint8_t* data, uint16_t length, WE_UART_TransmitComplete_t completeCb)
+{
+    if ((WE_UART1_Internal.uart == NULL) || (WE_UART1_Internal.dmaTx == NULL) || (data == NULL) || (length == 0))
+    {
+        return false;
+    }
+
+    /* Check and set the busy flag atomically, as transfers may be started from interrupt context as well */
+    uint32_t state = WE_EnterCritical();
+    bool busy = WE_UART1_Internal.txBusy;
+    WE_UART1_Internal.txBusy = true;
+    WE_ExitCritical(state);
+    if (busy)
+    {
+        return false;
+    }
+
+    WE_UART1_Internal.txCompleteCb = completeCb;
+
+    LL_DMA_DisableStream(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    while (LL_DMA_IsEnabledStream(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream))
+    {
+    }
+
+    /* Stream flags must be cleared before the stream can be re-enabled */
+    LL_DMA_ClearFlag_TC7(WE_UART1_Internal.dmaTx);
+    LL_DMA_ClearFlag_HT7(WE_UART1_Internal.dmaTx);
+    LL_DMA_ClearFlag_TE7(WE_UART1_Internal.dmaTx);
+    LL_DMA_ClearFlag_DME7(WE_UART1_Internal.dmaTx);
+    LL_DMA_ClearFlag_FE7(WE_UART1_Internal.dmaTx);
+
+    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, (uint32_t)data);
+    LL_DMA_SetDataLength(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, length);
+
+    LL_USART_ClearFlag_TC(WE_UART1_Internal.uart);
+    LL_DMA_EnableStream(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+
+    return true;
+}
+
+bool WE_UART6_Transmit(const uint8_t* data, uint16_t length)
+{
+    /* Wait for a previously started asynchronous transfer to finish */
+    while (WE_UART6_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART6_TransmitAsync(data, length, NULL))
+    {
+        return false;
+    }
+
+    while (WE_UART6_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART6_Internal.txSuccess)
+    {
+        return false;
+    }
+
+    /* Wait until the last byte has been shifted out */
+    while (!LL_USART_IsActiveFlag_TC(WE_UART6_Internal.uart))
+    {
+    }
+    return true;
+}
+
+bool WE_UART6_TransmitAsync(const uint8_t* data, uint16_t length, WE_UART_TransmitComplete_t completeCb)
+{
+    if ((WE_UART6_Internal.uart == NULL) || (WE_UART6_Internal.dmaTx == NULL) || (data == NULL) || (length == 0))
+    {
+        return false;
+    }
+
+    /* Check and set the busy flag atomically, as transfers may be started from interrupt context as well */
+    uint32_t state = WE_EnterCritical();
+    bool busy = WE_UART6_Internal.txBusy;
+    WE_UART6_Internal.txBusy = true;
+    WE_ExitCritical(state);
+    if (busy)
+    {
+        return false;
+    }
+
+    WE_UART6_Internal.txCompleteCb = completeCb;
+
+    LL_DMA_DisableStream(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+    while (LL_DMA_IsEnabledStream(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream))
+    {
+    }
+
+    /* Stream flags must be cleared before the stream can be re-enabled */
+    LL_DMA_ClearFlag_TC6(WE_UART6_Internal.dmaTx);
+    LL_DMA_ClearFlag_HT6(WE_UART6_Internal.dmaTx);
+    LL_DMA_ClearFlag_TE6(WE_UART6_Internal.dmaTx);
+    LL_DMA_ClearFlag_DME6(WE_UART6_Internal.dmaTx);
+    LL_DMA_ClearFlag_FE6(WE_UART6_Internal.dmaTx);
+
+    LL_DMA_SetMemoryAddress(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, (uint32_t)data);
+    LL_DMA_SetDataLength(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, length);
+
+    LL_USART_ClearFlag_TC(WE_UART6_Internal.uart);
+    LL_DMA_EnableStream(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+
+    return true;
+}
+#else
 bool WE_UART1_Transmit(const uint8_t* data, uint16_t length) { return (HAL_OK == UartTransmitInternal(WE_UART1_Internal.uart, data, length)); }
 
 bool WE_UART6_Transmit(const uint8_t* data, uint16_t length) { return (HAL_OK == UartTransmitInternal(WE_UART6_Internal.uart, data, length)); }
+#endif /* defined(WE_UART_DMA_TX) */
+
+/**
+ * @brief Returns the receive overflow counters of a UART (see WE_UART_GetRxOverflowCounts_t).
+ */
+static void WE_UART_GetRxOverflowCountsInternal(WE_UART_Internal_t* uartInternal, uint32_t* droppedBytesP, uint32_t* dmaOverrunsP)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    *droppedBytesP = uartInternal->rxRing.droppedBytes;
+#else
+    *droppedBytesP = 0;
+#endif
+#if defined(WE_UART_DMA)
+    *dmaOverrunsP = uartInternal->dmaRxOverrunCount;
+#else
+    *dmaOverrunsP = 0;
+#endif
+}
+
+void WE_UART1_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART1_Internal, droppedBytesP, dmaOverrunsP); }
+
+void WE_UART6_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART6_Internal, droppedBytesP, dmaOverrunsP); }
+
+#if defined(WE_UART_DMA)
+bool WE_UART1_ConfigureDmaRx(uint8_t* buffer, uint16_t size)
+{
+    if (WE_UART1_Internal.uart != NULL)
+    {
+        /* Buffer can't be changed while UART is running */
+        return false;
+    }
+
+    if (buffer == NULL)
+    {
+        /* Use default buffer */
+        buffer = WE_UART1_dmaRxBuffer;
+        size = WE_DMA_RX_BUFFER_SIZE;
+    }
+    else if ((size < 2) || ((size % 2) != 0))
+    {
+        return false;
+    }
+
+    WE_UART1_Internal.dmaRxBuffer = buffer;
+    WE_UART1_Internal.dmaRxBufferSize = size;
+    return true;
+}
+
+uint32_t WE_UART1_GetDmaRxOverrunCount() { return WE_UART1_Internal.dmaRxOverrunCount; }
+#endif /* defined(WE_UART_DMA) */
 
 bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
 {
     WE_UART1_Internal.flowControl = flowControl;
     WE_UART1_Internal.rxByteHandlerP = rxByteHandlerP;
 
-#if defined(WE_UART_DMA)
+#if defined(WE_UART_RX_DEFERRED)
+    if (!WE_RingBuffer_Init(&WE_UART1_Internal.rxRing, WE_UART1_Internal.rxRingBuffer, WE_UART_RX_RING_SIZE))
+    {
+        return false;
+    }
+#endif
+
+#if defined(WE_UART_DMA) && !defined(WE_OS_RTOS)
     /* Enable pendable service interrupt which is used for processing data received from radio module
 	 * (interrupt is triggered via WE_UART1_CheckIfDmaDataAvailableAsync() when bytes have been received) */
     NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_RX_DATA_PROCESSING, 0));
@@ -357,6 +905,10 @@ bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t
     LL_USART_EnableIT_RXNE(WE_UART1_Internal.uart);
 #endif
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART1_Init();
+#endif
+
     return true;
 }
 
@@ -367,6 +919,10 @@ bool WE_UART1_DeInit()
         return true;
     }
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART1_DeInit();
+#endif
+
 #if defined(WE_UART_DMA)
     WE_DMA_for_UART1_DeInit();
 #else
@@ -390,6 +946,7 @@ bool WE_UART1_DeInit()
     return true;
 }
 
+#if !defined(WE_UART_DMA_TX)
 static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef* hUart, const uint8_t* data, uint16_t size)
 {
     for (; size > 0; --size, ++data)
@@ -404,6 +961,7 @@ static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef* hUart, const uint8_
     }
     return HAL_OK;
 }
+#endif
 
 /**
  * @brief Interrupt handler for data received from wireless module via UART.
@@ -429,7 +987,7 @@ void USART1_IRQHandler()
 
         /* RXNE flag will be cleared by reading of DR register */
         WE_UART1_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART1_Internal.uart);
-        (*WE_UART1_Internal.rxByteHandlerP)(&WE_UART1_Internal.receivedByte, 1);
+        WE_UART_OnDataReceived(&WE_UART1_Internal, &WE_UART1_Internal.receivedByte, 1);
     }
     if (LL_USART_IsActiveFlag_ORE(WE_UART1_Internal.uart))
     {
@@ -451,6 +1009,7 @@ void DMA2_Stream2_IRQHandler()
     {
         /* DMA receive half-transfer complete */
         LL_DMA_ClearFlag_HT2(WE_UART1_Internal.dmaRx);
+        WE_UART1_Internal.dmaRxBoundaryCount++;
         WE_UART1_CheckIfDmaDataAvailableAsync();
     }
 
@@ -458,6 +1017,7 @@ void DMA2_Stream2_IRQHandler()
     {
         /* DMA receive transfer complete */
         LL_DMA_ClearFlag_TC2(WE_UART1_Internal.dmaRx);
+        WE_UART1_Internal.dmaRxBoundaryCount++;
         WE_UART1_CheckIfDmaDataAvailableAsync();
     }
 
@@ -470,6 +1030,7 @@ void DMA2_Stream1_IRQHandler()
     {
         /* DMA receive half-transfer complete */
         LL_DMA_ClearFlag_HT1(WE_UART6_Internal.dmaRx);
+        WE_UART6_Internal.dmaRxBoundaryCount++;
         WE_UART6_CheckIfDmaDataAvailableAsync();
     }
 
@@ -477,12 +1038,28 @@ void DMA2_Stream1_IRQHandler()
     {
         /* DMA receive transfer complete */
         LL_DMA_ClearFlag_TC1(WE_UART6_Internal.dmaRx);
+        WE_UART6_Internal.dmaRxBoundaryCount++;
         WE_UART6_CheckIfDmaDataAvailableAsync();
     }
 
     /* Other events can be implemented if required. */
 }
 
+#if defined(WE_OS_RTOS)
+static void WE_UART6_CheckIfDmaDataAvailableAsync()
+{
+    /* PendSV is used by the RTOS for context switching - the data is only copied to the receive
+     * ring buffer here and parsed by the thread waiting in WE_WaitEvent() (see WE_OS_NotifyDataReceived()) */
+    WE_UART6_CheckIfDmaDataAvailable();
+}
+
+static void WE_UART1_CheckIfDmaDataAvailableAsync()
+{
+    /* PendSV is used by the RTOS for context switching - the data is only copied to the receive
+     * ring buffer here and parsed by the thread waiting in WE_WaitEvent() (see WE_OS_NotifyDataReceived()) */
+    WE_UART1_CheckIfDmaDataAvailable();
+}
+#else
 /**
  * @brief Pendable service interrupt handler.
  *
@@ -519,45 +1096,9 @@ static void WE_UART1_CheckIfDmaDataAvailableAsync()
     SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
     WE_UART1_Internal.triggered = true;
 }
+#endif
 
-static void WE_UART1_CheckIfDmaDataAvailable()
-{
-    /* Get current DMA write position (in ring buffer) */
-    size_t pos = WE_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-
-    /* Check if new data is available (i.e. write position has changed) */
-    if (pos != WE_UART1_Internal.dmaLastReadPos)
-    {
-        if (pos > WE_UART1_Internal.dmaLastReadPos)
-        {
-            /* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
-            WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], pos - WE_UART1_Internal.dmaLastReadPos);
-        }
-        else /* pos < WE_UART1_Internal.dmaLastReadPos */
-        {
-            /* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
-			 * Data is split:
-			 * - Bytes between lastPos and the end of the buffer
-			 * - Bytes between start of the buffer and pos
-			 */
-            WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], WE_DMA_RX_BUFFER_SIZE - WE_UART1_Internal.dmaLastReadPos);
-            if (pos > 0)
-            {
-                WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[0], pos);
-            }
-        }
-
-        /* Store DMA write position for next interrupt */
-        WE_UART1_Internal.dmaLastReadPos = pos;
-    }
-}
-
-/**
- * @brief Is called when one or more bytes have been received from UART via DMA.
- * @param data Received data
- * @param size Number of bytes received
- */
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t* data, size_t size) { (*WE_UART1_Internal.rxByteHandlerP)(data, size); }
+static void WE_UART1_CheckIfDmaDataAvailable() { WE_DMA_RX_CheckIfDataAvailable(&WE_UART1_Internal); }
 
 static void WE_DMA_for_UART1_Init()
 {
@@ -565,6 +1106,8 @@ static void WE_DMA_for_UART1_Init()
     WE_UART1_Internal.dmaRx = DMA2;
     WE_UART1_Internal.dmaRxStream = LL_DMA_STREAM_2;
     WE_UART1_Internal.dmaLastReadPos = 0;
+    WE_UART1_Internal.dmaRxBoundaryCount = 0;
+    WE_UART1_Internal.dmaRxBoundaryCountRead = 0;
 
     /* DMA controller clock enable */
     LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
@@ -585,12 +1128,24 @@ static void WE_DMA_for_UART1_Init()
     LL_DMA_DisableFifoMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
 
     LL_DMA_SetPeriphAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)&USART1->DR);
-    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)WE_UART1_Internal.WE_dmaRxBuffer);
-    LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_DMA_RX_BUFFER_SIZE);
+#if defined(WE_UART_DMA_DOUBLE_BUFFER)
+    /* Double buffer mode: DMA alternates between first (memory 0) and second half (memory 1) of receive buffer */
+    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)WE_UART1_Internal.dmaRxBuffer);
+    LL_DMA_SetMemory1Address(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)(WE_UART1_Internal.dmaRxBuffer + WE_UART1_Internal.dmaRxBufferSize / 2));
+    LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_UART1_Internal.dmaRxBufferSize / 2);
+    LL_DMA_SetCurrentTargetMem(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_CURRENTTARGETMEM0);
+    LL_DMA_EnableDoubleBufferMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+
+    /* Enable TC interrupt (is triggered whenever the DMA switches buffers) */
+    LL_DMA_EnableIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+#else
+    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)WE_UART1_Internal.dmaRxBuffer);
+    LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_UART1_Internal.dmaRxBufferSize);
 
     /* Enable HT & TC interrupts */
     LL_DMA_EnableIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
     LL_DMA_EnableIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+#endif
 
     /* Enable DMA */
     LL_USART_EnableDMAReq_RX(WE_UART1_Internal.uart);
@@ -610,6 +1165,9 @@ static void WE_DMA_for_UART1_DeInit()
     LL_USART_DisableDMAReq_RX(WE_UART1_Internal.uart);
     LL_DMA_DisableIT_TC(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
     LL_DMA_DisableIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+#if defined(WE_UART_DMA_DOUBLE_BUFFER)
+    LL_DMA_DisableDoubleBufferMode(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
+#endif
     NVIC_DisableIRQ(DMA2_Stream2_IRQn);
     LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA2);
 
@@ -620,12 +1178,47 @@ static void WE_DMA_for_UART1_DeInit()
 
 #endif /* defined(WE_UART_DMA) */
 
+#if defined(WE_UART_DMA)
+bool WE_UART6_ConfigureDmaRx(uint8_t* buffer, uint16_t size)
+{
+    if (WE_UART6_Internal.uart != NULL)
+    {
+        /* Buffer can't be changed while UART is running */
+        return false;
+    }
+
+    if (buffer == NULL)
+    {
+        /* Use default buffer */
+        buffer = WE_UART6_dmaRxBuffer;
+        size = WE_DMA_RX_BUFFER_SIZE;
+    }
+    else if ((size < 2) || ((size % 2) != 0))
+    {
+        return false;
+    }
+
+    WE_UART6_Internal.dmaRxBuffer = buffer;
+    WE_UART6_Internal.dmaRxBufferSize = size;
+    return true;
+}
+
+uint32_t WE_UART6_GetDmaRxOverrunCount() { return WE_UART6_Internal.dmaRxOverrunCount; }
+#endif /* defined(WE_UART_DMA) */
+
 bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
 {
     WE_UART6_Internal.flowControl = flowControl;
     WE_UART6_Internal.rxByteHandlerP = rxByteHandlerP;
 
-#if defined(WE_UART_DMA)
+#if defined(WE_UART_RX_DEFERRED)
+    if (!WE_RingBuffer_Init(&WE_UART6_Internal.rxRing, WE_UART6_Internal.rxRingBuffer, WE_UART_RX_RING_SIZE))
+    {
+        return false;
+    }
+#endif
+
+#if defined(WE_UART_DMA) && !defined(WE_OS_RTOS)
     /* Enable pendable service interrupt which is used for processing data received from radio module
 	 * (interrupt is triggered via WE_UART1_CheckIfDmaDataAvailableAsync() when bytes have been received) */
     NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_RX_DATA_PROCESSING, 0));
@@ -739,6 +1332,10 @@ bool WE_UART6_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t
     LL_USART_EnableIT_RXNE(WE_UART6_Internal.uart);
 #endif
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART6_Init();
+#endif
+
     return true;
 }
 
@@ -749,6 +1346,10 @@ bool WE_UART6_DeInit()
         return true;
     }
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART6_DeInit();
+#endif
+
 #if defined(WE_UART_DMA)
     WE_DMA_for_UART6_DeInit();
 #else
@@ -796,7 +1397,7 @@ void USART6_IRQHandler()
 
         /* RXNE flag will be cleared by reading of DR register */
         WE_UART6_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART6_Internal.uart);
-        (*WE_UART6_Internal.rxByteHandlerP)(&WE_UART6_Internal.receivedByte, 1);
+        WE_UART_OnDataReceived(&WE_UART6_Internal, &WE_UART6_Internal.receivedByte, 1);
     }
     if (LL_USART_IsActiveFlag_ORE(WE_UART6_Internal.uart))
     {
@@ -806,44 +1407,7 @@ void USART6_IRQHandler()
 }
 
 #if defined(WE_UART_DMA)
-static void WE_UART6_CheckIfDmaDataAvailable()
-{
-    /* Get current DMA write position (in ring buffer) */
-    size_t pos = WE_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
-
-    /* Check if new data is available (i.e. write position has changed) */
-    if (pos != WE_UART6_Internal.dmaLastReadPos)
-    {
-        if (pos > WE_UART6_Internal.dmaLastReadPos)
-        {
-            /* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
-            WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[WE_UART6_Internal.dmaLastReadPos], pos - WE_UART6_Internal.dmaLastReadPos);
-        }
-        else /* pos < WE_UART6_Internal.dmaLastReadPos */
-        {
-            /* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
-			 * Data is split:
-			 * - Bytes between lastPos and the end of the buffer
-			 * - Bytes between start of the buffer and pos
-			 */
-            WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[WE_UART6_Internal.dmaLastReadPos], WE_DMA_RX_BUFFER_SIZE - WE_UART6_Internal.dmaLastReadPos);
-            if (pos > 0)
-            {
-                WE_DMA_for_UART6_OnDataReceived(&WE_UART6_Internal.WE_dmaRxBuffer[0], pos);
-            }
-        }
-
-        /* Store DMA write position for next interrupt */
-        WE_UART6_Internal.dmaLastReadPos = pos;
-    }
-}
-
-/**
- * @brief Is called when one or more bytes have been received from UART via DMA.
- * @param data Received data
- * @param size Number of bytes received
- */
-static void WE_DMA_for_UART6_OnDataReceived(uint8_t* data, size_t size) { (*WE_UART6_Internal.rxByteHandlerP)(data, size); }
+static void WE_UART6_CheckIfDmaDataAvailable() { WE_DMA_RX_CheckIfDataAvailable(&WE_UART6_Internal); }
 
 static void WE_DMA_for_UART6_Init() //USART6_RX DMA2, stream 1, channel 5
 {
@@ -851,6 +1415,8 @@ static void WE_DMA_for_UART6_Init() //USART6_RX DMA2, stream 1, channel 5
     WE_UART6_Internal.dmaRx = DMA2;
     WE_UART6_Internal.dmaRxStream = LL_DMA_STREAM_1;
     WE_UART6_Internal.dmaLastReadPos = 0;
+    WE_UART6_Internal.dmaRxBoundaryCount = 0;
+    WE_UART6_Internal.dmaRxBoundaryCountRead = 0;
 
     /* DMA controller clock enable */
     LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
@@ -871,12 +1437,24 @@ static void WE_DMA_for_UART6_Init() //USART6_RX DMA2, stream 1, channel 5
     LL_DMA_DisableFifoMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
 
     LL_DMA_SetPeriphAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t)&USART6->DR);
-    LL_DMA_SetMemoryAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t)WE_UART6_Internal.WE_dmaRxBuffer);
-    LL_DMA_SetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, WE_DMA_RX_BUFFER_SIZE);
+#if defined(WE_UART_DMA_DOUBLE_BUFFER)
+    /* Double buffer mode: DMA alternates between first (memory 0) and second half (memory 1) of receive buffer */
+    LL_DMA_SetMemoryAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t)WE_UART6_Internal.dmaRxBuffer);
+    LL_DMA_SetMemory1Address(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t)(WE_UART6_Internal.dmaRxBuffer + WE_UART6_Internal.dmaRxBufferSize / 2));
+    LL_DMA_SetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, WE_UART6_Internal.dmaRxBufferSize / 2);
+    LL_DMA_SetCurrentTargetMem(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, LL_DMA_CURRENTTARGETMEM0);
+    LL_DMA_EnableDoubleBufferMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+
+    /* Enable TC interrupt (is triggered whenever the DMA switches buffers) */
+    LL_DMA_EnableIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+#else
+    LL_DMA_SetMemoryAddress(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, (uint32_t)WE_UART6_Internal.dmaRxBuffer);
+    LL_DMA_SetDataLength(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream, WE_UART6_Internal.dmaRxBufferSize);
 
     /* Enable HT & TC interrupts */
     LL_DMA_EnableIT_HT(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
     LL_DMA_EnableIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+#endif
 
     /* Enable DMA */
     LL_USART_EnableDMAReq_RX(WE_UART6_Internal.uart);
@@ -896,6 +1474,9 @@ static void WE_DMA_for_UART6_DeInit()
     LL_USART_DisableDMAReq_RX(WE_UART6_Internal.uart);
     LL_DMA_DisableIT_TC(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
     LL_DMA_DisableIT_HT(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+#if defined(WE_UART_DMA_DOUBLE_BUFFER)
+    LL_DMA_DisableDoubleBufferMode(WE_UART6_Internal.dmaRx, WE_UART6_Internal.dmaRxStream);
+#endif
     NVIC_DisableIRQ(DMA2_Stream1_IRQn);
     LL_AHB1_GRP1_DisableClock(LL_AHB1_GRP1_PERIPH_DMA2);
 
@@ -906,16 +1487,189 @@ static void WE_DMA_for_UART6_DeInit()
 
 #endif /* defined(WE_UART_DMA) */
 
+#if defined(WE_UART_DMA_TX)
+
+/**
+ * @brief Interrupt handler for data transmitted to wireless module via DMA (UART1).
+ *
+ * Is only used if DMA TX is enabled.
+ */
+void DMA2_Stream7_IRQHandler()
+{
+    if (LL_DMA_IsEnabledIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TC7(WE_UART1_Internal.dmaTx))
+    {
+        /* DMA transmit complete */
+        LL_DMA_ClearFlag_TC7(WE_UART1_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART1_Internal, true);
+    }
+
+    if (LL_DMA_IsEnabledIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TE7(WE_UART1_Internal.dmaTx))
+    {
+        /* DMA transfer error */
+        LL_DMA_ClearFlag_TE7(WE_UART1_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART1_Internal, false);
+    }
+}
+
+/**
+ * @brief Interrupt handler for data transmitted to wireless module via DMA (UART6).
+ *
+ * Is only used if DMA TX is enabled.
+ */
+void DMA2_Stream6_IRQHandler()
+{
+    if (LL_DMA_IsEnabledIT_TC(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TC6(WE_UART6_Internal.dmaTx))
+    {
+        /* DMA transmit complete */
+        LL_DMA_ClearFlag_TC6(WE_UART6_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART6_Internal, true);
+    }
+
+    if (LL_DMA_IsEnabledIT_TE(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TE6(WE_UART6_Internal.dmaTx))
+    {
+        /* DMA transfer error */
+        LL_DMA_ClearFlag_TE6(WE_UART6_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART6_Internal, false);
+    }
+}
+
+static void WE_DMA_TX_for_UART1_Init() //USART1_TX DMA2, stream 7, channel 4
+{
+    WE_UART1_Internal.dmaTx = DMA2;
+    WE_UART1_Internal.dmaTxStream = LL_DMA_STREAM_7;
+    WE_UART1_Internal.txBusy = false;
+    WE_UART1_Internal.txCompleteCb = NULL;
+
+    /* DMA controller clock enable */
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
+
+    /* DMA2_Stream7_IRQn interrupt configuration */
+    NVIC_SetPriority(DMA2_Stream7_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_TX, 0));
+    NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+
+    LL_DMA_SetChannelSelection(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_CHANNEL_4);
+    LL_DMA_SetDataTransferDirection(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetStreamPriorityLevel(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_DisableFifoMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+
+    LL_DMA_SetPeriphAddress(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, (uint32_t)&USART1->DR);
+
+    /* Enable TC & TE interrupts */
+    LL_DMA_EnableIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_DMA_EnableIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+
+    /* Stream is enabled per transfer in WE_UART1_TransmitAsync() */
+    LL_USART_EnableDMAReq_TX(WE_UART1_Internal.uart);
+}
+
+static void WE_DMA_TX_for_UART1_DeInit()
+{
+    if (WE_UART1_Internal.dmaTx == NULL)
+    {
+        return;
+    }
+
+    LL_DMA_DisableStream(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_USART_DisableDMAReq_TX(WE_UART1_Internal.uart);
+    LL_DMA_DisableIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_DMA_DisableIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    NVIC_DisableIRQ(DMA2_Stream7_IRQn);
+
+    WE_UART1_Internal.dmaTxStream = 0;
+    WE_UART1_Internal.dmaTx = NULL;
+    WE_UART1_Internal.txBusy = false;
+    WE_UART1_Internal.txCompleteCb = NULL;
+}
+
+static void WE_DMA_TX_for_UART6_Init() //USART6_TX DMA2, stream 6, channel 5
+{
+    WE_UART6_Internal.dmaTx = DMA2;
+    WE_UART6_Internal.dmaTxStream = LL_DMA_STREAM_6;
+    WE_UART6_Internal.txBusy = false;
+    WE_UART6_Internal.txCompleteCb = NULL;
+
+    /* DMA controller clock enable */
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
+
+    /* DMA2_Stream6_IRQn interrupt configuration */
+    NVIC_SetPriority(DMA2_Stream6_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_TX, 0));
+    NVIC_EnableIRQ(DMA2_Stream6_IRQn);
+
+    LL_DMA_SetChannelSelection(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_CHANNEL_5);
+    LL_DMA_SetDataTransferDirection(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetStreamPriorityLevel(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_DisableFifoMode(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+
+    LL_DMA_SetPeriphAddress(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream, (uint32_t)&USART6->DR);
+
+    /* Enable TC & TE interrupts */
+    LL_DMA_EnableIT_TC(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+    LL_DMA_EnableIT_TE(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+
+    /* Stream is enabled per transfer in WE_UART6_TransmitAsync() */
+    LL_USART_EnableDMAReq_TX(WE_UART6_Internal.uart);
+}
+
+static void WE_DMA_TX_for_UART6_DeInit()
+{
+    if (WE_UART6_Internal.dmaTx == NULL)
+    {
+        return;
+    }
+
+    LL_DMA_DisableStream(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+    LL_USART_DisableDMAReq_TX(WE_UART6_Internal.uart);
+    LL_DMA_DisableIT_TC(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+    LL_DMA_DisableIT_TE(WE_UART6_Internal.dmaTx, WE_UART6_Internal.dmaTxStream);
+    NVIC_DisableIRQ(DMA2_Stream6_IRQn);
+
+    WE_UART6_Internal.dmaTxStream = 0;
+    WE_UART6_Internal.dmaTx = NULL;
+    WE_UART6_Internal.txBusy = false;
+    WE_UART6_Internal.txCompleteCb = NULL;
+}
+
+#endif /* defined(WE_UART_DMA_TX) */
+
 #ifdef WE_MICROSECOND_TICK
+#if defined(WE_MICROSECOND_TICK_TIMER)
+void WE_DelayMicroseconds(uint32_t sleepForUsec)
+{
+    uint32_t initialTicks = WE_TICK_TIMER->CNT;
+    while ((WE_TICK_TIMER->CNT - initialTicks) < sleepForUsec)
+    {
+#if defined(WE_UART_RX_DEFERRED)
+        WE_UART_Process();
+#endif
+    }
+}
+
+uint32_t WE_GetTickMicroseconds() { return WE_TICK_TIMER->CNT; }
+#else
 void WE_DelayMicroseconds(uint32_t sleepForUsec)
 {
     uint32_t initialTicks = DWT->CYCCNT;
     sleepForUsec *= dwtTicksPerMicrosecond;
     while ((DWT->CYCCNT - initialTicks) < sleepForUsec - dwtTicksPerMicrosecond)
-        ;
+    {
+#if defined(WE_UART_RX_DEFERRED)
+        WE_UART_Process();
+#endif
+    }
 }
 
 uint32_t WE_GetTickMicroseconds() { return DWT->CYCCNT / dwtTicksPerMicrosecond; }
+#endif
 #endif /* WE_MICROSECOND_TICK */
 
 #endif /* STM32F401xE */
@@ -51,6 +51,29 @@ extern "C"
 
 extern void WE_SystemClock_Config(void);
 
+#if defined(WE_UART_DMA)
+/**
+ * @brief Configure the buffer used for receiving data via DMA.
+ *
+ * Must be called before the UART is initialized. The buffer needs to be large enough to hold
+ * all data received while the previously received data is being processed. In double buffer mode (WE_UART_DMA_DOUBLE_BUFFER),
+ * the first and the second half of the buffer are used as DMA memory 0 and memory 1.
+ *
+ * @param[in] buffer Buffer to be used (NULL to use the default buffer of size WE_DMA_RX_BUFFER_SIZE)
+ * @param[in] size Size of buffer in bytes (must be even)
+ *
+ * @return True if request succeeded, false otherwise (e.g. if the UART is already initialized)
+ */
+extern bool WE_UART1_ConfigureDmaRx(uint8_t* buffer, uint16_t size);
+
+/**
+ * @brief Returns how often the DMA has overwritten received data that has not been processed yet.
+ *
+ * @return Number of DMA receive buffer overruns
+ */
+extern uint32_t WE_UART1_GetDmaRxOverrunCount();
+#endif
+
 /**
  * @brief Initialize and start the UART.
  *
@@ -74,6 +97,52 @@ extern bool WE_UART1_DeInit();
  */
 extern bool WE_UART1_Transmit(const uint8_t* data, uint16_t length);
 
+/**
+ * @brief Returns the receive overflow counters of the UART (can be used as WE_UART_t::uartGetRxOverflowCounts).
+ *
+ * @param[out] droppedBytesP Number of received bytes dropped because the receive ring buffer was full (0 if WE_UART_RX_DEFERRED is not used)
+ * @param[out] dmaOverrunsP Number of DMA receive buffer overruns (0 if WE_UART_DMA is not used)
+ */
+extern void WE_UART1_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP);
+
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Start a non-blocking transmission via UART using DMA.
+ *
+ * The data buffer must remain valid until completeCb has been called.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ * @param[in] completeCb Function to be called (from interrupt context) when the transfer has finished (may be NULL)
+ *
+ * @return True if the transfer has been started, false if another transfer is still in progress
+ */
+extern bool WE_UART1_TransmitAsync(const uint8_t* data, uint16_t length, WE_UART_TransmitComplete_t completeCb);
+#endif
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Configure the buffer used for receiving data via DMA.
+ *
+ * Must be called before the UART is initialized. The buffer needs to be large enough to hold
+ * all data received while the previously received data is being processed. In double buffer mode (WE_UART_DMA_DOUBLE_BUFFER),
+ * the first and the second half of the buffer are used as DMA memory 0 and memory 1.
+ *
+ * @param[in] buffer Buffer to be used (NULL to use the default buffer of size WE_DMA_RX_BUFFER_SIZE)
+ * @param[in] size Size of buffer in bytes (must be even)
+ *
+ * @return True if request succeeded, false otherwise (e.g. if the UART is already initialized)
+ */
+extern bool WE_UART6_ConfigureDmaRx(uint8_t* buffer, uint16_t size);
+
+/**
+ * @brief Returns how often the DMA has overwritten received data that has not been processed yet.
+ *
+ * @return Number of DMA receive buffer overruns
+ */
+extern uint32_t WE_UART6_GetDmaRxOverrunCount();
+#endif
+
 /**
  * @brief Initialize and start the UART.
  *
@@ -97,6 +166,29 @@ extern bool WE_UART6_DeInit();
  */
 extern bool WE_UART6_Transmit(const uint8_t* data, uint16_t length);
 
+/**
+ * @brief Returns the receive overflow counters of the UART (can be used as WE_UART_t::uartGetRxOverflowCounts).
+ *
+ * @param[out] droppedBytesP Number of received bytes dropped because the receive ring buffer was full (0 if WE_UART_RX_DEFERRED is not used)
+ * @param[out] dmaOverrunsP Number of DMA receive buffer overruns (0 if WE_UART_DMA is not used)
+ */
+extern void WE_UART6_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP);
+
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Start a non-blocking transmission via UART using DMA.
+ *
+ * The data buffer must remain valid until completeCb has been called.
+ *
+ * @param[in] data Pointer to data buffer (data to be sent)
+ * @param[in] length Number of bytes to be sent
+ * @param[in] completeCb Function to be called (from interrupt context) when the transfer has finished (may be NULL)
+ *
+ * @return True if the transfer has been started, false if another transfer is still in progress
+ */
+extern bool WE_UART6_TransmitAsync(const uint8_t* data, uint16_t length, WE_UART_TransmitComplete_t completeCb);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
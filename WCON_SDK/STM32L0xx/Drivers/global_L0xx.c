@@ -34,24 +34,65 @@
 
 #include <global/global.h>
 #include <global_platform.h>
+
+#if defined(WE_UART_RX_DEFERRED)
+#include <ringbuffer.h>
+
+#ifndef WE_UART_RX_RING_SIZE
+/**
+ * @brief Size of the per-UART receive ring buffer used if WE_UART_RX_DEFERRED is defined (must be a power of two).
+ */
+#define WE_UART_RX_RING_SIZE 1024
+#endif
+#endif
 #if defined(WE_UART_DMA)
 /**
  * @brief Priority for DMA interrupts (used for receiving data from radio module)
  */
-#define WE_PRIORITY_DMA_RX 0
+#define WE_PRIORITY_DMA_RX (WE_PRIORITY_BASE + 0)
 
+#ifndef WE_DMA_RX_BUFFER_SIZE
 /**
- * @brief Size of DMA receive buffer.
+ * @brief Default size of DMA receive buffer (used if no buffer has been configured via WE_UARTx_ConfigureDmaRx()).
  */
 #define WE_DMA_RX_BUFFER_SIZE 512
+#endif
 
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t* data, size_t size);
 static void WE_DMA_for_UART1_Init();
 static void WE_DMA_for_UART1_DeInit();
 static void WE_UART1_CheckIfDmaDataAvailable();
 static void WE_UART1_CheckIfDmaDataAvailableAsync();
 #endif
 
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Priority for DMA interrupts (used for transmitting data to radio module)
+ */
+#define WE_PRIORITY_DMA_TX (WE_PRIORITY_BASE + 1)
+
+static void WE_DMA_TX_for_UART1_Init();
+static void WE_DMA_TX_for_UART1_DeInit();
+#endif
+
+#ifdef WE_MICROSECOND_TICK
+/**
+ * @brief Timer used as microsecond time base (16-bit counter running at 1 MHz, extended to 32 bits by counting overflows).
+ */
+#define WE_TICK_TIMER TIM2
+
+/**
+ * @brief Priority for the microsecond time base's overflow interrupt.
+ */
+#define WE_PRIORITY_TICK_TIMER 0
+
+/**
+ * @brief Number of overflows of the microsecond time base (upper 16 bits of the microsecond tick).
+ */
+static volatile uint32_t tickTimerOverflowCount = 0;
+
+static void WE_TickTimer_Init();
+#endif /* WE_MICROSECOND_TICK */
+
 static HAL_StatusTypeDef UartTransmitInternal(USART_TypeDef* hUart, const uint8_t* data, uint16_t size);
 
 typedef struct
@@ -85,7 +126,12 @@ typedef struct
     /**
 	 * @brief Buffer used for dmaRx.
 	 */
-    uint8_t WE_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+    uint8_t* dmaRxBuffer;
+
+    /**
+	 * @brief Size of dmaRxBuffer in bytes.
+	 */
+    uint16_t dmaRxBufferSize;
 
     /**
 	 * @brief Last read position in DMA receive buffer (used only if DMA is enabled).
@@ -93,9 +139,68 @@ typedef struct
 	 */
     size_t dmaLastReadPos;
 
+    /**
+	 * @brief Number of times the DMA has reached the middle or the end of dmaRxBuffer (incremented in DMA interrupt).
+	 */
+    volatile uint32_t dmaRxBoundaryCount;
+
+    /**
+	 * @brief Number of buffer boundaries (middle or end of dmaRxBuffer) that have been passed by dmaLastReadPos.
+	 */
+    uint32_t dmaRxBoundaryCountRead;
+
+    /**
+	 * @brief Number of times the DMA has overwritten data in dmaRxBuffer that has not been processed yet.
+	 */
+    uint32_t dmaRxOverrunCount;
+
     bool triggered;
 #endif
 
+#if defined(WE_UART_DMA_TX)
+    /**
+	 * @brief DMA used for transmitting data to radio module (used only if DMA TX is enabled).
+	 */
+    DMA_TypeDef* dmaTx;
+
+    /**
+	 * @brief DMA channel used for transmitting data to radio module (used only if DMA TX is enabled).
+	 */
+    uint32_t dmaTxStream;
+
+    /**
+	 * @brief True while a DMA transmission is in progress.
+	 */
+    volatile bool txBusy;
+
+    /**
+	 * @brief Result of the last DMA transmission (true if all bytes have been transferred).
+	 */
+    volatile bool txSuccess;
+
+    /**
+	 * @brief Function to be called when the running DMA transmission has finished.
+	 */
+    WE_UART_TransmitComplete_t txCompleteCb;
+#endif
+
+#if defined(WE_UART_RX_DEFERRED)
+    /**
+	 * @brief Ring buffer for received data, filled in interrupt context and drained by WE_UART_Process().
+	 */
+    WE_RingBuffer_t rxRing;
+
+    /**
+	 * @brief Storage of rxRing.
+	 */
+    uint8_t rxRingBuffer[WE_UART_RX_RING_SIZE];
+
+    /**
+	 * @brief Is set to true while WE_UART_Process() is passing data to rxByteHandlerP (prevents reentrant processing).
+	 */
+    bool rxProcessing;
+#endif
+
     /**
 	 * @brief Last received byte
 	 */
@@ -103,6 +208,13 @@ typedef struct
 
 } WE_UART_Internal_t;
 
+#if defined(WE_UART_DMA)
+/**
+ * @brief Default DMA receive buffer of UART1.
+ */
+static uint8_t WE_UART1_dmaRxBuffer[WE_DMA_RX_BUFFER_SIZE];
+#endif
+
 WE_UART_Internal_t WE_UART1_Internal = {
     .uart = NULL,
     .flowControl = WE_FlowControl_NoFlowControl,
@@ -110,9 +222,24 @@ WE_UART_Internal_t WE_UART1_Internal = {
 #if defined(WE_UART_DMA)
     .dmaRx = NULL,
     .dmaRxStream = 0,
+    .dmaRxBuffer = WE_UART1_dmaRxBuffer,
+    .dmaRxBufferSize = WE_DMA_RX_BUFFER_SIZE,
     .dmaLastReadPos = 0,
+    .dmaRxBoundaryCount = 0,
+    .dmaRxBoundaryCountRead = 0,
+    .dmaRxOverrunCount = 0,
     .triggered = false,
 #endif
+#if defined(WE_UART_DMA_TX)
+    .dmaTx = NULL,
+    .dmaTxStream = 0,
+    .txBusy = false,
+    .txSuccess = false,
+    .txCompleteCb = NULL,
+#endif
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
 };
 
 WE_UART_Internal_t WE_UART4_Internal = {
@@ -125,8 +252,166 @@ WE_UART_Internal_t WE_UART4_Internal = {
     .dmaLastReadPos = 0,
     .triggered = false,
 #endif
+#if defined(WE_UART_DMA_TX)
+    .dmaTx = NULL,
+    .dmaTxStream = 0,
+    .txBusy = false,
+    .txSuccess = false,
+    .txCompleteCb = NULL,
+#endif
+#if defined(WE_UART_RX_DEFERRED)
+    .rxProcessing = false,
+#endif
 };
 
+/**
+ * @brief Is called when one or more bytes have been received from the radio module.
+ *
+ * If WE_UART_RX_DEFERRED is defined, the data is only appended to the UART's receive ring
+ * buffer and handed over to the driver by WE_UART_Process() (if running on top of an RTOS, the
+ * thread waiting in WE_WaitEvent() is woken up). Otherwise, the driver's byte handler is called
+ * directly (i.e. in interrupt context).
+ *
+ * @param uartInternal UART that has received the data
+ * @param data Received data
+ * @param size Number of bytes received
+ */
+static void WE_UART_OnDataReceived(WE_UART_Internal_t* uartInternal, uint8_t* data, size_t size)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_RingBuffer_Write(&uartInternal->rxRing, data, size);
+#if defined(WE_OS_RTOS)
+    WE_OS_NotifyDataReceived();
+#endif
+#else
+    (*uartInternal->rxByteHandlerP)(data, size);
+#endif
+}
+
+#if defined(WE_UART_DMA)
+/**
+ * @brief Returns the current DMA write position in the receive buffer.
+ *
+ * @param uartInternal UART to be checked
+ *
+ * @return Position in dmaRxBuffer the DMA is going to write the next byte to
+ */
+static size_t WE_DMA_RX_GetWritePos(WE_UART_Internal_t* uartInternal) { return uartInternal->dmaRxBufferSize - LL_DMA_GetDataLength(uartInternal->dmaRx, uartInternal->dmaRxStream); }
+
+/**
+ * @brief Passes data that has been written to the DMA receive buffer since the last call to the driver.
+ *
+ * Also detects if the DMA has lapped the last read position (i.e. unprocessed data has been overwritten).
+ * To do so, the number of buffer boundaries (middle and end of buffer) that have been reached by the DMA
+ * (counted in the DMA interrupt) is compared to the number of boundaries between the last and the current
+ * read position. Each additional pair of boundaries corresponds to one full lap of the DMA.
+ *
+ * @param uartInternal UART to be checked
+ */
+static void WE_DMA_RX_CheckIfDataAvailable(WE_UART_Internal_t* uartInternal)
+{
+    size_t size = uartInternal->dmaRxBufferSize;
+    size_t halfSize = size / 2;
+    size_t lastPos = uartInternal->dmaLastReadPos;
+
+    /* Boundary count must be read before write position (a boundary that is reached in between is detected during the next call) */
+    uint32_t boundaryCount = uartInternal->dmaRxBoundaryCount;
+    size_t pos = WE_DMA_RX_GetWritePos(uartInternal);
+    size_t count = (pos >= lastPos) ? (pos - lastPos) : (size - lastPos + pos);
+
+    /* Number of boundaries between last read position and current write position */
+    uint32_t boundariesPassed = 0;
+    if (count > 0)
+    {
+        size_t end = lastPos + count;
+        if ((lastPos < halfSize) && (end >= halfSize))
+        {
+            boundariesPassed++;
+        }
+        if (end >= size)
+        {
+            boundariesPassed++;
+        }
+        if (end >= size + halfSize)
+        {
+            boundariesPassed++;
+        }
+    }
+
+    int32_t missedBoundaries = (int32_t)(boundaryCount - uartInternal->dmaRxBoundaryCountRead - boundariesPassed);
+    if (missedBoundaries >= 2)
+    {
+        /* DMA has lapped the read position at least once - data has been lost */
+        uartInternal->dmaRxOverrunCount += (uint32_t)missedBoundaries / 2;
+        uartInternal->dmaRxBoundaryCountRead += (uint32_t)missedBoundaries & ~(uint32_t)1;
+    }
+    uartInternal->dmaRxBoundaryCountRead += boundariesPassed;
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    if (pos > lastPos)
+    {
+        /* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
+        WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[lastPos], pos - lastPos);
+    }
+    else /* pos < lastPos */
+    {
+        /* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
+		 * Data is split:
+		 * - Bytes between lastPos and the end of the buffer
+		 * - Bytes between start of the buffer and pos
+		 */
+        WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[lastPos], size - lastPos);
+        if (pos > 0)
+        {
+            WE_UART_OnDataReceived(uartInternal, &uartInternal->dmaRxBuffer[0], pos);
+        }
+    }
+
+    /* Store DMA write position for next interrupt */
+    uartInternal->dmaLastReadPos = pos;
+}
+#endif /* defined(WE_UART_DMA) */
+
+#if defined(WE_UART_RX_DEFERRED)
+/**
+ * @brief Passes all data stored in the UART's receive ring buffer to the driver's byte handler.
+ *
+ * @param uartInternal UART to be processed
+ */
+static void WE_UART_ProcessInternal(WE_UART_Internal_t* uartInternal)
+{
+    if (uartInternal->rxProcessing)
+    {
+        /* Called from within the byte handler (e.g. by a blocking function called from a driver callback) */
+        return;
+    }
+
+    uartInternal->rxProcessing = true;
+
+    uint8_t* data;
+    uint32_t length;
+    while ((uartInternal->rxByteHandlerP != NULL) && ((length = WE_RingBuffer_Peek(&uartInternal->rxRing, &data)) > 0))
+    {
+        (*uartInternal->rxByteHandlerP)(data, length);
+        WE_RingBuffer_Release(&uartInternal->rxRing, length);
+    }
+
+    uartInternal->rxProcessing = false;
+}
+#endif /* defined(WE_UART_RX_DEFERRED) */
+
+void WE_UART_Process()
+{
+#if defined(WE_UART_RX_DEFERRED)
+    WE_UART_ProcessInternal(&WE_UART1_Internal);
+    WE_UART_ProcessInternal(&WE_UART4_Internal);
+#endif
+}
+
 void WE_SystemClock_Config()
 {
     RCC_OscInitTypeDef RCC_OscInitStruct = {0};
@@ -159,16 +444,156 @@ void WE_SystemClock_Config()
     {
         WE_Error_Handler();
     }
+
+#ifdef WE_MICROSECOND_TICK
+    WE_TickTimer_Init();
+#endif
+}
+
+#if defined(WE_UART_DMA_TX)
+/**
+ * @brief Is called when a DMA transmission has finished (or failed).
+ *
+ * The busy flag is reset before calling the completion callback, so the
+ * callback may directly start the next transfer.
+ *
+ * @param uartInternal UART whose transmission has finished
+ * @param success True if all bytes have been transferred, false in case of a transfer error
+ */
+static void WE_UART_OnDmaTxFinished(WE_UART_Internal_t* uartInternal, bool success)
+{
+    WE_UART_TransmitComplete_t completeCb = uartInternal->txCompleteCb;
+    uartInternal->txCompleteCb = NULL;
+    uartInternal->txSuccess = success;
+    uartInternal->txBusy = false;
+    if (completeCb != NULL)
+    {
+        completeCb(success);
+    }
+}
+
+bool WE_UART1_Transmit(const uint8_t* data, uint16_t length)
+{
+    /* Wait for a previously started asynchronous transfer to finish */
+    while (WE_UART1_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART1_TransmitAsync(data, length, NULL))
+    {
+        return false;
+    }
+
+    while (WE_UART1_Internal.txBusy)
+    {
+    }
+
+    if (!WE_UART1_Internal.txSuccess)
+    {
+        return false;
+    }
+
+    /* Wait until the last byte has been shifted out */
+    while (!LL_USART_IsActiveFlag_TC(WE_UART1_Internal.uart))
+    {
+    }
+    return true;
 }
 
+bool WE_UART1_TransmitAsync(const uint8_t* data, uint16_t length, WE_UART_TransmitComplete_t completeCb)
+{
+    if ((WE_UART1_Internal.uart == NULL) || (WE_UART1_Internal.dmaTx == NULL) || (data == NULL) || (length == 0))
+    {
+        return false;
+    }
+
+    /* Check and set the busy flag atomically, as transfers may be started from interrupt context as well */
+    uint32_t state = WE_EnterCritical();
+    bool busy = WE_UART1_Internal.txBusy;
+    WE_UART1_Internal.txBusy = true;
+    WE_ExitCritical(state);
+    if (busy)
+    {
+        return false;
+    }
+
+    WE_UART1_Internal.txCompleteCb = completeCb;
+
+    LL_DMA_DisableChannel(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_DMA_ClearFlag_GI2(WE_UART1_Internal.dmaTx);
+
+    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, (uint32_t)data);
+    LL_DMA_SetDataLength(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, length);
+
+    LL_USART_ClearFlag_TC(WE_UART1_Internal.uart);
+    LL_DMA_EnableChannel(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+
+    return true;
+}
+#else
 bool WE_UART1_Transmit(const uint8_t* data, uint16_t length) { return (HAL_OK == UartTransmitInternal(WE_UART1_Internal.uart, data, length)); }
+#endif /* defined(WE_UART_DMA_TX) */
+
+/**
+ * @brief Returns the receive overflow counters of a UART (see WE_UART_GetRxOverflowCounts_t).
+ */
+static void WE_UART_GetRxOverflowCountsInternal(WE_UART_Internal_t* uartInternal, uint32_t* droppedBytesP, uint32_t* dmaOverrunsP)
+{
+#if defined(WE_UART_RX_DEFERRED)
+    *droppedBytesP = uartInternal->rxRing.droppedBytes;
+#else
+    *droppedBytesP = 0;
+#endif
+#if defined(WE_UART_DMA)
+    *dmaOverrunsP = uartInternal->dmaRxOverrunCount;
+#else
+    *dmaOverrunsP = 0;
+#endif
+}
+
+void WE_UART1_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART1_Internal, droppedBytesP, dmaOverrunsP); }
+
+#if defined(WE_UART_DMA)
+bool WE_UART1_ConfigureDmaRx(uint8_t* buffer, uint16_t size)
+{
+    if (WE_UART1_Internal.uart != NULL)
+    {
+        /* Buffer can't be changed while UART is running */
+        return false;
+    }
+
+    if (buffer == NULL)
+    {
+        /* Use default buffer */
+        buffer = WE_UART1_dmaRxBuffer;
+        size = WE_DMA_RX_BUFFER_SIZE;
+    }
+    else if ((size < 2) || ((size % 2) != 0))
+    {
+        return false;
+    }
+
+    WE_UART1_Internal.dmaRxBuffer = buffer;
+    WE_UART1_Internal.dmaRxBufferSize = size;
+    return true;
+}
+
+uint32_t WE_UART1_GetDmaRxOverrunCount() { return WE_UART1_Internal.dmaRxOverrunCount; }
+#endif /* defined(WE_UART_DMA) */
 
 bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
 {
     WE_UART1_Internal.flowControl = flowControl;
     WE_UART1_Internal.rxByteHandlerP = rxByteHandlerP;
 
-#if defined(WE_UART_DMA)
+#if defined(WE_UART_RX_DEFERRED)
+    if (!WE_RingBuffer_Init(&WE_UART1_Internal.rxRing, WE_UART1_Internal.rxRingBuffer, WE_UART_RX_RING_SIZE))
+    {
+        return false;
+    }
+#endif
+
+#if defined(WE_UART_DMA) && !defined(WE_OS_RTOS)
     /* Enable pendable service interrupt which is used for processing data received from radio module
 	 * (interrupt is triggered via WE_UART1_CheckIfDmaDataAvailableAsync() when bytes have been received) */
     NVIC_SetPriority(PendSV_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_RX_DATA_PROCESSING, 0));
@@ -312,6 +737,10 @@ bool WE_UART1_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t
     LL_USART_EnableIT_RXNE(WE_UART1_Internal.uart);
 #endif
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART1_Init();
+#endif
+
     return true;
 }
 
@@ -322,6 +751,10 @@ bool WE_UART1_DeInit()
         return true;
     }
 
+#if defined(WE_UART_DMA_TX)
+    WE_DMA_TX_for_UART1_DeInit();
+#endif
+
 #if defined(WE_UART_DMA)
     WE_DMA_for_UART1_DeInit();
 #else
@@ -347,11 +780,20 @@ bool WE_UART1_DeInit()
 
 bool WE_UART4_Transmit(const uint8_t* data, uint16_t length) { return (HAL_OK == UartTransmitInternal(WE_UART4_Internal.uart, data, length)); }
 
+void WE_UART4_GetRxOverflowCounts(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP) { WE_UART_GetRxOverflowCountsInternal(&WE_UART4_Internal, droppedBytesP, dmaOverrunsP); }
+
 bool WE_UART4_Init(uint32_t baudrate, WE_FlowControl_t flowControl, WE_Parity_t parity, WE_UART_HandleRxByte_t* rxByteHandlerP)
 {
     WE_UART4_Internal.flowControl = flowControl;
     WE_UART4_Internal.rxByteHandlerP = rxByteHandlerP;
 
+#if defined(WE_UART_RX_DEFERRED)
+    if (!WE_RingBuffer_Init(&WE_UART4_Internal.rxRing, WE_UART4_Internal.rxRingBuffer, WE_UART_RX_RING_SIZE))
+    {
+        return false;
+    }
+#endif
+
     /* USART1 clock enable */
     LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_USART4);
     LL_IOP_GRP1_EnableClock(LL_IOP_GRP1_PERIPH_GPIOC);
@@ -547,7 +989,7 @@ void USART1_IRQHandler()
 
         /* RXNE flag will be cleared by reading of DR register */
         WE_UART1_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART1_Internal.uart);
-        (*WE_UART1_Internal.rxByteHandlerP)(&WE_UART1_Internal.receivedByte, 1);
+        WE_UART_OnDataReceived(&WE_UART1_Internal, &WE_UART1_Internal.receivedByte, 1);
     }
     if (LL_USART_IsActiveFlag_ORE(WE_UART1_Internal.uart))
     {
@@ -571,7 +1013,7 @@ void USART4_5_IRQHandler()
 
         /* RXNE flag will be cleared by reading of DR register */
         WE_UART4_Internal.receivedByte = LL_USART_ReceiveData8(WE_UART4_Internal.uart);
-        (*WE_UART4_Internal.rxByteHandlerP)(&WE_UART4_Internal.receivedByte, 1);
+        WE_UART_OnDataReceived(&WE_UART4_Internal, &WE_UART4_Internal.receivedByte, 1);
     }
     if (LL_USART_IsActiveFlag_ORE(WE_UART4_Internal.uart))
     {
@@ -579,19 +1021,40 @@ void USART4_5_IRQHandler()
     }
 }
 
-#if defined(WE_UART_DMA)
+#if defined(WE_UART_DMA) || defined(WE_UART_DMA_TX)
 /**
- * @brief Interrupt handler for data received from wireless module via DMA.
+ * @brief Interrupt handler for data received from / transmitted to wireless module via DMA.
  *
- * Is only used if DMA is enabled.
+ * Is only used if DMA (RX and/or TX) is enabled. Channel 3 is used for reception,
+ * channel 2 for transmission.
  */
 void DMA1_Channel2_3_IRQHandler()
 {
+#if defined(WE_UART_DMA_TX)
+    if (LL_DMA_IsEnabledIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TC2(WE_UART1_Internal.dmaTx))
+    {
+        /* DMA transmit complete */
+
+        LL_DMA_ClearFlag_TC2(WE_UART1_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART1_Internal, true);
+    }
+
+    if (LL_DMA_IsEnabledIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream) && LL_DMA_IsActiveFlag_TE2(WE_UART1_Internal.dmaTx))
+    {
+        /* DMA transfer error */
+
+        LL_DMA_ClearFlag_TE2(WE_UART1_Internal.dmaTx);
+        WE_UART_OnDmaTxFinished(&WE_UART1_Internal, false);
+    }
+#endif
+
+#if defined(WE_UART_DMA)
     if (LL_DMA_IsEnabledIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream) && LL_DMA_IsActiveFlag_HT3(WE_UART1_Internal.dmaRx))
     {
         /* DMA receive half-transfer complete */
 
         LL_DMA_ClearFlag_HT3(WE_UART1_Internal.dmaRx);
+        WE_UART1_Internal.dmaRxBoundaryCount++;
         WE_UART1_CheckIfDmaDataAvailableAsync();
     }
 
@@ -600,9 +1063,14 @@ void DMA1_Channel2_3_IRQHandler()
         /* DMA receive transfer complete */
 
         LL_DMA_ClearFlag_TC3(WE_UART1_Internal.dmaRx);
+        WE_UART1_Internal.dmaRxBoundaryCount++;
         WE_UART1_CheckIfDmaDataAvailableAsync();
     }
+#endif
 }
+#endif /* defined(WE_UART_DMA) || defined(WE_UART_DMA_TX) */
+
+#if defined(WE_UART_DMA)
 
 /**
  * @brief Pendable service interrupt handler.
@@ -612,6 +1080,14 @@ void DMA1_Channel2_3_IRQHandler()
  *
  * @see WE_UART1_CheckIfDmaDataAvailableAsync()
  */
+#if defined(WE_OS_RTOS)
+static void WE_UART1_CheckIfDmaDataAvailableAsync()
+{
+    /* PendSV is used by the RTOS for context switching - the data is only copied to the receive
+     * ring buffer here and parsed by the thread waiting in WE_WaitEvent() (see WE_OS_NotifyDataReceived()) */
+    WE_UART1_CheckIfDmaDataAvailable();
+}
+#else
 void PendSV_Handler() { WE_UART1_CheckIfDmaDataAvailable(); }
 
 static void WE_UART1_CheckIfDmaDataAvailableAsync()
@@ -619,45 +1095,9 @@ static void WE_UART1_CheckIfDmaDataAvailableAsync()
     /* Trigger pendable service interrupt (PendSV) */
     SCB->ICSR |= SCB_ICSR_PENDSVSET_Msk;
 }
+#endif
 
-static void WE_UART1_CheckIfDmaDataAvailable()
-{
-    /* Get current DMA write position (in ring buffer) */
-    size_t pos = WE_DMA_RX_BUFFER_SIZE - LL_DMA_GetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
-
-    /* Check if new data is available (i.e. write position has changed) */
-    if (pos != WE_UART1_Internal.dmaLastReadPos)
-    {
-        if (pos > WE_UART1_Internal.dmaLastReadPos)
-        {
-            /* Data to be read from DMA ring buffer is continuous - between lastPos and pos */
-            WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], pos - WE_UART1_Internal.dmaLastReadPos);
-        }
-        else /* pos < WE_UART1_Internal.dmaLastReadPos */
-        {
-            /* Ring buffer write position has reached the end of the buffer and restarted at the beginning.
-			 * Data is split:
-			 * - Bytes between lastPos and the end of the buffer
-			 * - Bytes between start of the buffer and pos
-			 */
-            WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[WE_UART1_Internal.dmaLastReadPos], WE_DMA_RX_BUFFER_SIZE - WE_UART1_Internal.dmaLastReadPos);
-            if (pos > 0)
-            {
-                WE_DMA_for_UART1_OnDataReceived(&WE_UART1_Internal.WE_dmaRxBuffer[0], pos);
-            }
-        }
-
-        /* Store DMA write position for next interrupt */
-        WE_UART1_Internal.dmaLastReadPos = pos;
-    }
-}
-
-/**
- * @brief Is called when one or more bytes have been received from UART via DMA.
- * @param data Received data
- * @param size Number of bytes received
- */
-static void WE_DMA_for_UART1_OnDataReceived(uint8_t* data, size_t size) { (*WE_UART1_Internal.rxByteHandlerP)(data, size); }
+static void WE_UART1_CheckIfDmaDataAvailable() { WE_DMA_RX_CheckIfDataAvailable(&WE_UART1_Internal); }
 
 static void WE_DMA_for_UART1_Init()
 {
@@ -665,6 +1105,8 @@ static void WE_DMA_for_UART1_Init()
     WE_UART1_Internal.dmaRx = DMA1;
     WE_UART1_Internal.dmaRxStream = LL_DMA_CHANNEL_3;
     WE_UART1_Internal.dmaLastReadPos = 0;
+    WE_UART1_Internal.dmaRxBoundaryCount = 0;
+    WE_UART1_Internal.dmaRxBoundaryCountRead = 0;
 
     /* DMA controller clock enable */
     LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
@@ -684,8 +1126,8 @@ static void WE_DMA_for_UART1_Init()
     LL_DMA_SetMemorySize(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, LL_DMA_MDATAALIGN_BYTE);
 
     LL_DMA_SetPeriphAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)&USART1->RDR);
-    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)WE_UART1_Internal.WE_dmaRxBuffer);
-    LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_DMA_RX_BUFFER_SIZE);
+    LL_DMA_SetMemoryAddress(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, (uint32_t)WE_UART1_Internal.dmaRxBuffer);
+    LL_DMA_SetDataLength(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream, WE_UART1_Internal.dmaRxBufferSize);
 
     /* Enable HT & TC interrupts */
     LL_DMA_EnableIT_HT(WE_UART1_Internal.dmaRx, WE_UART1_Internal.dmaRxStream);
@@ -719,4 +1161,141 @@ static void WE_DMA_for_UART1_DeInit()
 
 #endif /* defined(WE_UART_DMA) */
 
+#if defined(WE_UART_DMA_TX)
+
+static void WE_DMA_TX_for_UART1_Init() //USART1_TX DMA1, channel 2, request 3
+{
+    WE_UART1_Internal.dmaTx = DMA1;
+    WE_UART1_Internal.dmaTxStream = LL_DMA_CHANNEL_2;
+    WE_UART1_Internal.txBusy = false;
+    WE_UART1_Internal.txCompleteCb = NULL;
+
+    /* DMA controller clock enable */
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+    /* DMA1_Channel2_3_IRQn interrupt configuration (shared with DMA RX, if enabled) */
+#if !defined(WE_UART_DMA)
+    NVIC_SetPriority(DMA1_Channel2_3_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_DMA_TX, 0));
+#endif
+    NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+
+    LL_DMA_SetPeriphRequest(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_REQUEST_3);
+    LL_DMA_SetDataTransferDirection(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetChannelPriorityLevel(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, LL_DMA_MDATAALIGN_BYTE);
+
+    LL_DMA_SetPeriphAddress(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream, (uint32_t)&USART1->TDR);
+
+    /* Enable TC & TE interrupts */
+    LL_DMA_EnableIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_DMA_EnableIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+
+    /* Channel is enabled per transfer in WE_UART1_TransmitAsync() */
+    LL_USART_EnableDMAReq_TX(WE_UART1_Internal.uart);
+}
+
+static void WE_DMA_TX_for_UART1_DeInit()
+{
+    if (WE_UART1_Internal.dmaTx == NULL)
+    {
+        return;
+    }
+
+    LL_DMA_DisableChannel(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_USART_DisableDMAReq_TX(WE_UART1_Internal.uart);
+    LL_DMA_DisableIT_TC(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+    LL_DMA_DisableIT_TE(WE_UART1_Internal.dmaTx, WE_UART1_Internal.dmaTxStream);
+#if !defined(WE_UART_DMA)
+    NVIC_DisableIRQ(DMA1_Channel2_3_IRQn);
+#endif
+
+    WE_UART1_Internal.dmaTxStream = 0;
+    WE_UART1_Internal.dmaTx = NULL;
+    WE_UART1_Internal.txBusy = false;
+    WE_UART1_Internal.txCompleteCb = NULL;
+}
+
+#endif /* defined(WE_UART_DMA_TX) */
+
+#ifdef WE_MICROSECOND_TICK
+/**
+ * @brief Starts the microsecond time base.
+ *
+ * The Cortex-M0+ has no cycle counter, so a general purpose timer is used instead. The timer
+ * keeps running while the CPU is sleeping (WFI), but not in stop mode.
+ */
+static void WE_TickTimer_Init()
+{
+    __HAL_RCC_TIM2_CLK_ENABLE();
+    __HAL_RCC_TIM2_CLK_SLEEP_ENABLE();
+
+    /* Timer clock is twice the APB1 clock if the APB1 prescaler is not 1 */
+    uint32_t timerClock = HAL_RCC_GetPCLK1Freq();
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+    {
+        timerClock *= 2;
+    }
+
+    /* Update event only on counter overflow (not when loading the prescaler below) */
+    WE_TICK_TIMER->CR1 = TIM_CR1_URS;
+    WE_TICK_TIMER->PSC = (timerClock / 1000000) - 1;
+    WE_TICK_TIMER->ARR = 0xFFFF;
+    WE_TICK_TIMER->CNT = 0;
+    WE_TICK_TIMER->EGR = TIM_EGR_UG;
+    WE_TICK_TIMER->SR = 0;
+    tickTimerOverflowCount = 0;
+
+    WE_TICK_TIMER->DIER = TIM_DIER_UIE;
+    NVIC_SetPriority(TIM2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_TICK_TIMER, 0));
+    NVIC_EnableIRQ(TIM2_IRQn);
+
+    WE_TICK_TIMER->CR1 |= TIM_CR1_CEN;
+}
+
+void TIM2_IRQHandler(void)
+{
+    if (WE_TICK_TIMER->SR & TIM_SR_UIF)
+    {
+        WE_TICK_TIMER->SR = (uint32_t)~TIM_SR_UIF;
+        tickTimerOverflowCount++;
+    }
+}
+
+void WE_DelayMicroseconds(uint32_t sleepForUsec)
+{
+    uint32_t initialTicks = WE_GetTickMicroseconds();
+    while ((WE_GetTickMicroseconds() - initialTicks) < sleepForUsec)
+    {
+#if defined(WE_UART_RX_DEFERRED)
+        WE_UART_Process();
+#endif
+    }
+}
+
+uint32_t WE_GetTickMicroseconds()
+{
+    uint32_t overflowCountBefore;
+    uint32_t overflowCount;
+    uint32_t counter;
+    do
+    {
+        overflowCountBefore = tickTimerOverflowCount;
+        counter = WE_TICK_TIMER->CNT;
+        overflowCount = overflowCountBefore;
+        if ((WE_TICK_TIMER->SR & TIM_SR_UIF) && (counter < 0x8000))
+        {
+            /* Counter has overflowed, but the interrupt has not been handled yet (e.g. interrupts are disabled) */
+            overflowCount++;
+        }
+        /* Retry if the overflow interrupt has been handled in the meantime */
+    } while (overflowCountBefore != tickTimerOverflowCount);
+
+    return (overflowCount << 16) | counter;
+}
+#endif /* WE_MICROSECOND_TICK */
+
 #endif /* STM32L073xx */
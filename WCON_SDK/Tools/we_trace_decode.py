@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+#
+# This file is part of WIRELESS CONNECTIVITY SDK:
+#
+# THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED "AS IS". YOU ACKNOWLEDGE THAT WUERTH ELEKTRONIK
+# EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+# TO THE NON-INFRINGEMENT OF THIRD PARTIES' INTELLECTUAL PROPERTY RIGHTS OR THE
+# MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WUERTH ELEKTRONIK EISOS DOES NOT
+# WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+# RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+# COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+# WUERTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+# FROM WUERTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+# THEREOF
+#
+# THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+# FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+# IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+#
+# COPYRIGHT (c) 2025 Wuerth Elektronik eiSos GmbH & Co. KG
+#
+"""Decodes the binary trace log written by WE_Trace_Dump() (see WCON_Drivers/global/trace.h).
+
+Reads the print output of the application (from a file or stdin), replaces the
+hex encoded trace records by the formatted messages and passes all other lines
+through unchanged. The format strings are read from the ELF file of the application.
+
+    python3 we_trace_decode.py application.elf [log.txt]
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+DUMP_PREFIX = "@WT"
+
+LEVELS = {1: "ERROR", 2: "INFO", 3: "DEBUG"}
+
+STRING_TRUNCATED = 0x80000000  # WE_TRACE_STRING_TRUNCATED
+
+CONVERSION = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcspn%])")
+
+
+class Elf:
+    """Minimal ELF reader (little endian): allocated sections and symbol table."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError("%s is not a little endian ELF file" % path)
+        self.is64 = self.data[4] == 2
+        self.pointer_size = 8 if self.is64 else 4
+        if self.is64:
+            shoff, = struct.unpack_from("<Q", self.data, 0x28)
+            shentsize, shnum = struct.unpack_from("<HH", self.data, 0x3A)
+        else:
+            shoff, = struct.unpack_from("<I", self.data, 0x20)
+            shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+
+        self.sections = []
+        for i in range(shnum):
+            offset = shoff + i * shentsize
+            if self.is64:
+                _, sh_type, flags, addr, sh_offset, size, link = struct.unpack_from("<IIQQQQI", self.data, offset)
+            else:
+                _, sh_type, flags, addr, sh_offset, size, link = struct.unpack_from("<IIIIIII", self.data, offset)
+            self.sections.append((sh_type, flags, addr, sh_offset, size, link))
+
+        self.symbols = {}
+        for sh_type, _, _, sh_offset, size, link in self.sections:
+            if sh_type != 2:  # SHT_SYMTAB
+                continue
+            strtab = self.sections[link][3]
+            entry_size = 24 if self.is64 else 16
+            for offset in range(sh_offset, sh_offset + size, entry_size):
+                if self.is64:
+                    name, _, _, _, value, _ = struct.unpack_from("<IBBHQQ", self.data, offset)
+                else:
+                    name, value, _, _, _, _ = struct.unpack_from("<IIIBBH", self.data, offset)
+                end = self.data.index(b"\0", strtab + name)
+                self.symbols[self.data[strtab + name:end].decode(errors="replace")] = value
+
+    def read(self, address, length):
+        """Returns the initial contents of the given memory range (None if not part of the file)."""
+        for sh_type, flags, addr, sh_offset, size, _ in self.sections:
+            # Allocated (SHF_ALLOC) section with contents (not SHT_NOBITS)
+            if (flags & 2) and sh_type != 8 and addr <= address and address + length <= addr + size:
+                start = sh_offset + address - addr
+                return self.data[start:start + length]
+        return None
+
+    def read_pointer(self, address):
+        data = self.read(address, self.pointer_size)
+        if data is None:
+            return None
+        return struct.unpack("<Q" if self.is64 else "<I", data)[0]
+
+    def read_string(self, address):
+        for sh_type, flags, addr, sh_offset, size, _ in self.sections:
+            if (flags & 2) and sh_type != 8 and addr <= address < addr + size:
+                start = sh_offset + address - addr
+                end = self.data.find(b"\0", start, sh_offset + size)
+                if end >= 0:
+                    return self.data[start:end].decode(errors="replace")
+        return None
+
+
+class Decoder:
+    def __init__(self, elf):
+        self.elf = elf
+        self.bias = 0
+        self.dropped = 0
+
+    def set_base(self, fields):
+        """Handles the line written at the start of each dump (address of WE_Trace_Dump, dropped messages)."""
+        address = int(fields[0], 16)
+        symbol = self.elf.symbols.get("WE_Trace_Dump")
+        if symbol is not None:
+            self.bias = address - symbol
+        dropped = int(fields[1])
+        lost = dropped - self.dropped
+        self.dropped = dropped
+        if lost > 0:
+            return "*** %d trace message(s) dropped ***" % lost
+        return None
+
+    def decode(self, words):
+        pointer_words = self.elf.pointer_size // 4
+        descriptor_address = 0
+        for i in range(pointer_words):
+            descriptor_address |= words[i] << (32 * i)
+        timestamp = words[pointer_words]
+        argument_words = words[pointer_words + 1]
+        arguments = b"".join(struct.pack("<I", w) for w in words[pointer_words + 2:pointer_words + 2 + argument_words])
+
+        descriptor_address -= self.bias
+        p = self.elf.pointer_size
+        format_address = self.elf.read_pointer(descriptor_address)
+        file_address = self.elf.read_pointer(descriptor_address + p)
+        function_address = self.elf.read_pointer(descriptor_address + 2 * p)
+        level_data = self.elf.read(descriptor_address + 3 * p, 1)
+        mask_data = self.elf.read(descriptor_address + 3 * p + 2, 2)
+        if format_address is None or level_data is None or mask_data is None:
+            return "[%10.6f] <unknown trace descriptor 0x%x>" % (timestamp / 1e6, descriptor_address)
+
+        string_arguments, = struct.unpack("<H", mask_data)
+        text = self.format(self.elf.read_string(format_address) or "", arguments, string_arguments)
+        level = level_data[0]
+        if level in LEVELS:
+            text = "%s (File: %s, Function: %s): %s" % (LEVELS[level], self.elf.read_string(file_address), self.elf.read_string(function_address), text)
+        return "[%10.6f] %s" % (timestamp / 1e6, text.rstrip("\r\n"))
+
+    def format(self, format_string, arguments, string_arguments):
+        """Formats the recorded argument values like printf() would have done on the target.
+
+        Arguments whose bit is set in string_arguments have been copied into the record
+        (length word with truncation flag, followed by the characters padded to full words).
+        """
+        position = 0
+        index = 0
+
+        def take_string():
+            nonlocal position
+            header = arguments[position:position + 4]
+            if len(header) < 4:
+                return None
+            length_word, = struct.unpack("<I", header)
+            length = length_word & 0xFFFF
+            data = arguments[position + 4:position + 4 + length]
+            position += 4 + (length + 3) // 4 * 4
+            if len(data) < length:
+                return None
+            return data.decode(errors="replace") + ("..." if length_word & STRING_TRUNCATED else "")
+
+        def take(size, kind):
+            nonlocal position, index
+            is_string = string_arguments & (1 << index)
+            index += 1
+            if is_string:
+                return take_string()
+            data = arguments[position:position + size]
+            position += size
+            if len(data) < size:
+                return None
+            if kind == "f":
+                return struct.unpack("<d", data)[0]
+            if kind == "i":
+                return int.from_bytes(data, "little", signed=True)
+            return int.from_bytes(data, "little")
+
+        def replace(match):
+            flags, width, precision, length, conversion = match.groups()
+            if conversion == "%":
+                return "%"
+            if width == "*":
+                width = str(take(4, "i"))
+            if precision == "*":
+                precision = str(take(4, "i"))
+            spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+
+            if conversion in "eEfFgGaA":
+                value = take(8, "f")
+                if value is None or isinstance(value, str):
+                    return "<?>" if value is None else value
+                if conversion in "aA":
+                    return value.hex()
+                return (spec + conversion) % value
+
+            if conversion in "sp":
+                value = take(self.elf.pointer_size, "u")
+                if value is None:
+                    return "<?>"
+                if isinstance(value, str):
+                    # String copied into the record
+                    return (spec + "s") % value if conversion == "s" else value
+                if conversion == "p":
+                    return "0x%x" % value
+                string = self.elf.read_string(value - self.bias)
+                return (spec + "s") % (string if string is not None else "<string@0x%x>" % value)
+
+            if length in ("ll", "j"):
+                size = 8
+            elif length in ("l", "z", "t"):
+                size = self.elf.pointer_size
+            else:
+                size = 4
+            value = take(size, "i" if conversion in "di" else "u")
+            if value is None or isinstance(value, str):
+                return "<?>" if value is None else value
+            if length == "h":
+                value = (value & 0xFFFF) - (0x10000 if conversion in "di" and value & 0x8000 else 0)
+            elif length == "hh":
+                value = (value & 0xFF) - (0x100 if conversion in "di" and value & 0x80 else 0)
+            if conversion == "c":
+                return (spec + "c") % chr(value & 0xFF)
+            if conversion == "u":
+                conversion = "d"
+            return (spec + conversion) % value
+
+        return CONVERSION.sub(replace, format_string)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes trace output written by WE_Trace_Dump().")
+    parser.add_argument("elf", help="ELF file of the application")
+    parser.add_argument("log", nargs="?", help="captured print output (default: stdin)")
+    args = parser.parse_args()
+
+    decoder = Decoder(Elf(args.elf))
+    log = open(args.log, errors="replace") if args.log else sys.stdin
+    for line in log:
+        # The trace lines might be preceded by other output not terminated by a line break
+        index = line.find(DUMP_PREFIX)
+        if index < 0:
+            sys.stdout.write(line)
+            continue
+        if index > 0:
+            print(line[:index])
+        fields = line[index + len(DUMP_PREFIX):].split()
+        try:
+            if line[index + len(DUMP_PREFIX)] == "B":
+                output = decoder.set_base(fields[1:])
+            else:
+                output = decoder.decode([int(f, 16) for f in fields])
+        except (ValueError, IndexError, struct.error):
+            output = line.rstrip("\r\n")
+        if output is not None:
+            print(output)
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
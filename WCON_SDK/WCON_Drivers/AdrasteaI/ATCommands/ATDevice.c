@@ -283,15 +283,16 @@ bool AdrasteaI_ATDevice_GetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t* ch
 bool AdrasteaI_ATDevice_SetTECharacterSet(AdrasteaI_ATDevice_Character_Set_t charset)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CSCS=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CSCS=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATDevice_Character_Set_Strings[charset], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATDevice_Character_Set_Strings[charset], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -372,26 +373,27 @@ bool AdrasteaI_ATDevice_SetPhoneFunctionality(AdrasteaI_ATDevice_Phone_Functiona
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CFUN=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CFUN=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, phoneFun, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, phoneFun, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (resetType != AdrasteaI_ATDevice_Phone_Functionality_Reset_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, resetType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, resetType, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -451,15 +453,16 @@ bool AdrasteaI_ATDevice_FactoryReset()
 bool AdrasteaI_ATDevice_SetResultCodeFormat(AdrasteaI_ATDevice_Result_Code_Format_t format)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "ATV");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "ATV");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
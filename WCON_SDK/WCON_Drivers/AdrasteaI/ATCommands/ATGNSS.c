@@ -80,21 +80,22 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSACT=1,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSACT=1,");
 
     if (startMode != AdrasteaI_ATGNSS_Start_Mode_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, startMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, startMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -115,15 +116,16 @@ bool AdrasteaI_ATGNSS_StartGNSS(AdrasteaI_ATGNSS_Start_Mode_t startMode)
 bool AdrasteaI_ATGNSS_StartGNSSWithTolerance(AdrasteaI_ATGNSS_Tolerance_t tolerance)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSACT=2,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSACT=2,");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, tolerance, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, tolerance, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -173,23 +175,24 @@ bool AdrasteaI_ATGNSS_SetSatelliteSystems(AdrasteaI_ATGNSS_Satellite_Systems_t s
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSCFG=\"SET\",\"SAT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSCFG=\"SET\",\"SAT\",");
 
     for (uint8_t i = 0; i < AdrasteaI_ATGNSS_Satellite_Systems_Strings_NumberOfValues; i++)
     {
         if ((satSystems.satSystemsStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Satellite_Systems_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATGNSS_Satellite_Systems_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -261,23 +264,24 @@ bool AdrasteaI_ATGNSS_SetNMEASentences(AdrasteaI_ATGNSS_NMEA_Sentences_t nmeaSen
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSCFG=\"SET\",\"NMEA\"");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSCFG=\"SET\",\"NMEA\"");
 
     for (uint8_t i = 0; i < AdrasteaI_ATGNSS_NMEA_Sentences_Strings_NumberOfValues; i++)
     {
         if ((nmeaSentences.nmeaSentencesStates & (AdrasteaI_ATGNSS_Runtime_Mode_State_Set << i)) >> i)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_NMEA_Sentences_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATGNSS_NMEA_Sentences_Strings[i], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -380,37 +384,28 @@ bool AdrasteaI_ATGNSS_ParseSatelliteQueryEvent(char* pEventArguments, AdrasteaI_
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    /* Exactly four arguments, the last one must extend to the end of the line */
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, pEventArguments);
 
-    switch (ATCommand_CountArgs(argumentsP))
+    if (!ATCommand_Cursor_NextInt(&cursor, &dataP->prn, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
     {
-        case 4:
-        {
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->prn, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
-
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->elevation, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->azimuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_ARGUMENT_DELIM))
-            {
-                return false;
-            }
+    if (!ATCommand_Cursor_NextInt(&cursor, &dataP->elevation, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
 
-            if (!ATCommand_GetNextArgumentInt(&argumentsP, &dataP->snr, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
-            {
-                return false;
-            }
+    if (!ATCommand_Cursor_NextInt(&cursor, &dataP->azimuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE16), ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
 
-            break;
-        }
-        default:
-            return false;
-            break;
+    if (!ATCommand_Cursor_NextInt(&cursor, &dataP->snr, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
     }
 
     return true;
@@ -615,20 +610,21 @@ bool AdrasteaI_ATGNSS_QueryGNSSEphemerisStatus(AdrasteaI_ATGNSS_Ephemeris_Status
 bool AdrasteaI_ATGNSS_SetGNSSUnsolicitedNotificationEvents(AdrasteaI_ATGNSS_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSEV=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSEV=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATGNSS_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -653,9 +649,10 @@ bool AdrasteaI_ATGNSS_ParseSessionStatusChangedEvent(char* pEventArguments, Adra
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, pEventArguments);
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Cursor_NextInt(&cursor, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -670,9 +667,10 @@ bool AdrasteaI_ATGNSS_ParseAllowedStatusChangedEvent(char* pEventArguments, Adra
         return false;
     }
 
-    char* argumentsP = pEventArguments;
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, pEventArguments);
 
-    if (!ATCommand_GetNextArgumentInt(&argumentsP, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Cursor_NextInt(&cursor, dataP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -695,15 +693,16 @@ bool AdrasteaI_ATGNSS_ParseNMEAEvent(char* pEventArguments, AdrasteaI_ATGNSS_NME
 bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSMEM=\"ERASE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSMEM=\"ERASE\",");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATGNSS_Deletion_Option_Strings[deleteOption], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATGNSS_Deletion_Option_Strings[deleteOption], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -724,15 +723,16 @@ bool AdrasteaI_ATGNSS_DeleteData(AdrasteaI_ATGNSS_Deletion_Option_t deleteOption
 bool AdrasteaI_ATGNSS_DownloadCEPFile(AdrasteaI_ATGNSS_CEP_Number_of_Days_t numDays)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%IGNSSCEP=\"DLD\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%IGNSSCEP=\"DLD\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, numDays, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, numDays, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -39,27 +39,28 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"NODES\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCFG=\"NODES\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if ((strlen(username) != 0) && (strlen(password) != 0))
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, username, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
 
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, password, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -67,9 +68,9 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -90,25 +91,26 @@ bool AdrasteaI_ATHTTP_ConfigureNodes(AdrasteaI_ATHTTP_Profile_ID_t profileID, Ad
 bool AdrasteaI_ATHTTP_ConfigureTLS(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t tlsProfileID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"TLS\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCFG=\"TLS\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, tlsProfileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, tlsProfileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -131,17 +133,18 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"IP\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCFG=\"IP\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (sessionID != AdrasteaI_ATHTTP_IP_Session_ID_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -149,7 +152,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -158,7 +161,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
     if (ipFormat != AdrasteaI_ATHTTP_IP_Addr_Format_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -166,7 +169,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -175,7 +178,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
     if (destPort != AdrasteaI_ATCommon_Port_Number_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, destPort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, destPort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -183,7 +186,7 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -192,16 +195,16 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 
     if (sourcePort != AdrasteaI_ATCommon_Port_Number_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, sourcePort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, sourcePort, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -222,30 +225,31 @@ bool AdrasteaI_ATHTTP_ConfigureIP(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adras
 bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, AdrasteaI_ATHTTP_Header_Presence_t requestHeader)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"FORMAT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCFG=\"FORMAT\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, requestHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, requestHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -266,20 +270,21 @@ bool AdrasteaI_ATHTTP_ConfigureFormat(AdrasteaI_ATHTTP_Profile_ID_t profileID, A
 bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATHTTP_Timeout_t timeout)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCFG=\"TIMEOUT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCFG=\"TIMEOUT\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, timeout, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -300,20 +305,21 @@ bool AdrasteaI_ATHTTP_ConfigureTimeout(AdrasteaI_ATHTTP_Profile_ID_t profileID,
 bool AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents(AdrasteaI_ATHTTP_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPEV=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPEV=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATHTTP_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATHTTP_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -331,28 +337,28 @@ bool AdrasteaI_ATHTTP_SetHTTPUnsolicitedNotificationEvents(AdrasteaI_ATHTTP_Even
     return true;
 }
 
-static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
+static bool GETDELETE_Common(ATCommand_Builder_t* pBuilder, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     AdrasteaI_optionalParamsDelimCount = 1;
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (responseHeader != AdrasteaI_ATHTTP_Header_Presence_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(pBuilder, responseHeader, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -360,7 +366,7 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -371,13 +377,13 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
     {
         for (int i = 0; i < headersCount - 1; i++)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, headers[i], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
 
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -385,14 +391,14 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(pBuilder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
+    if (!AdrasteaI_SendRequest(pBuilder->buffer))
     {
         return false;
     }
@@ -408,45 +414,47 @@ static bool GETDELETE_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_
 bool AdrasteaI_ATHTTP_GET(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCMD=\"GET\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCMD=\"GET\",");
 
-    return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+    return GETDELETE_Common(&builder, profileID, addr, responseHeader, headers, headersCount);
 }
 
 bool AdrasteaI_ATHTTP_DELETE(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, AdrasteaI_ATHTTP_Header_Presence_t responseHeader, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPCMD=\"DELETE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPCMD=\"DELETE\",");
 
-    return GETDELETE_Common(pRequestCommand, profileID, addr, responseHeader, headers, headersCount);
+    return GETDELETE_Common(&builder, profileID, addr, responseHeader, headers, headersCount);
 }
 
-static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
+static bool POSTPUT_Common(ATCommand_Builder_t* pBuilder, AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char crchar[] = {'\r', ATCOMMAND_STRING_TERMINATE};
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, bodySize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, bodySize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (contentType != NULL)
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, contentType, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, contentType, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -454,20 +462,20 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount++;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
     AdrasteaI_optionalParamsDelimCount++;
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -477,13 +485,13 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
     {
         for (int i = 0; i < headersCount - 1; i++)
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[i], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, headers[i], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
 
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(pBuilder, headers[headersCount - 1], ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -491,19 +499,19 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(pBuilder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, crchar, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, crchar, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, body, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, body, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!AdrasteaI_SendRequest(pRequestCommand))
+    if (!AdrasteaI_SendRequest(pBuilder->buffer))
     {
         return false;
     }
@@ -519,19 +527,21 @@ static bool POSTPUT_Common(char* pRequestCommand, AdrasteaI_ATHTTP_Profile_ID_t
 bool AdrasteaI_ATHTTP_POST(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPSEND=\"POST\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPSEND=\"POST\",");
 
-    return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+    return POSTPUT_Common(&builder, profileID, addr, body, bodySize, contentType, headers, headersCount);
 }
 
 bool AdrasteaI_ATHTTP_PUT(AdrasteaI_ATHTTP_Profile_ID_t profileID, AdrasteaI_ATCommon_IP_Addr_t addr, char* body, AdrasteaI_ATHTTP_Body_Size_t bodySize, char* contentType, char* headers[], AdrasteaI_ATHTTP_Header_Count_t headersCount)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPSEND=\"PUT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPSEND=\"PUT\",");
 
-    return POSTPUT_Common(pRequestCommand, profileID, addr, body, bodySize, contentType, headers, headersCount);
+    return POSTPUT_Common(&builder, profileID, addr, body, bodySize, contentType, headers, headersCount);
 }
 
 bool AdrasteaI_ATHTTP_ParseGETEvent(char* pEventArguments, AdrasteaI_ATHTTP_Event_Result_t* dataP)
@@ -577,20 +587,21 @@ bool AdrasteaI_ATHTTP_ReadResponse(AdrasteaI_ATHTTP_Profile_ID_t profileID, Adra
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%HTTPREAD=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%HTTPREAD=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, maxLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, maxLength, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -39,32 +39,33 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"NODES\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCFG=\"NODES\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, clientID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, addr, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, addr, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if ((strlen(username) != 0) && (strlen(password) != 0))
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, username, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
 
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, password, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, password, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -75,7 +76,7 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
     if (username != NULL && password == NULL)
     {
 
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, username, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, username, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -83,9 +84,9 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -106,25 +107,26 @@ bool AdrasteaI_ATMQTT_ConfigureNodes(AdrasteaI_ATMQTT_Conn_ID_t connID, Adrastea
 bool AdrasteaI_ATMQTT_ConfigureTLS(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATCommon_TLS_Auth_Mode_t authMode, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"TLS\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCFG=\"TLS\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, authMode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -147,17 +149,18 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"IP\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCFG=\"IP\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (sessionID != AdrasteaI_ATMQTT_IP_Session_ID_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -165,7 +168,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -174,7 +177,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
     if (ipFormat != AdrasteaI_ATMQTT_IP_Addr_Format_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -182,7 +185,7 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -191,16 +194,16 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 
     if (port != AdrasteaI_ATCommon_Port_Number_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, port, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, port, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -221,40 +224,41 @@ bool AdrasteaI_ATMQTT_ConfigureIP(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_WILL_Presence_t presence, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topic, char* message)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"WILLMSG\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCFG=\"WILLMSG\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, presence, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, presence, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topic, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, message, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, message, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -275,30 +279,31 @@ bool AdrasteaI_ATMQTT_ConfigureWillMessage(AdrasteaI_ATMQTT_Conn_ID_t connID, Ad
 bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_Clean_Session_t cleanSession)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCFG=\"PROTOCOL\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCFG=\"PROTOCOL\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, 0, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, cleanSession, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, cleanSession, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -319,20 +324,21 @@ bool AdrasteaI_ATMQTT_ConfigureProtocol(AdrasteaI_ATMQTT_Conn_ID_t connID, Adras
 bool AdrasteaI_ATMQTT_SetMQTTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTEV=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTEV=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -493,15 +499,16 @@ bool AdrasteaI_ATMQTT_ParsePublicationReceivedEvent(char* pEventArguments, Adras
 bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"CONNECT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCMD=\"CONNECT\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -522,15 +529,16 @@ bool AdrasteaI_ATMQTT_Connect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"DISCONNECT\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCMD=\"DISCONNECT\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -551,25 +559,26 @@ bool AdrasteaI_ATMQTT_Disconnect(AdrasteaI_ATMQTT_Conn_ID_t connID)
 bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t QoS, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"SUBSCRIBE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCMD=\"SUBSCRIBE\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, QoS, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, QoS, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -590,20 +599,21 @@ bool AdrasteaI_ATMQTT_Subscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATM
 bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"UNSUBSCRIBE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCMD=\"UNSUBSCRIBE\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -624,40 +634,41 @@ bool AdrasteaI_ATMQTT_Unsubscribe(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_A
 bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQTT_QoS_t qos, AdrasteaI_ATMQTT_Retain_t retain, AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload, AdrasteaI_ATMQTT_Payload_Size_t payloadSize)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%MQTTCMD=\"PUBLISH\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%MQTTCMD=\"PUBLISH\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, connID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, retain, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, payloadSize + 1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, payloadSize + 1, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, payload, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -678,25 +689,26 @@ bool AdrasteaI_ATMQTT_Publish(AdrasteaI_ATMQTT_Conn_ID_t connID, AdrasteaI_ATMQT
 bool AdrasteaI_ATMQTT_AWSIOTConfigureConnection(AdrasteaI_ATCommon_IP_Addr_t url, AdrasteaI_ATCommon_TLS_Profile_ID_t profileID, AdrasteaI_ATMQTT_Client_ID_t clientID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCFG=\"CONN\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCFG=\"CONN\",");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, url, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, url, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, profileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, clientID, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, clientID, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -719,12 +731,13 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
     AdrasteaI_optionalParamsDelimCount = 1;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCFG=\"IP\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCFG=\"IP\",");
 
     if (sessionID != AdrasteaI_ATMQTT_IP_Session_ID_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, sessionID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -732,7 +745,7 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
     }
     else
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -741,16 +754,16 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 
     if (ipFormat != AdrasteaI_ATMQTT_IP_Addr_Format_Invalid)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, ipFormat, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
         AdrasteaI_optionalParamsDelimCount = 0;
     }
 
-    pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+    ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -771,20 +784,21 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureIP(AdrasteaI_ATMQTT_IP_Session_ID_t session
 bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keepAlive, AdrasteaI_ATMQTT_AWSIOT_QoS_t qos)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCFG=\"PROTOCOL\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCFG=\"PROTOCOL\",");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, keepAlive, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, qos, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -805,20 +819,21 @@ bool AdrasteaI_ATMQTT_AWSIOTConfigureProtocol(AdrasteaI_ATMQTT_Keep_Alive_t keep
 bool AdrasteaI_ATMQTT_SetAWSIOTUnsolicitedNotificationEvents(AdrasteaI_ATMQTT_Event_t event, AdrasteaI_ATCommon_Event_State_t state)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTEV=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTEV=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, AdrasteaI_ATMQTT_Event_Strings[event], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, state, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -936,15 +951,16 @@ bool AdrasteaI_ATMQTT_AWSIOTDisconnect()
 bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCMD=\"SUBSCRIBE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCMD=\"SUBSCRIBE\",");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -965,15 +981,16 @@ bool AdrasteaI_ATMQTT_AWSIOTSubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCMD=\"UNSUBSCRIBE\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCMD=\"UNSUBSCRIBE\",");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -994,20 +1011,21 @@ bool AdrasteaI_ATMQTT_AWSIOTUnsubscribe(AdrasteaI_ATMQTT_Topic_Name_t topicName)
 bool AdrasteaI_ATMQTT_AWSIOTPublish(AdrasteaI_ATMQTT_Topic_Name_t topicName, char* payload)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT%AWSIOTCMD=\"PUBLISH\",");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT%AWSIOTCMD=\"PUBLISH\",");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, topicName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, topicName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, payload, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, payload, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -76,15 +76,16 @@ bool AdrasteaI_ATNetService_ParseOperatorReadEvent(char* pEventArguments, Adrast
 bool AdrasteaI_ATNetService_SetPLMNReadFormat(AdrasteaI_ATNetService_PLMN_Format_t format)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+COPS=3,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+COPS=3,");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -120,10 +121,11 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
             AdrasteaI_optionalParamsDelimCount = 1;
 
             char* pRequestCommand = AT_commandBuffer;
+            ATCommand_Builder_t builder;
 
-            strcpy(pRequestCommand, "AT+COPS=1,");
+            ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+COPS=1,");
 
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(&builder, plmn.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -133,7 +135,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
                 case AdrasteaI_ATNetService_PLMN_Format_Short_AlphaNumeric:
                 case AdrasteaI_ATNetService_PLMN_Format_Long_AlphaNumeric:
                 {
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, plmn.operator.operatorString, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, plmn.operator.operatorString, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -142,7 +144,7 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
                 }
                 case AdrasteaI_ATNetService_PLMN_Format_Numeric:
                 {
-                    if (!ATCommand_AppendArgumentIntQuotationMarks(pRequestCommand, plmn.operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendIntQuotationMarks(&builder, plmn.operator.operatorNumeric, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -156,16 +158,16 @@ bool AdrasteaI_ATNetService_SetPLMN(AdrasteaI_ATNetService_PLMN_t plmn)
 
             if (plmn.accessTechnology != AdrasteaI_ATCommon_AcT_Invalid)
             {
-                if (!ATCommand_AppendArgumentInt(pRequestCommand, plmn.accessTechnology, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(&builder, plmn.accessTechnology, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 AdrasteaI_optionalParamsDelimCount = 0;
             }
 
-            pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+            ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -430,14 +432,15 @@ bool AdrasteaI_ATNetService_ReadPowerSavingMode(AdrasteaI_ATNetService_Power_Sav
 bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Saving_Mode_t psm)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CPSMS=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CPSMS=");
 
     switch (psm.state)
     {
         case AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable:
         {
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendInt(&builder, AdrasteaI_ATNetService_Power_Saving_Mode_State_Disable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -446,27 +449,27 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
         }
         case AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable:
         {
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(&builder, AdrasteaI_ATNetService_Power_Saving_Mode_State_Enable, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendBitsQuotationMarks(&builder, psm.periodicTAU.periodicTAU, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, psm.activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendBitsQuotationMarks(&builder, psm.activeTime.activeTime, ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -478,7 +481,7 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
             break;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -499,15 +502,16 @@ bool AdrasteaI_ATNetService_SetPowerSavingMode(AdrasteaI_ATNetService_Power_Savi
 bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX_Mode_t mode, AdrasteaI_ATNetService_eDRX_t edrx)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CEDRXS=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CEDRXS=");
 
     switch (mode)
     {
         case AdrasteaI_ATNetService_eDRX_Mode_Disable:
         case AdrasteaI_ATNetService_eDRX_Mode_Disable_Reset:
         {
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendInt(&builder, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -519,14 +523,14 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
         {
             AdrasteaI_optionalParamsDelimCount = 1;
 
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(&builder, mode, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
             if (edrx.AcT > AdrasteaI_ATNetService_eDRX_AcT_NotUsingeDRX)
             {
-                if (!ATCommand_AppendArgumentInt(pRequestCommand, edrx.AcT, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendInt(&builder, edrx.AcT, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -534,7 +538,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
             }
             else
             {
-                if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -543,14 +547,14 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
 
             if (edrx.requestedValue != AdrasteaI_ATNetService_eDRX_Value_Invalid)
             {
-                if (!ATCommand_AppendArgumentBitsQuotationMarks(pRequestCommand, edrx.requestedValue, (ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendBitsQuotationMarks(&builder, edrx.requestedValue, (ATCOMMAND_INTFLAGS_SIZE8), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 AdrasteaI_optionalParamsDelimCount = 0;
             }
 
-            pRequestCommand[strlen(pRequestCommand) - AdrasteaI_optionalParamsDelimCount] = ATCOMMAND_STRING_TERMINATE;
+            ATCommand_Builder_TrimEnd(&builder, AdrasteaI_optionalParamsDelimCount);
 
             break;
         }
@@ -560,7 +564,7 @@ bool AdrasteaI_ATNetService_SeteDRXDynamicParameters(AdrasteaI_ATNetService_eDRX
             break;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -121,6 +121,23 @@ static char AdrasteaI_pendingCommandName[64] = {0};
  */
 static size_t AdrasteaI_pendingCommandNameLength = 0;
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Performance counters and latency histograms (see AdrasteaI_GetStatistics()).
+ */
+static WE_Stats_t AdrasteaI_stats = {0};
+
+/**
+ * @brief Time the pending request has been sent (see AdrasteaI_SendRequest()).
+ */
+static uint32_t AdrasteaI_requestStartUs = 0;
+
+/**
+ * @brief Is true as long as the latency of the pending request hasn't been recorded.
+ */
+static bool AdrasteaI_requestTimed = false;
+#endif
+
 /**
  * @brief Buffer used for current response text.
  */
@@ -184,7 +201,8 @@ static bool AdrasteaI_responseincoming = false;
 static volatile AdrasteaI_ATMode_t AdrasteaI_ATMode = AdrasteaI_ATMode_Off;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from Adrastea.
+ * @brief Time step (microseconds) when waiting for responses from Adrastea
+ * (maximum time between two checks, waiting ends as soon as the confirmation has been received).
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
@@ -192,6 +210,11 @@ static volatile AdrasteaI_ATMode_t AdrasteaI_ATMode = AdrasteaI_ATMode_Off;
  */
 static uint32_t AdrasteaI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is signaled when a confirmation has been received from Adrastea.
+ */
+static WE_Event_t AdrasteaI_confirmEvent = {0};
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to Adrastea
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -220,6 +243,28 @@ AdrasteaI_EventCallback_t AdrasteaI_eventCallback;
  */
 static bool AdrasteaI_executingEventCallback = false;
 
+/**
+ * @brief Serializes the access of several threads to the module (see AdrasteaI_Lock()).
+ */
+static WE_Mutex_t AdrasteaI_requestMutex = NULL;
+
+#if defined(WE_AT_RX_TASK)
+/**
+ * @brief Receive task, which executes the byte handler (see AdrasteaI_SetByteRxCallback()) if supported by the platform.
+ */
+static ATCommand_RxTask_t AdrasteaI_rxTask = {0};
+
+/**
+ * @brief Queues received data for the receive task.
+ */
+static void AdrasteaI_EnqueueRxBytes(uint8_t* dataP, size_t size) { ATCommand_RxTask_Enqueue(&AdrasteaI_rxTask, dataP, size); }
+
+/**
+ * @brief Byte handler passed to the UART if the receive task is running.
+ */
+static WE_UART_HandleRxByte_t AdrasteaI_uartRxCallback = AdrasteaI_EnqueueRxBytes;
+#endif
+
 /**
  * @brief Number of optional parameters delimiters so far (used by at commands).
  *
@@ -255,6 +300,9 @@ static WE_UART_t* AdrasteaI_uartP = NULL;
 bool AdrasteaI_Init(WE_UART_t* uartP, AdrasteaI_Pins_t* pinoutP, AdrasteaI_EventCallback_t eventCallback)
 {
     AdrasteaI_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&AdrasteaI_stats);
+#endif
 
     /* Callbacks */
     AdrasteaI_eventCallback = eventCallback;
@@ -282,7 +330,21 @@ bool AdrasteaI_Init(WE_UART_t* uartP, AdrasteaI_Pins_t* pinoutP, AdrasteaI_Event
     }
 
     AdrasteaI_uartP = uartP;
-    if (false == AdrasteaI_uartP->uartInit(AdrasteaI_uartP->baudrate, AdrasteaI_uartP->flowControl, AdrasteaI_uartP->parity, &byteRxCallback))
+
+    if ((NULL == AdrasteaI_requestMutex) && !WE_Mutex_Create(&AdrasteaI_requestMutex))
+    {
+        return false;
+    }
+
+    WE_UART_HandleRxByte_t* uartRxCallbackP = &byteRxCallback;
+#if defined(WE_AT_RX_TASK)
+    if (ATCommand_RxTask_Start(&AdrasteaI_rxTask, &byteRxCallback, "AdrasteaI_RX"))
+    {
+        /* Received data is passed to the byte handler by the receive task */
+        uartRxCallbackP = &AdrasteaI_uartRxCallback;
+    }
+#endif
+    if (false == AdrasteaI_uartP->uartInit(AdrasteaI_uartP->baudrate, AdrasteaI_uartP->flowControl, AdrasteaI_uartP->parity, uartRxCallbackP))
     {
         return false;
     }
@@ -394,9 +456,18 @@ bool AdrasteaI_PinWakeUp(void)
     return true;
 }
 
+bool AdrasteaI_Lock(uint32_t timeoutMs) { return WE_Mutex_Lock(AdrasteaI_requestMutex, timeoutMs); }
+
+void AdrasteaI_Unlock(void) { WE_Mutex_Unlock(AdrasteaI_requestMutex); }
+
 bool AdrasteaI_SendRequest(char* data)
 {
+#if defined(WE_AT_RX_TASK)
+    /* If running, the receive task executes the event callbacks - other threads may send requests in the meantime */
+    if (AdrasteaI_executingEventCallback && ATCommand_RxTask_IsCurrentContext(&AdrasteaI_rxTask))
+#else
     if (AdrasteaI_executingEventCallback)
+#endif
     {
         /* Don't allow sending AT commands from event handlers, as this will
          * mess up send/receive states and buffers. */
@@ -440,6 +511,11 @@ bool AdrasteaI_SendRequest(char* data)
 
     WE_DEBUG_PRINT_DEBUG("> %s", data);
 
+#if defined(WE_STATS_ENABLED)
+    AdrasteaI_stats.txFrames++;
+    WE_STATS_START_REQUEST(AdrasteaI_requestStartUs);
+    AdrasteaI_requestTimed = true;
+#endif
     AdrasteaI_Transparent_Transmit(data, dataLength);
 
     return true;
@@ -451,9 +527,27 @@ bool AdrasteaI_Transparent_Transmit(const char* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&AdrasteaI_stats, dataLength, false);
     return AdrasteaI_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+#if defined(WE_STATS_ENABLED)
+bool AdrasteaI_GetStatistics(WE_Stats_t* statsP)
+{
+    if (!WE_Stats_Snapshot(&AdrasteaI_stats, AdrasteaI_uartP, statsP))
+    {
+        return false;
+    }
+#if defined(WE_AT_RX_TASK)
+    /* Data discarded by the receive task counts as receive overflow as well */
+    statsP->rxDroppedBytes += AdrasteaI_rxTask.droppedBytes;
+#endif
+    return true;
+}
+
+void AdrasteaI_ResetStatistics() { WE_Stats_Reset(&AdrasteaI_stats); }
+#endif
+
 bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse)
 {
     AdrasteaI_cmdConfirmStatus = AdrasteaI_CNFStatus_Invalid;
@@ -492,11 +586,13 @@ bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expected
 
         if (AdrasteaI_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(AdrasteaI_waitTimeStepUsec);
+            /* Returns as soon as the confirmation has been received */
+            WE_WaitEvent(&AdrasteaI_confirmEvent, (AdrasteaI_waitTimeStepUsec + 999) / 1000);
         }
     }
 
     AdrasteaI_responseincoming = false;
+    WE_STATS_ADD(&AdrasteaI_stats, timeouts, 1);
     AdrasteaI_requestPending = false;
     return false;
 }
@@ -561,6 +657,8 @@ uint32_t AdrasteaI_GetTimeout(AdrasteaI_Timeout_t type) { return AdrasteaI_timeo
 
 static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
 {
+    WE_STATS_ADD(&AdrasteaI_stats, rxBytes, size);
+
     uint8_t receivedByte;
     for (; size > 0; size--, dataP++)
     {
@@ -577,6 +675,7 @@ static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
 
         if (AdrasteaI_rxByteCounter >= ADRASTEAI_LINE_MAX_SIZE)
         {
+            WE_STATS_ADD(&AdrasteaI_stats, parseErrors, 1);
             AdrasteaI_rxByteCounter = 0;
             AdrasteaI_eolChar1Found = false;
             return;
@@ -644,6 +743,8 @@ static void AdrasteaI_HandleRxByte(uint8_t* dataP, size_t size)
 
 static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
+    WE_STATS_ADD(&AdrasteaI_stats, rxFrames, 1);
+
     WE_DEBUG_PRINT_DEBUG("< %s\r\n", rxPacket);
 
     if (AdrasteaI_requestPending)
@@ -716,6 +817,20 @@ static void AdrasteaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
                 AdrasteaI_responseincoming = true;
             }
         }
+
+        if (AdrasteaI_CNFStatus_Invalid != AdrasteaI_cmdConfirmStatus)
+        {
+#if defined(WE_STATS_ENABLED)
+            if (AdrasteaI_requestTimed)
+            {
+                AdrasteaI_requestTimed = false;
+                WE_STATS_COMPLETE_REQUEST(&AdrasteaI_stats, WE_Stats_Hash(AdrasteaI_pendingCommandName, AdrasteaI_pendingCommandNameLength), AdrasteaI_pendingCommandName, AdrasteaI_requestStartUs);
+            }
+#endif
+
+            /* Wake up AdrasteaI_WaitForConfirm() */
+            WE_SignalEvent(&AdrasteaI_confirmEvent);
+        }
     }
 
     if (0 == strncmp(&rxPacket[0], ADRASTEAI_MCU_EVENT, strlen(ADRASTEAI_MCU_EVENT)))
@@ -32,6 +32,7 @@
 #define ADRASTEAI_H_INCLUDED
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -145,6 +146,25 @@ extern bool AdrasteaI_PinReset(void);
  */
 extern bool AdrasteaI_PinWakeUp(void);
 
+/**
+ * @brief Locks the driver for exclusive use by the calling thread.
+ *
+ * The AT command functions share the command buffer (AT_commandBuffer) and the state of the pending request.
+ * If the driver is used by several threads, each call (or sequence of calls) of driver functions needs to be
+ * enclosed in AdrasteaI_Lock() and AdrasteaI_Unlock(). The lock may be acquired several times by the same thread.
+ * Must not be called from the event callback. On bare metal platforms, this function has no effect.
+ *
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the driver has been locked, false if the timeout has expired
+ */
+extern bool AdrasteaI_Lock(uint32_t timeoutMs);
+
+/**
+ * @brief Releases the lock acquired using AdrasteaI_Lock().
+ */
+extern void AdrasteaI_Unlock(void);
+
 /**
  * @brief Sends the supplied AT command to the module
  *
@@ -165,6 +185,24 @@ extern bool AdrasteaI_SendRequest(char* data);
  */
 extern bool AdrasteaI_WaitForConfirm(uint32_t maxTimeMs, AdrasteaI_CNFStatus_t expectedStatus, char* pOutResponse);
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * The latency histograms are kept per AT command name (see WE_Stats_Hash()).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool AdrasteaI_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void AdrasteaI_ResetStatistics();
+#endif
+
 /**
  * @brief Set timing parameters used by the DaphnisI driver.
  *
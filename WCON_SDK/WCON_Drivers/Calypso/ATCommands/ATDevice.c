@@ -57,8 +57,8 @@ static const char* Calypso_ATDevice_StatusFlagsStrings[Calypso_ATDevice_StatusFl
 
 static bool Calypso_ATDevice_IsInputValidATget(Calypso_ATDevice_GetId_t id, uint8_t option);
 static bool Calypso_ATDevice_IsInputValidATset(Calypso_ATDevice_GetId_t id, uint8_t option);
-static bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t option);
-static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t* pValue);
+static bool Calypso_ATDevice_AddArgumentsATget(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option);
+static bool Calypso_ATDevice_AddArgumentsATset(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t* pValue);
 static bool Calypso_ATDevice_ParseResponseATget(uint8_t id, uint8_t option, char* pAtCommand, Calypso_ATDevice_Value_t* pValue);
 
 bool Calypso_ATDevice_Test()
@@ -87,14 +87,17 @@ bool Calypso_ATDevice_Stop(uint32_t timeoutMs)
         return false;
     }
 
-    char cmdToSend[32] = "AT+stop=";
+    char cmdToSend[32];
+    ATCommand_Builder_t builder;
 
-    if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC)))
+    ATCommand_Builder_Init(&builder, cmdToSend, sizeof(cmdToSend), "AT+stop=");
+
+    if (!ATCommand_Builder_AppendInt(&builder, timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -149,14 +152,17 @@ bool Calypso_ATDevice_Sleep(uint32_t timeoutSeconds)
         return false;
     }
 
-    char cmdToSend[32] = "AT+sleep=";
+    char cmdToSend[32];
+    ATCommand_Builder_t builder;
+
+    ATCommand_Builder_Init(&builder, cmdToSend, sizeof(cmdToSend), "AT+sleep=");
 
-    if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC)))
+    if (!ATCommand_Builder_AppendInt(&builder, timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -185,11 +191,12 @@ bool Calypso_ATDevice_Get(Calypso_ATDevice_GetId_t id, uint8_t option, Calypso_A
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pResponseCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+get=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+get=");
 
-    if (!Calypso_ATDevice_AddArgumentsATget(&pRequestCommand[strlen(pRequestCommand)], id, option))
+    if (!Calypso_ATDevice_AddArgumentsATget(&builder, id, option))
     {
         return false;
     }
@@ -243,10 +250,11 @@ bool Calypso_ATDevice_Set(Calypso_ATDevice_GetId_t id, uint8_t option, Calypso_A
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+set=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+set=");
 
-    if (!Calypso_ATDevice_AddArgumentsATset(&pRequestCommand[strlen(pRequestCommand)], id, option, pValue))
+    if (!Calypso_ATDevice_AddArgumentsATset(&builder, id, option, pValue))
     {
         return false;
     }
@@ -324,14 +332,14 @@ bool Calypso_ATDevice_IsInputValidATget(Calypso_ATDevice_GetId_t id, uint8_t opt
 /**
  * @brief Adds the arguments to the AT+get command string.
  *
- * @param[out] pAtCommand The AT request command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id The ID of the argument to be added
  * @param[in] option The option to add
  * @return true if arguments were added successfully, false otherwise
  */
-bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t option)
+bool Calypso_ATDevice_AddArgumentsATget(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option)
 {
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -340,7 +348,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
     {
         case Calypso_ATDevice_GetId_Status:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetStatusStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetStatusStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -348,7 +356,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
         case Calypso_ATDevice_GetId_General:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -356,7 +364,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
         case Calypso_ATDevice_GetId_IOT:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -364,7 +372,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
         case Calypso_ATDevice_GetId_UART:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -372,7 +380,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
         case Calypso_ATDevice_GetId_TransparentMode:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -380,7 +388,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
         case Calypso_ATDevice_GetId_GPIO:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -392,7 +400,7 @@ bool Calypso_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t op
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -814,15 +822,15 @@ static bool Calypso_ATDevice_IsInputValidATset(Calypso_ATDevice_GetId_t id, uint
  *
  * @param[in] id The id of the arguments to add
  * @param[in] option The option to add
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[out] pValues Parsed values
  * @return true if arguments were added successful, false otherwise
  */
-static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t* pValue)
+static bool Calypso_ATDevice_AddArgumentsATset(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option, Calypso_ATDevice_Value_t* pValue)
 {
 
     /* add id */
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -832,7 +840,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
         case Calypso_ATDevice_GetId_General:
         {
             /* add option */
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -846,7 +854,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -862,7 +870,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
@@ -872,7 +880,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
@@ -882,7 +890,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
@@ -892,7 +900,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
@@ -902,7 +910,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
@@ -912,7 +920,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                         return false;
                     }
 
-                    if (!ATCommand_AppendArgumentString(pAtCommand, tempString, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, tempString, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -930,7 +938,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
 
         case Calypso_ATDevice_GetId_UART:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -938,35 +946,35 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
             switch (option)
             {
                 case Calypso_ATDevice_GetUart_Baudrate:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.baudrate, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValue->uart.baudrate, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetUart_Parity:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.parity, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValue->uart.parity, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetUart_FlowControl:
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->uart.flowControl, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, pValue->uart.flowControl, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetUart_TransparentTrigger:
-                    if (!ATCommand_AppendArgumentBitmask(pAtCommand, Calypso_ATDevice_ATGetTransparentModeUartTriggerStrings, Calypso_ATDevice_TransparentModeUartTrigger_NumberOfValues, pValue->uart.transparentTrigger, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE))
+                    if (!ATCommand_Builder_AppendBitmask(pBuilder, Calypso_ATDevice_ATGetTransparentModeUartTriggerStrings, Calypso_ATDevice_TransparentModeUartTrigger_NumberOfValues, pValue->uart.transparentTrigger, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetUart_TransparentTimeout:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->uart.transparentTimeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValue->uart.transparentTimeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -975,7 +983,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
                 case Calypso_ATDevice_GetUart_TransparentETX:
                 {
                     uint16_t etx = ((uint16_t)pValue->uart.transparentETX[0] << 8) | pValue->uart.transparentETX[1];
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -991,7 +999,7 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
 
         case Calypso_ATDevice_GetId_TransparentMode:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetTransparentModeStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -999,56 +1007,56 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
             switch (option)
             {
                 case Calypso_ATDevice_GetTransparentMode_RemoteAddress:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, pValue->transparentMode.remoteAddress, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, pValue->transparentMode.remoteAddress, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_RemotePort:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->transparentMode.remotePort, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValue->transparentMode.remotePort, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_LocalPort:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValue->transparentMode.localPort, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValue->transparentMode.localPort, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_SocketType:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSocketTypeStrings[pValue->transparentMode.socketType], ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetTransparentModeSocketTypeStrings[pValue->transparentMode.socketType], ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_SecureMethod:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetTransparentModeSecureMethodStrings[pValue->transparentMode.secureMethod], ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetTransparentModeSecureMethodStrings[pValue->transparentMode.secureMethod], ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_PowerSave:
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.powerSave, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, pValue->transparentMode.powerSave, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_SkipDateVerify:
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.skipDateVerify, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, pValue->transparentMode.skipDateVerify, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATDevice_GetTransparentMode_DisableCertificateStore:
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->transparentMode.disableCertificateStore, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, pValue->transparentMode.disableCertificateStore, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1064,14 +1072,14 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
 
         case Calypso_ATDevice_GetId_GPIO:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATDevice_ATGetGPIOStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
             switch (option)
             {
                 case Calypso_ATDevice_GetGPIO_RemoteLock:
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, pValue->gpio.remoteLock, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, pValue->gpio.remoteLock, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1090,5 +1098,5 @@ static bool Calypso_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uin
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
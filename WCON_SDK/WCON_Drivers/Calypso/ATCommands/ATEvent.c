@@ -126,24 +126,35 @@ bool Calypso_ATEvent_ParsePingEvent(char** pEventArguments, Calypso_ATEvent_Ping
 
 bool Calypso_ATEvent_ParseSocketTCPConnectEvent(char** pEventArguments, Calypso_ATEvent_SocketTCPConnect_t* connectEvent)
 {
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(connectEvent->serverPort), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, *pEventArguments);
+
+    if (!ATCommand_Cursor_NextInt(&cursor, &(connectEvent->serverPort), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_Cursor_NextString(&cursor, connectEvent->serverAddress, sizeof(connectEvent->serverAddress), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_GetNextArgumentString(pEventArguments, connectEvent->serverAddress, ATCOMMAND_STRING_TERMINATE, sizeof(connectEvent->serverAddress));
+    *pEventArguments = cursor.pos;
+    return true;
 }
 
 bool Calypso_ATEvent_ParseSocketTCPAcceptEvent(char** pEventArguments, Calypso_ATEvent_SocketTCPAccept_t* acceptEvent)
 {
     char temp[12];
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, *pEventArguments);
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(acceptEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(acceptEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentString(pEventArguments, temp, ATCOMMAND_ARGUMENT_DELIM, sizeof(temp)))
+    if (!ATCommand_Cursor_NextString(&cursor, temp, sizeof(temp), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -153,45 +164,70 @@ bool Calypso_ATEvent_ParseSocketTCPAcceptEvent(char** pEventArguments, Calypso_A
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(acceptEvent->clientPort), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(acceptEvent->clientPort), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_GetNextArgumentString(pEventArguments, acceptEvent->clientAddress, ATCOMMAND_STRING_TERMINATE, sizeof(acceptEvent->clientAddress));
+    if (!ATCommand_Cursor_NextString(&cursor, acceptEvent->clientAddress, sizeof(acceptEvent->clientAddress), ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
+
+    *pEventArguments = cursor.pos;
+    return true;
 }
 
 bool Calypso_ATEvent_ParseSocketTXFailedEvent(char** pEventArguments, Calypso_ATEvent_SocketTXFailed_t* txFailedEvent)
 {
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(txFailedEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, *pEventArguments);
+
+    if (!ATCommand_Cursor_NextInt(&cursor, &(txFailedEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_Cursor_NextInt(&cursor, &(txFailedEvent->errorCode), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_GetNextArgumentInt(pEventArguments, &(txFailedEvent->errorCode), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED, ATCOMMAND_STRING_TERMINATE);
+    *pEventArguments = cursor.pos;
+    return true;
 }
 
 bool Calypso_ATEvent_ParseSocketRcvdEvent(char** pEventArguments, bool decodeBase64, Calypso_ATEvent_SocketRcvd_t* rcvdEvent)
 {
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, *pEventArguments);
+
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->socketID), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->format), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->format), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->length), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->length), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (decodeBase64)
     {
+        /* Decode directly from the received line */
+        ATCommand_Token_t payload;
+        if (!ATCommand_Cursor_NextBytes(&cursor, rcvdEvent->length, &payload))
+        {
+            return false;
+        }
+
         uint32_t decodedSize;
-        if (!Base64_GetDecBufSize((uint8_t*)*pEventArguments, rcvdEvent->length, &decodedSize))
+        if (!Base64_GetDecBufSize((uint8_t*)payload.data, payload.length, &decodedSize))
         {
             return false;
         }
@@ -203,7 +239,7 @@ bool Calypso_ATEvent_ParseSocketRcvdEvent(char** pEventArguments, bool decodeBas
         }
 
         decodedSize = sizeof(rcvdEvent->data) - 1 /*'\0'*/;
-        if (!Base64_Decode((uint8_t*)*pEventArguments, rcvdEvent->length, (uint8_t*)rcvdEvent->data, &decodedSize))
+        if (!Base64_Decode((uint8_t*)payload.data, payload.length, (uint8_t*)rcvdEvent->data, &decodedSize))
         {
             return false;
         }
@@ -211,6 +247,7 @@ bool Calypso_ATEvent_ParseSocketRcvdEvent(char** pEventArguments, bool decodeBas
         rcvdEvent->data[decodedSize] = '\0';
 
         rcvdEvent->length = decodedSize;
+        *pEventArguments = cursor.pos;
         return true;
     }
 
@@ -219,66 +256,86 @@ bool Calypso_ATEvent_ParseSocketRcvdEvent(char** pEventArguments, bool decodeBas
     {
         return false;
     }
-    return ATCommand_GetNextArgumentString(pEventArguments, rcvdEvent->data, ATCOMMAND_STRING_TERMINATE, sizeof(rcvdEvent->data));
+
+    if (!ATCommand_Cursor_NextString(&cursor, rcvdEvent->data, sizeof(rcvdEvent->data), ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
+
+    *pEventArguments = cursor.pos;
+    return true;
 }
 
 bool Calypso_ATEvent_ParseSocketMQTTRcvdEvent(char** pEventArguments, Calypso_ATEvent_MQTTRcvd_t* rcvdEvent)
 {
-    if (!ATCommand_GetNextArgumentString(pEventArguments, rcvdEvent->topic, ATCOMMAND_ARGUMENT_DELIM, sizeof(rcvdEvent->topic)))
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_Init(&cursor, *pEventArguments);
+
+    if (!ATCommand_Cursor_NextString(&cursor, rcvdEvent->topic, sizeof(rcvdEvent->topic), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     uint8_t qos_index;
 
-    if (!ATCommand_GetNextArgumentEnum(pEventArguments, &qos_index, Calypso_ATMQTT_QoSStrings, Calypso_ATMQTT_QoS_NumberOfValues, 5, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextEnum(&cursor, &qos_index, Calypso_ATMQTT_QoSStrings, Calypso_ATMQTT_QoS_NumberOfValues, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     rcvdEvent->qos = (Calypso_ATMQTT_QoS_t)qos_index;
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->retain), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->retain), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    {
+        return false;
+    }
+
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->duplicate), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->duplicate), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, (uint8_t*)&(rcvdEvent->dataFormat), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, (uint8_t*)&(rcvdEvent->dataFormat), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Cursor_NextInt(&cursor, &(rcvdEvent->dataLength), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_GetNextArgumentInt(pEventArguments, &(rcvdEvent->dataLength), ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Token_t payload;
+    if (!ATCommand_Cursor_NextToken(&cursor, ATCOMMAND_STRING_TERMINATE, &payload) || (payload.length >= sizeof(rcvdEvent->data)))
     {
         return false;
     }
 
-    if (ATCommand_GetNextArgumentString(pEventArguments, rcvdEvent->data, ATCOMMAND_STRING_TERMINATE, sizeof(rcvdEvent->data)))
+    if (rcvdEvent->dataFormat == Calypso_DataFormat_Base64)
     {
-        if (rcvdEvent->dataFormat == Calypso_DataFormat_Base64)
+        /* Decode the base64 encoded data directly from the received line */
+        if (rcvdEvent->dataLength > payload.length)
         {
-            /* Decode the base64 encoded data */
-            uint32_t elen = CALYPSO_LINE_MAX_SIZE;
-            char out[CALYPSO_LINE_MAX_SIZE + 1];
-            if (!Base64_Decode((uint8_t*)rcvdEvent->data, rcvdEvent->dataLength, (uint8_t*)out, &elen))
-            {
-                return false;
-            }
-            /* add string termination character needed by the Calypso functions */
-            out[elen] = '\0';
-
-            strcpy(rcvdEvent->data, out);
-            rcvdEvent->dataLength = elen;
+            return false;
         }
-        return true;
+
+        uint32_t elen = sizeof(rcvdEvent->data) - 1 /*'\0'*/;
+        if (!Base64_Decode((uint8_t*)payload.data, rcvdEvent->dataLength, (uint8_t*)rcvdEvent->data, &elen))
+        {
+            return false;
+        }
+        /* add string termination character needed by the Calypso functions */
+        rcvdEvent->data[elen] = '\0';
+        rcvdEvent->dataLength = elen;
+    }
+    else
+    {
+        memcpy(rcvdEvent->data, payload.data, payload.length);
+        rcvdEvent->data[payload.length] = '\0';
     }
 
-    return false;
+    *pEventArguments = cursor.pos;
+    return true;
 }
 
 bool Calypso_ATEvent_ParseNetappIP4AcquiredEvent(char** pEventArguments, Calypso_ATEvent_NetappIP4Acquired_t* ipv4Event)
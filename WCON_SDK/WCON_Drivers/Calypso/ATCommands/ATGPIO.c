@@ -42,19 +42,20 @@ bool Calypso_ATGPIO_Get(Calypso_ATGPIO_GPIOId_t id, bool defaultSetting, Calypso
     gpio->type = Calypso_ATGPIO_GPIOType_Unused;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+gpioGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+gpioGet=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, id, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, id, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, defaultSetting ? "true" : "false", ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, defaultSetting ? "true" : "false", ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -140,50 +141,51 @@ bool Calypso_ATGPIO_Get(Calypso_ATGPIO_GPIOId_t id, bool defaultSetting, Calypso
 bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t* gpio, bool save)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+gpioSet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+gpioSet=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->id, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, gpio->id, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, save ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, save ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_GPIOType_Strings[gpio->type], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATGPIO_GPIOType_Strings[gpio->type], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
     switch (gpio->type)
     {
         case Calypso_ATGPIO_GPIOType_Unused:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, "", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, "", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
             break;
 
         case Calypso_ATGPIO_GPIOType_Input:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_PullType_Strings[gpio->parameters.input.pullType], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATGPIO_PullType_Strings[gpio->parameters.input.pullType], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
             break;
 
         case Calypso_ATGPIO_GPIOType_Output:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATGPIO_GPIOState_Strings[gpio->parameters.output.state], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATGPIO_GPIOState_Strings[gpio->parameters.output.state], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
             break;
 
         case Calypso_ATGPIO_GPIOType_PWM:
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->parameters.pwm.period, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(&builder, gpio->parameters.pwm.period, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, gpio->parameters.pwm.ratio, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendInt(&builder, gpio->parameters.pwm.ratio, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -192,7 +194,7 @@ bool Calypso_ATGPIO_Set(Calypso_ATGPIO_GPIO_t* gpio, bool save)
         default:
             return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
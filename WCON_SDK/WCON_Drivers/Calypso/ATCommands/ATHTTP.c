@@ -127,12 +127,13 @@ bool Calypso_ATHTTP_Create(uint8_t* clientHandle)
 bool Calypso_ATHTTP_Destroy(uint8_t clientHandle)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpDestroy=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpDestroy=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -146,33 +147,34 @@ bool Calypso_ATHTTP_Destroy(uint8_t clientHandle)
 bool Calypso_ATHTTP_Connect(uint8_t clientHandle, const char* host, uint8_t flags, const char* privateKey, const char* certificate, const char* rootCaCertificate)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpConnect=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpConnect=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, host, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, host, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATHTTP_ConnectFlags_Strings, Calypso_ATHTTP_ConnectFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(&builder, Calypso_ATHTTP_ConnectFlags_Strings, Calypso_ATHTTP_ConnectFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, privateKey, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, privateKey, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, certificate, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, certificate, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, rootCaCertificate, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, rootCaCertificate, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -187,12 +189,13 @@ bool Calypso_ATHTTP_Connect(uint8_t clientHandle, const char* host, uint8_t flag
 bool Calypso_ATHTTP_Disconnect(uint8_t clientHandle)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpDisconnect=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpDisconnect=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -206,12 +209,13 @@ bool Calypso_ATHTTP_Disconnect(uint8_t clientHandle)
 bool Calypso_ATHTTP_SetProxy(Calypso_ATSocket_Descriptor_t proxy)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpSetProxy=");
-    if (!Calypso_ATSocket_AppendSocketDescriptor(pRequestCommand, proxy, ATCOMMAND_STRING_TERMINATE))
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpSetProxy=");
+    if (!Calypso_ATSocket_AppendSocketDescriptor(&builder, proxy, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -252,37 +256,38 @@ bool Calypso_ATHTTP_SendRequest(uint8_t clientHandle, Calypso_ATHTTP_Method_t me
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpSendReq=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpSendReq=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_Method_Strings[method], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATHTTP_Method_Strings[method], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, uri, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, uri, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATHTTP_RequestFlags_Strings, Calypso_ATHTTP_RequestFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(&builder, Calypso_ATHTTP_RequestFlags_Strings, Calypso_ATHTTP_RequestFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendBytes(&builder, data, length, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -316,21 +321,22 @@ bool Calypso_ATHTTP_ReadResponseBody(uint8_t clientHandle, Calypso_DataFormat_t
     responseBody->length = 0;
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpReadResBody=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpReadResBody=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -434,32 +440,33 @@ bool Calypso_ATHTTP_SetHeader(uint8_t clientHandle, Calypso_ATHTTP_HeaderField_t
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpSetHeader=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpSetHeader=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderField_Strings[field], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATHTTP_HeaderField_Strings[field], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderPersistency_Strings[persistency], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATHTTP_HeaderPersistency_Strings[persistency], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendBytes(&builder, data, length, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -473,25 +480,26 @@ bool Calypso_ATHTTP_SetHeader(uint8_t clientHandle, Calypso_ATHTTP_HeaderField_t
 bool Calypso_ATHTTP_GetHeader(uint8_t clientHandle, Calypso_ATHTTP_HeaderField_t field, Calypso_DataFormat_t format, bool decodeBase64, uint16_t length, Calypso_ATHTTP_HeaderData_t* header)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpGetHeader=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpGetHeader=");
+    if (!ATCommand_Builder_AppendInt(&builder, clientHandle, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATHTTP_HeaderField_Strings[field], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATHTTP_HeaderField_Strings[field], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -591,20 +599,21 @@ bool Calypso_ATHTTP_SendCustomResponse(Calypso_DataFormat_t format, bool encodeA
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+httpCustomResponse=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+httpCustomResponse=");
+    if (!ATCommand_Builder_AppendInt(&builder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentBytes(pRequestCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendBytes(&builder, data, length, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -41,21 +41,22 @@ static const char* Calypso_ATMQTT_SetOptionStrings[Calypso_ATMQTT_SetOption_Numb
 
 static const char* Calypso_ATMQTT_CreateFlagsStrings[Calypso_ATMQTT_CreateFlags_NumberOfValues] = {"ip4", "ip6", "url", "sec", "skip_domain_verify", "skip_cert_verify", "skip_date_verify"};
 
-static bool Calypso_ATMQTT_AddArgumentsCreate(char* pAtCommand, char* clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams);
-static bool Calypso_ATMQTT_AddArgumentsPublish(char* pAtCommand, uint8_t index, char* topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char* pMessage);
-static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t* pTopics);
-static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char* pAtCommand, uint8_t index, char* topic1, char* topic2, char* topic3, char* topic4);
-static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t* pValues);
+static bool Calypso_ATMQTT_AddArgumentsCreate(ATCommand_Builder_t* pBuilder, char* clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams);
+static bool Calypso_ATMQTT_AddArgumentsPublish(ATCommand_Builder_t* pBuilder, uint8_t index, char* topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char* pMessage);
+static bool Calypso_ATMQTT_AddArgumentsSubscribe(ATCommand_Builder_t* pBuilder, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t* pTopics);
+static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(ATCommand_Builder_t* pBuilder, uint8_t index, char* topic1, char* topic2, char* topic3, char* topic4);
+static bool Calypso_ATMQTT_AddArgumentsSet(ATCommand_Builder_t* pBuilder, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t* pValues);
 static bool Calypso_ATMQTT_ParseResponseCreate(char** pAtCommand, uint8_t* pOutIndex);
 
 bool Calypso_ATMQTT_Create(char* clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams, uint8_t* pIndex)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+mqttCreate=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttCreate=");
 
-    if (!Calypso_ATMQTT_AddArgumentsCreate(pRequestCommand, clientID, flags, serverInfo, securityParams, connectionParams))
+    if (!Calypso_ATMQTT_AddArgumentsCreate(&builder, clientID, flags, serverInfo, securityParams, connectionParams))
     {
         return false;
     }
@@ -76,14 +77,15 @@ bool Calypso_ATMQTT_Delete(uint8_t index)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttDelete=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttDelete=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -100,14 +102,15 @@ bool Calypso_ATMQTT_Connect(uint8_t index)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttConnect=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttConnect=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -123,14 +126,15 @@ bool Calypso_ATMQTT_Disconnect(uint8_t index)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttDisconnect=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttDisconnect=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -147,10 +151,11 @@ bool Calypso_ATMQTT_Publish(uint8_t index, char* topic, Calypso_ATMQTT_QoS_t QoS
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttPublish=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttPublish=");
 
-    if (!Calypso_ATMQTT_AddArgumentsPublish(pRequestCommand, index, topic, QoS, retain, messageLength, pMessage))
+    if (!Calypso_ATMQTT_AddArgumentsPublish(&builder, index, topic, QoS, retain, messageLength, pMessage))
     {
         return false;
     }
@@ -166,10 +171,11 @@ bool Calypso_ATMQTT_Subscribe(uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttSubscribe=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttSubscribe=");
 
-    if (!Calypso_ATMQTT_AddArgumentsSubscribe(pRequestCommand, index, numOfTopics, pTopics))
+    if (!Calypso_ATMQTT_AddArgumentsSubscribe(&builder, index, numOfTopics, pTopics))
     {
         return false;
     }
@@ -185,10 +191,11 @@ bool Calypso_ATMQTT_Unsubscribe(uint8_t index, char* topic1, char* topic2, char*
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttUnsubscribe=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttUnsubscribe=");
 
-    if (!Calypso_ATMQTT_AddArgumentsUnsubscribe(pRequestCommand, index, topic1, topic2, topic3, topic4))
+    if (!Calypso_ATMQTT_AddArgumentsUnsubscribe(&builder, index, topic1, topic2, topic3, topic4))
     {
         return false;
     }
@@ -204,10 +211,11 @@ bool Calypso_ATMQTT_Set(uint8_t index, Calypso_ATMQTT_SetOption_t option, Calyps
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+mqttSet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+mqttSet=");
 
-    if (!Calypso_ATMQTT_AddArgumentsSet(pRequestCommand, index, option, pValues))
+    if (!Calypso_ATMQTT_AddArgumentsSet(&builder, index, option, pValues))
     {
         return false;
     }
@@ -222,7 +230,7 @@ bool Calypso_ATMQTT_Set(uint8_t index, Calypso_ATMQTT_SetOption_t option, Calyps
 /**
  * @brief Adds arguments to the AT+MQTTCreate command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] clientID Client ID
  * @param[in] flags Creation flags (see Calypso_ATMQTT_CreateFlags_t)
  * @param[in] serverInfo Server address and port. See Calypso_ATMQTT_ServerInfo_t.
@@ -231,86 +239,86 @@ bool Calypso_ATMQTT_Set(uint8_t index, Calypso_ATMQTT_SetOption_t option, Calyps
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsCreate(char* pAtCommand, char* clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams)
+static bool Calypso_ATMQTT_AddArgumentsCreate(ATCommand_Builder_t* pBuilder, char* clientID, uint32_t flags, Calypso_ATMQTT_ServerInfo_t serverInfo, Calypso_ATMQTT_SecurityParams_t securityParams, Calypso_ATMQTT_ConnectionParams_t connectionParams)
 {
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, clientID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, clientID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBitmask(pAtCommand, Calypso_ATMQTT_CreateFlagsStrings, Calypso_ATMQTT_CreateFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(pBuilder, Calypso_ATMQTT_CreateFlagsStrings, Calypso_ATMQTT_CreateFlags_NumberOfValues, flags, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, serverInfo.address, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, serverInfo.address, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, serverInfo.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, serverInfo.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_SecurityMethodsStrings[securityParams.securityMethod], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_SecurityMethodsStrings[securityParams.securityMethod], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!Calypso_ATSocket_AppendCipherMask(pAtCommand, securityParams.cipher))
+    if (!Calypso_ATSocket_AppendCipherMask(pBuilder, securityParams.cipher))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, "", ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, "", ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.privateKeyFile, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, securityParams.privateKeyFile, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.certificateFile, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, securityParams.certificateFile, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.CAFile, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, securityParams.CAFile, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, securityParams.DHKey, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, securityParams.DHKey, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_ProtocolStrings[connectionParams.protocolVersion], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_ProtocolStrings[connectionParams.protocolVersion], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, connectionParams.blockingSend, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, connectionParams.blockingSend, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, connectionParams.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, connectionParams.format, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+MQTTpublish command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] index Index (handle) of MQTT client.
  * @param[in] topic Topic to be published
  * @param[in] retain Retain the message (1) or do not retain the message (0)
@@ -320,53 +328,53 @@ static bool Calypso_ATMQTT_AddArgumentsCreate(char* pAtCommand, char* clientID,
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsPublish(char* pAtCommand, uint8_t index, char* topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char* pMessage)
+static bool Calypso_ATMQTT_AddArgumentsPublish(ATCommand_Builder_t* pBuilder, uint8_t index, char* topic, Calypso_ATMQTT_QoS_t QoS, uint8_t retain, uint16_t messageLength, char* pMessage)
 {
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, topic, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, topic, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[QoS], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_QoSStrings[QoS], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBytes(pAtCommand, pMessage, messageLength, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendBytes(pBuilder, pMessage, messageLength, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+MQTTsubscribe command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] index Index (handle) of MQTT client to to subscribe.
  * @param[in] numOfTopics Number of topics to be subscribed to
  * @param[in] pTopics Topics to subscribe to. See Calypso_ATMQTT_SubscribeTopic_t
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t* pTopics)
+static bool Calypso_ATMQTT_AddArgumentsSubscribe(ATCommand_Builder_t* pBuilder, uint8_t index, uint8_t numOfTopics, Calypso_ATMQTT_SubscribeTopic_t* pTopics)
 {
 
     if (numOfTopics > MQTT_MAX_NUM_TOPICS_TO_SUBSCRIBE)
@@ -374,12 +382,12 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -387,17 +395,17 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index
     for (uint8_t i = 0; i < numOfTopics; i++)
     {
 
-        if (!ATCommand_AppendArgumentString(pAtCommand, pTopics[i].topic, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, pTopics[i].topic, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
 
-        if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pTopics[i].QoS], ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_QoSStrings[pTopics[i].QoS], ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
         /* Reserved argument */
-        if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -406,21 +414,19 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index
     /* Add empty, unused topics*/
     for (uint8_t i = numOfTopics; i <= MQTT_MAX_NUM_TOPICS_TO_SUBSCRIBE; i++)
     {
-        if (!ATCommand_AppendArgumentString(pAtCommand, ",,", ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ",,", ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
 
-    pAtCommand[strlen(pAtCommand)] = ATCOMMAND_STRING_TERMINATE;
-
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+MQTTunsubscribe command string
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] index Index (handle) of MQTT client to unsubscribe.
  * @param[in] topic1 Topic 1 to unsubscribe.
  * @param[in] topic2 Topic 2 to unsubscribe. Set to NULL / empty string to ignore this topic and topics 3,4.
@@ -429,7 +435,7 @@ static bool Calypso_ATMQTT_AddArgumentsSubscribe(char* pAtCommand, uint8_t index
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char* pAtCommand, uint8_t index, char* topic1, char* topic2, char* topic3, char* topic4)
+static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(ATCommand_Builder_t* pBuilder, uint8_t index, char* topic1, char* topic2, char* topic3, char* topic4)
 {
 
     uint32_t numOfTopics = 0;
@@ -450,73 +456,73 @@ static bool Calypso_ATMQTT_AddArgumentsUnsubscribe(char* pAtCommand, uint8_t ind
         numOfTopics++;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, numOfTopics, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic1 ? topic1 : ""), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, (NULL != topic1 ? topic1 : ""), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic2 ? topic2 : ""), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, (NULL != topic2 ? topic2 : ""), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic3 ? topic3 : ""), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, (NULL != topic3 ? topic3 : ""), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, (NULL != topic4 ? topic4 : ""), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, (NULL != topic4 ? topic4 : ""), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+MQTTset command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] index Index (handle) of MQTT client to set options for
  * @param[in] option Option to set
  * @param[in] pValues Values to set
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t* pValues)
+static bool Calypso_ATMQTT_AddArgumentsSet(ATCommand_Builder_t* pBuilder, uint8_t index, Calypso_ATMQTT_SetOption_t option, Calypso_ATMQTT_SetValues_t* pValues)
 {
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, index, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -526,7 +532,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_SetOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_SetOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -535,7 +541,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
     {
         case Calypso_ATMQTT_SetOption_User:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, pValues->username, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, pValues->username, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -544,7 +550,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
 
         case Calypso_ATMQTT_SetOption_Password:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, pValues->password, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, pValues->password, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -555,26 +561,26 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
         {
             Calypso_ATMQTT_SetWillParams_t* pWillValues = &pValues->will;
 
-            if (!ATCommand_AppendArgumentString(pAtCommand, pWillValues->topic, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, pWillValues->topic, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
 
-                if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATMQTT_QoSStrings[pWillValues->QoS], ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATMQTT_QoSStrings[pWillValues->QoS], ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
 
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pWillValues->retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pWillValues->retain, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
 
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pWillValues->messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pWillValues->messageLength, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
 
-                if (!ATCommand_AppendArgumentString(pAtCommand, pWillValues->message, ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendString(pBuilder, pWillValues->message, ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -584,7 +590,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
 
             case Calypso_ATMQTT_SetOption_KeepAlive:
             {
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAliveSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->keepAliveSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -593,7 +599,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
 
             case Calypso_ATMQTT_SetOption_Clean:
             {
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->clean, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->clean, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -607,7 +613,7 @@ static bool Calypso_ATMQTT_AddArgumentsSet(char* pAtCommand, uint8_t index, Caly
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -46,7 +46,7 @@ static const char* Calypso_ATNetApp_DnsClientOptionStrings[Calypso_ATNetApp_DnsC
 
 static const char* Calypso_ATNetApp_DeviceOptionStrings[Calypso_ATNetApp_DeviceOption_NumberOfValues] = {"URN", "DOMAIN"};
 
-static bool Calypso_ATNetApp_AddStartStopArguments(char* pOutString, uint8_t apps);
+static bool Calypso_ATNetApp_AddStartStopArguments(ATCommand_Builder_t* pBuilder, uint8_t apps);
 
 bool Calypso_ATNetApp_StartApplications(uint8_t apps)
 {
@@ -69,10 +69,11 @@ bool Calypso_ATNetApp_StartApplications(uint8_t apps)
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netAppStart=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppStart=");
 
-    if (!Calypso_ATNetApp_AddStartStopArguments(pRequestCommand, apps))
+    if (!Calypso_ATNetApp_AddStartStopArguments(&builder, apps))
     {
         return false;
     }
@@ -105,10 +106,11 @@ bool Calypso_ATNetApp_StopApplications(uint8_t apps)
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netAppStop=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppStop=");
 
-    if (!Calypso_ATNetApp_AddStartStopArguments(pRequestCommand, apps))
+    if (!Calypso_ATNetApp_AddStartStopArguments(&builder, apps))
     {
         return false;
     }
@@ -148,17 +150,18 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             }
 
             char* pRequestCommand = AT_commandBuffer;
-            strcpy(pRequestCommand, "AT+netAppSet=SNTP_CLIENT,server_address,");
+            ATCommand_Builder_t builder;
+            ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppSet=SNTP_CLIENT,server_address,");
 
-            if (!ATCommand_AppendArgumentInt(pRequestCommand, i, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(&builder, i, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
-            if (!ATCommand_AppendArgumentString(pRequestCommand, value->sntp.servers[i], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, value->sntp.servers[i], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -176,9 +179,10 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+netAppSet=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppSet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -186,7 +190,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
     switch (app)
     {
         case Calypso_ATNetApp_Application_HttpServer:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -194,98 +198,98 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_HttpOption_PrimPortNum:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.primPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.primPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_AuthCheck:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.authCheck, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.authCheck, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_AuthName:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authName, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.authName, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_AuthPassword:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authPassword, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.authPassword, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_AuthRealm:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.authRealm, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.authRealm, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_RomPagesAccess:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.romPagesAccess, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.romPagesAccess, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_SecondPortNum:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.secondPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.secondPortNum, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_SecondPortEn:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.secondPortEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.secondPortEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_PrimPortSecEn:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->http.primPortSecEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->http.primPortSecEn, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_PrivKeyFile:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.privKeyFile, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.privKeyFile, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_DevCertFile:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.devCertFile, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.devCertFile, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_CaCertFile:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.caCertFile, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.caCertFile, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_TmpRegisterService:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.tmpRegisterService, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.tmpRegisterService, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_HttpOption_TmpUnregisterService:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->http.tmpUnregisterService, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->http.tmpUnregisterService, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -297,7 +301,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             break;
 
         case Calypso_ATNetApp_Application_DhcpServer:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -305,15 +309,15 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_DhcpOption_Basic:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dhcp.basic.leaseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->dhcp.basic.leaseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->dhcp.basic.firstIpAddress, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendString(&builder, value->dhcp.basic.firstIpAddress, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->dhcp.basic.lastIpAddress, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->dhcp.basic.lastIpAddress, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -325,7 +329,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             break;
 
         case Calypso_ATNetApp_Application_mDns:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -333,41 +337,41 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_mDnsOption_ContQuery:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->mDns.contQuery, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->mDns.contQuery, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_mDnsOption_QeventMask:
-                    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATNetApp_mDnsEventMaskStrings, Calypso_ATNetApp_mDnsEventMask_NumberOfValues, value->mDns.qeventMask, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE))
+                    if (!ATCommand_Builder_AppendBitmask(&builder, Calypso_ATNetApp_mDnsEventMaskStrings, Calypso_ATNetApp_mDnsEventMask_NumberOfValues, value->mDns.qeventMask, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_mDnsOption_TimingParams:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.period, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.period, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.repetitions, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.repetitions, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.telescopicFactor, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.telescopicFactor, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.retransmissionInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.retransmissionInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.maxPeriodInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.maxPeriodInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->mDns.timingParams.maxTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->mDns.timingParams.maxTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -384,7 +388,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 
         case Calypso_ATNetApp_Application_SntpClient:
         {
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -392,21 +396,21 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_SntpOption_Enable:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.enable, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->sntp.enable, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_SntpOption_UpdateInterval:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.updateInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->sntp.updateInterval, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_SntpOption_TimeZone:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->sntp.timeZone, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->sntp.timeZone, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -420,7 +424,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
         }
 
         case Calypso_ATNetApp_Application_DnsClient:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -428,11 +432,11 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_DnsClientOption_Time:
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dnsClient.time.maxResponseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->dnsClient.time.maxResponseTime, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pRequestCommand, value->dnsClient.time.numberOfRetries, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(&builder, value->dnsClient.time.numberOfRetries, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -444,7 +448,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             break;
 
         case Calypso_ATNetApp_Application_Device:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -452,14 +456,14 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             switch (option)
             {
                 case Calypso_ATNetApp_DeviceOption_URN:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->device.urn, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->device.urn, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATNetApp_DeviceOption_Domain:
-                    if (!ATCommand_AppendArgumentString(pRequestCommand, value->device.domain, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(&builder, value->device.domain, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -474,7 +478,7 @@ bool Calypso_ATNetApp_Set(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -505,11 +509,12 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
     memset(value, 0, sizeof(*value));
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+netAppGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppGet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_ApplicationStrings[appIdx], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -517,21 +522,21 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
     switch (app)
     {
         case Calypso_ATNetApp_Application_HttpServer:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_HttpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATNetApp_Application_DhcpServer:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DhcpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATNetApp_Application_mDns:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_mDnsOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -542,21 +547,21 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             return false;
 
         case Calypso_ATNetApp_Application_SntpClient:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_SntpOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATNetApp_Application_DnsClient:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DnsClientOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATNetApp_Application_Device:
-            if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetApp_DeviceOptionStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -566,7 +571,7 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
             return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -850,11 +855,12 @@ bool Calypso_ATNetApp_Get(Calypso_ATNetApp_Application_t app, uint8_t option, Ca
 bool Calypso_ATNetApp_GetHostByName(const char* hostName, Calypso_ATSocket_Family_t family, Calypso_ATNetApp_GetHostByNameResult_t* lookupResult)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+netAppGetHostByName=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppGetHostByName=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, hostName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, hostName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -864,12 +870,12 @@ bool Calypso_ATNetApp_GetHostByName(const char* hostName, Calypso_ATSocket_Famil
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, temp, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, temp, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -908,43 +914,44 @@ bool Calypso_ATNetApp_GetHostByName(const char* hostName, Calypso_ATSocket_Famil
 bool Calypso_ATNetApp_Ping(Calypso_ATNetApp_PingParameters_t* parameters)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netAppPing=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netAppPing=");
 
     char temp[32];
     if (!Calypso_ATSocket_GetSocketFamilyString(parameters->family, temp))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, temp, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, temp, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, parameters->destination, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, parameters->destination, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->size, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, parameters->size, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->delayMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, parameters->delayMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->timeoutMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, parameters->timeoutMs, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->maxNumberOfPings, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, parameters->maxNumberOfPings, ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, parameters->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, parameters->mode, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -968,16 +975,16 @@ bool Calypso_ATNetApp_UpdateTime()
 /**
  * @brief Adds arguments to the AT+netAppStart or AT+netAppStop command.
  *
- * @param[out] pOutString Output string containing AT command
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] apps Applications to be started or stopped (bitmask)
  *
  * @return true if successful, false otherwise
  */
-bool Calypso_ATNetApp_AddStartStopArguments(char* pOutString, uint8_t apps)
+bool Calypso_ATNetApp_AddStartStopArguments(ATCommand_Builder_t* pBuilder, uint8_t apps)
 {
-    if (!ATCommand_AppendArgumentBitmask(pOutString, Calypso_ATNetApp_ApplicationStrings, Calypso_ATNetApp_Application_NumberOfValues, apps, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(pBuilder, Calypso_ATNetApp_ApplicationStrings, Calypso_ATNetApp_Application_NumberOfValues, apps, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    return ATCommand_AppendArgumentString(pOutString, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
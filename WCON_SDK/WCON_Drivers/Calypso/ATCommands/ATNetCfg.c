@@ -46,15 +46,16 @@ static const char* Calypso_ATNetCfg_IPv6MethodStrings[Calypso_ATNetCfg_IPv6Metho
 bool Calypso_ATNetCfg_SetInterfaceModes(uint16_t modes)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netCfgSet=IF,STATE,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgSet=IF,STATE,");
 
-    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATNetCfg_InterfaceModeStrings, Calypso_ATNetCfg_InterfaceMode_NumberOfValues, modes, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(&builder, Calypso_ATNetCfg_InterfaceModeStrings, Calypso_ATNetCfg_InterfaceMode_NumberOfValues, modes, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -74,10 +75,11 @@ bool Calypso_ATNetCfg_GetMacAddress(uint8_t macAddress[6])
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+netCfgGet=GET_MAC_ADDR");
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgGet=GET_MAC_ADDR");
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -116,18 +118,19 @@ bool Calypso_ATNetCfg_SetMacAddress(uint8_t macAddress[6])
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netCfgSet=SET_MAC_ADDR,,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgSet=SET_MAC_ADDR,,");
 
     for (uint8_t i = 0; i < 6; i++)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, macAddress[i], ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, macAddress[i], ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
 
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -161,10 +164,11 @@ bool Calypso_ATNetCfg_GetIPv4Address(Calypso_ATNetCfg_IPv4Config_t* ipConfig, bo
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, ap ? "AT+netCfgGet=IPV4_AP_ADDR" : "AT+netCfgGet=IPV4_STA_ADDR");
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, ap ? "AT+netCfgGet=IPV4_AP_ADDR" : "AT+netCfgGet=IPV4_STA_ADDR");
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -250,40 +254,41 @@ bool Calypso_ATNetCfg_SetIPv4Address(Calypso_ATNetCfg_IPv4Config_t* ipConfig, bo
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, ap ? "AT+netCfgSet=IPV4_AP_ADDR," : "AT+netCfgSet=IPV4_STA_ADDR,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, ap ? "AT+netCfgSet=IPV4_AP_ADDR," : "AT+netCfgSet=IPV4_STA_ADDR,");
 
     if (ap)
     {
         ipConfig->method = Calypso_ATNetCfg_IPv4Method_Static;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetCfg_IPv4MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetCfg_IPv4MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (Calypso_ATNetCfg_IPv4Method_Static == ipConfig->method)
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->subnetMask, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ipConfig->subnetMask, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->gatewayAddress, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(&builder, ipConfig->gatewayAddress, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendString(&builder, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
 
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -316,10 +321,11 @@ bool Calypso_ATNetCfg_GetIPv6Address(Calypso_ATNetCfg_IPv6Config_t* ipConfig, bo
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, global ? "AT+netCfgGet=IPV6_ADDR_GLOBAL" : "AT+netCfgGet=IPV6_ADDR_LOCAL");
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, global ? "AT+netCfgGet=IPV6_ADDR_GLOBAL" : "AT+netCfgGet=IPV6_ADDR_LOCAL");
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -384,25 +390,26 @@ bool Calypso_ATNetCfg_SetIPv6Address(Calypso_ATNetCfg_IPv6Config_t* ipConfig, bo
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, global ? "AT+netCfgSet=IPV6_ADDR_GLOBAL," : "AT+netCfgSet=IPV6_ADDR_LOCAL,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, global ? "AT+netCfgSet=IPV6_ADDR_GLOBAL," : "AT+netCfgSet=IPV6_ADDR_LOCAL,");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATNetCfg_IPv6MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATNetCfg_IPv6MethodStrings[ipConfig->method], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, ipConfig->ipAddress, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ipConfig->dnsAddress, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -419,18 +426,19 @@ bool Calypso_ATNetCfg_DisconnectApStation(uint8_t macAddress[6])
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netCfgSet=AP_STATION_DISCONNECT,,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgSet=AP_STATION_DISCONNECT,,");
 
     for (uint8_t i = 0; i < 6; i++)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, macAddress[i], ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, macAddress[i], ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX, i < 5 ? ':' : ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
 
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -447,10 +455,11 @@ bool Calypso_ATNetCfg_GetIPv4DnsClient(char dns2ndServerAddress[16])
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+netCfgGet=IPV4_DNS_CLIENT");
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgGet=IPV4_DNS_CLIENT");
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
@@ -481,11 +490,12 @@ bool Calypso_ATNetCfg_SetIPv4DnsClient(const char dns2ndServerAddress[16])
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+netCfgSet=IPV4_DNS_CLIENT,,");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+netCfgSet=IPV4_DNS_CLIENT,,");
 
-    ATCommand_AppendArgumentString(pRequestCommand, dns2ndServerAddress, ATCOMMAND_STRING_TERMINATE);
-    ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, dns2ndServerAddress, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 
     if (!Calypso_SendRequest(pRequestCommand))
     {
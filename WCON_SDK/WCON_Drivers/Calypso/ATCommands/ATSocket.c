@@ -69,12 +69,12 @@ static const char* Calypso_ATSocket_CipherStrings[Calypso_ATSocket_Cipher_Number
                                                                                              "TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256",
                                                                                              "TLS_DHE_RSA_WITH_CHACHA20_POLY1305_SHA256"};
 
-static bool Calypso_ATSocket_AddArgumentsCreate(char* pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol);
-static bool Calypso_ATSocket_AddArgumentsBindConnect(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket);
-static bool Calypso_ATSocket_AddArgumentsRecv(char* pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length);
-static bool Calypso_ATSocket_AddArgumentsRecvFrom(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length);
-static bool Calypso_ATSocket_AddArgumentsSendTo(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t* remoteSocket, Calypso_DataFormat_t format, uint16_t length, char* data);
-static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t* data);
+static bool Calypso_ATSocket_AddArgumentsCreate(ATCommand_Builder_t* pBuilder, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol);
+static bool Calypso_ATSocket_AddArgumentsBindConnect(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket);
+static bool Calypso_ATSocket_AddArgumentsRecv(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_AddArgumentsRecvFrom(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_AddArgumentsSendTo(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t* remoteSocket, Calypso_DataFormat_t format, uint16_t length);
+static bool Calypso_ATSocket_AddArgumentsSetSockOpt(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t* data);
 
 static bool Calypso_ATSocket_ParseResponseCreate(char** pAtCommand, uint8_t* pOutSocketID);
 static bool Calypso_ATSocket_ParseResponseGetOptions(Calypso_ATSocket_SockOptLevel_t level, uint8_t option, char** pAtCommand, Calypso_ATSocket_Options_t* pValues);
@@ -83,11 +83,12 @@ bool Calypso_ATSocket_Create(Calypso_ATSocket_Family_t family, Calypso_ATSocket_
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+socket=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+socket=");
 
-    if (!Calypso_ATSocket_AddArgumentsCreate(pRequestCommand, family, type, protocol))
+    if (!Calypso_ATSocket_AddArgumentsCreate(&builder, family, type, protocol))
     {
         return false;
     }
@@ -108,15 +109,16 @@ bool Calypso_ATSocket_Close(uint8_t socketID)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+close=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+close=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -132,10 +134,11 @@ bool Calypso_ATSocket_Bind(uint8_t socketID, Calypso_ATSocket_Descriptor_t socke
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+bind=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+bind=");
 
-    if (!Calypso_ATSocket_AddArgumentsBindConnect(pRequestCommand, socketID, socket))
+    if (!Calypso_ATSocket_AddArgumentsBindConnect(&builder, socketID, socket))
     {
         return false;
     }
@@ -151,20 +154,21 @@ bool Calypso_ATSocket_Listen(uint8_t socketID, uint16_t backlog)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+listen=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+listen=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, backlog, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, backlog, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -181,10 +185,11 @@ bool Calypso_ATSocket_Connect(uint8_t socketID, Calypso_ATSocket_Descriptor_t re
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+connect=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+connect=");
 
-    if (!Calypso_ATSocket_AddArgumentsBindConnect(pRequestCommand, socketID, remoteSocket))
+    if (!Calypso_ATSocket_AddArgumentsBindConnect(&builder, socketID, remoteSocket))
     {
         return false;
     }
@@ -200,20 +205,21 @@ bool Calypso_ATSocket_Accept(uint8_t socketID, Calypso_ATSocket_Family_t family)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+accept=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+accept=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketFamilyString[family], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATSocketFamilyString[family], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -229,10 +235,11 @@ bool Calypso_ATSocket_Receive(uint8_t socketID, Calypso_DataFormat_t format, uin
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+recv=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+recv=");
 
-    if (!Calypso_ATSocket_AddArgumentsRecv(pRequestCommand, socketID, format, length))
+    if (!Calypso_ATSocket_AddArgumentsRecv(&builder, socketID, format, length))
     {
         return false;
     }
@@ -248,10 +255,11 @@ bool Calypso_ATSocket_ReceiveFrom(uint8_t socketID, Calypso_ATSocket_Descriptor_
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+recvFrom=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+recvFrom=");
 
-    if (!Calypso_ATSocket_AddArgumentsRecvFrom(pRequestCommand, socketID, remoteSocket, format, length))
+    if (!Calypso_ATSocket_AddArgumentsRecvFrom(&builder, socketID, remoteSocket, format, length))
     {
         return false;
     }
@@ -268,88 +276,64 @@ bool Calypso_ATSocket_SendTo(uint8_t socketID, Calypso_ATSocket_Descriptor_t* re
 {
     *bytesSent = 0;
 
+    /* Send data using either AT+send or AT+sendTo, splitting the payload into
+     * chunks of max. CALYPSO_MAX_PAYLOAD_SIZE (after encoding), if necessary.
+     * Only the command header is built in AT_commandBuffer - the payload is streamed
+     * from the supplied buffer and (if requested) encoded as Base64 on the fly. */
+    uint16_t maxChunkSize = CALYPSO_MAX_PAYLOAD_SIZE;
     if (encodeAsBase64)
     {
-        /* Base64 encoded data might exceed the max. chunk size. To limit the required buffer size,
-         * the data is encoded in chunks, if necessary. */
+        maxChunkSize = (((CALYPSO_MAX_PAYLOAD_SIZE - 1) * 3) / 4) - 2;
+    }
 
-        uint16_t maxChunkSize = (((CALYPSO_MAX_PAYLOAD_SIZE - 1) * 3) / 4) - 2;
-        uint16_t chunkSize = 0;
-        for (uint16_t chunkOffset = 0; chunkOffset < length; chunkOffset += chunkSize)
+    uint16_t chunkSize = 0;
+    for (uint16_t chunkOffset = 0; chunkOffset < length; chunkOffset += chunkSize)
+    {
+        chunkSize = length - chunkOffset;
+        if (chunkSize > maxChunkSize)
         {
-            chunkSize = length - chunkOffset;
-            if (chunkSize > maxChunkSize)
-            {
-                chunkSize = maxChunkSize;
-            }
-
-            /* Encode as Base64 */
-            uint32_t lengthEncoded;
-            if (!Base64_GetEncBufSize(chunkSize, &lengthEncoded))
-            {
-                return false;
-            }
-            char base64Buffer[lengthEncoded];
-            if (!Base64_Encode((uint8_t*)data + chunkOffset, chunkSize, (uint8_t*)base64Buffer, &lengthEncoded))
-            {
-                return false;
-            }
-
-            /* Recursively call Calypso_ATSocket_Send() with the encoded binary data (excluding '\0') */
-            uint16_t chunkBytesWritten = 0;
-            bool ok = Calypso_ATSocket_SendTo(socketID, remoteSocket, format, false, lengthEncoded, base64Buffer, &chunkBytesWritten);
-            if (!ok)
-            {
-                return false;
-            }
-
-            *bytesSent += chunkSize;
+            chunkSize = maxChunkSize;
         }
 
-        return true;
-    }
-
-    /* Send data using either AT+send or AT+sendTo, splitting the payload into
-     * chunks of max. CALYPSO_MAX_PAYLOAD_SIZE, if necessary. */
-    uint16_t chunkBytesSent = 0;
-    for (uint16_t chunkOffset = 0; chunkOffset < length; chunkOffset += chunkBytesSent)
-    {
-        uint16_t chunkSize = length - chunkOffset;
-        if (chunkSize > CALYPSO_MAX_PAYLOAD_SIZE)
+        uint32_t lengthSent = chunkSize;
+        if (encodeAsBase64 && !Base64_GetEncBufSize(chunkSize, &lengthSent))
         {
-            chunkSize = CALYPSO_MAX_PAYLOAD_SIZE;
+            return false;
         }
 
         char* pRequestCommand = AT_commandBuffer;
+        ATCommand_Builder_t builder;
 
         if (NULL == remoteSocket)
         {
             /* Stream / TCP */
-            strcpy(pRequestCommand, "AT+send=");
+            ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+send=");
         }
         else
         {
             /* Datagram / UDP */
-            strcpy(pRequestCommand, "AT+sendTo=");
+            ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+sendTo=");
         }
 
-        if (!Calypso_ATSocket_AddArgumentsSendTo(pRequestCommand, socketID, remoteSocket, format, chunkSize, data + chunkOffset))
+        if (!Calypso_ATSocket_AddArgumentsSendTo(&builder, socketID, remoteSocket, format, (uint16_t)lengthSent))
         {
             return false;
         }
 
-        chunkBytesSent = chunkSize;
-
         if (!Calypso_SendRequest(pRequestCommand))
         {
             return false;
         }
+        if (!Calypso_SendRequestPayload((const uint8_t*)data + chunkOffset, chunkSize, encodeAsBase64))
+        {
+            return false;
+        }
         if (!Calypso_WaitForConfirm(Calypso_GetTimeout(Calypso_Timeout_General), Calypso_CNFStatus_Success, NULL))
         {
             return false;
         }
 
-        *bytesSent += chunkBytesSent;
+        *bytesSent += chunkSize;
     }
 
     return true;
@@ -359,10 +343,11 @@ bool Calypso_ATSocket_SetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+setSockOpt=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+setSockOpt=");
 
-    if (!Calypso_ATSocket_AddArgumentsSetSockOpt(pRequestCommand, socketID, level, option, pValues))
+    if (!Calypso_ATSocket_AddArgumentsSetSockOpt(&builder, socketID, level, option, pValues))
     {
         return false;
     }
@@ -377,16 +362,17 @@ bool Calypso_ATSocket_SetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
 bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t* pValues)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+getSockOpt=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+getSockOpt=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -398,14 +384,14 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
             /* Not supported */
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptSocketString[option], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendString(&builder, ATSocketSockOptSocketString[option], ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
     else if (Calypso_ATSocket_SockOptLevel_IP == level)
     {
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATSocketSockOptIPString[option], ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendString(&builder, ATSocketSockOptIPString[option], ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -415,7 +401,7 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -432,37 +418,37 @@ bool Calypso_ATSocket_GetSocketOption(uint8_t socketID, Calypso_ATSocket_SockOpt
     return Calypso_ATSocket_ParseResponseGetOptions(level, option, &pRespondCommand, pValues);
 }
 
-bool Calypso_ATSocket_AppendSocketDescriptor(char* pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim)
+bool Calypso_ATSocket_AppendSocketDescriptor(ATCommand_Builder_t* pBuilder, Calypso_ATSocket_Descriptor_t socket, char lastDelim)
 {
     if (socket.family >= Calypso_ATSocket_Family_NumberOfValues)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketFamilyString[socket.family], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATSocketFamilyString[socket.family], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socket.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socket.port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, socket.address, lastDelim);
+    return ATCommand_Builder_AppendString(pBuilder, socket.address, lastDelim);
 }
 
 /**
  * @brief Adds arguments to the AT+socket command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] family Family of the socket. See Calypso_ATSocket_Family_t
  * @param[in] type Type of the socket. See Calypso_ATSocket_Type_t
  * @param[in] protocol Protocol of the socket. See Calypso_ATSocket_Protocol_t
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsCreate(char* pAtCommand, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol)
+static bool Calypso_ATSocket_AddArgumentsCreate(ATCommand_Builder_t* pBuilder, Calypso_ATSocket_Family_t family, Calypso_ATSocket_Type_t type, Calypso_ATSocket_Protocol_t protocol)
 {
 
     if (family >= Calypso_ATSocket_Family_NumberOfValues)
@@ -470,7 +456,7 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char* pAtCommand, Calypso_ATSock
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketFamilyString[family], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATSocketFamilyString[family], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -480,7 +466,7 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char* pAtCommand, Calypso_ATSock
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketTypeString[type], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATSocketTypeString[type], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -490,50 +476,50 @@ static bool Calypso_ATSocket_AddArgumentsCreate(char* pAtCommand, Calypso_ATSock
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketProcotolString[protocol], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATSocketProcotolString[protocol], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+bind / AT+connect command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] socketID ID of the socket to be bound
  * @param[in] socket Socket configuration. See Calypso_ATSocket_Descriptor_t.
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsBindConnect(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket)
+static bool Calypso_ATSocket_AddArgumentsBindConnect(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t socket)
 {
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!Calypso_ATSocket_AppendSocketDescriptor(pAtCommand, socket, ATCOMMAND_STRING_TERMINATE))
+    if (!Calypso_ATSocket_AppendSocketDescriptor(pBuilder, socket, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+recv command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] socketID ID of the local socket which should receive
  * @param[in] format Format in which the data is to be provided. The module will encode the data and will provide it in this format.
  * @param[in] length Max number of bytes to receive
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsRecv(char* pAtCommand, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length)
+static bool Calypso_ATSocket_AddArgumentsRecv(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_DataFormat_t format, uint16_t length)
 {
 
     if (format >= Calypso_DataFormat_NumberOfValues)
@@ -541,28 +527,28 @@ static bool Calypso_ATSocket_AddArgumentsRecv(char* pAtCommand, uint8_t socketID
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+recvFrom command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] socketID ID of the local socket which should receive
  * @param[in] socketFrom Remote socket from which the data should be received
  * @param[in] format Format in which the data is to be provided. The module will encode the data and will provide it in this format.
@@ -570,86 +556,78 @@ static bool Calypso_ATSocket_AddArgumentsRecv(char* pAtCommand, uint8_t socketID
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsRecvFrom(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length)
+static bool Calypso_ATSocket_AddArgumentsRecvFrom(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t socketFrom, Calypso_DataFormat_t format, uint16_t length)
 {
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!Calypso_ATSocket_AppendSocketDescriptor(pAtCommand, socketFrom, ATCOMMAND_ARGUMENT_DELIM))
+    if (!Calypso_ATSocket_AppendSocketDescriptor(pBuilder, socketFrom, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, length < CALYPSO_MAX_PAYLOAD_SIZE ? length : CALYPSO_MAX_PAYLOAD_SIZE, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+send or AT+sendTo command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * The command is terminated by the argument delimiter preceding the payload, which
+ * is sent separately using Calypso_SendRequestPayload().
+ *
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] socketID ID of the local socket via which the data should be sent
  * @param[in] remoteSocket Remote socket to which the data should be sent. Optional (to be used with AT+sendTo).
  * @param[in] format Format in which the data is provided
  * @param[in] length Number of bytes to be sent
- * @param[in] data Data to be sent
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsSendTo(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_Descriptor_t* remoteSocket, Calypso_DataFormat_t format, uint16_t length, char* data)
+static bool Calypso_ATSocket_AddArgumentsSendTo(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_Descriptor_t* remoteSocket, Calypso_DataFormat_t format, uint16_t length)
 {
     if (format >= Calypso_DataFormat_NumberOfValues)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (NULL != remoteSocket)
     {
-        if (!Calypso_ATSocket_AppendSocketDescriptor(pAtCommand, *remoteSocket, ATCOMMAND_ARGUMENT_DELIM))
+        if (!Calypso_ATSocket_AppendSocketDescriptor(pBuilder, *remoteSocket, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pAtCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentBytes(pAtCommand, data, length, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendInt(pBuilder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM);
 }
 
 /**
  * @brief Adds arguments to the AT+setSockOpt command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] socketID ID of the local socket for which options should be set
  * @param[in] level Option level parameter
  * @param[in] option Option parameter
@@ -657,22 +635,22 @@ static bool Calypso_ATSocket_AddArgumentsSendTo(char* pAtCommand, uint8_t socket
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t* pValues)
+static bool Calypso_ATSocket_AddArgumentsSetSockOpt(ATCommand_Builder_t* pBuilder, uint8_t socketID, Calypso_ATSocket_SockOptLevel_t level, uint8_t option, Calypso_ATSocket_Options_t* pValues)
 {
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, socketID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATSocketSockOptLevelString[level], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     if (Calypso_ATSocket_SockOptLevel_Socket == level)
     {
-        if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptSocketString[option], ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ATSocketSockOptSocketString[option], ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -680,60 +658,60 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
         switch (option)
         {
             case Calypso_ATSocket_SockOptSocket_KeepAlive:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAlive, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->keepAlive, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_KeepAliveTime:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->keepAliveTimeSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->keepAliveTimeSeconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_RXNoIPBoundary:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rxNoIpBoundary, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->rxNoIpBoundary, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_RCVTimeout:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvTimeout.seconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->rcvTimeout.seconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvTimeout.microseconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->rcvTimeout.microseconds, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_RCVBuf:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->rcvBuf, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->rcvBuf, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_NonBlocking:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->nonBlocking, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->nonBlocking, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_SecMethod:
-                if (!ATCommand_AppendArgumentString(pAtCommand, AtSocketSockOptSecMethod[pValues->secMethod], ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendString(pBuilder, AtSocketSockOptSecMethod[pValues->secMethod], ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_SecureMask:
-                if (!Calypso_ATSocket_AppendCipherMask(pAtCommand, pValues->secureMask))
+                if (!Calypso_ATSocket_AppendCipherMask(pBuilder, pValues->secureMask))
                 {
                     return false;
                 }
@@ -744,21 +722,21 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
             case Calypso_ATSocket_SockOptSocket_SecureFilesCertificateFileName:
             case Calypso_ATSocket_SockOptSocket_SecureFilesDHKeyFileName:
                 /* File name strings to append */
-                if (!ATCommand_AppendArgumentString(pAtCommand, pValues->fileName, ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendString(pBuilder, pValues->fileName, ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_SecureDomainNameVerification:
-                if (!ATCommand_AppendArgumentString(pAtCommand, pValues->secureDomainNameVerification, ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendString(pBuilder, pValues->secureDomainNameVerification, ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
                 break;
 
             case Calypso_ATSocket_SockOptSocket_DisableCertificateStore:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->disableCertificateStore, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->disableCertificateStore, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -773,7 +751,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
     }
     else if (Calypso_ATSocket_SockOptLevel_IP == level)
     {
-        if (!ATCommand_AppendArgumentString(pAtCommand, ATSocketSockOptIPString[option], ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendString(pBuilder, ATSocketSockOptIPString[option], ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -781,7 +759,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
         switch (option)
         {
             case Calypso_ATSocket_SockOptIP_MulticastTTL:
-                if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->multicastTTL, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, pValues->multicastTTL, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -789,11 +767,11 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
 
             case Calypso_ATSocket_SockOptIP_AddMembership:
             case Calypso_ATSocket_SockOptIP_DropMembership:
-                if (!ATCommand_AppendArgumentString(pAtCommand, pValues->multicastGroup.ipv4Address, ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendString(pBuilder, pValues->multicastGroup.ipv4Address, ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
-                if (!ATCommand_AppendArgumentString(pAtCommand, pValues->multicastGroup.interfaceAddress, ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendString(pBuilder, pValues->multicastGroup.interfaceAddress, ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -809,7 +787,7 @@ static bool Calypso_ATSocket_AddArgumentsSetSockOpt(char* pAtCommand, uint8_t so
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -1005,4 +983,4 @@ bool Calypso_ATSocket_GetSocketFamilyString(Calypso_ATSocket_Family_t family, ch
     return true;
 }
 
-bool Calypso_ATSocket_AppendCipherMask(char* pOutStr, uint32_t cipherMask) { return ATCommand_AppendArgumentBitmask(pOutStr, Calypso_ATSocket_CipherStrings, Calypso_ATSocket_Cipher_NumberOfValues, cipherMask, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE); }
+bool Calypso_ATSocket_AppendCipherMask(ATCommand_Builder_t* pBuilder, uint32_t cipherMask) { return ATCommand_Builder_AppendBitmask(pBuilder, Calypso_ATSocket_CipherStrings, Calypso_ATSocket_Cipher_NumberOfValues, cipherMask, ATCOMMAND_STRING_TERMINATE); }
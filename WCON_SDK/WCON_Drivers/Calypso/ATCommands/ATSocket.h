@@ -409,21 +409,21 @@ extern bool Calypso_ATSocket_GetSocketFamilyString(Calypso_ATSocket_Family_t fam
 /**
  * @brief Adds socket descriptor arguments to the AT command string.
  *
- * @param[out] pAtCommand: The AT command string to add the arguments to
+ * @param[in,out] pBuilder: Builder of the AT command to add the arguments to
  * @param[in] socket: Socket information to append
  * @param[in] lastDelim: Delimiter to append after the last argument
  *
  * @return True if successful, false otherwise
  */
-extern bool Calypso_ATSocket_AppendSocketDescriptor(char* pAtCommand, Calypso_ATSocket_Descriptor_t socket, char lastDelim);
+extern bool Calypso_ATSocket_AppendSocketDescriptor(ATCommand_Builder_t* pBuilder, Calypso_ATSocket_Descriptor_t socket, char lastDelim);
 
 /**
- * @brief Appends cipher mask flags to the supplied string.
+ * @brief Appends cipher mask flags to an AT command.
  *
- * @param[out] pOutStr: The string to which the flags should be added (must be null terminated)
+ * @param[in,out] pBuilder: Builder of the AT command to which the flags should be added
  * @param[in] cipherMask: Cipher mask flags (see Calypso_ATSocket_Cipher_t)
  */
-extern bool Calypso_ATSocket_AppendCipherMask(char* pOutStr, uint32_t cipherMask);
+extern bool Calypso_ATSocket_AppendCipherMask(ATCommand_Builder_t* pBuilder, uint32_t cipherMask);
 
 #ifdef __cplusplus
 }
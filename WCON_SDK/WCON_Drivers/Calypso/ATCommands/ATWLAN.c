@@ -80,9 +80,9 @@ static const char* Calypso_ATWLAN_SecurityStatusStrings[Calypso_ATWLAN_SecurityS
 static bool Calypso_ATWLAN_IsInputValidWlanGet(Calypso_ATWLAN_SetID_t id, uint8_t option);
 static bool Calypso_ATWLAN_IsInputValidWlanSet(Calypso_ATWLAN_SetID_t id, uint8_t option);
 
-static bool Calypso_ATWLAN_AddConnectionArguments(char* pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
-static bool Calypso_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option);
-static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t* pValues);
+static bool Calypso_ATWLAN_AddConnectionArguments(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
+static bool Calypso_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_SetID_t id, uint8_t option);
+static bool Calypso_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t* pValues);
 
 static bool Calypso_ATWLAN_ParseResponseWlanScanEntry(char** pAtCommand, Calypso_ATWLAN_ScanEntry_t* pOutScanEntry);
 static bool Calypso_ATWLAN_ParseResponseWlanAddProfile(char** pAtCommand, uint8_t* pOutIndex);
@@ -100,15 +100,16 @@ bool Calypso_ATWLAN_SetMode(Calypso_ATWLAN_SetMode_t mode)
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanSetMode=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanSetMode=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_SetModeStrings[mode], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_SetModeStrings[mode], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -128,21 +129,22 @@ bool Calypso_ATWLAN_Scan(uint8_t index, uint8_t deviceCount, Calypso_ATWLAN_Scan
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanScan=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanScan=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -173,15 +175,16 @@ bool Calypso_ATWLAN_Connect(Calypso_ATWLAN_ConnectionArguments_t connectArgs)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanConnect=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanConnect=");
 
-    if (!Calypso_ATWLAN_AddConnectionArguments(pRequestCommand, connectArgs, ATCOMMAND_STRING_TERMINATE))
+    if (!Calypso_ATWLAN_AddConnectionArguments(&builder, connectArgs, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -212,21 +215,22 @@ bool Calypso_ATWLAN_AddProfile(Calypso_ATWLAN_Profile_t profile, uint8_t* pOutIn
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanProfileAdd=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileAdd=");
 
-    if (!Calypso_ATWLAN_AddConnectionArguments(pRequestCommand, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
+    if (!Calypso_ATWLAN_AddConnectionArguments(&builder, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -253,16 +257,17 @@ bool Calypso_ATWLAN_GetProfile(uint8_t index, Calypso_ATWLAN_Profile_t* pOutProf
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanProfileGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileGet=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -283,15 +288,16 @@ bool Calypso_ATWLAN_DeleteProfile(uint8_t index)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanProfileDel=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileDel=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -315,11 +321,12 @@ bool Calypso_ATWLAN_Get(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanGet=");
 
-    if (!Calypso_ATWLAN_AddArgumentsWlanGet(pRequestCommand, id, option))
+    if (!Calypso_ATWLAN_AddArgumentsWlanGet(&builder, id, option))
     {
         return false;
     }
@@ -345,10 +352,11 @@ bool Calypso_ATWLAN_Set(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanSet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanSet=");
 
-    if (!Calypso_ATWLAN_AddArgumentsWlanSet(pRequestCommand, id, option, pValues))
+    if (!Calypso_ATWLAN_AddArgumentsWlanSet(&builder, id, option, pValues))
     {
         return false;
     }
@@ -364,20 +372,21 @@ bool Calypso_ATWLAN_Set(Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLA
 bool Calypso_ATWLAN_SetConnectionPolicy(uint8_t policy)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, Calypso_ATWLAN_PolicyConnectionStrings, Calypso_ATWLAN_PolicyConnection_NumberOfValues, policy, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(&builder, Calypso_ATWLAN_PolicyConnectionStrings, Calypso_ATWLAN_PolicyConnection_NumberOfValues, policy, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -412,22 +421,23 @@ bool Calypso_ATWLAN_GetConnectionPolicy(uint8_t* policy)
 bool Calypso_ATWLAN_SetScanPolicy(Calypso_ATWLAN_PolicyScan_t policy, uint32_t scanIntervalSeconds)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -469,22 +479,23 @@ bool Calypso_ATWLAN_GetScanPolicy(Calypso_ATWLAN_PolicyScan_t* policy, uint32_t*
 bool Calypso_ATWLAN_SetPMPolicy(Calypso_ATWLAN_PolicyPM_t policy, uint32_t maxSleepTimeMs)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -526,22 +537,23 @@ bool Calypso_ATWLAN_GetPMPolicy(Calypso_ATWLAN_PolicyPM_t* policy, uint32_t* max
 bool Calypso_ATWLAN_SetP2PPolicy(Calypso_ATWLAN_PolicyP2P_t policy, Calypso_ATWLAN_PolicyP2PValue_t value)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyStrings[Calypso_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -605,16 +617,17 @@ bool Calypso_ATWLAN_SendPolicyGet(Calypso_ATWLAN_PolicyID_t id, char** pRespondC
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     *pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanPolicyGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicyGet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, Calypso_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, Calypso_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -718,61 +731,61 @@ static bool Calypso_ATWLAN_IsInputValidWlanSet(Calypso_ATWLAN_SetID_t id, uint8_
 /**
  * @brief Adds arguments to the connection command string.
  *
- * @param[out] pOutString The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] connectionArgs The connection parameters
  * @param[in] lastDelim The delimiter to add after the last argument.
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddConnectionArguments(char* pOutString, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
+static bool Calypso_ATWLAN_AddConnectionArguments(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
 {
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, Calypso_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pOutString, Calypso_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
+    return ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
 }
 
 /**
  * @brief Adds arguments to the AT+wlanGet command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id ID of the value to get
  * @param[in] option Option of the value to get
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option)
+static bool Calypso_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_SetID_t id, uint8_t option)
 {
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -780,28 +793,28 @@ static bool Calypso_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, Calypso_ATWLAN_
     switch (id)
     {
         case Calypso_ATWLAN_SetID_General:
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATWLAN_SetID_P2P:
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATWLAN_SetID_Connection:
-            if (!ATCommand_AppendArgumentString(pAtCommand, "", ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, "", ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
             break;
 
         case Calypso_ATWLAN_SetID_AccessPoint:
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -811,23 +824,23 @@ static bool Calypso_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, Calypso_ATWLAN_
             return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+wlanSet command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id ID of the value to set
  * @param[in] option Option of the value to set
  * @param[in] pValues Values to set
  *
  * @return true if successful, false otherwise
  */
-static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t* pValues)
+static bool Calypso_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t* pBuilder, Calypso_ATWLAN_SetID_t id, uint8_t option, Calypso_ATWLAN_Settings_t* pValues)
 {
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -836,7 +849,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
     {
         case Calypso_ATWLAN_SetID_General:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -844,46 +857,46 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
             switch (option)
             {
                 case Calypso_ATWLAN_SetGeneral_CountryCode:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetGeneral_StationTxPower:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetGeneral_AccessPointTxPower:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.apTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.apTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetGeneral_ScanParams:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetGeneral_SuspendProfiles:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetGeneral_DisableEntServerAuth:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -900,7 +913,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
 
         case Calypso_ATWLAN_SetID_P2P:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetP2PStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -912,22 +925,22 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
 
             Calypso_ATWLAN_P2PChannelNRegs_t* pChannelNRegs = &pValues->p2p.p2pChannelNRegs;
 
-            if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->listenChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(pBuilder, pChannelNRegs->listenChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->listenRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(pBuilder, pChannelNRegs->listenRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->operatingChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendInt(pBuilder, pChannelNRegs->operatingChannel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
 
-            if (!ATCommand_AppendArgumentInt(pAtCommand, pChannelNRegs->operatingRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendInt(pBuilder, pChannelNRegs->operatingRegulatoryClass, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -937,7 +950,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
 
         case Calypso_ATWLAN_SetID_AccessPoint:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_SetGetAPStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -948,47 +961,47 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
                     if (Calypso_firmwareVersionMajor > 1 || (Calypso_firmwareVersionMajor == 1 && Calypso_firmwareVersionMinor >= 9))
                     {
                         /* Starting with firmware version 1.9.0, there is an appendMac argument */
-                        if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.ssidConfig.appendMac ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
+                        if (!ATCommand_Builder_AppendString(pBuilder, pValues->ap.ssidConfig.appendMac ? "true" : "false", ATCOMMAND_ARGUMENT_DELIM))
                         {
                             return false;
                         }
                     }
-                    if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.ssidConfig.ssid, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, pValues->ap.ssidConfig.ssid, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetAP_Channel:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->ap.channel, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetAP_HiddenSSID:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.hiddenSSID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->ap.hiddenSSID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetAP_Security:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, Calypso_ATWLAN_APSecurityTypeStrings[pValues->ap.security], ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, Calypso_ATWLAN_APSecurityTypeStrings[pValues->ap.security], ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetAP_Password:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, pValues->ap.password, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, pValues->ap.password, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case Calypso_ATWLAN_SetAP_MaxStations:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->ap.maxStations, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->ap.maxStations, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1009,7 +1022,7 @@ static bool Calypso_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, Calypso_ATWLAN_
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
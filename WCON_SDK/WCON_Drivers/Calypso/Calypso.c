@@ -58,6 +58,23 @@ static char Calypso_pendingCommandName[64] = {0};
  */
 static size_t Calypso_pendingCommandNameLength = 0;
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Performance counters and latency histograms (see Calypso_GetStatistics()).
+ */
+static WE_Stats_t Calypso_stats = {0};
+
+/**
+ * @brief Time the pending request has been sent (see Calypso_SendRequest()).
+ */
+static uint32_t Calypso_requestStartUs = 0;
+
+/**
+ * @brief Is true as long as the latency of the pending request hasn't been recorded.
+ */
+static bool Calypso_requestTimed = false;
+#endif
+
 /**
  * @brief Buffer used for current response text.
  */
@@ -121,7 +138,8 @@ static uint8_t Calypso_eolChar2 = '\n';
 static bool Calypso_twoEolCharacters = true;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from Calypso.
+ * @brief Time step (microseconds) when waiting for responses from Calypso
+ * (maximum time between two checks, waiting ends as soon as the confirmation has been received).
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
@@ -129,6 +147,11 @@ static bool Calypso_twoEolCharacters = true;
  */
 static uint32_t Calypso_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is signaled when a confirmation has been received from Calypso.
+ */
+static WE_Event_t Calypso_confirmEvent = {0};
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to Calypso
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -193,6 +216,28 @@ Calypso_EventCallback_t Calypso_eventCallback;
  */
 static bool Calypso_executingEventCallback = false;
 
+/**
+ * @brief Serializes the access of several threads to the module (see Calypso_Lock()).
+ */
+static WE_Mutex_t Calypso_requestMutex = NULL;
+
+#if defined(WE_AT_RX_TASK)
+/**
+ * @brief Receive task, which executes the byte handler (see Calypso_SetByteRxCallback()) if supported by the platform.
+ */
+static ATCommand_RxTask_t Calypso_rxTask = {0};
+
+/**
+ * @brief Queues received data for the receive task.
+ */
+static void Calypso_EnqueueRxBytes(uint8_t* dataP, size_t size) { ATCommand_RxTask_Enqueue(&Calypso_rxTask, dataP, size); }
+
+/**
+ * @brief Byte handler passed to the UART if the receive task is running.
+ */
+static WE_UART_HandleRxByte_t Calypso_uartRxCallback = Calypso_EnqueueRxBytes;
+#endif
+
 /**
  * @brief Callback function which is executed if a single byte has been received from Calypso.
  * The default callback is Calypso_HandleRxByte().
@@ -219,6 +264,9 @@ static WE_UART_t* Calypso_uartP = NULL;
 bool Calypso_Init(WE_UART_t* uartP, Calypso_Pins_t* pinoutP, Calypso_EventCallback_t eventCallback)
 {
     Calypso_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&Calypso_stats);
+#endif
 
     /* Callbacks */
     byteRxCallback = Calypso_HandleRxByte;
@@ -263,7 +311,21 @@ bool Calypso_Init(WE_UART_t* uartP, Calypso_Pins_t* pinoutP, Calypso_EventCallba
     }
 
     Calypso_uartP = uartP;
-    if (false == Calypso_uartP->uartInit(Calypso_uartP->baudrate, Calypso_uartP->flowControl, Calypso_uartP->parity, &byteRxCallback))
+
+    if ((NULL == Calypso_requestMutex) && !WE_Mutex_Create(&Calypso_requestMutex))
+    {
+        return false;
+    }
+
+    WE_UART_HandleRxByte_t* uartRxCallbackP = &byteRxCallback;
+#if defined(WE_AT_RX_TASK)
+    if (ATCommand_RxTask_Start(&Calypso_rxTask, &byteRxCallback, "Calypso_RX"))
+    {
+        /* Received data is passed to the byte handler by the receive task */
+        uartRxCallbackP = &Calypso_uartRxCallback;
+    }
+#endif
+    if (false == Calypso_uartP->uartInit(Calypso_uartP->baudrate, Calypso_uartP->flowControl, Calypso_uartP->parity, uartRxCallbackP))
     {
         return false;
     }
@@ -343,9 +405,18 @@ bool Calypso_PinWakeUp(void)
 
 bool Calypso_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP) { return WE_GetPinLevel(pin, pin_levelP); }
 
+bool Calypso_Lock(uint32_t timeoutMs) { return WE_Mutex_Lock(Calypso_requestMutex, timeoutMs); }
+
+void Calypso_Unlock(void) { WE_Mutex_Unlock(Calypso_requestMutex); }
+
 bool Calypso_SendRequest(char* data)
 {
+#if defined(WE_AT_RX_TASK)
+    /* If running, the receive task executes the event callbacks - other threads may send requests in the meantime */
+    if (Calypso_executingEventCallback && ATCommand_RxTask_IsCurrentContext(&Calypso_rxTask))
+#else
     if (Calypso_executingEventCallback)
+#endif
     {
         /* Don't allow sending AT commands from event handlers, as this will
          * mess up send/receive states and buffers. */
@@ -382,20 +453,115 @@ bool Calypso_SendRequest(char* data)
 
     WE_DEBUG_PRINT_DEBUG("> %s", data);
 
+#if defined(WE_STATS_ENABLED)
+    Calypso_stats.txFrames++;
+    WE_STATS_START_REQUEST(Calypso_requestStartUs);
+    Calypso_requestTimed = true;
+#endif
     Calypso_Transparent_Transmit(data, dataLength);
 
     return true;
 }
 
+/**
+ * @brief Transmits the payload of a request and the terminating "\r\n" (see Calypso_SendRequestPayload()).
+ */
+static bool Calypso_TransmitRequestPayload(const uint8_t* data, uint16_t dataLength, bool encodeAsBase64)
+{
+    if ((data == NULL) && (dataLength > 0))
+    {
+        return false;
+    }
+
+    if (!encodeAsBase64)
+    {
+        if ((dataLength > 0) && !Calypso_Transparent_Transmit((const char*)data, dataLength))
+        {
+            return false;
+        }
+        return Calypso_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+    }
+
+    /* Encode the payload block-wise, so that only a single block has to be buffered */
+    uint8_t block[CALYPSO_BASE64_ENCODE_BLOCK_SIZE];
+    Base64_Encoder_t encoder;
+    Base64_EncodeInit(&encoder);
+
+    for (uint16_t offset = 0; offset < dataLength;)
+    {
+        uint16_t inLength = dataLength - offset;
+        if (inLength > (CALYPSO_BASE64_ENCODE_BLOCK_SIZE / 4) * 3)
+        {
+            inLength = (CALYPSO_BASE64_ENCODE_BLOCK_SIZE / 4) * 3;
+        }
+
+        uint32_t outLength = sizeof(block);
+        if (!Base64_EncodeUpdate(&encoder, data + offset, inLength, block, &outLength))
+        {
+            return false;
+        }
+        if ((outLength > 0) && !Calypso_Transparent_Transmit((const char*)block, outLength))
+        {
+            return false;
+        }
+        offset += inLength;
+    }
+
+    uint32_t outLength = sizeof(block);
+    if (!Base64_EncodeFinal(&encoder, block, &outLength))
+    {
+        return false;
+    }
+    if ((outLength > 0) && !Calypso_Transparent_Transmit((const char*)block, outLength))
+    {
+        return false;
+    }
+
+    return Calypso_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+}
+
+bool Calypso_SendRequestPayload(const uint8_t* data, uint16_t dataLength, bool encodeAsBase64)
+{
+    if (Calypso_TransmitRequestPayload(data, dataLength, encodeAsBase64))
+    {
+        return true;
+    }
+
+    /* The module has received an incomplete request - don't wait for a confirmation of it */
+    Calypso_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    Calypso_requestTimed = false;
+#endif
+    return false;
+}
+
 bool Calypso_Transparent_Transmit(const char* data, uint16_t dataLength)
 {
     if ((data == NULL) || (dataLength == 0))
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&Calypso_stats, dataLength, false);
     return Calypso_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+#if defined(WE_STATS_ENABLED)
+bool Calypso_GetStatistics(WE_Stats_t* statsP)
+{
+    if (!WE_Stats_Snapshot(&Calypso_stats, Calypso_uartP, statsP))
+    {
+        return false;
+    }
+#if defined(WE_AT_RX_TASK)
+    /* Data discarded by the receive task counts as receive overflow as well */
+    statsP->rxDroppedBytes += Calypso_rxTask.droppedBytes;
+#endif
+    return true;
+}
+
+void Calypso_ResetStatistics() { WE_Stats_Reset(&Calypso_stats); }
+#endif
+
 bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStatus, char* pOutResponse)
 {
     Calypso_cmdConfirmStatus = Calypso_CNFStatus_Invalid;
@@ -435,10 +601,12 @@ bool Calypso_WaitForConfirm(uint32_t maxTimeMs, Calypso_CNFStatus_t expectedStat
 
         if (Calypso_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(Calypso_waitTimeStepUsec);
+            /* Returns as soon as the confirmation has been received */
+            WE_WaitEvent(&Calypso_confirmEvent, (Calypso_waitTimeStepUsec + 999) / 1000);
         }
     }
 
+    WE_STATS_ADD(&Calypso_stats, timeouts, 1);
     Calypso_requestPending = false;
     return false;
 }
@@ -485,6 +653,8 @@ uint32_t Calypso_GetTimeout(Calypso_Timeout_t type) { return Calypso_timeouts[ty
  */
 static void Calypso_HandleRxByte(uint8_t* dataP, size_t size)
 {
+    WE_STATS_ADD(&Calypso_stats, rxBytes, size);
+
     uint8_t receivedByte;
     for (; size > 0; size--, dataP++)
     {
@@ -505,6 +675,7 @@ static void Calypso_HandleRxByte(uint8_t* dataP, size_t size)
         {
             if (Calypso_rxByteCounter >= CALYPSO_LINE_MAX_SIZE)
             {
+                WE_STATS_ADD(&Calypso_stats, parseErrors, 1);
                 Calypso_rxByteCounter = 0;
                 Calypso_eolChar1Found = false;
                 return;
@@ -552,6 +723,8 @@ static void Calypso_HandleRxByte(uint8_t* dataP, size_t size)
  */
 static void Calypso_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
+    WE_STATS_ADD(&Calypso_stats, rxFrames, 1);
+
     WE_DEBUG_PRINT_DEBUG("< %s\r\n", rxPacket);
 
     /* Check if a custom line rx callback is specified and call it if so */
@@ -620,6 +793,20 @@ static void Calypso_HandleRxLine(char* rxPacket, uint16_t rxLength)
                 Calypso_currentResponseLength += chunkLength;
             }
         }
+
+        if (Calypso_CNFStatus_Invalid != Calypso_cmdConfirmStatus)
+        {
+#if defined(WE_STATS_ENABLED)
+            if (Calypso_requestTimed)
+            {
+                Calypso_requestTimed = false;
+                WE_STATS_COMPLETE_REQUEST(&Calypso_stats, WE_Stats_Hash(Calypso_pendingCommandName, Calypso_pendingCommandNameLength), Calypso_pendingCommandName, Calypso_requestStartUs);
+            }
+#endif
+
+            /* Wake up Calypso_WaitForConfirm() */
+            WE_SignalEvent(&Calypso_confirmEvent);
+        }
     }
 
     if ('+' == rxPacket[0])
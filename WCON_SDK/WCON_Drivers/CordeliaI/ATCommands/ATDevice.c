@@ -59,8 +59,8 @@ static const char* CordeliaI_ATDevice_StatusFlagsStrings[CordeliaI_ATDevice_Stat
 
 static bool CordeliaI_ATDevice_IsInputValidATget(CordeliaI_ATDevice_GetId_t id, uint8_t option);
 static bool CordeliaI_ATDevice_IsInputValidATset(CordeliaI_ATDevice_GetId_t id, uint8_t option);
-static bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t option);
-static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uint8_t option, void* pValue);
+static bool CordeliaI_ATDevice_AddArgumentsATget(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option);
+static bool CordeliaI_ATDevice_AddArgumentsATset(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option, void* pValue);
 static bool CordeliaI_ATDevice_ParseResponseATget(uint8_t id, uint8_t option, char* pAtCommand, void* pValue);
 
 bool CordeliaI_ATDevice_Test()
@@ -107,14 +107,17 @@ bool CordeliaI_ATDevice_Stop(uint32_t timeoutMs)
         return false;
     }
 
-    char cmdToSend[32] = "AT+stop=";
+    char cmdToSend[32];
+    ATCommand_Builder_t builder;
 
-    if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC)))
+    ATCommand_Builder_Init(&builder, cmdToSend, sizeof(cmdToSend), "AT+stop=");
+
+    if (!ATCommand_Builder_AppendInt(&builder, timeoutMs, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -169,14 +172,17 @@ bool CordeliaI_ATDevice_Hibernate(uint32_t timeoutSeconds)
         return false;
     }
 
-    char cmdToSend[32] = "AT+hibernate=";
+    char cmdToSend[32];
+    ATCommand_Builder_t builder;
+
+    ATCommand_Builder_Init(&builder, cmdToSend, sizeof(cmdToSend), "AT+hibernate=");
 
-    if (!ATCommand_IntToString(&cmdToSend[strlen(cmdToSend)], timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC)))
+    if (!ATCommand_Builder_AppendInt(&builder, timeoutSeconds, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(cmdToSend, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -196,11 +202,12 @@ bool CordeliaI_ATDevice_Get(CordeliaI_ATDevice_GetId_t id, uint8_t option, void*
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pResponseCommand = AT_commandBuffer;
     uint32_t timeout;
-    strcpy(pRequestCommand, "AT+get=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+get=");
 
-    if (!CordeliaI_ATDevice_AddArgumentsATget(&pRequestCommand[strlen(pRequestCommand)], id, option))
+    if (!CordeliaI_ATDevice_AddArgumentsATget(&builder, id, option))
     {
         return false;
     }
@@ -250,10 +257,11 @@ bool CordeliaI_ATDevice_Set(CordeliaI_ATDevice_GetId_t id, uint8_t option, void*
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+set=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+set=");
 
-    if (!CordeliaI_ATDevice_AddArgumentsATset(&pRequestCommand[strlen(pRequestCommand)], id, option, pValue))
+    if (!CordeliaI_ATDevice_AddArgumentsATset(&builder, id, option, pValue))
     {
         return false;
     }
@@ -268,18 +276,19 @@ bool CordeliaI_MQTT_Publish(CordeliaI_MQTT_PublishArguments_t publishArgs)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+iotpublish=");
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint8_t)publishArgs.topicNo, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+iotpublish=");
+    if (!ATCommand_Builder_AppendInt(&builder, (uint8_t)publishArgs.topicNo, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, publishArgs.Message, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, publishArgs.Message, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -417,14 +426,14 @@ bool CordeliaI_ATDevice_IsInputValidATget(CordeliaI_ATDevice_GetId_t id, uint8_t
 /**
  * @brief Adds the arguments to the AT+get command string.
  *
- * @param[out] pAtCommand The AT request command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id The ID of the argument to be added
  * @param[in] option The option to add
  * @return true if arguments were added successfully, false otherwise
  */
-bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t option)
+bool CordeliaI_ATDevice_AddArgumentsATget(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option)
 {
-    if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -433,7 +442,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
     {
         case CordeliaI_ATDevice_GetId_General:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -441,7 +450,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_IOT:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetIotStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -449,7 +458,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_MQTT:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetMQTTStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetMQTTStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -457,7 +466,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_CSR:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetCSRStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetCSRStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -465,7 +474,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_Quarklink:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetQuarklinkStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetQuarklinkStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -473,7 +482,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_OTA:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetOTAStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetOTAStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -484,7 +493,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         case CordeliaI_ATDevice_GetId_PubTopic2:
         case CordeliaI_ATDevice_GetId_PubTopic3:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetPubTopicStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetPubTopicStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -495,7 +504,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         case CordeliaI_ATDevice_GetId_SubTopic2:
         case CordeliaI_ATDevice_GetId_SubTopic3:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetSubTopicStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetSubTopicStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -503,7 +512,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
         case CordeliaI_ATDevice_GetId_UART:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetUartStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -515,7 +524,7 @@ bool CordeliaI_ATDevice_AddArgumentsATget(char* pAtCommand, uint8_t id, uint8_t
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
@@ -1070,15 +1079,15 @@ static bool CordeliaI_ATDevice_IsInputValidATset(CordeliaI_ATDevice_GetId_t id,
  *
  * @param[in] id The id of the arguments to add
  * @param[in] option The option to add
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[out] pValues Parsed values
  * @return true if arguments were added successful, false otherwise
  */
-static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, uint8_t option, void* pValue)
+static bool CordeliaI_ATDevice_AddArgumentsATset(ATCommand_Builder_t* pBuilder, uint8_t id, uint8_t option, void* pValue)
 {
 
     /* add id */
-    if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetIdStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -1087,7 +1096,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
 
         case CordeliaI_ATDevice_GetId_CSR:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetCSRStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetCSRStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1101,7 +1110,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetCSR_Organization:
                 case CordeliaI_ATDevice_GetCSR_Unit:
                 case CordeliaI_ATDevice_GetCSR_Email:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1118,7 +1127,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         case CordeliaI_ATDevice_GetId_PubTopic2:
         case CordeliaI_ATDevice_GetId_PubTopic3:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetPubTopicStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetPubTopicStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1128,7 +1137,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
 
                 case CordeliaI_ATDevice_GetPubTopic_Name:
                 {
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1136,7 +1145,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 }
                 case CordeliaI_ATDevice_GetPubTopic_Qos:
                 {
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1144,7 +1153,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 }
                 case CordeliaI_ATDevice_GetPubTopic_Retain:
                 {
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, *((bool*)pValue), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, *((bool*)pValue), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1162,7 +1171,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         case CordeliaI_ATDevice_GetId_SubTopic2:
         case CordeliaI_ATDevice_GetId_SubTopic3:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetSubTopicStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetSubTopicStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1171,7 +1180,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
             {
                 case CordeliaI_ATDevice_GetSubTopic_Name:
                 {
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1179,7 +1188,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 }
                 case CordeliaI_ATDevice_GetSubTopic_Qos:
                 {
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1194,7 +1203,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         }
         case CordeliaI_ATDevice_GetId_Quarklink:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetQuarklinkStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetQuarklinkStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1204,7 +1213,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetQuarklink_Hostname:
                 case CordeliaI_ATDevice_GetQuarklink_RootCAPath:
                 {
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1212,7 +1221,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 }
                 case CordeliaI_ATDevice_GetQuarklink_Port:
                 {
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, *((uint32_t*)pValue), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, *((uint32_t*)pValue), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1227,7 +1236,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         }
         case CordeliaI_ATDevice_GetId_OTA:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetOTAStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetOTAStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1238,7 +1247,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetOTA_RootCAPath:
                 case CordeliaI_ATDevice_GetOTA_FirmwareVersion:
                 {
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1253,7 +1262,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         }
         case CordeliaI_ATDevice_GetId_MQTT:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetMQTTStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetMQTTStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1271,7 +1280,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetMQTT_UserName:
                 case CordeliaI_ATDevice_GetMQTT_Password:
                 {
-                    if (!ATCommand_AppendArgumentString(pAtCommand, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, (char*)pValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1280,7 +1289,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetMQTT_IotHubPort:
                 case CordeliaI_ATDevice_GetMQTT_KeepAliveTimeOut:
                 {
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, *((uint32_t*)pValue), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, *((uint32_t*)pValue), ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1288,7 +1297,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 }
                 case CordeliaI_ATDevice_GetMQTT_WillQos:
                 {
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, *((uint8_t*)pValue), ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1299,7 +1308,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetMQTT_WillRetain:
                 case CordeliaI_ATDevice_GetMQTT_CleanConnect:
                 {
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, *((bool*)pValue), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, *((bool*)pValue), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1315,7 +1324,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         }
         case CordeliaI_ATDevice_GetId_UART:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATDevice_ATGetUartStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -1325,7 +1334,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetUart_Baudrate:
                 {
                     uint32_t baudValue = *((uint32_t*)pValue);
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, baudValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, baudValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1334,7 +1343,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetUart_Parity:
                 {
                     CordeliaI_ATDevice_UartParity_t parityValue = *((CordeliaI_ATDevice_UartParity_t*)pValue);
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, parityValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, parityValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1343,7 +1352,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetUart_FlowControl:
                 {
                     bool boolValue = *((bool*)pValue);
-                    if (!ATCommand_AppendArgumentBoolean(pAtCommand, boolValue, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendBoolean(pBuilder, boolValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1352,7 +1361,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetUart_TransparentTrigger:
                 {
                     uint8_t triggerValue = *((uint8_t*)pValue);
-                    if (!ATCommand_AppendArgumentBitmask(pAtCommand, CordeliaI_ATDevice_ATGetTransparentModeUartTriggerStrings, CordeliaI_ATDevice_TransparentModeUartTrigger_NumberOfValues, triggerValue, ATCOMMAND_STRING_TERMINATE, AT_MAX_COMMAND_BUFFER_SIZE))
+                    if (!ATCommand_Builder_AppendBitmask(pBuilder, CordeliaI_ATDevice_ATGetTransparentModeUartTriggerStrings, CordeliaI_ATDevice_TransparentModeUartTrigger_NumberOfValues, triggerValue, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1361,7 +1370,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 case CordeliaI_ATDevice_GetUart_TransparentTimeout:
                 {
                     uint32_t timeoutValue = *((uint32_t*)pValue);
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, timeoutValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, timeoutValue, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1371,7 +1380,7 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
                 {
                     uint8_t* ETXByteArray = (uint8_t*)pValue;
                     uint16_t etx = ((uint16_t)ETXByteArray[0] << 8) | ETXByteArray[1];
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, etx, (ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -1390,5 +1399,5 @@ static bool CordeliaI_ATDevice_AddArgumentsATset(char* pAtCommand, uint8_t id, u
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
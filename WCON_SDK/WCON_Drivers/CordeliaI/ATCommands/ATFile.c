@@ -35,11 +35,11 @@ static const char* CordeliaI_ATFile_OpenFlags_Strings[CordeliaI_ATFile_OpenFlags
 
 static const char* CordeliaI_ATFile_FileProperties_Strings[CordeliaI_ATFile_FileProperties_NumberOfValues] = {"open_write", "open_read", "must_commit", "bundle_file", "pending_commit", "pending_bundle_commit", "not_failsafe", "not_valid", "sys_file", "secure", "nosignature", "public_write", "public_read"};
 
-static bool CordeliaI_ATFile_AddArgumentsFileOpen(char* pAtCommand, const char* fileName, uint32_t options, uint16_t fileSize);
-static bool CordeliaI_ATFile_AddArgumentsFileClose(char* pAtCommand, uint32_t fileID, const char* certName, const char* signature);
-static bool CordeliaI_ATFile_AddArgumentsFileDel(char* pAtCommand, const char* fileName, uint32_t secureToken);
-static bool CordeliaI_ATFile_AddArgumentsFileRead(char* pAtCommand, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToRead);
-static bool CordeliaI_ATFile_AddArgumentsFileWrite(char* pAtCommand, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToWrite, const char* data);
+static bool CordeliaI_ATFile_AddArgumentsFileOpen(ATCommand_Builder_t* pBuilder, const char* fileName, uint32_t options, uint16_t fileSize);
+static bool CordeliaI_ATFile_AddArgumentsFileClose(ATCommand_Builder_t* pBuilder, uint32_t fileID, const char* certName, const char* signature);
+static bool CordeliaI_ATFile_AddArgumentsFileDel(ATCommand_Builder_t* pBuilder, const char* fileName, uint32_t secureToken);
+static bool CordeliaI_ATFile_AddArgumentsFileRead(ATCommand_Builder_t* pBuilder, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToRead);
+static bool CordeliaI_ATFile_AddArgumentsFileWrite(ATCommand_Builder_t* pBuilder, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToWrite);
 
 static bool CordeliaI_ATFile_ParseResponseFileOpen(char** pAtCommand, uint32_t* fileID, uint32_t* secureToken);
 static bool CordeliaI_ATFile_ParseResponseFileRead(char** pAtCommand, uint16_t bytesToRead, bool decodeBase64, uint16_t* bytesRead, char* data);
@@ -49,11 +49,12 @@ bool CordeliaI_ATFile_Open(const char* fileName, uint32_t options, uint16_t file
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+fileOpen=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileOpen=");
 
-    if (!CordeliaI_ATFile_AddArgumentsFileOpen(pRequestCommand, fileName, options, fileSize))
+    if (!CordeliaI_ATFile_AddArgumentsFileOpen(&builder, fileName, options, fileSize))
     {
         return false;
     }
@@ -74,10 +75,11 @@ bool CordeliaI_ATFile_Close(uint32_t fileID, char* certFileName, char* signature
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+fileClose=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileClose=");
 
-    if (!CordeliaI_ATFile_AddArgumentsFileClose(pRequestCommand, fileID, certFileName, signature))
+    if (!CordeliaI_ATFile_AddArgumentsFileClose(&builder, fileID, certFileName, signature))
     {
         return false;
     }
@@ -93,10 +95,11 @@ bool CordeliaI_ATFile_Close(uint32_t fileID, char* certFileName, char* signature
 bool CordeliaI_ATFile_Delete(const char* fileName, uint32_t secureToken)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+fileDel=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileDel=");
 
-    if (!CordeliaI_ATFile_AddArgumentsFileDel(pRequestCommand, fileName, secureToken))
+    if (!CordeliaI_ATFile_AddArgumentsFileDel(&builder, fileName, secureToken))
     {
         return false;
     }
@@ -122,11 +125,12 @@ bool CordeliaI_ATFile_Read(uint32_t fileID, uint16_t offset, CordeliaI_DataForma
         }
 
         char* pRequestCommand = AT_commandBuffer;
+        ATCommand_Builder_t builder;
         char* pRespondCommand = AT_commandBuffer;
 
-        strcpy(pRequestCommand, "AT+fileRead=");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileRead=");
 
-        if (!CordeliaI_ATFile_AddArgumentsFileRead(pRequestCommand, fileID, offset + chunkOffset, format, chunkSize))
+        if (!CordeliaI_ATFile_AddArgumentsFileRead(&builder, fileID, offset + chunkOffset, format, chunkSize))
         {
             return false;
         }
@@ -156,62 +160,37 @@ bool CordeliaI_ATFile_Write(uint32_t fileID, uint16_t offset, CordeliaI_DataForm
 {
     *bytesWritten = 0;
 
+    /* Base64 encoded data might exceed the max. chunk size, so the raw chunk size is
+     * reduced accordingly. Only the command header is built in AT_commandBuffer - the
+     * payload is streamed from the supplied buffer and encoded on the fly, if requested. */
+    uint16_t maxChunkSize = ATFILE_FILE_MAX_CHUNK_SIZE;
     if (encodeAsBase64)
     {
-        /* Base64 encoded data might exceed the max. chunk size. To limit the required buffer size,
-         * the data is encoded in chunks, if necessary. */
-
-        uint16_t maxChunkSize = (((ATFILE_FILE_MAX_CHUNK_SIZE - 1) * 3) / 4) - 2;
-        uint16_t chunkSize = 0;
-        for (uint16_t chunkOffset = 0; chunkOffset < bytesToWrite; chunkOffset += chunkSize)
-        {
-            chunkSize = bytesToWrite - chunkOffset;
-            if (chunkSize > maxChunkSize)
-            {
-                chunkSize = maxChunkSize;
-            }
-
-            /* Encode as Base64 */
-            uint32_t lengthEncoded;
-            if (!Base64_GetEncBufSize(chunkSize, &lengthEncoded))
-            {
-                return false;
-            }
-
-            char base64Buffer[lengthEncoded];
-            if (!Base64_Encode((uint8_t*)data + chunkOffset, chunkSize, (uint8_t*)base64Buffer, &lengthEncoded))
-            {
-                return false;
-            }
-
-            /* Recursively call CordeliaI_ATFile_Write() with the encoded binary data */
-            uint16_t chunkBytesWritten = 0;
-            bool ok = CordeliaI_ATFile_Write(fileID, offset + chunkOffset, format, false, lengthEncoded, base64Buffer, &chunkBytesWritten);
-            if (!ok)
-            {
-                return false;
-            }
-            *bytesWritten += chunkSize;
-        }
-
-        return true;
+        maxChunkSize = (((ATFILE_FILE_MAX_CHUNK_SIZE - 1) * 3) / 4) - 2;
     }
 
     uint16_t chunkBytesWritten = 0;
     for (uint16_t chunkOffset = 0; chunkOffset < bytesToWrite; chunkOffset += chunkBytesWritten)
     {
         uint16_t chunkSize = bytesToWrite - chunkOffset;
-        if (chunkSize > ATFILE_FILE_MAX_CHUNK_SIZE)
+        if (chunkSize > maxChunkSize)
         {
-            chunkSize = ATFILE_FILE_MAX_CHUNK_SIZE;
+            chunkSize = maxChunkSize;
+        }
+
+        uint32_t lengthWritten = chunkSize;
+        if (encodeAsBase64 && !Base64_GetEncBufSize(chunkSize, &lengthWritten))
+        {
+            return false;
         }
 
         char* pRequestCommand = AT_commandBuffer;
+        ATCommand_Builder_t builder;
         char* pRespondCommand = AT_commandBuffer;
 
-        strcpy(pRequestCommand, "AT+fileWrite=");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileWrite=");
 
-        if (!CordeliaI_ATFile_AddArgumentsFileWrite(pRequestCommand, fileID, offset + chunkOffset, format, chunkSize, data + chunkOffset))
+        if (!CordeliaI_ATFile_AddArgumentsFileWrite(&builder, fileID, offset + chunkOffset, format, (uint16_t)lengthWritten))
         {
             return false;
         }
@@ -220,6 +199,10 @@ bool CordeliaI_ATFile_Write(uint32_t fileID, uint16_t offset, CordeliaI_DataForm
         {
             return false;
         }
+        if (!CordeliaI_SendRequestPayload((const uint8_t*)data + chunkOffset, chunkSize, encodeAsBase64))
+        {
+            return false;
+        }
         if (!CordeliaI_WaitForConfirm(CordeliaI_GetTimeout(CordeliaI_Timeout_FileIO), CordeliaI_CNFStatus_Success, pRespondCommand))
         {
             return false;
@@ -230,6 +213,12 @@ bool CordeliaI_ATFile_Write(uint32_t fileID, uint16_t offset, CordeliaI_DataForm
             return false;
         }
 
+        if (encodeAsBase64)
+        {
+            /* The reported length refers to the encoded data - a Base64 chunk is always written as a whole */
+            chunkBytesWritten = chunkSize;
+        }
+
         *bytesWritten += chunkBytesWritten;
     }
 
@@ -239,19 +228,20 @@ bool CordeliaI_ATFile_Write(uint32_t fileID, uint16_t offset, CordeliaI_DataForm
 bool CordeliaI_ATFile_GetInfo(const char* fileName, uint32_t secureToken, CordeliaI_ATFile_FileInfo_t* fileInfo)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(AT_commandBuffer, "AT+fileGetInfo=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+fileGetInfo=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, fileName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, secureToken, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, secureToken, ATCOMMAND_INTFLAGS_SIZE32 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -337,17 +327,17 @@ bool CordeliaI_ATFile_PrintFileProperties(uint32_t properties, char* pOutStr, si
 /**
  * @brief Adds arguments to the AT+fileOpen command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] fileName Name of file to be opened
  * @param[in] options Option flags
  * @param[in] fileSize Maximum size of the file. Will be allocated on creation.
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATFile_AddArgumentsFileOpen(char* pAtCommand, const char* fileName, uint32_t options, uint16_t fileSize)
+static bool CordeliaI_ATFile_AddArgumentsFileOpen(ATCommand_Builder_t* pBuilder, const char* fileName, uint32_t options, uint16_t fileSize)
 {
 
-    if ((NULL == pAtCommand) || (NULL == fileName))
+    if ((NULL == pBuilder) || (NULL == fileName))
     {
         return false;
     }
@@ -357,93 +347,93 @@ static bool CordeliaI_ATFile_AddArgumentsFileOpen(char* pAtCommand, const char*
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, fileName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBitmask(pAtCommand, CordeliaI_ATFile_OpenFlags_Strings, CordeliaI_ATFile_OpenFlags_NumberOfValues, options, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(pBuilder, CordeliaI_ATFile_OpenFlags_Strings, CordeliaI_ATFile_OpenFlags_NumberOfValues, options, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, fileSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, fileSize, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+fileClose command string.
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] fileID ID of opened file as returned by CordeliaI_ATFile_Open()
  * @param[in] certName Full path to certificate (optional). Can be NULL if not used.
  * @param[in] signature SHA1 signature (optional). Can be NULL if not used.
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATFile_AddArgumentsFileClose(char* pAtCommand, uint32_t fileID, const char* certName, const char* signature)
+static bool CordeliaI_ATFile_AddArgumentsFileClose(ATCommand_Builder_t* pBuilder, uint32_t fileID, const char* certName, const char* signature)
 {
 
-    if (NULL == pAtCommand)
+    if (NULL == pBuilder)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, fileID, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, certName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, certName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pAtCommand, signature, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, signature, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+fileDel command string
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] fileName Name of the file to delete
  * @param[in] secureToken Secure token returned by CordeliaI_ATFile_Open() (optional)
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATFile_AddArgumentsFileDel(char* pAtCommand, const char* fileName, uint32_t secureToken)
+static bool CordeliaI_ATFile_AddArgumentsFileDel(ATCommand_Builder_t* pBuilder, const char* fileName, uint32_t secureToken)
 {
 
-    if (NULL == pAtCommand)
+    if (NULL == pBuilder)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, fileName, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, fileName, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, secureToken, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, secureToken, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+fileRead command string
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] fileID ID of file to read as returned by CordeliaI_ATFile_Open()
  * @param[in] offset Offset for the read operation
  * @param[in] format Format of the output data.
@@ -451,83 +441,75 @@ static bool CordeliaI_ATFile_AddArgumentsFileDel(char* pAtCommand, const char* f
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATFile_AddArgumentsFileRead(char* pAtCommand, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToRead)
+static bool CordeliaI_ATFile_AddArgumentsFileRead(ATCommand_Builder_t* pBuilder, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToRead)
 {
 
-    if (NULL == pAtCommand)
+    if (NULL == pBuilder)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, bytesToRead, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, bytesToRead, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+fileWrite command string
  *
- * @param[in] pAtCommand The AT command string to add the arguments to
+ * The command is terminated by the argument delimiter preceding the data, which
+ * is sent separately using CordeliaI_SendRequestPayload().
+ *
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] fileID ID of file to write as returned by CordeliaI_ATFile_Open()
  * @param[in] offset Offset for the write operation
  * @param[in] format Format of the data to be written.
  * @param[in] bytestoWrite Number of bytes to write
- * @param[in] data Data to be written
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATFile_AddArgumentsFileWrite(char* pAtCommand, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToWrite, const char* data)
+static bool CordeliaI_ATFile_AddArgumentsFileWrite(ATCommand_Builder_t* pBuilder, uint32_t fileID, uint16_t offset, CordeliaI_DataFormat_t format, uint16_t bytesToWrite)
 {
 
-    if (NULL == pAtCommand)
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pAtCommand, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentInt(pAtCommand, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (NULL == pBuilder)
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, fileID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pAtCommand, bytesToWrite, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(pBuilder, offset, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBytes(pAtCommand, data, bytesToWrite, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(pBuilder, format, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendInt(pBuilder, bytesToWrite, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM);
 }
 
 /**
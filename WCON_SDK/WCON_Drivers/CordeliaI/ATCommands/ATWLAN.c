@@ -60,9 +60,9 @@ static const char* CordeliaI_ATWLAN_SecurityEAPStrings[CordeliaI_ATWLAN_Security
 static bool CordeliaI_ATWLAN_IsInputValidWlanGet(CordeliaI_ATWLAN_SetID_t id, uint8_t option);
 static bool CordeliaI_ATWLAN_IsInputValidWlanSet(CordeliaI_ATWLAN_SetID_t id, uint8_t option);
 
-static bool CordeliaI_ATWLAN_AddConnectionArguments(char* pOutString, CordeliaI_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
-static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, CordeliaI_ATWLAN_SetID_t id, uint8_t option);
-static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI_ATWLAN_Settings_t* pValues);
+static bool CordeliaI_ATWLAN_AddConnectionArguments(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim);
+static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_SetID_t id, uint8_t option);
+static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI_ATWLAN_Settings_t* pValues);
 
 static bool CordeliaI_ATWLAN_ParseResponseWlanScanEntry(char** pAtCommand, CordeliaI_ATWLAN_ScanEntry_t* pOutScanEntry);
 static bool CordeliaI_ATWLAN_ParseResponseWlanAddProfile(char** pAtCommand, uint8_t* pOutIndex);
@@ -79,21 +79,22 @@ bool CordeliaI_ATWLAN_Scan(uint8_t index, uint8_t deviceCount, CordeliaI_ATWLAN_
         return false;
     }
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanScan=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanScan=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, deviceCount, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -124,15 +125,16 @@ bool CordeliaI_ATWLAN_Connect(CordeliaI_ATWLAN_ConnectionArguments_t connectArgs
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanConnect=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanConnect=");
 
-    if (!CordeliaI_ATWLAN_AddConnectionArguments(pRequestCommand, connectArgs, ATCOMMAND_STRING_TERMINATE))
+    if (!CordeliaI_ATWLAN_AddConnectionArguments(&builder, connectArgs, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -163,21 +165,22 @@ bool CordeliaI_ATWLAN_AddProfile(CordeliaI_ATWLAN_Profile_t profile, uint8_t* pO
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanProfileAdd=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileAdd=");
 
-    if (!CordeliaI_ATWLAN_AddConnectionArguments(pRequestCommand, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
+    if (!CordeliaI_ATWLAN_AddConnectionArguments(&builder, profile.connection, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, profile.priority, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -204,16 +207,17 @@ bool CordeliaI_ATWLAN_GetProfile(uint8_t index, CordeliaI_ATWLAN_Profile_t* pOut
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanProfileGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileGet=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -234,15 +238,16 @@ bool CordeliaI_ATWLAN_DeleteProfile(uint8_t index)
 {
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanProfileDel=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanProfileDel=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, index, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -266,11 +271,12 @@ bool CordeliaI_ATWLAN_Get(CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     char* pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanGet=");
 
-    if (!CordeliaI_ATWLAN_AddArgumentsWlanGet(pRequestCommand, id, option))
+    if (!CordeliaI_ATWLAN_AddArgumentsWlanGet(&builder, id, option))
     {
         return false;
     }
@@ -296,10 +302,11 @@ bool CordeliaI_ATWLAN_Set(CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanSet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanSet=");
 
-    if (!CordeliaI_ATWLAN_AddArgumentsWlanSet(pRequestCommand, id, option, pValues))
+    if (!CordeliaI_ATWLAN_AddArgumentsWlanSet(&builder, id, option, pValues))
     {
         return false;
     }
@@ -315,20 +322,21 @@ bool CordeliaI_ATWLAN_Set(CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI
 bool CordeliaI_ATWLAN_SetConnectionPolicy(uint8_t policy)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_Connection], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentBitmask(pRequestCommand, CordeliaI_ATWLAN_PolicyConnectionStrings, CordeliaI_ATWLAN_PolicyConnection_NumberOfValues, policy, ATCOMMAND_ARGUMENT_DELIM, AT_MAX_COMMAND_BUFFER_SIZE))
+    if (!ATCommand_Builder_AppendBitmask(&builder, CordeliaI_ATWLAN_PolicyConnectionStrings, CordeliaI_ATWLAN_PolicyConnection_NumberOfValues, policy, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -363,22 +371,23 @@ bool CordeliaI_ATWLAN_GetConnectionPolicy(uint8_t* policy)
 bool CordeliaI_ATWLAN_SetScanPolicy(CordeliaI_ATWLAN_PolicyScan_t policy, uint32_t scanIntervalSeconds)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_Scan], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyScanStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, scanIntervalSeconds, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -420,22 +429,23 @@ bool CordeliaI_ATWLAN_GetScanPolicy(CordeliaI_ATWLAN_PolicyScan_t* policy, uint3
 bool CordeliaI_ATWLAN_SetPMPolicy(CordeliaI_ATWLAN_PolicyPM_t policy, uint32_t maxSleepTimeMs)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_PowerManagement], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyPMStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, maxSleepTimeMs, ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -477,22 +487,23 @@ bool CordeliaI_ATWLAN_GetPMPolicy(CordeliaI_ATWLAN_PolicyPM_t* policy, uint32_t*
 bool CordeliaI_ATWLAN_SetP2PPolicy(CordeliaI_ATWLAN_PolicyP2P_t policy, CordeliaI_ATWLAN_PolicyP2PValue_t value)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+wlanPolicySet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicySet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyStrings[CordeliaI_ATWLAN_PolicyID_P2P], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyP2PStrings[policy], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyP2PValue_Strings[value], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -556,16 +567,17 @@ bool CordeliaI_ATWLAN_SendPolicyGet(CordeliaI_ATWLAN_PolicyID_t id, char** pResp
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
     *pRespondCommand = AT_commandBuffer;
 
-    strcpy(pRequestCommand, "AT+wlanPolicyGet=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+wlanPolicyGet=");
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, CordeliaI_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, CordeliaI_ATWLAN_PolicyStrings[id], ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -649,61 +661,61 @@ static bool CordeliaI_ATWLAN_IsInputValidWlanSet(CordeliaI_ATWLAN_SetID_t id, ui
 /**
  * @brief Adds arguments to the connection command string.
  *
- * @param[out] pOutString The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] connectionArgs The connection parameters
  * @param[in] lastDelim The delimiter to add after the last argument.
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATWLAN_AddConnectionArguments(char* pOutString, CordeliaI_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
+static bool CordeliaI_ATWLAN_AddConnectionArguments(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_ConnectionArguments_t connectionArgs, char lastDelim)
 {
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.SSID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.BSSID, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, CordeliaI_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SecurityTypeStrings[connectionArgs.securityParams.securityType], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityParams.securityKey, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityExtParams.extUser, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pOutString, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, connectionArgs.securityExtParams.extAnonUser, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    return ATCommand_AppendArgumentString(pOutString, CordeliaI_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
+    return ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SecurityEAPStrings[connectionArgs.securityExtParams.eapMethod], lastDelim);
 }
 
 /**
  * @brief Adds arguments to the AT+wlanGet command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id ID of the value to get
  * @param[in] option Option of the value to get
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, CordeliaI_ATWLAN_SetID_t id, uint8_t option)
+static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_SetID_t id, uint8_t option)
 {
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -711,7 +723,7 @@ static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, CordeliaI_ATW
     switch (id)
     {
         case CordeliaI_ATWLAN_SetID_General:
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_STRING_TERMINATE))
             {
                 return false;
             }
@@ -721,23 +733,23 @@ static bool CordeliaI_ATWLAN_AddArgumentsWlanGet(char* pAtCommand, CordeliaI_ATW
             return false;
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
  * @brief Adds arguments to the AT+wlanSet command string.
  *
- * @param[out] pAtCommand The AT command string to add the arguments to
+ * @param[in,out] pBuilder Builder of the AT command to add the arguments to
  * @param[in] id ID of the value to set
  * @param[in] option Option of the value to set
  * @param[in] pValues Values to set
  *
  * @return true if successful, false otherwise
  */
-static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI_ATWLAN_Settings_t* pValues)
+static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(ATCommand_Builder_t* pBuilder, CordeliaI_ATWLAN_SetID_t id, uint8_t option, CordeliaI_ATWLAN_Settings_t* pValues)
 {
 
-    if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SetIDStrings[id], ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
@@ -746,7 +758,7 @@ static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, CordeliaI_ATW
     {
         case CordeliaI_ATWLAN_SetID_General:
         {
-            if (!ATCommand_AppendArgumentString(pAtCommand, CordeliaI_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, CordeliaI_ATWLAN_SetGetGeneralStrings[option], ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -754,39 +766,39 @@ static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, CordeliaI_ATW
             switch (option)
             {
                 case CordeliaI_ATWLAN_SetGeneral_CountryCode:
-                    if (!ATCommand_AppendArgumentString(pAtCommand, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendString(pBuilder, pValues->general.countryCode, ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case CordeliaI_ATWLAN_SetGeneral_StationTxPower:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.staTxPower, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case CordeliaI_ATWLAN_SetGeneral_ScanParams:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_ARGUMENT_DELIM))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.scanParams.channelMask, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_ARGUMENT_DELIM))
                     {
                         return false;
                     }
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.scanParams.rssiTreshold, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_HEX), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case CordeliaI_ATWLAN_SetGeneral_SuspendProfiles:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.suspendProfiles, (ATCOMMAND_INTFLAGS_NOTATION_HEX | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
                     break;
 
                 case CordeliaI_ATWLAN_SetGeneral_DisableEntServerAuth:
-                    if (!ATCommand_AppendArgumentInt(pAtCommand, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
+                    if (!ATCommand_Builder_AppendInt(pBuilder, pValues->general.disableEntServerAuth, (ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC), ATCOMMAND_STRING_TERMINATE))
                     {
                         return false;
                     }
@@ -807,7 +819,7 @@ static bool CordeliaI_ATWLAN_AddArgumentsWlanSet(char* pAtCommand, CordeliaI_ATW
         }
     }
 
-    return ATCommand_AppendArgumentString(pAtCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
+    return ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE);
 }
 
 /**
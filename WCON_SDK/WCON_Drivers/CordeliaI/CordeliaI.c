@@ -58,6 +58,23 @@ static char CordeliaI_pendingCommandName[64] = {0};
  */
 static size_t CordeliaI_pendingCommandNameLength = 0;
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Performance counters and latency histograms (see CordeliaI_GetStatistics()).
+ */
+static WE_Stats_t CordeliaI_stats = {0};
+
+/**
+ * @brief Time the pending request has been sent (see CordeliaI_SendRequest()).
+ */
+static uint32_t CordeliaI_requestStartUs = 0;
+
+/**
+ * @brief Is true as long as the latency of the pending request hasn't been recorded.
+ */
+static bool CordeliaI_requestTimed = false;
+#endif
+
 /**
  * @brief Buffer used for current response text.
  */
@@ -121,7 +138,8 @@ static uint8_t CordeliaI_eolChar2 = '\n';
 static bool CordeliaI_twoEolCharacters = true;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from CordeliaI.
+ * @brief Time step (microseconds) when waiting for responses from CordeliaI
+ * (maximum time between two checks, waiting ends as soon as the confirmation has been received).
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
@@ -129,6 +147,11 @@ static bool CordeliaI_twoEolCharacters = true;
  */
 static uint32_t CordeliaI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is signaled when a confirmation has been received from CordeliaI.
+ */
+static WE_Event_t CordeliaI_confirmEvent = {0};
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to CordeliaI
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -157,6 +180,28 @@ CordeliaI_EventCallback_t CordeliaI_eventCallback;
  */
 static bool CordeliaI_executingEventCallback = false;
 
+/**
+ * @brief Serializes the access of several threads to the module (see CordeliaI_Lock()).
+ */
+static WE_Mutex_t CordeliaI_requestMutex = NULL;
+
+#if defined(WE_AT_RX_TASK)
+/**
+ * @brief Receive task, which executes the byte handler (see CordeliaI_SetByteRxCallback()) if supported by the platform.
+ */
+static ATCommand_RxTask_t CordeliaI_rxTask = {0};
+
+/**
+ * @brief Queues received data for the receive task.
+ */
+static void CordeliaI_EnqueueRxBytes(uint8_t* dataP, size_t size) { ATCommand_RxTask_Enqueue(&CordeliaI_rxTask, dataP, size); }
+
+/**
+ * @brief Byte handler passed to the UART if the receive task is running.
+ */
+static WE_UART_HandleRxByte_t CordeliaI_uartRxCallback = CordeliaI_EnqueueRxBytes;
+#endif
+
 /**
  * @brief Callback function which is executed if a single byte has been received from CordeliaI.
  * The default callback is CordeliaI_HandleRxByte().
@@ -184,6 +229,9 @@ static WE_UART_t* CordeliaI_uartP = NULL;
 bool CordeliaI_Init(WE_UART_t* uartP, CordeliaI_Pins_t* pinoutP, CordeliaI_EventCallback_t eventCallback)
 {
     CordeliaI_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&CordeliaI_stats);
+#endif
 
     /* Callbacks */
     byteRxCallback = CordeliaI_HandleRxByte;
@@ -228,7 +276,21 @@ bool CordeliaI_Init(WE_UART_t* uartP, CordeliaI_Pins_t* pinoutP, CordeliaI_Event
     }
 
     CordeliaI_uartP = uartP;
-    if (false == CordeliaI_uartP->uartInit(CordeliaI_uartP->baudrate, CordeliaI_uartP->flowControl, CordeliaI_uartP->parity, &byteRxCallback))
+
+    if ((NULL == CordeliaI_requestMutex) && !WE_Mutex_Create(&CordeliaI_requestMutex))
+    {
+        return false;
+    }
+
+    WE_UART_HandleRxByte_t* uartRxCallbackP = &byteRxCallback;
+#if defined(WE_AT_RX_TASK)
+    if (ATCommand_RxTask_Start(&CordeliaI_rxTask, &byteRxCallback, "CordeliaI_RX"))
+    {
+        /* Received data is passed to the byte handler by the receive task */
+        uartRxCallbackP = &CordeliaI_uartRxCallback;
+    }
+#endif
+    if (false == CordeliaI_uartP->uartInit(CordeliaI_uartP->baudrate, CordeliaI_uartP->flowControl, CordeliaI_uartP->parity, uartRxCallbackP))
     {
         return false;
     }
@@ -304,9 +366,18 @@ bool CordeliaI_PinWakeUp(void)
 
 bool CordeliaI_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP) { return WE_GetPinLevel(pin, pin_levelP); }
 
+bool CordeliaI_Lock(uint32_t timeoutMs) { return WE_Mutex_Lock(CordeliaI_requestMutex, timeoutMs); }
+
+void CordeliaI_Unlock(void) { WE_Mutex_Unlock(CordeliaI_requestMutex); }
+
 bool CordeliaI_SendRequest(char* data)
 {
+#if defined(WE_AT_RX_TASK)
+    /* If running, the receive task executes the event callbacks - other threads may send requests in the meantime */
+    if (CordeliaI_executingEventCallback && ATCommand_RxTask_IsCurrentContext(&CordeliaI_rxTask))
+#else
     if (CordeliaI_executingEventCallback)
+#endif
     {
         /* Don't allow sending AT commands from event handlers, as this will
          * mess up send/receive states and buffers. */
@@ -343,20 +414,115 @@ bool CordeliaI_SendRequest(char* data)
 
     WE_DEBUG_PRINT_DEBUG("> %s", data);
 
+#if defined(WE_STATS_ENABLED)
+    CordeliaI_stats.txFrames++;
+    WE_STATS_START_REQUEST(CordeliaI_requestStartUs);
+    CordeliaI_requestTimed = true;
+#endif
     CordeliaI_Transparent_Transmit(data, dataLength);
 
     return true;
 }
 
+/**
+ * @brief Transmits the payload of a request and the terminating "\r\n" (see CordeliaI_SendRequestPayload()).
+ */
+static bool CordeliaI_TransmitRequestPayload(const uint8_t* data, uint16_t dataLength, bool encodeAsBase64)
+{
+    if ((data == NULL) && (dataLength > 0))
+    {
+        return false;
+    }
+
+    if (!encodeAsBase64)
+    {
+        if ((dataLength > 0) && !CordeliaI_Transparent_Transmit((const char*)data, dataLength))
+        {
+            return false;
+        }
+        return CordeliaI_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+    }
+
+    /* Encode the payload block-wise, so that only a single block has to be buffered */
+    uint8_t block[CORDELIAI_BASE64_ENCODE_BLOCK_SIZE];
+    Base64_Encoder_t encoder;
+    Base64_EncodeInit(&encoder);
+
+    for (uint16_t offset = 0; offset < dataLength;)
+    {
+        uint16_t inLength = dataLength - offset;
+        if (inLength > (CORDELIAI_BASE64_ENCODE_BLOCK_SIZE / 4) * 3)
+        {
+            inLength = (CORDELIAI_BASE64_ENCODE_BLOCK_SIZE / 4) * 3;
+        }
+
+        uint32_t outLength = sizeof(block);
+        if (!Base64_EncodeUpdate(&encoder, data + offset, inLength, block, &outLength))
+        {
+            return false;
+        }
+        if ((outLength > 0) && !CordeliaI_Transparent_Transmit((const char*)block, outLength))
+        {
+            return false;
+        }
+        offset += inLength;
+    }
+
+    uint32_t outLength = sizeof(block);
+    if (!Base64_EncodeFinal(&encoder, block, &outLength))
+    {
+        return false;
+    }
+    if ((outLength > 0) && !CordeliaI_Transparent_Transmit((const char*)block, outLength))
+    {
+        return false;
+    }
+
+    return CordeliaI_Transparent_Transmit(ATCOMMAND_CRLF, 2);
+}
+
+bool CordeliaI_SendRequestPayload(const uint8_t* data, uint16_t dataLength, bool encodeAsBase64)
+{
+    if (CordeliaI_TransmitRequestPayload(data, dataLength, encodeAsBase64))
+    {
+        return true;
+    }
+
+    /* The module has received an incomplete request - don't wait for a confirmation of it */
+    CordeliaI_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    CordeliaI_requestTimed = false;
+#endif
+    return false;
+}
+
 bool CordeliaI_Transparent_Transmit(const char* data, uint16_t dataLength)
 {
     if ((data == NULL) || (dataLength == 0))
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&CordeliaI_stats, dataLength, false);
     return CordeliaI_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+#if defined(WE_STATS_ENABLED)
+bool CordeliaI_GetStatistics(WE_Stats_t* statsP)
+{
+    if (!WE_Stats_Snapshot(&CordeliaI_stats, CordeliaI_uartP, statsP))
+    {
+        return false;
+    }
+#if defined(WE_AT_RX_TASK)
+    /* Data discarded by the receive task counts as receive overflow as well */
+    statsP->rxDroppedBytes += CordeliaI_rxTask.droppedBytes;
+#endif
+    return true;
+}
+
+void CordeliaI_ResetStatistics() { WE_Stats_Reset(&CordeliaI_stats); }
+#endif
+
 bool CordeliaI_WaitForConfirm(uint32_t maxTimeMs, CordeliaI_CNFStatus_t expectedStatus, char* pOutResponse)
 {
     CordeliaI_cmdConfirmStatus = CordeliaI_CNFStatus_Invalid;
@@ -396,10 +562,12 @@ bool CordeliaI_WaitForConfirm(uint32_t maxTimeMs, CordeliaI_CNFStatus_t expected
 
         if (CordeliaI_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(CordeliaI_waitTimeStepUsec);
+            /* Returns as soon as the confirmation has been received */
+            WE_WaitEvent(&CordeliaI_confirmEvent, (CordeliaI_waitTimeStepUsec + 999) / 1000);
         }
     }
 
+    WE_STATS_ADD(&CordeliaI_stats, timeouts, 1);
     CordeliaI_requestPending = false;
     return false;
 }
@@ -432,6 +600,8 @@ uint32_t CordeliaI_GetTimeout(CordeliaI_Timeout_t type) { return CordeliaI_timeo
  */
 static void CordeliaI_HandleRxByte(uint8_t* dataP, size_t size)
 {
+    WE_STATS_ADD(&CordeliaI_stats, rxBytes, size);
+
     uint8_t receivedByte;
     for (; size > 0; size--, dataP++)
     {
@@ -452,6 +622,7 @@ static void CordeliaI_HandleRxByte(uint8_t* dataP, size_t size)
         {
             if (CordeliaI_rxByteCounter >= CORDELIAI_LINE_MAX_SIZE)
             {
+                WE_STATS_ADD(&CordeliaI_stats, parseErrors, 1);
                 CordeliaI_rxByteCounter = 0;
                 CordeliaI_eolChar1Found = false;
                 return;
@@ -499,6 +670,8 @@ static void CordeliaI_HandleRxByte(uint8_t* dataP, size_t size)
  */
 static void CordeliaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
+    WE_STATS_ADD(&CordeliaI_stats, rxFrames, 1);
+
     WE_DEBUG_PRINT_DEBUG("< %s\r\n", rxPacket);
 
     /* Check if a custom line rx callback is specified and call it if so */
@@ -567,6 +740,20 @@ static void CordeliaI_HandleRxLine(char* rxPacket, uint16_t rxLength)
                 CordeliaI_currentResponseLength += chunkLength;
             }
         }
+
+        if (CordeliaI_CNFStatus_Invalid != CordeliaI_cmdConfirmStatus)
+        {
+#if defined(WE_STATS_ENABLED)
+            if (CordeliaI_requestTimed)
+            {
+                CordeliaI_requestTimed = false;
+                WE_STATS_COMPLETE_REQUEST(&CordeliaI_stats, WE_Stats_Hash(CordeliaI_pendingCommandName, CordeliaI_pendingCommandNameLength), CordeliaI_pendingCommandName, CordeliaI_requestStartUs);
+            }
+#endif
+
+            /* Wake up CordeliaI_WaitForConfirm() */
+            WE_SignalEvent(&CordeliaI_confirmEvent);
+        }
     }
 
     if ('+' == rxPacket[0])
@@ -31,6 +31,7 @@
 #ifndef CORDELIAI_H_INCLUDED
 #define CORDELIAI_H_INCLUDED
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -42,6 +43,12 @@
  */
 #define CORDELIAI_LINE_MAX_SIZE 2048
 
+/**
+ * @brief Number of Base64 characters encoded per UART transmission when streaming a request payload.
+ * Must be a multiple of 4. Determines the stack usage of CordeliaI_SendRequestPayload().
+ */
+#define CORDELIAI_BASE64_ENCODE_BLOCK_SIZE 128
+
 /**
  * @brief Max. length of response text (size of buffer storing responses received from CordeliaI).
  * @see CordeliaI_currentResponseText
@@ -193,6 +200,25 @@ extern bool CordeliaI_PinWakeUp(void);
  */
 extern bool CordeliaI_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP);
 
+/**
+ * @brief Locks the driver for exclusive use by the calling thread.
+ *
+ * The AT command functions share the command buffer (AT_commandBuffer) and the state of the pending request.
+ * If the driver is used by several threads, each call (or sequence of calls) of driver functions needs to be
+ * enclosed in CordeliaI_Lock() and CordeliaI_Unlock(). The lock may be acquired several times by the same thread.
+ * Must not be called from the event callback. On bare metal platforms, this function has no effect.
+ *
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the driver has been locked, false if the timeout has expired
+ */
+extern bool CordeliaI_Lock(uint32_t timeoutMs);
+
+/**
+ * @brief Releases the lock acquired using CordeliaI_Lock().
+ */
+extern void CordeliaI_Unlock(void);
+
 /**
  * @brief Sends the supplied AT command to the module
  *
@@ -202,6 +228,22 @@ extern bool CordeliaI_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP);
  */
 extern bool CordeliaI_SendRequest(char* data);
 
+/**
+ * @brief Sends the payload of an AT command whose header has been sent using CordeliaI_SendRequest().
+ *
+ * The payload is transmitted directly from the supplied buffer (optionally encoding it
+ * as Base64 on the fly in blocks of CORDELIAI_BASE64_ENCODE_BLOCK_SIZE characters), followed
+ * by the terminating "\r\n". The header passed to CordeliaI_SendRequest() must not end with "\r\n".
+ *
+ * @param[in] data: Payload to send
+ * @param[in] dataLength: Number of payload bytes (before encoding)
+ * @param[in] encodeAsBase64: Encode the payload as Base64 while sending
+ *
+ * @return True if successful, false otherwise (the request is no longer pending in this case, so
+ * CordeliaI_WaitForConfirm() need not be called)
+ */
+extern bool CordeliaI_SendRequestPayload(const uint8_t* data, uint16_t dataLength, bool encodeAsBase64);
+
 /**
  * @brief Waits for the response from the module after a request.
  *
@@ -213,6 +255,24 @@ extern bool CordeliaI_SendRequest(char* data);
  */
 extern bool CordeliaI_WaitForConfirm(uint32_t maxTimeMs, CordeliaI_CNFStatus_t expectedStatus, char* pOutResponse);
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * The latency histograms are kept per AT command name (see WE_Stats_Hash()).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool CordeliaI_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void CordeliaI_ResetStatistics();
+#endif
+
 /**
  * @brief Returns the code of the last error (if any).
  *
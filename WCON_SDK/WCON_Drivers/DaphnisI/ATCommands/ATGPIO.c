@@ -41,8 +41,8 @@
 static bool DaphnisI_GPIO_ParseConfigBlocks(char* string, DaphnisI_GPIOConfigBlock_t* configBlocksP, uint8_t* configBlocksCountP);
 static bool DaphnisI_GPIO_ParseValueGetBlocks(char* string, DaphnisI_GPIOValueGetBlock_t* valueGetBlocksP, uint8_t* valueGetBlocksCountP);
 static bool DaphnisI_GPIO_ParseStatusBlocks(char* string, DaphnisI_GPIOStatusBlock_t* statusBlocksP, uint8_t* statusBlocksCountP);
-static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOConfigBlock_t* configBlocksP, uint8_t configBlocksCount);
-static bool DaphnisI_GPIO_CreateValueSetBlocksString(char* string, DaphnisI_GPIOValueSetBlock_t* valueSetBlocksP, uint8_t valueSetBlocksCount);
+static bool DaphnisI_GPIO_CreateConfigBlocksString(ATCommand_Builder_t* pBuilder, DaphnisI_GPIOConfigBlock_t* configBlocksP, uint8_t configBlocksCount);
+static bool DaphnisI_GPIO_CreateValueSetBlocksString(ATCommand_Builder_t* pBuilder, DaphnisI_GPIOValueSetBlock_t* valueSetBlocksP, uint8_t valueSetBlocksCount);
 
 #define GPIO_PIN_DELIMITER ':'
 
@@ -54,9 +54,10 @@ bool DaphnisI_GPIO_Local_Configuration_Set(DaphnisI_GPIOConfigBlock_t* configBlo
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+GPIOLCFGSET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+GPIOLCFGSET=");
 
-    if (!DaphnisI_GPIO_CreateConfigBlocksString(pRequestCommand, configBlocksP, configBlocksCount))
+    if (!DaphnisI_GPIO_CreateConfigBlocksString(&builder, configBlocksP, configBlocksCount))
     {
         return false;
     }
@@ -133,9 +134,10 @@ bool DaphnisI_GPIO_Local_Value_Set(DaphnisI_GPIOValueSetBlock_t* valueSetBlocksP
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+GPIOLVALUESET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+GPIOLVALUESET=");
 
-    if (!DaphnisI_GPIO_CreateValueSetBlocksString(pRequestCommand, valueSetBlocksP, valueSetBlocksCount))
+    if (!DaphnisI_GPIO_CreateValueSetBlocksString(&builder, valueSetBlocksP, valueSetBlocksCount))
     {
         return false;
     }
@@ -180,25 +182,26 @@ bool DaphnisI_GPIO_Local_Value_Get(DaphnisI_GPIO_t* gpioToReadP, uint8_t gpioToR
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+GPIOLVALUEGET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+GPIOLVALUEGET=");
 
     for (uint8_t i = 0; i < gpioToReadCount; i++)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, gpioToReadP[i], (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, gpioToReadP[i], (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
 
         if (i != (gpioToReadCount - 1))
         {
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -238,7 +241,8 @@ bool DaphnisI_P2P_GPIO_Remote_Configuration_Set(DaphnisI_Device_Address_t dest_a
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PGPIORCFGSET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PGPIORCFGSET=");
 
     char dest_device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -247,12 +251,12 @@ bool DaphnisI_P2P_GPIO_Remote_Configuration_Set(DaphnisI_Device_Address_t dest_a
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!DaphnisI_GPIO_CreateConfigBlocksString(pRequestCommand, configBlocksP, configBlocksCount))
+    if (!DaphnisI_GPIO_CreateConfigBlocksString(&builder, configBlocksP, configBlocksCount))
     {
         return false;
     }
@@ -282,7 +286,8 @@ bool DaphnisI_P2P_GPIO_Remote_Configuration_Set(DaphnisI_Device_Address_t dest_a
 bool DaphnisI_P2P_GPIO_Remote_Configuration_Get(DaphnisI_Device_Address_t dest_address)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PGPIORCFGGET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PGPIORCFGGET=");
 
     char dest_device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -291,12 +296,12 @@ bool DaphnisI_P2P_GPIO_Remote_Configuration_Get(DaphnisI_Device_Address_t dest_a
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, dest_device_address_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, dest_device_address_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -331,7 +336,8 @@ bool DaphnisI_P2P_GPIO_Remote_Value_Set(DaphnisI_Device_Address_t dest_address,
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PGPIORVALUESET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PGPIORVALUESET=");
 
     char dest_device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -340,12 +346,12 @@ bool DaphnisI_P2P_GPIO_Remote_Value_Set(DaphnisI_Device_Address_t dest_address,
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!DaphnisI_GPIO_CreateValueSetBlocksString(pRequestCommand, valueSetBlocksP, valueSetBlocksCount))
+    if (!DaphnisI_GPIO_CreateValueSetBlocksString(&builder, valueSetBlocksP, valueSetBlocksCount))
     {
         return false;
     }
@@ -380,7 +386,8 @@ bool DaphnisI_P2P_GPIO_Remote_Value_Get(DaphnisI_Device_Address_t dest_address,
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PGPIORVALUEGET=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PGPIORVALUEGET=");
 
     char dest_device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -389,28 +396,28 @@ bool DaphnisI_P2P_GPIO_Remote_Value_Get(DaphnisI_Device_Address_t dest_address,
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
     for (uint8_t i = 0; i < gpioToReadCount; i++)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, gpioToReadP[i], (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, gpioToReadP[i], (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
 
         if (i != (gpioToReadCount - 1))
         {
-            if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -735,21 +742,21 @@ static bool DaphnisI_GPIO_ParseStatusBlocks(char* string, DaphnisI_GPIOStatusBlo
     return true;
 }
 
-static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOConfigBlock_t* configBlocksP, uint8_t configBlocksCount)
+static bool DaphnisI_GPIO_CreateConfigBlocksString(ATCommand_Builder_t* pBuilder, DaphnisI_GPIOConfigBlock_t* configBlocksP, uint8_t configBlocksCount)
 {
-    if ((string == NULL) || (configBlocksP == NULL))
+    if ((pBuilder == NULL) || (configBlocksP == NULL))
     {
         return false;
     }
 
     for (uint8_t i = 0; i < configBlocksCount; i++)
     {
-        if (!ATCommand_AppendArgumentInt(string, configBlocksP[i].GPIO_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), GPIO_PIN_DELIMITER))
+        if (!ATCommand_Builder_AppendInt(pBuilder, configBlocksP[i].GPIO_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), GPIO_PIN_DELIMITER))
         {
             return false;
         }
 
-        if (!ATCommand_AppendArgumentInt(string, configBlocksP[i].function, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(pBuilder, configBlocksP[i].function, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
@@ -762,12 +769,12 @@ static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOCo
             }
             case DaphnisI_GPIO_IO_Input:
             {
-                if (!ATCommand_AppendArgumentString(string, ATCOMMAND_STRING_EMPTY, GPIO_PIN_DELIMITER))
+                if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, GPIO_PIN_DELIMITER))
                 {
                     return false;
                 }
 
-                if (!ATCommand_AppendArgumentInt(string, configBlocksP[i].value.input, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, configBlocksP[i].value.input, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -776,12 +783,12 @@ static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOCo
             }
             case DaphnisI_GPIO_IO_Output:
             {
-                if (!ATCommand_AppendArgumentString(string, ATCOMMAND_STRING_EMPTY, GPIO_PIN_DELIMITER))
+                if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, GPIO_PIN_DELIMITER))
                 {
                     return false;
                 }
 
-                if (!ATCommand_AppendArgumentInt(string, configBlocksP[i].value.output, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+                if (!ATCommand_Builder_AppendInt(pBuilder, configBlocksP[i].value.output, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
                 {
                     return false;
                 }
@@ -796,14 +803,14 @@ static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOCo
 
         if (i != (configBlocksCount - 1))
         {
-            if (!ATCommand_AppendArgumentString(string, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    if (!ATCommand_AppendArgumentString(string, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -811,30 +818,30 @@ static bool DaphnisI_GPIO_CreateConfigBlocksString(char* string, DaphnisI_GPIOCo
     return true;
 }
 
-static bool DaphnisI_GPIO_CreateValueSetBlocksString(char* string, DaphnisI_GPIOValueSetBlock_t* valueSetBlocksP, uint8_t valueSetBlocksCount)
+static bool DaphnisI_GPIO_CreateValueSetBlocksString(ATCommand_Builder_t* pBuilder, DaphnisI_GPIOValueSetBlock_t* valueSetBlocksP, uint8_t valueSetBlocksCount)
 {
     for (uint8_t i = 0; i < valueSetBlocksCount; i++)
     {
-        if (!ATCommand_AppendArgumentInt(string, valueSetBlocksP[i].GPIO_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), GPIO_PIN_DELIMITER))
+        if (!ATCommand_Builder_AppendInt(pBuilder, valueSetBlocksP[i].GPIO_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), GPIO_PIN_DELIMITER))
         {
             return false;
         }
 
-        if (!ATCommand_AppendArgumentInt(string, valueSetBlocksP[i].value, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(pBuilder, valueSetBlocksP[i].value, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
 
         if (i != (valueSetBlocksCount - 1))
         {
-            if (!ATCommand_AppendArgumentString(string, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_STRING_EMPTY, ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
         }
     }
 
-    if (!ATCommand_AppendArgumentString(string, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
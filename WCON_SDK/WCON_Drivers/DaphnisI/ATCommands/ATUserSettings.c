@@ -269,19 +269,21 @@ static bool DaphnisI_SetStringSetting(const char* setting, char* string)
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT");
 
-    strcat(pRequestCommand, setting);
-
-    strcat(pRequestCommand, "=");
+    if (!ATCommand_Builder_AppendString(&builder, setting, ATCOMMAND_COMMAND_DELIM))
+    {
+        return false;
+    }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -302,12 +304,19 @@ static bool DaphnisI_GetStringSetting(const char* setting, char* string, uint16_
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT");
 
-    strcat(pRequestCommand, setting);
+    if (!ATCommand_Builder_AppendString(&builder, setting, ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
 
-    strcat(pRequestCommand, "=?\r\n");
+    if (!ATCommand_Builder_AppendString(&builder, "=?" ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
 
     if (!DaphnisI_SendRequest(pRequestCommand))
     {
@@ -360,19 +369,21 @@ bool DaphnisI_ResetUserSettings()
 static bool DaphnisI_SetIntSetting(const char* setting, uint32_t integer, uint16_t int_flags)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT");
 
-    strcat(pRequestCommand, setting);
-
-    strcat(pRequestCommand, "=");
+    if (!ATCommand_Builder_AppendString(&builder, setting, ATCOMMAND_COMMAND_DELIM))
+    {
+        return false;
+    }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, integer, int_flags, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, integer, int_flags, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -393,12 +404,19 @@ static bool DaphnisI_GetIntSetting(const char* setting, void* integerP, uint16_t
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT");
 
-    strcat(pRequestCommand, setting);
+    if (!ATCommand_Builder_AppendString(&builder, setting, ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
 
-    strcat(pRequestCommand, "=?\r\n");
+    if (!ATCommand_Builder_AppendString(&builder, "=?" ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    {
+        return false;
+    }
 
     if (!DaphnisI_SendRequest(pRequestCommand))
     {
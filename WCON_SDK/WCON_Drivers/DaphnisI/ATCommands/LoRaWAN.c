@@ -51,7 +51,8 @@ bool DaphnisI_LoRaWAN_SetAPPEUI(DaphnisI_EUI_t app_eui)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+APPEUI=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+APPEUI=");
 
     char app_eui_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_LORAWAN_EUI_LENGTH)];
 
@@ -60,12 +61,12 @@ bool DaphnisI_LoRaWAN_SetAPPEUI(DaphnisI_EUI_t app_eui)
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, app_eui_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, app_eui_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -124,7 +125,8 @@ bool DaphnisI_LoRaWAN_SetDeviceEUI(DaphnisI_EUI_t device_eui)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+DEUI=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+DEUI=");
 
     char device_eui_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_LORAWAN_EUI_LENGTH)];
 
@@ -133,12 +135,12 @@ bool DaphnisI_LoRaWAN_SetDeviceEUI(DaphnisI_EUI_t device_eui)
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, device_eui_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, device_eui_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -197,7 +199,8 @@ bool DaphnisI_LoRaWAN_SetKey(DaphnisI_KeyType_t keyType, DaphnisI_Key_t key)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, DaphnisI_Key_SetRequestStrings[keyType]);
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, DaphnisI_Key_SetRequestStrings[keyType]);
 
     char key_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_LORAWAN_KEY_LENGTH)];
 
@@ -206,12 +209,12 @@ bool DaphnisI_LoRaWAN_SetKey(DaphnisI_KeyType_t keyType, DaphnisI_Key_t key)
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, key_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, key_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -232,7 +235,8 @@ bool DaphnisI_LoRaWAN_SetDeviceAddress(DaphnisI_Device_Address_t device_address)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+DADDR=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+DADDR=");
 
     char device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -241,12 +245,12 @@ bool DaphnisI_LoRaWAN_SetDeviceAddress(DaphnisI_Device_Address_t device_address)
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, device_address_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, device_address_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -300,14 +304,15 @@ bool DaphnisI_LoRaWAN_GetDeviceAddress(DaphnisI_Device_Address_t* device_address
 bool DaphnisI_LoRaWAN_SetNetworkID(uint8_t network_id)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+NWKID=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+NWKID=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, network_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, network_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -372,17 +377,18 @@ bool DaphnisI_LoRaWAN_EraseStoredStackContext()
 bool DaphnisI_LoRaWAN_SetDeviceClass(DaphnisI_DeviceClass_t device_class)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+CLASS=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CLASS=");
 
     char device_class_string[2] = "A";
     device_class_string[0] += device_class;
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, device_class_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, device_class_string, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -431,11 +437,12 @@ bool DaphnisI_LoRaWAN_GetDeviceClass(DaphnisI_DeviceClass_t* device_classP)
 bool DaphnisI_LoRaWAN_Join(DaphnisI_JoinMode_t join_Mode)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+JOIN=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+JOIN=");
 
-    ATCommand_AppendArgumentInt(pRequestCommand, join_Mode, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE);
+    ATCommand_Builder_AppendInt(&builder, join_Mode, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE);
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -467,29 +474,25 @@ bool DaphnisI_LoRaWAN_Send(uint8_t port, const uint8_t* payload, uint16_t length
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+SEND=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+SEND=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, port, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, port, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, ack_Requested ? 1 : 0, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, ack_Requested ? 1 : 0, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_EVENT_DELIM))
     {
         return false;
     }
 
-    size_t pRequestCommandLength = strlen(pRequestCommand);
-
-    for (uint16_t i = 0; i < length; i++)
+    if (!ATCommand_Builder_AppendHex(&builder, payload, length, ATCOMMAND_STRING_TERMINATE))
     {
-        sprintf(&pRequestCommand[pRequestCommandLength], "%02" PRIX32, (uint32_t)payload[i]);
-        pRequestCommandLength += 2;
+        return false;
     }
 
-    pRequestCommand[pRequestCommandLength] = '\0';
-
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -505,14 +508,15 @@ bool DaphnisI_LoRaWAN_Send(uint8_t port, const uint8_t* payload, uint16_t length
 bool DaphnisI_LoRaWAN_SetDelay(DaphnisI_Delay_t delayType, uint16_t delayMS)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, DaphnisI_Delay_SetRequestStrings[delayType]);
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, DaphnisI_Delay_SetRequestStrings[delayType]);
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, delayMS, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, delayMS, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE16 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -559,14 +563,15 @@ bool DaphnisI_LoRaWAN_GetDelay(DaphnisI_Delay_t delayType, uint16_t* delayMSP)
 bool DaphnisI_LoRaWAN_SetRX2Frequency(uint32_t frequency)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+RX2FQ=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+RX2FQ=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, frequency, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, frequency, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE32, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -619,14 +624,15 @@ bool DaphnisI_LoRaWAN_SetRX2DataRate(uint8_t dataRate)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+RX2DR=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+RX2DR=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, dataRate, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, dataRate, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -679,14 +685,15 @@ bool DaphnisI_LoRaWAN_SetPingSlotPeriodicityFactor(uint8_t factor)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+PGSLOT=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+PGSLOT=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, factor, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, factor, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -739,14 +746,15 @@ bool DaphnisI_LoRaWAN_SetTxPower(uint8_t power)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+TXP=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+TXP=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, power, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, power, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -793,14 +801,15 @@ bool DaphnisI_LoRaWAN_GetTxPower(uint8_t* powerP)
 bool DaphnisI_LoRaWAN_SetAdaptiveDataRate(bool adr)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+ADR=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+ADR=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, adr, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, adr, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -853,14 +862,15 @@ bool DaphnisI_LoRaWAN_SetDataRate(uint8_t dataRate)
     }
 
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+DR=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+DR=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, dataRate, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, dataRate, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -907,14 +917,15 @@ bool DaphnisI_LoRaWAN_GetDataRate(uint8_t* dataRateP)
 bool DaphnisI_LoRaWAN_SetDutyCycleRestriction(bool dcRestriction)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+DCS=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+DCS=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, dcRestriction, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, dcRestriction, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_SIZE8, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
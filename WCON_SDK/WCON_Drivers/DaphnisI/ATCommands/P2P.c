@@ -37,15 +37,16 @@
 #include <stdio.h>
 #include <string.h>
 
-static bool DaphnisI_P2P_SendPayloadString(char* string, uint8_t* payloadP, uint16_t payload_length);
+static bool DaphnisI_P2P_SendPayloadString(ATCommand_Builder_t* pBuilder, uint8_t* payloadP, uint16_t payload_length);
 
 bool DaphnisI_P2P_TransmitBroadcast(uint8_t* payloadP, uint16_t payload_length)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+P2PBROADCASTTX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PBROADCASTTX=");
 
-    if (!DaphnisI_P2P_SendPayloadString(pRequestCommand, payloadP, payload_length))
+    if (!DaphnisI_P2P_SendPayloadString(&builder, payloadP, payload_length))
     {
         return false;
     }
@@ -58,10 +59,11 @@ bool DaphnisI_P2P_TransmitBroadcast(uint8_t* payloadP, uint16_t payload_length)
 bool DaphnisI_P2P_TransmitUnicast(uint8_t* payloadP, uint16_t payload_length)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+P2PUNICASTTX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PUNICASTTX=");
 
-    if (!DaphnisI_P2P_SendPayloadString(pRequestCommand, payloadP, payload_length))
+    if (!DaphnisI_P2P_SendPayloadString(&builder, payloadP, payload_length))
     {
         return false;
     }
@@ -79,10 +81,11 @@ bool DaphnisI_P2P_TransmitUnicast(uint8_t* payloadP, uint16_t payload_length)
 bool DaphnisI_P2P_TransmitMulticast(uint8_t* payloadP, uint16_t payload_length)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+P2PMULTICASTTX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PMULTICASTTX=");
 
-    if (!DaphnisI_P2P_SendPayloadString(pRequestCommand, payloadP, payload_length))
+    if (!DaphnisI_P2P_SendPayloadString(&builder, payloadP, payload_length))
     {
         return false;
     }
@@ -95,7 +98,8 @@ bool DaphnisI_P2P_TransmitMulticast(uint8_t* payloadP, uint16_t payload_length)
 bool DaphnisI_P2P_TransmitUnicastExtended(DaphnisI_Device_Address_t dest_address, uint8_t* payloadP, uint16_t payload_length)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PUNICASTEXTX=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PUNICASTEXTX=");
 
     char dest_device_address_string[BYTEARRAY_TO_KEYADDR_LENGTH(DAPHNISI_ADDRESS_LENGTH)];
 
@@ -104,12 +108,12 @@ bool DaphnisI_P2P_TransmitUnicastExtended(DaphnisI_Device_Address_t dest_address
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendString(&builder, dest_device_address_string, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!DaphnisI_P2P_SendPayloadString(pRequestCommand, payloadP, payload_length))
+    if (!DaphnisI_P2P_SendPayloadString(&builder, payloadP, payload_length))
     {
         return false;
     }
@@ -127,15 +131,16 @@ bool DaphnisI_P2P_TransmitUnicastExtended(DaphnisI_Device_Address_t dest_address
 bool DaphnisI_P2P_TransmitMulticastExtended(uint8_t group_id, uint8_t* payloadP, uint16_t payload_length)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+P2PMULTICASTEXTX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PMULTICASTEXTX=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, group_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, group_id, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
 
-    if (!DaphnisI_P2P_SendPayloadString(pRequestCommand, payloadP, payload_length))
+    if (!DaphnisI_P2P_SendPayloadString(&builder, payloadP, payload_length))
     {
         return false;
     }
@@ -148,14 +153,15 @@ bool DaphnisI_P2P_TransmitMulticastExtended(uint8_t group_id, uint8_t* payloadP,
 bool DaphnisI_P2P_SetRXEnabled(bool rx_state)
 {
     char* pRequestCommand = AT_commandBuffer;
-    strcpy(pRequestCommand, "AT+P2PRX=");
+    ATCommand_Builder_t builder;
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+P2PRX=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint8_t)rx_state, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, (uint8_t)rx_state, ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -199,7 +205,7 @@ bool DaphnisI_P2P_GetRXEnabled(bool* rx_stateP)
     return ATCommand_GetNextArgumentInt(&pRespondCommand, (uint8_t*)rx_stateP, ATCOMMAND_INTFLAGS_SIZE8 | ATCOMMAND_INTFLAGS_UNSIGNED | ATCOMMAND_INTFLAGS_NOTATION_DEC, ATCOMMAND_STRING_TERMINATE);
 }
 
-static bool DaphnisI_P2P_SendPayloadString(char* string, uint8_t* payloadP, uint16_t payload_length)
+static bool DaphnisI_P2P_SendPayloadString(ATCommand_Builder_t* pBuilder, uint8_t* payloadP, uint16_t payload_length)
 {
     if (payloadP == NULL)
     {
@@ -211,24 +217,17 @@ static bool DaphnisI_P2P_SendPayloadString(char* string, uint8_t* payloadP, uint
         return false;
     }
 
-    char payload_string[BYTEARRAY_TO_HEXSTRING_LENGTH(DAPHNISI_P2P_MAX_PAYLOAD_SIZE)];
-
-    if (!DaphnisI_ByteArrayToHexString(payloadP, payload_length, payload_string))
-    {
-        return false;
-    }
-
-    if (!ATCommand_AppendArgumentString(string, payload_string, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendHex(pBuilder, payloadP, payload_length, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!ATCommand_AppendArgumentString(string, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(pBuilder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
 
-    if (!DaphnisI_SendRequest(string))
+    if (!DaphnisI_SendRequest(pBuilder->buffer))
     {
         return false;
     }
@@ -82,6 +82,23 @@ static char DaphnisI_pendingCommandName[64] = {0};
  */
 static size_t DaphnisI_pendingCommandNameLength = 0;
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Performance counters and latency histograms (see DaphnisI_GetStatistics()).
+ */
+static WE_Stats_t DaphnisI_stats = {0};
+
+/**
+ * @brief Time the pending request has been sent (see DaphnisI_SendRequest()).
+ */
+static uint32_t DaphnisI_requestStartUs = 0;
+
+/**
+ * @brief Is true as long as the latency of the pending request hasn't been recorded.
+ */
+static bool DaphnisI_requestTimed = false;
+#endif
+
 /**
  * @brief Buffer used for current response text.
  */
@@ -157,7 +174,8 @@ static DaphnisI_Pins_t* DaphnisI_pinsP = NULL;
 static WE_UART_t* DaphnisI_uartP = NULL;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from DaphnisI.
+ * @brief Time step (microseconds) when waiting for responses from DaphnisI
+ * (maximum time between two checks, waiting ends as soon as the confirmation has been received).
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
@@ -165,6 +183,11 @@ static WE_UART_t* DaphnisI_uartP = NULL;
  */
 static uint32_t DaphnisI_waitTimeStepUsec = 1000;
 
+/**
+ * @brief Is signaled when a confirmation or an event has been received from DaphnisI.
+ */
+static WE_Event_t DaphnisI_confirmEvent = {0};
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to DaphnisI
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -193,6 +216,28 @@ DaphnisI_EventCallback_t DaphnisI_eventCallback;
  */
 static bool DaphnisI_executingEventCallback = false;
 
+/**
+ * @brief Serializes the access of several threads to the module (see DaphnisI_Lock()).
+ */
+static WE_Mutex_t DaphnisI_requestMutex = NULL;
+
+#if defined(WE_AT_RX_TASK)
+/**
+ * @brief Receive task, which executes the byte handler (see DaphnisI_SetByteRxCallback()) if supported by the platform.
+ */
+static ATCommand_RxTask_t DaphnisI_rxTask = {0};
+
+/**
+ * @brief Queues received data for the receive task.
+ */
+static void DaphnisI_EnqueueRxBytes(uint8_t* dataP, size_t size) { ATCommand_RxTask_Enqueue(&DaphnisI_rxTask, dataP, size); }
+
+/**
+ * @brief Byte handler passed to the UART if the receive task is running.
+ */
+static WE_UART_HandleRxByte_t DaphnisI_uartRxCallback = DaphnisI_EnqueueRxBytes;
+#endif
+
 /**
  * @brief  Array corresponding to the description of each possible AT Error
  */
@@ -231,6 +276,8 @@ static const ATCommand_Event_t moduleMainEvents[] = {PARENTEVENTENTRY("+CS", LoR
  */
 static void DaphnisI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
+    WE_STATS_ADD(&DaphnisI_stats, rxFrames, 1);
+
     WE_DEBUG_PRINT_DEBUG("< %s\r\n", rxPacket);
 
     if (DaphnisI_requestPending)
@@ -285,6 +332,20 @@ static void DaphnisI_HandleRxLine(char* rxPacket, uint16_t rxLength)
                 DaphnisI_currentResponseLength += chunkLength;
             }
         }
+
+        if (DaphnisI_CNFStatus_Invalid != DaphnisI_cmdConfirmStatus)
+        {
+#if defined(WE_STATS_ENABLED)
+            if (DaphnisI_requestTimed)
+            {
+                DaphnisI_requestTimed = false;
+                WE_STATS_COMPLETE_REQUEST(&DaphnisI_stats, WE_Stats_Hash(DaphnisI_pendingCommandName, DaphnisI_pendingCommandNameLength), DaphnisI_pendingCommandName, DaphnisI_requestStartUs);
+            }
+#endif
+
+            /* Wake up DaphnisI_WaitForConfirm() */
+            WE_SignalEvent(&DaphnisI_confirmEvent);
+        }
     }
 
     if ('+' == rxPacket[0])
@@ -305,6 +366,9 @@ static void DaphnisI_HandleRxLine(char* rxPacket, uint16_t rxLength)
             }
         }
 
+        /* Wake up DaphnisI_WaitForEvents() */
+        WE_SignalEvent(&DaphnisI_confirmEvent);
+
         /* An event occurred. Execute callback (if specified). */
         if (NULL != DaphnisI_eventCallback)
         {
@@ -324,6 +388,8 @@ static void DaphnisI_HandleRxLine(char* rxPacket, uint16_t rxLength)
  */
 static void DaphnisI_HandleRxByte(uint8_t* dataP, size_t size)
 {
+    WE_STATS_ADD(&DaphnisI_stats, rxBytes, size);
+
     uint8_t receivedByte;
     for (; size > 0; size--, dataP++)
     {
@@ -344,6 +410,7 @@ static void DaphnisI_HandleRxByte(uint8_t* dataP, size_t size)
         {
             if (DaphnisI_rxByteCounter >= DAPHNISI_LINE_MAX_SIZE)
             {
+                WE_STATS_ADD(&DaphnisI_stats, parseErrors, 1);
                 DaphnisI_rxByteCounter = 0;
                 DaphnisI_eolChar1Found = false;
                 return;
@@ -386,6 +453,9 @@ static void DaphnisI_HandleRxByte(uint8_t* dataP, size_t size)
 bool DaphnisI_Init(WE_UART_t* uartP, DaphnisI_Pins_t* pinoutP, DaphnisI_EventCallback_t eventCallback)
 {
     DaphnisI_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&DaphnisI_stats);
+#endif
 
     /* Callbacks */
     DaphnisI_eventCallback = eventCallback;
@@ -422,7 +492,21 @@ bool DaphnisI_Init(WE_UART_t* uartP, DaphnisI_Pins_t* pinoutP, DaphnisI_EventCal
     }
 
     DaphnisI_uartP = uartP;
-    if (false == DaphnisI_uartP->uartInit(DaphnisI_uartP->baudrate, DaphnisI_uartP->flowControl, DaphnisI_uartP->parity, &byteRxCallback))
+
+    if ((NULL == DaphnisI_requestMutex) && !WE_Mutex_Create(&DaphnisI_requestMutex))
+    {
+        return false;
+    }
+
+    WE_UART_HandleRxByte_t* uartRxCallbackP = &byteRxCallback;
+#if defined(WE_AT_RX_TASK)
+    if (ATCommand_RxTask_Start(&DaphnisI_rxTask, &byteRxCallback, "DaphnisI_RX"))
+    {
+        /* Received data is passed to the byte handler by the receive task */
+        uartRxCallbackP = &DaphnisI_uartRxCallback;
+    }
+#endif
+    if (false == DaphnisI_uartP->uartInit(DaphnisI_uartP->baudrate, DaphnisI_uartP->flowControl, DaphnisI_uartP->parity, uartRxCallbackP))
     {
         return false;
     }
@@ -496,9 +580,27 @@ static bool DaphnisI_Transparent_Transmit(const char* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&DaphnisI_stats, dataLength, false);
     return DaphnisI_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+#if defined(WE_STATS_ENABLED)
+bool DaphnisI_GetStatistics(WE_Stats_t* statsP)
+{
+    if (!WE_Stats_Snapshot(&DaphnisI_stats, DaphnisI_uartP, statsP))
+    {
+        return false;
+    }
+#if defined(WE_AT_RX_TASK)
+    /* Data discarded by the receive task counts as receive overflow as well */
+    statsP->rxDroppedBytes += DaphnisI_rxTask.droppedBytes;
+#endif
+    return true;
+}
+
+void DaphnisI_ResetStatistics() { WE_Stats_Reset(&DaphnisI_stats); }
+#endif
+
 bool DaphnisI_PinReset(void)
 {
     if (!WE_SetPin(DaphnisI_pinsP->DaphnisI_Pin_Reset, WE_Pin_Level_Low))
@@ -530,9 +632,18 @@ bool DaphnisI_PinWakeUp(void)
 
 bool DaphnisI_SetPin(WE_Pin_t pin, WE_Pin_Level_t level) { return WE_SetPin(pin, level); }
 
+bool DaphnisI_Lock(uint32_t timeoutMs) { return WE_Mutex_Lock(DaphnisI_requestMutex, timeoutMs); }
+
+void DaphnisI_Unlock(void) { WE_Mutex_Unlock(DaphnisI_requestMutex); }
+
 bool DaphnisI_SendRequest(char* data)
 {
+#if defined(WE_AT_RX_TASK)
+    /* If running, the receive task executes the event callbacks - other threads may send requests in the meantime */
+    if (DaphnisI_executingEventCallback && ATCommand_RxTask_IsCurrentContext(&DaphnisI_rxTask))
+#else
     if (DaphnisI_executingEventCallback)
+#endif
     {
         /* Don't allow sending AT commands from event handlers, as this will
          * mess up send/receive states and buffers. */
@@ -568,6 +679,11 @@ bool DaphnisI_SendRequest(char* data)
 
     WE_DEBUG_PRINT_DEBUG("> %s", data);
 
+#if defined(WE_STATS_ENABLED)
+    DaphnisI_stats.txFrames++;
+    WE_STATS_START_REQUEST(DaphnisI_requestStartUs);
+    DaphnisI_requestTimed = true;
+#endif
     DaphnisI_Transparent_Transmit(data, dataLength);
 
     return true;
@@ -612,10 +728,12 @@ bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedSt
 
         if (DaphnisI_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(DaphnisI_waitTimeStepUsec);
+            /* Returns as soon as the confirmation has been received */
+            WE_WaitEvent(&DaphnisI_confirmEvent, (DaphnisI_waitTimeStepUsec + 999) / 1000);
         }
     }
 
+    WE_STATS_ADD(&DaphnisI_stats, timeouts, 1);
     DaphnisI_requestPending = false;
     return false;
 }
@@ -656,7 +774,8 @@ DaphnisI_ATEvent_t DaphnisI_WaitForEvents(uint32_t maxTimeMs, DaphnisI_ATEvent_t
 
         if (DaphnisI_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(DaphnisI_waitTimeStepUsec);
+            /* Returns as soon as an event has been received */
+            WE_WaitEvent(&DaphnisI_confirmEvent, (DaphnisI_waitTimeStepUsec + 999) / 1000);
         }
     }
 
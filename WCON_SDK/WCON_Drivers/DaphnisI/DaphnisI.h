@@ -32,6 +32,7 @@
 #define DAPHNISI_H_INCLUDED
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 
 /**
@@ -228,6 +229,25 @@ extern bool DaphnisI_PinWakeUp(void);
  */
 extern bool DaphnisI_SetPin(WE_Pin_t pin, WE_Pin_Level_t level);
 
+/**
+ * @brief Locks the driver for exclusive use by the calling thread.
+ *
+ * The AT command functions share the command buffer (AT_commandBuffer) and the state of the pending request.
+ * If the driver is used by several threads, each call (or sequence of calls) of driver functions needs to be
+ * enclosed in DaphnisI_Lock() and DaphnisI_Unlock(). The lock may be acquired several times by the same thread.
+ * Must not be called from the event callback. On bare metal platforms, this function has no effect.
+ *
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the driver has been locked, false if the timeout has expired
+ */
+extern bool DaphnisI_Lock(uint32_t timeoutMs);
+
+/**
+ * @brief Releases the lock acquired using DaphnisI_Lock().
+ */
+extern void DaphnisI_Unlock(void);
+
 /**
  * @brief Sends the supplied AT command to the module
  *
@@ -248,6 +268,24 @@ extern bool DaphnisI_SendRequest(char* data);
  */
 extern bool DaphnisI_WaitForConfirm(uint32_t maxTimeMs, DaphnisI_CNFStatus_t expectedStatus, char* pOutResponse);
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * The latency histograms are kept per AT command name (see WE_Stats_Hash()).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool DaphnisI_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void DaphnisI_ResetStatistics();
+#endif
+
 /**
  * @brief Waits for an event from the module.
  *
@@ -29,6 +29,7 @@
  */
 
 #include <Metis/Metis.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -89,9 +90,6 @@
 #define METIS_CMD_FACTORYRESET_REQ (METIS_CMD_FACTORYRESET | METIS_CMD_TYPE_REQ)
 #define METIS_CMD_FACTORYRESET_CNF (METIS_CMD_FACTORYRESET | METIS_CMD_TYPE_CNF)
 
-void Metis_HandleRxByte(uint8_t* dataP, size_t size);
-static WE_UART_HandleRxByte_t byteRxCallback = Metis_HandleRxByte;
-
 /**
  * @brief Type used to check the response, when a command was sent to the module
  */
@@ -111,45 +109,62 @@ typedef struct
     uint8_t Data[MAX_PAYLOAD_LENGTH + 1]; /* +1 for the CS */
 } Metis_CMD_Frame_t;
 
-typedef struct
-{
-    uint8_t cmd;               /* variable to check if correct CMD has been confirmed */
-    Metis_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the module */
-} Metis_CMD_Confirmation_t;
-
 typedef struct
 {
     uint8_t memoryPosition;   /* memory position of requested usersetting */
     uint8_t lengthGetRequest; /* length of one or more requested usersetting */
 } Metis_US_Confirmation_t;
 
-/**************************************
- *          Static variables          *
- **************************************/
+/**
+ * @brief State of a Metis driver instance.
+ */
+struct Metis_Handle_t
+{
+    Metis_Pins_t* pinsP;                                                         /**< pin configuration struct pointer */
+    WE_UART_t* uartP;                                                            /**< UART configuration struct pointer */
+    Metis_CMD_Frame_t rxPacket;                                                  /**< data buffer for RX */
+    Metis_CMD_Frame_t txPacket;                                                  /**< request to be sent to the module */
+    CMDFrame_ConfirmationQueue_t cmdConfirmations;                               /**< received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t stats;                                                            /**< performance counters and latency histograms */
+#endif
+    Metis_US_Confirmation_t usConfirmation;                                      /**< variable used to check if GET function was successful */
+    Metis_Frequency_t frequency;                                                 /**< frequency used by module */
+    bool rssi_enable;                                                            /**< RSSI value is appended to received data */
+    CMDFrame_Parser_t rxParser;                                                  /**< assembles the frames received from the module */
+    uint8_t rxBuffer[sizeof(Metis_CMD_Frame_t)];                                 /**< data buffer for RX */
+    Metis_RxCallback_t RxCallback;                                               /**< callback function */
+    WE_UART_HandleRxByte_t byteRxCallback;                                       /**< function called by the UART driver on data reception */
+};
 
 /**
- * @brief Pin configuration struct pointer.
+ * @brief Initial state of a driver instance.
  */
-static Metis_Pins_t* Metis_pinsP = NULL;
+#define HANDLE_INITIALIZER {.txPacket = {.Stx = CMD_STX, .Length = 0}}
+
+#if METIS_MAX_INSTANCES > 4
+#error "METIS_MAX_INSTANCES must not exceed 4"
+#endif
+
+/**************************************
+ *          Static variables          *
+ **************************************/
+static Metis_Handle_t instances[METIS_MAX_INSTANCES] = {HANDLE_INITIALIZER,
+#if METIS_MAX_INSTANCES > 1
+                                                        HANDLE_INITIALIZER,
+#endif
+#if METIS_MAX_INSTANCES > 2
+                                                        HANDLE_INITIALIZER,
+#endif
+#if METIS_MAX_INSTANCES > 3
+                                                        HANDLE_INITIALIZER,
+#endif
+};
 
 /**
- * @brief Uart configuration struct pointer.
+ * @brief Instance used by the functions without handle parameter.
  */
-static WE_UART_t* Metis_uartP = NULL;
-static Metis_CMD_Frame_t rxPacket;                                 /* data buffer for RX */
-static Metis_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
-
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static Metis_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
-static Metis_US_Confirmation_t usConfirmation; /* variable used to check if GET function was successful */
-static Metis_Frequency_t frequency;            /* frequency used by module */
-static bool rssi_enable = false;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint8_t bytesToReceive = 0;                  /* read buffer for next available byte */
-static uint8_t rxBuffer[sizeof(Metis_CMD_Frame_t)]; /* data buffer for RX */
-static Metis_RxCallback_t RxCallback;
-/* callback function */
+#define DEFAULT_HANDLE (&instances[0])
 
 /**************************************
  *          Static functions          *
@@ -160,13 +175,7 @@ static Metis_RxCallback_t RxCallback;
  */
 static void FillChecksum(Metis_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint8_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
 }
 
 static int8_t CalculateRSSIValue(uint8_t rxLevel)
@@ -175,257 +184,244 @@ static int8_t CalculateRSSIValue(uint8_t rxLevel)
     return (rxLevel < 128) ? (rxLevel / 2 - offset) : ((rxLevel - 256) / 2 - offset);
 }
 
-static void HandleRxPacket(uint8_t* packetData)
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    Metis_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
-
-    uint8_t cmd_length = packetData[2];
-    memcpy((uint8_t*)&rxPacket, packetData, cmd_length + 4); /* payload + std + command + length byte + checksum */
+    Metis_Handle_t* handle = (Metis_Handle_t*)context;
 
-    switch (rxPacket.Cmd)
+    /* the call of the handle->RxCallback strongly depends on the configuration of the module */
+    if (handle->RxCallback != NULL)
     {
-        case METIS_CMD_DATA_IND:
+        if (handle->rssi_enable == 0x01)
         {
-            /* the call of the RxCallback strongly depends on the configuration of the module */
-            if (RxCallback != NULL)
-            {
-                if (rssi_enable == 0x01)
-                {
-                    /* the following implementation expects that the RSSI_Enable usersetting is enabled */
-                    rxPacket.Length = rxPacket.Length - 1;
-                    RxCallback(&rxPacket.Length, rxPacket.Length + 1, CalculateRSSIValue(rxPacket.Data[rxPacket.Length]));
-                }
-                else
-                {
-                    /* the following implementation expects that the RSSI_Enable usersetting is disabled */
-                    RxCallback(&rxPacket.Length, rxPacket.Length + 1, (int8_t)RSSIINVALID);
-                }
-            }
+            /* the following implementation expects that the RSSI_Enable usersetting is enabled */
+            frame->frameP[2] = frame->length - 1;
+            handle->RxCallback(&frame->frameP[2], frame->length, CalculateRSSIValue(frame->data[frame->length - 1]));
         }
-        break;
-
-        case METIS_CMD_GET_CNF:
+        else
         {
-            /* Data[0] contains memory position of usersetting
-         * Data[1] contains length of parameter, which is depending on usersetting
-         * On success mode responds with usersetting, length of parameter and parameter
-         */
-            switch (rxPacket.Data[0])
-            {
-                /* usersettings with value length of 1 byte */
-                case (Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE):
-                case (Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE):
-                case (Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER):
-                case (Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE):
-                case (Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT):
-                {
-                    /* check if correct usersetting was changed and if length corresponds to usersetting */
-                    if ((usConfirmation.memoryPosition == rxPacket.Data[0]) && (usConfirmation.lengthGetRequest == rxPacket.Data[1]))
-                    {
-                        cmdConfirmation.status = CMD_Status_Success;
-                    }
-                    else
-                    {
-                        cmdConfirmation.status = CMD_Status_Failed;
-                    }
-                    cmdConfirmation.cmd = rxPacket.Cmd;
-                }
-                break;
-                    /* usersettings with value length of 2 byte*/
-                case (Metis_USERSETTING_MEMPOSITION_CFG_FLAGS):
-                {
-                    /* check if correct usersetting was changed and if length corresponds to usersetting */
-                    if ((usConfirmation.memoryPosition == rxPacket.Data[0]) && (usConfirmation.lengthGetRequest == rxPacket.Data[1]))
-                    {
-                        cmdConfirmation.status = CMD_Status_Success;
-                    }
-                    else
-                    {
-                        cmdConfirmation.status = CMD_Status_Failed;
-                    }
-                    cmdConfirmation.cmd = rxPacket.Cmd;
-                }
-                break;
-
-                default:
-                    break;
-            }
+            /* the following implementation expects that the RSSI_Enable usersetting is disabled */
+            handle->RxCallback(&frame->frameP[2], frame->length + 1, (int8_t)RSSIINVALID);
         }
-        break;
+    }
+}
 
-        case METIS_CMD_FACTORYRESET_CNF:
-        case METIS_CMD_SET_CNF:
-        case METIS_CMD_SET_MODE_CNF:
-        case METIS_CMD_RESET_CNF:
-        case METIS_CMD_DATA_CNF:
-        case METIS_CMD_SETUARTSPEED_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+static void HandleGetCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    Metis_Handle_t* handle = (Metis_Handle_t*)context;
 
-        case METIS_CMD_GET_SERIALNO_CNF:
+    /* Data[0] contains memory position of usersetting
+     * Data[1] contains length of parameter, which is depending on usersetting
+     * On success mode responds with usersetting, length of parameter and parameter
+     */
+    switch (frame->data[0])
+    {
+        /* usersettings with value length of 1 byte */
+        case (Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE):
+        case (Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE):
+        case (Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER):
+        case (Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE):
+        case (Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT):
         {
-            cmdConfirmation.status = (rxPacket.Length == 4) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
+            /* check if correct usersetting was changed and if length corresponds to usersetting */
+            if ((handle->usConfirmation.memoryPosition == frame->data[0]) && (handle->usConfirmation.lengthGetRequest == frame->data[1]))
+            {
+                confirmation->status = CMD_Status_Success;
+            }
+            else
+            {
+                confirmation->status = CMD_Status_Failed;
+            }
+            confirmation->cmd = frame->cmd;
         }
         break;
-
-        case METIS_CMD_GET_FWRELEASE_CNF:
+            /* usersettings with value length of 2 byte*/
+        case (Metis_USERSETTING_MEMPOSITION_CFG_FLAGS):
         {
-            cmdConfirmation.status = (rxPacket.Length == 3) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
+            /* check if correct usersetting was changed and if length corresponds to usersetting */
+            if ((handle->usConfirmation.memoryPosition == frame->data[0]) && (handle->usConfirmation.lengthGetRequest == frame->data[1]))
+            {
+                confirmation->status = CMD_Status_Success;
+            }
+            else
+            {
+                confirmation->status = CMD_Status_Failed;
+            }
+            confirmation->cmd = frame->cmd;
         }
         break;
+
         default:
             break;
     }
+}
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
-    }
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
 }
 
-static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, Metis_CMD_Status_t expectedStatus, bool reset_confirmstate)
+static void HandleGetSerialNumberCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    int count = 0;
-    int time_step_ms = 5; /* 5ms */
-    int max_count = max_time_ms / time_step_ms;
+    confirmation->status = (frame->length == 4) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
 
-    if (reset_confirmstate)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
-    }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
+static void HandleGetFirmwareReleaseCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->length == 3) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
 
-        if (count >= max_count)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [METIS_CMD_DATA_IND]          = HandleDataInd,
+    [METIS_CMD_GET_CNF]           = HandleGetCnf,
+    [METIS_CMD_FACTORYRESET_CNF]  = HandleStatusCnf,
+    [METIS_CMD_SET_CNF]           = HandleStatusCnf,
+    [METIS_CMD_SET_MODE_CNF]      = HandleStatusCnf,
+    [METIS_CMD_RESET_CNF]         = HandleStatusCnf,
+    [METIS_CMD_DATA_CNF]          = HandleStatusCnf,
+    [METIS_CMD_SETUARTSPEED_CNF]  = HandleStatusCnf,
+    [METIS_CMD_GET_SERIALNO_CNF]  = HandleGetSerialNumberCnf,
+    [METIS_CMD_GET_FWRELEASE_CNF] = HandleGetFirmwareReleaseCnf,
+};
+
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    Metis_Handle_t* handle = (Metis_Handle_t*)context;
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
+
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
 
-        /* wait */
-        count++;
-        WE_Delay(time_step_ms);
+    if (cmdConfirmation.cmd != CNFINVALID)
+    {
+        CMDFrame_ConfirmationQueue_Add(&handle->cmdConfirmations, &cmdConfirmation, frame);
     }
-    return true;
 }
 
-void Metis_HandleRxByte(uint8_t* dataP, size_t size)
+static bool Wait4CNF(Metis_Handle_t* handle, uint32_t max_time_ms, uint8_t expectedCmdConfirmation, Metis_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    for (; size > 0; size--, dataP++)
+    if (reset_confirmstate)
     {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
+    }
 
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for SFD */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = (rxBuffer[rxByteCounter - 1] + 4); /* len + crc + sfd + cmd */
-                break;
-
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint8_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&handle->cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
+    return (status == expectedStatus);
+}
+
+/**
+ * @brief Registers handle->rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(Metis_Handle_t* handle, uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&handle->cmdConfirmations, expectedCmdConfirmation, &handle->rxPacket, sizeof(handle->rxPacket)); }
+
+static void Metis_HandleRxByte(Metis_Handle_t* handle, uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&handle->rxParser, dataP, size);
 }
 
-bool Metis_Transparent_Transmit(const uint8_t* dataP, uint16_t dataLength)
+/*
+ * The UART driver calls the byte handler without any context, so each instance
+ * needs its own handler function.
+ */
+static void Metis_HandleRxByte0(uint8_t* dataP, size_t size) { Metis_HandleRxByte(&instances[0], dataP, size); }
+#if METIS_MAX_INSTANCES > 1
+static void Metis_HandleRxByte1(uint8_t* dataP, size_t size) { Metis_HandleRxByte(&instances[1], dataP, size); }
+#endif
+#if METIS_MAX_INSTANCES > 2
+static void Metis_HandleRxByte2(uint8_t* dataP, size_t size) { Metis_HandleRxByte(&instances[2], dataP, size); }
+#endif
+#if METIS_MAX_INSTANCES > 3
+static void Metis_HandleRxByte3(uint8_t* dataP, size_t size) { Metis_HandleRxByte(&instances[3], dataP, size); }
+#endif
+
+/**
+ * @brief Byte handler of each instance.
+ */
+static const WE_UART_HandleRxByte_t rxByteHandlers[METIS_MAX_INSTANCES] = {Metis_HandleRxByte0,
+#if METIS_MAX_INSTANCES > 1
+                                                                           Metis_HandleRxByte1,
+#endif
+#if METIS_MAX_INSTANCES > 2
+                                                                           Metis_HandleRxByte2,
+#endif
+#if METIS_MAX_INSTANCES > 3
+                                                                           Metis_HandleRxByte3,
+#endif
+};
+
+bool Metis_Handle_Transparent_Transmit(Metis_Handle_t* handle, const uint8_t* dataP, uint16_t dataLength)
 {
     if ((dataP == NULL) || (dataLength == 0))
     {
         return false;
     }
 
-    return Metis_uartP->uartTransmit((uint8_t*)dataP, dataLength);
+    WE_STATS_TRANSMIT(&handle->stats, dataLength, dataP == (const uint8_t*)&handle->txPacket);
+
+    CMDFRAME_STATS_START_REQUEST(&handle->cmdConfirmations, dataP == (const uint8_t*)&handle->txPacket);
+    return handle->uartP->uartTransmit((uint8_t*)dataP, dataLength);
 }
 
-bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq, Metis_Mode_Preselect_t mode, bool enable_rssi, Metis_RxCallback_t RXcb)
+uint32_t Metis_Handle_GetConfirmationOverflowCount(Metis_Handle_t* handle) { return handle->cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool Metis_Handle_GetStatistics(Metis_Handle_t* handle, WE_Stats_t* statsP) { return WE_Stats_Snapshot(&handle->stats, handle->uartP, statsP); }
+
+void Metis_Handle_ResetStatistics(Metis_Handle_t* handle) { WE_Stats_Reset(&handle->stats); }
+#endif
+
+bool Metis_Handle_Init(Metis_Handle_t* handle, WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq, Metis_Mode_Preselect_t mode, bool enable_rssi, Metis_RxCallback_t RXcb)
 {
-    /* set frequency used by module */
-    frequency = freq;
+    /* set handle->frequency used by module */
+    handle->frequency = freq;
 
     /* set RX callback function */
-    RxCallback = RXcb;
+    handle->RxCallback = RXcb;
 
-    /* set rssi_enable */
-    rssi_enable = enable_rssi;
+    /* set handle->rssi_enable */
+    handle->rssi_enable = enable_rssi;
 
     if ((pinoutP == NULL) || (uartP == NULL) || (uartP->uartInit == NULL) || (uartP->uartDeinit == NULL) || (uartP->uartTransmit == NULL))
     {
         return false;
     }
 
-    Metis_pinsP = pinoutP;
-    Metis_pinsP->Metis_Pin_Reset.type = WE_Pin_Type_Output;
-    Metis_pinsP->Metis_Pin_Reset.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP = pinoutP;
+    handle->pinsP->Metis_Pin_Reset.type = WE_Pin_Type_Output;
+    handle->pinsP->Metis_Pin_Reset.initial_value.output = WE_Pin_Level_High;
 
-    if (!WE_InitPins(&Metis_pinsP->Metis_Pin_Reset, 1))
+    if (!WE_InitPins(&handle->pinsP->Metis_Pin_Reset, 1))
     {
         /* error */
         return false;
     }
 
-    Metis_uartP = uartP;
-    if (!Metis_uartP->uartInit(Metis_uartP->baudrate, Metis_uartP->flowControl, Metis_uartP->parity, &byteRxCallback))
+    handle->byteRxCallback = rxByteHandlers[handle - instances];
+
+    CMDFrame_Parser_Init(&handle->rxParser, CMD_STX, sizeof(handle->rxPacket.Length), handle->rxBuffer, sizeof(handle->rxBuffer), HandleRxPacket, handle);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&handle->stats);
+    handle->rxParser.stats = &handle->stats;
+    handle->cmdConfirmations.stats = &handle->stats;
+#endif
+
+    handle->uartP = uartP;
+    if (!handle->uartP->uartInit(handle->uartP->baudrate, handle->uartP->flowControl, handle->uartP->parity, &handle->byteRxCallback))
     {
         return false;
     }
@@ -437,7 +433,7 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
      * Setting is written to flash so write only if necessary
      */
     uint8_t uartEnable;
-    if (!Metis_GetUartOutEnable(&uartEnable))
+    if (!Metis_Handle_GetUartOutEnable(handle, &uartEnable))
     {
         return false;
     }
@@ -445,14 +441,14 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
     if (uartEnable != 1)
     {
         WE_Delay(50);
-        if (Metis_SetUartOutEnable(1))
+        if (Metis_Handle_SetUartOutEnable(handle, 1))
         {
             WE_Delay(50);
         }
         else
         {
             WE_DEBUG_PRINT_INFO("Set UART_CMD_OUT_MODE failed\r\n");
-            Metis_Deinit();
+            Metis_Handle_Deinit(handle);
             return false;
         }
     }
@@ -461,22 +457,22 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
      * Setting is written to flash so write only if necessary
      */
     uint8_t rssi;
-    if (!Metis_GetRSSIEnable(&rssi))
+    if (!Metis_Handle_GetRSSIEnable(handle, &rssi))
     {
         return false;
     }
 
-    if (rssi != rssi_enable)
+    if (rssi != handle->rssi_enable)
     {
         WE_Delay(50);
-        if (Metis_SetRSSIEnable(rssi_enable ? 1 : 0))
+        if (Metis_Handle_SetRSSIEnable(handle, handle->rssi_enable ? 1 : 0))
         {
             WE_Delay(50);
         }
         else
         {
             WE_DEBUG_PRINT_INFO("Set RSSI failed\r\n");
-            Metis_Deinit();
+            Metis_Handle_Deinit(handle);
             return false;
         }
     }
@@ -485,7 +481,7 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
      * Setting is written to flash so write only if necessary
      */
     uint8_t aesEnable;
-    if (!Metis_GetAESEnable(&aesEnable))
+    if (!Metis_Handle_GetAESEnable(handle, &aesEnable))
     {
         return false;
     }
@@ -493,14 +489,14 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
     if (aesEnable != 0)
     {
         WE_Delay(50);
-        if (Metis_SetAESEnable(0))
+        if (Metis_Handle_SetAESEnable(handle, 0))
         {
             WE_Delay(50);
         }
         else
         {
             WE_DEBUG_PRINT_INFO("Set AESEnable failed\r\n");
-            Metis_Deinit();
+            Metis_Handle_Deinit(handle);
             return false;
         }
     }
@@ -509,7 +505,7 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
      * Setting is written to flash so write only if necessary
      */
     uint8_t modePreselect;
-    if (!Metis_GetModePreselect(&modePreselect))
+    if (!Metis_Handle_GetModePreselect(handle, &modePreselect))
     {
         return false;
     }
@@ -517,118 +513,118 @@ bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq,
     if (modePreselect != mode)
     {
         WE_Delay(50);
-        if (Metis_SetModePreselect(mode))
+        if (Metis_Handle_SetModePreselect(handle, mode))
         {
             WE_Delay(50);
         }
         else
         {
             WE_DEBUG_PRINT_INFO("Set mode preselect failed\r\n");
-            Metis_Deinit();
+            Metis_Handle_Deinit(handle);
             return false;
         }
     }
 
     /* Reset module to apply changes */
-    if (Metis_Reset())
+    if (Metis_Handle_Reset(handle))
     {
         WE_Delay(300);
     }
     else
     {
         WE_DEBUG_PRINT_INFO("Reset failed\r\n");
-        Metis_Deinit();
+        Metis_Handle_Deinit(handle);
         return false;
     }
     return true;
 }
 
-bool Metis_Deinit()
+bool Metis_Handle_Deinit(Metis_Handle_t* handle)
 {
     /* deinit pins */
-    if (!WE_DeinitPins(&Metis_pinsP->Metis_Pin_Reset, 1))
+    if (!WE_DeinitPins(&handle->pinsP->Metis_Pin_Reset, 1))
     {
         return false;
     }
 
     /* deinit RX callback */
-    RxCallback = NULL;
+    handle->RxCallback = NULL;
 
-    return Metis_uartP->uartDeinit();
+    return handle->uartP->uartDeinit();
 }
 
-bool Metis_PinReset()
+bool Metis_Handle_PinReset(Metis_Handle_t* handle)
 {
-    if (!WE_SetPin(Metis_pinsP->Metis_Pin_Reset, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->Metis_Pin_Reset, WE_Pin_Level_Low))
     {
         return false;
     }
 
     WE_Delay(5);
 
-    return WE_SetPin(Metis_pinsP->Metis_Pin_Reset, WE_Pin_Level_High);
+    return WE_SetPin(handle->pinsP->Metis_Pin_Reset, WE_Pin_Level_High);
     ;
 }
 
-bool Metis_Reset()
+bool Metis_Handle_Reset(Metis_Handle_t* handle)
 {
-    txPacket.Cmd = METIS_CMD_RESET_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = METIS_CMD_RESET_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_RESET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_RESET_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_FactoryReset()
+bool Metis_Handle_FactoryReset(Metis_Handle_t* handle)
 {
-    txPacket.Cmd = METIS_CMD_FACTORYRESET_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = METIS_CMD_FACTORYRESET_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_FACTORYRESET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_FACTORYRESET_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_SetUartSpeed(Metis_UartBaudrate_t baudrate)
+bool Metis_Handle_SetUartSpeed(Metis_Handle_t* handle, Metis_UartBaudrate_t baudrate)
 {
-    txPacket.Cmd = METIS_CMD_SETUARTSPEED;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = baudrate;
+    handle->txPacket.Cmd = METIS_CMD_SETUARTSPEED;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = baudrate;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_SETUARTSPEED_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_SETUARTSPEED_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_Get(Metis_UserSettings_t us, uint8_t* responseP, uint8_t* response_lengthP)
+bool Metis_Handle_Get(Metis_Handle_t* handle, Metis_UserSettings_t us, uint8_t* responseP, uint8_t* response_lengthP)
 {
     if (responseP == NULL || response_lengthP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = METIS_CMD_GET_REQ;
-    txPacket.Length = 0x02;
-    txPacket.Data[0] = us;
+    handle->txPacket.Cmd = METIS_CMD_GET_REQ;
+    handle->txPacket.Length = 0x02;
+    handle->txPacket.Data[0] = us;
 
     switch (us)
     {
@@ -639,84 +635,86 @@ bool Metis_Get(Metis_UserSettings_t us, uint8_t* responseP, uint8_t* response_le
         case (Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE):
         case (Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT):
         {
-            txPacket.Data[1] = 0x01;
+            handle->txPacket.Data[1] = 0x01;
         }
         break;
             /* usersettings with value length 2 */
         case (Metis_USERSETTING_MEMPOSITION_CFG_FLAGS):
         {
-            txPacket.Data[1] = 0x02;
+            handle->txPacket.Data[1] = 0x02;
         }
         break;
         default:
             break;
     }
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, METIS_CMD_GET_CNF);
+    FillChecksum(&handle->txPacket);
 
-    usConfirmation.memoryPosition = us;
-    usConfirmation.lengthGetRequest = txPacket.Data[1];
+    handle->usConfirmation.memoryPosition = us;
+    handle->usConfirmation.lengthGetRequest = handle->txPacket.Data[1];
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    bool ret = Wait4CNF(CMD_WAIT_TIME, METIS_CMD_GET_CNF, CMD_Status_Success, true);
+    bool ret = Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_GET_CNF, CMD_Status_Success, true);
 
     if (ret)
     {
-        int length = rxPacket.Length - 2;
-        memcpy(responseP, &rxPacket.Data[2], length);
+        int length = handle->rxPacket.Length - 2;
+        memcpy(responseP, &handle->rxPacket.Data[2], length);
         *response_lengthP = length;
     }
 
-    usConfirmation.memoryPosition = -1;
-    usConfirmation.lengthGetRequest = -1;
+    handle->usConfirmation.memoryPosition = -1;
+    handle->usConfirmation.lengthGetRequest = -1;
 
     return ret;
 }
 
-bool Metis_GetMultiple(uint8_t startAddress, uint8_t lengthToRead, uint8_t* responseP, uint8_t* response_lengthP)
+bool Metis_Handle_GetMultiple(Metis_Handle_t* handle, uint8_t startAddress, uint8_t lengthToRead, uint8_t* responseP, uint8_t* response_lengthP)
 {
     if ((responseP == NULL) || (response_lengthP == NULL) || (lengthToRead == 0))
     {
         return false;
     }
 
-    txPacket.Cmd = METIS_CMD_GET_REQ;
-    txPacket.Length = 0x02;
-    txPacket.Data[0] = startAddress;
-    txPacket.Data[1] = lengthToRead;
+    handle->txPacket.Cmd = METIS_CMD_GET_REQ;
+    handle->txPacket.Length = 0x02;
+    handle->txPacket.Data[0] = startAddress;
+    handle->txPacket.Data[1] = lengthToRead;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, METIS_CMD_GET_CNF);
+    FillChecksum(&handle->txPacket);
 
-    usConfirmation.memoryPosition = startAddress;
-    usConfirmation.lengthGetRequest = lengthToRead;
+    handle->usConfirmation.memoryPosition = startAddress;
+    handle->usConfirmation.lengthGetRequest = lengthToRead;
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    bool ret = Wait4CNF(CMD_WAIT_TIME, METIS_CMD_GET_CNF, CMD_Status_Success, true);
+    bool ret = Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_GET_CNF, CMD_Status_Success, true);
 
     if (ret)
     {
-        int length = rxPacket.Length - 2;
-        memcpy(responseP, &rxPacket.Data[2], length);
+        int length = handle->rxPacket.Length - 2;
+        memcpy(responseP, &handle->rxPacket.Data[2], length);
         *response_lengthP = length;
     }
 
-    usConfirmation.memoryPosition = -1;
-    usConfirmation.lengthGetRequest = -1;
+    handle->usConfirmation.memoryPosition = -1;
+    handle->usConfirmation.lengthGetRequest = -1;
 
     return ret;
 }
 
-bool Metis_CheckNSet(Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+bool Metis_Handle_CheckNSet(Metis_Handle_t* handle, Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
@@ -726,7 +724,7 @@ bool Metis_CheckNSet(Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t
     uint8_t current_value[length];
     uint8_t current_length = length;
 
-    if (!Metis_Get(userSetting, current_value, &current_length))
+    if (!Metis_Handle_Get(handle, userSetting, current_value, &current_length))
     {
         return false;
     }
@@ -738,88 +736,90 @@ bool Metis_CheckNSet(Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t
     }
 
     /* value differs, and thus must be set */
-    return Metis_Set(userSetting, valueP, length);
+    return Metis_Handle_Set(handle, userSetting, valueP, length);
 }
 
-bool Metis_Set(Metis_UserSettings_t us, uint8_t* valueP, uint8_t length)
+bool Metis_Handle_Set(Metis_Handle_t* handle, Metis_UserSettings_t us, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = METIS_CMD_SET_REQ;
-    txPacket.Length = (2 + length);
-    txPacket.Data[0] = us;
-    txPacket.Data[1] = length;
-    memcpy(&txPacket.Data[2], valueP, length);
+    handle->txPacket.Cmd = METIS_CMD_SET_REQ;
+    handle->txPacket.Length = (2 + length);
+    handle->txPacket.Data[0] = us;
+    handle->txPacket.Data[1] = length;
+    memcpy(&handle->txPacket.Data[2], valueP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_SET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_SET_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_GetFirmwareVersion(uint8_t* fwP)
+bool Metis_Handle_GetFirmwareVersion(Metis_Handle_t* handle, uint8_t* fwP)
 {
     if (fwP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = METIS_CMD_GET_FWRELEASE;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = METIS_CMD_GET_FWRELEASE;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, METIS_CMD_GET_FWRELEASE_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, METIS_CMD_GET_FWRELEASE_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_GET_FWRELEASE_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    memcpy(fwP, &rxPacket.Data[0], rxPacket.Length);
+    memcpy(fwP, &handle->rxPacket.Data[0], handle->rxPacket.Length);
     return true;
 }
 
-bool Metis_GetSerialNumber(uint8_t* snP)
+bool Metis_Handle_GetSerialNumber(Metis_Handle_t* handle, uint8_t* snP)
 {
     if (snP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = METIS_CMD_GET_SERIALNO;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = METIS_CMD_GET_SERIALNO;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, METIS_CMD_GET_SERIALNO_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, METIS_CMD_GET_SERIALNO_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_GET_SERIALNO_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    memcpy(snP, &rxPacket.Data[0], rxPacket.Length);
+    memcpy(snP, &handle->rxPacket.Data[0], handle->rxPacket.Length);
     return true;
 }
 
-bool Metis_GetDefaultTXPower(int8_t* txpowerP)
+bool Metis_Handle_GetDefaultTXPower(Metis_Handle_t* handle, int8_t* txpowerP)
 {
     if (txpowerP == NULL)
     {
@@ -829,34 +829,34 @@ bool Metis_GetDefaultTXPower(int8_t* txpowerP)
     *txpowerP = TXPOWERINVALID;
     uint8_t length;
 
-    return Metis_Get(Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER, (uint8_t*)txpowerP, &length);
+    return Metis_Handle_Get(handle, Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER, (uint8_t*)txpowerP, &length);
 }
 
-bool Metis_GetUartOutEnable(uint8_t* uartEnableP)
+bool Metis_Handle_GetUartOutEnable(Metis_Handle_t* handle, uint8_t* uartEnableP)
 {
     uint8_t length;
-    return Metis_Get(Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE, uartEnableP, &length);
+    return Metis_Handle_Get(handle, Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE, uartEnableP, &length);
 }
 
-bool Metis_GetRSSIEnable(uint8_t* rssiEnableP)
+bool Metis_Handle_GetRSSIEnable(Metis_Handle_t* handle, uint8_t* rssiEnableP)
 {
     uint8_t length;
-    return Metis_Get(Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE, rssiEnableP, &length);
+    return Metis_Handle_Get(handle, Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE, rssiEnableP, &length);
 }
 
-bool Metis_GetModePreselect(uint8_t* modePreselectP)
+bool Metis_Handle_GetModePreselect(Metis_Handle_t* handle, uint8_t* modePreselectP)
 {
     uint8_t length;
-    return Metis_Get(Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT, modePreselectP, &length);
+    return Metis_Handle_Get(handle, Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT, modePreselectP, &length);
 }
 
-bool Metis_GetAESEnable(uint8_t* aesEnableP)
+bool Metis_Handle_GetAESEnable(Metis_Handle_t* handle, uint8_t* aesEnableP)
 {
     uint8_t length;
-    return Metis_Get(Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE, aesEnableP, &length);
+    return Metis_Handle_Get(handle, Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE, aesEnableP, &length);
 }
 
-bool Metis_SetDefaultTXPower(int8_t txpower)
+bool Metis_Handle_SetDefaultTXPower(Metis_Handle_t* handle, int8_t txpower)
 {
     /* check for invalid power */
     if ((txpower < -11) || (txpower > 15))
@@ -864,55 +864,55 @@ bool Metis_SetDefaultTXPower(int8_t txpower)
         /* invalid power */
         return false;
     }
-    return Metis_Set(Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER, (uint8_t*)&txpower, 1);
+    return Metis_Handle_Set(handle, Metis_USERSETTING_MEMPOSITION_DEFAULTRFTXPOWER, (uint8_t*)&txpower, 1);
 }
 
-bool Metis_SetUartOutEnable(uint8_t uartEnable)
+bool Metis_Handle_SetUartOutEnable(Metis_Handle_t* handle, uint8_t uartEnable)
 {
     if ((uartEnable != 0) && (uartEnable != 1))
     {
         return false;
     }
-    return Metis_Set(Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE, &uartEnable, 1);
+    return Metis_Handle_Set(handle, Metis_USERSETTING_MEMPOSITION_UART_CMD_OUT_ENABLE, &uartEnable, 1);
 }
-bool Metis_SetRSSIEnable(uint8_t rssiEnable)
+bool Metis_Handle_SetRSSIEnable(Metis_Handle_t* handle, uint8_t rssiEnable)
 {
     if ((rssiEnable != 0) && (rssiEnable != 1))
     {
         return false;
     }
-    return Metis_Set(Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE, &rssiEnable, 1);
+    return Metis_Handle_Set(handle, Metis_USERSETTING_MEMPOSITION_RSSI_ENABLE, &rssiEnable, 1);
 }
 
-bool Metis_SetAESEnable(uint8_t aesEnable)
+bool Metis_Handle_SetAESEnable(Metis_Handle_t* handle, uint8_t aesEnable)
 {
     if (aesEnable != 0)
     {
         return false;
     }
-    return Metis_Set(Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE, &aesEnable, 1);
+    return Metis_Handle_Set(handle, Metis_USERSETTING_MEMPOSITION_APP_AES_ENABLE, &aesEnable, 1);
 }
 
-bool Metis_SetModePreselect(Metis_Mode_Preselect_t modePreselect) { return Metis_Set(Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT, (uint8_t*)&modePreselect, 1); }
+bool Metis_Handle_SetModePreselect(Metis_Handle_t* handle, Metis_Mode_Preselect_t modePreselect) { return Metis_Handle_Set(handle, Metis_USERSETTING_MEMPOSITION_MODE_PRESELECT, (uint8_t*)&modePreselect, 1); }
 
-bool Metis_SetVolatile_ModePreselect(Metis_Mode_Preselect_t modePreselect)
+bool Metis_Handle_SetVolatile_ModePreselect(Metis_Handle_t* handle, Metis_Mode_Preselect_t modePreselect)
 {
-    txPacket.Cmd = METIS_CMD_SET_MODE;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = modePreselect;
+    handle->txPacket.Cmd = METIS_CMD_SET_MODE;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = modePreselect;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf*/
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_SET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_SET_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_Transmit(uint8_t* payloadP)
+bool Metis_Handle_Transmit(Metis_Handle_t* handle, uint8_t* payloadP)
 {
     if (payloadP == NULL)
     {
@@ -927,11 +927,11 @@ bool Metis_Transmit(uint8_t* payloadP)
         return false;
     }
 
-    /* mode preselect C2/T2 for frequency 868 is not suitable for sending frames */
-    if ((frequency == Metis_Frequency_868))
+    /* mode preselect C2/T2 for handle->frequency 868 is not suitable for sending frames */
+    if ((handle->frequency == Metis_Frequency_868))
     {
         uint8_t modePreselect;
-        if (!Metis_GetModePreselect(&modePreselect))
+        if (!Metis_Handle_GetModePreselect(handle, &modePreselect))
         {
             return false;
         }
@@ -943,22 +943,22 @@ bool Metis_Transmit(uint8_t* payloadP)
         }
     }
 
-    txPacket.Cmd = METIS_CMD_DATA_REQ;
-    txPacket.Length = length;
-    memcpy(&txPacket.Data[0], &payloadP[1], length);
+    handle->txPacket.Cmd = METIS_CMD_DATA_REQ;
+    handle->txPacket.Length = length;
+    memcpy(&handle->txPacket.Data[0], &payloadP[1], length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!Metis_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!Metis_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, METIS_CMD_DATA_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, METIS_CMD_DATA_CNF, CMD_Status_Success, true);
 }
 
-bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool factory_reset)
+bool Metis_Handle_Configure(Metis_Handle_t* handle, Metis_Configuration_t* configP, uint8_t config_length, bool factory_reset)
 {
     if ((configP == NULL) || (config_length == 0))
     {
@@ -971,7 +971,7 @@ bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool
     if (factory_reset)
     {
         /* perform a factory reset */
-        if (!Metis_FactoryReset())
+        if (!Metis_Handle_FactoryReset(handle))
         {
             /* error */
             return false;
@@ -983,7 +983,7 @@ bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool
     for (uint8_t i = 0; i < config_length; i++)
     {
         /* read current value */
-        if (!Metis_Get(configP[i].usersetting, help, &help_length))
+        if (!Metis_Handle_Get(handle, configP[i].usersetting, help, &help_length))
         {
             /* error */
             return false;
@@ -999,7 +999,7 @@ bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool
         if (memcmp(help, configP[i].value, configP[i].value_length) != 0)
         {
             /* read value is not up to date, thus write the new value */
-            if (!Metis_Set(configP[i].usersetting, configP[i].value, configP[i].value_length))
+            if (!Metis_Handle_Set(handle, configP[i].usersetting, configP[i].value, configP[i].value_length))
             {
                 /* error */
                 return false;
@@ -1009,5 +1009,71 @@ bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool
     }
 
     /* reset to take effect of the updated parameters */
-    return Metis_PinReset();
+    return Metis_Handle_PinReset(handle);
 }
+
+Metis_Handle_t* Metis_GetHandle(uint8_t index) { return (index < METIS_MAX_INSTANCES) ? &instances[index] : NULL; }
+
+/**************************************
+ *   Functions for default instance   *
+ **************************************/
+
+bool Metis_Transparent_Transmit(const uint8_t* dataP, uint16_t dataLength) { return Metis_Handle_Transparent_Transmit(DEFAULT_HANDLE, dataP, dataLength); }
+
+bool Metis_Init(WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq, Metis_Mode_Preselect_t mode, bool enable_rssi, Metis_RxCallback_t RXcb) { return Metis_Handle_Init(DEFAULT_HANDLE, uartP, pinoutP, freq, mode, enable_rssi, RXcb); }
+
+bool Metis_Deinit() { return Metis_Handle_Deinit(DEFAULT_HANDLE); }
+
+bool Metis_PinReset() { return Metis_Handle_PinReset(DEFAULT_HANDLE); }
+
+bool Metis_Reset() { return Metis_Handle_Reset(DEFAULT_HANDLE); }
+
+bool Metis_FactoryReset() { return Metis_Handle_FactoryReset(DEFAULT_HANDLE); }
+
+bool Metis_SetUartSpeed(Metis_UartBaudrate_t baudrate) { return Metis_Handle_SetUartSpeed(DEFAULT_HANDLE, baudrate); }
+
+bool Metis_Get(Metis_UserSettings_t us, uint8_t* responseP, uint8_t* response_lengthP) { return Metis_Handle_Get(DEFAULT_HANDLE, us, responseP, response_lengthP); }
+
+bool Metis_GetMultiple(uint8_t startAddress, uint8_t lengthToRead, uint8_t* responseP, uint8_t* response_lengthP) { return Metis_Handle_GetMultiple(DEFAULT_HANDLE, startAddress, lengthToRead, responseP, response_lengthP); }
+
+bool Metis_CheckNSet(Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return Metis_Handle_CheckNSet(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool Metis_Set(Metis_UserSettings_t us, uint8_t* valueP, uint8_t length) { return Metis_Handle_Set(DEFAULT_HANDLE, us, valueP, length); }
+
+bool Metis_GetFirmwareVersion(uint8_t* fwP) { return Metis_Handle_GetFirmwareVersion(DEFAULT_HANDLE, fwP); }
+
+bool Metis_GetSerialNumber(uint8_t* snP) { return Metis_Handle_GetSerialNumber(DEFAULT_HANDLE, snP); }
+
+bool Metis_GetDefaultTXPower(int8_t* txpowerP) { return Metis_Handle_GetDefaultTXPower(DEFAULT_HANDLE, txpowerP); }
+
+bool Metis_GetUartOutEnable(uint8_t* uartEnableP) { return Metis_Handle_GetUartOutEnable(DEFAULT_HANDLE, uartEnableP); }
+
+bool Metis_GetRSSIEnable(uint8_t* rssiEnableP) { return Metis_Handle_GetRSSIEnable(DEFAULT_HANDLE, rssiEnableP); }
+
+bool Metis_GetModePreselect(uint8_t* modePreselectP) { return Metis_Handle_GetModePreselect(DEFAULT_HANDLE, modePreselectP); }
+
+bool Metis_GetAESEnable(uint8_t* aesEnableP) { return Metis_Handle_GetAESEnable(DEFAULT_HANDLE, aesEnableP); }
+
+bool Metis_SetDefaultTXPower(int8_t txpower) { return Metis_Handle_SetDefaultTXPower(DEFAULT_HANDLE, txpower); }
+
+bool Metis_SetUartOutEnable(uint8_t uartEnable) { return Metis_Handle_SetUartOutEnable(DEFAULT_HANDLE, uartEnable); }
+
+bool Metis_SetRSSIEnable(uint8_t rssiEnable) { return Metis_Handle_SetRSSIEnable(DEFAULT_HANDLE, rssiEnable); }
+
+bool Metis_SetAESEnable(uint8_t aesEnable) { return Metis_Handle_SetAESEnable(DEFAULT_HANDLE, aesEnable); }
+
+bool Metis_SetModePreselect(Metis_Mode_Preselect_t modePreselect) { return Metis_Handle_SetModePreselect(DEFAULT_HANDLE, modePreselect); }
+
+bool Metis_SetVolatile_ModePreselect(Metis_Mode_Preselect_t modePreselect) { return Metis_Handle_SetVolatile_ModePreselect(DEFAULT_HANDLE, modePreselect); }
+
+bool Metis_Transmit(uint8_t* payloadP) { return Metis_Handle_Transmit(DEFAULT_HANDLE, payloadP); }
+
+bool Metis_Configure(Metis_Configuration_t* configP, uint8_t config_length, bool factory_reset) { return Metis_Handle_Configure(DEFAULT_HANDLE, configP, config_length, factory_reset); }
+
+uint32_t Metis_GetConfirmationOverflowCount() { return Metis_Handle_GetConfirmationOverflowCount(DEFAULT_HANDLE); }
+
+#if defined(WE_STATS_ENABLED)
+bool Metis_GetStatistics(WE_Stats_t* statsP) { return Metis_Handle_GetStatistics(DEFAULT_HANDLE, statsP); }
+
+void Metis_ResetStatistics() { Metis_Handle_ResetStatistics(DEFAULT_HANDLE); }
+#endif
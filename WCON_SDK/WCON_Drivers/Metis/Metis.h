@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -156,6 +157,33 @@ typedef struct Metis_Configuration_t
  * following payload (i.e. the L field value). */
 typedef void (*Metis_RxCallback_t)(uint8_t* frameData, uint8_t frameLength, int8_t rssi);
 
+#ifndef METIS_MAX_INSTANCES
+/**
+ * @brief Max. number of Metis modules that can be driven at the same time (see Metis_GetHandle()).
+ */
+#define METIS_MAX_INSTANCES 1
+#endif
+
+/**
+ * @brief Handle of a driver instance (opaque).
+ *
+ * Each instance holds its own state (UART, pins, callbacks, receive buffers), so
+ * several Metis modules connected to different UARTs can be used at the same time.
+ * The functions without handle parameter operate on the instance with index 0.
+ * Note that callbacks don't receive the handle - use different callback functions
+ * for each instance if needed.
+ */
+typedef struct Metis_Handle_t Metis_Handle_t;
+
+/**
+ * @brief Returns the handle of a driver instance.
+ *
+ * @param[in] index: Index of instance (0 to METIS_MAX_INSTANCES - 1, 0 is the default instance)
+ *
+ * @return Handle of the instance or NULL if index is out of range
+ */
+extern Metis_Handle_t* Metis_GetHandle(uint8_t index);
+
 /**
  * @brief Initialize the AMB module for serial interface.
  *
@@ -459,6 +487,71 @@ extern bool Metis_SetModePreselect(Metis_Mode_Preselect_t modePreselect);
  */
 extern bool Metis_SetVolatile_ModePreselect(Metis_Mode_Preselect_t modePreselect);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t Metis_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool Metis_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void Metis_ResetStatistics();
+#endif
+
+/**
+ * @name Functions operating on a specific driver instance
+ *
+ * Same as the corresponding functions without handle parameter (e.g. Metis_Handle_Init() is
+ * the same as Metis_Init()), but for the driver instance referenced by handle (see Metis_GetHandle()).
+ * @{
+ */
+extern bool Metis_Handle_Init(Metis_Handle_t* handle, WE_UART_t* uartP, Metis_Pins_t* pinoutP, Metis_Frequency_t freq, Metis_Mode_Preselect_t mode, bool enable_rssi, Metis_RxCallback_t RXcb);
+extern bool Metis_Handle_Deinit(Metis_Handle_t* handle);
+extern bool Metis_Handle_PinReset(Metis_Handle_t* handle);
+extern bool Metis_Handle_Reset(Metis_Handle_t* handle);
+extern bool Metis_Handle_Transmit(Metis_Handle_t* handle, uint8_t* payloadP);
+extern bool Metis_Handle_Transparent_Transmit(Metis_Handle_t* handle, const uint8_t* dataP, uint16_t dataLength);
+extern bool Metis_Handle_Get(Metis_Handle_t* handle, Metis_UserSettings_t us, uint8_t* responseP, uint8_t* response_lengthP);
+extern bool Metis_Handle_GetMultiple(Metis_Handle_t* handle, uint8_t startAddress, uint8_t lengthToRead, uint8_t* responseP, uint8_t* response_lengthP);
+extern bool Metis_Handle_GetFirmwareVersion(Metis_Handle_t* handle, uint8_t* fwP);
+extern bool Metis_Handle_GetSerialNumber(Metis_Handle_t* handle, uint8_t* snP);
+extern bool Metis_Handle_GetDefaultTXPower(Metis_Handle_t* handle, int8_t* txpowerP);
+extern bool Metis_Handle_GetUartOutEnable(Metis_Handle_t* handle, uint8_t* uartEnableP);
+extern bool Metis_Handle_GetRSSIEnable(Metis_Handle_t* handle, uint8_t* rssiEnableP);
+extern bool Metis_Handle_GetAESEnable(Metis_Handle_t* handle, uint8_t* aesEnableP);
+extern bool Metis_Handle_GetModePreselect(Metis_Handle_t* handle, uint8_t* modePreselectP);
+extern bool Metis_Handle_FactoryReset(Metis_Handle_t* handle);
+extern bool Metis_Handle_SetUartSpeed(Metis_Handle_t* handle, Metis_UartBaudrate_t baudrate);
+extern bool Metis_Handle_Set(Metis_Handle_t* handle, Metis_UserSettings_t us, uint8_t* valueP, uint8_t length);
+extern bool Metis_Handle_CheckNSet(Metis_Handle_t* handle, Metis_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool Metis_Handle_Configure(Metis_Handle_t* handle, Metis_Configuration_t* configP, uint8_t config_length, bool factory_reset);
+extern bool Metis_Handle_SetDefaultTXPower(Metis_Handle_t* handle, int8_t txpower);
+extern bool Metis_Handle_SetUartOutEnable(Metis_Handle_t* handle, uint8_t uartEnable);
+extern bool Metis_Handle_SetRSSIEnable(Metis_Handle_t* handle, uint8_t rssiEnable);
+extern bool Metis_Handle_SetAESEnable(Metis_Handle_t* handle, uint8_t aesEnable);
+extern bool Metis_Handle_SetModePreselect(Metis_Handle_t* handle, Metis_Mode_Preselect_t modePreselect);
+extern bool Metis_Handle_SetVolatile_ModePreselect(Metis_Handle_t* handle, Metis_Mode_Preselect_t modePreselect);
+extern uint32_t Metis_Handle_GetConfirmationOverflowCount(Metis_Handle_t* handle);
+#if defined(WE_STATS_ENABLED)
+extern bool Metis_Handle_GetStatistics(Metis_Handle_t* handle, WE_Stats_t* statsP);
+extern void Metis_Handle_ResetStatistics(Metis_Handle_t* handle);
+#endif
+/** @} */
+
 #endif // METIS_H_INCLUDED
 #ifdef __cplusplus
 }
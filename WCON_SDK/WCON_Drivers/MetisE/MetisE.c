@@ -29,6 +29,7 @@
  */
 
 #include <MetisE/MetisE.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -154,16 +155,10 @@ typedef struct
     uint8_t* pValue;
 } MetisE_CMD_Option_t;
 
-typedef struct
-{
-    uint8_t cmd;                /* variable to check if correct CMD has been confirmed */
-    MetisE_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the MetisE */
-} MetisE_CMD_Confirmation_t;
-
 static bool MetisE_GetSetting(MetisE_UserSettings_t us, bool getDefault, uint8_t* response, uint8_t* response_length);
 static bool MetisE_SetSetting(MetisE_UserSettings_t us, bool getDefault, uint8_t* value, uint8_t length);
 void MetisE_HandleRxByte(uint8_t* dataP, size_t size);
-void MetisE_GetOptionPointer(MetisE_CMD_Frame_t* pCmdFrame, MetisE_Options_t option, MetisE_CMD_Option_t* pOptionOut);
+void MetisE_GetOptionPointer(uint8_t* pData, uint16_t length, MetisE_Options_t option, MetisE_CMD_Option_t* pOptionOut);
 static WE_UART_HandleRxByte_t byteRxCallback = MetisE_HandleRxByte;
 
 /**************************************
@@ -173,8 +168,10 @@ static MetisE_ReceivedData_t receivedFrame;                         /* */
 static MetisE_CMD_Frame_t rxPacket;                                 /* data buffer for RX */
 static MetisE_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
 
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static MetisE_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see MetisE_GetStatistics()) */
+#endif
 /**
  * @brief Pin configuration struct pointer.
  */
@@ -184,19 +181,17 @@ static MetisE_Pins_t* MetisE_pinsP = NULL;
  * @brief Uart configuration struct pointer.
  */
 static WE_UART_t* MetisE_uartP = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(MetisE_CMD_Frame_t)]; /* data buffer for RX */
 static void (*RxCallback)(MetisE_ReceivedData_t);    /* callback function */
 
 /**************************************
  *         Static functions           *
  **************************************/
-void MetisE_GetOptionPointer(MetisE_CMD_Frame_t* pCmdFrame, MetisE_Options_t option, MetisE_CMD_Option_t* pOptionOut)
+void MetisE_GetOptionPointer(uint8_t* pData, uint16_t length, MetisE_Options_t option, MetisE_CMD_Option_t* pOptionOut)
 {
-    uint8_t* currentOption = pCmdFrame->Data;
-    uint8_t* endOfFrame = currentOption + pCmdFrame->Length;
+    uint8_t* currentOption = pData;
+    uint8_t* endOfFrame = currentOption + length;
 
     pOptionOut->OptionByte = MetisE_OPTION_Invalid;
 
@@ -218,216 +213,126 @@ void MetisE_GetOptionPointer(MetisE_CMD_Frame_t* pCmdFrame, MetisE_Options_t opt
     }
 }
 
-static void HandleRxPacket(uint8_t* rxBuffer)
+static void HandleResetInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    MetisE_CMD_Confirmation_t cmdConfirmation;
-
-    uint16_t cmd_length = rxBuffer[2];
-    cmd_length = ((uint16_t)rxBuffer[3] << 8) + cmd_length;
-    memcpy((uint8_t*)&rxPacket, rxBuffer, cmd_length + LENGTH_CMD_OVERHEAD);
+    /* Commands with length 0 - they have no status option. Receiving them is always a success */
+    confirmation->status = CMD_Status_Success;
+}
 
-    cmdConfirmation.cmd = rxPacket.Cmd;
-    cmdConfirmation.status = CMD_Status_Invalid;
+static void HandleDataExInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* Indication has no status option - but receiving it */
+    confirmation->status = CMD_Status_Success;
 
     MetisE_CMD_Option_t currentOption;
-    currentOption.OptionByte = MetisE_OPTION_Invalid;
-    MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_STATUS, &currentOption);
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_RSSI, &currentOption);
+    if (currentOption.OptionByte != MetisE_OPTION_Invalid)
+    {
+        receivedFrame.rssi = currentOption.pValue[0];
+    }
 
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_TIMESTAMP, &currentOption);
     if (currentOption.OptionByte != MetisE_OPTION_Invalid)
     {
-        cmdConfirmation.status = currentOption.pValue[0];
+        receivedFrame.timestamp = currentOption.pValue[0];
+        receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[1];
+        receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[2];
+        receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[3];
     }
 
-    switch (rxPacket.Cmd)
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_WMBUS_RXMODE, &currentOption);
+    if (currentOption.OptionByte != MetisE_OPTION_Invalid)
     {
-        case METIS_E_CMD_RESET_IND:
-        case METIS_E_CMD_STANDBY_IND:
-        {
-            /* Commands with length 0 - they have no status option. Receiving them is always a success */
-            cmdConfirmation.status = CMD_Status_Success;
-        }
-        break;
-        case METIS_E_CMD_DATAEX_IND:
-        {
-            /* Indication has no status option - but receiving it */
-            cmdConfirmation.status = CMD_Status_Success;
+        receivedFrame.wmBusModeRx = currentOption.pValue[0];
+    }
 
-            MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_RSSI, &currentOption);
-            if (currentOption.OptionByte != MetisE_OPTION_Invalid)
-            {
-                receivedFrame.rssi = currentOption.pValue[0];
-            }
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_WMBUS_FRAMEFORMAT, &currentOption);
+    if (currentOption.OptionByte != MetisE_OPTION_Invalid)
+    {
+        receivedFrame.wmBusModeFrameFormat = currentOption.pValue[0];
+    }
 
-            MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_TIMESTAMP, &currentOption);
-            if (currentOption.OptionByte != MetisE_OPTION_Invalid)
-            {
-                receivedFrame.timestamp = currentOption.pValue[0];
-                receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[1];
-                receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[2];
-                receivedFrame.timestamp = (receivedFrame.timestamp << 8) + currentOption.pValue[3];
-            }
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_WMBUS_DATA, &currentOption);
+    if (currentOption.OptionByte == MetisE_OPTION_Invalid)
+    {
+        /* no payload, nothing to pass to the RxCallback function */
+        return;
+    }
+    receivedFrame.payloadLength = currentOption.Length;
+    receivedFrame.pPayload = currentOption.pValue;
 
-            MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_WMBUS_RXMODE, &currentOption);
-            receivedFrame.wmBusModeRx = currentOption.pValue[0];
+    /* data received, give it to the RxCallback function */
+    if (RxCallback != NULL)
+    {
+        RxCallback(receivedFrame);
+    }
+}
 
-            MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_WMBUS_FRAMEFORMAT, &currentOption);
-            receivedFrame.wmBusModeFrameFormat = currentOption.pValue[0];
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [METIS_E_CMD_RESET_IND]   = HandleResetInd,
+    [METIS_E_CMD_STANDBY_IND] = HandleResetInd,
+    [METIS_E_CMD_DATAEX_IND]  = HandleDataExInd,
+};
+
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = frame->cmd;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-            MetisE_GetOptionPointer(&rxPacket, MetisE_OPTION_WMBUS_DATA, &currentOption);
-            receivedFrame.payloadLength = currentOption.Length;
-            receivedFrame.pPayload = currentOption.pValue;
+    MetisE_CMD_Option_t currentOption;
+    currentOption.OptionByte = MetisE_OPTION_Invalid;
+    MetisE_GetOptionPointer(frame->data, frame->length, MetisE_OPTION_STATUS, &currentOption);
 
-            /* data received, give it to the RxCallback function */
-            if (RxCallback != NULL)
-            {
-                RxCallback(receivedFrame);
-            }
-        }
-        break;
-
-        case METIS_E_CMD_GET_CNF:
-        case METIS_E_CMD_FACTORY_RESET_CNF:
-        case METIS_E_CMD_RESET_CNF:
-        case METIS_E_CMD_SHUTDOWN_CNF:
-        case METIS_E_CMD_STANDBY_CNF:
-        case METIS_E_CMD_DATAEX_CNF:
-        case METIS_E_CMD_RXSTART_CNF:
-        case METIS_E_CMD_RXSTOP_CNF:
-        case METIS_E_CMD_SET_CNF:
-        default:
-        {
-            /* Nothing to do - data is handled in respective functions */
-        }
-        break;
+    if (currentOption.OptionByte != MetisE_OPTION_Invalid)
+    {
+        cmdConfirmation.status = currentOption.pValue[0];
     }
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if (frame->cmd != METIS_E_CMD_DATAEX_IND)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
 static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, MetisE_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    int count = 0;
-    int time_step_ms = 5; /* 5ms */
-    int max_count = max_time_ms / time_step_ms;
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
 
-    while (1)
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
-
-        if (count >= max_count)
-        {
-            /* received no correct response within timeout */
-            break;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(time_step_ms);
+        /* received no correct response within timeout */
+        return false;
     }
-
-    // if we get here, there was a timeout. Otherwise function returns from within the while-loop
-    return false;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 static void FillChecksum(MetisE_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-
-    for (uint8_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
 }
 
 void MetisE_HandleRxByte(uint8_t* dataP, size_t size)
 {
-    for (; size > 0; size--, dataP++)
-    {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-        else
-        {
-            rxByteCounter = 0;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = (rxBuffer[rxByteCounter - 1] + LENGTH_CMD_OVERHEAD); /* len + crc + sfd + cmd */
-                break;
-
-            case 3:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = bytesToReceive + (((uint16_t)rxBuffer[rxByteCounter - 1] << 8));
-                break;
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint8_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
-    }
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
 }
 
 bool MetisE_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
@@ -437,6 +342,9 @@ bool MetisE_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
         return false;
     }
 
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return MetisE_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -470,6 +378,13 @@ bool MetisE_Init(WE_UART_t* uartP, MetisE_Pins_t* pinoutP, void (*RXcb)(MetisE_R
         return false;
     }
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     MetisE_uartP = uartP;
     if (!MetisE_uartP->uartInit(MetisE_uartP->baudrate, MetisE_uartP->flowControl, MetisE_uartP->parity, &byteRxCallback))
     {
@@ -505,11 +420,7 @@ bool MetisE_PinWakeup()
     }
 
     WE_Delay(5);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmation_array[i].status = CMD_Status_Invalid;
-        cmdConfirmation_array[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 
     if (!WE_SetPin(MetisE_pinsP->MetisE_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
@@ -617,6 +528,7 @@ static bool MetisE_GetSetting(MetisE_UserSettings_t us, bool getDefault, uint8_t
     txPacket.Data[1] = 1;
     txPacket.Data[2] = us;
 
+    ExpectResponse(getDefault ? METIS_E_CMD_GET_CNF : METIS_E_CMD_GET_RAM_CNF);
     FillChecksum(&txPacket);
 
     if (!MetisE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -631,7 +543,7 @@ static bool MetisE_GetSetting(MetisE_UserSettings_t us, bool getDefault, uint8_t
     }
 
     MetisE_CMD_Option_t option;
-    MetisE_GetOptionPointer(&rxPacket, (MetisE_Options_t)us, &option);
+    MetisE_GetOptionPointer(rxPacket.Data, rxPacket.Length, (MetisE_Options_t)us, &option);
 
     if (MetisE_OPTION_Invalid == option.OptionByte)
     {
@@ -1073,3 +985,11 @@ bool MetisE_Configure(MetisE_Configuration_t* config, uint8_t config_length, boo
     /* reset to take effect of the updated parameters */
     return MetisE_PinReset();
 }
+
+uint32_t MetisE_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool MetisE_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, MetisE_uartP, statsP); }
+
+void MetisE_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -454,6 +455,31 @@ extern bool MetisE_SetVolatile_wmBusRole(MetisE_wmBusRole_t wmbusRxRole);
  */
 extern bool MetisE_SetVolatile_CFGFlags(uint8_t cfgFlags);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t MetisE_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool MetisE_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void MetisE_ResetStatistics();
+#endif
+
 #endif // METIS_E_H_INCLUDED
 
 #ifdef __cplusplus
@@ -29,6 +29,7 @@
  */
 
 #include <ProteusE/ProteusE.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -187,15 +188,6 @@ typedef enum ProteusE_CMD_Status_t
     CMD_Status_NoStatus,
 } ProteusE_CMD_Status_t;
 
-/**
- * @brief Command confirmation.
- */
-typedef struct
-{
-    uint8_t cmd;                  /**< Variable to check if correct CMD has been confirmed */
-    ProteusE_CMD_Status_t status; /**< Variable used to check the response (*_CNF), when a request (*_REQ) was sent to the Proteus-e */
-} ProteusE_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
@@ -203,8 +195,10 @@ static ProteusE_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request
 static ProteusE_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
 ;
 
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static ProteusE_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see ProteusE_GetStatistics()) */
+#endif
 static ProteusE_OperationMode_t operationMode = ProteusE_OperationMode_CommandMode;
 static ProteusE_DriverState_t bleState;
 /**
@@ -219,9 +213,7 @@ static WE_UART_t* ProteusE_uartP = NULL;
 
 static ProteusE_CallbackConfig_t callbacks;
 static WE_UART_HandleRxByte_t byteRxCallback = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(ProteusE_CMD_Frame_t)]; /* For UART RX from module */
 
 /**************************************
@@ -230,402 +222,312 @@ static uint8_t rxBuffer[sizeof(ProteusE_CMD_Frame_t)]; /* For UART RX from modul
 
 static void ClearReceiveBuffers()
 {
-    bytesToReceive = 0;
-    rxByteCounter = 0;
-    checksum = 0;
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_Parser_Reset(&rxParser);
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 }
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ProteusE_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
 
-    uint16_t cmdLength = ((ProteusE_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
-
-    switch (rxPacket.Cmd)
-    {
-        case PROTEUSE_CMD_RESET_CNF:
-        case PROTEUSE_CMD_GET_CNF:
-        case PROTEUSE_CMD_GET_RAM_CNF:
-        case PROTEUSE_CMD_SET_CNF:
-        case PROTEUSE_CMD_SET_RAM_CNF:
-        case PROTEUSE_CMD_PHYUPDATE_CNF:
-        case PROTEUSE_CMD_DATA_CNF:
-        case PROTEUSE_CMD_DISCONNECT_CNF:
-        case PROTEUSE_CMD_FACTORYRESET_CNF:
-        case PROTEUSE_CMD_SLEEP_CNF:
-        case PROTEUSE_CMD_UART_DISABLE_CNF:
-        case PROTEUSE_CMD_UART_ENABLE_IND:
-        case PROTEUSE_CMD_GPIO_LOCAL_WRITECONFIG_CNF:
-        case PROTEUSE_CMD_GPIO_LOCAL_READCONFIG_CNF:
-        case PROTEUSE_CMD_GPIO_LOCAL_WRITE_CNF:
-        case PROTEUSE_CMD_GPIO_LOCAL_READ_CNF:
-        case PROTEUSE_CMD_GPIO_REMOTE_WRITECONFIG_CNF:
-        case PROTEUSE_CMD_GPIO_REMOTE_READCONFIG_CNF:
-        case PROTEUSE_CMD_GPIO_REMOTE_WRITE_CNF:
-        case PROTEUSE_CMD_GPIO_REMOTE_READ_CNF:
-        case PROTEUSE_CMD_GET_BONDS_CNF:
-        case PROTEUSE_CMD_DELETE_BONDS_CNF:
-        case PROTEUSE_CMD_ALLOWUNBONDEDCONNECTIONS_CNF:
-        case PROTEUSE_CMD_TXCOMPLETE_RSP:
-        case PROTEUSE_CMD_DTMSTART_CNF:
-        case PROTEUSE_CMD_DTM_CNF:
+static void HandleGetStateCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    /* GETSTATE_CNF has no status field */
+    confirmation->status = CMD_Status_NoStatus;
+
+    switch (frame->data[1])
+    {
+        case ProteusE_BLE_Action_Idle:
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            break;
+            bleState = ProteusE_DriverState_BLE_Idle;
         }
-
-        case PROTEUSE_CMD_GETSTATE_CNF:
+        break;
+        case ProteusE_BLE_Action_Connected:
+        case ProteusE_BLE_Action_None:
+        case ProteusE_BLE_Action_Sleep:
+        case ProteusE_BLE_Action_DTM:
+        default:
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            /* GETSTATE_CNF has no status field */
-            cmdConfirmation.status = CMD_Status_NoStatus;
-
-            switch (rxPacket.Data[1])
-            {
-                case ProteusE_BLE_Action_Idle:
-                {
-                    bleState = ProteusE_DriverState_BLE_Idle;
-                }
-                break;
-                case ProteusE_BLE_Action_Connected:
-                case ProteusE_BLE_Action_None:
-                case ProteusE_BLE_Action_Sleep:
-                case ProteusE_BLE_Action_DTM:
-                default:
-                {
-                    /* do not use this information */
-                }
-                break;
-            }
-
-            break;
+            /* do not use this information */
         }
+        break;
+    }
+}
 
-        case PROTEUSE_CMD_CHANNELOPEN_RSP:
+static void HandleChannelOpenRsp(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), max payload (1 byte) */
+    bleState = ProteusE_DriverState_BLE_ChannelOpen;
+    if (callbacks.channelOpenCb != NULL)
+    {
+        callbacks.channelOpenCb(&frame->data[1], (uint16_t)frame->data[7]);
+    }
+}
+
+static void HandleConnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    bool success = (frame->data[0] == CMD_Status_Success);
+    if (success)
+    {
+        bleState = ProteusE_DriverState_BLE_Connected;
+    }
+    if (callbacks.connectCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 7)
         {
-            /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), max payload (1 byte) */
-            bleState = ProteusE_DriverState_BLE_ChannelOpen;
-            if (callbacks.channelOpenCb != NULL)
-            {
-                callbacks.channelOpenCb(&rxPacket.Data[1], (uint16_t)rxPacket.Data[7]);
-            }
-            break;
+            memcpy(btMac, &frame->data[1], sizeof(btMac));
         }
-
-        case PROTEUSE_CMD_CONNECT_IND:
+        else
         {
-            bool success = (rxPacket.Data[0] == CMD_Status_Success);
-            if (success)
-            {
-                bleState = ProteusE_DriverState_BLE_Connected;
-            }
-            if (callbacks.connectCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 7)
-                {
-                    memcpy(btMac, &rxPacket.Data[1], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. connection failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.connectCb(success, btMac);
-            }
-            break;
+            /* Packet doesn't contain BTMAC (e.g. connection failed) */
+            memset(btMac, 0, sizeof(btMac));
         }
+        callbacks.connectCb(success, btMac);
+    }
+}
 
-        case PROTEUSE_CMD_DISCONNECT_IND:
+static void HandleDisconnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    bleState = ProteusE_DriverState_BLE_Idle;
+    if (callbacks.disconnectCb != NULL)
+    {
+        ProteusE_DisconnectReason_t reason = ProteusE_DisconnectReason_Unknown;
+        switch (frame->data[0])
         {
-            bleState = ProteusE_DriverState_BLE_Idle;
-            if (callbacks.disconnectCb != NULL)
-            {
-                ProteusE_DisconnectReason_t reason = ProteusE_DisconnectReason_Unknown;
-                switch (rxPacket.Data[0])
-                {
-                    case 0x08:
-                        reason = ProteusE_DisconnectReason_ConnectionTimeout;
-                        break;
+            case 0x08:
+                reason = ProteusE_DisconnectReason_ConnectionTimeout;
+                break;
 
-                    case 0x13:
-                        reason = ProteusE_DisconnectReason_UserTerminatedConnection;
-                        break;
+            case 0x13:
+                reason = ProteusE_DisconnectReason_UserTerminatedConnection;
+                break;
 
-                    case 0x16:
-                        reason = ProteusE_DisconnectReason_HostTerminatedConnection;
-                        break;
+            case 0x16:
+                reason = ProteusE_DisconnectReason_HostTerminatedConnection;
+                break;
 
-                    case 0x3B:
-                        reason = ProteusE_DisconnectReason_ConnectionIntervalUnacceptable;
-                        break;
+            case 0x3B:
+                reason = ProteusE_DisconnectReason_ConnectionIntervalUnacceptable;
+                break;
 
-                    case 0x3D:
-                        reason = ProteusE_DisconnectReason_MicFailure;
-                        break;
+            case 0x3D:
+                reason = ProteusE_DisconnectReason_MicFailure;
+                break;
 
-                    case 0x3E:
-                        reason = ProteusE_DisconnectReason_ConnectionSetupFailed;
-                        break;
-                }
-                callbacks.disconnectCb(reason);
-            }
-            break;
+            case 0x3E:
+                reason = ProteusE_DisconnectReason_ConnectionSetupFailed;
+                break;
         }
+        callbacks.disconnectCb(reason);
+    }
+}
 
-        case PROTEUSE_CMD_DATA_IND:
-        {
-            if (callbacks.rxCb != NULL)
-            {
-                callbacks.rxCb(&rxPacket.Data[7], rxPacket.Length - 7, &rxPacket.Data[0], rxPacket.Data[6]);
-            }
-            break;
-        }
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.rxCb != NULL)
+    {
+        callbacks.rxCb(&frame->data[7], frame->length - 7, &frame->data[0], frame->data[6]);
+    }
+}
 
-        case PROTEUSE_CMD_SECURITY_IND:
-        {
-            if (callbacks.securityCb != NULL)
-            {
-                callbacks.securityCb(&rxPacket.Data[1], rxPacket.Data[0]);
-            }
-            break;
-        }
+static void HandleSecurityInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.securityCb != NULL)
+    {
+        callbacks.securityCb(&frame->data[1], frame->data[0]);
+    }
+}
 
-        case PROTEUSE_CMD_PHYUPDATE_IND:
+static void HandlePhyUpdateInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.phyUpdateCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 9)
         {
-            if (callbacks.phyUpdateCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 9)
-                {
-                    memcpy(btMac, &rxPacket.Data[3], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.phyUpdateCb((rxPacket.Data[0] == CMD_Status_Success), btMac, (ProteusE_Phy_t)rxPacket.Data[1], (ProteusE_Phy_t)rxPacket.Data[2]);
-            }
-            break;
+            memcpy(btMac, &frame->data[3], sizeof(btMac));
         }
-
-        case PROTEUSE_CMD_SLEEP_IND:
+        else
         {
-            if (callbacks.sleepCb != NULL)
-            {
-                callbacks.sleepCb();
-            }
-            break;
+            /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
+            memset(btMac, 0, sizeof(btMac));
         }
+        callbacks.phyUpdateCb((frame->data[0] == CMD_Status_Success), btMac, (ProteusE_Phy_t)frame->data[1], (ProteusE_Phy_t)frame->data[2]);
+    }
+}
 
-        case PROTEUSE_CMD_GPIO_LOCAL_WRITE_IND:
-        case PROTEUSE_CMD_GPIO_REMOTE_WRITE_IND:
-        {
-            if (callbacks.gpioWriteCb != NULL)
-            {
-                uint8_t pos = 0;
-                while (pos < rxPacket.Length)
-                {
-                    uint8_t blockLength = rxPacket.Data[pos] + 1;
-
-                    /* Note that the gpioId parameter is of type uint8_t instead of ProteusE_GPIO_t, as the
-                 * remote device may support other GPIOs than this device. */
-                    uint8_t gpioId = rxPacket.Data[1 + pos];
-                    uint8_t value = rxPacket.Data[2 + pos];
-                    callbacks.gpioWriteCb(PROTEUSE_CMD_GPIO_REMOTE_WRITE_IND == rxPacket.Cmd, gpioId, value);
-
-                    pos += blockLength;
-                }
-            }
-            break;
-        }
+static void HandleSleepInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.sleepCb != NULL)
+    {
+        callbacks.sleepCb();
+    }
+}
 
-        case PROTEUSE_CMD_GPIO_REMOTE_WRITECONFIG_IND:
+static void HandleGpioWriteInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.gpioWriteCb != NULL)
+    {
+        uint8_t pos = 0;
+        while (pos < frame->length)
         {
-            if (callbacks.gpioRemoteConfigCb != NULL)
-            {
-                uint8_t pos = 0;
-                while (pos < rxPacket.Length)
-                {
-                    uint8_t blockLength = rxPacket.Data[pos] + 1;
-                    uint8_t gpioId = rxPacket.Data[1 + pos];
-                    uint8_t function = rxPacket.Data[2 + pos];
-                    uint8_t* value = &rxPacket.Data[3 + pos];
-
-                    ProteusE_GPIOConfigBlock_t gpioConfig = {0};
-                    gpioConfig.gpioId = (ProteusE_GPIO_t)gpioId;
-                    gpioConfig.function = (ProteusE_GPIO_IO_t)function;
-                    switch (gpioConfig.function)
-                    {
-                        case ProteusE_GPIO_IO_Disconnected:
-                            break;
+            uint8_t blockLength = frame->data[pos] + 1;
 
-                        case ProteusE_GPIO_IO_Input:
-                            gpioConfig.value.input = (ProteusE_GPIO_Input_t)*value;
-                            break;
+            /* Note that the gpioId parameter is of type uint8_t instead of ProteusE_GPIO_t, as the
+         * remote device may support other GPIOs than this device. */
+            uint8_t gpioId = frame->data[1 + pos];
+            uint8_t value = frame->data[2 + pos];
+            callbacks.gpioWriteCb(PROTEUSE_CMD_GPIO_REMOTE_WRITE_IND == frame->cmd, gpioId, value);
 
-                        case ProteusE_GPIO_IO_Output:
-                            gpioConfig.value.output = (ProteusE_GPIO_Output_t)*value;
-                            break;
-                    }
-                    callbacks.gpioRemoteConfigCb(&gpioConfig);
-                    pos += blockLength;
-                }
-            }
-            break;
+            pos += blockLength;
         }
+    }
+}
 
-        case PROTEUSE_CMD_ERROR_IND:
+static void HandleGpioRemoteWriteConfigInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.gpioRemoteConfigCb != NULL)
+    {
+        uint8_t pos = 0;
+        while (pos < frame->length)
         {
-            if (callbacks.errorCb != NULL)
+            uint8_t blockLength = frame->data[pos] + 1;
+            uint8_t gpioId = frame->data[1 + pos];
+            uint8_t function = frame->data[2 + pos];
+            uint8_t* value = &frame->data[3 + pos];
+
+            ProteusE_GPIOConfigBlock_t gpioConfig = {0};
+            gpioConfig.gpioId = (ProteusE_GPIO_t)gpioId;
+            gpioConfig.function = (ProteusE_GPIO_IO_t)function;
+            switch (gpioConfig.function)
             {
-                callbacks.errorCb(rxPacket.Data[0]);
-            }
-            break;
-        }
+                case ProteusE_GPIO_IO_Disconnected:
+                    break;
 
-        default:
-        {
-            /* invalid */
-            break;
-        }
-    }
+                case ProteusE_GPIO_IO_Input:
+                    gpioConfig.value.input = (ProteusE_GPIO_Input_t)*value;
+                    break;
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        if (cmdConfirmationArray[i].cmd == CNFINVALID)
-        {
-            cmdConfirmationArray[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmationArray[i].status = cmdConfirmation.status;
-            break;
+                case ProteusE_GPIO_IO_Output:
+                    gpioConfig.value.output = (ProteusE_GPIO_Output_t)*value;
+                    break;
+            }
+            callbacks.gpioRemoteConfigCb(&gpioConfig);
+            pos += blockLength;
         }
     }
 }
 
-void ProteusE_HandleRxByte(uint8_t* dataP, size_t size)
+static void HandleErrorInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    for (; size > 0; size--, dataP++)
+    if (callbacks.errorCb != NULL)
     {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field LSB */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
+        callbacks.errorCb(frame->data[0]);
+    }
+}
 
-            case 3:
-                /* length field MSB */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [PROTEUSE_CMD_RESET_CNF]                    = HandleStatusCnf,
+    [PROTEUSE_CMD_GET_CNF]                      = HandleStatusCnf,
+    [PROTEUSE_CMD_GET_RAM_CNF]                  = HandleStatusCnf,
+    [PROTEUSE_CMD_SET_CNF]                      = HandleStatusCnf,
+    [PROTEUSE_CMD_SET_RAM_CNF]                  = HandleStatusCnf,
+    [PROTEUSE_CMD_PHYUPDATE_CNF]                = HandleStatusCnf,
+    [PROTEUSE_CMD_DATA_CNF]                     = HandleStatusCnf,
+    [PROTEUSE_CMD_DISCONNECT_CNF]               = HandleStatusCnf,
+    [PROTEUSE_CMD_FACTORYRESET_CNF]             = HandleStatusCnf,
+    [PROTEUSE_CMD_SLEEP_CNF]                    = HandleStatusCnf,
+    [PROTEUSE_CMD_UART_DISABLE_CNF]             = HandleStatusCnf,
+    [PROTEUSE_CMD_UART_ENABLE_IND]              = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_LOCAL_WRITECONFIG_CNF]   = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_LOCAL_READCONFIG_CNF]    = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_LOCAL_WRITE_CNF]         = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_LOCAL_READ_CNF]          = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_REMOTE_WRITECONFIG_CNF]  = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_REMOTE_READCONFIG_CNF]   = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_REMOTE_WRITE_CNF]        = HandleStatusCnf,
+    [PROTEUSE_CMD_GPIO_REMOTE_READ_CNF]         = HandleStatusCnf,
+    [PROTEUSE_CMD_GET_BONDS_CNF]                = HandleStatusCnf,
+    [PROTEUSE_CMD_DELETE_BONDS_CNF]             = HandleStatusCnf,
+    [PROTEUSE_CMD_ALLOWUNBONDEDCONNECTIONS_CNF] = HandleStatusCnf,
+    [PROTEUSE_CMD_TXCOMPLETE_RSP]               = HandleStatusCnf,
+    [PROTEUSE_CMD_DTMSTART_CNF]                 = HandleStatusCnf,
+    [PROTEUSE_CMD_DTM_CNF]                      = HandleStatusCnf,
+    [PROTEUSE_CMD_GETSTATE_CNF]                 = HandleGetStateCnf,
+    [PROTEUSE_CMD_CHANNELOPEN_RSP]              = HandleChannelOpenRsp,
+    [PROTEUSE_CMD_CONNECT_IND]                  = HandleConnectInd,
+    [PROTEUSE_CMD_DISCONNECT_IND]               = HandleDisconnectInd,
+    [PROTEUSE_CMD_DATA_IND]                     = HandleDataInd,
+    [PROTEUSE_CMD_SECURITY_IND]                 = HandleSecurityInd,
+    [PROTEUSE_CMD_PHYUPDATE_IND]                = HandlePhyUpdateInd,
+    [PROTEUSE_CMD_SLEEP_IND]                    = HandleSleepInd,
+    [PROTEUSE_CMD_GPIO_LOCAL_WRITE_IND]         = HandleGpioWriteInd,
+    [PROTEUSE_CMD_GPIO_REMOTE_WRITE_IND]        = HandleGpioWriteInd,
+    [PROTEUSE_CMD_GPIO_REMOTE_WRITECONFIG_IND]  = HandleGpioRemoteWriteConfigInd,
+    [PROTEUSE_CMD_ERROR_IND]                    = HandleErrorInd,
+};
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
 
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+    if (cmdConfirmation.cmd != CNFINVALID)
+    {
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
+void ProteusE_HandleRxByte(uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
+}
+
 /**
  * @brief Function that waits for the return value of Proteus-e (*_CNF),
  * when a command (*_REQ) was sent before.
  */
 static bool Wait4CNF(uint32_t maxTimeMs, uint8_t expectedCmdConfirmation, ProteusE_CMD_Status_t expectedStatus, bool resetConfirmState)
 {
-    int count = 0;
-    int timeStepMs = 5; /* 5ms */
-    int maxCount = maxTimeMs / timeStepMs;
-
     if (resetConfirmState)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmationArray[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
-            {
-                return (cmdConfirmationArray[i].status == expectedStatus);
-            }
-        }
 
-        if (count >= maxCount)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(timeStepMs);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, maxTimeMs, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static bool FillChecksum(ProteusE_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
     return true;
 }
 
@@ -638,6 +540,8 @@ bool ProteusE_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return ProteusE_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -686,6 +590,13 @@ bool ProteusE_Init(WE_UART_t* uartP, ProteusE_Pins_t* pinoutP, ProteusE_Operatio
     callbacks = callbackConfig;
     byteRxCallback = ProteusE_HandleRxByte;
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     ProteusE_uartP = uartP;
     if (false == ProteusE_uartP->uartInit(ProteusE_uartP->baudrate, ProteusE_uartP->flowControl, ProteusE_uartP->parity, &byteRxCallback))
     {
@@ -805,11 +716,7 @@ bool ProteusE_PinUartEnable()
         return false;
     }
     WE_Delay(15);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].status = CMD_Status_Invalid;
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     if (!WE_SetPin(ProteusE_pinsP->ProteusE_Pin_BusyUartEnable, WE_Pin_Level_High))
     {
         return false;
@@ -1041,6 +948,7 @@ bool ProteusE_Get(ProteusE_UserSettings_t userSetting, uint8_t* responseP, uint1
     txPacket.Length = 1;
     txPacket.Data[0] = userSetting;
 
+    ExpectResponse(PROTEUSE_CMD_GET_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1303,6 +1211,7 @@ bool ProteusE_GetState(ProteusE_ModuleState_t* moduleStateP)
     txPacket.Cmd = PROTEUSE_CMD_GETSTATE_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSE_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1449,6 +1358,7 @@ bool ProteusE_GPIOLocalReadConfig(ProteusE_GPIOConfigBlock_t* configP, uint16_t*
     txPacket.Cmd = PROTEUSE_CMD_GPIO_LOCAL_READCONFIG_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSE_CMD_GPIO_LOCAL_READCONFIG_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1562,6 +1472,7 @@ bool ProteusE_GPIOLocalRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, Prot
     txPacket.Data[0] = amountGPIOToRead;
     memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
+    ExpectResponse(PROTEUSE_CMD_GPIO_LOCAL_READ_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1667,6 +1578,7 @@ bool ProteusE_GPIORemoteReadConfig(ProteusE_GPIOConfigBlock_t* configP, uint16_t
     txPacket.Cmd = PROTEUSE_CMD_GPIO_REMOTE_READCONFIG_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSE_CMD_GPIO_REMOTE_READCONFIG_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1777,6 +1689,7 @@ bool ProteusE_GPIORemoteRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, Pro
     txPacket.Data[0] = amountGPIOToRead;
     memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
+    ExpectResponse(PROTEUSE_CMD_GPIO_REMOTE_READ_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1819,6 +1732,7 @@ bool ProteusE_GetBonds(ProteusE_BondDatabase_t* bondDatabaseP)
     txPacket.Cmd = PROTEUSE_CMD_GET_BONDS_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSE_CMD_GET_BONDS_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1921,6 +1835,7 @@ bool ProteusE_GetRAM(ProteusE_UserSettings_t userSetting, uint8_t* responseP, ui
     txPacket.Length = 1;
     txPacket.Data[0] = userSetting;
 
+    ExpectResponse(PROTEUSE_CMD_GET_RAM_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1947,6 +1862,7 @@ bool ProteusE_DTMEnable()
     txPacket.Cmd = PROTEUSE_CMD_DTMSTART_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSE_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
     if (!ProteusE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1992,3 +1908,11 @@ bool ProteusE_DTMStop() { return ProteusE_DTMRun(ProteusE_DTMCommand_Stop, 0x00,
 bool ProteusE_DTMSetPhy(ProteusE_Phy_t phy) { return ProteusE_DTMRun(ProteusE_DTMCommand_Setup, 0x02, (uint8_t)phy, 0x00); }
 
 bool ProteusE_DTMSetTXPower(ProteusE_TXPower_t power) { return ProteusE_DTMRun(ProteusE_DTMCommand_StartTX, (uint8_t)power, 0x02, 0x03); }
+
+uint32_t ProteusE_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ProteusE_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, ProteusE_uartP, statsP); }
+
+void ProteusE_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
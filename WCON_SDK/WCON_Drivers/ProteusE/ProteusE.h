@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -1302,6 +1303,31 @@ extern bool ProteusE_DTMSetPhy(ProteusE_Phy_t phy);
 */
 extern bool ProteusE_DTMSetTXPower(ProteusE_TXPower_t power);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ProteusE_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ProteusE_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ProteusE_ResetStatistics();
+#endif
+
 #endif // PROTEUSE_H_INCLUDED
 
 #ifdef __cplusplus
@@ -29,6 +29,7 @@
  */
 
 #include <ProteusII/ProteusII.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -174,15 +175,6 @@ typedef enum ProteusII_CMD_Status_t
     CMD_Status_NoStatus,
 } ProteusII_CMD_Status_t;
 
-/**
- * @brief Command confirmation.
- */
-typedef struct
-{
-    uint8_t cmd;                   /**< Variable to check if correct CMD has been confirmed */
-    ProteusII_CMD_Status_t status; /**< Variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ProteusII */
-} ProteusII_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
@@ -190,8 +182,10 @@ static ProteusII_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* reques
 static ProteusII_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
 ;
 
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static ProteusII_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see ProteusII_GetStatistics()) */
+#endif
 static ProteusII_OperationMode_t operationMode = ProteusII_OperationMode_CommandMode;
 static ProteusII_GetDevices_t* ProteusII_getDevicesP = NULL;
 static ProteusII_DriverState_t bleState;
@@ -207,9 +201,7 @@ static WE_UART_t* ProteusII_uartP = NULL;
 
 static ProteusII_CallbackConfig_t callbacks;
 static WE_UART_HandleRxByte_t byteRxCallback = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(ProteusII_CMD_Frame_t)]; /* For UART RX from module */
 
 /**************************************
@@ -218,407 +210,318 @@ static uint8_t rxBuffer[sizeof(ProteusII_CMD_Frame_t)]; /* For UART RX from modu
 
 static void ClearReceiveBuffers()
 {
-    bytesToReceive = 0;
-    rxByteCounter = 0;
-    checksum = 0;
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_Parser_Reset(&rxParser);
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 }
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+static void HandleGetDevicesCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ProteusII_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
-
-    uint16_t cmdLength = ((ProteusII_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
-
-    switch (rxPacket.Cmd)
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+    if ((confirmation->status == CMD_Status_Success) && (ProteusII_getDevicesP != NULL))
     {
-        case PROTEUSII_CMD_GETDEVICES_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            if ((cmdConfirmation.status == CMD_Status_Success) && (ProteusII_getDevicesP != NULL))
-            {
-                uint8_t size = rxPacket.Data[1];
-                if (size >= PROTEUSII_MAX_NUMBER_OF_DEVICES)
-                {
-                    size = PROTEUSII_MAX_NUMBER_OF_DEVICES;
-                }
-                ProteusII_getDevicesP->numberOfDevices = size;
-
-                uint16_t len = 2;
-                for (uint8_t i = 0; i < ProteusII_getDevicesP->numberOfDevices; i++)
-                {
-                    memcpy(&ProteusII_getDevicesP->devices[i].btmac[0], &rxPacket.Data[len], 6);
-                    ProteusII_getDevicesP->devices[i].rssi = rxPacket.Data[len + 6];
-                    ProteusII_getDevicesP->devices[i].txPower = rxPacket.Data[len + 7];
-                    ProteusII_getDevicesP->devices[i].deviceNameLength = rxPacket.Data[len + 8];
-                    memcpy(&ProteusII_getDevicesP->devices[i].deviceName[0], &rxPacket.Data[len + 9], ProteusII_getDevicesP->devices[i].deviceNameLength);
-                    len += (9 + ProteusII_getDevicesP->devices[i].deviceNameLength);
-                }
-            }
-            break;
-        }
-        case PROTEUSII_CMD_RESET_CNF:
-        case PROTEUSII_CMD_SCANSTART_CNF:
-        case PROTEUSII_CMD_SCANSTOP_CNF:
-        case PROTEUSII_CMD_GET_CNF:
-        case PROTEUSII_CMD_SET_CNF:
-        case PROTEUSII_CMD_SETBEACON_CNF:
-        case PROTEUSII_CMD_PASSKEY_CNF:
-        case PROTEUSII_CMD_PHYUPDATE_CNF:
-        case PROTEUSII_CMD_CONNECT_CNF:
-        case PROTEUSII_CMD_DATA_CNF:
-        case PROTEUSII_CMD_DISCONNECT_CNF:
-        case PROTEUSII_CMD_FACTORYRESET_CNF:
-        case PROTEUSII_CMD_SLEEP_CNF:
-        case PROTEUSII_CMD_UART_DISABLE_CNF:
-        case PROTEUSII_CMD_UART_ENABLE_IND:
-        case PROTEUSII_CMD_GET_BONDS_CNF:
-        case PROTEUSII_CMD_DELETE_BONDS_CNF:
-        case PROTEUSII_CMD_TXCOMPLETE_RSP:
-        case PROTEUSII_CMD_NUMERIC_COMP_CNF:
-        case PROTEUSII_CMD_DTMSTART_CNF:
-        case PROTEUSII_CMD_DTM_CNF:
+        uint8_t size = frame->data[1];
+        if (size >= PROTEUSII_MAX_NUMBER_OF_DEVICES)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            break;
+            size = PROTEUSII_MAX_NUMBER_OF_DEVICES;
         }
+        ProteusII_getDevicesP->numberOfDevices = size;
 
-        case PROTEUSII_CMD_GETSTATE_CNF:
+        uint16_t len = 2;
+        for (uint8_t i = 0; i < ProteusII_getDevicesP->numberOfDevices; i++)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            /* GETSTATE_CNF has no status field */
-            cmdConfirmation.status = CMD_Status_NoStatus;
-
-            switch (rxPacket.Data[1])
-            {
-                case ProteusII_BLE_Action_Idle:
-                {
-                    bleState = ProteusII_DriverState_BLE_Idle;
-                }
-                break;
-                case ProteusII_BLE_Action_Connected:
-                case ProteusII_BLE_Action_None:
-                case ProteusII_BLE_Action_Scanning:
-                case ProteusII_BLE_Action_Sleep:
-                case ProteusII_BLE_Action_DTM:
-                default:
-                {
-                    /* do not use this information */
-                }
-                break;
-            }
-
-            break;
+            memcpy(&ProteusII_getDevicesP->devices[i].btmac[0], &frame->data[len], 6);
+            ProteusII_getDevicesP->devices[i].rssi = frame->data[len + 6];
+            ProteusII_getDevicesP->devices[i].txPower = frame->data[len + 7];
+            ProteusII_getDevicesP->devices[i].deviceNameLength = frame->data[len + 8];
+            memcpy(&ProteusII_getDevicesP->devices[i].deviceName[0], &frame->data[len + 9], ProteusII_getDevicesP->devices[i].deviceNameLength);
+            len += (9 + ProteusII_getDevicesP->devices[i].deviceNameLength);
         }
+    }
+}
 
-        case PROTEUSII_CMD_CHANNELOPEN_RSP:
-        {
-            /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), Max Payload (1byte)*/
-            bleState = ProteusII_DriverState_BLE_ChannelOpen;
-            if (callbacks.channelOpenCb != NULL)
-            {
-                callbacks.channelOpenCb(&rxPacket.Data[1], (uint16_t)rxPacket.Data[7]);
-            }
-            break;
-        }
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
 
-        case PROTEUSII_CMD_CONNECT_IND:
-        {
-            bool success = (rxPacket.Data[0] == CMD_Status_Success);
-            if (success)
-            {
-                bleState = ProteusII_DriverState_BLE_Connected;
-            }
-            if (callbacks.connectCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 7)
-                {
-                    memcpy(btMac, &rxPacket.Data[1], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. connection failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.connectCb(success, btMac);
-            }
-            break;
-        }
+static void HandleGetStateCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    /* GETSTATE_CNF has no status field */
+    confirmation->status = CMD_Status_NoStatus;
 
-        case PROTEUSII_CMD_DISCONNECT_IND:
+    switch (frame->data[1])
+    {
+        case ProteusII_BLE_Action_Idle:
         {
             bleState = ProteusII_DriverState_BLE_Idle;
-            if (callbacks.disconnectCb != NULL)
-            {
-                ProteusII_DisconnectReason_t reason = ProteusII_DisconnectReason_Unknown;
-                switch (rxPacket.Data[0])
-                {
-                    case 0x08:
-                        reason = ProteusII_DisconnectReason_ConnectionTimeout;
-                        break;
-
-                    case 0x13:
-                        reason = ProteusII_DisconnectReason_UserTerminatedConnection;
-                        break;
-
-                    case 0x16:
-                        reason = ProteusII_DisconnectReason_HostTerminatedConnection;
-                        break;
-
-                    case 0x3B:
-                        reason = ProteusII_DisconnectReason_ConnectionIntervalUnacceptable;
-                        break;
-
-                    case 0x3D:
-                        reason = ProteusII_DisconnectReason_MicFailure;
-                        break;
-
-                    case 0x3E:
-                        reason = ProteusII_DisconnectReason_ConnectionSetupFailed;
-                        break;
-                }
-                callbacks.disconnectCb(reason);
-            }
-            break;
         }
-
-        case PROTEUSII_CMD_DATA_IND:
+        break;
+        case ProteusII_BLE_Action_Connected:
+        case ProteusII_BLE_Action_None:
+        case ProteusII_BLE_Action_Scanning:
+        case ProteusII_BLE_Action_Sleep:
+        case ProteusII_BLE_Action_DTM:
+        default:
         {
-            if (callbacks.rxCb != NULL)
-            {
-                callbacks.rxCb(&rxPacket.Data[7], rxPacket.Length - 7, &rxPacket.Data[0], rxPacket.Data[6]);
-            }
-            break;
+            /* do not use this information */
         }
+        break;
+    }
+}
 
-        case PROTEUSII_CMD_BEACON_IND:
-        case PROTEUSII_CMD_BEACON_RSP:
-        {
-            if (callbacks.beaconRxCb != NULL)
-            {
-                callbacks.beaconRxCb(&rxPacket.Data[7], rxPacket.Length - 7, &rxPacket.Data[0], rxPacket.Data[6]);
-            }
-            break;
-        }
+static void HandleChannelOpenRsp(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), Max Payload (1byte)*/
+    bleState = ProteusII_DriverState_BLE_ChannelOpen;
+    if (callbacks.channelOpenCb != NULL)
+    {
+        callbacks.channelOpenCb(&frame->data[1], (uint16_t)frame->data[7]);
+    }
+}
 
-        case PROTEUSII_CMD_RSSI_IND:
+static void HandleConnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    bool success = (frame->data[0] == CMD_Status_Success);
+    if (success)
+    {
+        bleState = ProteusII_DriverState_BLE_Connected;
+    }
+    if (callbacks.connectCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 7)
         {
-            if (callbacks.rssiCb != NULL)
-            {
-                if (rxPacket.Length >= 8)
-                {
-                    callbacks.rssiCb(&rxPacket.Data[0], rxPacket.Data[6], rxPacket.Data[7]);
-                }
-            }
-            break;
+            memcpy(btMac, &frame->data[1], sizeof(btMac));
         }
-
-        case PROTEUSII_CMD_SECURITY_IND:
+        else
         {
-            if (callbacks.securityCb != NULL)
-            {
-                callbacks.securityCb(&rxPacket.Data[1], rxPacket.Data[0]);
-            }
-            break;
+            /* Packet doesn't contain BTMAC (e.g. connection failed) */
+            memset(btMac, 0, sizeof(btMac));
         }
+        callbacks.connectCb(success, btMac);
+    }
+}
 
-        case PROTEUSII_CMD_PASSKEY_IND:
+static void HandleDisconnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    bleState = ProteusII_DriverState_BLE_Idle;
+    if (callbacks.disconnectCb != NULL)
+    {
+        ProteusII_DisconnectReason_t reason = ProteusII_DisconnectReason_Unknown;
+        switch (frame->data[0])
         {
-            if (callbacks.passkeyCb != NULL)
-            {
-                callbacks.passkeyCb(&rxPacket.Data[1]);
-            }
-            break;
-        }
+            case 0x08:
+                reason = ProteusII_DisconnectReason_ConnectionTimeout;
+                break;
 
-        case PROTEUSII_CMD_DISPLAY_PASSKEY_IND:
-        {
-            if (callbacks.displayPasskeyCb != NULL)
-            {
-                callbacks.displayPasskeyCb((ProteusII_DisplayPasskeyAction_t)rxPacket.Data[0], &rxPacket.Data[1], &rxPacket.Data[7]);
-            }
-            break;
-        }
+            case 0x13:
+                reason = ProteusII_DisconnectReason_UserTerminatedConnection;
+                break;
 
-        case PROTEUSII_CMD_PHYUPDATE_IND:
-        {
-            if (callbacks.phyUpdateCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 9)
-                {
-                    memcpy(btMac, &rxPacket.Data[3], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.phyUpdateCb((rxPacket.Data[0] == CMD_Status_Success), btMac, (ProteusII_Phy_t)rxPacket.Data[1], (ProteusII_Phy_t)rxPacket.Data[2]);
-            }
-            break;
-        }
+            case 0x16:
+                reason = ProteusII_DisconnectReason_HostTerminatedConnection;
+                break;
 
-        case PROTEUSII_CMD_SLEEP_IND:
-        {
-            if (callbacks.sleepCb != NULL)
-            {
-                callbacks.sleepCb();
-            }
-            break;
-        }
+            case 0x3B:
+                reason = ProteusII_DisconnectReason_ConnectionIntervalUnacceptable;
+                break;
 
-        case PROTEUSII_CMD_ERROR_IND:
-        {
-            if (callbacks.errorCb != NULL)
-            {
-                callbacks.errorCb(rxPacket.Data[0]);
-            }
-            break;
-        }
+            case 0x3D:
+                reason = ProteusII_DisconnectReason_MicFailure;
+                break;
 
-        default:
-        {
-            /* invalid*/
-            break;
+            case 0x3E:
+                reason = ProteusII_DisconnectReason_ConnectionSetupFailed;
+                break;
         }
+        callbacks.disconnectCb(reason);
     }
+}
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.rxCb != NULL)
+    {
+        callbacks.rxCb(&frame->data[7], frame->length - 7, &frame->data[0], frame->data[6]);
+    }
+}
+
+static void HandleBeaconInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.beaconRxCb != NULL)
+    {
+        callbacks.beaconRxCb(&frame->data[7], frame->length - 7, &frame->data[0], frame->data[6]);
+    }
+}
+
+static void HandleRssiInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.rssiCb != NULL)
     {
-        if (cmdConfirmationArray[i].cmd == CNFINVALID)
+        if (frame->length >= 8)
         {
-            cmdConfirmationArray[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmationArray[i].status = cmdConfirmation.status;
-            break;
+            callbacks.rssiCb(&frame->data[0], frame->data[6], frame->data[7]);
         }
     }
 }
 
-static void ProteusII_HandleRxByte(uint8_t* dataP, size_t size)
+static void HandleSecurityInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.securityCb != NULL)
+    {
+        callbacks.securityCb(&frame->data[1], frame->data[0]);
+    }
+}
+
+static void HandlePasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    for (; size > 0; size--, dataP++)
+    if (callbacks.passkeyCb != NULL)
     {
-        if (rxByteCounter < sizeof(rxBuffer))
+        callbacks.passkeyCb(&frame->data[1]);
+    }
+}
+
+static void HandleDisplayPasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.displayPasskeyCb != NULL)
+    {
+        callbacks.displayPasskeyCb((ProteusII_DisplayPasskeyAction_t)frame->data[0], &frame->data[1], &frame->data[7]);
+    }
+}
+
+static void HandlePhyUpdateInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.phyUpdateCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 9)
         {
-            rxBuffer[rxByteCounter] = *dataP;
+            memcpy(btMac, &frame->data[3], sizeof(btMac));
         }
-
-        switch (rxByteCounter)
+        else
         {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
+            /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
+            memset(btMac, 0, sizeof(btMac));
+        }
+        callbacks.phyUpdateCb((frame->data[0] == CMD_Status_Success), btMac, (ProteusII_Phy_t)frame->data[1], (ProteusII_Phy_t)frame->data[2]);
+    }
+}
 
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
+static void HandleSleepInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.sleepCb != NULL)
+    {
+        callbacks.sleepCb();
+    }
+}
 
-            case 2:
-                /* length field lsb */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
+static void HandleErrorInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.errorCb != NULL)
+    {
+        callbacks.errorCb(frame->data[0]);
+    }
+}
 
-            case 3:
-                /* length field msb */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [PROTEUSII_CMD_GETDEVICES_CNF]      = HandleGetDevicesCnf,
+    [PROTEUSII_CMD_RESET_CNF]           = HandleStatusCnf,
+    [PROTEUSII_CMD_SCANSTART_CNF]       = HandleStatusCnf,
+    [PROTEUSII_CMD_SCANSTOP_CNF]        = HandleStatusCnf,
+    [PROTEUSII_CMD_GET_CNF]             = HandleStatusCnf,
+    [PROTEUSII_CMD_SET_CNF]             = HandleStatusCnf,
+    [PROTEUSII_CMD_SETBEACON_CNF]       = HandleStatusCnf,
+    [PROTEUSII_CMD_PASSKEY_CNF]         = HandleStatusCnf,
+    [PROTEUSII_CMD_PHYUPDATE_CNF]       = HandleStatusCnf,
+    [PROTEUSII_CMD_CONNECT_CNF]         = HandleStatusCnf,
+    [PROTEUSII_CMD_DATA_CNF]            = HandleStatusCnf,
+    [PROTEUSII_CMD_DISCONNECT_CNF]      = HandleStatusCnf,
+    [PROTEUSII_CMD_FACTORYRESET_CNF]    = HandleStatusCnf,
+    [PROTEUSII_CMD_SLEEP_CNF]           = HandleStatusCnf,
+    [PROTEUSII_CMD_UART_DISABLE_CNF]    = HandleStatusCnf,
+    [PROTEUSII_CMD_UART_ENABLE_IND]     = HandleStatusCnf,
+    [PROTEUSII_CMD_GET_BONDS_CNF]       = HandleStatusCnf,
+    [PROTEUSII_CMD_DELETE_BONDS_CNF]    = HandleStatusCnf,
+    [PROTEUSII_CMD_TXCOMPLETE_RSP]      = HandleStatusCnf,
+    [PROTEUSII_CMD_NUMERIC_COMP_CNF]    = HandleStatusCnf,
+    [PROTEUSII_CMD_DTMSTART_CNF]        = HandleStatusCnf,
+    [PROTEUSII_CMD_DTM_CNF]             = HandleStatusCnf,
+    [PROTEUSII_CMD_GETSTATE_CNF]        = HandleGetStateCnf,
+    [PROTEUSII_CMD_CHANNELOPEN_RSP]     = HandleChannelOpenRsp,
+    [PROTEUSII_CMD_CONNECT_IND]         = HandleConnectInd,
+    [PROTEUSII_CMD_DISCONNECT_IND]      = HandleDisconnectInd,
+    [PROTEUSII_CMD_DATA_IND]            = HandleDataInd,
+    [PROTEUSII_CMD_BEACON_IND]          = HandleBeaconInd,
+    [PROTEUSII_CMD_BEACON_RSP]          = HandleBeaconInd,
+    [PROTEUSII_CMD_RSSI_IND]            = HandleRssiInd,
+    [PROTEUSII_CMD_SECURITY_IND]        = HandleSecurityInd,
+    [PROTEUSII_CMD_PASSKEY_IND]         = HandlePasskeyInd,
+    [PROTEUSII_CMD_DISPLAY_PASSKEY_IND] = HandleDisplayPasskeyInd,
+    [PROTEUSII_CMD_PHYUPDATE_IND]       = HandlePhyUpdateInd,
+    [PROTEUSII_CMD_SLEEP_IND]           = HandleSleepInd,
+    [PROTEUSII_CMD_ERROR_IND]           = HandleErrorInd,
+};
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
+
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if (cmdConfirmation.cmd != CNFINVALID)
+    {
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
+static void ProteusII_HandleRxByte(uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
+}
+
 /**
  * @brief Function that waits for the return value of ProteusII (*_CNF),
  * when a command (*_REQ) was sent before.
  */
 static bool Wait4CNF(uint32_t maxTimeMs, uint8_t expectedCmdConfirmation, ProteusII_CMD_Status_t expectedStatus, bool resetConfirmState)
 {
-    int count = 0;
-    int timeStepMs = 5; /* 5ms */
-    int maxCount = maxTimeMs / timeStepMs;
-
     if (resetConfirmState)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmationArray[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
-            {
-                return (cmdConfirmationArray[i].status == expectedStatus);
-            }
-        }
 
-        if (count >= maxCount)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(timeStepMs);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, maxTimeMs, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static bool FillChecksum(ProteusII_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
     return true;
 }
 
@@ -640,6 +543,8 @@ bool ProteusII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return ProteusII_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -685,6 +590,13 @@ bool ProteusII_Init(WE_UART_t* uartP, ProteusII_Pins_t* pinoutP, ProteusII_Opera
     callbacks = callbackConfig;
     byteRxCallback = ProteusII_HandleRxByte;
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     ProteusII_uartP = uartP;
     if (false == ProteusII_uartP->uartInit(ProteusII_uartP->baudrate, ProteusII_uartP->flowControl, ProteusII_uartP->parity, &byteRxCallback))
     {
@@ -739,11 +651,7 @@ bool ProteusII_PinWakeup()
         return false;
     }
     WE_Delay(5);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].status = CMD_Status_Invalid;
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     if (!WE_SetPin(ProteusII_pinsP->ProteusII_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
@@ -760,11 +668,7 @@ bool ProteusII_PinUartEnable()
         return false;
     }
     WE_Delay(15);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].status = CMD_Status_Invalid;
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     if (!WE_SetPin(ProteusII_pinsP->ProteusII_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
@@ -1106,6 +1010,7 @@ bool ProteusII_Get(ProteusII_UserSettings_t userSetting, uint8_t* responseP, uin
     txPacket.Length = 1;
     txPacket.Data[0] = userSetting;
 
+    ExpectResponse(PROTEUSII_CMD_GET_CNF);
     FillChecksum(&txPacket);
     if (!ProteusII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1352,6 +1257,7 @@ bool ProteusII_GetState(ProteusII_ModuleState_t* moduleStateP)
     txPacket.Cmd = PROTEUSII_CMD_GETSTATE_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSII_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
     if (!ProteusII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1547,6 +1453,7 @@ bool ProteusII_GetBonds(ProteusII_BondDatabase_t* bondDatabaseP)
     txPacket.Cmd = PROTEUSII_CMD_GET_BONDS_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSII_CMD_GET_BONDS_CNF);
     FillChecksum(&txPacket);
     if (!ProteusII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1618,6 +1525,7 @@ bool ProteusII_DTMEnable()
     txPacket.Cmd = PROTEUSII_CMD_DTMSTART_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSII_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
     if (!ProteusII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1706,3 +1614,11 @@ bool ProteusII_DTMStop() { return ProteusII_DTMRun(ProteusII_DTMCommand_Stop, 0x
 bool ProteusII_DTMSetPhy(ProteusII_Phy_t phy) { return ProteusII_DTMRun(ProteusII_DTMCommand_Setup, 0x02, (uint8_t)phy, 0x00); }
 
 bool ProteusII_DTMSetTXPower(ProteusII_TXPower_t power) { return ProteusII_DTMRun(ProteusII_DTMCommand_StartTX, (uint8_t)power, 0x02, 0x03); }
+
+uint32_t ProteusII_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ProteusII_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, ProteusII_uartP, statsP); }
+
+void ProteusII_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
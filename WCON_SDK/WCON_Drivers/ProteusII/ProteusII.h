@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -1007,6 +1008,31 @@ extern bool ProteusII_DTMStartTXCarrier(uint8_t channel);
 extern bool ProteusII_DTMStop();
 extern bool ProteusII_DTMSetPhy(ProteusII_Phy_t phy);
 extern bool ProteusII_DTMSetTXPower(ProteusII_TXPower_t power);
+
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ProteusII_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ProteusII_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ProteusII_ResetStatistics();
+#endif
 #endif // PROTEUSII_H_INCLUDED
 
 #ifdef __cplusplus
@@ -29,6 +29,7 @@
  */
 
 #include <ProteusIII/ProteusIII.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -214,520 +215,789 @@ typedef enum ProteusIII_CMD_Status_t
 } ProteusIII_CMD_Status_t;
 
 /**
- * @brief Command confirmation.
+ * @brief State of a packet sent using ProteusIII_TransmitPipelined().
  */
-typedef struct
+typedef enum ProteusIII_TxState_t
 {
-    uint8_t cmd;                    /**< Variable to check if correct CMD has been confirmed */
-    ProteusIII_CMD_Status_t status; /**< Variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ProteusIII */
-} ProteusIII_CMD_Confirmation_t;
+    ProteusIII_TxState_Sent,      /**< waiting for CMD_DATA_CNF */
+    ProteusIII_TxState_Confirmed, /**< accepted by the module, waiting for CMD_TXCOMPLETE_RSP */
+    ProteusIII_TxState_Done,      /**< result known, but not yet reported (as an older packet is still outstanding) */
+} ProteusIII_TxState_t;
+
+/**
+ * @brief Entry of the transmit window, i.e. a packet sent using ProteusIII_TransmitPipelined().
+ */
+typedef struct ProteusIII_TxWindowEntry_t
+{
+    uint32_t sentTick;                   /**< time the packet has been sent (WE_GetTick()) */
+    volatile ProteusIII_TxState_t state; /**< state of the packet */
+    volatile bool success;               /**< result of the packet (valid in state ProteusIII_TxState_Done) */
+#if defined(WE_STATS_ENABLED)
+    uint32_t sentUs; /**< time the packet has been sent in us (latency measurement) */
+#endif
+} ProteusIII_TxWindowEntry_t;
 
-/**************************************
- *          Static variables          *
- **************************************/
-static ProteusIII_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
-static ProteusIII_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
-
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static ProteusIII_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
-static ProteusIII_OperationMode_t operationMode = ProteusIII_OperationMode_CommandMode;
-static ProteusIII_GetDevices_t* ProteusIII_getDevicesP = NULL;
-static ProteusIII_DriverState_t bleState;
 /**
- * @brief Pin configuration struct pointer.
+ * @brief State of a ProteusIII driver instance.
  */
-static ProteusIII_Pins_t* ProteusIII_pinsP = NULL;
+struct ProteusIII_Handle_t
+{
+    ProteusIII_CMD_Frame_t txPacket;                                                 /**< request to be sent to the module */
+    ProteusIII_CMD_Frame_t rxPacket;                                                 /**< received packet that has been sent by the module */
+    CMDFrame_ConfirmationQueue_t cmdConfirmations;                                   /**< received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t stats;                                                                /**< performance counters and latency histograms */
+#endif
+    ProteusIII_OperationMode_t operationMode;                                        /**< operation mode of the module */
+    ProteusIII_GetDevices_t* getDevicesP;                                            /**< result buffer of a pending ProteusIII_GetDevices() request */
+    ProteusIII_DriverState_t bleState;                                               /**< BLE connection state */
+    ProteusIII_Pins_t* pinsP;                                                        /**< pin configuration struct pointer */
+    WE_UART_t* uartP;                                                                /**< UART configuration struct pointer */
+    ProteusIII_CallbackConfig_t callbacks;                                           /**< user callbacks */
+    ProteusIII_TxWindowEntry_t txWindow[PROTEUSIII_TX_WINDOW_SIZE];                  /**< outstanding pipelined packets, packet n is stored at index n % PROTEUSIII_TX_WINDOW_SIZE */
+    volatile uint8_t txRequestCount;                                                 /**< number of packets sent using ProteusIII_TransmitPipelined() */
+    volatile uint8_t txConfirmCount;                                                 /**< number of those packets confirmed by CMD_DATA_CNF (or expired before) */
+    volatile uint8_t txCompleteCount;                                                /**< number of those packets whose result has been reported */
+    volatile bool txReporting;                                                       /**< true while results are being reported using txCompleteCb */
+    WE_Event_t txCompleteEvent;                                                      /**< is signaled when a pipelined packet has been completed */
+    CMDFrame_AsyncQueue_t asyncQueue;                                                /**< asynchronous requests waiting for their confirmation */
+    WE_UART_HandleRxByte_t byteRxCallback;                                           /**< function called by the UART driver on data reception */
+    CMDFrame_Parser_t rxParser;                                                      /**< assembles the frames received from the module */
+    uint8_t rxBuffer[sizeof(ProteusIII_CMD_Frame_t)];                                /**< For UART RX from module */
+};
 
 /**
- * @brief Uart configuration struct pointer.
+ * @brief Initial state of a driver instance.
  */
-static WE_UART_t* ProteusIII_uartP = NULL;
+#define HANDLE_INITIALIZER {.txPacket = {.Stx = CMD_STX, .Length = 0}, .rxPacket = {.Stx = CMD_STX, .Length = 0}, .operationMode = ProteusIII_OperationMode_CommandMode}
 
-static ProteusIII_CallbackConfig_t callbacks;
-static WE_UART_HandleRxByte_t byteRxCallback = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
-static uint8_t rxBuffer[sizeof(ProteusIII_CMD_Frame_t)]; /* For UART RX from module */
+#if PROTEUSIII_MAX_INSTANCES > 4
+#error "PROTEUSIII_MAX_INSTANCES must not exceed 4"
+#endif
+
+#if (PROTEUSIII_TX_WINDOW_SIZE < 1) || (PROTEUSIII_TX_WINDOW_SIZE > 128) || ((PROTEUSIII_TX_WINDOW_SIZE & (PROTEUSIII_TX_WINDOW_SIZE - 1)) != 0)
+#error "PROTEUSIII_TX_WINDOW_SIZE must be a power of two in the range 1 to 128"
+#endif
+
+/**************************************
+ *          Static variables          *
+ **************************************/
+static ProteusIII_Handle_t instances[PROTEUSIII_MAX_INSTANCES] = {HANDLE_INITIALIZER,
+#if PROTEUSIII_MAX_INSTANCES > 1
+                                                                  HANDLE_INITIALIZER,
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 2
+                                                                  HANDLE_INITIALIZER,
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 3
+                                                                  HANDLE_INITIALIZER,
+#endif
+};
+
+/**
+ * @brief Instance used by the functions without handle parameter.
+ */
+#define DEFAULT_HANDLE (&instances[0])
 
 /**************************************
  *         Static functions           *
  **************************************/
 
-static void ClearReceiveBuffers()
+/**
+ * @brief Returns the number of pipelined packets that have not been completed yet.
+ */
+static inline uint8_t GetOutstandingTxCount(ProteusIII_Handle_t* handle) { return (uint8_t)(handle->txRequestCount - handle->txCompleteCount); }
+
+/**
+ * @brief Returns the transmit window entry of the n-th pipelined packet.
+ */
+static inline ProteusIII_TxWindowEntry_t* GetTxWindowEntry(ProteusIII_Handle_t* handle, uint8_t n) { return &handle->txWindow[n % PROTEUSIII_TX_WINDOW_SIZE]; }
+
+/**
+ * @brief Reports the results of completed pipelined packets using txCompleteCb.
+ *
+ * Results are reported strictly in the order the packets have been sent, so a packet
+ * completed early is held back until all older packets have been completed as well.
+ * Only one context reports at a time; a context calling this function while another
+ * one is reporting leaves the newly completed packets to that context.
+ */
+static void ReportPipelinedTransmits(ProteusIII_Handle_t* handle)
 {
-    bytesToReceive = 0;
-    rxByteCounter = 0;
-    checksum = 0;
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+    uint32_t criticalState = WE_EnterCritical();
+    if (handle->txReporting)
     {
-        cmdConfirmationArray[i].cmd = CNFINVALID;
+        WE_ExitCritical(criticalState);
+        return;
     }
+    handle->txReporting = true;
+
+    while ((handle->txCompleteCount != handle->txRequestCount) && (GetTxWindowEntry(handle, handle->txCompleteCount)->state == ProteusIII_TxState_Done))
+    {
+        bool success = GetTxWindowEntry(handle, handle->txCompleteCount)->success;
+        handle->txCompleteCount++;
+        WE_ExitCritical(criticalState);
+
+        WE_SignalEvent(&handle->txCompleteEvent);
+        if (handle->callbacks.txCompleteCb != NULL)
+        {
+            handle->callbacks.txCompleteCb(success);
+        }
+
+        criticalState = WE_EnterCritical();
+    }
+
+    handle->txReporting = false;
+    WE_ExitCritical(criticalState);
 }
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+/**
+ * @brief Reports all outstanding pipelined packets as failed (e.g. on disconnect).
+ */
+static void AbortPipelinedTransmits(ProteusIII_Handle_t* handle)
 {
-    ProteusIII_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    uint32_t criticalState = WE_EnterCritical();
+    for (uint8_t n = handle->txCompleteCount; n != handle->txRequestCount; n++)
+    {
+        ProteusIII_TxWindowEntry_t* entry = GetTxWindowEntry(handle, n);
+        if (entry->state != ProteusIII_TxState_Done)
+        {
+            entry->success = false;
+            entry->state = ProteusIII_TxState_Done;
+        }
+    }
+    handle->txConfirmCount = handle->txRequestCount;
+    WE_ExitCritical(criticalState);
+
+    ReportPipelinedTransmits(handle);
+}
 
-    uint16_t cmdLength = ((ProteusIII_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
+/**
+ * @brief Reports pipelined packets as failed whose responses haven't been received within
+ * PROTEUSIII_TX_TIMEOUT_MS (e.g. as a response has been lost), freeing their slots of the transmit window.
+ *
+ * @return Time in ms until the next outstanding packet expires (WE_WAIT_FOREVER if there is none)
+ */
+static uint32_t ExpirePipelinedTransmits(ProteusIII_Handle_t* handle)
+{
+    uint32_t nextExpiryMs = WE_WAIT_FOREVER;
+    uint32_t now = WE_GetTick();
 
-    switch (rxPacket.Cmd)
+    uint32_t criticalState = WE_EnterCritical();
+    /* packets have been sent in order, so the search can stop at the first packet that hasn't expired */
+    for (uint8_t n = handle->txCompleteCount; n != handle->txRequestCount; n++)
     {
-        case PROTEUSIII_CMD_GETDEVICES_CNF:
+        ProteusIII_TxWindowEntry_t* entry = GetTxWindowEntry(handle, n);
+        if (entry->state == ProteusIII_TxState_Done)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            if ((cmdConfirmation.status == CMD_Status_Success) && (ProteusIII_getDevicesP != NULL))
-            {
-                uint8_t size = rxPacket.Data[1];
-                if (size >= PROTEUSIII_MAX_NUMBER_OF_DEVICES)
-                {
-                    size = PROTEUSIII_MAX_NUMBER_OF_DEVICES;
-                }
-                ProteusIII_getDevicesP->numberOfDevices = size;
-
-                uint16_t len = 2;
-                for (uint8_t i = 0; i < ProteusIII_getDevicesP->numberOfDevices; i++)
-                {
-                    memcpy(&ProteusIII_getDevicesP->devices[i].btmac[0], &rxPacket.Data[len], 6);
-                    ProteusIII_getDevicesP->devices[i].rssi = rxPacket.Data[len + 6];
-                    ProteusIII_getDevicesP->devices[i].txPower = rxPacket.Data[len + 7];
-                    ProteusIII_getDevicesP->devices[i].deviceNameLength = rxPacket.Data[len + 8];
-                    memcpy(&ProteusIII_getDevicesP->devices[i].deviceName[0], &rxPacket.Data[len + 9], ProteusIII_getDevicesP->devices[i].deviceNameLength);
-                    len += (9 + ProteusIII_getDevicesP->devices[i].deviceNameLength);
-                }
-            }
-            break;
+            continue;
         }
-        case PROTEUSIII_CMD_RESET_CNF:
-        case PROTEUSIII_CMD_SCANSTART_CNF:
-        case PROTEUSIII_CMD_SCANSTOP_CNF:
-        case PROTEUSIII_CMD_GET_CNF:
-        case PROTEUSIII_CMD_SET_CNF:
-        case PROTEUSIII_CMD_SETBEACON_CNF:
-        case PROTEUSIII_CMD_PASSKEY_CNF:
-        case PROTEUSIII_CMD_PHYUPDATE_CNF:
-        case PROTEUSIII_CMD_CONNECT_CNF:
-        case PROTEUSIII_CMD_DATA_CNF:
-        case PROTEUSIII_CMD_DISCONNECT_CNF:
-        case PROTEUSIII_CMD_FACTORYRESET_CNF:
-        case PROTEUSIII_CMD_SLEEP_CNF:
-        case PROTEUSIII_CMD_UART_DISABLE_CNF:
-        case PROTEUSIII_CMD_UART_ENABLE_IND:
-        case PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_CNF:
-        case PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_CNF:
-        case PROTEUSIII_CMD_GPIO_LOCAL_WRITE_CNF:
-        case PROTEUSIII_CMD_GPIO_LOCAL_READ_CNF:
-        case PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_CNF:
-        case PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_CNF:
-        case PROTEUSIII_CMD_GPIO_REMOTE_WRITE_CNF:
-        case PROTEUSIII_CMD_GPIO_REMOTE_READ_CNF:
-        case PROTEUSIII_CMD_GET_BONDS_CNF:
-        case PROTEUSIII_CMD_DELETE_BONDS_CNF:
-        case PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_CNF:
-        case PROTEUSIII_CMD_TXCOMPLETE_RSP:
-        case PROTEUSIII_CMD_NUMERIC_COMP_CNF:
-        case PROTEUSIII_CMD_DTMSTART_CNF:
-        case PROTEUSIII_CMD_DTM_CNF:
+
+        uint32_t elapsed = now - entry->sentTick;
+        if (elapsed < PROTEUSIII_TX_TIMEOUT_MS)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
+            nextExpiryMs = PROTEUSIII_TX_TIMEOUT_MS - elapsed;
             break;
         }
 
-        case PROTEUSIII_CMD_GETSTATE_CNF:
+        entry->success = false;
+        entry->state = ProteusIII_TxState_Done;
+        WE_STATS_ADD(&handle->stats, timeouts, 1);
+        if ((uint8_t)(n - handle->txCompleteCount) >= (uint8_t)(handle->txConfirmCount - handle->txCompleteCount))
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            /* GETSTATE_CNF has no status field*/
-            cmdConfirmation.status = CMD_Status_NoStatus;
+            /* CMD_DATA_CNF is considered lost, so the next one belongs to the following packet */
+            handle->txConfirmCount = n + 1;
+        }
+    }
+    WE_ExitCritical(criticalState);
 
-            switch (rxPacket.Data[1])
-            {
-                case ProteusIII_BLE_Action_Idle:
-                {
-                    bleState = ProteusIII_DriverState_BLE_Idle;
-                }
-                break;
-                case ProteusIII_BLE_Action_Connected:
-                case ProteusIII_BLE_Action_None:
-                case ProteusIII_BLE_Action_Scanning:
-                case ProteusIII_BLE_Action_Sleep:
-                case ProteusIII_BLE_Action_DTM:
-                default:
-                {
-                    /* do not use this information */
-                }
-                break;
-            }
+    ReportPipelinedTransmits(handle);
+    return nextExpiryMs;
+}
 
-            break;
+/**
+ * @brief Waits until at most maxOutstanding pipelined packets are outstanding.
+ */
+static bool WaitTxWindow(ProteusIII_Handle_t* handle, uint8_t maxOutstanding, uint32_t maxTimeMs)
+{
+    uint32_t t0 = WE_GetTick();
+    while (1)
+    {
+        uint32_t nextExpiryMs = ExpirePipelinedTransmits(handle);
+        if (GetOutstandingTxCount(handle) <= maxOutstanding)
+        {
+            return true;
         }
 
-        case PROTEUSIII_CMD_CHANNELOPEN_RSP:
+        uint32_t elapsed = WE_GetTick() - t0;
+        if (elapsed >= maxTimeMs)
         {
-            /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), Max Payload (1byte)*/
-            bleState = ProteusIII_DriverState_BLE_ChannelOpen;
-            if (callbacks.channelOpenCb != NULL)
-            {
-                callbacks.channelOpenCb(&rxPacket.Data[1], (uint16_t)rxPacket.Data[7]);
-            }
-            break;
+            return false;
         }
 
-        case PROTEUSIII_CMD_CONNECT_IND:
+        /* wait (returns as soon as a packet has been completed or the oldest packet expires) */
+        uint32_t waitMs = maxTimeMs - elapsed;
+        WE_WaitEvent(&handle->txCompleteEvent, (nextExpiryMs < waitMs) ? nextExpiryMs : waitMs);
+    }
+}
+
+static void ClearReceiveBuffers(ProteusIII_Handle_t* handle)
+{
+    CMDFrame_Parser_Reset(&handle->rxParser);
+    AbortPipelinedTransmits(handle);
+    CMDFrame_AsyncQueue_Abort(&handle->asyncQueue);
+    CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
+}
+
+static void HandleGetDevicesCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+    if ((confirmation->status == CMD_Status_Success) && (handle->getDevicesP != NULL))
+    {
+        uint8_t size = frame->data[1];
+        if (size >= PROTEUSIII_MAX_NUMBER_OF_DEVICES)
         {
-            bool success = (rxPacket.Data[0] == CMD_Status_Success);
-            if (success)
-            {
-                bleState = ProteusIII_DriverState_BLE_Connected;
-            }
-            if (callbacks.connectCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 7)
-                {
-                    memcpy(btMac, &rxPacket.Data[1], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. connection failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.connectCb(success, btMac);
-            }
-            break;
+            size = PROTEUSIII_MAX_NUMBER_OF_DEVICES;
         }
+        handle->getDevicesP->numberOfDevices = size;
 
-        case PROTEUSIII_CMD_DISCONNECT_IND:
+        uint16_t len = 2;
+        for (uint8_t i = 0; i < handle->getDevicesP->numberOfDevices; i++)
         {
-            bleState = ProteusIII_DriverState_BLE_Idle;
-            if (callbacks.disconnectCb != NULL)
-            {
-                ProteusIII_DisconnectReason_t reason = ProteusIII_DisconnectReason_Unknown;
-                switch (rxPacket.Data[0])
-                {
-                    case 0x08:
-                        reason = ProteusIII_DisconnectReason_ConnectionTimeout;
-                        break;
+            memcpy(&handle->getDevicesP->devices[i].btmac[0], &frame->data[len], 6);
+            handle->getDevicesP->devices[i].rssi = frame->data[len + 6];
+            handle->getDevicesP->devices[i].txPower = frame->data[len + 7];
+            handle->getDevicesP->devices[i].deviceNameLength = frame->data[len + 8];
+            memcpy(&handle->getDevicesP->devices[i].deviceName[0], &frame->data[len + 9], handle->getDevicesP->devices[i].deviceNameLength);
+            len += (9 + handle->getDevicesP->devices[i].deviceNameLength);
+        }
+    }
+}
 
-                    case 0x13:
-                        reason = ProteusIII_DisconnectReason_UserTerminatedConnection;
-                        break;
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
 
-                    case 0x16:
-                        reason = ProteusIII_DisconnectReason_HostTerminatedConnection;
-                        break;
+static void HandleDataCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-                    case 0x3B:
-                        reason = ProteusIII_DisconnectReason_ConnectionIntervalUnacceptable;
-                        break;
+    uint32_t criticalState = WE_EnterCritical();
+    if (handle->txConfirmCount == handle->txRequestCount)
+    {
+        WE_ExitCritical(criticalState);
+        /* Confirmation of a packet sent using ProteusIII_Transmit() */
+        HandleStatusCnf(context, frame, confirmation);
+        return;
+    }
 
-                    case 0x3D:
-                        reason = ProteusIII_DisconnectReason_MicFailure;
-                        break;
+    ProteusIII_TxWindowEntry_t* entry = GetTxWindowEntry(handle, handle->txConfirmCount);
+    handle->txConfirmCount++;
+    WE_STATS_COMPLETE_REQUEST(&handle->stats, PROTEUSIII_CMD_DATA_CNF, NULL, entry->sentUs);
+    if (frame->data[0] == CMD_Status_Success)
+    {
+        entry->state = ProteusIII_TxState_Confirmed;
+    }
+    else
+    {
+        /* Packet has been rejected, so there won't be a TXCOMPLETE_RSP for it */
+        entry->success = false;
+        entry->state = ProteusIII_TxState_Done;
+    }
+    WE_ExitCritical(criticalState);
 
-                    case 0x3E:
-                        reason = ProteusIII_DisconnectReason_ConnectionSetupFailed;
-                        break;
-                }
-                callbacks.disconnectCb(reason);
-            }
-            break;
-        }
+    ReportPipelinedTransmits(handle);
+}
 
-        case PROTEUSIII_CMD_DATA_IND:
-        {
-            if (callbacks.rxCb != NULL)
-            {
-                callbacks.rxCb(&rxPacket.Data[7], rxPacket.Length - 7, &rxPacket.Data[0], rxPacket.Data[6]);
-            }
-            break;
-        }
+static void HandleTxCompleteRsp(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        case PROTEUSIII_CMD_BEACON_IND:
-        case PROTEUSIII_CMD_BEACON_RSP:
+    /* TXCOMPLETE_RSP belongs to the oldest packet that has been accepted by the module */
+    ProteusIII_TxWindowEntry_t* entry = NULL;
+    uint32_t criticalState = WE_EnterCritical();
+    for (uint8_t n = handle->txCompleteCount; n != handle->txConfirmCount; n++)
+    {
+        if (GetTxWindowEntry(handle, n)->state == ProteusIII_TxState_Confirmed)
         {
-            if (callbacks.beaconRxCb != NULL)
-            {
-                callbacks.beaconRxCb(&rxPacket.Data[7], rxPacket.Length - 7, &rxPacket.Data[0], rxPacket.Data[6]);
-            }
+            entry = GetTxWindowEntry(handle, n);
+            entry->success = (frame->data[0] == CMD_Status_Success);
+            entry->state = ProteusIII_TxState_Done;
+            WE_STATS_COMPLETE_REQUEST(&handle->stats, PROTEUSIII_CMD_TXCOMPLETE_RSP, NULL, entry->sentUs);
             break;
         }
+    }
+    WE_ExitCritical(criticalState);
 
-        case PROTEUSIII_CMD_RSSI_IND:
+    if (entry == NULL)
+    {
+        /* Response to a packet sent using ProteusIII_Transmit() */
+        HandleStatusCnf(context, frame, confirmation);
+        return;
+    }
+
+    ReportPipelinedTransmits(handle);
+}
+
+static void HandleGetStateCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    confirmation->cmd = frame->cmd;
+    /* GETSTATE_CNF has no status field*/
+    confirmation->status = CMD_Status_NoStatus;
+
+    switch (frame->data[1])
+    {
+        case ProteusIII_BLE_Action_Idle:
         {
-            if (callbacks.rssiCb != NULL)
-            {
-                if (rxPacket.Length >= 8)
-                {
-                    callbacks.rssiCb(&rxPacket.Data[0], rxPacket.Data[6], rxPacket.Data[7]);
-                }
-            }
-            break;
+            handle->bleState = ProteusIII_DriverState_BLE_Idle;
         }
-
-        case PROTEUSIII_CMD_SECURITY_IND:
+        break;
+        case ProteusIII_BLE_Action_Connected:
+        case ProteusIII_BLE_Action_None:
+        case ProteusIII_BLE_Action_Scanning:
+        case ProteusIII_BLE_Action_Sleep:
+        case ProteusIII_BLE_Action_DTM:
+        default:
         {
-            if (callbacks.securityCb != NULL)
-            {
-                callbacks.securityCb(&rxPacket.Data[1], rxPacket.Data[0]);
-            }
-            break;
+            /* do not use this information */
         }
+        break;
+    }
+}
+
+static void HandleChannelOpenRsp(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    /* Payload of CHANNELOPEN_RSP: Status (1 byte), BTMAC (6 byte), Max Payload (1byte)*/
+    handle->bleState = ProteusIII_DriverState_BLE_ChannelOpen;
+    if (handle->callbacks.channelOpenCb != NULL)
+    {
+        handle->callbacks.channelOpenCb(&frame->data[1], (uint16_t)frame->data[7]);
+    }
+}
 
-        case PROTEUSIII_CMD_PASSKEY_IND:
+static void HandleConnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    bool success = (frame->data[0] == CMD_Status_Success);
+    if (success)
+    {
+        handle->bleState = ProteusIII_DriverState_BLE_Connected;
+    }
+    if (handle->callbacks.connectCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 7)
         {
-            if (callbacks.passkeyCb != NULL)
-            {
-                callbacks.passkeyCb(&rxPacket.Data[1]);
-            }
-            break;
+            memcpy(btMac, &frame->data[1], sizeof(btMac));
         }
-
-        case PROTEUSIII_CMD_DISPLAY_PASSKEY_IND:
+        else
         {
-            if (callbacks.displayPasskeyCb != NULL)
-            {
-                callbacks.displayPasskeyCb((ProteusIII_DisplayPasskeyAction_t)rxPacket.Data[0], &rxPacket.Data[1], &rxPacket.Data[7]);
-            }
-            break;
+            /* Packet doesn't contain BTMAC (e.g. connection failed) */
+            memset(btMac, 0, sizeof(btMac));
         }
+        handle->callbacks.connectCb(success, btMac);
+    }
+}
+
+static void HandleDisconnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        case PROTEUSIII_CMD_PHYUPDATE_IND:
+    handle->bleState = ProteusIII_DriverState_BLE_Idle;
+    AbortPipelinedTransmits(handle);
+    if (handle->callbacks.disconnectCb != NULL)
+    {
+        ProteusIII_DisconnectReason_t reason = ProteusIII_DisconnectReason_Unknown;
+        switch (frame->data[0])
         {
-            if (callbacks.phyUpdateCb != NULL)
-            {
-                uint8_t btMac[BTMAC_LENGTH];
-                if (rxPacket.Length >= 9)
-                {
-                    memcpy(btMac, &rxPacket.Data[3], sizeof(btMac));
-                }
-                else
-                {
-                    /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
-                    memset(btMac, 0, sizeof(btMac));
-                }
-                callbacks.phyUpdateCb((rxPacket.Data[0] == CMD_Status_Success), btMac, (ProteusIII_Phy_t)rxPacket.Data[1], (ProteusIII_Phy_t)rxPacket.Data[2]);
-            }
-            break;
+            case 0x08:
+                reason = ProteusIII_DisconnectReason_ConnectionTimeout;
+                break;
+
+            case 0x13:
+                reason = ProteusIII_DisconnectReason_UserTerminatedConnection;
+                break;
+
+            case 0x16:
+                reason = ProteusIII_DisconnectReason_HostTerminatedConnection;
+                break;
+
+            case 0x3B:
+                reason = ProteusIII_DisconnectReason_ConnectionIntervalUnacceptable;
+                break;
+
+            case 0x3D:
+                reason = ProteusIII_DisconnectReason_MicFailure;
+                break;
+
+            case 0x3E:
+                reason = ProteusIII_DisconnectReason_ConnectionSetupFailed;
+                break;
         }
+        handle->callbacks.disconnectCb(reason);
+    }
+}
+
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    if (handle->callbacks.rxCb != NULL)
+    {
+        handle->callbacks.rxCb(&frame->data[7], frame->length - 7, &frame->data[0], frame->data[6]);
+    }
+}
+
+static void HandleBeaconInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    if (handle->callbacks.beaconRxCb != NULL)
+    {
+        handle->callbacks.beaconRxCb(&frame->data[7], frame->length - 7, &frame->data[0], frame->data[6]);
+    }
+}
+
+static void HandleRssiInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        case PROTEUSIII_CMD_SLEEP_IND:
+    if (handle->callbacks.rssiCb != NULL)
+    {
+        if (frame->length >= 8)
         {
-            if (callbacks.sleepCb != NULL)
-            {
-                callbacks.sleepCb();
-            }
-            break;
+            handle->callbacks.rssiCb(&frame->data[0], frame->data[6], frame->data[7]);
         }
+    }
+}
 
-        case PROTEUSIII_CMD_GPIO_LOCAL_WRITE_IND:
-        case PROTEUSIII_CMD_GPIO_REMOTE_WRITE_IND:
-        {
-            if (callbacks.gpioWriteCb != NULL)
-            {
-                uint8_t pos = 0;
-                while (pos < rxPacket.Length)
-                {
-                    uint8_t blockLength = rxPacket.Data[pos] + 1;
+static void HandleSecurityInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-                    /* Note that the gpioId parameter is of type uint8_t instead of ProteusIII_GPIO_t, as the
-                 * remote device may support other GPIOs than this device. */
-                    uint8_t gpioId = rxPacket.Data[1 + pos];
-                    uint8_t value = rxPacket.Data[2 + pos];
-                    callbacks.gpioWriteCb(PROTEUSIII_CMD_GPIO_REMOTE_WRITE_IND == rxPacket.Cmd, gpioId, value);
+    if (handle->callbacks.securityCb != NULL)
+    {
+        handle->callbacks.securityCb(&frame->data[1], frame->data[0]);
+    }
+}
 
-                    pos += blockLength;
-                }
-            }
-            break;
-        }
+static void HandlePasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        case PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_IND:
-        {
-            if (callbacks.gpioRemoteConfigCb != NULL)
-            {
-                uint8_t pos = 0;
-                while (pos < rxPacket.Length)
-                {
-                    uint8_t blockLength = rxPacket.Data[pos] + 1;
-                    uint8_t gpioId = rxPacket.Data[1 + pos];
-                    uint8_t function = rxPacket.Data[2 + pos];
-                    uint8_t* value = &rxPacket.Data[3 + pos];
-
-                    ProteusIII_GPIOConfigBlock_t gpioConfig = {0};
-                    gpioConfig.gpioId = (ProteusIII_GPIO_t)gpioId;
-                    gpioConfig.function = (ProteusIII_GPIO_IO_t)function;
-                    switch (gpioConfig.function)
-                    {
-                        case ProteusIII_GPIO_IO_Disconnected:
-                            break;
+    if (handle->callbacks.passkeyCb != NULL)
+    {
+        handle->callbacks.passkeyCb(&frame->data[1]);
+    }
+}
 
-                        case ProteusIII_GPIO_IO_Input:
-                            gpioConfig.value.input = (ProteusIII_GPIO_Input_t)*value;
-                            break;
+static void HandleDisplayPasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-                        case ProteusIII_GPIO_IO_Output:
-                            gpioConfig.value.output = (ProteusIII_GPIO_Output_t)*value;
-                            break;
+    if (handle->callbacks.displayPasskeyCb != NULL)
+    {
+        handle->callbacks.displayPasskeyCb((ProteusIII_DisplayPasskeyAction_t)frame->data[0], &frame->data[1], &frame->data[7]);
+    }
+}
 
-                        case ProteusIII_GPIO_IO_PWM:
-                            gpioConfig.value.pwm.period = (((uint16_t)value[1]) << 8) | ((uint16_t)value[0]);
-                            gpioConfig.value.pwm.ratio = value[2];
-                            break;
-                    }
-                    callbacks.gpioRemoteConfigCb(&gpioConfig);
-                    pos += blockLength;
-                }
-            }
-            break;
-        }
+static void HandlePhyUpdateInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        case PROTEUSIII_CMD_ERROR_IND:
+    if (handle->callbacks.phyUpdateCb != NULL)
+    {
+        uint8_t btMac[BTMAC_LENGTH];
+        if (frame->length >= 9)
         {
-            if (callbacks.errorCb != NULL)
-            {
-                callbacks.errorCb(rxPacket.Data[0]);
-            }
-            break;
+            memcpy(btMac, &frame->data[3], sizeof(btMac));
         }
-
-        default:
+        else
         {
-            /* invalid*/
-            break;
+            /* Packet doesn't contain BTMAC (e.g. Phy update failed) */
+            memset(btMac, 0, sizeof(btMac));
         }
+        handle->callbacks.phyUpdateCb((frame->data[0] == CMD_Status_Success), btMac, (ProteusIII_Phy_t)frame->data[1], (ProteusIII_Phy_t)frame->data[2]);
     }
+}
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+static void HandleSleepInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    if (handle->callbacks.sleepCb != NULL)
     {
-        if (cmdConfirmationArray[i].cmd == CNFINVALID)
-        {
-            cmdConfirmationArray[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmationArray[i].status = cmdConfirmation.status;
-            break;
-        }
+        handle->callbacks.sleepCb();
     }
 }
 
-static void ProteusIII_HandleRxByte(uint8_t* dataP, size_t size)
+static void HandleGpioWriteInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    for (; size > 0; size--, dataP++)
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    if (handle->callbacks.gpioWriteCb != NULL)
     {
-        if (rxByteCounter < sizeof(rxBuffer))
+        uint8_t pos = 0;
+        while (pos < frame->length)
         {
-            rxBuffer[rxByteCounter] = *dataP;
+            uint8_t blockLength = frame->data[pos] + 1;
+
+            /* Note that the gpioId parameter is of type uint8_t instead of ProteusIII_GPIO_t, as the
+         * remote device may support other GPIOs than this device. */
+            uint8_t gpioId = frame->data[1 + pos];
+            uint8_t value = frame->data[2 + pos];
+            handle->callbacks.gpioWriteCb(PROTEUSIII_CMD_GPIO_REMOTE_WRITE_IND == frame->cmd, gpioId, value);
+
+            pos += blockLength;
         }
+    }
+}
+
+static void HandleGpioRemoteWriteConfigInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
 
-        switch (rxByteCounter)
+    if (handle->callbacks.gpioRemoteConfigCb != NULL)
+    {
+        uint8_t pos = 0;
+        while (pos < frame->length)
         {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
+            uint8_t blockLength = frame->data[pos] + 1;
+            uint8_t gpioId = frame->data[1 + pos];
+            uint8_t function = frame->data[2 + pos];
+            uint8_t* value = &frame->data[3 + pos];
+
+            ProteusIII_GPIOConfigBlock_t gpioConfig = {0};
+            gpioConfig.gpioId = (ProteusIII_GPIO_t)gpioId;
+            gpioConfig.function = (ProteusIII_GPIO_IO_t)function;
+            switch (gpioConfig.function)
+            {
+                case ProteusIII_GPIO_IO_Disconnected:
+                    break;
 
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
+                case ProteusIII_GPIO_IO_Input:
+                    gpioConfig.value.input = (ProteusIII_GPIO_Input_t)*value;
+                    break;
 
-            case 2:
-                /* length field lsb */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
+                case ProteusIII_GPIO_IO_Output:
+                    gpioConfig.value.output = (ProteusIII_GPIO_Output_t)*value;
+                    break;
 
-            case 3:
-                /* length field msb */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
+                case ProteusIII_GPIO_IO_PWM:
+                    gpioConfig.value.pwm.period = (((uint16_t)value[1]) << 8) | ((uint16_t)value[0]);
+                    gpioConfig.value.pwm.ratio = value[2];
+                    break;
+            }
+            handle->callbacks.gpioRemoteConfigCb(&gpioConfig);
+            pos += blockLength;
+        }
+    }
+}
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
+static void HandleErrorInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+
+    if (handle->callbacks.errorCb != NULL)
+    {
+        handle->callbacks.errorCb(frame->data[0]);
+    }
+}
+
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [PROTEUSIII_CMD_GETDEVICES_CNF]               = HandleGetDevicesCnf,
+    [PROTEUSIII_CMD_RESET_CNF]                    = HandleStatusCnf,
+    [PROTEUSIII_CMD_SCANSTART_CNF]                = HandleStatusCnf,
+    [PROTEUSIII_CMD_SCANSTOP_CNF]                 = HandleStatusCnf,
+    [PROTEUSIII_CMD_GET_CNF]                      = HandleStatusCnf,
+    [PROTEUSIII_CMD_SET_CNF]                      = HandleStatusCnf,
+    [PROTEUSIII_CMD_SETBEACON_CNF]                = HandleStatusCnf,
+    [PROTEUSIII_CMD_PASSKEY_CNF]                  = HandleStatusCnf,
+    [PROTEUSIII_CMD_PHYUPDATE_CNF]                = HandleStatusCnf,
+    [PROTEUSIII_CMD_CONNECT_CNF]                  = HandleStatusCnf,
+    [PROTEUSIII_CMD_DATA_CNF]                     = HandleDataCnf,
+    [PROTEUSIII_CMD_DISCONNECT_CNF]               = HandleStatusCnf,
+    [PROTEUSIII_CMD_FACTORYRESET_CNF]             = HandleStatusCnf,
+    [PROTEUSIII_CMD_SLEEP_CNF]                    = HandleStatusCnf,
+    [PROTEUSIII_CMD_UART_DISABLE_CNF]             = HandleStatusCnf,
+    [PROTEUSIII_CMD_UART_ENABLE_IND]              = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_CNF]   = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_CNF]    = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_LOCAL_WRITE_CNF]         = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_LOCAL_READ_CNF]          = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_CNF]  = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_CNF]   = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_REMOTE_WRITE_CNF]        = HandleStatusCnf,
+    [PROTEUSIII_CMD_GPIO_REMOTE_READ_CNF]         = HandleStatusCnf,
+    [PROTEUSIII_CMD_GET_BONDS_CNF]                = HandleStatusCnf,
+    [PROTEUSIII_CMD_DELETE_BONDS_CNF]             = HandleStatusCnf,
+    [PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_CNF] = HandleStatusCnf,
+    [PROTEUSIII_CMD_TXCOMPLETE_RSP]               = HandleTxCompleteRsp,
+    [PROTEUSIII_CMD_NUMERIC_COMP_CNF]             = HandleStatusCnf,
+    [PROTEUSIII_CMD_DTMSTART_CNF]                 = HandleStatusCnf,
+    [PROTEUSIII_CMD_DTM_CNF]                      = HandleStatusCnf,
+    [PROTEUSIII_CMD_GETSTATE_CNF]                 = HandleGetStateCnf,
+    [PROTEUSIII_CMD_CHANNELOPEN_RSP]              = HandleChannelOpenRsp,
+    [PROTEUSIII_CMD_CONNECT_IND]                  = HandleConnectInd,
+    [PROTEUSIII_CMD_DISCONNECT_IND]               = HandleDisconnectInd,
+    [PROTEUSIII_CMD_DATA_IND]                     = HandleDataInd,
+    [PROTEUSIII_CMD_BEACON_IND]                   = HandleBeaconInd,
+    [PROTEUSIII_CMD_BEACON_RSP]                   = HandleBeaconInd,
+    [PROTEUSIII_CMD_RSSI_IND]                     = HandleRssiInd,
+    [PROTEUSIII_CMD_SECURITY_IND]                 = HandleSecurityInd,
+    [PROTEUSIII_CMD_PASSKEY_IND]                  = HandlePasskeyInd,
+    [PROTEUSIII_CMD_DISPLAY_PASSKEY_IND]          = HandleDisplayPasskeyInd,
+    [PROTEUSIII_CMD_PHYUPDATE_IND]                = HandlePhyUpdateInd,
+    [PROTEUSIII_CMD_SLEEP_IND]                    = HandleSleepInd,
+    [PROTEUSIII_CMD_GPIO_LOCAL_WRITE_IND]         = HandleGpioWriteInd,
+    [PROTEUSIII_CMD_GPIO_REMOTE_WRITE_IND]        = HandleGpioWriteInd,
+    [PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_IND]  = HandleGpioRemoteWriteConfigInd,
+    [PROTEUSIII_CMD_ERROR_IND]                    = HandleErrorInd,
+};
+
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    ProteusIII_Handle_t* handle = (ProteusIII_Handle_t*)context;
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
 
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+    if ((cmdConfirmation.cmd != CNFINVALID) && CMDFrame_AsyncQueue_Complete(&handle->asyncQueue, &cmdConfirmation, frame))
+    {
+        /* Confirmation of an asynchronous request (has been passed to the request's callback) */
+        return;
+    }
+
+    if (cmdConfirmation.cmd != CNFINVALID)
+    {
+        CMDFrame_ConfirmationQueue_Add(&handle->cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
+static void ProteusIII_HandleRxByte(ProteusIII_Handle_t* handle, uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&handle->rxParser, dataP, size);
+}
+
+/*
+ * The UART driver calls the byte handler without any context, so each instance
+ * needs its own handler function.
+ */
+static void ProteusIII_HandleRxByte0(uint8_t* dataP, size_t size) { ProteusIII_HandleRxByte(&instances[0], dataP, size); }
+#if PROTEUSIII_MAX_INSTANCES > 1
+static void ProteusIII_HandleRxByte1(uint8_t* dataP, size_t size) { ProteusIII_HandleRxByte(&instances[1], dataP, size); }
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 2
+static void ProteusIII_HandleRxByte2(uint8_t* dataP, size_t size) { ProteusIII_HandleRxByte(&instances[2], dataP, size); }
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 3
+static void ProteusIII_HandleRxByte3(uint8_t* dataP, size_t size) { ProteusIII_HandleRxByte(&instances[3], dataP, size); }
+#endif
+
+/**
+ * @brief Byte handler of each instance.
+ */
+static const WE_UART_HandleRxByte_t rxByteHandlers[PROTEUSIII_MAX_INSTANCES] = {ProteusIII_HandleRxByte0,
+#if PROTEUSIII_MAX_INSTANCES > 1
+                                                                                ProteusIII_HandleRxByte1,
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 2
+                                                                                ProteusIII_HandleRxByte2,
+#endif
+#if PROTEUSIII_MAX_INSTANCES > 3
+                                                                                ProteusIII_HandleRxByte3,
+#endif
+};
+
 /**
  * @brief Function that waits for the return value of ProteusIII (*_CNF),
  * when a command (*_REQ) was sent before.
  */
-static bool Wait4CNF(uint32_t maxTimeMs, uint8_t expectedCmdConfirmation, ProteusIII_CMD_Status_t expectedStatus, bool resetConfirmState)
+static bool Wait4CNF(ProteusIII_Handle_t* handle, uint32_t maxTimeMs, uint8_t expectedCmdConfirmation, ProteusIII_CMD_Status_t expectedStatus, bool resetConfirmState)
 {
-    int count = 0;
-    int timeStepMs = 5; /* 5ms */
-    int maxCount = maxTimeMs / timeStepMs;
-
     if (resetConfirmState)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmationArray[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
-            {
-                return (cmdConfirmationArray[i].status == expectedStatus);
-            }
-        }
-
-        if (count >= maxCount)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
 
-        /* wait */
-        count++;
-        WE_Delay(timeStepMs);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&handle->cmdConfirmations, expectedCmdConfirmation, maxTimeMs, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers handle->rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(ProteusIII_Handle_t* handle, uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&handle->cmdConfirmations, expectedCmdConfirmation, &handle->rxPacket, sizeof(handle->rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static bool FillChecksum(ProteusIII_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
+    return true;
+}
+
+/**
+ * @brief Sends data to the module.
+ *
+ * isBlockingRequest is true if the data is a request whose confirmation is awaited using Wait4CNF(), so that
+ * its latency is measured by the confirmation queue. The latency of asynchronous requests and pipelined
+ * packets is measured per request by the asynchronous queue and the transmit window instead.
+ */
+static bool TransmitData(ProteusIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength, bool isBlockingRequest)
+{
+    if ((data == NULL) || (dataLength == 0))
+    {
+        return false;
+    }
+    WE_STATS_TRANSMIT(&handle->stats, dataLength, data == (const uint8_t*)&handle->txPacket);
+    CMDFRAME_STATS_START_REQUEST(&handle->cmdConfirmations, isBlockingRequest);
+    return handle->uartP->uartTransmit((uint8_t*)data, dataLength);
+}
+
+/**
+ * @brief Sends the request in handle->txPacket without waiting for its confirmation.
+ *
+ * The request is added to the queue of asynchronous requests before it is sent, as the
+ * confirmation might be received before the transmit function returns.
+ */
+static bool SendAsyncRequest(ProteusIII_Handle_t* handle, uint8_t expectedCmdConfirmation, ProteusIII_AsyncCallback_t cb)
+{
+    if (!CMDFrame_AsyncQueue_Add(&handle->asyncQueue, expectedCmdConfirmation, CMD_Status_Success, CMD_WAIT_TIME, cb))
+    {
+        return false;
+    }
+
+    FillChecksum(&handle->txPacket);
+    if (!TransmitData(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD, false))
     {
-        checksum ^= pArray[i];
+        /* Unless the request has already been completed (its callback has been called), no callback will follow */
+        return !CMDFrame_AsyncQueue_Cancel(&handle->asyncQueue);
     }
-    cmd->Data[cmd->Length] = checksum;
     return true;
 }
 
@@ -743,46 +1013,47 @@ static bool FillChecksum(ProteusIII_CMD_Frame_t* cmd)
  * @return true if transmission succeeded,
  *         false otherwise
  */
-bool ProteusIII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
-{
-    if ((data == NULL) || (dataLength == 0))
-    {
-        return false;
-    }
-    return ProteusIII_uartP->uartTransmit((uint8_t*)data, dataLength);
-}
+bool ProteusIII_Handle_Transparent_Transmit(ProteusIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength) { return TransmitData(handle, data, dataLength, data == (const uint8_t*)&handle->txPacket); }
+
+uint32_t ProteusIII_Handle_GetConfirmationOverflowCount(ProteusIII_Handle_t* handle) { return handle->cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ProteusIII_Handle_GetStatistics(ProteusIII_Handle_t* handle, WE_Stats_t* statsP) { return WE_Stats_Snapshot(&handle->stats, handle->uartP, statsP); }
+
+void ProteusIII_Handle_ResetStatistics(ProteusIII_Handle_t* handle) { WE_Stats_Reset(&handle->stats); }
+#endif
 
-bool ProteusIII_Init(WE_UART_t* uartP, ProteusIII_Pins_t* pinoutP, ProteusIII_OperationMode_t opMode, ProteusIII_CallbackConfig_t callbackConfig)
+bool ProteusIII_Handle_Init(ProteusIII_Handle_t* handle, WE_UART_t* uartP, ProteusIII_Pins_t* pinoutP, ProteusIII_OperationMode_t opMode, ProteusIII_CallbackConfig_t callbackConfig)
 {
-    operationMode = opMode;
+    handle->operationMode = opMode;
 
     if ((pinoutP == NULL) || (uartP == NULL) || (uartP->uartInit == NULL) || (uartP->uartDeinit == NULL) || (uartP->uartTransmit == NULL))
     {
         return false;
     }
 
-    ProteusIII_pinsP = pinoutP;
-    ProteusIII_pinsP->ProteusIII_Pin_Reset.type = WE_Pin_Type_Output;
-    ProteusIII_pinsP->ProteusIII_Pin_Reset.initial_value.output = WE_Pin_Level_High;
-    ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
-    ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_High;
-    ProteusIII_pinsP->ProteusIII_Pin_Boot.type = WE_Pin_Type_Output;
-    ProteusIII_pinsP->ProteusIII_Pin_Boot.initial_value.output = WE_Pin_Level_High;
-    ProteusIII_pinsP->ProteusIII_Pin_Mode.type = WE_Pin_Type_Output;
-    ProteusIII_pinsP->ProteusIII_Pin_Mode.initial_value.output = ((operationMode == ProteusIII_OperationMode_PeripheralOnlyMode) ? WE_Pin_Level_High : WE_Pin_Level_Low);
-    ProteusIII_pinsP->ProteusIII_Pin_Busy.type = WE_Pin_Type_Input;
-    ProteusIII_pinsP->ProteusIII_Pin_Busy.initial_value.input_pull = WE_Pin_PullType_No;
-    ProteusIII_pinsP->ProteusIII_Pin_StatusLed2.type = WE_Pin_Type_Input;
-    ProteusIII_pinsP->ProteusIII_Pin_StatusLed2.initial_value.input_pull = WE_Pin_PullType_No;
+    handle->pinsP = pinoutP;
+    handle->pinsP->ProteusIII_Pin_Reset.type = WE_Pin_Type_Output;
+    handle->pinsP->ProteusIII_Pin_Reset.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ProteusIII_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
+    handle->pinsP->ProteusIII_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ProteusIII_Pin_Boot.type = WE_Pin_Type_Output;
+    handle->pinsP->ProteusIII_Pin_Boot.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ProteusIII_Pin_Mode.type = WE_Pin_Type_Output;
+    handle->pinsP->ProteusIII_Pin_Mode.initial_value.output = ((handle->operationMode == ProteusIII_OperationMode_PeripheralOnlyMode) ? WE_Pin_Level_High : WE_Pin_Level_Low);
+    handle->pinsP->ProteusIII_Pin_Busy.type = WE_Pin_Type_Input;
+    handle->pinsP->ProteusIII_Pin_Busy.initial_value.input_pull = WE_Pin_PullType_No;
+    handle->pinsP->ProteusIII_Pin_StatusLed2.type = WE_Pin_Type_Input;
+    handle->pinsP->ProteusIII_Pin_StatusLed2.initial_value.input_pull = WE_Pin_PullType_No;
 
     WE_Pin_t pins[sizeof(ProteusIII_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Mode, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Busy, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_StatusLed2, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Busy, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_StatusLed2, sizeof(WE_Pin_t));
 
     if (!WE_InitPins(pins, pin_count))
     {
@@ -791,40 +1062,48 @@ bool ProteusIII_Init(WE_UART_t* uartP, ProteusIII_Pins_t* pinoutP, ProteusIII_Op
     }
 
     /* set callback functions */
-    callbacks = callbackConfig;
-    byteRxCallback = ProteusIII_HandleRxByte;
+    handle->callbacks = callbackConfig;
+    handle->byteRxCallback = rxByteHandlers[handle - instances];
 
-    ProteusIII_uartP = uartP;
-    if (false == ProteusIII_uartP->uartInit(ProteusIII_uartP->baudrate, ProteusIII_uartP->flowControl, ProteusIII_uartP->parity, &byteRxCallback))
+    CMDFrame_Parser_Init(&handle->rxParser, CMD_STX, sizeof(handle->rxPacket.Length), handle->rxBuffer, sizeof(handle->rxBuffer), HandleRxPacket, handle);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&handle->stats);
+    handle->rxParser.stats = &handle->stats;
+    handle->cmdConfirmations.stats = &handle->stats;
+    handle->asyncQueue.stats = &handle->stats;
+#endif
+
+    handle->uartP = uartP;
+    if (false == handle->uartP->uartInit(handle->uartP->baudrate, handle->uartP->flowControl, handle->uartP->parity, &handle->byteRxCallback))
     {
         return false;
     }
     WE_Delay(10);
 
     /* reset module */
-    if (!(IS_WE_PIN_UNDEFINED(ProteusIII_pinsP->ProteusIII_Pin_Reset) ? ProteusIII_Reset() : ProteusIII_PinReset()))
+    if (!(IS_WE_PIN_UNDEFINED(handle->pinsP->ProteusIII_Pin_Reset) ? ProteusIII_Handle_Reset(handle) : ProteusIII_Handle_PinReset(handle)))
     {
         WE_DEBUG_PRINT_INFO("Reset failed\r\n");
-        ProteusIII_Deinit();
+        ProteusIII_Handle_Deinit(handle);
         return false;
     }
 
-    bleState = ProteusIII_DriverState_BLE_Idle;
-    ProteusIII_getDevicesP = NULL;
+    handle->bleState = ProteusIII_DriverState_BLE_Idle;
+    handle->getDevicesP = NULL;
 
     return true;
 }
 
-bool ProteusIII_Deinit()
+bool ProteusIII_Handle_Deinit(ProteusIII_Handle_t* handle)
 {
     WE_Pin_t pins[sizeof(ProteusIII_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Mode, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_Busy, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ProteusIII_pinsP->ProteusIII_Pin_StatusLed2, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_Busy, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ProteusIII_Pin_StatusLed2, sizeof(WE_Pin_t));
 
     /* deinit pins */
     if (!WE_DeinitPins(pins, pin_count))
@@ -832,73 +1111,65 @@ bool ProteusIII_Deinit()
         return false;
     }
 
-    /* reset callbacks */
-    memset(&callbacks, 0, sizeof(callbacks));
+    /* reset handle->callbacks */
+    memset(&handle->callbacks, 0, sizeof(handle->callbacks));
 
     /* make sure any bytes remaining in receive buffer are discarded */
-    ClearReceiveBuffers();
+    ClearReceiveBuffers(handle);
 
-    return ProteusIII_uartP->uartDeinit();
+    return handle->uartP->uartDeinit();
 }
 
-bool ProteusIII_PinWakeup()
+bool ProteusIII_Handle_PinWakeup(ProteusIII_Handle_t* handle)
 {
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
         return false;
     }
     WE_Delay(5);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].status = CMD_Status_Invalid;
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_High))
+    CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, false);
 }
 
-bool ProteusIII_PinUartEnable()
+bool ProteusIII_Handle_PinUartEnable(ProteusIII_Handle_t* handle)
 {
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
         return false;
     }
     WE_Delay(15);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].status = CMD_Status_Invalid;
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_High))
+    CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
     }
 
     /* wait for UART enable indication */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_UART_ENABLE_IND, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_UART_ENABLE_IND, CMD_Status_Success, false);
 }
 
-bool ProteusIII_PinReset()
+bool ProteusIII_Handle_PinReset(ProteusIII_Handle_t* handle)
 {
     /* set to output mode */
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_Reset, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_Reset, WE_Pin_Level_Low))
     {
         return false;
     }
     WE_Delay(5);
     /* make sure any bytes remaining in receive buffer are discarded */
-    ClearReceiveBuffers();
-    if (!WE_SetPin(ProteusIII_pinsP->ProteusIII_Pin_Reset, WE_Pin_Level_High))
+    ClearReceiveBuffers(handle);
+    if (!WE_SetPin(handle->pinsP->ProteusIII_Pin_Reset, WE_Pin_Level_High))
     {
         return false;
     }
 
-    if (operationMode == ProteusIII_OperationMode_PeripheralOnlyMode)
+    if (handle->operationMode == ProteusIII_OperationMode_PeripheralOnlyMode)
     {
         WE_Delay(PROTEUSIII_BOOT_DURATION);
         /* peripheral only mode is ready (the module doesn't send a "ready for operation" message in peripheral only mode) */
@@ -906,113 +1177,173 @@ bool ProteusIII_PinReset()
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
 }
 
-bool ProteusIII_Reset()
+bool ProteusIII_Handle_Reset(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_RESET_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_RESET_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
 }
 
-bool ProteusIII_Disconnect()
+bool ProteusIII_Handle_Disconnect(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_DISCONNECT_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DISCONNECT_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* Confirmation is sent before performing the disconnect. After disconnect, the module sends a disconnect indication */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_DISCONNECT_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_DISCONNECT_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_Sleep()
+bool ProteusIII_Handle_Sleep(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_SLEEP_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SLEEP_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SLEEP_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_SLEEP_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_UartDisable()
+bool ProteusIII_Handle_UartDisable(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_UART_DISABLE_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_UART_DISABLE_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_UART_DISABLE_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_UART_DISABLE_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_Transmit(uint8_t* payloadP, uint16_t length)
+bool ProteusIII_Handle_Transmit(ProteusIII_Handle_t* handle, uint8_t* payloadP, uint16_t length)
 {
-    if ((payloadP == NULL) || (length == 0) || (length > PROTEUSIII_MAX_RADIO_PAYLOAD_LENGTH) || (ProteusIII_DriverState_BLE_ChannelOpen != ProteusIII_GetDriverState()))
+    if ((payloadP == NULL) || (length == 0) || (length > PROTEUSIII_MAX_RADIO_PAYLOAD_LENGTH) || (ProteusIII_DriverState_BLE_ChannelOpen != ProteusIII_Handle_GetDriverState(handle)))
+    {
+        return false;
+    }
+
+    /* pipelined packets need to be completed first, as their responses can't be told apart */
+    if (!WaitTxWindow(handle, 0, CMD_WAIT_TIME))
+    {
+        return false;
+    }
+
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DATA_REQ;
+    handle->txPacket.Length = length;
+
+    memcpy(&handle->txPacket.Data[0], payloadP, length);
+
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_DATA_REQ;
-    txPacket.Length = length;
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_DATA_CNF, CMD_Status_Success, true))
+    {
+        return false;
+    }
 
-    memcpy(&txPacket.Data[0], payloadP, length);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+}
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+bool ProteusIII_Handle_TransmitPipelined(ProteusIII_Handle_t* handle, uint8_t* payloadP, uint16_t length)
+{
+    if ((payloadP == NULL) || (length == 0) || (length > PROTEUSIII_MAX_RADIO_PAYLOAD_LENGTH) || (ProteusIII_DriverState_BLE_ChannelOpen != ProteusIII_Handle_GetDriverState(handle)))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_DATA_CNF, CMD_Status_Success, true))
+    /* wait for a free slot in the transmit window */
+    if (!WaitTxWindow(handle, PROTEUSIII_TX_WINDOW_SIZE - 1, CMD_WAIT_TIME))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DATA_REQ;
+    handle->txPacket.Length = length;
+
+    memcpy(&handle->txPacket.Data[0], payloadP, length);
+
+    FillChecksum(&handle->txPacket);
+
+    /* the packet is added to the window before it is sent, so that its responses are assigned
+     * correctly even if they are received before ProteusIII_Handle_Transparent_Transmit() returns */
+    ProteusIII_TxWindowEntry_t* entry = GetTxWindowEntry(handle, handle->txRequestCount);
+    entry->sentTick = WE_GetTick();
+    WE_STATS_START_REQUEST(entry->sentUs);
+    entry->state = ProteusIII_TxState_Sent;
+    uint32_t criticalState = WE_EnterCritical();
+    handle->txRequestCount++;
+    WE_ExitCritical(criticalState);
+
+    if (!TransmitData(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD, false))
+    {
+        bool reported;
+        criticalState = WE_EnterCritical();
+        reported = (handle->txCompleteCount == handle->txRequestCount);
+        if (!reported)
+        {
+            handle->txRequestCount--;
+            if (handle->txConfirmCount == (uint8_t)(handle->txRequestCount + 1))
+            {
+                handle->txConfirmCount = handle->txRequestCount;
+            }
+        }
+        WE_ExitCritical(criticalState);
+
+        /* Unless the packet has already been reported as failed (using txCompleteCb), no callback will follow */
+        return reported;
+    }
+
+    return true;
 }
 
-bool ProteusIII_SetBeacon(uint8_t* beaconDataP, uint16_t length)
+bool ProteusIII_Handle_WaitTransmitComplete(ProteusIII_Handle_t* handle, uint32_t maxTimeMs) { return WaitTxWindow(handle, 0, maxTimeMs); }
+
+bool ProteusIII_Handle_SetBeacon(ProteusIII_Handle_t* handle, uint8_t* beaconDataP, uint16_t length)
 {
-    if ((beaconDataP == NULL) || (length == 0) || (length > PROTEUSIII_MAX_BEACON_LENGTH) || (ProteusIII_DriverState_BLE_Idle != ProteusIII_GetDriverState()))
+    if ((beaconDataP == NULL) || (length == 0) || (length > PROTEUSIII_MAX_BEACON_LENGTH) || (ProteusIII_DriverState_BLE_Idle != ProteusIII_Handle_GetDriverState(handle)))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_SETBEACON_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SETBEACON_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], beaconDataP, length);
+    memcpy(&handle->txPacket.Data[0], beaconDataP, length);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SETBEACON_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_SETBEACON_CNF, CMD_Status_Success, true);
 }
 
 /*
@@ -1021,22 +1352,22 @@ bool ProteusIII_SetBeacon(uint8_t* beaconDataP, uint16_t length)
  * @return true if succeeded,
  *         false otherwise
  */
-bool ProteusIII_FactoryReset()
+bool ProteusIII_Handle_FactoryReset(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_FACTORYRESET_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_FACTORYRESET_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for reset after factory reset */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true);
 }
 
-bool ProteusIII_CheckNSet(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+bool ProteusIII_Handle_CheckNSet(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if ((valueP == NULL) || (length == 0))
     {
@@ -1046,7 +1377,7 @@ bool ProteusIII_CheckNSet(ProteusIII_UserSettings_t userSetting, uint8_t* valueP
     uint8_t current_value[length];
     uint16_t current_length = length;
 
-    if (true == ProteusIII_Get(userSetting, current_value, &current_length))
+    if (true == ProteusIII_Handle_Get(handle, userSetting, current_value, &current_length))
     {
         if ((length == current_length) && (0 == memcmp(valueP, current_value, length)))
         {
@@ -1056,7 +1387,7 @@ bool ProteusIII_CheckNSet(ProteusIII_UserSettings_t userSetting, uint8_t* valueP
         else
         {
             /* value differs, and thus must be set */
-            return ProteusIII_Set(userSetting, valueP, length);
+            return ProteusIII_Handle_Set(handle, userSetting, valueP, length);
         }
     }
     else
@@ -1066,83 +1397,106 @@ bool ProteusIII_CheckNSet(ProteusIII_UserSettings_t userSetting, uint8_t* valueP
     }
 }
 
-bool ProteusIII_Set(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+/**
+ * @brief Prepares a CMD_SET_REQ in handle->txPacket.
+ */
+static bool PrepareSetRequest(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if ((valueP == NULL) || (length == 0))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_SET_REQ;
-    txPacket.Length = 1 + length;
-    txPacket.Data[0] = userSetting;
-    memcpy(&txPacket.Data[1], valueP, length);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SET_REQ;
+    handle->txPacket.Length = 1 + length;
+    handle->txPacket.Data[0] = userSetting;
+    memcpy(&handle->txPacket.Data[1], valueP, length);
+    return true;
+}
+
+bool ProteusIII_Handle_Set(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+{
+    if (!PrepareSetRequest(handle, userSetting, valueP, length))
+    {
+        return false;
+    }
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SET_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_SET_CNF, CMD_Status_Success, true))
+    {
+        return false;
+    }
+
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, false);
+}
+
+bool ProteusIII_Handle_SetAsync(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ProteusIII_AsyncCallback_t cb)
+{
+    if (!PrepareSetRequest(handle, userSetting, valueP, length))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, false);
+    /* The module's CMD_GETSTATE_CNF following the CMD_SET_CNF is not waited for */
+    return SendAsyncRequest(handle, PROTEUSIII_CMD_SET_CNF, cb);
 }
 
-bool ProteusIII_SetDeviceName(uint8_t* deviceNameP, uint8_t nameLength) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_DEVICE_NAME, deviceNameP, nameLength); }
+bool ProteusIII_Handle_SetDeviceName(ProteusIII_Handle_t* handle, uint8_t* deviceNameP, uint8_t nameLength) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_DEVICE_NAME, deviceNameP, nameLength); }
 
-bool ProteusIII_SetAdvertisingTimeout(uint16_t advTimeout)
+bool ProteusIII_Handle_SetAdvertisingTimeout(ProteusIII_Handle_t* handle, uint16_t advTimeout)
 {
     uint8_t help[2];
     memcpy(help, (uint8_t*)&advTimeout, 2);
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_ADVERTISING_TIMEOUT, help, 2);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_ADVERTISING_TIMEOUT, help, 2);
 }
 
-bool ProteusIII_SetAdvertisingFlags(ProteusIII_AdvertisingFlags_t advFlags)
+bool ProteusIII_Handle_SetAdvertisingFlags(ProteusIII_Handle_t* handle, ProteusIII_AdvertisingFlags_t advFlags)
 {
     uint8_t flags = (uint8_t)advFlags;
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_ADVERTISING_FLAGS, &flags, 1);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_ADVERTISING_FLAGS, &flags, 1);
 }
 
-bool ProteusIII_SetScanFlags(uint8_t scanFlags) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SCAN_FLAGS, &scanFlags, 1); }
+bool ProteusIII_Handle_SetScanFlags(ProteusIII_Handle_t* handle, uint8_t scanFlags) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SCAN_FLAGS, &scanFlags, 1); }
 
-bool ProteusIII_SetBeaconFlags(ProteusIII_BeaconFlags_t beaconFlags)
+bool ProteusIII_Handle_SetBeaconFlags(ProteusIII_Handle_t* handle, ProteusIII_BeaconFlags_t beaconFlags)
 {
     uint8_t flags = (uint8_t)beaconFlags;
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_BEACON_FLAGS, &flags, 1);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_BEACON_FLAGS, &flags, 1);
 }
 
-bool ProteusIII_SetCFGFlags(uint16_t cfgFlags)
+bool ProteusIII_Handle_SetCFGFlags(ProteusIII_Handle_t* handle, uint16_t cfgFlags)
 {
     uint8_t help[2];
     memcpy(help, (uint8_t*)&cfgFlags, 2);
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_CFGFLAGS, help, 2);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_CFGFLAGS, help, 2);
 }
 
-bool ProteusIII_SetConnectionTiming(ProteusIII_ConnectionTiming_t connectionTiming) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_CONNECTION_TIMING, (uint8_t*)&connectionTiming, 1); }
+bool ProteusIII_Handle_SetConnectionTiming(ProteusIII_Handle_t* handle, ProteusIII_ConnectionTiming_t connectionTiming) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_CONNECTION_TIMING, (uint8_t*)&connectionTiming, 1); }
 
-bool ProteusIII_SetScanTiming(ProteusIII_ScanTiming_t scanTiming) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SCAN_TIMING, (uint8_t*)&scanTiming, 1); }
+bool ProteusIII_Handle_SetScanTiming(ProteusIII_Handle_t* handle, ProteusIII_ScanTiming_t scanTiming) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SCAN_TIMING, (uint8_t*)&scanTiming, 1); }
 
-bool ProteusIII_SetScanFactor(uint8_t scanFactor)
+bool ProteusIII_Handle_SetScanFactor(ProteusIII_Handle_t* handle, uint8_t scanFactor)
 {
     if ((scanFactor > 10) || (scanFactor < 1))
     {
         return false;
     }
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_SCAN_FACTOR, &scanFactor, 1);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SCAN_FACTOR, &scanFactor, 1);
 }
 
-bool ProteusIII_SetTXPower(ProteusIII_TXPower_t txPower) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_TX_POWER, (uint8_t*)&txPower, 1); }
+bool ProteusIII_Handle_SetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t txPower) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_TX_POWER, (uint8_t*)&txPower, 1); }
 
-bool ProteusIII_SetSecFlags(ProteusIII_SecFlags_t secFlags) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SEC_FLAGS, (uint8_t*)&secFlags, 1); }
+bool ProteusIII_Handle_SetSecFlags(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t secFlags) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SEC_FLAGS, (uint8_t*)&secFlags, 1); }
 
-bool ProteusIII_SetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t secFlags) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SECFLAGSPERONLY, (uint8_t*)&secFlags, 1); }
+bool ProteusIII_Handle_SetSecFlagsPeripheralOnly(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t secFlags) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SECFLAGSPERONLY, (uint8_t*)&secFlags, 1); }
 
-bool ProteusIII_SetBaudrateIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable)
+bool ProteusIII_Handle_SetBaudrateIndex(ProteusIII_Handle_t* handle, ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable)
 {
     uint8_t baudrateIndex = (uint8_t)baudrate;
 
@@ -1158,50 +1512,59 @@ bool ProteusIII_SetBaudrateIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_Uart
         baudrateIndex += 64;
     }
 
-    return ProteusIII_Set(ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*)&baudrateIndex, 1);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*)&baudrateIndex, 1);
 }
 
-bool ProteusIII_SetBTMAC(uint8_t* btMacP) { return ProteusIII_Set(ProteusIII_USERSETTING_FS_BTMAC, btMacP, 6); }
+bool ProteusIII_Handle_SetBTMAC(ProteusIII_Handle_t* handle, uint8_t* btMacP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_FS_BTMAC, btMacP, 6); }
 
-bool ProteusIII_SetStaticPasskey(uint8_t* staticPasskeyP) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_STATIC_PASSKEY, staticPasskeyP, 6); }
+bool ProteusIII_Handle_SetStaticPasskey(ProteusIII_Handle_t* handle, uint8_t* staticPasskeyP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_STATIC_PASSKEY, staticPasskeyP, 6); }
 
-bool ProteusIII_SetAppearance(uint16_t appearance)
+bool ProteusIII_Handle_SetAppearance(ProteusIII_Handle_t* handle, uint16_t appearance)
 {
     uint8_t help[2];
     memcpy(help, (uint8_t*)&appearance, 2);
-    return ProteusIII_Set(ProteusIII_USERSETTING_RF_APPEARANCE, help, 2);
+    return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_APPEARANCE, help, 2);
 }
 
-bool ProteusIII_SetSppBaseUuid(uint8_t* uuidP) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SPPBASEUUID, uuidP, 16); }
+bool ProteusIII_Handle_SetSppBaseUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SPPBASEUUID, uuidP, 16); }
 
-bool ProteusIII_SetSppServiceUuid(uint8_t* uuidP) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SPPServiceUUID, uuidP, 2); }
+bool ProteusIII_Handle_SetSppServiceUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SPPServiceUUID, uuidP, 2); }
 
-bool ProteusIII_SetSppRxUuid(uint8_t* uuidP) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SPPRXUUID, uuidP, 2); }
+bool ProteusIII_Handle_SetSppRxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SPPRXUUID, uuidP, 2); }
 
-bool ProteusIII_SetSppTxUuid(uint8_t* uuidP) { return ProteusIII_Set(ProteusIII_USERSETTING_RF_SPPTXUUID, uuidP, 2); }
+bool ProteusIII_Handle_SetSppTxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP) { return ProteusIII_Handle_Set(handle, ProteusIII_USERSETTING_RF_SPPTXUUID, uuidP, 2); }
+
+/**
+ * @brief Prepares a CMD_GET_REQ in handle->txPacket.
+ */
+static void PrepareGetRequest(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting)
+{
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GET_REQ;
+    handle->txPacket.Length = 1;
+    handle->txPacket.Data[0] = userSetting;
+}
 
-bool ProteusIII_Get(ProteusIII_UserSettings_t userSetting, uint8_t* responseP, uint16_t* responseLengthP)
+bool ProteusIII_Handle_Get(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* responseP, uint16_t* responseLengthP)
 {
     if ((responseP == NULL) || (responseLengthP == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GET_REQ;
-    txPacket.Length = 1;
-    txPacket.Data[0] = userSetting;
+    PrepareGetRequest(handle, userSetting);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GET_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GET_CNF, CMD_Status_Success, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GET_CNF, CMD_Status_Success, true))
     {
-        uint16_t length = rxPacket.Length;
-        memcpy(responseP, &rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response */
+        uint16_t length = handle->rxPacket.Length;
+        memcpy(responseP, &handle->rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response */
         *responseLengthP = length - 1;
         return true;
     }
@@ -1209,13 +1572,19 @@ bool ProteusIII_Get(ProteusIII_UserSettings_t userSetting, uint8_t* responseP, u
     return false;
 }
 
-bool ProteusIII_GetFWVersion(uint8_t* versionP)
+bool ProteusIII_Handle_GetAsync(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, ProteusIII_AsyncCallback_t cb)
+{
+    PrepareGetRequest(handle, userSetting);
+    return SendAsyncRequest(handle, PROTEUSIII_CMD_GET_CNF, cb);
+}
+
+bool ProteusIII_Handle_GetFWVersion(ProteusIII_Handle_t* handle, uint8_t* versionP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_FS_FWVersion, versionP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_FS_FWVersion, versionP, &length);
 }
 
-bool ProteusIII_GetDeviceInfo(ProteusIII_DeviceInfo_t* deviceInfoP)
+bool ProteusIII_Handle_GetDeviceInfo(ProteusIII_Handle_t* handle, ProteusIII_DeviceInfo_t* deviceInfoP)
 {
     if (deviceInfoP == NULL)
     {
@@ -1224,7 +1593,7 @@ bool ProteusIII_GetDeviceInfo(ProteusIII_DeviceInfo_t* deviceInfoP)
 
     uint8_t help[12];
     uint16_t length;
-    if (!ProteusIII_Get(ProteusIII_USERSETTING_FS_DEVICE_INFO, help, &length))
+    if (!ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_FS_DEVICE_INFO, help, &length))
     {
         return false;
     }
@@ -1235,31 +1604,31 @@ bool ProteusIII_GetDeviceInfo(ProteusIII_DeviceInfo_t* deviceInfoP)
     return true;
 }
 
-bool ProteusIII_GetSerialNumber(uint8_t* serialNumberP)
+bool ProteusIII_Handle_GetSerialNumber(ProteusIII_Handle_t* handle, uint8_t* serialNumberP)
 {
     uint16_t length;
-    if (!ProteusIII_Get(ProteusIII_USERSETTING_FS_SERIAL_NUMBER, serialNumberP, &length))
+    if (!ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_FS_SERIAL_NUMBER, serialNumberP, &length))
     {
         return false;
     }
     return true;
 }
 
-bool ProteusIII_GetDeviceName(uint8_t* deviceNameP, uint16_t* nameLengthP) { return ProteusIII_Get(ProteusIII_USERSETTING_RF_DEVICE_NAME, deviceNameP, nameLengthP); }
+bool ProteusIII_Handle_GetDeviceName(ProteusIII_Handle_t* handle, uint8_t* deviceNameP, uint16_t* nameLengthP) { return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_DEVICE_NAME, deviceNameP, nameLengthP); }
 
-bool ProteusIII_GetMAC(uint8_t* macP)
+bool ProteusIII_Handle_GetMAC(ProteusIII_Handle_t* handle, uint8_t* macP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_FS_MAC, macP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_FS_MAC, macP, &length);
 }
 
-bool ProteusIII_GetBTMAC(uint8_t* btMacP)
+bool ProteusIII_Handle_GetBTMAC(ProteusIII_Handle_t* handle, uint8_t* btMacP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_FS_BTMAC, btMacP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_FS_BTMAC, btMacP, &length);
 }
 
-bool ProteusIII_GetAdvertisingTimeout(uint16_t* advTimeoutP)
+bool ProteusIII_Handle_GetAdvertisingTimeout(ProteusIII_Handle_t* handle, uint16_t* advTimeoutP)
 {
     if (advTimeoutP == NULL)
     {
@@ -1269,7 +1638,7 @@ bool ProteusIII_GetAdvertisingTimeout(uint16_t* advTimeoutP)
     uint16_t length;
     uint8_t help[2];
 
-    if (ProteusIII_Get(ProteusIII_USERSETTING_RF_ADVERTISING_TIMEOUT, help, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_ADVERTISING_TIMEOUT, help, &length))
     {
         memcpy((uint8_t*)advTimeoutP, help, 2);
         return true;
@@ -1278,7 +1647,7 @@ bool ProteusIII_GetAdvertisingTimeout(uint16_t* advTimeoutP)
     return false;
 }
 
-bool ProteusIII_GetAdvertisingFlags(ProteusIII_AdvertisingFlags_t* advFlagsP)
+bool ProteusIII_Handle_GetAdvertisingFlags(ProteusIII_Handle_t* handle, ProteusIII_AdvertisingFlags_t* advFlagsP)
 {
     if (advFlagsP == NULL)
     {
@@ -1287,7 +1656,7 @@ bool ProteusIII_GetAdvertisingFlags(ProteusIII_AdvertisingFlags_t* advFlagsP)
 
     uint16_t length;
     uint8_t flags;
-    if (ProteusIII_Get(ProteusIII_USERSETTING_RF_ADVERTISING_FLAGS, &flags, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_ADVERTISING_FLAGS, &flags, &length))
     {
         *advFlagsP = flags;
         return true;
@@ -1295,13 +1664,13 @@ bool ProteusIII_GetAdvertisingFlags(ProteusIII_AdvertisingFlags_t* advFlagsP)
     return false;
 }
 
-bool ProteusIII_GetScanFlags(uint8_t* scanFlagsP)
+bool ProteusIII_Handle_GetScanFlags(ProteusIII_Handle_t* handle, uint8_t* scanFlagsP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SCAN_FLAGS, scanFlagsP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SCAN_FLAGS, scanFlagsP, &length);
 }
 
-bool ProteusIII_GetBeaconFlags(ProteusIII_BeaconFlags_t* beaconFlagsP)
+bool ProteusIII_Handle_GetBeaconFlags(ProteusIII_Handle_t* handle, ProteusIII_BeaconFlags_t* beaconFlagsP)
 {
     if (beaconFlagsP == NULL)
     {
@@ -1310,7 +1679,7 @@ bool ProteusIII_GetBeaconFlags(ProteusIII_BeaconFlags_t* beaconFlagsP)
 
     uint16_t length;
     uint8_t flags;
-    if (ProteusIII_Get(ProteusIII_USERSETTING_RF_BEACON_FLAGS, &flags, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_BEACON_FLAGS, &flags, &length))
     {
         *beaconFlagsP = flags;
         return true;
@@ -1318,43 +1687,43 @@ bool ProteusIII_GetBeaconFlags(ProteusIII_BeaconFlags_t* beaconFlagsP)
     return false;
 }
 
-bool ProteusIII_GetConnectionTiming(ProteusIII_ConnectionTiming_t* connectionTimingP)
+bool ProteusIII_Handle_GetConnectionTiming(ProteusIII_Handle_t* handle, ProteusIII_ConnectionTiming_t* connectionTimingP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_CONNECTION_TIMING, (uint8_t*)connectionTimingP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_CONNECTION_TIMING, (uint8_t*)connectionTimingP, &length);
 }
 
-bool ProteusIII_GetScanTiming(ProteusIII_ScanTiming_t* scanTimingP)
+bool ProteusIII_Handle_GetScanTiming(ProteusIII_Handle_t* handle, ProteusIII_ScanTiming_t* scanTimingP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SCAN_TIMING, (uint8_t*)scanTimingP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SCAN_TIMING, (uint8_t*)scanTimingP, &length);
 }
 
-bool ProteusIII_GetScanFactor(uint8_t* scanFactorP)
+bool ProteusIII_Handle_GetScanFactor(ProteusIII_Handle_t* handle, uint8_t* scanFactorP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SCAN_FACTOR, scanFactorP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SCAN_FACTOR, scanFactorP, &length);
 }
 
-bool ProteusIII_GetTXPower(ProteusIII_TXPower_t* txPowerP)
+bool ProteusIII_Handle_GetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t* txPowerP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_TX_POWER, (uint8_t*)txPowerP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_TX_POWER, (uint8_t*)txPowerP, &length);
 }
 
-bool ProteusIII_GetSecFlags(ProteusIII_SecFlags_t* secFlagsP)
+bool ProteusIII_Handle_GetSecFlags(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t* secFlagsP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SEC_FLAGS, (uint8_t*)secFlagsP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SEC_FLAGS, (uint8_t*)secFlagsP, &length);
 }
 
-bool ProteusIII_GetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t* secFlagsP)
+bool ProteusIII_Handle_GetSecFlagsPeripheralOnly(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t* secFlagsP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SECFLAGSPERONLY, (uint8_t*)secFlagsP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SECFLAGSPERONLY, (uint8_t*)secFlagsP, &length);
 }
 
-bool ProteusIII_GetBaudrateIndex(ProteusIII_BaudRate_t* baudrateP, ProteusIII_UartParity_t* parityP, bool* flowControlEnableP)
+bool ProteusIII_Handle_GetBaudrateIndex(ProteusIII_Handle_t* handle, ProteusIII_BaudRate_t* baudrateP, ProteusIII_UartParity_t* parityP, bool* flowControlEnableP)
 {
     if ((baudrateP == NULL) || (parityP == NULL) || (flowControlEnableP == NULL))
     {
@@ -1364,7 +1733,7 @@ bool ProteusIII_GetBaudrateIndex(ProteusIII_BaudRate_t* baudrateP, ProteusIII_Ua
     uint16_t length;
     uint8_t uartIndex;
 
-    if (ProteusIII_Get(ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*)&uartIndex, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_UART_CONFIG_INDEX, (uint8_t*)&uartIndex, &length))
     {
         /* if index is even, flow control is off.
          * If flow control is on, decrease index by one to later determine the base baudrate */
@@ -1398,13 +1767,13 @@ bool ProteusIII_GetBaudrateIndex(ProteusIII_BaudRate_t* baudrateP, ProteusIII_Ua
     return false;
 }
 
-bool ProteusIII_GetStaticPasskey(uint8_t* staticPasskeyP)
+bool ProteusIII_Handle_GetStaticPasskey(ProteusIII_Handle_t* handle, uint8_t* staticPasskeyP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_STATIC_PASSKEY, staticPasskeyP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_STATIC_PASSKEY, staticPasskeyP, &length);
 }
 
-bool ProteusIII_GetAppearance(uint16_t* appearanceP)
+bool ProteusIII_Handle_GetAppearance(ProteusIII_Handle_t* handle, uint16_t* appearanceP)
 {
     if (appearanceP == NULL)
     {
@@ -1414,7 +1783,7 @@ bool ProteusIII_GetAppearance(uint16_t* appearanceP)
     uint16_t length;
     uint8_t help[2];
 
-    if (ProteusIII_Get(ProteusIII_USERSETTING_RF_APPEARANCE, help, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_APPEARANCE, help, &length))
     {
         memcpy((uint8_t*)appearanceP, help, 2);
         return true;
@@ -1423,31 +1792,31 @@ bool ProteusIII_GetAppearance(uint16_t* appearanceP)
     return false;
 }
 
-bool ProteusIII_GetSppBaseUuid(uint8_t* uuidP)
+bool ProteusIII_Handle_GetSppBaseUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SPPBASEUUID, uuidP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SPPBASEUUID, uuidP, &length);
 }
 
-bool ProteusIII_GetSppServiceUuid(uint8_t* uuidP)
+bool ProteusIII_Handle_GetSppServiceUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SPPServiceUUID, uuidP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SPPServiceUUID, uuidP, &length);
 }
 
-bool ProteusIII_GetSppRxUuid(uint8_t* uuidP)
+bool ProteusIII_Handle_GetSppRxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SPPRXUUID, uuidP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SPPRXUUID, uuidP, &length);
 }
 
-bool ProteusIII_GetSppTxUuid(uint8_t* uuidP)
+bool ProteusIII_Handle_GetSppTxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP)
 {
     uint16_t length;
-    return ProteusIII_Get(ProteusIII_USERSETTING_RF_SPPTXUUID, uuidP, &length);
+    return ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_SPPTXUUID, uuidP, &length);
 }
 
-bool ProteusIII_GetCFGFlags(uint16_t* cfgFlagsP)
+bool ProteusIII_Handle_GetCFGFlags(ProteusIII_Handle_t* handle, uint16_t* cfgFlagsP)
 {
     if (cfgFlagsP == NULL)
     {
@@ -1457,7 +1826,7 @@ bool ProteusIII_GetCFGFlags(uint16_t* cfgFlagsP)
     uint16_t length;
     uint8_t help[2];
 
-    if (ProteusIII_Get(ProteusIII_USERSETTING_RF_CFGFLAGS, help, &length))
+    if (ProteusIII_Handle_Get(handle, ProteusIII_USERSETTING_RF_CFGFLAGS, help, &length))
     {
         memcpy((uint8_t*)cfgFlagsP, help, 2);
         return true;
@@ -1466,32 +1835,33 @@ bool ProteusIII_GetCFGFlags(uint16_t* cfgFlagsP)
     return false;
 }
 
-bool ProteusIII_GetState(ProteusIII_ModuleState_t* moduleStateP)
+bool ProteusIII_Handle_GetState(ProteusIII_Handle_t* handle, ProteusIII_ModuleState_t* moduleStateP)
 {
     if (moduleStateP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GETSTATE_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GETSTATE_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GETSTATE_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true))
     {
-        uint16_t length = rxPacket.Length;
-        moduleStateP->role = rxPacket.Data[0];
-        moduleStateP->action = rxPacket.Data[1];
+        uint16_t length = handle->rxPacket.Length;
+        moduleStateP->role = handle->rxPacket.Data[0];
+        moduleStateP->action = handle->rxPacket.Data[1];
 
         if (moduleStateP->action == ProteusIII_BLE_Action_Connected && length >= 8)
         {
-            memcpy(moduleStateP->connectedDeviceBtMac, &rxPacket.Data[2], 6);
+            memcpy(moduleStateP->connectedDeviceBtMac, &handle->rxPacket.Data[2], 6);
         }
         else
         {
@@ -1504,143 +1874,157 @@ bool ProteusIII_GetState(ProteusIII_ModuleState_t* moduleStateP)
     return false;
 }
 
-ProteusIII_DriverState_t ProteusIII_GetDriverState() { return bleState; }
+ProteusIII_DriverState_t ProteusIII_Handle_GetDriverState(ProteusIII_Handle_t* handle) { return handle->bleState; }
 
-bool ProteusIII_ScanStart()
+bool ProteusIII_Handle_ScanStart(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_SCANSTART_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SCANSTART_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SCANSTART_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_SCANSTART_CNF, CMD_Status_Success, true);
+}
+
+bool ProteusIII_Handle_ScanStartAsync(ProteusIII_Handle_t* handle, ProteusIII_AsyncCallback_t cb)
+{
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SCANSTART_REQ;
+    handle->txPacket.Length = 0;
+    return SendAsyncRequest(handle, PROTEUSIII_CMD_SCANSTART_CNF, cb);
 }
 
-bool ProteusIII_ScanStop()
+bool ProteusIII_Handle_ScanStop(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_SCANSTOP_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SCANSTOP_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_SCANSTOP_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_SCANSTOP_CNF, CMD_Status_Success, true);
+}
+
+bool ProteusIII_Handle_ScanStopAsync(ProteusIII_Handle_t* handle, ProteusIII_AsyncCallback_t cb)
+{
+    handle->txPacket.Cmd = PROTEUSIII_CMD_SCANSTOP_REQ;
+    handle->txPacket.Length = 0;
+    return SendAsyncRequest(handle, PROTEUSIII_CMD_SCANSTOP_CNF, cb);
 }
 
-bool ProteusIII_GetDevices(ProteusIII_GetDevices_t* devicesP)
+bool ProteusIII_Handle_GetDevices(ProteusIII_Handle_t* handle, ProteusIII_GetDevices_t* devicesP)
 {
-    ProteusIII_getDevicesP = devicesP;
-    if (ProteusIII_getDevicesP != NULL)
+    handle->getDevicesP = devicesP;
+    if (handle->getDevicesP != NULL)
     {
-        ProteusIII_getDevicesP->numberOfDevices = 0;
+        handle->getDevicesP->numberOfDevices = 0;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GETDEVICES_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GETDEVICES_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
-        ProteusIII_getDevicesP = NULL;
+        handle->getDevicesP = NULL;
         return false;
     }
 
     /* wait for cnf */
-    bool ret = Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETDEVICES_CNF, CMD_Status_Success, true);
-    ProteusIII_getDevicesP = NULL;
+    bool ret = Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETDEVICES_CNF, CMD_Status_Success, true);
+    handle->getDevicesP = NULL;
     return ret;
 }
 
-bool ProteusIII_Connect(uint8_t* btMacP)
+bool ProteusIII_Handle_Connect(ProteusIII_Handle_t* handle, uint8_t* btMacP)
 {
     if (btMacP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_CONNECT_REQ;
-    txPacket.Length = 6;
-    memcpy(&txPacket.Data[0], btMacP, 6);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_CONNECT_REQ;
+    handle->txPacket.Length = 6;
+    memcpy(&handle->txPacket.Data[0], btMacP, 6);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(3000, PROTEUSIII_CMD_CONNECT_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, 3000, PROTEUSIII_CMD_CONNECT_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_Passkey(uint8_t* passkeyP)
+bool ProteusIII_Handle_Passkey(ProteusIII_Handle_t* handle, uint8_t* passkeyP)
 {
     if (passkeyP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_PASSKEY_REQ;
-    txPacket.Length = 6;
-    memcpy(&txPacket.Data[0], passkeyP, 6);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_PASSKEY_REQ;
+    handle->txPacket.Length = 6;
+    memcpy(&handle->txPacket.Data[0], passkeyP, 6);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_PASSKEY_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_PASSKEY_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_NumericCompareConfirm(bool keyIsOk)
+bool ProteusIII_Handle_NumericCompareConfirm(ProteusIII_Handle_t* handle, bool keyIsOk)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_NUMERIC_COMP_REQ;
-    txPacket.Length = 1;
-    txPacket.Data[0] = keyIsOk ? 0x00 : 0x01;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_NUMERIC_COMP_REQ;
+    handle->txPacket.Length = 1;
+    handle->txPacket.Data[0] = keyIsOk ? 0x00 : 0x01;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_NUMERIC_COMP_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_NUMERIC_COMP_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_PhyUpdate(ProteusIII_Phy_t phy)
+bool ProteusIII_Handle_PhyUpdate(ProteusIII_Handle_t* handle, ProteusIII_Phy_t phy)
 {
-    if (ProteusIII_DriverState_BLE_ChannelOpen == ProteusIII_GetDriverState())
+    if (ProteusIII_DriverState_BLE_ChannelOpen == ProteusIII_Handle_GetDriverState(handle))
     {
-        txPacket.Cmd = PROTEUSIII_CMD_PHYUPDATE_REQ;
-        txPacket.Length = 1;
-        txPacket.Data[0] = (uint8_t)phy;
+        handle->txPacket.Cmd = PROTEUSIII_CMD_PHYUPDATE_REQ;
+        handle->txPacket.Length = 1;
+        handle->txPacket.Data[0] = (uint8_t)phy;
 
-        FillChecksum(&txPacket);
-        if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+        FillChecksum(&handle->txPacket);
+        if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
         {
             return false;
         }
 
         /* wait for cnf */
-        return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_PHYUPDATE_CNF, CMD_Status_Success, true);
+        return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_PHYUPDATE_CNF, CMD_Status_Success, true);
     }
     return false;
 }
 
-bool ProteusIII_GetStatusLed2PinLevel(WE_Pin_Level_t* statusLed2LevelP) { return WE_GetPinLevel(ProteusIII_pinsP->ProteusIII_Pin_StatusLed2, statusLed2LevelP); }
+bool ProteusIII_Handle_GetStatusLed2PinLevel(ProteusIII_Handle_t* handle, WE_Pin_Level_t* statusLed2LevelP) { return WE_GetPinLevel(handle->pinsP->ProteusIII_Pin_StatusLed2, statusLed2LevelP); }
 
-bool ProteusIII_IsPeripheralOnlyModeBusy(bool* busyStateP)
+bool ProteusIII_Handle_IsPeripheralOnlyModeBusy(ProteusIII_Handle_t* handle, bool* busyStateP)
 {
     if (busyStateP == NULL)
     {
@@ -1649,7 +2033,7 @@ bool ProteusIII_IsPeripheralOnlyModeBusy(bool* busyStateP)
 
     WE_Pin_Level_t pin_level;
 
-    if (!WE_GetPinLevel(ProteusIII_pinsP->ProteusIII_Pin_Busy, &pin_level))
+    if (!WE_GetPinLevel(handle->pinsP->ProteusIII_Pin_Busy, &pin_level))
     {
         return false;
     }
@@ -1659,9 +2043,9 @@ bool ProteusIII_IsPeripheralOnlyModeBusy(bool* busyStateP)
     return true;
 }
 
-void ProteusIII_SetByteRxCallback(WE_UART_HandleRxByte_t callback) { byteRxCallback = (callback == NULL) ? ProteusIII_HandleRxByte : callback; }
+void ProteusIII_Handle_SetByteRxCallback(ProteusIII_Handle_t* handle, WE_UART_HandleRxByte_t callback) { handle->byteRxCallback = (callback == NULL) ? rxByteHandlers[handle - instances] : callback; }
 
-bool ProteusIII_GPIOLocalWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs)
+bool ProteusIII_Handle_GPIOLocalWriteConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs)
 {
     if (configP == NULL)
     {
@@ -1676,38 +2060,38 @@ bool ProteusIII_GPIOLocalWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint
         {
             case ProteusIII_GPIO_IO_Disconnected:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = 0x00;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = 0x00;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_Input:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.input;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.input;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_Output:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.output;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.output;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_PWM:
             {
-                txPacket.Data[length] = 5;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                memcpy(&txPacket.Data[length + 3], &configP->value.pwm.period, 2);
-                txPacket.Data[length + 5] = configP->value.pwm.ratio;
+                handle->txPacket.Data[length] = 5;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                memcpy(&handle->txPacket.Data[length + 3], &configP->value.pwm.period, 2);
+                handle->txPacket.Data[length + 5] = configP->value.pwm.ratio;
                 length += 6;
                 break;
             }
@@ -1719,44 +2103,45 @@ bool ProteusIII_GPIOLocalWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint
         configP++;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_REQ;
+    handle->txPacket.Length = length;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_WRITECONFIG_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_GPIOLocalReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP)
+bool ProteusIII_Handle_GPIOLocalReadConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP)
 {
     if ((configP == NULL) || (numberOfConfigsP == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_CNF, CMD_Status_Success, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_READCONFIG_CNF, CMD_Status_Success, true))
     {
-        uint16_t length = rxPacket.Length;
+        uint16_t length = handle->rxPacket.Length;
 
         *numberOfConfigsP = 0;
-        uint8_t* uartP = &rxPacket.Data[1];
+        uint8_t* uartP = &handle->rxPacket.Data[1];
         ProteusIII_GPIOConfigBlock_t* configP_running = configP;
-        while (uartP < &rxPacket.Data[length])
+        while (uartP < &handle->rxPacket.Data[length])
         {
             switch (*(uartP + 2))
             {
@@ -1824,7 +2209,10 @@ bool ProteusIII_GPIOLocalReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint1
     return false;
 }
 
-bool ProteusIII_GPIOLocalWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls)
+/**
+ * @brief Prepares a CMD_GPIO_LOCAL_WRITE_REQ in handle->txPacket.
+ */
+static bool PrepareGPIOLocalWriteRequest(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls)
 {
     if ((controlP == NULL) || (numberOfControls == 0))
     {
@@ -1835,55 +2223,80 @@ bool ProteusIII_GPIOLocalWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t
 
     for (uint16_t i = 0; i < numberOfControls; i++)
     {
-        txPacket.Data[length] = 2;
-        txPacket.Data[length + 1] = controlP->gpioId;
-        txPacket.Data[length + 2] = controlP->value.output;
+        handle->txPacket.Data[length] = 2;
+        handle->txPacket.Data[length + 1] = controlP->gpioId;
+        handle->txPacket.Data[length + 2] = controlP->value.output;
         length += 3;
 
         /* Move pointer to next element. configP is increased by sizeof(ProteusIII_GPIOControlBlock_t)*/
         controlP++;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_WRITE_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_WRITE_REQ;
+    handle->txPacket.Length = length;
+    return true;
+}
+
+bool ProteusIII_Handle_GPIOLocalWrite(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls)
+{
+    if (!PrepareGPIOLocalWriteRequest(handle, controlP, numberOfControls))
+    {
+        return false;
+    }
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_WRITE_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_WRITE_CNF, CMD_Status_Success, true);
+}
+
+bool ProteusIII_Handle_GPIOLocalWriteAsync(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls, ProteusIII_AsyncCallback_t cb)
+{
+    if (!PrepareGPIOLocalWriteRequest(handle, controlP, numberOfControls))
+    {
+        return false;
+    }
+    return SendAsyncRequest(handle, PROTEUSIII_CMD_GPIO_LOCAL_WRITE_CNF, cb);
+}
+
+void ProteusIII_Handle_CheckAsyncTimeouts(ProteusIII_Handle_t* handle)
+{
+    CMDFrame_AsyncQueue_CheckTimeouts(&handle->asyncQueue);
+    ExpirePipelinedTransmits(handle);
 }
 
-bool ProteusIII_GPIOLocalRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP)
+bool ProteusIII_Handle_GPIOLocalRead(ProteusIII_Handle_t* handle, uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP)
 {
     if ((gpioToReadP == NULL) || (controlP == NULL) || (numberOfControlsP == NULL) || (amountGPIOToRead == 0))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_READ_REQ;
-    txPacket.Length = amountGPIOToRead + 1;
-    txPacket.Data[0] = amountGPIOToRead;
-    memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_LOCAL_READ_REQ;
+    handle->txPacket.Length = amountGPIOToRead + 1;
+    handle->txPacket.Data[0] = amountGPIOToRead;
+    memcpy(&handle->txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GPIO_LOCAL_READ_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_READ_CNF, CMD_Status_Success, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_LOCAL_READ_CNF, CMD_Status_Success, true))
     {
-        uint16_t length = rxPacket.Length;
+        uint16_t length = handle->rxPacket.Length;
 
         *numberOfControlsP = 0;
-        uint8_t* uartP = &rxPacket.Data[1];
+        uint8_t* uartP = &handle->rxPacket.Data[1];
         ProteusIII_GPIOControlBlock_t* controlP_running = controlP;
-        while (uartP < &rxPacket.Data[length])
+        while (uartP < &handle->rxPacket.Data[length])
         {
             /* each ControlBlock starts with length field which is currently fixed to "2" */
             if (*uartP == 2)
@@ -1905,7 +2318,7 @@ bool ProteusIII_GPIOLocalRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, Pr
     return false;
 }
 
-bool ProteusIII_GPIORemoteWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs)
+bool ProteusIII_Handle_GPIORemoteWriteConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs)
 {
     if ((configP == NULL) || (numberOfConfigs == 0))
     {
@@ -1920,38 +2333,38 @@ bool ProteusIII_GPIORemoteWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uin
         {
             case ProteusIII_GPIO_IO_Disconnected:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = 0x00;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = 0x00;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_Input:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.input;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.input;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_Output:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.output;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.output;
                 length += 4;
                 break;
             }
             case ProteusIII_GPIO_IO_PWM:
             {
-                txPacket.Data[length] = 5;
-                txPacket.Data[length + 1] = configP->gpioId;
-                txPacket.Data[length + 2] = configP->function;
-                memcpy(&txPacket.Data[length + 3], &configP->value.pwm.period, 2);
-                txPacket.Data[length + 5] = configP->value.pwm.ratio;
+                handle->txPacket.Data[length] = 5;
+                handle->txPacket.Data[length + 1] = configP->gpioId;
+                handle->txPacket.Data[length + 2] = configP->function;
+                memcpy(&handle->txPacket.Data[length + 3], &configP->value.pwm.period, 2);
+                handle->txPacket.Data[length + 5] = configP->value.pwm.ratio;
                 length += 6;
                 break;
             }
@@ -1961,44 +2374,45 @@ bool ProteusIII_GPIORemoteWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uin
         configP++;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_REQ;
+    handle->txPacket.Length = length;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_WRITECONFIG_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_GPIORemoteReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP)
+bool ProteusIII_Handle_GPIORemoteReadConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP)
 {
     if ((configP == NULL) || (numberOfConfigsP == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_CNF, CMD_Status_Success, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_READCONFIG_CNF, CMD_Status_Success, true))
     {
-        uint16_t length = rxPacket.Length;
+        uint16_t length = handle->rxPacket.Length;
 
         *numberOfConfigsP = 0;
-        uint8_t* uartP = &rxPacket.Data[1];
+        uint8_t* uartP = &handle->rxPacket.Data[1];
         ProteusIII_GPIOConfigBlock_t* configP_running = configP;
-        while (uartP < &rxPacket.Data[length])
+        while (uartP < &handle->rxPacket.Data[length])
         {
             switch (*(uartP + 2))
             {
@@ -2065,7 +2479,7 @@ bool ProteusIII_GPIORemoteReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint
     return false;
 }
 
-bool ProteusIII_GPIORemoteWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls)
+bool ProteusIII_Handle_GPIORemoteWrite(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls)
 {
     if ((controlP == NULL) || (numberOfControls == 0))
     {
@@ -2075,53 +2489,54 @@ bool ProteusIII_GPIORemoteWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_
     uint16_t length = 0;
     for (uint16_t i = 0; i < numberOfControls; i++)
     {
-        txPacket.Data[length] = 2;
-        txPacket.Data[length + 1] = controlP->gpioId;
-        txPacket.Data[length + 2] = controlP->value.ratio;
+        handle->txPacket.Data[length] = 2;
+        handle->txPacket.Data[length + 1] = controlP->gpioId;
+        handle->txPacket.Data[length + 2] = controlP->value.ratio;
         length += 3;
         controlP++;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_WRITE_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_WRITE_REQ;
+    handle->txPacket.Length = length;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_WRITE_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_WRITE_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_GPIORemoteRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP)
+bool ProteusIII_Handle_GPIORemoteRead(ProteusIII_Handle_t* handle, uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP)
 {
     if ((gpioToReadP == NULL) || (controlP == NULL) || (numberOfControlsP == NULL) || (amountGPIOToRead == 0))
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_READ_REQ;
-    txPacket.Length = amountGPIOToRead + 1;
-    txPacket.Data[0] = amountGPIOToRead;
-    memcpy(&txPacket.Data[1], gpioToReadP, amountGPIOToRead);
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GPIO_REMOTE_READ_REQ;
+    handle->txPacket.Length = amountGPIOToRead + 1;
+    handle->txPacket.Data[0] = amountGPIOToRead;
+    memcpy(&handle->txPacket.Data[1], gpioToReadP, amountGPIOToRead);
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GPIO_REMOTE_READ_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_READ_CNF, CMD_Status_Success, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GPIO_REMOTE_READ_CNF, CMD_Status_Success, true))
     {
-        uint16_t length = rxPacket.Length;
+        uint16_t length = handle->rxPacket.Length;
 
         *numberOfControlsP = 0;
-        uint8_t* uartP = &rxPacket.Data[1];
+        uint8_t* uartP = &handle->rxPacket.Data[1];
         ProteusIII_GPIOControlBlock_t* controlP_running = controlP;
-        while (uartP < &rxPacket.Data[length])
+        while (uartP < &handle->rxPacket.Data[length])
         {
             if (*uartP == 2)
             {
@@ -2139,29 +2554,30 @@ bool ProteusIII_GPIORemoteRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, P
     return false;
 }
 
-bool ProteusIII_GetBonds(ProteusIII_BondDatabase_t* bondDatabaseP)
+bool ProteusIII_Handle_GetBonds(ProteusIII_Handle_t* handle, ProteusIII_BondDatabase_t* bondDatabaseP)
 {
     if (bondDatabaseP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = PROTEUSIII_CMD_GET_BONDS_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_GET_BONDS_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GET_BONDS_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GET_BONDS_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GET_BONDS_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    bondDatabaseP->nrOfDevices = rxPacket.Data[1];
+    bondDatabaseP->nrOfDevices = handle->rxPacket.Data[1];
     if (bondDatabaseP->nrOfDevices > PROTEUSIII_MAX_BOND_DEVICES)
     {
         bondDatabaseP->nrOfDevices = PROTEUSIII_MAX_BOND_DEVICES;
@@ -2170,75 +2586,76 @@ bool ProteusIII_GetBonds(ProteusIII_BondDatabase_t* bondDatabaseP)
     for (uint8_t i = 0; i < bondDatabaseP->nrOfDevices; i++)
     {
         uint8_t offset = 2 + i * 8;
-        bondDatabaseP->devices[i].id = ((uint16_t)rxPacket.Data[offset] << 0) + ((uint16_t)rxPacket.Data[offset + 1] << 8);
-        memcpy(bondDatabaseP->devices[i].btMac, &rxPacket.Data[offset + 2], 6);
+        bondDatabaseP->devices[i].id = ((uint16_t)handle->rxPacket.Data[offset] << 0) + ((uint16_t)handle->rxPacket.Data[offset + 1] << 8);
+        memcpy(bondDatabaseP->devices[i].btMac, &handle->rxPacket.Data[offset + 2], 6);
     }
 
     return true;
 }
 
-bool ProteusIII_DeleteBonds()
+bool ProteusIII_Handle_DeleteBonds(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_DELETE_BONDS_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DELETE_BONDS_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_DELETE_BONDS_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_DELETE_BONDS_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_DeleteBond(uint8_t bondId)
+bool ProteusIII_Handle_DeleteBond(ProteusIII_Handle_t* handle, uint8_t bondId)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_DELETE_BONDS_REQ;
-    txPacket.Length = 2;
-    txPacket.Data[0] = bondId;
-    txPacket.Data[1] = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DELETE_BONDS_REQ;
+    handle->txPacket.Length = 2;
+    handle->txPacket.Data[0] = bondId;
+    handle->txPacket.Data[1] = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_DELETE_BONDS_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_DELETE_BONDS_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_AllowUnbondedConnections()
+bool ProteusIII_Handle_AllowUnbondedConnections(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_ALLOWUNBONDEDCONNECTIONS_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_DTMEnable()
+bool ProteusIII_Handle_DTMEnable(ProteusIII_Handle_t* handle)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_DTMSTART_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DTMSTART_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    ExpectResponse(handle, PROTEUSIII_CMD_GETSTATE_CNF);
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true))
+    if (Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_GETSTATE_CNF, CMD_Status_NoStatus, true))
     {
-        if ((rxPacket.Data[0] == (uint8_t)ProteusIII_BLE_Role_DTM) && (rxPacket.Data[1] == (uint8_t)ProteusIII_BLE_Action_DTM))
+        if ((handle->rxPacket.Data[0] == (uint8_t)ProteusIII_BLE_Role_DTM) && (handle->rxPacket.Data[1] == (uint8_t)ProteusIII_BLE_Action_DTM))
         {
             return true;
         }
@@ -2246,31 +2663,243 @@ bool ProteusIII_DTMEnable()
     return false;
 }
 
-bool ProteusIII_DTMRun(ProteusIII_DTMCommand_t command, uint8_t channel_vendoroption, uint8_t length_vendorcmd, uint8_t payload)
+bool ProteusIII_Handle_DTMRun(ProteusIII_Handle_t* handle, ProteusIII_DTMCommand_t command, uint8_t channel_vendoroption, uint8_t length_vendorcmd, uint8_t payload)
 {
-    txPacket.Cmd = PROTEUSIII_CMD_DTM_REQ;
-    txPacket.Length = 4;
-    txPacket.Data[0] = command;
-    txPacket.Data[1] = channel_vendoroption;
-    txPacket.Data[2] = length_vendorcmd;
-    txPacket.Data[3] = payload;
+    handle->txPacket.Cmd = PROTEUSIII_CMD_DTM_REQ;
+    handle->txPacket.Length = 4;
+    handle->txPacket.Data[0] = command;
+    handle->txPacket.Data[1] = channel_vendoroption;
+    handle->txPacket.Data[2] = length_vendorcmd;
+    handle->txPacket.Data[3] = payload;
 
-    FillChecksum(&txPacket);
-    if (!ProteusIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    FillChecksum(&handle->txPacket);
+    if (!ProteusIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, PROTEUSIII_CMD_DTM_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, PROTEUSIII_CMD_DTM_CNF, CMD_Status_Success, true);
 }
 
-bool ProteusIII_DTMStartTX(uint8_t channel, uint8_t length, ProteusIII_DTMTXPattern_t pattern) { return ProteusIII_DTMRun(ProteusIII_DTMCommand_StartTX, channel, length, (uint8_t)pattern); }
+bool ProteusIII_Handle_DTMStartTX(ProteusIII_Handle_t* handle, uint8_t channel, uint8_t length, ProteusIII_DTMTXPattern_t pattern) { return ProteusIII_Handle_DTMRun(handle, ProteusIII_DTMCommand_StartTX, channel, length, (uint8_t)pattern); }
+
+bool ProteusIII_Handle_DTMStartTXCarrier(ProteusIII_Handle_t* handle, uint8_t channel) { return ProteusIII_Handle_DTMRun(handle, ProteusIII_DTMCommand_StartTX, channel, 0x00, 0x03); }
+
+bool ProteusIII_Handle_DTMStop(ProteusIII_Handle_t* handle) { return ProteusIII_Handle_DTMRun(handle, ProteusIII_DTMCommand_Stop, 0x00, 0x00, 0x01); }
+
+bool ProteusIII_Handle_DTMSetPhy(ProteusIII_Handle_t* handle, ProteusIII_Phy_t phy) { return ProteusIII_Handle_DTMRun(handle, ProteusIII_DTMCommand_Setup, 0x02, (uint8_t)phy, 0x00); }
+
+bool ProteusIII_Handle_DTMSetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t power) { return ProteusIII_Handle_DTMRun(handle, ProteusIII_DTMCommand_StartTX, (uint8_t)power, 0x02, 0x03); }
+
+ProteusIII_Handle_t* ProteusIII_GetHandle(uint8_t index) { return (index < PROTEUSIII_MAX_INSTANCES) ? &instances[index] : NULL; }
+
+/**************************************
+ *   Functions for default instance   *
+ **************************************/
+
+bool ProteusIII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength) { return ProteusIII_Handle_Transparent_Transmit(DEFAULT_HANDLE, data, dataLength); }
+
+bool ProteusIII_Init(WE_UART_t* uartP, ProteusIII_Pins_t* pinoutP, ProteusIII_OperationMode_t opMode, ProteusIII_CallbackConfig_t callbackConfig) { return ProteusIII_Handle_Init(DEFAULT_HANDLE, uartP, pinoutP, opMode, callbackConfig); }
+
+bool ProteusIII_Deinit() { return ProteusIII_Handle_Deinit(DEFAULT_HANDLE); }
+
+bool ProteusIII_PinWakeup() { return ProteusIII_Handle_PinWakeup(DEFAULT_HANDLE); }
+
+bool ProteusIII_PinUartEnable() { return ProteusIII_Handle_PinUartEnable(DEFAULT_HANDLE); }
+
+bool ProteusIII_PinReset() { return ProteusIII_Handle_PinReset(DEFAULT_HANDLE); }
+
+bool ProteusIII_Reset() { return ProteusIII_Handle_Reset(DEFAULT_HANDLE); }
+
+bool ProteusIII_Disconnect() { return ProteusIII_Handle_Disconnect(DEFAULT_HANDLE); }
+
+bool ProteusIII_Sleep() { return ProteusIII_Handle_Sleep(DEFAULT_HANDLE); }
+
+bool ProteusIII_UartDisable() { return ProteusIII_Handle_UartDisable(DEFAULT_HANDLE); }
+
+bool ProteusIII_Transmit(uint8_t* payloadP, uint16_t length) { return ProteusIII_Handle_Transmit(DEFAULT_HANDLE, payloadP, length); }
+
+bool ProteusIII_TransmitPipelined(uint8_t* payloadP, uint16_t length) { return ProteusIII_Handle_TransmitPipelined(DEFAULT_HANDLE, payloadP, length); }
+
+bool ProteusIII_WaitTransmitComplete(uint32_t maxTimeMs) { return ProteusIII_Handle_WaitTransmitComplete(DEFAULT_HANDLE, maxTimeMs); }
+
+bool ProteusIII_SetBeacon(uint8_t* beaconDataP, uint16_t length) { return ProteusIII_Handle_SetBeacon(DEFAULT_HANDLE, beaconDataP, length); }
+
+bool ProteusIII_FactoryReset() { return ProteusIII_Handle_FactoryReset(DEFAULT_HANDLE); }
+
+bool ProteusIII_CheckNSet(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return ProteusIII_Handle_CheckNSet(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool ProteusIII_Set(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return ProteusIII_Handle_Set(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool ProteusIII_SetAsync(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ProteusIII_AsyncCallback_t cb) { return ProteusIII_Handle_SetAsync(DEFAULT_HANDLE, userSetting, valueP, length, cb); }
+
+bool ProteusIII_SetDeviceName(uint8_t* deviceNameP, uint8_t nameLength) { return ProteusIII_Handle_SetDeviceName(DEFAULT_HANDLE, deviceNameP, nameLength); }
+
+bool ProteusIII_SetAdvertisingTimeout(uint16_t advTimeout) { return ProteusIII_Handle_SetAdvertisingTimeout(DEFAULT_HANDLE, advTimeout); }
+
+bool ProteusIII_SetAdvertisingFlags(ProteusIII_AdvertisingFlags_t advFlags) { return ProteusIII_Handle_SetAdvertisingFlags(DEFAULT_HANDLE, advFlags); }
+
+bool ProteusIII_SetScanFlags(uint8_t scanFlags) { return ProteusIII_Handle_SetScanFlags(DEFAULT_HANDLE, scanFlags); }
+
+bool ProteusIII_SetBeaconFlags(ProteusIII_BeaconFlags_t beaconFlags) { return ProteusIII_Handle_SetBeaconFlags(DEFAULT_HANDLE, beaconFlags); }
+
+bool ProteusIII_SetCFGFlags(uint16_t cfgFlags) { return ProteusIII_Handle_SetCFGFlags(DEFAULT_HANDLE, cfgFlags); }
+
+bool ProteusIII_SetConnectionTiming(ProteusIII_ConnectionTiming_t connectionTiming) { return ProteusIII_Handle_SetConnectionTiming(DEFAULT_HANDLE, connectionTiming); }
+
+bool ProteusIII_SetScanTiming(ProteusIII_ScanTiming_t scanTiming) { return ProteusIII_Handle_SetScanTiming(DEFAULT_HANDLE, scanTiming); }
+
+bool ProteusIII_SetScanFactor(uint8_t scanFactor) { return ProteusIII_Handle_SetScanFactor(DEFAULT_HANDLE, scanFactor); }
+
+bool ProteusIII_SetTXPower(ProteusIII_TXPower_t txPower) { return ProteusIII_Handle_SetTXPower(DEFAULT_HANDLE, txPower); }
+
+bool ProteusIII_SetSecFlags(ProteusIII_SecFlags_t secFlags) { return ProteusIII_Handle_SetSecFlags(DEFAULT_HANDLE, secFlags); }
+
+bool ProteusIII_SetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t secFlags) { return ProteusIII_Handle_SetSecFlagsPeripheralOnly(DEFAULT_HANDLE, secFlags); }
+
+bool ProteusIII_SetBaudrateIndex(ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable) { return ProteusIII_Handle_SetBaudrateIndex(DEFAULT_HANDLE, baudrate, parity, flowControlEnable); }
+
+bool ProteusIII_SetBTMAC(uint8_t* btMacP) { return ProteusIII_Handle_SetBTMAC(DEFAULT_HANDLE, btMacP); }
+
+bool ProteusIII_SetStaticPasskey(uint8_t* staticPasskeyP) { return ProteusIII_Handle_SetStaticPasskey(DEFAULT_HANDLE, staticPasskeyP); }
+
+bool ProteusIII_SetAppearance(uint16_t appearance) { return ProteusIII_Handle_SetAppearance(DEFAULT_HANDLE, appearance); }
+
+bool ProteusIII_SetSppBaseUuid(uint8_t* uuidP) { return ProteusIII_Handle_SetSppBaseUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_SetSppServiceUuid(uint8_t* uuidP) { return ProteusIII_Handle_SetSppServiceUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_SetSppRxUuid(uint8_t* uuidP) { return ProteusIII_Handle_SetSppRxUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_SetSppTxUuid(uint8_t* uuidP) { return ProteusIII_Handle_SetSppTxUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_Get(ProteusIII_UserSettings_t userSetting, uint8_t* responseP, uint16_t* responseLengthP) { return ProteusIII_Handle_Get(DEFAULT_HANDLE, userSetting, responseP, responseLengthP); }
+
+bool ProteusIII_GetAsync(ProteusIII_UserSettings_t userSetting, ProteusIII_AsyncCallback_t cb) { return ProteusIII_Handle_GetAsync(DEFAULT_HANDLE, userSetting, cb); }
+
+bool ProteusIII_GetFWVersion(uint8_t* versionP) { return ProteusIII_Handle_GetFWVersion(DEFAULT_HANDLE, versionP); }
+
+bool ProteusIII_GetDeviceInfo(ProteusIII_DeviceInfo_t* deviceInfoP) { return ProteusIII_Handle_GetDeviceInfo(DEFAULT_HANDLE, deviceInfoP); }
+
+bool ProteusIII_GetSerialNumber(uint8_t* serialNumberP) { return ProteusIII_Handle_GetSerialNumber(DEFAULT_HANDLE, serialNumberP); }
+
+bool ProteusIII_GetDeviceName(uint8_t* deviceNameP, uint16_t* nameLengthP) { return ProteusIII_Handle_GetDeviceName(DEFAULT_HANDLE, deviceNameP, nameLengthP); }
+
+bool ProteusIII_GetMAC(uint8_t* macP) { return ProteusIII_Handle_GetMAC(DEFAULT_HANDLE, macP); }
+
+bool ProteusIII_GetBTMAC(uint8_t* btMacP) { return ProteusIII_Handle_GetBTMAC(DEFAULT_HANDLE, btMacP); }
+
+bool ProteusIII_GetAdvertisingTimeout(uint16_t* advTimeoutP) { return ProteusIII_Handle_GetAdvertisingTimeout(DEFAULT_HANDLE, advTimeoutP); }
+
+bool ProteusIII_GetAdvertisingFlags(ProteusIII_AdvertisingFlags_t* advFlagsP) { return ProteusIII_Handle_GetAdvertisingFlags(DEFAULT_HANDLE, advFlagsP); }
+
+bool ProteusIII_GetScanFlags(uint8_t* scanFlagsP) { return ProteusIII_Handle_GetScanFlags(DEFAULT_HANDLE, scanFlagsP); }
+
+bool ProteusIII_GetBeaconFlags(ProteusIII_BeaconFlags_t* beaconFlagsP) { return ProteusIII_Handle_GetBeaconFlags(DEFAULT_HANDLE, beaconFlagsP); }
+
+bool ProteusIII_GetConnectionTiming(ProteusIII_ConnectionTiming_t* connectionTimingP) { return ProteusIII_Handle_GetConnectionTiming(DEFAULT_HANDLE, connectionTimingP); }
+
+bool ProteusIII_GetScanTiming(ProteusIII_ScanTiming_t* scanTimingP) { return ProteusIII_Handle_GetScanTiming(DEFAULT_HANDLE, scanTimingP); }
+
+bool ProteusIII_GetScanFactor(uint8_t* scanFactorP) { return ProteusIII_Handle_GetScanFactor(DEFAULT_HANDLE, scanFactorP); }
+
+bool ProteusIII_GetTXPower(ProteusIII_TXPower_t* txPowerP) { return ProteusIII_Handle_GetTXPower(DEFAULT_HANDLE, txPowerP); }
+
+bool ProteusIII_GetSecFlags(ProteusIII_SecFlags_t* secFlagsP) { return ProteusIII_Handle_GetSecFlags(DEFAULT_HANDLE, secFlagsP); }
+
+bool ProteusIII_GetSecFlagsPeripheralOnly(ProteusIII_SecFlags_t* secFlagsP) { return ProteusIII_Handle_GetSecFlagsPeripheralOnly(DEFAULT_HANDLE, secFlagsP); }
+
+bool ProteusIII_GetBaudrateIndex(ProteusIII_BaudRate_t* baudrateP, ProteusIII_UartParity_t* parityP, bool* flowControlEnableP) { return ProteusIII_Handle_GetBaudrateIndex(DEFAULT_HANDLE, baudrateP, parityP, flowControlEnableP); }
+
+bool ProteusIII_GetStaticPasskey(uint8_t* staticPasskeyP) { return ProteusIII_Handle_GetStaticPasskey(DEFAULT_HANDLE, staticPasskeyP); }
+
+bool ProteusIII_GetAppearance(uint16_t* appearanceP) { return ProteusIII_Handle_GetAppearance(DEFAULT_HANDLE, appearanceP); }
+
+bool ProteusIII_GetSppBaseUuid(uint8_t* uuidP) { return ProteusIII_Handle_GetSppBaseUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_GetSppServiceUuid(uint8_t* uuidP) { return ProteusIII_Handle_GetSppServiceUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_GetSppRxUuid(uint8_t* uuidP) { return ProteusIII_Handle_GetSppRxUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_GetSppTxUuid(uint8_t* uuidP) { return ProteusIII_Handle_GetSppTxUuid(DEFAULT_HANDLE, uuidP); }
+
+bool ProteusIII_GetCFGFlags(uint16_t* cfgFlagsP) { return ProteusIII_Handle_GetCFGFlags(DEFAULT_HANDLE, cfgFlagsP); }
+
+bool ProteusIII_GetState(ProteusIII_ModuleState_t* moduleStateP) { return ProteusIII_Handle_GetState(DEFAULT_HANDLE, moduleStateP); }
+
+ProteusIII_DriverState_t ProteusIII_GetDriverState() { return ProteusIII_Handle_GetDriverState(DEFAULT_HANDLE); }
+
+bool ProteusIII_ScanStart() { return ProteusIII_Handle_ScanStart(DEFAULT_HANDLE); }
+
+bool ProteusIII_ScanStop() { return ProteusIII_Handle_ScanStop(DEFAULT_HANDLE); }
+
+bool ProteusIII_ScanStartAsync(ProteusIII_AsyncCallback_t cb) { return ProteusIII_Handle_ScanStartAsync(DEFAULT_HANDLE, cb); }
+
+bool ProteusIII_ScanStopAsync(ProteusIII_AsyncCallback_t cb) { return ProteusIII_Handle_ScanStopAsync(DEFAULT_HANDLE, cb); }
+
+bool ProteusIII_GetDevices(ProteusIII_GetDevices_t* devicesP) { return ProteusIII_Handle_GetDevices(DEFAULT_HANDLE, devicesP); }
+
+bool ProteusIII_Connect(uint8_t* btMacP) { return ProteusIII_Handle_Connect(DEFAULT_HANDLE, btMacP); }
+
+bool ProteusIII_Passkey(uint8_t* passkeyP) { return ProteusIII_Handle_Passkey(DEFAULT_HANDLE, passkeyP); }
+
+bool ProteusIII_NumericCompareConfirm(bool keyIsOk) { return ProteusIII_Handle_NumericCompareConfirm(DEFAULT_HANDLE, keyIsOk); }
+
+bool ProteusIII_PhyUpdate(ProteusIII_Phy_t phy) { return ProteusIII_Handle_PhyUpdate(DEFAULT_HANDLE, phy); }
+
+bool ProteusIII_GetStatusLed2PinLevel(WE_Pin_Level_t* statusLed2LevelP) { return ProteusIII_Handle_GetStatusLed2PinLevel(DEFAULT_HANDLE, statusLed2LevelP); }
+
+bool ProteusIII_IsPeripheralOnlyModeBusy(bool* busyStateP) { return ProteusIII_Handle_IsPeripheralOnlyModeBusy(DEFAULT_HANDLE, busyStateP); }
+
+void ProteusIII_SetByteRxCallback(WE_UART_HandleRxByte_t callback) { ProteusIII_Handle_SetByteRxCallback(DEFAULT_HANDLE, callback); }
+
+bool ProteusIII_GPIOLocalWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs) { return ProteusIII_Handle_GPIOLocalWriteConfig(DEFAULT_HANDLE, configP, numberOfConfigs); }
+
+bool ProteusIII_GPIOLocalReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP) { return ProteusIII_Handle_GPIOLocalReadConfig(DEFAULT_HANDLE, configP, numberOfConfigsP); }
+
+bool ProteusIII_GPIOLocalWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls) { return ProteusIII_Handle_GPIOLocalWrite(DEFAULT_HANDLE, controlP, numberOfControls); }
+
+bool ProteusIII_GPIOLocalWriteAsync(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls, ProteusIII_AsyncCallback_t cb) { return ProteusIII_Handle_GPIOLocalWriteAsync(DEFAULT_HANDLE, controlP, numberOfControls, cb); }
+
+void ProteusIII_CheckAsyncTimeouts() { ProteusIII_Handle_CheckAsyncTimeouts(DEFAULT_HANDLE); }
+
+bool ProteusIII_GPIOLocalRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP) { return ProteusIII_Handle_GPIOLocalRead(DEFAULT_HANDLE, gpioToReadP, amountGPIOToRead, controlP, numberOfControlsP); }
+
+bool ProteusIII_GPIORemoteWriteConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs) { return ProteusIII_Handle_GPIORemoteWriteConfig(DEFAULT_HANDLE, configP, numberOfConfigs); }
+
+bool ProteusIII_GPIORemoteReadConfig(ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP) { return ProteusIII_Handle_GPIORemoteReadConfig(DEFAULT_HANDLE, configP, numberOfConfigsP); }
+
+bool ProteusIII_GPIORemoteWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls) { return ProteusIII_Handle_GPIORemoteWrite(DEFAULT_HANDLE, controlP, numberOfControls); }
+
+bool ProteusIII_GPIORemoteRead(uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP) { return ProteusIII_Handle_GPIORemoteRead(DEFAULT_HANDLE, gpioToReadP, amountGPIOToRead, controlP, numberOfControlsP); }
+
+bool ProteusIII_GetBonds(ProteusIII_BondDatabase_t* bondDatabaseP) { return ProteusIII_Handle_GetBonds(DEFAULT_HANDLE, bondDatabaseP); }
+
+bool ProteusIII_DeleteBonds() { return ProteusIII_Handle_DeleteBonds(DEFAULT_HANDLE); }
+
+bool ProteusIII_DeleteBond(uint8_t bondId) { return ProteusIII_Handle_DeleteBond(DEFAULT_HANDLE, bondId); }
+
+bool ProteusIII_AllowUnbondedConnections() { return ProteusIII_Handle_AllowUnbondedConnections(DEFAULT_HANDLE); }
+
+bool ProteusIII_DTMEnable() { return ProteusIII_Handle_DTMEnable(DEFAULT_HANDLE); }
+
+bool ProteusIII_DTMRun(ProteusIII_DTMCommand_t command, uint8_t channel_vendoroption, uint8_t length_vendorcmd, uint8_t payload) { return ProteusIII_Handle_DTMRun(DEFAULT_HANDLE, command, channel_vendoroption, length_vendorcmd, payload); }
+
+bool ProteusIII_DTMStartTX(uint8_t channel, uint8_t length, ProteusIII_DTMTXPattern_t pattern) { return ProteusIII_Handle_DTMStartTX(DEFAULT_HANDLE, channel, length, pattern); }
+
+bool ProteusIII_DTMStartTXCarrier(uint8_t channel) { return ProteusIII_Handle_DTMStartTXCarrier(DEFAULT_HANDLE, channel); }
+
+bool ProteusIII_DTMStop() { return ProteusIII_Handle_DTMStop(DEFAULT_HANDLE); }
+
+bool ProteusIII_DTMSetPhy(ProteusIII_Phy_t phy) { return ProteusIII_Handle_DTMSetPhy(DEFAULT_HANDLE, phy); }
 
-bool ProteusIII_DTMStartTXCarrier(uint8_t channel) { return ProteusIII_DTMRun(ProteusIII_DTMCommand_StartTX, channel, 0x00, 0x03); }
+bool ProteusIII_DTMSetTXPower(ProteusIII_TXPower_t power) { return ProteusIII_Handle_DTMSetTXPower(DEFAULT_HANDLE, power); }
 
-bool ProteusIII_DTMStop() { return ProteusIII_DTMRun(ProteusIII_DTMCommand_Stop, 0x00, 0x00, 0x01); }
+uint32_t ProteusIII_GetConfirmationOverflowCount() { return ProteusIII_Handle_GetConfirmationOverflowCount(DEFAULT_HANDLE); }
 
-bool ProteusIII_DTMSetPhy(ProteusIII_Phy_t phy) { return ProteusIII_DTMRun(ProteusIII_DTMCommand_Setup, 0x02, (uint8_t)phy, 0x00); }
+#if defined(WE_STATS_ENABLED)
+bool ProteusIII_GetStatistics(WE_Stats_t* statsP) { return ProteusIII_Handle_GetStatistics(DEFAULT_HANDLE, statsP); }
 
-bool ProteusIII_DTMSetTXPower(ProteusIII_TXPower_t power) { return ProteusIII_DTMRun(ProteusIII_DTMCommand_StartTX, (uint8_t)power, 0x02, 0x03); }
+void ProteusIII_ResetStatistics() { ProteusIII_Handle_ResetStatistics(DEFAULT_HANDLE); }
+#endif
@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -483,6 +484,14 @@ typedef void (*ProteusIII_RssiCallback_t)(uint8_t* btMac, int8_t rssi, int8_t tx
 typedef void (*ProteusIII_GpioWriteCallback_t)(bool remote, uint8_t gpioId, uint8_t value);
 typedef void (*ProteusIII_GpioRemoteConfigCallback_t)(ProteusIII_GPIOConfigBlock_t* gpioConfig);
 typedef void (*ProteusIII_ErrorCallback_t)(uint8_t errorCode);
+/* Is called once for each packet sent using ProteusIII_TransmitPipelined() (strictly in the order the packets
+ * have been sent). success is false if the packet has been rejected by the module, couldn't be sent or
+ * hasn't been completed within PROTEUSIII_TX_TIMEOUT_MS. */
+typedef void (*ProteusIII_TxCompleteCallback_t)(bool success);
+/* Is called when a request sent using one of the *Async() functions has been completed (from the context
+ * processing the received data, or from ProteusIII_CheckAsyncTimeouts() in case of a timeout). dataP points
+ * to the payload of the confirmation (status byte followed by the response data) and is NULL on timeout. */
+typedef void (*ProteusIII_AsyncCallback_t)(bool success, uint8_t* dataP, uint16_t length);
 
 /**
  * @brief Callback configuration structure. Used as argument for ProteusIII_Init().
@@ -507,8 +516,55 @@ typedef struct ProteusIII_CallbackConfig_t
     ProteusIII_GpioWriteCallback_t gpioWriteCb;               /**< Callback for CMD_GPIO_LOCAL_WRITE_IND and CMD_GPIO_REMOTE_WRITE_IND */
     ProteusIII_GpioRemoteConfigCallback_t gpioRemoteConfigCb; /**< Callback for CMD_GPIO_REMOTE_WRITECONFIG_IND */
     ProteusIII_ErrorCallback_t errorCb;                       /**< Callback for CMD_ERROR_IND */
+    ProteusIII_TxCompleteCallback_t txCompleteCb;             /**< Callback for CMD_TXCOMPLETE_RSP of packets sent using ProteusIII_TransmitPipelined() */
 } ProteusIII_CallbackConfig_t;
 
+#ifndef PROTEUSIII_TX_WINDOW_SIZE
+/**
+ * @brief Max. number of packets sent using ProteusIII_TransmitPipelined() that may be
+ * outstanding (i.e. not yet confirmed by CMD_TXCOMPLETE_RSP) at the same time.
+ *
+ * Must be a power of two in the range 1 to 128, so that the 8 bit packet counter
+ * maps to the same window slots before and after it wraps around.
+ */
+#define PROTEUSIII_TX_WINDOW_SIZE 4
+#endif
+
+#ifndef PROTEUSIII_TX_TIMEOUT_MS
+/**
+ * @brief Time in ms after which a packet sent using ProteusIII_TransmitPipelined() is reported
+ * as failed if its CMD_DATA_CNF or CMD_TXCOMPLETE_RSP hasn't been received (e.g. as it has been lost).
+ */
+#define PROTEUSIII_TX_TIMEOUT_MS 3000
+#endif
+
+#ifndef PROTEUSIII_MAX_INSTANCES
+/**
+ * @brief Max. number of Proteus-III modules that can be driven at the same time (see ProteusIII_GetHandle()).
+ */
+#define PROTEUSIII_MAX_INSTANCES 1
+#endif
+
+/**
+ * @brief Handle of a driver instance (opaque).
+ *
+ * Each instance holds its own state (UART, pins, callbacks, receive buffers), so
+ * several Proteus-III modules connected to different UARTs can be used at the same time.
+ * The functions without handle parameter operate on the instance with index 0.
+ * Note that callbacks don't receive the handle - use different callback functions
+ * for each instance if needed.
+ */
+typedef struct ProteusIII_Handle_t ProteusIII_Handle_t;
+
+/**
+ * @brief Returns the handle of a driver instance.
+ *
+ * @param[in] index: Index of instance (0 to PROTEUSIII_MAX_INSTANCES - 1, 0 is the default instance)
+ *
+ * @return Handle of the instance or NULL if index is out of range
+ */
+extern ProteusIII_Handle_t* ProteusIII_GetHandle(uint8_t index);
+
 /**
  * @brief Initialize the ProteusIII for serial interface.
  *
@@ -645,6 +701,37 @@ extern bool ProteusIII_ScanStart();
  */
 extern bool ProteusIII_ScanStop();
 
+/**
+ * @brief Start scan without waiting for the confirmation
+ *
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise (e.g. too many pending asynchronous requests)
+ */
+extern bool ProteusIII_ScanStartAsync(ProteusIII_AsyncCallback_t cb);
+
+/**
+ * @brief Stop a scan without waiting for the confirmation
+ *
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise (e.g. too many pending asynchronous requests)
+ */
+extern bool ProteusIII_ScanStopAsync(ProteusIII_AsyncCallback_t cb);
+
+/**
+ * @brief Completes pending asynchronous requests that haven't been confirmed in time
+ * and reports pipelined packets as failed that haven't been completed in time
+ *
+ * Timeouts are also checked whenever a request is sent or a confirmation is received,
+ * so this function only needs to be called periodically if no further requests are sent.
+ *
+ * @return None
+ */
+extern void ProteusIII_CheckAsyncTimeouts();
+
 /**
  * @brief Request the scan results
  *
@@ -666,6 +753,32 @@ extern bool ProteusIII_GetDevices(ProteusIII_GetDevices_t* devicesP);
  */
 extern bool ProteusIII_Transmit(uint8_t* payloadP, uint16_t length);
 
+/**
+ * @brief Transmit data if a connection is open, without waiting for the data to be sent.
+ *
+ * Up to PROTEUSIII_TX_WINDOW_SIZE packets may be outstanding at the same time. If the window is
+ * full, the function waits until the module reports that a previous packet has been sent
+ * (CMD_TXCOMPLETE_RSP). The result of each packet is reported using the txCompleteCb callback.
+ * Packets whose responses are missing are reported as failed after PROTEUSIII_TX_TIMEOUT_MS.
+ *
+ * @param[in] payloadP: Pointer to the data to transmit
+ * @param[in] length: Length of the data to transmit
+ *
+ * @return True if the data has been passed to the module (or its failure has already been reported using txCompleteCb),
+ *         false otherwise (e.g. the window didn't become free in time)
+ */
+extern bool ProteusIII_TransmitPipelined(uint8_t* payloadP, uint16_t length);
+
+/**
+ * @brief Waits until all packets sent using ProteusIII_TransmitPipelined() have been completed.
+ *
+ * @param[in] maxTimeMs: Max. time to wait in milliseconds
+ *
+ * @return True if all packets have been completed,
+ *         false if there are still outstanding packets after maxTimeMs
+ */
+extern bool ProteusIII_WaitTransmitComplete(uint32_t maxTimeMs);
+
 /**
  * @brief Transmitting the data via UART.
  *
@@ -786,6 +899,19 @@ extern bool ProteusIII_GPIOLocalReadConfig(ProteusIII_GPIOConfigBlock_t* configP
  */
 extern bool ProteusIII_GPIOLocalWrite(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls);
 
+/**
+ * @brief Set the output value of the local pin without waiting for the confirmation.
+ * See ProteusIII_GPIOLocalWrite
+ *
+ * @param[in] controlP: Pointer to one or more pin controls
+ * @param[in] numberOfControls: number of entries in controlP array
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+ */
+extern bool ProteusIII_GPIOLocalWriteAsync(ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls, ProteusIII_AsyncCallback_t cb);
+
 /**
  * @brief Read the input of the pin. Pin has to be configured first.
  * See ProteusIII_GPIOLocalWriteConfig
@@ -909,6 +1035,20 @@ extern bool ProteusIII_FactoryReset();
  */
 extern bool ProteusIII_Set(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
 
+/**
+ * @brief Set a special user setting without waiting for the confirmation.
+ * See ProteusIII_Set
+ *
+ * @param[in] userSetting: user setting to be updated
+ * @param[in] valueP: Pointer to the new settings value
+ * @param[in] length: Length of the value
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+ */
+extern bool ProteusIII_SetAsync(ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ProteusIII_AsyncCallback_t cb);
+
 /**
  * @brief Set a special user setting, but checks first if the value is already ok
  *
@@ -1203,6 +1343,17 @@ extern bool ProteusIII_SetSppTxUuid(uint8_t* uuidP);
  */
 extern bool ProteusIII_Get(ProteusIII_UserSettings_t userSetting, uint8_t* responseP, uint16_t* responseLengthP);
 
+/**
+ * @brief Request the current user settings without waiting for the response
+ *
+ * @param[in] userSetting: user setting to be requested
+ * @param[in] cb: Function called with the requested content when the response has been received
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+ */
+extern bool ProteusIII_GetAsync(ProteusIII_UserSettings_t userSetting, ProteusIII_AsyncCallback_t cb);
+
 /**
  * @brief Request the 3 byte firmware version.
  *
@@ -1517,6 +1668,144 @@ extern bool ProteusIII_DTMSetPhy(ProteusIII_Phy_t phy);
  */
 extern bool ProteusIII_DTMSetTXPower(ProteusIII_TXPower_t power);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ProteusIII_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ProteusIII_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ProteusIII_ResetStatistics();
+#endif
+
+/**
+ * @name Functions operating on a specific driver instance
+ *
+ * Same as the corresponding functions without handle parameter (e.g. ProteusIII_Handle_Init() is
+ * the same as ProteusIII_Init()), but for the driver instance referenced by handle (see ProteusIII_GetHandle()).
+ * @{
+ */
+extern bool ProteusIII_Handle_SetBeacon(ProteusIII_Handle_t* handle, uint8_t* beaconDataP, uint16_t length);
+extern bool ProteusIII_Handle_Init(ProteusIII_Handle_t* handle, WE_UART_t* uartP, ProteusIII_Pins_t* pinoutP, ProteusIII_OperationMode_t opMode, ProteusIII_CallbackConfig_t callbackConfig);
+extern bool ProteusIII_Handle_Deinit(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_GetState(ProteusIII_Handle_t* handle, ProteusIII_ModuleState_t* moduleStateP);
+extern bool ProteusIII_Handle_PinReset(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_Reset(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_Sleep(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_PinWakeup(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_UartDisable(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_PinUartEnable(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_Connect(ProteusIII_Handle_t* handle, uint8_t* btMacP);
+extern bool ProteusIII_Handle_Disconnect(ProteusIII_Handle_t* handle);
+extern ProteusIII_DriverState_t ProteusIII_Handle_GetDriverState(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_ScanStart(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_ScanStop(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_ScanStartAsync(ProteusIII_Handle_t* handle, ProteusIII_AsyncCallback_t cb);
+extern bool ProteusIII_Handle_ScanStopAsync(ProteusIII_Handle_t* handle, ProteusIII_AsyncCallback_t cb);
+extern void ProteusIII_Handle_CheckAsyncTimeouts(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_GetDevices(ProteusIII_Handle_t* handle, ProteusIII_GetDevices_t* devicesP);
+extern bool ProteusIII_Handle_Transmit(ProteusIII_Handle_t* handle, uint8_t* payloadP, uint16_t length);
+extern bool ProteusIII_Handle_TransmitPipelined(ProteusIII_Handle_t* handle, uint8_t* payloadP, uint16_t length);
+extern bool ProteusIII_Handle_WaitTransmitComplete(ProteusIII_Handle_t* handle, uint32_t maxTimeMs);
+extern bool ProteusIII_Handle_Transparent_Transmit(ProteusIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength);
+extern bool ProteusIII_Handle_Passkey(ProteusIII_Handle_t* handle, uint8_t* passkeyP);
+extern bool ProteusIII_Handle_NumericCompareConfirm(ProteusIII_Handle_t* handle, bool keyIsOk);
+extern bool ProteusIII_Handle_PhyUpdate(ProteusIII_Handle_t* handle, ProteusIII_Phy_t phy);
+extern bool ProteusIII_Handle_GetStatusLed2PinLevel(ProteusIII_Handle_t* handle, WE_Pin_Level_t* statusLed2LevelP);
+extern bool ProteusIII_Handle_IsPeripheralOnlyModeBusy(ProteusIII_Handle_t* handle, bool* busyStateP);
+extern void ProteusIII_Handle_SetByteRxCallback(ProteusIII_Handle_t* handle, WE_UART_HandleRxByte_t callback);
+extern bool ProteusIII_Handle_GPIOLocalWriteConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs);
+extern bool ProteusIII_Handle_GPIOLocalReadConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP);
+extern bool ProteusIII_Handle_GPIOLocalWrite(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls);
+extern bool ProteusIII_Handle_GPIOLocalWriteAsync(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls, ProteusIII_AsyncCallback_t cb);
+extern bool ProteusIII_Handle_GPIOLocalRead(ProteusIII_Handle_t* handle, uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP);
+extern bool ProteusIII_Handle_GPIORemoteWriteConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t numberOfConfigs);
+extern bool ProteusIII_Handle_GPIORemoteReadConfig(ProteusIII_Handle_t* handle, ProteusIII_GPIOConfigBlock_t* configP, uint16_t* numberOfConfigsP);
+extern bool ProteusIII_Handle_GPIORemoteWrite(ProteusIII_Handle_t* handle, ProteusIII_GPIOControlBlock_t* controlP, uint16_t numberOfControls);
+extern bool ProteusIII_Handle_GPIORemoteRead(ProteusIII_Handle_t* handle, uint8_t* gpioToReadP, uint8_t amountGPIOToRead, ProteusIII_GPIOControlBlock_t* controlP, uint16_t* numberOfControlsP);
+extern bool ProteusIII_Handle_GetBonds(ProteusIII_Handle_t* handle, ProteusIII_BondDatabase_t* bondDatabaseP);
+extern bool ProteusIII_Handle_DeleteBonds(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_DeleteBond(ProteusIII_Handle_t* handle, uint8_t bondId);
+extern bool ProteusIII_Handle_AllowUnbondedConnections(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_FactoryReset(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_Set(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool ProteusIII_Handle_SetAsync(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ProteusIII_AsyncCallback_t cb);
+extern bool ProteusIII_Handle_CheckNSet(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool ProteusIII_Handle_SetDeviceName(ProteusIII_Handle_t* handle, uint8_t* deviceNameP, uint8_t nameLength);
+extern bool ProteusIII_Handle_SetAdvertisingTimeout(ProteusIII_Handle_t* handle, uint16_t advTimeout);
+extern bool ProteusIII_Handle_SetAdvertisingFlags(ProteusIII_Handle_t* handle, ProteusIII_AdvertisingFlags_t advFlags);
+extern bool ProteusIII_Handle_SetScanFlags(ProteusIII_Handle_t* handle, uint8_t scanFlags);
+extern bool ProteusIII_Handle_SetBeaconFlags(ProteusIII_Handle_t* handle, ProteusIII_BeaconFlags_t beaconFlags);
+extern bool ProteusIII_Handle_SetCFGFlags(ProteusIII_Handle_t* handle, uint16_t cfgFlags);
+extern bool ProteusIII_Handle_SetBTMAC(ProteusIII_Handle_t* handle, uint8_t* btMacP);
+extern bool ProteusIII_Handle_SetConnectionTiming(ProteusIII_Handle_t* handle, ProteusIII_ConnectionTiming_t connectionTiming);
+extern bool ProteusIII_Handle_SetScanTiming(ProteusIII_Handle_t* handle, ProteusIII_ScanTiming_t scanTiming);
+extern bool ProteusIII_Handle_SetScanFactor(ProteusIII_Handle_t* handle, uint8_t scanFactor);
+extern bool ProteusIII_Handle_SetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t txPower);
+extern bool ProteusIII_Handle_SetSecFlags(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t secFlags);
+extern bool ProteusIII_Handle_SetSecFlagsPeripheralOnly(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t secFlags);
+extern bool ProteusIII_Handle_SetBaudrateIndex(ProteusIII_Handle_t* handle, ProteusIII_BaudRate_t baudrate, ProteusIII_UartParity_t parity, bool flowControlEnable);
+extern bool ProteusIII_Handle_SetStaticPasskey(ProteusIII_Handle_t* handle, uint8_t* staticPasskeyP);
+extern bool ProteusIII_Handle_SetAppearance(ProteusIII_Handle_t* handle, uint16_t appearance);
+extern bool ProteusIII_Handle_SetSppBaseUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_SetSppServiceUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_SetSppRxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_SetSppTxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_Get(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, uint8_t* responseP, uint16_t* responseLengthP);
+extern bool ProteusIII_Handle_GetAsync(ProteusIII_Handle_t* handle, ProteusIII_UserSettings_t userSetting, ProteusIII_AsyncCallback_t cb);
+extern bool ProteusIII_Handle_GetFWVersion(ProteusIII_Handle_t* handle, uint8_t* versionP);
+extern bool ProteusIII_Handle_GetDeviceInfo(ProteusIII_Handle_t* handle, ProteusIII_DeviceInfo_t* deviceInfoP);
+extern bool ProteusIII_Handle_GetSerialNumber(ProteusIII_Handle_t* handle, uint8_t* serialNumberP);
+extern bool ProteusIII_Handle_GetDeviceName(ProteusIII_Handle_t* handle, uint8_t* deviceNameP, uint16_t* nameLengthP);
+extern bool ProteusIII_Handle_GetMAC(ProteusIII_Handle_t* handle, uint8_t* macP);
+extern bool ProteusIII_Handle_GetBTMAC(ProteusIII_Handle_t* handle, uint8_t* btMacP);
+extern bool ProteusIII_Handle_GetAdvertisingTimeout(ProteusIII_Handle_t* handle, uint16_t* advTimeoutP);
+extern bool ProteusIII_Handle_GetAdvertisingFlags(ProteusIII_Handle_t* handle, ProteusIII_AdvertisingFlags_t* advFlagsP);
+extern bool ProteusIII_Handle_GetScanFlags(ProteusIII_Handle_t* handle, uint8_t* scanFlagsP);
+extern bool ProteusIII_Handle_GetBeaconFlags(ProteusIII_Handle_t* handle, ProteusIII_BeaconFlags_t* beaconFlagsP);
+extern bool ProteusIII_Handle_GetCFGFlags(ProteusIII_Handle_t* handle, uint16_t* cfgFlagsP);
+extern bool ProteusIII_Handle_GetConnectionTiming(ProteusIII_Handle_t* handle, ProteusIII_ConnectionTiming_t* connectionTimingP);
+extern bool ProteusIII_Handle_GetScanTiming(ProteusIII_Handle_t* handle, ProteusIII_ScanTiming_t* scanTimingP);
+extern bool ProteusIII_Handle_GetScanFactor(ProteusIII_Handle_t* handle, uint8_t* scanFactorP);
+extern bool ProteusIII_Handle_GetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t* txPowerP);
+extern bool ProteusIII_Handle_GetSecFlags(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t* secFlagsP);
+extern bool ProteusIII_Handle_GetSecFlagsPeripheralOnly(ProteusIII_Handle_t* handle, ProteusIII_SecFlags_t* secFlagsP);
+extern bool ProteusIII_Handle_GetBaudrateIndex(ProteusIII_Handle_t* handle, ProteusIII_BaudRate_t* baudrateP, ProteusIII_UartParity_t* parityP, bool* flowControlEnableP);
+extern bool ProteusIII_Handle_GetStaticPasskey(ProteusIII_Handle_t* handle, uint8_t* staticPasskeyP);
+extern bool ProteusIII_Handle_GetAppearance(ProteusIII_Handle_t* handle, uint16_t* appearanceP);
+extern bool ProteusIII_Handle_GetSppBaseUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_GetSppServiceUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_GetSppRxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_GetSppTxUuid(ProteusIII_Handle_t* handle, uint8_t* uuidP);
+extern bool ProteusIII_Handle_DTMEnable(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_DTMRun(ProteusIII_Handle_t* handle, ProteusIII_DTMCommand_t command, uint8_t channel_vendoroption, uint8_t length_vendorcmd, uint8_t payload);
+extern bool ProteusIII_Handle_DTMStartTX(ProteusIII_Handle_t* handle, uint8_t channel, uint8_t length, ProteusIII_DTMTXPattern_t pattern);
+extern bool ProteusIII_Handle_DTMStartTXCarrier(ProteusIII_Handle_t* handle, uint8_t channel);
+extern bool ProteusIII_Handle_DTMStop(ProteusIII_Handle_t* handle);
+extern bool ProteusIII_Handle_DTMSetPhy(ProteusIII_Handle_t* handle, ProteusIII_Phy_t phy);
+extern bool ProteusIII_Handle_DTMSetTXPower(ProteusIII_Handle_t* handle, ProteusIII_TXPower_t power);
+extern uint32_t ProteusIII_Handle_GetConfirmationOverflowCount(ProteusIII_Handle_t* handle);
+#if defined(WE_STATS_ENABLED)
+extern bool ProteusIII_Handle_GetStatistics(ProteusIII_Handle_t* handle, WE_Stats_t* statsP);
+extern void ProteusIII_Handle_ResetStatistics(ProteusIII_Handle_t* handle);
+#endif
+/** @} */
+
 #endif // PROTEUSIII_H_INCLUDED
 
 #ifdef __cplusplus
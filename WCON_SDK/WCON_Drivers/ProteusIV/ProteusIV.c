@@ -28,6 +28,7 @@
  */
 
 #include <ProteusIV/ProteusIV.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -172,23 +173,16 @@ typedef enum ProteusIV_CMD_Status_t
     CMD_Status_NotPermitted = (uint8_t)0xFF,
 } ProteusIV_CMD_Status_t;
 
-/**
- * @brief Command confirmation.
- */
-typedef struct
-{
-    uint8_t cmd;                   /**< Variable to check if correct CMD has been confirmed */
-    ProteusIV_CMD_Status_t status; /**< Variable used to check the response (*_CNF), when a request (*_REQ) was sent to the Proteus-IV */
-} ProteusIV_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
 static ProteusIV_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
 static ProteusIV_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
 
-#define CMDCONFIRMATIONARRAY_LENGTH 10
-static ProteusIV_CMD_Confirmation_t cmdConfirmationArray[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see ProteusIV_GetStatistics()) */
+#endif
 static ProteusIV_OperationMode_t operationMode = ProteusIV_OperationMode_CommandMode;
 static ProteusIV_ScanResult_t* ProteusIV_ScanDevicesP = NULL;
 static ProteusIV_ConnectedDevices_t* ProteusIV_ConnectedDevicesP = NULL;
@@ -208,9 +202,7 @@ static WE_UART_t* ProteusIV_uartP = NULL;
 
 static ProteusIV_CallbackConfig_t callbacks;
 static WE_UART_HandleRxByte_t byteRxCallback = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(ProteusIV_CMD_Frame_t)]; /* For UART RX from module */
 
 /**************************************
@@ -230,450 +222,360 @@ static void ResetConnectionList()
 
 static void ClearReceiveBuffers()
 {
-    bytesToReceive = 0;
-    rxByteCounter = 0;
-    checksum = 0;
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmationArray[i].cmd = CNFINVALID;
-    }
+    CMDFrame_Parser_Reset(&rxParser);
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 }
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+static void HandleConnectionInfoCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ProteusIV_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
-
-    uint16_t cmdLength = ((ProteusIV_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
-
-    switch (rxPacket.Cmd)
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+    if ((confirmation->status == CMD_Status_Success) && (ProteusIV_ConnectedDevicesP != NULL))
     {
-        case PROTEUSIV_CMD_CONNECTIONINFO_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            if ((cmdConfirmation.status == CMD_Status_Success) && (ProteusIV_ConnectedDevicesP != NULL))
-            {
-                uint8_t size = rxPacket.Data[1];
-                if (size >= PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
-                {
-                    size = PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES;
-                }
-                ProteusIV_ConnectedDevicesP->numberOfDevices = size;
-
-                uint16_t len = 2;
-                for (uint8_t i = 0; i < ProteusIV_ConnectedDevicesP->numberOfDevices; i++)
-                {
-                    ProteusIV_ConnectedDevicesP->devices[i].conn_ID = rxPacket.Data[len];
-                    ProteusIV_ConnectedDevicesP->devices[i].addr_type = rxPacket.Data[len + 1];
-                    memcpy(&ProteusIV_ConnectedDevicesP->devices[i].btMac[0], &rxPacket.Data[len + 2], PROTEUSIV_BTMAC_LENGTH);
-                    ProteusIV_ConnectedDevicesP->devices[i].is_linkopen = (rxPacket.Data[len + 8] == 0x01);
-                    memcpy(&ProteusIV_ConnectedDevicesP->devices[i].max_payload, &rxPacket.Data[len + 9], 2);
-                    memcpy(&ProteusIV_ConnectedDevicesP->devices[i].connection_interval, &rxPacket.Data[len + 11], 2);
-                    ProteusIV_ConnectedDevicesP->devices[i].phy_rx = rxPacket.Data[len + 13];
-                    ProteusIV_ConnectedDevicesP->devices[i].phy_tx = rxPacket.Data[len + 14];
-                    len += 15;
-                }
-            }
-            break;
-        }
-        case PROTEUSIV_CMD_GETBONDS_CNF:
+        uint8_t size = frame->data[1];
+        if (size >= PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            if ((cmdConfirmation.status == CMD_Status_Success) && (ProteusIV_BondDatabaseP != NULL))
-            {
-                uint8_t size = rxPacket.Data[1];
-                if (size >= PROTEUSIV_MAX_BOND_DEVICES)
-                {
-                    size = PROTEUSIV_MAX_BOND_DEVICES;
-                }
-                ProteusIV_BondDatabaseP->numberOfDevices = size;
-
-                uint16_t len = 2;
-                for (uint8_t i = 0; i < ProteusIV_BondDatabaseP->numberOfDevices; i++)
-                {
-                    ProteusIV_BondDatabaseP->devices[i].addr_type = rxPacket.Data[len];
-                    memcpy(&ProteusIV_BondDatabaseP->devices[i].btMac[0], &rxPacket.Data[len + 1], PROTEUSIV_BTMAC_LENGTH);
-                    len += (1 + PROTEUSIV_BTMAC_LENGTH);
-                }
-            }
-            break;
+            size = PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES;
         }
+        ProteusIV_ConnectedDevicesP->numberOfDevices = size;
 
-        case PROTEUSIV_CMD_RESET_CNF:
-        case PROTEUSIV_CMD_SCAN_CNF:
-        case PROTEUSIV_CMD_ADVERTISING_CNF:
-        case PROTEUSIV_CMD_GET_CNF:
-        case PROTEUSIV_CMD_SET_CNF:
-        case PROTEUSIV_CMD_GETRAM_CNF:
-        case PROTEUSIV_CMD_SETRAM_CNF:
-        case PROTEUSIV_CMD_PASSKEY_CNF:
-        case PROTEUSIV_CMD_PHYUPDATE_CNF:
-        case PROTEUSIV_CMD_CONNECT_CNF:
-        case PROTEUSIV_CMD_DATA_CNF:
-        case PROTEUSIV_CMD_DISCONNECT_CNF:
-        case PROTEUSIV_CMD_DELETEBONDS_CNF:
-        case PROTEUSIV_CMD_FACTORYRESET_CNF:
-        case PROTEUSIV_CMD_SLEEP_CNF:
-        case PROTEUSIV_CMD_TXCOMPLETE_RSP:
-        case PROTEUSIV_CMD_NUMERIC_COMP_CNF:
-        case PROTEUSIV_CMD_GETSTATE_CNF:
-        case PROTEUSIV_CMD_UARTDISABLE_CNF:
-        case PROTEUSIV_CMD_UARTENABLE_IND:
+        uint16_t len = 2;
+        for (uint8_t i = 0; i < ProteusIV_ConnectedDevicesP->numberOfDevices; i++)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            break;
+            ProteusIV_ConnectedDevicesP->devices[i].conn_ID = frame->data[len];
+            ProteusIV_ConnectedDevicesP->devices[i].addr_type = frame->data[len + 1];
+            memcpy(&ProteusIV_ConnectedDevicesP->devices[i].btMac[0], &frame->data[len + 2], PROTEUSIV_BTMAC_LENGTH);
+            ProteusIV_ConnectedDevicesP->devices[i].is_linkopen = (frame->data[len + 8] == 0x01);
+            memcpy(&ProteusIV_ConnectedDevicesP->devices[i].max_payload, &frame->data[len + 9], 2);
+            memcpy(&ProteusIV_ConnectedDevicesP->devices[i].connection_interval, &frame->data[len + 11], 2);
+            ProteusIV_ConnectedDevicesP->devices[i].phy_rx = frame->data[len + 13];
+            ProteusIV_ConnectedDevicesP->devices[i].phy_tx = frame->data[len + 14];
+            len += 15;
         }
+    }
+}
 
-        case PROTEUSIV_CMD_STARTUP_IND:
+static void HandleGetBondsCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+    if ((confirmation->status == CMD_Status_Success) && (ProteusIV_BondDatabaseP != NULL))
+    {
+        uint8_t size = frame->data[1];
+        if (size >= PROTEUSIV_MAX_BOND_DEVICES)
         {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = CMD_Status_Success;
-
-            ResetConnectionList();
-            break;
+            size = PROTEUSIV_MAX_BOND_DEVICES;
         }
+        ProteusIV_BondDatabaseP->numberOfDevices = size;
 
-        case PROTEUSIV_CMD_LINKOPEN_RSP:
+        uint16_t len = 2;
+        for (uint8_t i = 0; i < ProteusIV_BondDatabaseP->numberOfDevices; i++)
         {
-            uint8_t conn_ID = rxPacket.Data[0];
-            bool link_open = (rxPacket.Data[1] == 0x01);
+            ProteusIV_BondDatabaseP->devices[i].addr_type = frame->data[len];
+            memcpy(&ProteusIV_BondDatabaseP->devices[i].btMac[0], &frame->data[len + 1], PROTEUSIV_BTMAC_LENGTH);
+            len += (1 + PROTEUSIV_BTMAC_LENGTH);
+        }
+    }
+}
 
-            if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
-            {
-                ProteusIV_connection_list[conn_ID].is_linkopen = link_open;
-            }
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
 
-            /* Payload of LINKOPEN_RSP: conn_ID, enabled/disabled */
-            if (callbacks.linkOpenCb != NULL)
-            {
-                callbacks.linkOpenCb(conn_ID, link_open);
-            }
-            break;
-        }
+static void HandleStartupInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = CMD_Status_Success;
 
-        case PROTEUSIV_CMD_CONNECT_IND:
-        {
-            uint8_t conn_ID = rxPacket.Data[0];
+    ResetConnectionList();
+}
 
-            if ((conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES) && (conn_ID != PROTEUSIV_MULTICONN_INVALID_ID))
-            {
-                ProteusIV_connection_list[conn_ID].is_connected = true;
-            }
+static void HandleLinkOpenRsp(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    uint8_t conn_ID = frame->data[0];
+    bool link_open = (frame->data[1] == 0x01);
 
-            if (callbacks.connectCb != NULL)
-            {
-                callbacks.connectCb(conn_ID, rxPacket.Data[1] == 0x00, rxPacket.Data[2], &rxPacket.Data[3]);
-            }
-            break;
-        }
+    if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
+    {
+        ProteusIV_connection_list[conn_ID].is_linkopen = link_open;
+    }
 
-        case PROTEUSIV_CMD_MAXPAYLOAD_IND:
-        {
-            uint8_t conn_ID = rxPacket.Data[0];
+    /* Payload of LINKOPEN_RSP: conn_ID, enabled/disabled */
+    if (callbacks.linkOpenCb != NULL)
+    {
+        callbacks.linkOpenCb(conn_ID, link_open);
+    }
+}
 
-            uint16_t max_payload = rxPacket.Data[2] << 8;
-            max_payload |= rxPacket.Data[1];
+static void HandleConnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    uint8_t conn_ID = frame->data[0];
 
-            if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
-            {
-                ProteusIV_connection_list[conn_ID].max_payload = max_payload;
-            }
+    if ((conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES) && (conn_ID != PROTEUSIV_MULTICONN_INVALID_ID))
+    {
+        ProteusIV_connection_list[conn_ID].is_connected = true;
+    }
 
-            if (callbacks.maxPayloadCb != NULL)
-            {
-                callbacks.maxPayloadCb(conn_ID, max_payload);
-            }
-            break;
-        }
+    if (callbacks.connectCb != NULL)
+    {
+        callbacks.connectCb(conn_ID, frame->data[1] == 0x00, frame->data[2], &frame->data[3]);
+    }
+}
 
-        case PROTEUSIV_CMD_DISCONNECT_IND:
-        {
-            uint8_t conn_ID = rxPacket.Data[0];
+static void HandleMaxPayloadInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    uint8_t conn_ID = frame->data[0];
 
-            if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
-            {
-                ProteusIV_connection_list[conn_ID].is_connected = false;
-                ProteusIV_connection_list[conn_ID].is_linkopen = false;
-                ProteusIV_connection_list[conn_ID].max_payload = 0;
-            }
+    uint16_t max_payload = frame->data[2] << 8;
+    max_payload |= frame->data[1];
 
-            if (callbacks.disconnectCb != NULL)
-            {
-                ProteusIV_DisconnectReason_t reason = ProteusIV_DisconnectReason_Unknown;
-                switch (rxPacket.Data[1])
-                {
-                    case 0x08:
-                        reason = ProteusIV_DisconnectReason_ConnectionTimeout;
-                        break;
-
-                    case 0x13:
-                        reason = ProteusIV_DisconnectReason_UserTerminatedConnection;
-                        break;
-
-                    case 0x16:
-                        reason = ProteusIV_DisconnectReason_HostTerminatedConnection;
-                        break;
-
-                    case 0x3B:
-                        reason = ProteusIV_DisconnectReason_ConnectionIntervalUnacceptable;
-                        break;
-
-                    case 0x3D:
-                        reason = ProteusIV_DisconnectReason_MicFailure;
-                        break;
-
-                    case 0x3E:
-                        reason = ProteusIV_DisconnectReason_ConnectionSetupFailed;
-                        break;
-                    default:
-                        break;
-                }
-                callbacks.disconnectCb(conn_ID, reason);
-            }
-            break;
-        }
+    if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
+    {
+        ProteusIV_connection_list[conn_ID].max_payload = max_payload;
+    }
 
-        case PROTEUSIV_CMD_DATA_IND:
-        {
-            if (callbacks.rxCb != NULL)
-            {
-                callbacks.rxCb(rxPacket.Data[0], &rxPacket.Data[2], rxPacket.Length - 2, rxPacket.Data[1]);
-            }
-            break;
-        }
+    if (callbacks.maxPayloadCb != NULL)
+    {
+        callbacks.maxPayloadCb(conn_ID, max_payload);
+    }
+}
 
-        case PROTEUSIV_CMD_SECURITY_IND:
-        {
-            if (callbacks.securityCb != NULL)
-            {
-                ProteusIV_SecurityState_t sec;
-                sec.success = rxPacket.Data[1];
-                sec.level = rxPacket.Data[2];
-                callbacks.securityCb(rxPacket.Data[0], sec);
-            }
-            break;
-        }
+static void HandleDisconnectInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    uint8_t conn_ID = frame->data[0];
 
-        case PROTEUSIV_CMD_PASSKEY_IND:
-        {
-            if (callbacks.passkeyCb != NULL)
-            {
-                callbacks.passkeyCb(rxPacket.Data[0]);
-            }
-            break;
-        }
+    if (conn_ID < PROTEUSIV_MAX_NUMBER_OF_CONNECTEDDEVICES)
+    {
+        ProteusIV_connection_list[conn_ID].is_connected = false;
+        ProteusIV_connection_list[conn_ID].is_linkopen = false;
+        ProteusIV_connection_list[conn_ID].max_payload = 0;
+    }
 
-        case PROTEUSIV_CMD_DISPLAY_PASSKEY_IND:
+    if (callbacks.disconnectCb != NULL)
+    {
+        ProteusIV_DisconnectReason_t reason = ProteusIV_DisconnectReason_Unknown;
+        switch (frame->data[1])
         {
-            if (callbacks.displayPasskeyCb != NULL)
-            {
-                callbacks.displayPasskeyCb(rxPacket.Data[0], (ProteusIV_DisplayPasskeyAction_t)rxPacket.Data[1], &rxPacket.Data[2]);
-            }
-            break;
-        }
+            case 0x08:
+                reason = ProteusIV_DisconnectReason_ConnectionTimeout;
+                break;
 
-        case PROTEUSIV_CMD_PHYUPDATE_IND:
-        {
-            if (callbacks.phyUpdateCb != NULL)
-            {
-                callbacks.phyUpdateCb(rxPacket.Data[0], (ProteusIV_Phy_t)rxPacket.Data[1], (ProteusIV_Phy_t)rxPacket.Data[2]);
-            }
-            break;
-        }
+            case 0x13:
+                reason = ProteusIV_DisconnectReason_UserTerminatedConnection;
+                break;
 
-        case PROTEUSIV_CMD_SCAN_IND:
-        {
-            uint8_t* typeP = &rxPacket.Data[0];
-            uint8_t* MacP = &rxPacket.Data[1];
-            int8_t* RssiP = (int8_t*)&rxPacket.Data[7];
-            uint8_t* NameLenP = &rxPacket.Data[8];
-            char* NameP = (char*)&rxPacket.Data[9];
+            case 0x16:
+                reason = ProteusIV_DisconnectReason_HostTerminatedConnection;
+                break;
 
-            if (*NameLenP > PROTEUSIV_DEVICENAME_LENGTH)
-            {
-                /* error */
-                *NameLenP = PROTEUSIV_DEVICENAME_LENGTH;
-            }
-            *(NameP + *NameLenP) = '\0';
+            case 0x3B:
+                reason = ProteusIV_DisconnectReason_ConnectionIntervalUnacceptable;
+                break;
 
-            if (ProteusIV_ScanDevicesP != NULL)
-            {
-                bool updated_entry = false;
-                for (int i = 0; i < PROTEUSIV_MAX_NUMBER_OF_SCANDEVICES; i++)
-                {
-                    if (ProteusIV_ScanDevicesP->devices[i].inUse && (0 == memcmp(ProteusIV_ScanDevicesP->devices[i].btMac, MacP, PROTEUSIV_BTMAC_LENGTH)))
-                    {
-                        /* update entry */
-                        ProteusIV_ScanDevicesP->devices[i].rssi = *RssiP;
-                        updated_entry = true;
-                        break;
-                    }
-                }
-                if (!updated_entry)
-                {
-                    for (int i = 0; i < PROTEUSIV_MAX_NUMBER_OF_SCANDEVICES; i++)
-                    {
-                        if (false == ProteusIV_ScanDevicesP->devices[i].inUse)
-                        {
-                            /* add new entry */
-                            ProteusIV_ScanDevicesP->devices[i].inUse = true;
-                            ProteusIV_ScanDevicesP->devices[i].rssi = *RssiP;
-                            ProteusIV_ScanDevicesP->devices[i].addr_type = *typeP;
-                            memcpy(ProteusIV_ScanDevicesP->devices[i].btMac, MacP, PROTEUSIV_BTMAC_LENGTH);
-                            memcpy(ProteusIV_ScanDevicesP->devices[i].deviceName, NameP, *NameLenP + 1);
-                            break;
-                        }
-                    }
-                }
-            }
+            case 0x3D:
+                reason = ProteusIV_DisconnectReason_MicFailure;
+                break;
 
-            if (callbacks.scanCb != NULL)
-            {
-                callbacks.scanCb(*typeP, MacP, *RssiP, NameP);
-            }
-            break;
+            case 0x3E:
+                reason = ProteusIV_DisconnectReason_ConnectionSetupFailed;
+                break;
+            default:
+                break;
         }
+        callbacks.disconnectCb(conn_ID, reason);
+    }
+}
 
-        default:
-        {
-            /* invalid*/
-            break;
-        }
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.rxCb != NULL)
+    {
+        callbacks.rxCb(frame->data[0], &frame->data[2], frame->length - 2, frame->data[1]);
     }
+}
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+static void HandleSecurityInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.securityCb != NULL)
     {
-        if (cmdConfirmationArray[i].cmd == CNFINVALID)
-        {
-            cmdConfirmationArray[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmationArray[i].status = cmdConfirmation.status;
-            break;
-        }
+        ProteusIV_SecurityState_t sec;
+        sec.success = frame->data[1];
+        sec.level = frame->data[2];
+        callbacks.securityCb(frame->data[0], sec);
     }
 }
 
-static void ProteusIV_HandleRxByte(uint8_t* dataP, size_t size)
+static void HandlePasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.passkeyCb != NULL)
+    {
+        callbacks.passkeyCb(frame->data[0]);
+    }
+}
+
+static void HandleDisplayPasskeyInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    for (; size > 0; size--, dataP++)
+    if (callbacks.displayPasskeyCb != NULL)
+    {
+        callbacks.displayPasskeyCb(frame->data[0], (ProteusIV_DisplayPasskeyAction_t)frame->data[1], &frame->data[2]);
+    }
+}
+
+static void HandlePhyUpdateInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (callbacks.phyUpdateCb != NULL)
+    {
+        callbacks.phyUpdateCb(frame->data[0], (ProteusIV_Phy_t)frame->data[1], (ProteusIV_Phy_t)frame->data[2]);
+    }
+}
+
+static void HandleScanInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    uint8_t* typeP = &frame->data[0];
+    uint8_t* MacP = &frame->data[1];
+    int8_t* RssiP = (int8_t*)&frame->data[7];
+    uint8_t* NameLenP = &frame->data[8];
+    char* NameP = (char*)&frame->data[9];
+
+    if (*NameLenP > PROTEUSIV_DEVICENAME_LENGTH)
+    {
+        /* error */
+        *NameLenP = PROTEUSIV_DEVICENAME_LENGTH;
+    }
+    *(NameP + *NameLenP) = '\0';
+
+    if (ProteusIV_ScanDevicesP != NULL)
     {
-        if (rxByteCounter < sizeof(rxBuffer))
+        bool updated_entry = false;
+        for (int i = 0; i < PROTEUSIV_MAX_NUMBER_OF_SCANDEVICES; i++)
         {
-            rxBuffer[rxByteCounter] = *dataP;
+            if (ProteusIV_ScanDevicesP->devices[i].inUse && (0 == memcmp(ProteusIV_ScanDevicesP->devices[i].btMac, MacP, PROTEUSIV_BTMAC_LENGTH)))
+            {
+                /* update entry */
+                ProteusIV_ScanDevicesP->devices[i].rssi = *RssiP;
+                updated_entry = true;
+                break;
+            }
         }
-
-        switch (rxByteCounter)
+        if (!updated_entry)
         {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
+            for (int i = 0; i < PROTEUSIV_MAX_NUMBER_OF_SCANDEVICES; i++)
+            {
+                if (false == ProteusIV_ScanDevicesP->devices[i].inUse)
                 {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
+                    /* add new entry */
+                    ProteusIV_ScanDevicesP->devices[i].inUse = true;
+                    ProteusIV_ScanDevicesP->devices[i].rssi = *RssiP;
+                    ProteusIV_ScanDevicesP->devices[i].addr_type = *typeP;
+                    memcpy(ProteusIV_ScanDevicesP->devices[i].btMac, MacP, PROTEUSIV_BTMAC_LENGTH);
+                    memcpy(ProteusIV_ScanDevicesP->devices[i].deviceName, NameP, *NameLenP + 1);
+                    break;
                 }
-                break;
+            }
+        }
+    }
 
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
+    if (callbacks.scanCb != NULL)
+    {
+        callbacks.scanCb(*typeP, MacP, *RssiP, NameP);
+    }
+}
 
-            case 2:
-                /* length field lsb */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [PROTEUSIV_CMD_CONNECTIONINFO_CNF]  = HandleConnectionInfoCnf,
+    [PROTEUSIV_CMD_GETBONDS_CNF]        = HandleGetBondsCnf,
+    [PROTEUSIV_CMD_RESET_CNF]           = HandleStatusCnf,
+    [PROTEUSIV_CMD_SCAN_CNF]            = HandleStatusCnf,
+    [PROTEUSIV_CMD_ADVERTISING_CNF]     = HandleStatusCnf,
+    [PROTEUSIV_CMD_GET_CNF]             = HandleStatusCnf,
+    [PROTEUSIV_CMD_SET_CNF]             = HandleStatusCnf,
+    [PROTEUSIV_CMD_GETRAM_CNF]          = HandleStatusCnf,
+    [PROTEUSIV_CMD_SETRAM_CNF]          = HandleStatusCnf,
+    [PROTEUSIV_CMD_PASSKEY_CNF]         = HandleStatusCnf,
+    [PROTEUSIV_CMD_PHYUPDATE_CNF]       = HandleStatusCnf,
+    [PROTEUSIV_CMD_CONNECT_CNF]         = HandleStatusCnf,
+    [PROTEUSIV_CMD_DATA_CNF]            = HandleStatusCnf,
+    [PROTEUSIV_CMD_DISCONNECT_CNF]      = HandleStatusCnf,
+    [PROTEUSIV_CMD_DELETEBONDS_CNF]     = HandleStatusCnf,
+    [PROTEUSIV_CMD_FACTORYRESET_CNF]    = HandleStatusCnf,
+    [PROTEUSIV_CMD_SLEEP_CNF]           = HandleStatusCnf,
+    [PROTEUSIV_CMD_TXCOMPLETE_RSP]      = HandleStatusCnf,
+    [PROTEUSIV_CMD_NUMERIC_COMP_CNF]    = HandleStatusCnf,
+    [PROTEUSIV_CMD_GETSTATE_CNF]        = HandleStatusCnf,
+    [PROTEUSIV_CMD_UARTDISABLE_CNF]     = HandleStatusCnf,
+    [PROTEUSIV_CMD_UARTENABLE_IND]      = HandleStatusCnf,
+    [PROTEUSIV_CMD_STARTUP_IND]         = HandleStartupInd,
+    [PROTEUSIV_CMD_LINKOPEN_RSP]        = HandleLinkOpenRsp,
+    [PROTEUSIV_CMD_CONNECT_IND]         = HandleConnectInd,
+    [PROTEUSIV_CMD_MAXPAYLOAD_IND]      = HandleMaxPayloadInd,
+    [PROTEUSIV_CMD_DISCONNECT_IND]      = HandleDisconnectInd,
+    [PROTEUSIV_CMD_DATA_IND]            = HandleDataInd,
+    [PROTEUSIV_CMD_SECURITY_IND]        = HandleSecurityInd,
+    [PROTEUSIV_CMD_PASSKEY_IND]         = HandlePasskeyInd,
+    [PROTEUSIV_CMD_DISPLAY_PASSKEY_IND] = HandleDisplayPasskeyInd,
+    [PROTEUSIV_CMD_PHYUPDATE_IND]       = HandlePhyUpdateInd,
+    [PROTEUSIV_CMD_SCAN_IND]            = HandleScanInd,
+};
 
-            case 3:
-                /* length field msb */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if (cmdConfirmation.cmd != CNFINVALID)
+    {
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
+static void ProteusIV_HandleRxByte(uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
+}
+
 /**
  * @brief Function that waits for the return value of Proteus-IV (*_CNF),
  * when a command (*_REQ) was sent before.
  */
 static ProteusIV_CMD_Status_t Wait4CNF(uint32_t maxTimeMs, uint8_t expectedCmdConfirmation, bool resetConfirmState)
 {
-    int count = 0;
-    int timeStepMs = 5; /* 5ms */
-    int maxCount = maxTimeMs / timeStepMs;
-
     if (resetConfirmState)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmationArray[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmationArray[i].cmd)
-            {
-                return cmdConfirmationArray[i].status;
-            }
-        }
 
-        if (count >= maxCount)
-        {
-            /* received no correct response within timeout */
-            return CMD_Status_Invalid;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(timeStepMs);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, maxTimeMs, &status))
+    {
+        /* received no correct response within timeout */
+        return CMD_Status_Invalid;
     }
-
-    /* we should never come to this place */
-    return CMD_Status_Invalid;
+    return (ProteusIV_CMD_Status_t)status;
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static bool FillChecksum(ProteusIV_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
     return true;
 }
 
@@ -683,6 +585,8 @@ bool ProteusIV_Internal_Transmit(const uint8_t* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return ProteusIV_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -793,6 +697,13 @@ bool ProteusIV_Init(WE_UART_t* uartP, ProteusIV_Pins_t* pinoutP, ProteusIV_Opera
         return false;
     }
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     ProteusIV_uartP = uartP;
     if (false == ProteusIV_uartP->uartInit(ProteusIV_uartP->baudrate, ProteusIV_uartP->flowControl, ProteusIV_uartP->parity, &byteRxCallback))
     {
@@ -1173,6 +1084,7 @@ bool ProteusIV_Get(ProteusIV_UserSettings_t userSetting, uint8_t* responseP, uin
     txPacket.Length = 1;
     txPacket.Data[0] = userSetting;
 
+    ExpectResponse(PROTEUSIV_CMD_GET_CNF);
     FillChecksum(&txPacket);
     if (!ProteusIV_Internal_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1441,6 +1353,7 @@ bool ProteusIV_GetRAM(ProteusIV_RuntimeSettings_t runtimeSetting, uint8_t* respo
     txPacket.Length = 1;
     txPacket.Data[0] = runtimeSetting;
 
+    ExpectResponse(PROTEUSIV_CMD_GETRAM_CNF);
     FillChecksum(&txPacket);
     if (!ProteusIV_Internal_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1505,6 +1418,7 @@ bool ProteusIV_GetState(ProteusIV_ModuleState_t* moduleStateP)
     txPacket.Cmd = PROTEUSIV_CMD_GETSTATE_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(PROTEUSIV_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
     if (!ProteusIV_Internal_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
@@ -1813,3 +1727,11 @@ bool ProteusIV_DeleteBond(ProteusIV_Bluetooth_Address_Type_t type, uint8_t* btMa
 
     return CMD_Status_Success == Wait4CNF(CMD_WAIT_TIME, PROTEUSIV_CMD_DELETEBONDS_CNF, true);
 }
+
+uint32_t ProteusIV_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ProteusIV_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, ProteusIV_uartP, statsP); }
+
+void ProteusIV_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
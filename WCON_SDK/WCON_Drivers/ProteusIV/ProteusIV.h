@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -1343,6 +1344,31 @@ extern bool ProteusIV_SetRAMAdvertisingData(uint8_t* dataP, uint16_t length);
  */
 extern bool ProteusIV_SetRAMScanResponseData(uint8_t* dataP, uint16_t length);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ProteusIV_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ProteusIV_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ProteusIV_ResetStatistics();
+#endif
+
 #endif // PROTEUSIV_H_INCLUDED
 
 #ifdef __cplusplus
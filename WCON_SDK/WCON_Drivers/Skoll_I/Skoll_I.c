@@ -33,8 +33,6 @@
 #include <stdio.h>
 #include <string.h>
 
-#define CMD_WAIT_TIME_STEP_MS 0
-
 /**
  * @brief Byte handler to be passed to the UART peripheral
  */
@@ -63,6 +61,7 @@ typedef struct
 } Skoll_I_ReceiveBuffer_t;
 
 static Skoll_I_ReceiveBuffer_t receiveBuffer[2];
+static WE_Event_t receiveEvent = {0}; /* is signaled when a packet has been stored in receiveBuffer */
 static ezs_packet_type_t expectedResponseType = EZS_PACKET_TYPE_ANY;
 
 /**
@@ -102,6 +101,7 @@ static void internal_ezsHandler(ezs_packet_t* packetP)
             {
                 memcpy(&receiveBuffer[i].packet, packetP, sizeof(ezs_packet_t));
                 receiveBuffer[i].isInUse = true;
+                WE_SignalEvent(&receiveEvent);
             }
         }
     }
@@ -241,11 +241,8 @@ ezs_packet_t* Skoll_I_Wait4CNF(ezs_packet_type_t type, uint32_t max_time_ms)
             return NULL;
         }
 
-        if (CMD_WAIT_TIME_STEP_MS > 0)
-        {
-            /* wait */
-            WE_Delay(CMD_WAIT_TIME_STEP_MS);
-        }
+        /* wait (returns as soon as a packet has been received) */
+        WE_WaitEvent(&receiveEvent, max_time_ms - (now - t0) + 1);
     }
     return NULL;
 }
@@ -35,14 +35,15 @@
 bool StephanoI_ATSocket_SetEnableIPv6(bool enable)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPV6=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPV6=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -72,14 +73,15 @@ bool StephanoI_ATSocket_GetEnableIPv6(bool* enable)
 bool StephanoI_ATSocket_SetMultiple(bool multiple)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPMUX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPMUX=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, multiple ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, multiple ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -110,13 +112,14 @@ bool StephanoI_ATSocket_GetMultiple(bool* multipleP)
 bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID, StephanoI_ATSocket_Type_t type, char* remote_IP, uint32_t remote_port)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSTART=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSTART=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -125,7 +128,7 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
     {
         case StephanoI_ATSocket_Type_TCP:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCP", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -133,7 +136,7 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
         break;
         case StephanoI_ATSocket_Type_TCPv6:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -146,15 +149,15 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -169,13 +172,14 @@ bool StephanoI_ATSocket_OpenTCPSocket(bool multiple_connections, uint8_t link_ID
 bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID, StephanoI_ATSocket_Type_t type, char* remote_IP, uint32_t remote_port, uint32_t local_port)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSTART=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSTART=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
@@ -184,7 +188,7 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
     {
         case StephanoI_ATSocket_Type_UDP:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "UDP", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -192,7 +196,7 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
         break;
         case StephanoI_ATSocket_Type_UDPv6:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -205,19 +209,19 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, local_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, local_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -232,14 +236,15 @@ bool StephanoI_ATSocket_OpenUDPSocket(bool multiple_connections, uint8_t link_ID
 bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remote_IP, uint32_t remote_port)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSTARTEX=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSTARTEX=");
 
     switch (type)
     {
         case StephanoI_ATSocket_Type_TCP:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCP", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -247,7 +252,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remot
         break;
         case StephanoI_ATSocket_Type_TCPv6:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -255,7 +260,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remot
         break;
         case StephanoI_ATSocket_Type_UDP:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDP", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "UDP", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -263,7 +268,7 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remot
         break;
         case StephanoI_ATSocket_Type_UDPv6:
         {
-            if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
+            if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "UDPv6", ATCOMMAND_ARGUMENT_DELIM))
             {
                 return false;
             }
@@ -274,15 +279,15 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remot
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, remote_IP, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -297,25 +302,26 @@ bool StephanoI_ATSocket_OpenSocketEx(StephanoI_ATSocket_Type_t type, char* remot
 bool StephanoI_ATSocket_CloseSocket(bool multiple_connections, uint8_t link_ID)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPCLOSE=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPCLOSE=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        strcpy(pRequestCommand, "AT+CIPCLOSE=");
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPCLOSE=");
+        if (!ATCommand_Builder_AppendInt(&builder, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
     else
     {
-        strcpy(pRequestCommand, "AT+CIPCLOSE\r\n");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPCLOSE\r\n");
     }
 
     if (!StephanoI_SendRequest(pRequestCommand))
@@ -344,14 +350,15 @@ bool StephanoI_ATSocket_Ping(char* host, StephanoI_ATSocket_Ping_t* t)
 {
     char responsebuffer[16];
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+PING=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+PING=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, host, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, host, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -373,14 +380,15 @@ bool StephanoI_ATSocket_ResolveDomain(char* domain_name, StephanoI_ATSocket_Doma
 {
     char responsebuffer[64];
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPDOMAIN=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPDOMAIN=");
 
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, domain_name, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, domain_name, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -400,41 +408,42 @@ bool StephanoI_ATSocket_ResolveDomain(char* domain_name, StephanoI_ATSocket_Doma
 bool StephanoI_ATSocket_Send(bool multiple_connections, uint8_t link_id, char* remote_host, uint32_t remote_port, uint8_t* data, uint32_t length)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
     if (length > 8192)
     {
-        strcpy(pRequestCommand, "AT+CIPSENDL=");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSENDL=");
     }
     else
     {
-        strcpy(pRequestCommand, "AT+CIPSEND=");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSEND=");
     }
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, link_id, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, link_id, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), (remote_host != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, length, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), (remote_host != NULL) ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
     if (remote_host != NULL)
     {
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, remote_host, ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, remote_host, ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, remote_port, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -458,18 +467,19 @@ bool StephanoI_ATSocket_Send(bool multiple_connections, uint8_t link_id, char* r
 bool StephanoI_ATSocket_SendConfiguration(uint32_t report_size, uint32_t transmit_size)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSENDLCFG=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSENDLCFG=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, report_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, report_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, transmit_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, transmit_size, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -490,14 +500,15 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
     }
 
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSERVER=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSERVER=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, mode ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, mode ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, param2, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), mode ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, param2, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), mode ? ATCOMMAND_ARGUMENT_DELIM : ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -507,7 +518,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
         {
             case StephanoI_ATSocket_Type_TCP:
             {
-                if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCP", ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCP", ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -515,7 +526,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
             break;
             case StephanoI_ATSocket_Type_TCPv6:
             {
-                if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "TCPv6", ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -523,7 +534,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
             break;
             case StephanoI_ATSocket_Type_SSL:
             {
-                if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "SSL", ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "SSL", ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -531,7 +542,7 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
             break;
             case StephanoI_ATSocket_Type_SSLv6:
             {
-                if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, "SSLv6", ATCOMMAND_ARGUMENT_DELIM))
+                if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, "SSLv6", ATCOMMAND_ARGUMENT_DELIM))
                 {
                     return false;
                 }
@@ -542,12 +553,12 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
                 return false;
             }
         }
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, CA_enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, CA_enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -562,14 +573,15 @@ bool StephanoI_ATSocket_EnableTCPSSLServer(bool multiple_connections, bool mode,
 bool StephanoI_ATSocket_SetTCPSSLServerMaxConnections(uint8_t max_num)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSERVERMAXCONN=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSERVERMAXCONN=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, max_num, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, max_num, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -601,14 +613,15 @@ bool StephanoI_ATSocket_GetTCPSSLServerMaxConnections(uint8_t* max_num)
 bool StephanoI_ATSocket_SetTCPSSLServerTimeout(uint16_t time)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSTO=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSTO=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -640,22 +653,23 @@ bool StephanoI_ATSocket_GetTCPSSLServerTimeout(uint16_t* time)
 bool StephanoI_ATSocket_EnableSNTPServer(bool enable, StephanoI_ATSocket_TimeZone_t timezone, char* server1)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSNTPCFG=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSNTPCFG=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, enable ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, (int32_t)timezone, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, (int32_t)timezone, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_SIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, server1, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, server1, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -687,14 +701,15 @@ bool StephanoI_ATSocket_ReadSNTPTime(StephanoI_ATSocket_SNTP_Time_t* t)
 bool StephanoI_ATSocket_SetSNTPTimeInterval(uint32_t time)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSNTPINTV=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSNTPINTV=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, time, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -724,41 +739,42 @@ bool StephanoI_ATSocket_GetSNTPTimeInterval(uint32_t* time)
 bool StephanoI_ATSocket_SetSSLClient(bool multiple_connections, StephanoI_ATSocket_SSLClient_t client)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSSLCCONF=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSSLCCONF=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, client.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, client.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
     if (client.auth_mode == StephanoI_ATSocket_SSLAuthMode_NoAuth)
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t)client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, (uint32_t)client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
     else
     {
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t)client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, (uint32_t)client.auth_mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, client.pki_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, client.pki_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, client.ca_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendInt(&builder, client.ca_number, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
 
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -782,22 +798,23 @@ bool StephanoI_ATSocket_GetSSLClient()
 bool StephanoI_ATSocket_SetSSLClientName(bool multiple_connections, StephanoI_ATSocket_SSLClientName_t name)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSSLCCN=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSSLCCN=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, name.common_name, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, name.common_name, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -827,22 +844,23 @@ bool StephanoI_ATSocket_GetSSLClientName(StephanoI_ATSocket_SSLClientName_t* nam
 bool StephanoI_ATSocket_SetSSLClientServerNameIndication(bool multiple_connections, StephanoI_ATSocket_SSLClientServerNameIndication_t name)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSSLCSNI=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSSLCSNI=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, name.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, name.sni, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, name.sni, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -872,26 +890,27 @@ bool StephanoI_ATSocket_GetSSLClientServerNameIndication(StephanoI_ATSocket_SSLC
 bool StephanoI_ATSocket_SetSSLClientALPN(bool multiple_connections, StephanoI_ATSocket_SSLClientALPN_t alpn)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSSLCALPN=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSSLCALPN=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, alpn.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, alpn.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, alpn.counts, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendInt(&builder, alpn.counts, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, alpn.alpn, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, alpn.alpn, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -921,26 +940,27 @@ bool StephanoI_ATSocket_GetSSLClientALPN(StephanoI_ATSocket_SSLClientALPN_t* alp
 bool StephanoI_ATSocket_SetSSLClientPSK(bool multiple_connections, StephanoI_ATSocket_SSLClientPSK_t psk)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPSSLCPSK=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPSSLCPSK=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, psk.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, psk.link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, psk.psk, ATCOMMAND_ARGUMENT_DELIM))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, psk.psk, ATCOMMAND_ARGUMENT_DELIM))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, psk.hint, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, psk.hint, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -970,26 +990,27 @@ bool StephanoI_ATSocket_GetSSLClientPSK(StephanoI_ATSocket_SSLClientPSK_t* psk)
 bool StephanoI_ATSocket_SetDNSServerInformation(bool manual, char* DNS_server)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
     if (manual)
     {
-        strcpy(pRequestCommand, "AT+CIPDNS=");
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, manual ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPDNS=");
+        if (!ATCommand_Builder_AppendInt(&builder, manual ? (uint32_t)1 : (uint32_t)0, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentStringQuotationMarks(pRequestCommand, DNS_server, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendStringQuotationMarks(&builder, DNS_server, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
-        if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+        if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
         {
             return false;
         }
     }
     else
     {
-        strcpy(pRequestCommand, "AT+CIPDNS=0\r\n");
+        ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPDNS=0\r\n");
     }
 
     if (!StephanoI_SendRequest(pRequestCommand))
@@ -1002,14 +1023,15 @@ bool StephanoI_ATSocket_SetDNSServerInformation(bool manual, char* DNS_server)
 bool StephanoI_ATSocket_SetReceiveMode(StephanoI_ATSocket_ReceiveMode_t mode)
 {
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPRECVMODE=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPRECVMODE=");
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, (uint32_t)mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, (uint32_t)mode, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
@@ -1056,23 +1078,24 @@ bool StephanoI_ATSocket_GetReceivedData(bool multiple_connections, uint8_t link_
 {
     char responsebuffer[len + 32];
     char* pRequestCommand = AT_commandBuffer;
+    ATCommand_Builder_t builder;
 
-    strcpy(pRequestCommand, "AT+CIPRECVDATA=");
+    ATCommand_Builder_Init(&builder, pRequestCommand, AT_MAX_COMMAND_BUFFER_SIZE, "AT+CIPRECVDATA=");
 
     if (multiple_connections)
     {
         /* AT+CIPMUX=1 */
-        if (!ATCommand_AppendArgumentInt(pRequestCommand, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
+        if (!ATCommand_Builder_AppendInt(&builder, link_ID, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_ARGUMENT_DELIM))
         {
             return false;
         }
     }
 
-    if (!ATCommand_AppendArgumentInt(pRequestCommand, len, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendInt(&builder, len, (ATCOMMAND_INTFLAGS_NOTATION_DEC | ATCOMMAND_INTFLAGS_UNSIGNED), ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
-    if (!ATCommand_AppendArgumentString(pRequestCommand, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
+    if (!ATCommand_Builder_AppendString(&builder, ATCOMMAND_CRLF, ATCOMMAND_STRING_TERMINATE))
     {
         return false;
     }
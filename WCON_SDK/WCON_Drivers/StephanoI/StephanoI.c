@@ -58,6 +58,23 @@ static char StephanoI_pendingCommandName[64] = {0};
  */
 static size_t StephanoI_pendingCommandNameLength = 0;
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Performance counters and latency histograms (see StephanoI_GetStatistics()).
+ */
+static WE_Stats_t StephanoI_stats = {0};
+
+/**
+ * @brief Time the pending request has been sent (see StephanoI_SendRequest()).
+ */
+static uint32_t StephanoI_requestStartUs = 0;
+
+/**
+ * @brief Is true as long as the latency of the pending request hasn't been recorded.
+ */
+static bool StephanoI_requestTimed = false;
+#endif
+
 /**
  * @brief Buffer used for current response text.
  */
@@ -117,7 +134,8 @@ static StephanoI_Pins_t* StephanoI_pinsP = NULL;
 static WE_UART_t* StephanoI_uartP = NULL;
 
 /**
- * @brief Time step (microseconds) when waiting for responses from StephanoI.
+ * @brief Time step (microseconds) when waiting for responses from StephanoI
+ * (maximum time between two checks, waiting ends as soon as the confirmation has been received).
  *
  * Note that WE_MICROSECOND_TICK needs to be defined to enable microsecond timer resolution.
  *
@@ -125,6 +143,11 @@ static WE_UART_t* StephanoI_uartP = NULL;
  */
 static uint32_t StephanoI_waitTimeStepUsec = 5 * 1000;
 
+/**
+ * @brief Is signaled when a confirmation has been received from StephanoI.
+ */
+static WE_Event_t StephanoI_confirmEvent = {0};
+
 /**
  * @brief Minimum interval (microseconds) between subsequent commands sent to StephanoI
  * (more precisely the minimum interval between the confirmation of the previous command
@@ -153,6 +176,28 @@ StephanoI_EventCallback_t StephanoI_eventCallback;
  */
 static bool StephanoI_executingEventCallback = false;
 
+/**
+ * @brief Serializes the access of several threads to the module (see StephanoI_Lock()).
+ */
+static WE_Mutex_t StephanoI_requestMutex = NULL;
+
+#if defined(WE_AT_RX_TASK)
+/**
+ * @brief Receive task, which executes the byte handler (see StephanoI_SetByteRxCallback()) if supported by the platform.
+ */
+static ATCommand_RxTask_t StephanoI_rxTask = {0};
+
+/**
+ * @brief Queues received data for the receive task.
+ */
+static void StephanoI_EnqueueRxBytes(uint8_t* dataP, size_t size) { ATCommand_RxTask_Enqueue(&StephanoI_rxTask, dataP, size); }
+
+/**
+ * @brief Byte handler passed to the UART if the receive task is running.
+ */
+static WE_UART_HandleRxByte_t StephanoI_uartRxCallback = StephanoI_EnqueueRxBytes;
+#endif
+
 /**
  * @brief Initializes the serial communication with the module
  *
@@ -165,6 +210,9 @@ static bool StephanoI_executingEventCallback = false;
 bool StephanoI_Init(WE_UART_t* uartP, StephanoI_Pins_t* pinoutP, StephanoI_EventCallback_t eventCallback)
 {
     StephanoI_requestPending = false;
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&StephanoI_stats);
+#endif
 
     /* Callbacks */
     StephanoI_eventCallback = eventCallback;
@@ -209,7 +257,21 @@ bool StephanoI_Init(WE_UART_t* uartP, StephanoI_Pins_t* pinoutP, StephanoI_Event
     }
 
     StephanoI_uartP = uartP;
-    if (false == StephanoI_uartP->uartInit(StephanoI_uartP->baudrate, StephanoI_uartP->flowControl, StephanoI_uartP->parity, &byteRxCallback))
+
+    if ((NULL == StephanoI_requestMutex) && !WE_Mutex_Create(&StephanoI_requestMutex))
+    {
+        return false;
+    }
+
+    WE_UART_HandleRxByte_t* uartRxCallbackP = &byteRxCallback;
+#if defined(WE_AT_RX_TASK)
+    if (ATCommand_RxTask_Start(&StephanoI_rxTask, &byteRxCallback, "StephanoI_RX"))
+    {
+        /* Received data is passed to the byte handler by the receive task */
+        uartRxCallbackP = &StephanoI_uartRxCallback;
+    }
+#endif
+    if (false == StephanoI_uartP->uartInit(StephanoI_uartP->baudrate, StephanoI_uartP->flowControl, StephanoI_uartP->parity, uartRxCallbackP))
     {
         return false;
     }
@@ -288,9 +350,31 @@ bool StephanoI_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
     {
         return false;
     }
+    WE_STATS_TRANSMIT(&StephanoI_stats, dataLength, false);
     return StephanoI_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
+#if defined(WE_STATS_ENABLED)
+bool StephanoI_GetStatistics(WE_Stats_t* statsP)
+{
+    if (!WE_Stats_Snapshot(&StephanoI_stats, StephanoI_uartP, statsP))
+    {
+        return false;
+    }
+#if defined(WE_AT_RX_TASK)
+    /* Data discarded by the receive task counts as receive overflow as well */
+    statsP->rxDroppedBytes += StephanoI_rxTask.droppedBytes;
+#endif
+    return true;
+}
+
+void StephanoI_ResetStatistics() { WE_Stats_Reset(&StephanoI_stats); }
+#endif
+
+bool StephanoI_Lock(uint32_t timeoutMs) { return WE_Mutex_Lock(StephanoI_requestMutex, timeoutMs); }
+
+void StephanoI_Unlock(void) { WE_Mutex_Unlock(StephanoI_requestMutex); }
+
 /**
  * @brief Sends the supplied AT command to the module
  *
@@ -310,7 +394,12 @@ bool StephanoI_SendRequest(char* data) { return StephanoI_SendRequest_ex((uint8_
  */
 bool StephanoI_SendRequest_ex(uint8_t* data, size_t dataLength)
 {
+#if defined(WE_AT_RX_TASK)
+    /* If running, the receive task executes the event callbacks - other threads may send requests in the meantime */
+    if (StephanoI_executingEventCallback && ATCommand_RxTask_IsCurrentContext(&StephanoI_rxTask))
+#else
     if (StephanoI_executingEventCallback)
+#endif
     {
         /* Don't allow sending AT commands from event handlers, as this will
          * mess up send/receive states and buffers. */
@@ -347,6 +436,11 @@ bool StephanoI_SendRequest_ex(uint8_t* data, size_t dataLength)
         WE_DEBUG_PRINT_DEBUG("\r\n");
     }
 
+#if defined(WE_STATS_ENABLED)
+    StephanoI_stats.txFrames++;
+    WE_STATS_START_REQUEST(StephanoI_requestStartUs);
+    StephanoI_requestTimed = true;
+#endif
     StephanoI_Transparent_Transmit(data, dataLength);
 
     return true;
@@ -415,11 +509,13 @@ bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expec
 
         if (StephanoI_waitTimeStepUsec > 0)
         {
-            WE_DelayMicroseconds(StephanoI_waitTimeStepUsec);
+            /* Returns as soon as the confirmation has been received */
+            WE_WaitEvent(&StephanoI_confirmEvent, (StephanoI_waitTimeStepUsec + 999) / 1000);
         }
     }
 
     /* Timeout occurred */
+    WE_STATS_ADD(&StephanoI_stats, timeouts, 1);
     StephanoI_requestPending = false;
     StephanoI_currentResponseText = NULL;
     StephanoI_currentResponseAvailableLength = 0;
@@ -480,6 +576,8 @@ uint32_t StephanoI_GetTimeout(StephanoI_Timeout_t type) { return StephanoI_timeo
  */
 static void StephanoI_HandleRxByte(uint8_t* dataP, size_t size)
 {
+    WE_STATS_ADD(&StephanoI_stats, rxBytes, size);
+
     uint8_t receivedByte;
     for (; size > 0; size--, dataP++)
     {
@@ -508,6 +606,7 @@ static void StephanoI_HandleRxByte(uint8_t* dataP, size_t size)
         {
             if (StephanoI_rxByteCounter >= STEPHANOI_LINE_MAX_SIZE)
             {
+                WE_STATS_ADD(&StephanoI_stats, parseErrors, 1);
                 StephanoI_rxByteCounter = 0;
                 StephanoI_eolChar1Found = false;
                 return;
@@ -555,6 +654,8 @@ static void StephanoI_HandleRxByte(uint8_t* dataP, size_t size)
  */
 static void StephanoI_HandleRxLine(char* rxPacket, uint16_t rxLength)
 {
+    WE_STATS_ADD(&StephanoI_stats, rxFrames, 1);
+
     WE_DEBUG_PRINT_DEBUG("< %s\r\n", rxPacket);
 
     /* confirmations */
@@ -625,6 +726,20 @@ static void StephanoI_HandleRxLine(char* rxPacket, uint16_t rxLength)
                 StephanoI_currentResponseLength += chunkLength;
             }
         }
+
+        if (StephanoI_CNFStatus_Invalid != StephanoI_cmdConfirmStatus)
+        {
+#if defined(WE_STATS_ENABLED)
+            if (StephanoI_requestTimed)
+            {
+                StephanoI_requestTimed = false;
+                WE_STATS_COMPLETE_REQUEST(&StephanoI_stats, WE_Stats_Hash(StephanoI_pendingCommandName, StephanoI_pendingCommandNameLength), StephanoI_pendingCommandName, StephanoI_requestStartUs);
+            }
+#endif
+
+            /* Wake up StephanoI_WaitForConfirm_ex() */
+            WE_SignalEvent(&StephanoI_confirmEvent);
+        }
     }
 
     /* indications */
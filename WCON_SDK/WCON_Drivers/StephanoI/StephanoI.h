@@ -32,6 +32,7 @@
 #define STEPHANOI_H_INCLUDED
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -149,12 +150,49 @@ extern bool StephanoI_Deinit(void);
 extern bool StephanoI_PinReset(void);
 extern bool StephanoI_SetWakeUpPin(bool high);
 
+/**
+ * @brief Locks the driver for exclusive use by the calling thread.
+ *
+ * The AT command functions share the command buffer (AT_commandBuffer) and the state of the pending request.
+ * If the driver is used by several threads, each call (or sequence of calls) of driver functions needs to be
+ * enclosed in StephanoI_Lock() and StephanoI_Unlock(). The lock may be acquired several times by the same thread.
+ * Must not be called from the event callback. On bare metal platforms, this function has no effect.
+ *
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the driver has been locked, false if the timeout has expired
+ */
+extern bool StephanoI_Lock(uint32_t timeoutMs);
+
+/**
+ * @brief Releases the lock acquired using StephanoI_Lock().
+ */
+extern void StephanoI_Unlock(void);
+
 extern bool StephanoI_Transparent_Transmit(const uint8_t* data, uint16_t dataLength);
 extern bool StephanoI_SendRequest(char* data);
 extern bool StephanoI_SendRequest_ex(uint8_t* data, size_t dataLength);
 extern bool StephanoI_WaitForConfirm(uint32_t maxTimeMs, StephanoI_CNFStatus_t expectedStatus);
 extern bool StephanoI_WaitForConfirm_ex(uint32_t maxTimeMs, StephanoI_CNFStatus_t expectedStatus, char* pOutResponse, uint16_t responseSize);
 
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * The latency histograms are kept per AT command name (see WE_Stats_Hash()).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool StephanoI_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void StephanoI_ResetStatistics();
+#endif
+
 extern bool StephanoI_SetTimingParameters(uint32_t waitTimeStepMicroseconds, uint32_t minCommandIntervalMicroseconds);
 extern void StephanoI_SetTimeout(StephanoI_Timeout_t type, uint32_t timeout);
 extern uint32_t StephanoI_GetTimeout(StephanoI_Timeout_t type);
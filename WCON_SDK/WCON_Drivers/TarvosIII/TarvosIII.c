@@ -29,6 +29,7 @@
  */
 
 #include <TarvosIII/TarvosIII.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -112,9 +113,6 @@
 #define TARVOSIII_CFGFLAGS_SNIFFERMODEENABLE 0x0001
 #define TARVOSIII_RPFLAGS_REPEATERENABLE 0X0001
 
-void TarvosIII_HandleRxByte(uint8_t* dataP, size_t size);
-static WE_UART_HandleRxByte_t byteRxCallback = TarvosIII_HandleRxByte;
-
 /**
  * @brief Type used to check the response, when a command was sent to the TarvosIII
  */
@@ -139,309 +137,334 @@ typedef struct
     uint8_t Data[MAX_DATA_BUFFER + 1]; /* +1 for the CS */
 } TarvosIII_CMD_Frame_t;
 
-typedef struct
+/**
+ * @brief State of a TarvosIII driver instance.
+ */
+struct TarvosIII_Handle_t
 {
-    uint8_t cmd;                   /* variable to check if correct CMD has been confirmed */
-    TarvosIII_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the TarvosIII */
-} TarvosIII_CMD_Confirmation_t;
+    TarvosIII_CMD_Frame_t rxPacket;                                                  /**< data buffer for RX */
+    TarvosIII_CMD_Frame_t txPacket;                                                  /**< request to be sent to the module */
+    CMDFrame_ConfirmationQueue_t cmdConfirmations;                                   /**< received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t stats;                                                                /**< performance counters and latency histograms */
+#endif
+    uint8_t channelVolatile;                                                         /**< variable used to check if setting the channel was successful */
+    uint8_t powerVolatile;                                                           /**< variable used to check if setting the TXPower was successful */
+    TarvosIII_AddressMode_t addressmode;                                             /**< address mode */
+    TarvosIII_Pins_t* pinsP;                                                         /**< pin configuration struct pointer */
+    WE_UART_t* uartP;                                                                /**< UART configuration struct pointer */
+    CMDFrame_Parser_t rxParser;                                                      /**< assembles the frames received from the module */
+    uint8_t rxBuffer[sizeof(TarvosIII_CMD_Frame_t)];                                 /**< data buffer for RX */
+    void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t);        /**< callback function */
+    WE_UART_HandleRxByte_t byteRxCallback;                                           /**< function called by the UART driver on data reception */
+    CMDFrame_AsyncQueue_t asyncQueue;                                                /**< asynchronous requests waiting for their confirmation */
+};
+
+/**
+ * @brief Initial state of a driver instance.
+ */
+#define HANDLE_INITIALIZER {.txPacket = {.Stx = CMD_STX, .Length = 0}, .channelVolatile = CHANNELINVALID, .powerVolatile = TXPOWERINVALID, .addressmode = TarvosIII_AddressMode_0}
+
+#if TARVOSIII_MAX_INSTANCES > 4
+#error "TARVOSIII_MAX_INSTANCES must not exceed 4"
+#endif
 
 /**************************************
  *          Static variables          *
  **************************************/
+static TarvosIII_Handle_t instances[TARVOSIII_MAX_INSTANCES] = {HANDLE_INITIALIZER,
+#if TARVOSIII_MAX_INSTANCES > 1
+                                                                HANDLE_INITIALIZER,
+#endif
+#if TARVOSIII_MAX_INSTANCES > 2
+                                                                HANDLE_INITIALIZER,
+#endif
+#if TARVOSIII_MAX_INSTANCES > 3
+                                                                HANDLE_INITIALIZER,
+#endif
+};
 
-static TarvosIII_CMD_Frame_t rxPacket;                                 /* data buffer for RX */
-static TarvosIII_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
-
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static TarvosIII_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
-static uint8_t channelVolatile = CHANNELINVALID;                      /* variable used to check if setting the channel was successful */
-static uint8_t powerVolatile = TXPOWERINVALID;                        /* variable used to check if setting the TXPower was successful */
-static TarvosIII_AddressMode_t addressmode = TarvosIII_AddressMode_0; /* initial address mode */
 /**
- * @brief Pin configuration struct pointer.
+ * @brief Instance used by the functions without handle parameter.
  */
-static TarvosIII_Pins_t* TarvosIII_pinsP = NULL;
-
-/**
- * @brief Uart configuration struct pointer.
- */
-static WE_UART_t* TarvosIII_uartP = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint8_t bytesToReceive = 0;
-static uint8_t rxBuffer[sizeof(TarvosIII_CMD_Frame_t)];                          /* data buffer for RX */
-static void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t); /* callback function */
+#define DEFAULT_HANDLE (&instances[0])
 
 /**************************************
  *         Static functions           *
  **************************************/
 
-/**
- * @brief Interpret the valid received UART data packet
- */
-static void HandleRxPacket(uint8_t* rxBuffer)
+static void HandleResetInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    TarvosIII_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->status = CMD_Status_Success;
+    confirmation->cmd = frame->cmd;
+}
 
-    uint8_t cmd_length = rxBuffer[2];
-    memcpy((uint8_t*)&rxPacket, rxBuffer, cmd_length + 4);
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandleDataExInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    TarvosIII_Handle_t* handle = (TarvosIII_Handle_t*)context;
 
-    switch (rxPacket.Cmd)
+    /* data received, give it to the handle->RxCallback function */
+    if (handle->RxCallback != NULL)
     {
-        case TARVOSIII_CMD_RESET_IND:
-        case TARVOSIII_CMD_STANDBY_IND:
+        switch (handle->addressmode)
         {
-            cmdConfirmation.status = CMD_Status_Success;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
-        case TARVOSIII_CMD_FACTORY_RESET_CNF:
-        case TARVOSIII_CMD_RESET_CNF:
-        case TARVOSIII_CMD_SHUTDOWN_CNF:
-        case TARVOSIII_CMD_STANDBY_CNF:
-        case TARVOSIII_CMD_DATA_CNF:
-        case TARVOSIII_CMD_GET_CNF:
-        case TARVOSIII_CMD_SET_DESTADDR_CNF:
-        case TARVOSIII_CMD_SET_DESTNETID_CNF:
-        case TARVOSIII_CMD_SET_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TarvosIII_AddressMode_0:
+            {
+                handle->RxCallback(&frame->data[0], frame->length - 1, TARVOSIII_BROADCASTADDRESS, TARVOSIII_BROADCASTADDRESS, TARVOSIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case TARVOSIII_CMD_DATAEX_IND:
-        {
-            /* data received, give it to the RxCallback function */
-            if (RxCallback != NULL)
+            case TarvosIII_AddressMode_1:
             {
-                switch (addressmode)
-                {
-                    case TarvosIII_AddressMode_0:
-                    {
-                        RxCallback(&rxPacket.Data[0], rxPacket.Length - 1, TARVOSIII_BROADCASTADDRESS, TARVOSIII_BROADCASTADDRESS, TARVOSIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TarvosIII_AddressMode_1:
-                    {
-                        RxCallback(&rxPacket.Data[1], rxPacket.Length - 2, TARVOSIII_BROADCASTADDRESS, rxPacket.Data[0], TARVOSIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TarvosIII_AddressMode_2:
-                    {
-                        RxCallback(&rxPacket.Data[2], rxPacket.Length - 3, rxPacket.Data[0], rxPacket.Data[1], TARVOSIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TarvosIII_AddressMode_3:
-                    {
-                        RxCallback(&rxPacket.Data[3], rxPacket.Length - 4, rxPacket.Data[0], rxPacket.Data[1], rxPacket.Data[2], (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    default:
-                        /* wrong address mode */
-                        break;
-                }
+                handle->RxCallback(&frame->data[1], frame->length - 2, TARVOSIII_BROADCASTADDRESS, frame->data[0], TARVOSIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
             }
-        }
-        break;
+            break;
 
-        case TARVOSIII_CMD_SET_CHANNEL_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TarvosIII_AddressMode_2:
+            {
+                handle->RxCallback(&frame->data[2], frame->length - 3, frame->data[0], frame->data[1], TARVOSIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case TARVOSIII_CMD_SET_PAPOWER_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TarvosIII_AddressMode_3:
+            {
+                handle->RxCallback(&frame->data[3], frame->length - 4, frame->data[0], frame->data[1], frame->data[2], (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-            /* for internal use only */
-        case TARVOSIII_CMD_PINGDUT_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
+            default:
+                /* wrong address mode */
+                break;
         }
-        break;
+    }
+}
 
-        default:
-            break;
+static void HandleSetChannelCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    TarvosIII_Handle_t* handle = (TarvosIII_Handle_t*)context;
+
+    confirmation->status = (frame->data[0] == handle->channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandleSetPaPowerCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    TarvosIII_Handle_t* handle = (TarvosIII_Handle_t*)context;
+
+    confirmation->status = (frame->data[0] == handle->powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandlePingDutCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* for internal use only */
+    confirmation->status = (frame->data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [TARVOSIII_CMD_RESET_IND]         = HandleResetInd,
+    [TARVOSIII_CMD_STANDBY_IND]       = HandleResetInd,
+    [TARVOSIII_CMD_FACTORY_RESET_CNF] = HandleStatusCnf,
+    [TARVOSIII_CMD_RESET_CNF]         = HandleStatusCnf,
+    [TARVOSIII_CMD_SHUTDOWN_CNF]      = HandleStatusCnf,
+    [TARVOSIII_CMD_STANDBY_CNF]       = HandleStatusCnf,
+    [TARVOSIII_CMD_DATA_CNF]          = HandleStatusCnf,
+    [TARVOSIII_CMD_GET_CNF]           = HandleStatusCnf,
+    [TARVOSIII_CMD_SET_DESTADDR_CNF]  = HandleStatusCnf,
+    [TARVOSIII_CMD_SET_DESTNETID_CNF] = HandleStatusCnf,
+    [TARVOSIII_CMD_SET_CNF]           = HandleStatusCnf,
+    [TARVOSIII_CMD_DATAEX_IND]        = HandleDataExInd,
+    [TARVOSIII_CMD_SET_CHANNEL_CNF]   = HandleSetChannelCnf,
+    [TARVOSIII_CMD_SET_PAPOWER_CNF]   = HandleSetPaPowerCnf,
+    [TARVOSIII_CMD_PINGDUT_CNF]       = HandlePingDutCnf,
+};
+
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    TarvosIII_Handle_t* handle = (TarvosIII_Handle_t*)context;
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
+
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if ((cmdConfirmation.cmd != CNFINVALID) && CMDFrame_AsyncQueue_Complete(&handle->asyncQueue, &cmdConfirmation, frame))
+    {
+        /* Confirmation of an asynchronous request (has been passed to the request's callback) */
+        return;
     }
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+    if (cmdConfirmation.cmd != CNFINVALID)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&handle->cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
 /**
  * @brief Function that waits for the return value of TarvosIII (*_CNF), when a command (*_REQ) was sent before
  */
-static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, TarvosIII_CMD_Status_t expectedStatus, bool reset_confirmstate)
+static bool Wait4CNF(TarvosIII_Handle_t* handle, uint32_t max_time_ms, uint8_t expectedCmdConfirmation, TarvosIII_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    int count = 0;
-    int time_step_ms = 5; /* 5ms */
-    int max_count = max_time_ms / time_step_ms;
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
-
-        if (count >= max_count)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
 
-        /* wait */
-        count++;
-        WE_Delay(time_step_ms);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&handle->cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers handle->rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(TarvosIII_Handle_t* handle, uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&handle->cmdConfirmations, expectedCmdConfirmation, &handle->rxPacket, sizeof(handle->rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static void FillChecksum(TarvosIII_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
+}
 
-    for (uint8_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
+/**
+ * @brief Sends data to the module.
+ *
+ * isBlockingRequest is true if the data is a request whose confirmation is awaited using Wait4CNF(), so that
+ * its latency is measured by the confirmation queue. The latency of asynchronous requests is measured per
+ * request by the asynchronous queue instead.
+ */
+static bool TransmitData(TarvosIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength, bool isBlockingRequest)
+{
+    if ((data == NULL) || (dataLength == 0))
     {
-        checksum ^= pArray[i];
+        return false;
     }
 
-    cmd->Data[cmd->Length] = checksum;
+    WE_STATS_TRANSMIT(&handle->stats, dataLength, data == (const uint8_t*)&handle->txPacket);
+    CMDFRAME_STATS_START_REQUEST(&handle->cmdConfirmations, isBlockingRequest);
+    return handle->uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
-void TarvosIII_HandleRxByte(uint8_t* dataP, size_t size)
+/**
+ * @brief Sends the request in handle->txPacket without waiting for its confirmation.
+ *
+ * The request is added to the queue of asynchronous requests before it is sent, as the
+ * confirmation might be received before the transmit function returns.
+ */
+static bool SendAsyncRequest(TarvosIII_Handle_t* handle, uint8_t expectedCmdConfirmation, TarvosIII_AsyncCallback_t cb)
 {
-    for (; size > 0; size--, dataP++)
+    if (!CMDFrame_AsyncQueue_Add(&handle->asyncQueue, expectedCmdConfirmation, CMD_Status_Success, CMD_WAIT_TIME, cb))
     {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
+        return false;
+    }
 
-            case 2:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = (rxBuffer[rxByteCounter - 1] + 4); /* len + crc + sfd + cmd */
-                break;
+    FillChecksum(&handle->txPacket);
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint8_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
+    if (!TransmitData(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD, false))
+    {
+        /* Unless the request has already been completed (its callback has been called), no callback will follow */
+        return !CMDFrame_AsyncQueue_Cancel(&handle->asyncQueue);
     }
+    return true;
+}
+
+static void TarvosIII_HandleRxByte(TarvosIII_Handle_t* handle, uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&handle->rxParser, dataP, size);
 }
 
+/*
+ * The UART driver calls the byte handler without any context, so each instance
+ * needs its own handler function.
+ */
+static void TarvosIII_HandleRxByte0(uint8_t* dataP, size_t size) { TarvosIII_HandleRxByte(&instances[0], dataP, size); }
+#if TARVOSIII_MAX_INSTANCES > 1
+static void TarvosIII_HandleRxByte1(uint8_t* dataP, size_t size) { TarvosIII_HandleRxByte(&instances[1], dataP, size); }
+#endif
+#if TARVOSIII_MAX_INSTANCES > 2
+static void TarvosIII_HandleRxByte2(uint8_t* dataP, size_t size) { TarvosIII_HandleRxByte(&instances[2], dataP, size); }
+#endif
+#if TARVOSIII_MAX_INSTANCES > 3
+static void TarvosIII_HandleRxByte3(uint8_t* dataP, size_t size) { TarvosIII_HandleRxByte(&instances[3], dataP, size); }
+#endif
+
+/**
+ * @brief Byte handler of each instance.
+ */
+static const WE_UART_HandleRxByte_t rxByteHandlers[TARVOSIII_MAX_INSTANCES] = {TarvosIII_HandleRxByte0,
+#if TARVOSIII_MAX_INSTANCES > 1
+                                                                               TarvosIII_HandleRxByte1,
+#endif
+#if TARVOSIII_MAX_INSTANCES > 2
+                                                                               TarvosIII_HandleRxByte2,
+#endif
+#if TARVOSIII_MAX_INSTANCES > 3
+                                                                               TarvosIII_HandleRxByte3,
+#endif
+};
+
 /**************************************
  *         Global functions           *
  **************************************/
-bool TarvosIII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
-{
-    if ((data == NULL) || (dataLength == 0))
-    {
-        return false;
-    }
+bool TarvosIII_Handle_Transparent_Transmit(TarvosIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength) { return TransmitData(handle, data, dataLength, data == (const uint8_t*)&handle->txPacket); }
 
-    return TarvosIII_uartP->uartTransmit((uint8_t*)data, dataLength);
-}
+uint32_t TarvosIII_Handle_GetConfirmationOverflowCount(TarvosIII_Handle_t* handle) { return handle->cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool TarvosIII_Handle_GetStatistics(TarvosIII_Handle_t* handle, WE_Stats_t* statsP) { return WE_Stats_Snapshot(&handle->stats, handle->uartP, statsP); }
 
-bool TarvosIII_Init(WE_UART_t* uartP, TarvosIII_Pins_t* pinoutP, TarvosIII_AddressMode_t addrmode, void (*RXcb)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t))
+void TarvosIII_Handle_ResetStatistics(TarvosIII_Handle_t* handle) { WE_Stats_Reset(&handle->stats); }
+#endif
+
+bool TarvosIII_Handle_Init(TarvosIII_Handle_t* handle, WE_UART_t* uartP, TarvosIII_Pins_t* pinoutP, TarvosIII_AddressMode_t addrmode, void (*RXcb)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t))
 {
     /* set address mode */
-    addressmode = addrmode;
+    handle->addressmode = addrmode;
 
     /* set RX callback function */
-    RxCallback = RXcb;
+    handle->RxCallback = RXcb;
 
     if ((pinoutP == NULL) || (uartP == NULL) || (uartP->uartInit == NULL) || (uartP->uartDeinit == NULL) || (uartP->uartTransmit == NULL))
     {
         return false;
     }
 
-    TarvosIII_pinsP = pinoutP;
-    TarvosIII_pinsP->TarvosIII_Pin_Reset.type = WE_Pin_Type_Output;
-    TarvosIII_pinsP->TarvosIII_Pin_Reset.initial_value.output = WE_Pin_Level_High;
-    TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
-    TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_Low;
-    TarvosIII_pinsP->TarvosIII_Pin_Boot.type = WE_Pin_Type_Output;
-    TarvosIII_pinsP->TarvosIII_Pin_Boot.initial_value.output = WE_Pin_Level_Low;
-    TarvosIII_pinsP->TarvosIII_Pin_Mode.type = WE_Pin_Type_Output;
-    TarvosIII_pinsP->TarvosIII_Pin_Mode.initial_value.output = WE_Pin_Level_Low;
+    handle->pinsP = pinoutP;
+    handle->pinsP->TarvosIII_Pin_Reset.type = WE_Pin_Type_Output;
+    handle->pinsP->TarvosIII_Pin_Reset.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->TarvosIII_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
+    handle->pinsP->TarvosIII_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_Low;
+    handle->pinsP->TarvosIII_Pin_Boot.type = WE_Pin_Type_Output;
+    handle->pinsP->TarvosIII_Pin_Boot.initial_value.output = WE_Pin_Level_Low;
+    handle->pinsP->TarvosIII_Pin_Mode.type = WE_Pin_Type_Output;
+    handle->pinsP->TarvosIII_Pin_Mode.initial_value.output = WE_Pin_Level_Low;
 
     WE_Pin_t pins[sizeof(TarvosIII_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Mode, sizeof(WE_Pin_t));
 
     if (!WE_InitPins(pins, pin_count))
     {
@@ -449,36 +472,46 @@ bool TarvosIII_Init(WE_UART_t* uartP, TarvosIII_Pins_t* pinoutP, TarvosIII_Addre
         return false;
     }
 
-    TarvosIII_uartP = uartP;
-    if (!TarvosIII_uartP->uartInit(TarvosIII_uartP->baudrate, TarvosIII_uartP->flowControl, TarvosIII_uartP->parity, &byteRxCallback))
+    handle->byteRxCallback = rxByteHandlers[handle - instances];
+
+    CMDFrame_Parser_Init(&handle->rxParser, CMD_STX, sizeof(handle->rxPacket.Length), handle->rxBuffer, sizeof(handle->rxBuffer), HandleRxPacket, handle);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&handle->stats);
+    handle->rxParser.stats = &handle->stats;
+    handle->cmdConfirmations.stats = &handle->stats;
+    handle->asyncQueue.stats = &handle->stats;
+#endif
+
+    handle->uartP = uartP;
+    if (!handle->uartP->uartInit(handle->uartP->baudrate, handle->uartP->flowControl, handle->uartP->parity, &handle->byteRxCallback))
     {
         return false;
     }
     WE_Delay(10);
 
     /* reset module */
-    if (TarvosIII_PinReset())
+    if (TarvosIII_Handle_PinReset(handle))
     {
         WE_Delay(300);
     }
     else
     {
         WE_DEBUG_PRINT_INFO("Pin reset failed\r\n");
-        TarvosIII_Deinit();
+        TarvosIII_Handle_Deinit(handle);
         return false;
     }
 
     return true;
 }
 
-bool TarvosIII_Deinit()
+bool TarvosIII_Handle_Deinit(TarvosIII_Handle_t* handle)
 {
     WE_Pin_t pins[sizeof(TarvosIII_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &TarvosIII_pinsP->TarvosIII_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->TarvosIII_Pin_Mode, sizeof(WE_Pin_t));
 
     /* deinit pins */
     if (!WE_DeinitPins(pins, pin_count))
@@ -486,151 +519,165 @@ bool TarvosIII_Deinit()
         return false;
     }
 
-    addressmode = TarvosIII_AddressMode_0;
-    RxCallback = NULL;
+    handle->addressmode = TarvosIII_AddressMode_0;
+    handle->RxCallback = NULL;
+    CMDFrame_AsyncQueue_Abort(&handle->asyncQueue);
 
-    return TarvosIII_uartP->uartDeinit();
+    return handle->uartP->uartDeinit();
 }
 
-bool TarvosIII_PinWakeup(bool standby)
+bool TarvosIII_Handle_PinWakeup(TarvosIII_Handle_t* handle, bool standby)
 {
-    if (!WE_SetPin(TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp, WE_Pin_Level_High))
+    if (!WE_SetPin(handle->pinsP->TarvosIII_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
     }
 
     WE_Delay(5);
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmation_array[i].status = CMD_Status_Invalid;
-        cmdConfirmation_array[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
 
-    if (!WE_SetPin(TarvosIII_pinsP->TarvosIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->TarvosIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, standby ? TARVOSIII_CMD_STANDBY_IND : TARVOSIII_CMD_RESET_IND, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, standby ? TARVOSIII_CMD_STANDBY_IND : TARVOSIII_CMD_RESET_IND, CMD_Status_Success, false);
 }
 
-bool TarvosIII_PinReset()
+bool TarvosIII_Handle_PinReset(TarvosIII_Handle_t* handle)
 {
-    if (!WE_SetPin(TarvosIII_pinsP->TarvosIII_Pin_Reset, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->TarvosIII_Pin_Reset, WE_Pin_Level_Low))
     {
         return false;
     }
 
     WE_Delay(5);
 
-    if (!WE_SetPin(TarvosIII_pinsP->TarvosIII_Pin_Reset, WE_Pin_Level_High))
+    if (!WE_SetPin(handle->pinsP->TarvosIII_Pin_Reset, WE_Pin_Level_High))
     {
         return false;
     }
 
+    CMDFrame_AsyncQueue_Abort(&handle->asyncQueue);
+
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_RESET_IND, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_RESET_IND, CMD_Status_Success, true);
 }
 
-bool TarvosIII_Reset()
+bool TarvosIII_Handle_Reset(TarvosIII_Handle_t* handle)
 {
-    txPacket.Cmd = TARVOSIII_CMD_RESET_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = TARVOSIII_CMD_RESET_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_RESET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_RESET_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_FactoryReset()
+bool TarvosIII_Handle_FactoryReset(TarvosIII_Handle_t* handle)
 {
-    txPacket.Cmd = TARVOSIII_CMD_FACTORY_RESET_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = TARVOSIII_CMD_FACTORY_RESET_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(1500, TARVOSIII_CMD_FACTORY_RESET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, 1500, TARVOSIII_CMD_FACTORY_RESET_CNF, CMD_Status_Success, true);
     ;
 }
 
-bool TarvosIII_Standby()
+bool TarvosIII_Handle_Standby(TarvosIII_Handle_t* handle)
 {
-    txPacket.Cmd = TARVOSIII_CMD_STANDBY_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = TARVOSIII_CMD_STANDBY_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_STANDBY_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_STANDBY_CNF, CMD_Status_Success, true);
     ;
 }
 
-bool TarvosIII_Shutdown()
+bool TarvosIII_Handle_Shutdown(TarvosIII_Handle_t* handle)
 {
-    txPacket.Cmd = TARVOSIII_CMD_SHUTDOWN_REQ;
-    txPacket.Length = 0x00;
+    handle->txPacket.Cmd = TARVOSIII_CMD_SHUTDOWN_REQ;
+    handle->txPacket.Length = 0x00;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SHUTDOWN_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SHUTDOWN_CNF, CMD_Status_Success, true);
+}
+
+/**
+ * @brief Prepares a CMD_GET_REQ in handle->txPacket.
+ */
+static void PrepareGetRequest(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us)
+{
+    handle->txPacket.Cmd = TARVOSIII_CMD_GET_REQ;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = us;
 }
 
-bool TarvosIII_Get(TarvosIII_UserSettings_t us, uint8_t* response, uint8_t* response_length)
+bool TarvosIII_Handle_Get(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* response, uint8_t* response_length)
 {
     if (response == NULL || response_length == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_GET_REQ;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = us;
+    PrepareGetRequest(handle, us);
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, TARVOSIII_CMD_GET_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_GET_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_GET_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    int length = rxPacket.Length - 1;
-    memcpy(response, &rxPacket.Data[1], length);
+    int length = handle->rxPacket.Length - 1;
+    memcpy(response, &handle->rxPacket.Data[1], length);
     *response_length = length;
 
     return true;
 }
 
-bool TarvosIII_CheckNSet(TarvosIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+bool TarvosIII_Handle_GetAsync(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, TarvosIII_AsyncCallback_t cb)
+{
+    PrepareGetRequest(handle, us);
+    return SendAsyncRequest(handle, TARVOSIII_CMD_GET_CNF, cb);
+}
+
+bool TarvosIII_Handle_CheckNSet(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
@@ -640,7 +687,7 @@ bool TarvosIII_CheckNSet(TarvosIII_UserSettings_t userSetting, uint8_t* valueP,
     uint8_t current_value[length];
     uint8_t current_length = length;
 
-    if (!TarvosIII_Get(userSetting, current_value, &current_length))
+    if (!TarvosIII_Handle_Get(handle, userSetting, current_value, &current_length))
     {
         return false;
     }
@@ -652,34 +699,57 @@ bool TarvosIII_CheckNSet(TarvosIII_UserSettings_t userSetting, uint8_t* valueP,
     }
 
     /* value differs, and thus must be set */
-    return TarvosIII_Set(userSetting, valueP, length);
+    return TarvosIII_Handle_Set(handle, userSetting, valueP, length);
 }
 
-bool TarvosIII_Set(TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length)
+/**
+ * @brief Prepares a CMD_SET_REQ in handle->txPacket.
+ */
+static bool PrepareSetRequest(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length)
 {
     if (value == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_SET_REQ;
-    txPacket.Length = (1 + length);
-    txPacket.Data[0] = us;
-    memcpy(&txPacket.Data[1], value, length);
+    handle->txPacket.Cmd = TARVOSIII_CMD_SET_REQ;
+    handle->txPacket.Length = (1 + length);
+    handle->txPacket.Data[0] = us;
+    memcpy(&handle->txPacket.Data[1], value, length);
+    return true;
+}
 
-    FillChecksum(&txPacket);
+bool TarvosIII_Handle_Set(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length)
+{
+    if (!PrepareSetRequest(handle, us, value, length))
+    {
+        return false;
+    }
+
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SET_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SET_CNF, CMD_Status_Success, true);
     ;
 }
 
-bool TarvosIII_GetFirmwareVersion(uint8_t* fw)
+bool TarvosIII_Handle_SetAsync(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length, TarvosIII_AsyncCallback_t cb)
+{
+    if (!PrepareSetRequest(handle, us, value, length))
+    {
+        return false;
+    }
+    return SendAsyncRequest(handle, TARVOSIII_CMD_SET_CNF, cb);
+}
+
+void TarvosIII_Handle_CheckAsyncTimeouts(TarvosIII_Handle_t* handle) { CMDFrame_AsyncQueue_CheckTimeouts(&handle->asyncQueue); }
+
+bool TarvosIII_Handle_GetFirmwareVersion(TarvosIII_Handle_t* handle, uint8_t* fw)
 {
     if (fw == NULL)
     {
@@ -689,7 +759,7 @@ bool TarvosIII_GetFirmwareVersion(uint8_t* fw)
     uint8_t help[3];
     uint8_t help_length;
 
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_FWVERSION, help, &help_length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_FWVERSION, help, &help_length))
     {
         return false;
     }
@@ -701,7 +771,7 @@ bool TarvosIII_GetFirmwareVersion(uint8_t* fw)
     return true;
 }
 
-bool TarvosIII_GetSerialNumber(uint8_t* sn)
+bool TarvosIII_Handle_GetSerialNumber(TarvosIII_Handle_t* handle, uint8_t* sn)
 {
     if (sn == NULL)
     {
@@ -711,7 +781,7 @@ bool TarvosIII_GetSerialNumber(uint8_t* sn)
     uint8_t help[8];
     uint8_t help_length;
 
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_FACTORYSETTINGS, help, &help_length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_FACTORYSETTINGS, help, &help_length))
     {
         return false;
     }
@@ -724,7 +794,7 @@ bool TarvosIII_GetSerialNumber(uint8_t* sn)
     return true;
 }
 
-bool TarvosIII_GetDefaultTXPower(uint8_t* txpower)
+bool TarvosIII_Handle_GetDefaultTXPower(TarvosIII_Handle_t* handle, uint8_t* txpower)
 {
     if (txpower == NULL)
     {
@@ -734,10 +804,10 @@ bool TarvosIII_GetDefaultTXPower(uint8_t* txpower)
     *txpower = TXPOWERINVALID;
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFTXPOWER, txpower, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFTXPOWER, txpower, &length);
 }
 
-bool TarvosIII_GetDefaultDestAddr(uint8_t* destaddr_lsb, uint8_t* destaddr_msb)
+bool TarvosIII_Handle_GetDefaultDestAddr(TarvosIII_Handle_t* handle, uint8_t* destaddr_lsb, uint8_t* destaddr_msb)
 {
     if (destaddr_lsb == NULL || destaddr_msb == NULL)
     {
@@ -748,7 +818,7 @@ bool TarvosIII_GetDefaultDestAddr(uint8_t* destaddr_lsb, uint8_t* destaddr_msb)
     uint8_t help[2];
     uint8_t length;
 
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTADDR, help, &length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTADDR, help, &length))
     {
         return false;
     }
@@ -759,14 +829,14 @@ bool TarvosIII_GetDefaultDestAddr(uint8_t* destaddr_lsb, uint8_t* destaddr_msb)
     return true;
 }
 
-bool TarvosIII_GetDefaultDestNetID(uint8_t* destnetid)
+bool TarvosIII_Handle_GetDefaultDestNetID(TarvosIII_Handle_t* handle, uint8_t* destnetid)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTNETID, destnetid, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTNETID, destnetid, &length);
 }
 
-bool TarvosIII_GetSourceAddr(uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb)
+bool TarvosIII_Handle_GetSourceAddr(TarvosIII_Handle_t* handle, uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb)
 {
     if (srcaddr_lsb == NULL || srcaddr_msb == NULL)
     {
@@ -777,7 +847,7 @@ bool TarvosIII_GetSourceAddr(uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb)
     uint8_t help[2];
     uint8_t length;
 
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_SOURCEADDR, help, &length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_SOURCEADDR, help, &length))
     {
         return false;
     }
@@ -788,42 +858,42 @@ bool TarvosIII_GetSourceAddr(uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb)
     return true;
 }
 
-bool TarvosIII_GetSourceNetID(uint8_t* srcnetid)
+bool TarvosIII_Handle_GetSourceNetID(TarvosIII_Handle_t* handle, uint8_t* srcnetid)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_SOURCENETID, srcnetid, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_SOURCENETID, srcnetid, &length);
 }
 
-bool TarvosIII_GetDefaultRFChannel(uint8_t* channel)
+bool TarvosIII_Handle_GetDefaultRFChannel(TarvosIII_Handle_t* handle, uint8_t* channel)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFCHANNEL, channel, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFCHANNEL, channel, &length);
 }
 
-bool TarvosIII_GetDefaultRFProfile(uint8_t* profile)
+bool TarvosIII_Handle_GetDefaultRFProfile(TarvosIII_Handle_t* handle, uint8_t* profile)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFPROFILE, profile, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFPROFILE, profile, &length);
 }
 
-bool TarvosIII_GetLBTObservationPeriod(uint8_t* period)
+bool TarvosIII_Handle_GetLBTObservationPeriod(TarvosIII_Handle_t* handle, uint8_t* period)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_LBT_OBSERVATION_PERIOD, period, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_LBT_OBSERVATION_PERIOD, period, &length);
 }
 
-bool TarvosIII_GetLBTThreshold(int8_t* threshold)
+bool TarvosIII_Handle_GetLBTThreshold(TarvosIII_Handle_t* handle, int8_t* threshold)
 {
     uint8_t length;
 
-    return TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_LBT_THRESHOLD, (uint8_t*)threshold, &length);
+    return TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_LBT_THRESHOLD, (uint8_t*)threshold, &length);
 }
 
-bool TarvosIII_SetDefaultTXPower(uint8_t txpower)
+bool TarvosIII_Handle_SetDefaultTXPower(TarvosIII_Handle_t* handle, uint8_t txpower)
 {
     /* check for invalid power */
     if (txpower > 14)
@@ -832,32 +902,32 @@ bool TarvosIII_SetDefaultTXPower(uint8_t txpower)
         return false;
     }
 
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFTXPOWER, &txpower, 1);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFTXPOWER, &txpower, 1);
 }
 
-bool TarvosIII_SetDefaultDestAddr(uint8_t destaddr_lsb, uint8_t destaddr_msb)
+bool TarvosIII_Handle_SetDefaultDestAddr(TarvosIII_Handle_t* handle, uint8_t destaddr_lsb, uint8_t destaddr_msb)
 {
     /* fill array */
     uint8_t help[2];
     help[0] = destaddr_lsb;
     help[1] = destaddr_msb;
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTADDR, help, 2);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTADDR, help, 2);
 }
 
-bool TarvosIII_SetDefaultDestNetID(uint8_t destnetid) { return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTNETID, &destnetid, 1); }
+bool TarvosIII_Handle_SetDefaultDestNetID(TarvosIII_Handle_t* handle, uint8_t destnetid) { return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTDESTNETID, &destnetid, 1); }
 
-bool TarvosIII_SetSourceAddr(uint8_t srcaddr_lsb, uint8_t srcaddr_msb)
+bool TarvosIII_Handle_SetSourceAddr(TarvosIII_Handle_t* handle, uint8_t srcaddr_lsb, uint8_t srcaddr_msb)
 {
     /* fill array */
     uint8_t help[2];
     help[0] = srcaddr_lsb;
     help[1] = srcaddr_msb;
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_SOURCEADDR, help, 2);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_SOURCEADDR, help, 2);
 }
 
-bool TarvosIII_SetSourceNetID(uint8_t srcnetid) { return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_SOURCENETID, &srcnetid, 1); }
+bool TarvosIII_Handle_SetSourceNetID(TarvosIII_Handle_t* handle, uint8_t srcnetid) { return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_SOURCENETID, &srcnetid, 1); }
 
-bool TarvosIII_SetDefaultRFChannel(uint8_t channel)
+bool TarvosIII_Handle_SetDefaultRFChannel(TarvosIII_Handle_t* handle, uint8_t channel)
 {
     /* check for valid channel */
     if ((channel < 100) || (channel > 140))
@@ -865,38 +935,38 @@ bool TarvosIII_SetDefaultRFChannel(uint8_t channel)
         /* invalid channel */
         return false;
     }
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFCHANNEL, &channel, 1);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFCHANNEL, &channel, 1);
 }
 
-bool TarvosIII_SetDefaultRFProfile(uint8_t profile) { return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_DEFAULTRFPROFILE, &profile, 1); }
+bool TarvosIII_Handle_SetDefaultRFProfile(TarvosIII_Handle_t* handle, uint8_t profile) { return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_DEFAULTRFPROFILE, &profile, 1); }
 
-bool TarvosIII_SetLBTObservationPeriod(uint8_t period)
+bool TarvosIII_Handle_SetLBTObservationPeriod(TarvosIII_Handle_t* handle, uint8_t period)
 {
     if (period > 15)
     {
         return false;
     }
 
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_LBT_OBSERVATION_PERIOD, &period, 1);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_LBT_OBSERVATION_PERIOD, &period, 1);
 }
 
-bool TarvosIII_SetLBTThreshold(int8_t threshold)
+bool TarvosIII_Handle_SetLBTThreshold(TarvosIII_Handle_t* handle, int8_t threshold)
 {
     if ((threshold < -100) || (threshold > -45))
     {
         return false;
     }
 
-    return TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_LBT_THRESHOLD, (uint8_t*)&threshold, 1);
+    return TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_LBT_THRESHOLD, (uint8_t*)&threshold, 1);
 }
 
-bool TarvosIII_EnableSnifferMode()
+bool TarvosIII_Handle_EnableSnifferMode(TarvosIII_Handle_t* handle)
 {
     uint16_t rpFlags;
     uint16_t cfgFlags;
     uint8_t length;
 
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_CFG_FLAGS, (uint8_t*)&cfgFlags, &length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_CFG_FLAGS, (uint8_t*)&cfgFlags, &length))
     {
         return false;
     }
@@ -905,14 +975,14 @@ bool TarvosIII_EnableSnifferMode()
     if (TARVOSIII_CFGFLAGS_SNIFFERMODEENABLE != (cfgFlags & TARVOSIII_CFGFLAGS_SNIFFERMODEENABLE))
     {
         cfgFlags |= TARVOSIII_CFGFLAGS_SNIFFERMODEENABLE;
-        if (!TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_CFG_FLAGS, (uint8_t*)&cfgFlags, 2))
+        if (!TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_CFG_FLAGS, (uint8_t*)&cfgFlags, 2))
         {
             return false;
         }
     }
 
     /* Make sure repeater mode is disabled once sniffer mode is active. Sniffer mode and repeater mode can not be used simultaneously */
-    if (!TarvosIII_Get(TarvosIII_CMD_SETGET_OPTION_RP_FLAGS, (uint8_t*)&rpFlags, &length))
+    if (!TarvosIII_Handle_Get(handle, TarvosIII_CMD_SETGET_OPTION_RP_FLAGS, (uint8_t*)&rpFlags, &length))
     {
         return false;
     }
@@ -920,7 +990,7 @@ bool TarvosIII_EnableSnifferMode()
     if (TARVOSIII_RPFLAGS_REPEATERENABLE == (rpFlags & TARVOSIII_RPFLAGS_REPEATERENABLE))
     {
         rpFlags &= ~TARVOSIII_RPFLAGS_REPEATERENABLE;
-        if (!TarvosIII_Set(TarvosIII_CMD_SETGET_OPTION_RP_FLAGS, (uint8_t*)&rpFlags, 2))
+        if (!TarvosIII_Handle_Set(handle, TarvosIII_CMD_SETGET_OPTION_RP_FLAGS, (uint8_t*)&rpFlags, 2))
         {
             return false;
         }
@@ -929,7 +999,7 @@ bool TarvosIII_EnableSnifferMode()
     return true;
 }
 
-bool TarvosIII_SetVolatile_TXPower(uint8_t power)
+bool TarvosIII_Handle_SetVolatile_TXPower(TarvosIII_Handle_t* handle, uint8_t power)
 {
     /* check for invalid power */
     if (power > 14)
@@ -938,28 +1008,28 @@ bool TarvosIII_SetVolatile_TXPower(uint8_t power)
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_SET_PAPOWER_REQ;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = power;
+    handle->txPacket.Cmd = TARVOSIII_CMD_SET_PAPOWER_REQ;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = power;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    powerVolatile = power;
+    handle->powerVolatile = power;
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    bool ret = Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SET_PAPOWER_CNF, CMD_Status_Success, true);
+    bool ret = Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SET_PAPOWER_CNF, CMD_Status_Success, true);
 
-    powerVolatile = TXPOWERINVALID;
+    handle->powerVolatile = TXPOWERINVALID;
 
     return ret;
 }
 
-bool TarvosIII_SetVolatile_Channel(uint8_t channel)
+bool TarvosIII_Handle_SetVolatile_Channel(TarvosIII_Handle_t* handle, uint8_t channel)
 {
     /* check for valid channel */
     if ((channel < 100) || (channel > 140))
@@ -968,82 +1038,82 @@ bool TarvosIII_SetVolatile_Channel(uint8_t channel)
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_SET_CHANNEL_REQ;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = channel;
+    handle->txPacket.Cmd = TARVOSIII_CMD_SET_CHANNEL_REQ;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = channel;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    channelVolatile = channel;
+    handle->channelVolatile = channel;
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    bool ret = Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SET_CHANNEL_CNF, CMD_Status_Success, true);
+    bool ret = Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SET_CHANNEL_CNF, CMD_Status_Success, true);
 
-    channelVolatile = CHANNELINVALID;
+    handle->channelVolatile = CHANNELINVALID;
 
     return ret;
 }
 
-bool TarvosIII_SetVolatile_DestNetID(uint8_t destnetid)
+bool TarvosIII_Handle_SetVolatile_DestNetID(TarvosIII_Handle_t* handle, uint8_t destnetid)
 {
 
-    txPacket.Cmd = TARVOSIII_CMD_SET_DESTNETID_REQ;
-    txPacket.Length = 0x01;
-    txPacket.Data[0] = destnetid;
+    handle->txPacket.Cmd = TARVOSIII_CMD_SET_DESTNETID_REQ;
+    handle->txPacket.Length = 0x01;
+    handle->txPacket.Data[0] = destnetid;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SET_DESTNETID_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SET_DESTNETID_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_SetVolatile_DestAddr(uint8_t destaddr_lsb, uint8_t destaddr_msb)
+bool TarvosIII_Handle_SetVolatile_DestAddr(TarvosIII_Handle_t* handle, uint8_t destaddr_lsb, uint8_t destaddr_msb)
 {
-    switch (addressmode)
+    switch (handle->addressmode)
     {
         case TarvosIII_AddressMode_0:
         case TarvosIII_AddressMode_1:
         case TarvosIII_AddressMode_2:
         {
-            txPacket.Cmd = TARVOSIII_CMD_SET_DESTADDR_REQ;
-            txPacket.Length = 0x01;
-            txPacket.Data[0] = destaddr_lsb;
+            handle->txPacket.Cmd = TARVOSIII_CMD_SET_DESTADDR_REQ;
+            handle->txPacket.Length = 0x01;
+            handle->txPacket.Data[0] = destaddr_lsb;
         }
         break;
         case TarvosIII_AddressMode_3:
         {
-            txPacket.Cmd = TARVOSIII_CMD_SET_DESTADDR_REQ;
-            txPacket.Length = 0x02;
-            txPacket.Data[0] = destaddr_lsb;
-            txPacket.Data[1] = destaddr_msb;
+            handle->txPacket.Cmd = TARVOSIII_CMD_SET_DESTADDR_REQ;
+            handle->txPacket.Length = 0x02;
+            handle->txPacket.Data[0] = destaddr_lsb;
+            handle->txPacket.Data[1] = destaddr_msb;
         }
         break;
         default:
             return false;
     }
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_SET_DESTADDR_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_SET_DESTADDR_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_Transmit(uint8_t* payload, uint8_t length)
+bool TarvosIII_Handle_Transmit(TarvosIII_Handle_t* handle, uint8_t* payload, uint8_t length)
 {
     if ((payload == NULL) || (length == 0))
     {
@@ -1056,22 +1126,22 @@ bool TarvosIII_Transmit(uint8_t* payload, uint8_t length)
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_DATA_REQ;
-    txPacket.Length = length;
-    memcpy(&txPacket.Data[0], payload, length);
+    handle->txPacket.Cmd = TARVOSIII_CMD_DATA_REQ;
+    handle->txPacket.Length = length;
+    memcpy(&handle->txPacket.Data[0], payload, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_DATA_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_DATA_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_Transmit_Extended(uint8_t* payload, uint8_t length, uint8_t channel, uint8_t dest_network_id, uint8_t dest_address_lsb, uint8_t dest_address_msb)
+bool TarvosIII_Handle_Transmit_Extended(TarvosIII_Handle_t* handle, uint8_t* payload, uint8_t length, uint8_t channel, uint8_t dest_network_id, uint8_t dest_address_lsb, uint8_t dest_address_msb)
 {
     if ((payload == NULL) || (length == 0))
     {
@@ -1084,45 +1154,45 @@ bool TarvosIII_Transmit_Extended(uint8_t* payload, uint8_t length, uint8_t chann
         return false;
     }
 
-    txPacket.Cmd = TARVOSIII_CMD_DATAEX_REQ;
+    handle->txPacket.Cmd = TARVOSIII_CMD_DATAEX_REQ;
 
-    switch (addressmode)
+    switch (handle->addressmode)
     {
         case TarvosIII_AddressMode_0:
         {
-            txPacket.Length = (length + 1);
-            txPacket.Data[0] = channel;
-            memcpy(&txPacket.Data[1], payload, length);
+            handle->txPacket.Length = (length + 1);
+            handle->txPacket.Data[0] = channel;
+            memcpy(&handle->txPacket.Data[1], payload, length);
         }
         break;
 
         case TarvosIII_AddressMode_1:
         {
-            txPacket.Length = (length + 2);
-            txPacket.Data[0] = channel;
-            txPacket.Data[1] = dest_address_lsb;
-            memcpy(&txPacket.Data[2], payload, length);
+            handle->txPacket.Length = (length + 2);
+            handle->txPacket.Data[0] = channel;
+            handle->txPacket.Data[1] = dest_address_lsb;
+            memcpy(&handle->txPacket.Data[2], payload, length);
         }
         break;
 
         case TarvosIII_AddressMode_2:
         {
-            txPacket.Length = (length + 3);
-            txPacket.Data[0] = channel;
-            txPacket.Data[1] = dest_network_id;
-            txPacket.Data[2] = dest_address_lsb;
-            memcpy(&txPacket.Data[3], payload, length);
+            handle->txPacket.Length = (length + 3);
+            handle->txPacket.Data[0] = channel;
+            handle->txPacket.Data[1] = dest_network_id;
+            handle->txPacket.Data[2] = dest_address_lsb;
+            memcpy(&handle->txPacket.Data[3], payload, length);
         }
         break;
 
         case TarvosIII_AddressMode_3:
         {
-            txPacket.Length = (length + 4);
-            txPacket.Data[0] = channel;
-            txPacket.Data[1] = dest_network_id;
-            txPacket.Data[2] = dest_address_lsb;
-            txPacket.Data[3] = dest_address_msb;
-            memcpy(&txPacket.Data[4], payload, length);
+            handle->txPacket.Length = (length + 4);
+            handle->txPacket.Data[0] = channel;
+            handle->txPacket.Data[1] = dest_network_id;
+            handle->txPacket.Data[2] = dest_address_lsb;
+            handle->txPacket.Data[3] = dest_address_msb;
+            memcpy(&handle->txPacket.Data[4], payload, length);
         }
         break;
 
@@ -1131,33 +1201,33 @@ bool TarvosIII_Transmit_Extended(uint8_t* payload, uint8_t length, uint8_t chann
             return false;
     }
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!TarvosIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, TARVOSIII_CMD_DATA_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, TARVOSIII_CMD_DATA_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_Ping()
+bool TarvosIII_Handle_Ping(TarvosIII_Handle_t* handle)
 {
     /* rf-profil 5, ch134, +14dbm, 10 packets */
     uint8_t ping_command[] = {0x02, 0x1F, 0x08, 0x20, 0x05, 0x86, 0x0E, 0x0A, 0xFF, 0xFF, 0xFF, 0x4D};
 
     /* now send the data */
-    if (!TarvosIII_Transparent_Transmit(ping_command, sizeof(ping_command)))
+    if (!TarvosIII_Handle_Transparent_Transmit(handle, ping_command, sizeof(ping_command)))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(10000 /*10s*/, TARVOSIII_CMD_PINGDUT_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, 10000 /*10s*/, TARVOSIII_CMD_PINGDUT_CNF, CMD_Status_Success, true);
 }
 
-bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_length, bool factory_reset)
+bool TarvosIII_Handle_Configure(TarvosIII_Handle_t* handle, TarvosIII_Configuration_t* config, uint8_t config_length, bool factory_reset)
 {
     if ((config == NULL) || (config_length == 0))
     {
@@ -1170,7 +1240,7 @@ bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_lengt
     if (factory_reset)
     {
         /* perform a factory reset */
-        if (!TarvosIII_FactoryReset())
+        if (!TarvosIII_Handle_FactoryReset(handle))
         {
             /* error */
             return false;
@@ -1182,7 +1252,7 @@ bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_lengt
     for (uint8_t i = 0; i < config_length; i++)
     {
         /* read current value */
-        if (!TarvosIII_Get(config[i].usersetting, help, &help_length))
+        if (!TarvosIII_Handle_Get(handle, config[i].usersetting, help, &help_length))
         {
             /* error */
             return false;
@@ -1198,7 +1268,7 @@ bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_lengt
         if (memcmp(help, config[i].value, config[i].value_length) != 0)
         {
             /* read value is not up to date, thus write the new value */
-            if (!TarvosIII_Set(config[i].usersetting, config[i].value, config[i].value_length))
+            if (!TarvosIII_Handle_Set(handle, config[i].usersetting, config[i].value, config[i].value_length))
             {
                 /* error */
                 return false;
@@ -1208,5 +1278,107 @@ bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_lengt
     }
 
     /* reset to take effect of the updated parameters */
-    return TarvosIII_PinReset();
+    return TarvosIII_Handle_PinReset(handle);
 }
+
+TarvosIII_Handle_t* TarvosIII_GetHandle(uint8_t index) { return (index < TARVOSIII_MAX_INSTANCES) ? &instances[index] : NULL; }
+
+/**************************************
+ *   Functions for default instance   *
+ **************************************/
+
+bool TarvosIII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength) { return TarvosIII_Handle_Transparent_Transmit(DEFAULT_HANDLE, data, dataLength); }
+
+bool TarvosIII_Init(WE_UART_t* uartP, TarvosIII_Pins_t* pinoutP, TarvosIII_AddressMode_t addrmode, void (*RXcb)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t)) { return TarvosIII_Handle_Init(DEFAULT_HANDLE, uartP, pinoutP, addrmode, RXcb); }
+
+bool TarvosIII_Deinit() { return TarvosIII_Handle_Deinit(DEFAULT_HANDLE); }
+
+bool TarvosIII_PinWakeup(bool standby) { return TarvosIII_Handle_PinWakeup(DEFAULT_HANDLE, standby); }
+
+bool TarvosIII_PinReset() { return TarvosIII_Handle_PinReset(DEFAULT_HANDLE); }
+
+bool TarvosIII_Reset() { return TarvosIII_Handle_Reset(DEFAULT_HANDLE); }
+
+bool TarvosIII_FactoryReset() { return TarvosIII_Handle_FactoryReset(DEFAULT_HANDLE); }
+
+bool TarvosIII_Standby() { return TarvosIII_Handle_Standby(DEFAULT_HANDLE); }
+
+bool TarvosIII_Shutdown() { return TarvosIII_Handle_Shutdown(DEFAULT_HANDLE); }
+
+bool TarvosIII_Get(TarvosIII_UserSettings_t us, uint8_t* response, uint8_t* response_length) { return TarvosIII_Handle_Get(DEFAULT_HANDLE, us, response, response_length); }
+
+bool TarvosIII_GetAsync(TarvosIII_UserSettings_t us, TarvosIII_AsyncCallback_t cb) { return TarvosIII_Handle_GetAsync(DEFAULT_HANDLE, us, cb); }
+
+bool TarvosIII_CheckNSet(TarvosIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return TarvosIII_Handle_CheckNSet(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool TarvosIII_Set(TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length) { return TarvosIII_Handle_Set(DEFAULT_HANDLE, us, value, length); }
+
+bool TarvosIII_SetAsync(TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length, TarvosIII_AsyncCallback_t cb) { return TarvosIII_Handle_SetAsync(DEFAULT_HANDLE, us, value, length, cb); }
+
+void TarvosIII_CheckAsyncTimeouts() { TarvosIII_Handle_CheckAsyncTimeouts(DEFAULT_HANDLE); }
+
+bool TarvosIII_GetFirmwareVersion(uint8_t* fw) { return TarvosIII_Handle_GetFirmwareVersion(DEFAULT_HANDLE, fw); }
+
+bool TarvosIII_GetSerialNumber(uint8_t* sn) { return TarvosIII_Handle_GetSerialNumber(DEFAULT_HANDLE, sn); }
+
+bool TarvosIII_GetDefaultTXPower(uint8_t* txpower) { return TarvosIII_Handle_GetDefaultTXPower(DEFAULT_HANDLE, txpower); }
+
+bool TarvosIII_GetDefaultDestAddr(uint8_t* destaddr_lsb, uint8_t* destaddr_msb) { return TarvosIII_Handle_GetDefaultDestAddr(DEFAULT_HANDLE, destaddr_lsb, destaddr_msb); }
+
+bool TarvosIII_GetDefaultDestNetID(uint8_t* destnetid) { return TarvosIII_Handle_GetDefaultDestNetID(DEFAULT_HANDLE, destnetid); }
+
+bool TarvosIII_GetSourceAddr(uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb) { return TarvosIII_Handle_GetSourceAddr(DEFAULT_HANDLE, srcaddr_lsb, srcaddr_msb); }
+
+bool TarvosIII_GetSourceNetID(uint8_t* srcnetid) { return TarvosIII_Handle_GetSourceNetID(DEFAULT_HANDLE, srcnetid); }
+
+bool TarvosIII_GetDefaultRFChannel(uint8_t* channel) { return TarvosIII_Handle_GetDefaultRFChannel(DEFAULT_HANDLE, channel); }
+
+bool TarvosIII_GetDefaultRFProfile(uint8_t* profile) { return TarvosIII_Handle_GetDefaultRFProfile(DEFAULT_HANDLE, profile); }
+
+bool TarvosIII_GetLBTObservationPeriod(uint8_t* period) { return TarvosIII_Handle_GetLBTObservationPeriod(DEFAULT_HANDLE, period); }
+
+bool TarvosIII_GetLBTThreshold(int8_t* threshold) { return TarvosIII_Handle_GetLBTThreshold(DEFAULT_HANDLE, threshold); }
+
+bool TarvosIII_SetDefaultTXPower(uint8_t txpower) { return TarvosIII_Handle_SetDefaultTXPower(DEFAULT_HANDLE, txpower); }
+
+bool TarvosIII_SetDefaultDestAddr(uint8_t destaddr_lsb, uint8_t destaddr_msb) { return TarvosIII_Handle_SetDefaultDestAddr(DEFAULT_HANDLE, destaddr_lsb, destaddr_msb); }
+
+bool TarvosIII_SetDefaultDestNetID(uint8_t destnetid) { return TarvosIII_Handle_SetDefaultDestNetID(DEFAULT_HANDLE, destnetid); }
+
+bool TarvosIII_SetSourceAddr(uint8_t srcaddr_lsb, uint8_t srcaddr_msb) { return TarvosIII_Handle_SetSourceAddr(DEFAULT_HANDLE, srcaddr_lsb, srcaddr_msb); }
+
+bool TarvosIII_SetSourceNetID(uint8_t srcnetid) { return TarvosIII_Handle_SetSourceNetID(DEFAULT_HANDLE, srcnetid); }
+
+bool TarvosIII_SetDefaultRFChannel(uint8_t channel) { return TarvosIII_Handle_SetDefaultRFChannel(DEFAULT_HANDLE, channel); }
+
+bool TarvosIII_SetDefaultRFProfile(uint8_t profile) { return TarvosIII_Handle_SetDefaultRFProfile(DEFAULT_HANDLE, profile); }
+
+bool TarvosIII_SetLBTObservationPeriod(uint8_t period) { return TarvosIII_Handle_SetLBTObservationPeriod(DEFAULT_HANDLE, period); }
+
+bool TarvosIII_SetLBTThreshold(int8_t threshold) { return TarvosIII_Handle_SetLBTThreshold(DEFAULT_HANDLE, threshold); }
+
+bool TarvosIII_EnableSnifferMode() { return TarvosIII_Handle_EnableSnifferMode(DEFAULT_HANDLE); }
+
+bool TarvosIII_SetVolatile_TXPower(uint8_t power) { return TarvosIII_Handle_SetVolatile_TXPower(DEFAULT_HANDLE, power); }
+
+bool TarvosIII_SetVolatile_Channel(uint8_t channel) { return TarvosIII_Handle_SetVolatile_Channel(DEFAULT_HANDLE, channel); }
+
+bool TarvosIII_SetVolatile_DestNetID(uint8_t destnetid) { return TarvosIII_Handle_SetVolatile_DestNetID(DEFAULT_HANDLE, destnetid); }
+
+bool TarvosIII_SetVolatile_DestAddr(uint8_t destaddr_lsb, uint8_t destaddr_msb) { return TarvosIII_Handle_SetVolatile_DestAddr(DEFAULT_HANDLE, destaddr_lsb, destaddr_msb); }
+
+bool TarvosIII_Transmit(uint8_t* payload, uint8_t length) { return TarvosIII_Handle_Transmit(DEFAULT_HANDLE, payload, length); }
+
+bool TarvosIII_Transmit_Extended(uint8_t* payload, uint8_t length, uint8_t channel, uint8_t dest_network_id, uint8_t dest_address_lsb, uint8_t dest_address_msb) { return TarvosIII_Handle_Transmit_Extended(DEFAULT_HANDLE, payload, length, channel, dest_network_id, dest_address_lsb, dest_address_msb); }
+
+bool TarvosIII_Ping() { return TarvosIII_Handle_Ping(DEFAULT_HANDLE); }
+
+bool TarvosIII_Configure(TarvosIII_Configuration_t* config, uint8_t config_length, bool factory_reset) { return TarvosIII_Handle_Configure(DEFAULT_HANDLE, config, config_length, factory_reset); }
+
+uint32_t TarvosIII_GetConfirmationOverflowCount() { return TarvosIII_Handle_GetConfirmationOverflowCount(DEFAULT_HANDLE); }
+
+#if defined(WE_STATS_ENABLED)
+bool TarvosIII_GetStatistics(WE_Stats_t* statsP) { return TarvosIII_Handle_GetStatistics(DEFAULT_HANDLE, statsP); }
+
+void TarvosIII_ResetStatistics() { TarvosIII_Handle_ResetStatistics(DEFAULT_HANDLE); }
+#endif
@@ -29,6 +29,7 @@
  */
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -93,6 +94,47 @@ typedef struct TarvosIII_Configuration_t
     uint8_t value_length;                            /**< length of the value */
 } TarvosIII_Configuration_t;
 
+#ifndef TARVOSIII_MAX_INSTANCES
+/**
+ * @brief Max. number of Tarvos-III modules that can be driven at the same time (see TarvosIII_GetHandle()).
+ */
+#define TARVOSIII_MAX_INSTANCES 1
+#endif
+
+/**
+ * @brief Is called when a request sent using one of the *Async() functions has been completed.
+ *
+ * Is called from the context processing the received data, or from TarvosIII_CheckAsyncTimeouts()
+ * in case of a timeout.
+ *
+ * @param[in] success: True if the confirmation has been received with status success, false otherwise (e.g. timeout)
+ * @param[in] dataP: Payload of the confirmation (status byte followed by the response data, NULL on timeout)
+ * @param[in] length: Length of the payload
+ *
+ * @return None
+ */
+typedef void (*TarvosIII_AsyncCallback_t)(bool success, uint8_t* dataP, uint16_t length);
+
+/**
+ * @brief Handle of a driver instance (opaque).
+ *
+ * Each instance holds its own state (UART, pins, callbacks, receive buffers), so
+ * several Tarvos-III modules connected to different UARTs can be used at the same time.
+ * The functions without handle parameter operate on the instance with index 0.
+ * Note that callbacks don't receive the handle - use different callback functions
+ * for each instance if needed.
+ */
+typedef struct TarvosIII_Handle_t TarvosIII_Handle_t;
+
+/**
+ * @brief Returns the handle of a driver instance.
+ *
+ * @param[in] index: Index of instance (0 to TARVOSIII_MAX_INSTANCES - 1, 0 is the default instance)
+ *
+ * @return Handle of the instance or NULL if index is out of range
+ */
+extern TarvosIII_Handle_t* TarvosIII_GetHandle(uint8_t index);
+
 /**
  * @brief Initialize the TarvosIII for serial interface.
  *
@@ -219,6 +261,17 @@ extern bool TarvosIII_PinWakeup(bool standby);
 */
 extern bool TarvosIII_Get(TarvosIII_UserSettings_t us, uint8_t* response, uint8_t* response_length);
 
+/**
+* @brief Request the current TarvosIII settings without waiting for the response
+ *
+ * @param[in] us: user setting to be requested
+ * @param[in] cb: Function called with the requested content when the response has been received
+ *
+ * @return True if request has been sent,
+ *         false otherwise (e.g. too many pending asynchronous requests)
+*/
+extern bool TarvosIII_GetAsync(TarvosIII_UserSettings_t us, TarvosIII_AsyncCallback_t cb);
+
 /**
 * @brief Request the 3 byte firmware version
  *
@@ -361,6 +414,30 @@ extern bool TarvosIII_FactoryReset(void);
 */
 extern bool TarvosIII_Set(TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length);
 
+/**
+* @brief Set a special user setting without waiting for the confirmation.
+ * See TarvosIII_Set
+ *
+ * @param[in] us: user setting to be updated
+ * @param[in] value: Pointer to the new settings value
+ * @param[in] length: Length of the value
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+*/
+extern bool TarvosIII_SetAsync(TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length, TarvosIII_AsyncCallback_t cb);
+
+/**
+* @brief Completes pending asynchronous requests that haven't been confirmed in time
+ *
+ * Timeouts are also checked whenever a request is sent or a confirmation is received,
+ * so this function only needs to be called periodically if no further requests are sent.
+ *
+ * @return None
+*/
+extern void TarvosIII_CheckAsyncTimeouts();
+
 /**
 * @brief Set a special user setting, but checks first if the value is already ok
  *
@@ -575,6 +652,89 @@ extern bool TarvosIII_SetVolatile_Channel(uint8_t channel);
 */
 extern bool TarvosIII_Ping();
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t TarvosIII_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool TarvosIII_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void TarvosIII_ResetStatistics();
+#endif
+
+/**
+ * @name Functions operating on a specific driver instance
+ *
+ * Same as the corresponding functions without handle parameter (e.g. TarvosIII_Handle_Init() is
+ * the same as TarvosIII_Init()), but for the driver instance referenced by handle (see TarvosIII_GetHandle()).
+ * @{
+ */
+extern bool TarvosIII_Handle_Init(TarvosIII_Handle_t* handle, WE_UART_t* uartP, TarvosIII_Pins_t* pinoutP, TarvosIII_AddressMode_t addrmode, void (*RXcb)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t));
+extern bool TarvosIII_Handle_Deinit(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_PinReset(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_Reset(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_Transmit_Extended(TarvosIII_Handle_t* handle, uint8_t* payload, uint8_t length, uint8_t channel, uint8_t dest_network_id, uint8_t dest_address_lsb, uint8_t dest_address_msb);
+extern bool TarvosIII_Handle_Transmit(TarvosIII_Handle_t* handle, uint8_t* payload, uint8_t length);
+extern bool TarvosIII_Handle_Transparent_Transmit(TarvosIII_Handle_t* handle, const uint8_t* data, uint16_t dataLength);
+extern bool TarvosIII_Handle_Shutdown(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_Standby(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_PinWakeup(TarvosIII_Handle_t* handle, bool standby);
+extern bool TarvosIII_Handle_Get(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* response, uint8_t* response_length);
+extern bool TarvosIII_Handle_GetAsync(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, TarvosIII_AsyncCallback_t cb);
+extern bool TarvosIII_Handle_GetFirmwareVersion(TarvosIII_Handle_t* handle, uint8_t* fw);
+extern bool TarvosIII_Handle_GetSerialNumber(TarvosIII_Handle_t* handle, uint8_t* sn);
+extern bool TarvosIII_Handle_GetDefaultTXPower(TarvosIII_Handle_t* handle, uint8_t* txpower);
+extern bool TarvosIII_Handle_GetSourceAddr(TarvosIII_Handle_t* handle, uint8_t* srcaddr_lsb, uint8_t* srcaddr_msb);
+extern bool TarvosIII_Handle_GetSourceNetID(TarvosIII_Handle_t* handle, uint8_t* srcnetid);
+extern bool TarvosIII_Handle_GetDefaultDestAddr(TarvosIII_Handle_t* handle, uint8_t* destaddr_lsb, uint8_t* destaddr_msb);
+extern bool TarvosIII_Handle_GetDefaultDestNetID(TarvosIII_Handle_t* handle, uint8_t* destnetid);
+extern bool TarvosIII_Handle_GetDefaultRFChannel(TarvosIII_Handle_t* handle, uint8_t* channel);
+extern bool TarvosIII_Handle_GetDefaultRFProfile(TarvosIII_Handle_t* handle, uint8_t* profile);
+extern bool TarvosIII_Handle_GetLBTObservationPeriod(TarvosIII_Handle_t* handle, uint8_t* period);
+extern bool TarvosIII_Handle_GetLBTThreshold(TarvosIII_Handle_t* handle, int8_t* threshold);
+extern bool TarvosIII_Handle_FactoryReset(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_Set(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length);
+extern bool TarvosIII_Handle_SetAsync(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t us, uint8_t* value, uint8_t length, TarvosIII_AsyncCallback_t cb);
+extern void TarvosIII_Handle_CheckAsyncTimeouts(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_CheckNSet(TarvosIII_Handle_t* handle, TarvosIII_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool TarvosIII_Handle_Configure(TarvosIII_Handle_t* handle, TarvosIII_Configuration_t* config, uint8_t config_length, bool factory_reset);
+extern bool TarvosIII_Handle_SetDefaultTXPower(TarvosIII_Handle_t* handle, uint8_t txpower);
+extern bool TarvosIII_Handle_SetSourceAddr(TarvosIII_Handle_t* handle, uint8_t srcaddr_lsb, uint8_t srcaddr_msb);
+extern bool TarvosIII_Handle_SetSourceNetID(TarvosIII_Handle_t* handle, uint8_t srcnetid);
+extern bool TarvosIII_Handle_SetDefaultDestAddr(TarvosIII_Handle_t* handle, uint8_t destaddr_lsb, uint8_t destaddr_msb);
+extern bool TarvosIII_Handle_SetDefaultDestNetID(TarvosIII_Handle_t* handle, uint8_t destnetid);
+extern bool TarvosIII_Handle_SetDefaultRFChannel(TarvosIII_Handle_t* handle, uint8_t channel);
+extern bool TarvosIII_Handle_SetDefaultRFProfile(TarvosIII_Handle_t* handle, uint8_t profile);
+extern bool TarvosIII_Handle_SetLBTObservationPeriod(TarvosIII_Handle_t* handle, uint8_t period);
+extern bool TarvosIII_Handle_SetLBTThreshold(TarvosIII_Handle_t* handle, int8_t threshold);
+extern bool TarvosIII_Handle_EnableSnifferMode(TarvosIII_Handle_t* handle);
+extern bool TarvosIII_Handle_SetVolatile_DestAddr(TarvosIII_Handle_t* handle, uint8_t destaddr_lsb, uint8_t destaddr_msb);
+extern bool TarvosIII_Handle_SetVolatile_DestNetID(TarvosIII_Handle_t* handle, uint8_t destnetid);
+extern bool TarvosIII_Handle_SetVolatile_TXPower(TarvosIII_Handle_t* handle, uint8_t power);
+extern bool TarvosIII_Handle_SetVolatile_Channel(TarvosIII_Handle_t* handle, uint8_t channel);
+extern bool TarvosIII_Handle_Ping(TarvosIII_Handle_t* handle);
+extern uint32_t TarvosIII_Handle_GetConfirmationOverflowCount(TarvosIII_Handle_t* handle);
+#if defined(WE_STATS_ENABLED)
+extern bool TarvosIII_Handle_GetStatistics(TarvosIII_Handle_t* handle, WE_Stats_t* statsP);
+extern void TarvosIII_Handle_ResetStatistics(TarvosIII_Handle_t* handle);
+#endif
+/** @} */
+
 #endif // TARVOSIII_H_INCLUDED
 
 #ifdef __cplusplus
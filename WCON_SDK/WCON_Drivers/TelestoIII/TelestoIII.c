@@ -29,6 +29,7 @@
  */
 
 #include <TelestoIII/TelestoIII.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -139,12 +140,6 @@ typedef struct
     uint8_t Data[MAX_DATA_BUFFER + 1]; /* +1 for the CS */
 } TelestoIII_CMD_Frame_t;
 
-typedef struct
-{
-    uint8_t cmd;                    /* variable to check if correct CMD has been confirmed */
-    TelestoIII_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the TelestoIII */
-} TelestoIII_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
@@ -152,8 +147,10 @@ typedef struct
 static TelestoIII_CMD_Frame_t rxPacket;                                 /* data buffer for RX */
 static TelestoIII_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
 
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static TelestoIII_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see TelestoIII_GetStatistics()) */
+#endif
 static uint8_t channelVolatile = CHANNELINVALID;                        /* variable used to check if setting the channel was successful */
 static uint8_t powerVolatile = TXPOWERINVALID;                          /* variable used to check if setting the TXPower was successful */
 static TelestoIII_AddressMode_t addressmode = TelestoIII_AddressMode_0; /* initial address mode */
@@ -166,9 +163,7 @@ static TelestoIII_Pins_t* TelestoIII_pinsP = NULL;
  * @brief Uart configuration struct pointer.
  */
 static WE_UART_t* TelestoIII_uartP = NULL;
-uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint8_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(TelestoIII_CMD_Frame_t)];                         /* data buffer for RX */
 static void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t); /* callback function */
 
@@ -176,115 +171,110 @@ static void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t);
  *         Static functions           *
  **************************************/
 
-/**
- * @brief Interpret the valid received UART data packet
- */
-static void HandleRxPacket(uint8_t* rxBuffer)
+static void HandleResetInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    TelestoIII_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->status = CMD_Status_Success;
+    confirmation->cmd = frame->cmd;
+}
 
-    uint8_t cmd_length = rxBuffer[2];
-    memcpy((uint8_t*)&rxPacket, rxBuffer, cmd_length + 4);
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
 
-    switch (rxPacket.Cmd)
+static void HandleDataExInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* data received, give it to the RxCallback function */
+    if (RxCallback != NULL)
     {
-        case TELESTOIII_CMD_RESET_IND:
-        case TELESTOIII_CMD_STANDBY_IND:
+        switch (addressmode)
         {
-            cmdConfirmation.status = CMD_Status_Success;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TelestoIII_AddressMode_0:
+            {
+                RxCallback(&frame->data[0], frame->length - 1, TELESTOIII_BROADCASTADDRESS, TELESTOIII_BROADCASTADDRESS, TELESTOIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case TELESTOIII_CMD_FACTORY_RESET_CNF:
-        case TELESTOIII_CMD_RESET_CNF:
-        case TELESTOIII_CMD_SHUTDOWN_CNF:
-        case TELESTOIII_CMD_STANDBY_CNF:
-        case TELESTOIII_CMD_DATA_CNF:
-        case TELESTOIII_CMD_GET_CNF:
-        case TELESTOIII_CMD_SET_CNF:
-        case TELESTOIII_CMD_SET_DESTADDR_CNF:
-        case TELESTOIII_CMD_SET_DESTNETID_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TelestoIII_AddressMode_1:
+            {
+                RxCallback(&frame->data[1], frame->length - 2, TELESTOIII_BROADCASTADDRESS, frame->data[0], TELESTOIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case TELESTOIII_CMD_DATAEX_IND:
-        {
-            /* data received, give it to the RxCallback function */
-            if (RxCallback != NULL)
+            case TelestoIII_AddressMode_2:
             {
-                switch (addressmode)
-                {
-                    case TelestoIII_AddressMode_0:
-                    {
-                        RxCallback(&rxPacket.Data[0], rxPacket.Length - 1, TELESTOIII_BROADCASTADDRESS, TELESTOIII_BROADCASTADDRESS, TELESTOIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TelestoIII_AddressMode_1:
-                    {
-                        RxCallback(&rxPacket.Data[1], rxPacket.Length - 2, TELESTOIII_BROADCASTADDRESS, rxPacket.Data[0], TELESTOIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TelestoIII_AddressMode_2:
-                    {
-                        RxCallback(&rxPacket.Data[2], rxPacket.Length - 3, rxPacket.Data[0], rxPacket.Data[1], TELESTOIII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case TelestoIII_AddressMode_3:
-                    {
-                        RxCallback(&rxPacket.Data[3], rxPacket.Length - 4, rxPacket.Data[0], rxPacket.Data[1], rxPacket.Data[2], (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    default:
-                        /* wrong address mode */
-                        break;
-                }
+                RxCallback(&frame->data[2], frame->length - 3, frame->data[0], frame->data[1], TELESTOIII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
             }
-        }
-        break;
+            break;
 
-        case TELESTOIII_CMD_SET_CHANNEL_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
-        case TELESTOIII_CMD_SET_PAPOWER_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case TelestoIII_AddressMode_3:
+            {
+                RxCallback(&frame->data[3], frame->length - 4, frame->data[0], frame->data[1], frame->data[2], (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-            /* for internal use only */
-        case TELESTOIII_CMD_PINGDUT_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
+            default:
+                /* wrong address mode */
+                break;
         }
-        break;
-
-        default:
-            break;
     }
+}
+
+static void HandleSetChannelCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandleSetPaPowerCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandlePingDutCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* for internal use only */
+    confirmation->status = (frame->data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [TELESTOIII_CMD_RESET_IND]         = HandleResetInd,
+    [TELESTOIII_CMD_STANDBY_IND]       = HandleResetInd,
+    [TELESTOIII_CMD_FACTORY_RESET_CNF] = HandleStatusCnf,
+    [TELESTOIII_CMD_RESET_CNF]         = HandleStatusCnf,
+    [TELESTOIII_CMD_SHUTDOWN_CNF]      = HandleStatusCnf,
+    [TELESTOIII_CMD_STANDBY_CNF]       = HandleStatusCnf,
+    [TELESTOIII_CMD_DATA_CNF]          = HandleStatusCnf,
+    [TELESTOIII_CMD_GET_CNF]           = HandleStatusCnf,
+    [TELESTOIII_CMD_SET_CNF]           = HandleStatusCnf,
+    [TELESTOIII_CMD_SET_DESTADDR_CNF]  = HandleStatusCnf,
+    [TELESTOIII_CMD_SET_DESTNETID_CNF] = HandleStatusCnf,
+    [TELESTOIII_CMD_DATAEX_IND]        = HandleDataExInd,
+    [TELESTOIII_CMD_SET_CHANNEL_CNF]   = HandleSetChannelCnf,
+    [TELESTOIII_CMD_SET_PAPOWER_CNF]   = HandleSetPaPowerCnf,
+    [TELESTOIII_CMD_PINGDUT_CNF]       = HandlePingDutCnf,
+};
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
+
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if (cmdConfirmation.cmd != CNFINVALID)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
@@ -293,111 +283,37 @@ static void HandleRxPacket(uint8_t* rxBuffer)
  */
 static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, TelestoIII_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    int count = 0;
-    int time_step_ms = 5; /* 5ms */
-    int max_count = max_time_ms / time_step_ms;
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
 
-        if (count >= max_count)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(time_step_ms);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet
  */
 static void FillChecksum(TelestoIII_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-
-    for (uint8_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
 }
 
 void TelestoIII_HandleRxByte(uint8_t* dataP, size_t size)
 {
-    for (; size > 0; size--, dataP++)
-    {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = (rxBuffer[rxByteCounter - 1] + 4); /* len + crc + sfd + cmd */
-                break;
-
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint8_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
-    }
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
 }
 
 /**************************************
@@ -411,6 +327,9 @@ bool TelestoIII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
         return false;
     }
 
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return TelestoIII_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -450,6 +369,13 @@ bool TelestoIII_Init(WE_UART_t* uartP, TelestoIII_Pins_t* pinoutP, TelestoIII_Ad
         return false;
     }
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     TelestoIII_uartP = uartP;
     if (!TelestoIII_uartP->uartInit(TelestoIII_uartP->baudrate, TelestoIII_uartP->flowControl, TelestoIII_uartP->parity, &byteRxCallback))
     {
@@ -502,11 +428,7 @@ bool TelestoIII_PinWakeup(bool standby)
 
     WE_Delay(5);
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmation_array[i].status = CMD_Status_Invalid;
-        cmdConfirmation_array[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 
     if (!WE_SetPin(TelestoIII_pinsP->TelestoIII_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
@@ -611,6 +533,7 @@ bool TelestoIII_Get(TelestoIII_UserSettings_t us, uint8_t* response, uint8_t* re
     txPacket.Length = 0x01;
     txPacket.Data[0] = us;
 
+    ExpectResponse(TELESTOIII_CMD_GET_CNF);
     FillChecksum(&txPacket);
 
     if (!TelestoIII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1211,3 +1134,11 @@ bool TelestoIII_Configure(TelestoIII_Configuration_t* config, uint8_t config_len
     /* reset to take effect of the updated parameters */
     return TelestoIII_PinReset();
 }
+
+uint32_t TelestoIII_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool TelestoIII_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, TelestoIII_uartP, statsP); }
+
+void TelestoIII_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
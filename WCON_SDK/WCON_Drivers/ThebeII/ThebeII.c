@@ -28,6 +28,7 @@
  * @brief Thebe-II driver source file.
  */
 #include <ThebeII/ThebeII.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
@@ -138,12 +139,6 @@ typedef struct
     uint8_t Data[MAX_DATA_BUFFER + 1]; /* +1 for the CS */
 } ThebeII_CMD_Frame_t;
 
-typedef struct
-{
-    uint8_t cmd;                 /* variable to check if correct CMD has been confirmed */
-    ThebeII_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ThebeII */
-} ThebeII_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
@@ -151,8 +146,10 @@ typedef struct
 static ThebeII_CMD_Frame_t rxPacket;                                 /* data buffer for RX */
 static ThebeII_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
 
-#define CMDCONFIRMATIONARRAY_LENGTH 2
-static ThebeII_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see ThebeII_GetStatistics()) */
+#endif
 static uint8_t channelVolatile = CHANNELINVALID;                  /* variable used to check if setting the channel was successful */
 static uint8_t powerVolatile = TXPOWERINVALID;                    /* variable used to check if setting the TXPower was successful */
 static ThebeII_AddressMode_t addressmode = ThebeII_AddressMode_0; /* initial address mode */
@@ -165,9 +162,7 @@ static ThebeII_Pins_t* ThebeII_pinsP = NULL;
  * @brief Uart configuration struct pointer.
  */
 static WE_UART_t* ThebeII_uartP = NULL;
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint8_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(ThebeII_CMD_Frame_t)];                            /* data buffer for RX */
 static void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t); /* callback function */
 
@@ -175,117 +170,110 @@ static void (*RxCallback)(uint8_t*, uint8_t, uint8_t, uint8_t, uint8_t, int8_t);
  *         Static functions           *
  **************************************/
 
-/**
- * @brief Interpret the valid received UART data packet.
- */
-static void HandleRxPacket(uint8_t* rxBuffer)
+static void HandleResetInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ThebeII_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->status = CMD_Status_Success;
+    confirmation->cmd = frame->cmd;
+}
 
-    uint8_t cmd_length = rxBuffer[2];
-    memcpy((uint8_t*)&rxPacket, rxBuffer, cmd_length + 4);
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
 
-    switch (rxPacket.Cmd)
+static void HandleDataExInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* data received, give it to the RxCallback function */
+    if (RxCallback != NULL)
     {
-
-        case THEBEII_CMD_RESET_IND:
-        case THEBEII_CMD_STANDBY_IND:
+        switch (addressmode)
         {
-            cmdConfirmation.status = CMD_Status_Success;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case ThebeII_AddressMode_0:
+            {
+                RxCallback(&frame->data[0], frame->length - 1, THEBEII_BROADCASTADDRESS, THEBEII_BROADCASTADDRESS, THEBEII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case THEBEII_CMD_FACTORY_RESET_CNF:
-        case THEBEII_CMD_RESET_CNF:
-        case THEBEII_CMD_SHUTDOWN_CNF:
-        case THEBEII_CMD_STANDBY_CNF:
-        case THEBEII_CMD_DATA_CNF:
-        case THEBEII_CMD_GET_CNF:
-        case THEBEII_CMD_SET_DESTADDR_CNF:
-        case THEBEII_CMD_SET_DESTNETID_CNF:
-        case THEBEII_CMD_SET_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == 0x00) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case ThebeII_AddressMode_1:
+            {
+                RxCallback(&frame->data[1], frame->length - 2, THEBEII_BROADCASTADDRESS, frame->data[0], THEBEII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case THEBEII_CMD_DATAEX_IND:
-        {
-            /* data received, give it to the RxCallback function */
-            if (RxCallback != NULL)
+            case ThebeII_AddressMode_2:
             {
-                switch (addressmode)
-                {
-                    case ThebeII_AddressMode_0:
-                    {
-                        RxCallback(&rxPacket.Data[0], rxPacket.Length - 1, THEBEII_BROADCASTADDRESS, THEBEII_BROADCASTADDRESS, THEBEII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case ThebeII_AddressMode_1:
-                    {
-                        RxCallback(&rxPacket.Data[1], rxPacket.Length - 2, THEBEII_BROADCASTADDRESS, rxPacket.Data[0], THEBEII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case ThebeII_AddressMode_2:
-                    {
-                        RxCallback(&rxPacket.Data[2], rxPacket.Length - 3, rxPacket.Data[0], rxPacket.Data[1], THEBEII_BROADCASTADDRESS, (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    case ThebeII_AddressMode_3:
-                    {
-                        RxCallback(&rxPacket.Data[3], rxPacket.Length - 4, rxPacket.Data[0], rxPacket.Data[1], rxPacket.Data[2], (int8_t)rxPacket.Data[rxPacket.Length - 1]);
-                    }
-                    break;
-
-                    default:
-                        /* wrong address mode */
-                        break;
-                }
+                RxCallback(&frame->data[2], frame->length - 3, frame->data[0], frame->data[1], THEBEII_BROADCASTADDRESS, (int8_t)frame->data[frame->length - 1]);
             }
-        }
-        break;
+            break;
 
-        case THEBEII_CMD_SET_CHANNEL_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+            case ThebeII_AddressMode_3:
+            {
+                RxCallback(&frame->data[3], frame->length - 4, frame->data[0], frame->data[1], frame->data[2], (int8_t)frame->data[frame->length - 1]);
+            }
+            break;
 
-        case THEBEII_CMD_SET_PAPOWER_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[0] == powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
+            default:
+                /* wrong address mode */
+                break;
         }
-        break;
+    }
+}
 
-            /* for internal use only */
-        case THEBEII_CMD_PINGDUT_CNF:
-        {
-            cmdConfirmation.status = (rxPacket.Data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
-            cmdConfirmation.cmd = rxPacket.Cmd;
-        }
-        break;
+static void HandleSetChannelCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == channelVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
 
-        default:
-            break;
-    }
+static void HandleSetPaPowerCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->status = (frame->data[0] == powerVolatile) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+static void HandlePingDutCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    /* for internal use only */
+    confirmation->status = (frame->data[4] == 0x0A) ? CMD_Status_Success : CMD_Status_Failed;
+    confirmation->cmd = frame->cmd;
+}
+
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [THEBEII_CMD_RESET_IND]         = HandleResetInd,
+    [THEBEII_CMD_STANDBY_IND]       = HandleResetInd,
+    [THEBEII_CMD_FACTORY_RESET_CNF] = HandleStatusCnf,
+    [THEBEII_CMD_RESET_CNF]         = HandleStatusCnf,
+    [THEBEII_CMD_SHUTDOWN_CNF]      = HandleStatusCnf,
+    [THEBEII_CMD_STANDBY_CNF]       = HandleStatusCnf,
+    [THEBEII_CMD_DATA_CNF]          = HandleStatusCnf,
+    [THEBEII_CMD_GET_CNF]           = HandleStatusCnf,
+    [THEBEII_CMD_SET_DESTADDR_CNF]  = HandleStatusCnf,
+    [THEBEII_CMD_SET_DESTNETID_CNF] = HandleStatusCnf,
+    [THEBEII_CMD_SET_CNF]           = HandleStatusCnf,
+    [THEBEII_CMD_DATAEX_IND]        = HandleDataExInd,
+    [THEBEII_CMD_SET_CHANNEL_CNF]   = HandleSetChannelCnf,
+    [THEBEII_CMD_SET_PAPOWER_CNF]   = HandleSetPaPowerCnf,
+    [THEBEII_CMD_PINGDUT_CNF]       = HandlePingDutCnf,
+};
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
+
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
+
+    if (cmdConfirmation.cmd != CNFINVALID)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
@@ -294,111 +282,37 @@ static void HandleRxPacket(uint8_t* rxBuffer)
  */
 static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, ThebeII_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    int count = 0;
-    int time_step_ms = 5; /* 5ms */
-    int max_count = max_time_ms / time_step_ms;
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
 
-        if (count >= max_count)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
-
-        /* wait */
-        count++;
-        WE_Delay(time_step_ms);
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet
  */
 static void FillChecksum(ThebeII_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-
-    for (uint8_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
 }
 
 void ThebeII_HandleRxByte(uint8_t* dataP, size_t size)
 {
-    for (; size > 0; size--, dataP++)
-    {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field */
-                rxByteCounter++;
-                bytesToReceive = (rxBuffer[rxByteCounter - 1] + 4); /* len + crc + sfd + cmd */
-                break;
-
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint8_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
-    }
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
 }
 
 /**************************************
@@ -411,6 +325,9 @@ bool ThebeII_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
         return false;
     }
 
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return ThebeII_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -450,6 +367,13 @@ bool ThebeII_Init(WE_UART_t* uartP, ThebeII_Pins_t* pinoutP, ThebeII_AddressMode
         return false;
     }
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     ThebeII_uartP = uartP;
     if (!ThebeII_uartP->uartInit(ThebeII_uartP->baudrate, ThebeII_uartP->flowControl, ThebeII_uartP->parity, &byteRxCallback))
     {
@@ -501,11 +425,7 @@ bool ThebeII_PinWakeup(bool standby)
 
     WE_Delay(5);
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmation_array[i].status = CMD_Status_Invalid;
-        cmdConfirmation_array[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
 
     if (!WE_SetPin(ThebeII_pinsP->ThebeII_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
@@ -609,6 +529,7 @@ bool ThebeII_Get(ThebeII_UserSettings_t us, uint8_t* response, uint8_t* response
     txPacket.Length = 0x01;
     txPacket.Data[0] = us;
 
+    ExpectResponse(THEBEII_CMD_GET_CNF);
     FillChecksum(&txPacket);
 
     if (!ThebeII_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1208,3 +1129,11 @@ bool ThebeII_Configure(ThebeII_Configuration_t* config, uint8_t config_length, b
     /* reset to take effect of the updated parameters */
     return ThebeII_PinReset();
 }
+
+uint32_t ThebeII_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ThebeII_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, ThebeII_uartP, statsP); }
+
+void ThebeII_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
@@ -29,12 +29,12 @@
  */
 
 #include <ThyoneE/ThyoneE.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
 
 #define CMD_WAIT_TIME 1500
-#define CMD_WAIT_TIME_STEP_MS 0
 #define CNFINVALID 255
 
 /* Normal overhead: Start signal + Command + Length + CS = 1+1+2+1=5 bytes */
@@ -171,12 +171,6 @@ typedef enum ThyoneE_CMD_Status_t
     CMD_Status_NoStatus,
 } ThyoneE_CMD_Status_t;
 
-typedef struct
-{
-    uint8_t cmd;                 /* variable to check if correct CMD has been confirmed */
-    ThyoneE_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ThyoneE */
-} ThyoneE_CMD_Confirmation_t;
-
 /**************************************
  *          Static variables          *
  **************************************/
@@ -184,8 +178,10 @@ static ThyoneE_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request
 static ThyoneE_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
 ;
 
-#define CMDCONFIRMATIONARRAY_LENGTH 3
-static ThyoneE_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
+static CMDFrame_ConfirmationQueue_t cmdConfirmations = {0}; /* received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+static WE_Stats_t stats = {0}; /* performance counters and latency histograms (see ThyoneE_GetStatistics()) */
+#endif
 /**
  * @brief Pin configuration struct pointer.
  */
@@ -195,9 +191,7 @@ static ThyoneE_Pins_t* ThyoneE_pinsP = NULL;
  */
 static WE_UART_t* ThyoneE_uartP = NULL;
 
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
+static CMDFrame_Parser_t rxParser; /* assembles the frames received from the module */
 static uint8_t rxBuffer[sizeof(ThyoneE_CMD_Frame_t)];            /* For UART RX from module */
 static void (*RxCallback)(uint8_t*, uint16_t, uint32_t, int8_t); /* callback function */
 static ThyoneE_OperationMode_t operationMode = ThyoneE_OperationMode_CommandMode;
@@ -206,95 +200,88 @@ static ThyoneE_OperationMode_t operationMode = ThyoneE_OperationMode_CommandMode
  *         Static functions           *
  **************************************/
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+static void HandleNoStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ThyoneE_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->cmd = frame->cmd;
+    confirmation->status = CMD_Status_NoStatus;
+}
 
-    uint16_t cmdLength = ((ThyoneE_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
 
-    switch (rxPacket.Cmd)
-    {
-        case THYONEE_CMD_RESET_CNF:
-        case THYONEE_CMD_START_IND:
-        case THYONEE_CMD_GPIO_REMOTE_GETCONFIG_RSP:
-        case THYONEE_CMD_GPIO_REMOTE_READ_RSP:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = CMD_Status_NoStatus;
-            break;
-        }
+static void HandleGpioRemoteReadCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = CMD_Status_Invalid;
+}
 
-        case THYONEE_CMD_DATA_CNF:
-        case THYONEE_CMD_GET_CNF:
-        case THYONEE_CMD_SET_CNF:
-        case THYONEE_CMD_GETRAM_CNF:
-        case THYONEE_CMD_SETRAM_CNF:
-        case THYONEE_CMD_SETCHANNEL_CNF:
-        case THYONEE_CMD_FACTORYRESET_CNF:
-        case THYONEE_CMD_SLEEP_CNF:
-        case THYONEE_CMD_GPIO_LOCAL_SETCONFIG_CNF:
-        case THYONEE_CMD_GPIO_LOCAL_GETCONFIG_CNF:
-        case THYONEE_CMD_GPIO_LOCAL_WRITE_CNF:
-        case THYONEE_CMD_GPIO_LOCAL_READ_CNF:
-        case THYONEE_CMD_GPIO_REMOTE_SETCONFIG_CNF:
-        case THYONEE_CMD_GPIO_REMOTE_GETCONFIG_CNF:
-        case THYONEE_CMD_GPIO_REMOTE_WRITE_CNF:
-        case THYONEE_CMD_TXCOMPLETE_RSP:
-        case THYONEE_CMD_GETSTATE_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            break;
-        }
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (RxCallback != NULL)
+    {
+        uint32_t src_address;
+        memcpy(&src_address, &frame->data[0], 4);
+        RxCallback(&frame->data[5], frame->length - 5, src_address, frame->data[4]);
+    }
+}
 
-        case THYONEE_CMD_GPIO_REMOTE_READ_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = CMD_Status_Invalid;
+static void HandleSnifferInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    if (RxCallback != NULL)
+    {
+        uint32_t src_address;
+        memcpy(&src_address, &frame->data[0], 4);
+        RxCallback(&frame->data[6], frame->length - 6, src_address, frame->data[4]);
+    }
+}
 
-            break;
-        }
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [THYONEE_CMD_RESET_CNF]                 = HandleNoStatusCnf,
+    [THYONEE_CMD_START_IND]                 = HandleNoStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_GETCONFIG_RSP] = HandleNoStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_READ_RSP]      = HandleNoStatusCnf,
+    [THYONEE_CMD_DATA_CNF]                  = HandleStatusCnf,
+    [THYONEE_CMD_GET_CNF]                   = HandleStatusCnf,
+    [THYONEE_CMD_SET_CNF]                   = HandleStatusCnf,
+    [THYONEE_CMD_GETRAM_CNF]                = HandleStatusCnf,
+    [THYONEE_CMD_SETRAM_CNF]                = HandleStatusCnf,
+    [THYONEE_CMD_SETCHANNEL_CNF]            = HandleStatusCnf,
+    [THYONEE_CMD_FACTORYRESET_CNF]          = HandleStatusCnf,
+    [THYONEE_CMD_SLEEP_CNF]                 = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_LOCAL_SETCONFIG_CNF]  = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_LOCAL_GETCONFIG_CNF]  = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_LOCAL_WRITE_CNF]      = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_LOCAL_READ_CNF]       = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_SETCONFIG_CNF] = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_GETCONFIG_CNF] = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_WRITE_CNF]     = HandleStatusCnf,
+    [THYONEE_CMD_TXCOMPLETE_RSP]            = HandleStatusCnf,
+    [THYONEE_CMD_GETSTATE_CNF]              = HandleStatusCnf,
+    [THYONEE_CMD_GPIO_REMOTE_READ_CNF]      = HandleGpioRemoteReadCnf,
+    [THYONEE_CMD_DATA_IND]                  = HandleDataInd,
+    [THYONEE_CMD_SNIFFER_IND]               = HandleSnifferInd,
+};
 
-        case THYONEE_CMD_DATA_IND:
-        {
-            if (RxCallback != NULL)
-            {
-                uint32_t src_address;
-                memcpy(&src_address, &rxPacket.Data[0], 4);
-                RxCallback(&rxPacket.Data[5], rxPacket.Length - 5, src_address, rxPacket.Data[4]);
-            }
-            break;
-        }
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-        case THYONEE_CMD_SNIFFER_IND:
-        {
-            if (RxCallback != NULL)
-            {
-                uint32_t src_address;
-                memcpy(&src_address, &rxPacket.Data[0], 4);
-                RxCallback(&rxPacket.Data[6], rxPacket.Length - 6, src_address, rxPacket.Data[4]);
-            }
-            break;
-        }
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
 
-        default:
-        {
-            /* invalid*/
-            break;
-        }
-    }
-
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+    if (cmdConfirmation.cmd != CNFINVALID)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
@@ -303,116 +290,37 @@ static void HandleRxPacket(uint8_t* prxBuffer)
  */
 static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, ThyoneE_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    uint32_t t0 = WE_GetTick();
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
-
-        uint32_t now = WE_GetTick();
-        if (now - t0 > max_time_ms)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
 
-        if (CMD_WAIT_TIME_STEP_MS > 0)
-        {
-            /* wait */
-            WE_Delay(CMD_WAIT_TIME_STEP_MS);
-        }
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&cmdConfirmations, expectedCmdConfirmation, &rxPacket, sizeof(rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static void FillChecksum(ThyoneE_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
-    {
-        checksum ^= pArray[i];
-    }
-    cmd->Data[cmd->Length] = checksum;
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
 }
 
 void ThyoneE_HandleRxByte(uint8_t* dataP, size_t size)
 {
-    for (; size > 0; size--, dataP++)
-    {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
-
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
-
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
-
-            case 2:
-                /* length field LSB */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
-
-            case 3:
-                /* length field MSB */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
-
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
-    }
+    CMDFrame_Parser_HandleRxBytes(&rxParser, dataP, size);
 }
 
 /**************************************
@@ -425,6 +333,9 @@ bool ThyoneE_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
         return false;
     }
 
+    WE_STATS_TRANSMIT(&stats, dataLength, data == (const uint8_t*)&txPacket);
+
+    CMDFRAME_STATS_START_REQUEST(&cmdConfirmations, data == (const uint8_t*)&txPacket);
     return ThyoneE_uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
@@ -460,6 +371,13 @@ bool ThyoneE_Init(WE_UART_t* uartP, ThyoneE_Pins_t* pinoutP, ThyoneE_OperationMo
         return false;
     }
 
+    CMDFrame_Parser_Init(&rxParser, CMD_STX, sizeof(rxPacket.Length), rxBuffer, sizeof(rxBuffer), HandleRxPacket, NULL);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&stats);
+    rxParser.stats = &stats;
+    cmdConfirmations.stats = &stats;
+#endif
+
     ThyoneE_uartP = uartP;
     if (false == ThyoneE_uartP->uartInit(ThyoneE_uartP->baudrate, ThyoneE_uartP->flowControl, ThyoneE_uartP->parity, &byteRxCallback))
     {
@@ -869,6 +787,7 @@ bool ThyoneE_GetRam(ThyoneE_RuntimeSettings_t runtimeSetting, uint8_t* responseP
     txPacket.Length = 1;
     txPacket.Data[0] = runtimeSetting;
 
+    ExpectResponse(THYONEE_CMD_GETRAM_CNF);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -900,6 +819,7 @@ bool ThyoneE_Get(ThyoneE_UserSettings_t userSetting, uint8_t* responseP, uint16_
     txPacket.Length = 1;
     txPacket.Data[0] = userSetting;
 
+    ExpectResponse(THYONEE_CMD_GET_CNF);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1059,6 +979,7 @@ bool ThyoneE_GetState(ThyoneE_States_t* state)
     txPacket.Cmd = THYONEE_CMD_GETSTATE_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(THYONEE_CMD_GETSTATE_CNF);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1148,6 +1069,7 @@ bool ThyoneE_GPIOLocalGetConfig(ThyoneE_GPIOConfigBlock_t* configP, uint16_t* nu
     txPacket.Cmd = THYONEE_CMD_GPIO_LOCAL_GETCONFIG_REQ;
     txPacket.Length = 0;
 
+    ExpectResponse(THYONEE_CMD_GPIO_LOCAL_GETCONFIG_CNF);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1262,6 +1184,7 @@ bool ThyoneE_GPIOLocalRead(uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, Thyon
     txPacket.Data[0] = amountGPIOToRead;
     memcpy(&txPacket.Data[1], GPIOToReadP, amountGPIOToRead);
 
+    ExpectResponse(THYONEE_CMD_GPIO_LOCAL_READ_CNF);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1370,6 +1293,7 @@ bool ThyoneE_GPIORemoteGetConfig(uint32_t destAddress, ThyoneE_GPIOConfigBlock_t
     txPacket.Length = 4;
     memcpy(&txPacket.Data[0], &destAddress, 4);
 
+    ExpectResponse(THYONEE_CMD_GPIO_REMOTE_GETCONFIG_RSP);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1491,6 +1415,7 @@ bool ThyoneE_GPIORemoteRead(uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t
     txPacket.Data[4] = amountGPIOToRead;
     memcpy(&txPacket.Data[5], GPIOToReadP, amountGPIOToRead);
 
+    ExpectResponse(THYONEE_CMD_GPIO_REMOTE_READ_RSP);
     FillChecksum(&txPacket);
 
     if (!ThyoneE_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
@@ -1542,3 +1467,11 @@ bool ThyoneE_IsTransparentModeBusy(bool* busyStateP)
 
     return true;
 }
+
+uint32_t ThyoneE_GetConfirmationOverflowCount() { return cmdConfirmations.overflowCount; }
+
+#if defined(WE_STATS_ENABLED)
+bool ThyoneE_GetStatistics(WE_Stats_t* statsP) { return WE_Stats_Snapshot(&stats, ThyoneE_uartP, statsP); }
+
+void ThyoneE_ResetStatistics() { WE_Stats_Reset(&stats); }
+#endif
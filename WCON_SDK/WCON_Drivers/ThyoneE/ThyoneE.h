@@ -37,6 +37,7 @@ extern "C"
 #define THYONEE_H_INCLUDED
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 
 /** Boot-up time */
@@ -885,6 +886,31 @@ extern bool ThyoneE_GetGPIOBlockRemoteConfig(uint8_t* remoteConfigP);
  */
 extern bool ThyoneE_GetModuleMode(ThyoneE_ModuleMode_t* moduleModeP);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ThyoneE_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ThyoneE_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ThyoneE_ResetStatistics();
+#endif
+
 #endif // THYONEE_H_INCLUDED
 
 #ifdef __cplusplus
@@ -29,12 +29,12 @@
  */
 
 #include <ThyoneI/ThyoneI.h>
+#include <global/CMDFrame.h>
 #include <global/global.h>
 #include <stdio.h>
 #include <string.h>
 
 #define CMD_WAIT_TIME 1500
-#define CMD_WAIT_TIME_STEP_MS 0
 #define CNFINVALID 255
 
 /* Normal overhead: Start signal + Command + Length + CS = 1+1+2+1=5 bytes */
@@ -156,9 +156,6 @@ typedef struct
 #define THYONEI_CMD_GPIO_REMOTE_READ_CNF (THYONEI_CMD_GPIO_REMOTE_READ | THYONEI_CMD_TYPE_CNF)
 #define THYONEI_CMD_GPIO_REMOTE_READ_RSP (THYONEI_CMD_GPIO_REMOTE_READ | THYONEI_CMD_TYPE_RSP)
 
-void ThyoneI_HandleRxByte(uint8_t* dataP, size_t size);
-static WE_UART_HandleRxByte_t byteRxCallback = ThyoneI_HandleRxByte;
-
 /**
  * @brief Type used to check the response, when a command was sent to the ThyoneI
  */
@@ -171,297 +168,311 @@ typedef enum ThyoneI_CMD_Status_t
     CMD_Status_NoStatus,
 } ThyoneI_CMD_Status_t;
 
-typedef struct
+/**
+ * @brief State of a ThyoneI driver instance.
+ */
+struct ThyoneI_Handle_t
 {
-    uint8_t cmd;                 /* variable to check if correct CMD has been confirmed */
-    ThyoneI_CMD_Status_t status; /* variable used to check the response (*_CNF), when a request (*_REQ) was sent to the ThyoneI */
-} ThyoneI_CMD_Confirmation_t;
+    ThyoneI_CMD_Frame_t txPacket;                                                  /**< request to be sent to the module */
+    ThyoneI_CMD_Frame_t rxPacket;                                                  /**< received packet that has been sent by the module */
+    CMDFrame_ConfirmationQueue_t cmdConfirmations;                                 /**< received confirmations that haven't been evaluated yet */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t stats;                                                              /**< performance counters and latency histograms */
+#endif
+    ThyoneI_Pins_t* pinsP;                                                         /**< pin configuration struct pointer */
+    WE_UART_t* uartP;                                                              /**< UART configuration struct pointer */
+    CMDFrame_Parser_t rxParser;                                                    /**< assembles the frames received from the module */
+    uint8_t rxBuffer[sizeof(ThyoneI_CMD_Frame_t)];                                 /**< For UART RX from module */
+    void (*RxCallback)(uint8_t*, uint16_t, uint32_t, int8_t);                      /**< callback function */
+    ThyoneI_OperationMode_t operationMode;                                         /**< operation mode of the module */
+    WE_UART_HandleRxByte_t byteRxCallback;                                         /**< function called by the UART driver on data reception */
+    CMDFrame_AsyncQueue_t asyncQueue;                                              /**< asynchronous requests waiting for their confirmation */
+};
+
+/**
+ * @brief Initial state of a driver instance.
+ */
+#define HANDLE_INITIALIZER {.txPacket = {.Stx = CMD_STX, .Length = 0}, .rxPacket = {.Stx = CMD_STX, .Length = 0}, .operationMode = ThyoneI_OperationMode_CommandMode}
+
+#if THYONEI_MAX_INSTANCES > 4
+#error "THYONEI_MAX_INSTANCES must not exceed 4"
+#endif
 
 /**************************************
  *          Static variables          *
  **************************************/
-static ThyoneI_CMD_Frame_t txPacket = {.Stx = CMD_STX, .Length = 0}; /* request to be sent to the module */
-static ThyoneI_CMD_Frame_t rxPacket = {.Stx = CMD_STX, .Length = 0}; /* received packet that has been sent by the module */
-;
-
-#define CMDCONFIRMATIONARRAY_LENGTH 3
-static ThyoneI_CMD_Confirmation_t cmdConfirmation_array[CMDCONFIRMATIONARRAY_LENGTH];
-
-/**
- * @brief Pin configuration struct pointer.
- */
-static ThyoneI_Pins_t* ThyoneI_pinsP = NULL;
+static ThyoneI_Handle_t instances[THYONEI_MAX_INSTANCES] = {HANDLE_INITIALIZER,
+#if THYONEI_MAX_INSTANCES > 1
+                                                            HANDLE_INITIALIZER,
+#endif
+#if THYONEI_MAX_INSTANCES > 2
+                                                            HANDLE_INITIALIZER,
+#endif
+#if THYONEI_MAX_INSTANCES > 3
+                                                            HANDLE_INITIALIZER,
+#endif
+};
 
 /**
- * @brief Uart configuration struct pointer.
+ * @brief Instance used by the functions without handle parameter.
  */
-static WE_UART_t* ThyoneI_uartP = NULL;
-
-static uint8_t checksum = 0;
-static uint16_t rxByteCounter = 0;
-static uint16_t bytesToReceive = 0;
-static uint8_t rxBuffer[sizeof(ThyoneI_CMD_Frame_t)];            /* For UART RX from module */
-static void (*RxCallback)(uint8_t*, uint16_t, uint32_t, int8_t); /* callback function */
-static ThyoneI_OperationMode_t operationMode = ThyoneI_OperationMode_CommandMode;
+#define DEFAULT_HANDLE (&instances[0])
 
 /**************************************
  *         Static functions           *
  **************************************/
 
-static void HandleRxPacket(uint8_t* prxBuffer)
+static void HandleNoStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
 {
-    ThyoneI_CMD_Confirmation_t cmdConfirmation;
-    cmdConfirmation.cmd = CNFINVALID;
-    cmdConfirmation.status = CMD_Status_Invalid;
+    confirmation->cmd = frame->cmd;
+    confirmation->status = CMD_Status_NoStatus;
+}
 
-    uint16_t cmdLength = ((ThyoneI_CMD_Frame_t*)prxBuffer)->Length;
-    memcpy(&rxPacket, prxBuffer, cmdLength + LENGTH_CMD_OVERHEAD);
+static void HandleStatusCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = frame->data[0];
+}
+
+static void HandleGpioRemoteReadCnf(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    confirmation->cmd = frame->cmd;
+    confirmation->status = CMD_Status_Invalid;
+}
+
+static void HandleDataInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ThyoneI_Handle_t* handle = (ThyoneI_Handle_t*)context;
 
-    switch (rxPacket.Cmd)
+    if (handle->RxCallback != NULL)
     {
-        case THYONEI_CMD_RESET_CNF:
-        case THYONEI_CMD_START_IND:
-        case THYONEI_CMD_GPIO_REMOTE_GETCONFIG_RSP:
-        case THYONEI_CMD_GPIO_REMOTE_READ_RSP:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = CMD_Status_NoStatus;
-            break;
-        }
+        uint32_t src_address;
+        memcpy(&src_address, &frame->data[0], 4);
+        handle->RxCallback(&frame->data[5], frame->length - 5, src_address, frame->data[4]);
+    }
+}
 
-        case THYONEI_CMD_DATA_CNF:
-        case THYONEI_CMD_GET_CNF:
-        case THYONEI_CMD_SET_CNF:
-        case THYONEI_CMD_GETRAM_CNF:
-        case THYONEI_CMD_SETRAM_CNF:
-        case THYONEI_CMD_SETCHANNEL_CNF:
-        case THYONEI_CMD_FACTORYRESET_CNF:
-        case THYONEI_CMD_SLEEP_CNF:
-        case THYONEI_CMD_GPIO_LOCAL_SETCONFIG_CNF:
-        case THYONEI_CMD_GPIO_LOCAL_GETCONFIG_CNF:
-        case THYONEI_CMD_GPIO_LOCAL_WRITE_CNF:
-        case THYONEI_CMD_GPIO_LOCAL_READ_CNF:
-        case THYONEI_CMD_GPIO_REMOTE_SETCONFIG_CNF:
-        case THYONEI_CMD_GPIO_REMOTE_GETCONFIG_CNF:
-        case THYONEI_CMD_GPIO_REMOTE_WRITE_CNF:
-        case THYONEI_CMD_TXCOMPLETE_RSP:
-        case THYONEI_CMD_GETSTATE_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = rxPacket.Data[0];
-            break;
-        }
+static void HandleSnifferInd(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    ThyoneI_Handle_t* handle = (ThyoneI_Handle_t*)context;
 
-        case THYONEI_CMD_GPIO_REMOTE_READ_CNF:
-        {
-            cmdConfirmation.cmd = rxPacket.Cmd;
-            cmdConfirmation.status = CMD_Status_Invalid;
+    if (handle->RxCallback != NULL)
+    {
+        uint32_t src_address;
+        memcpy(&src_address, &frame->data[0], 4);
+        handle->RxCallback(&frame->data[6], frame->length - 6, src_address, frame->data[4]);
+    }
+}
 
-            break;
-        }
+/**
+ * @brief Handlers of the frames received from the module (indexed by command byte).
+ */
+static const CMDFrame_Handler_t rxHandlers[CMDFRAME_HANDLER_TABLE_SIZE] = {
+    [THYONEI_CMD_RESET_CNF]                 = HandleNoStatusCnf,
+    [THYONEI_CMD_START_IND]                 = HandleNoStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_GETCONFIG_RSP] = HandleNoStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_READ_RSP]      = HandleNoStatusCnf,
+    [THYONEI_CMD_DATA_CNF]                  = HandleStatusCnf,
+    [THYONEI_CMD_GET_CNF]                   = HandleStatusCnf,
+    [THYONEI_CMD_SET_CNF]                   = HandleStatusCnf,
+    [THYONEI_CMD_GETRAM_CNF]                = HandleStatusCnf,
+    [THYONEI_CMD_SETRAM_CNF]                = HandleStatusCnf,
+    [THYONEI_CMD_SETCHANNEL_CNF]            = HandleStatusCnf,
+    [THYONEI_CMD_FACTORYRESET_CNF]          = HandleStatusCnf,
+    [THYONEI_CMD_SLEEP_CNF]                 = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_LOCAL_SETCONFIG_CNF]  = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_LOCAL_GETCONFIG_CNF]  = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_LOCAL_WRITE_CNF]      = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_LOCAL_READ_CNF]       = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_SETCONFIG_CNF] = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_GETCONFIG_CNF] = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_WRITE_CNF]     = HandleStatusCnf,
+    [THYONEI_CMD_TXCOMPLETE_RSP]            = HandleStatusCnf,
+    [THYONEI_CMD_GETSTATE_CNF]              = HandleStatusCnf,
+    [THYONEI_CMD_GPIO_REMOTE_READ_CNF]      = HandleGpioRemoteReadCnf,
+    [THYONEI_CMD_DATA_IND]                  = HandleDataInd,
+    [THYONEI_CMD_SNIFFER_IND]               = HandleSnifferInd,
+};
 
-        case THYONEI_CMD_DATA_IND:
-        {
-            if (RxCallback != NULL)
-            {
-                uint32_t src_address;
-                memcpy(&src_address, &rxPacket.Data[0], 4);
-                RxCallback(&rxPacket.Data[5], rxPacket.Length - 5, src_address, rxPacket.Data[4]);
-            }
-            break;
-        }
+/**
+ * @brief Evaluates a frame received from the module (called by the frame parser).
+ */
+static void HandleRxPacket(void* context, CMDFrame_t* frame)
+{
+    ThyoneI_Handle_t* handle = (ThyoneI_Handle_t*)context;
+    CMDFrame_Confirmation_t cmdConfirmation;
+    cmdConfirmation.cmd = CNFINVALID;
+    cmdConfirmation.status = CMD_Status_Invalid;
 
-        case THYONEI_CMD_SNIFFER_IND:
-        {
-            if (RxCallback != NULL)
-            {
-                uint32_t src_address;
-                memcpy(&src_address, &rxPacket.Data[0], 4);
-                RxCallback(&rxPacket.Data[6], rxPacket.Length - 6, src_address, rxPacket.Data[4]);
-            }
-            break;
-        }
+    CMDFrame_Dispatch(rxHandlers, context, frame, &cmdConfirmation);
 
-        default:
-        {
-            /* invalid*/
-            break;
-        }
+    if ((cmdConfirmation.cmd != CNFINVALID) && CMDFrame_AsyncQueue_Complete(&handle->asyncQueue, &cmdConfirmation, frame))
+    {
+        /* Confirmation of an asynchronous request (has been passed to the request's callback) */
+        return;
     }
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
+    if (cmdConfirmation.cmd != CNFINVALID)
     {
-        if (cmdConfirmation_array[i].cmd == CNFINVALID)
-        {
-            cmdConfirmation_array[i].cmd = cmdConfirmation.cmd;
-            cmdConfirmation_array[i].status = cmdConfirmation.status;
-            break;
-        }
+        CMDFrame_ConfirmationQueue_Add(&handle->cmdConfirmations, &cmdConfirmation, frame);
     }
 }
 
 /**
  * @brief Function that waits for the return value of ThyoneI (*_CNF), when a command (*_REQ) was sent before
  */
-static bool Wait4CNF(uint32_t max_time_ms, uint8_t expectedCmdConfirmation, ThyoneI_CMD_Status_t expectedStatus, bool reset_confirmstate)
+static bool Wait4CNF(ThyoneI_Handle_t* handle, uint32_t max_time_ms, uint8_t expectedCmdConfirmation, ThyoneI_CMD_Status_t expectedStatus, bool reset_confirmstate)
 {
-    uint32_t t0 = WE_GetTick();
-
     if (reset_confirmstate)
     {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            cmdConfirmation_array[i].cmd = CNFINVALID;
-        }
+        CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
     }
-    while (1)
-    {
-        for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-        {
-            if (expectedCmdConfirmation == cmdConfirmation_array[i].cmd)
-            {
-                return (cmdConfirmation_array[i].status == expectedStatus);
-            }
-        }
-
-        uint32_t now = WE_GetTick();
-        if (now - t0 > max_time_ms)
-        {
-            /* received no correct response within timeout */
-            return false;
-        }
 
-        if (CMD_WAIT_TIME_STEP_MS > 0)
-        {
-            /* wait */
-            WE_Delay(CMD_WAIT_TIME_STEP_MS);
-        }
+    uint8_t status;
+    if (!CMDFrame_ConfirmationQueue_Wait(&handle->cmdConfirmations, expectedCmdConfirmation, max_time_ms, &status))
+    {
+        /* received no correct response within timeout */
+        return false;
     }
-    return true;
+    return (status == expectedStatus);
 }
 
+/**
+ * @brief Registers handle->rxPacket as buffer for the confirmation expectedCmdConfirmation, whose data is
+ * evaluated after Wait4CNF() has returned (must be called before the request is sent).
+ */
+static void ExpectResponse(ThyoneI_Handle_t* handle, uint8_t expectedCmdConfirmation) { CMDFrame_ConfirmationQueue_ExpectResponse(&handle->cmdConfirmations, expectedCmdConfirmation, &handle->rxPacket, sizeof(handle->rxPacket)); }
+
 /**
  * @brief Function to add the checksum at the end of the data packet.
  */
 static void FillChecksum(ThyoneI_CMD_Frame_t* cmd)
 {
-    uint8_t checksum = (uint8_t)cmd->Stx;
-    uint8_t* pArray = (uint8_t*)cmd;
-    for (uint16_t i = 1; i < (cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC); i++)
+    CMDFrame_FillChecksum((uint8_t*)cmd, cmd->Length + LENGTH_CMD_OVERHEAD_WITHOUT_CRC);
+}
+
+/**
+ * @brief Sends data to the module.
+ *
+ * isBlockingRequest is true if the data is a request whose confirmation is awaited using Wait4CNF(), so that
+ * its latency is measured by the confirmation queue. The latency of asynchronous requests is measured per
+ * request by the asynchronous queue instead.
+ */
+static bool TransmitData(ThyoneI_Handle_t* handle, const uint8_t* data, uint16_t dataLength, bool isBlockingRequest)
+{
+    if ((data == NULL) || (dataLength == 0))
     {
-        checksum ^= pArray[i];
+        return false;
     }
-    cmd->Data[cmd->Length] = checksum;
+
+    WE_STATS_TRANSMIT(&handle->stats, dataLength, data == (const uint8_t*)&handle->txPacket);
+    CMDFRAME_STATS_START_REQUEST(&handle->cmdConfirmations, isBlockingRequest);
+    return handle->uartP->uartTransmit((uint8_t*)data, dataLength);
 }
 
-void ThyoneI_HandleRxByte(uint8_t* dataP, size_t size)
+/**
+ * @brief Sends the request in handle->txPacket without waiting for its confirmation.
+ *
+ * The request is added to the queue of asynchronous requests before it is sent, as the
+ * confirmation might be received before the transmit function returns.
+ */
+static bool SendAsyncRequest(ThyoneI_Handle_t* handle, uint8_t expectedCmdConfirmation, ThyoneI_AsyncCallback_t cb)
 {
-    for (; size > 0; size--, dataP++)
+    if (!CMDFrame_AsyncQueue_Add(&handle->asyncQueue, expectedCmdConfirmation, CMD_Status_Success, CMD_WAIT_TIME, cb))
     {
-        if (rxByteCounter < sizeof(rxBuffer))
-        {
-            rxBuffer[rxByteCounter] = *dataP;
-        }
+        return false;
+    }
 
-        switch (rxByteCounter)
-        {
-            case 0:
-                /* wait for start byte of frame */
-                if (rxBuffer[rxByteCounter] == CMD_STX)
-                {
-                    bytesToReceive = 0;
-                    rxByteCounter = 1;
-                }
-                break;
+    FillChecksum(&handle->txPacket);
 
-            case 1:
-                /* CMD */
-                rxByteCounter++;
-                break;
+    if (!TransmitData(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD, false))
+    {
+        /* Unless the request has already been completed (its callback has been called), no callback will follow */
+        return !CMDFrame_AsyncQueue_Cancel(&handle->asyncQueue);
+    }
+    return true;
+}
 
-            case 2:
-                /* length field LSB */
-                rxByteCounter++;
-                bytesToReceive = (uint16_t)(rxBuffer[rxByteCounter - 1]);
-                break;
+static void ThyoneI_HandleRxByte(ThyoneI_Handle_t* handle, uint8_t* dataP, size_t size)
+{
+    CMDFrame_Parser_HandleRxBytes(&handle->rxParser, dataP, size);
+}
 
-            case 3:
-                /* length field MSB */
-                rxByteCounter++;
-                bytesToReceive += (((uint16_t)rxBuffer[rxByteCounter - 1] << 8) + LENGTH_CMD_OVERHEAD); /* len_msb + len_lsb + crc + sfd + cmd */
-                break;
+/*
+ * The UART driver calls the byte handler without any context, so each instance
+ * needs its own handler function.
+ */
+static void ThyoneI_HandleRxByte0(uint8_t* dataP, size_t size) { ThyoneI_HandleRxByte(&instances[0], dataP, size); }
+#if THYONEI_MAX_INSTANCES > 1
+static void ThyoneI_HandleRxByte1(uint8_t* dataP, size_t size) { ThyoneI_HandleRxByte(&instances[1], dataP, size); }
+#endif
+#if THYONEI_MAX_INSTANCES > 2
+static void ThyoneI_HandleRxByte2(uint8_t* dataP, size_t size) { ThyoneI_HandleRxByte(&instances[2], dataP, size); }
+#endif
+#if THYONEI_MAX_INSTANCES > 3
+static void ThyoneI_HandleRxByte3(uint8_t* dataP, size_t size) { ThyoneI_HandleRxByte(&instances[3], dataP, size); }
+#endif
 
-            default:
-                /* data field */
-                rxByteCounter++;
-                if (rxByteCounter >= bytesToReceive)
-                {
-                    /* check CRC */
-                    checksum = 0;
-                    for (uint16_t i = 0; i < (bytesToReceive - 1); i++)
-                    {
-                        checksum ^= rxBuffer[i];
-                    }
-
-                    if (checksum == rxBuffer[bytesToReceive - 1])
-                    {
-                        /* received frame ok, interpret it now */
-                        HandleRxPacket(rxBuffer);
-                    }
-
-                    rxByteCounter = 0;
-                    bytesToReceive = 0;
-                }
-                break;
-        }
-    }
-}
+/**
+ * @brief Byte handler of each instance.
+ */
+static const WE_UART_HandleRxByte_t rxByteHandlers[THYONEI_MAX_INSTANCES] = {ThyoneI_HandleRxByte0,
+#if THYONEI_MAX_INSTANCES > 1
+                                                                             ThyoneI_HandleRxByte1,
+#endif
+#if THYONEI_MAX_INSTANCES > 2
+                                                                             ThyoneI_HandleRxByte2,
+#endif
+#if THYONEI_MAX_INSTANCES > 3
+                                                                             ThyoneI_HandleRxByte3,
+#endif
+};
 
 /**************************************
  *         Global functions           *
  **************************************/
 
-bool ThyoneI_Transparent_Transmit(const uint8_t* data, uint16_t dataLength)
-{
-    if ((data == NULL) || (dataLength == 0))
-    {
-        return false;
-    }
+bool ThyoneI_Handle_Transparent_Transmit(ThyoneI_Handle_t* handle, const uint8_t* data, uint16_t dataLength) { return TransmitData(handle, data, dataLength, data == (const uint8_t*)&handle->txPacket); }
 
-    return ThyoneI_uartP->uartTransmit((uint8_t*)data, dataLength);
-}
+uint32_t ThyoneI_Handle_GetConfirmationOverflowCount(ThyoneI_Handle_t* handle) { return handle->cmdConfirmations.overflowCount; }
 
-bool ThyoneI_Init(WE_UART_t* uartP, ThyoneI_Pins_t* pinoutP, ThyoneI_OperationMode_t opMode, void (*RXcb)(uint8_t*, uint16_t, uint32_t, int8_t))
+#if defined(WE_STATS_ENABLED)
+bool ThyoneI_Handle_GetStatistics(ThyoneI_Handle_t* handle, WE_Stats_t* statsP) { return WE_Stats_Snapshot(&handle->stats, handle->uartP, statsP); }
+
+void ThyoneI_Handle_ResetStatistics(ThyoneI_Handle_t* handle) { WE_Stats_Reset(&handle->stats); }
+#endif
+
+bool ThyoneI_Handle_Init(ThyoneI_Handle_t* handle, WE_UART_t* uartP, ThyoneI_Pins_t* pinoutP, ThyoneI_OperationMode_t opMode, void (*RXcb)(uint8_t*, uint16_t, uint32_t, int8_t))
 {
     /* set RX callback function */
-    RxCallback = RXcb;
+    handle->RxCallback = RXcb;
 
-    operationMode = opMode;
+    handle->operationMode = opMode;
 
     if ((pinoutP == NULL) || (uartP == NULL) || (uartP->uartInit == NULL) || (uartP->uartDeinit == NULL) || (uartP->uartTransmit == NULL))
     {
         return false;
     }
 
-    ThyoneI_pinsP = pinoutP;
-    ThyoneI_pinsP->ThyoneI_Pin_Reset.type = WE_Pin_Type_Output;
-    ThyoneI_pinsP->ThyoneI_Pin_Reset.initial_value.output = WE_Pin_Level_High;
-    ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
-    ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_High;
-    ThyoneI_pinsP->ThyoneI_Pin_Busy.type = WE_Pin_Type_Input;
-    ThyoneI_pinsP->ThyoneI_Pin_Busy.initial_value.input_pull = WE_Pin_PullType_No;
-    ThyoneI_pinsP->ThyoneI_Pin_Boot.type = WE_Pin_Type_Output;
-    ThyoneI_pinsP->ThyoneI_Pin_Boot.initial_value.output = WE_Pin_Level_High;
-    ThyoneI_pinsP->ThyoneI_Pin_Mode.type = WE_Pin_Type_Output;
-    ThyoneI_pinsP->ThyoneI_Pin_Mode.initial_value.output = ((operationMode == ThyoneI_OperationMode_TransparentMode) ? WE_Pin_Level_High : WE_Pin_Level_Low);
+    handle->pinsP = pinoutP;
+    handle->pinsP->ThyoneI_Pin_Reset.type = WE_Pin_Type_Output;
+    handle->pinsP->ThyoneI_Pin_Reset.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ThyoneI_Pin_SleepWakeUp.type = WE_Pin_Type_Output;
+    handle->pinsP->ThyoneI_Pin_SleepWakeUp.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ThyoneI_Pin_Busy.type = WE_Pin_Type_Input;
+    handle->pinsP->ThyoneI_Pin_Busy.initial_value.input_pull = WE_Pin_PullType_No;
+    handle->pinsP->ThyoneI_Pin_Boot.type = WE_Pin_Type_Output;
+    handle->pinsP->ThyoneI_Pin_Boot.initial_value.output = WE_Pin_Level_High;
+    handle->pinsP->ThyoneI_Pin_Mode.type = WE_Pin_Type_Output;
+    handle->pinsP->ThyoneI_Pin_Mode.initial_value.output = ((handle->operationMode == ThyoneI_OperationMode_TransparentMode) ? WE_Pin_Level_High : WE_Pin_Level_Low);
 
     WE_Pin_t pins[sizeof(ThyoneI_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Mode, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Busy, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Busy, sizeof(WE_Pin_t));
 
     if (!WE_InitPins(pins, pin_count))
     {
@@ -469,33 +480,43 @@ bool ThyoneI_Init(WE_UART_t* uartP, ThyoneI_Pins_t* pinoutP, ThyoneI_OperationMo
         return false;
     }
 
-    ThyoneI_uartP = uartP;
-    if (false == ThyoneI_uartP->uartInit(ThyoneI_uartP->baudrate, ThyoneI_uartP->flowControl, ThyoneI_uartP->parity, &byteRxCallback))
+    handle->byteRxCallback = rxByteHandlers[handle - instances];
+
+    CMDFrame_Parser_Init(&handle->rxParser, CMD_STX, sizeof(handle->rxPacket.Length), handle->rxBuffer, sizeof(handle->rxBuffer), HandleRxPacket, handle);
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_Reset(&handle->stats);
+    handle->rxParser.stats = &handle->stats;
+    handle->cmdConfirmations.stats = &handle->stats;
+    handle->asyncQueue.stats = &handle->stats;
+#endif
+
+    handle->uartP = uartP;
+    if (false == handle->uartP->uartInit(handle->uartP->baudrate, handle->uartP->flowControl, handle->uartP->parity, &handle->byteRxCallback))
     {
         return false;
     }
     WE_Delay(10);
 
     /* reset module */
-    if (!(IS_WE_PIN_UNDEFINED(ThyoneI_pinsP->ThyoneI_Pin_Reset) ? ThyoneI_Reset() : ThyoneI_PinReset()))
+    if (!(IS_WE_PIN_UNDEFINED(handle->pinsP->ThyoneI_Pin_Reset) ? ThyoneI_Handle_Reset(handle) : ThyoneI_Handle_PinReset(handle)))
     {
         WE_DEBUG_PRINT_INFO("Reset failed\r\n");
-        ThyoneI_Deinit();
+        ThyoneI_Handle_Deinit(handle);
         return false;
     }
 
     return true;
 }
 
-bool ThyoneI_Deinit()
+bool ThyoneI_Handle_Deinit(ThyoneI_Handle_t* handle)
 {
     WE_Pin_t pins[sizeof(ThyoneI_Pins_t) / sizeof(WE_Pin_t)];
     uint8_t pin_count = 0;
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Reset, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Boot, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Mode, sizeof(WE_Pin_t));
-    memcpy(&pins[pin_count++], &ThyoneI_pinsP->ThyoneI_Pin_Busy, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Reset, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_SleepWakeUp, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Boot, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Mode, sizeof(WE_Pin_t));
+    memcpy(&pins[pin_count++], &handle->pinsP->ThyoneI_Pin_Busy, sizeof(WE_Pin_t));
 
     /* deinit pins */
     if (!WE_DeinitPins(pins, pin_count))
@@ -503,56 +524,55 @@ bool ThyoneI_Deinit()
         return false;
     }
 
-    RxCallback = NULL;
+    handle->RxCallback = NULL;
+    CMDFrame_AsyncQueue_Abort(&handle->asyncQueue);
 
-    return ThyoneI_uartP->uartDeinit();
+    return handle->uartP->uartDeinit();
 }
 
-bool ThyoneI_PinWakeup()
+bool ThyoneI_Handle_PinWakeup(ThyoneI_Handle_t* handle)
 {
-    if (!WE_SetPin(ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->ThyoneI_Pin_SleepWakeUp, WE_Pin_Level_Low))
     {
         return false;
     }
 
     WE_Delay(5);
 
-    for (uint8_t i = 0; i < CMDCONFIRMATIONARRAY_LENGTH; i++)
-    {
-        cmdConfirmation_array[i].status = CMD_Status_Invalid;
-        cmdConfirmation_array[i].cmd = CNFINVALID;
-    }
+    CMDFrame_ConfirmationQueue_Reset(&handle->cmdConfirmations);
 
-    if (!WE_SetPin(ThyoneI_pinsP->ThyoneI_Pin_SleepWakeUp, WE_Pin_Level_High))
+    if (!WE_SetPin(handle->pinsP->ThyoneI_Pin_SleepWakeUp, WE_Pin_Level_High))
     {
         return false;
     }
 
-    if (operationMode == ThyoneI_OperationMode_TransparentMode)
+    if (handle->operationMode == ThyoneI_OperationMode_TransparentMode)
     {
         /* transparent mode is ready (the module doesn't send a "ready for operation" message in transparent mode) */
         return true;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, false);
 }
 
-bool ThyoneI_PinReset()
+bool ThyoneI_Handle_PinReset(ThyoneI_Handle_t* handle)
 {
-    if (!WE_SetPin(ThyoneI_pinsP->ThyoneI_Pin_Reset, WE_Pin_Level_Low))
+    if (!WE_SetPin(handle->pinsP->ThyoneI_Pin_Reset, WE_Pin_Level_Low))
     {
         return false;
     }
 
     WE_Delay(5);
 
-    if (!WE_SetPin(ThyoneI_pinsP->ThyoneI_Pin_Reset, WE_Pin_Level_High))
+    if (!WE_SetPin(handle->pinsP->ThyoneI_Pin_Reset, WE_Pin_Level_High))
     {
         return false;
     }
 
-    if (operationMode == ThyoneI_OperationMode_TransparentMode)
+    CMDFrame_AsyncQueue_Abort(&handle->asyncQueue);
+
+    if (handle->operationMode == ThyoneI_OperationMode_TransparentMode)
     {
         WE_Delay(THYONEI_BOOT_DURATION);
         /* transparent mode is ready (the module doesn't send a "ready for operation" message in transparent mode) */
@@ -560,217 +580,217 @@ bool ThyoneI_PinReset()
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
 }
 
-bool ThyoneI_Reset()
+bool ThyoneI_Handle_Reset(ThyoneI_Handle_t* handle)
 {
-    txPacket.Cmd = THYONEI_CMD_RESET_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = THYONEI_CMD_RESET_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
 }
 
-bool ThyoneI_Sleep()
+bool ThyoneI_Handle_Sleep(ThyoneI_Handle_t* handle)
 {
-    txPacket.Cmd = THYONEI_CMD_SLEEP_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = THYONEI_CMD_SLEEP_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_SLEEP_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_SLEEP_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_TransmitBroadcast(uint8_t* payloadP, uint16_t length)
+bool ThyoneI_Handle_TransmitBroadcast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length)
 {
     if ((payloadP == NULL) || (length > MAX_RADIO_PAYLOAD_LENGTH))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_BROADCAST_DATA_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_BROADCAST_DATA_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], payloadP, length);
+    memcpy(&handle->txPacket.Data[0], payloadP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
 }
 
-bool ThyoneI_TransmitMulticast(uint8_t* payloadP, uint16_t length)
+bool ThyoneI_Handle_TransmitMulticast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length)
 {
     if ((payloadP == NULL) || (length > MAX_RADIO_PAYLOAD_LENGTH))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], payloadP, length);
+    memcpy(&handle->txPacket.Data[0], payloadP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
 }
 
-bool ThyoneI_TransmitUnicast(uint8_t* payloadP, uint16_t length)
+bool ThyoneI_Handle_TransmitUnicast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length)
 {
     if ((payloadP == NULL) || (length > MAX_RADIO_PAYLOAD_LENGTH))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], payloadP, length);
+    memcpy(&handle->txPacket.Data[0], payloadP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
 }
 
-bool ThyoneI_TransmitMulticastExtended(uint8_t groupID, uint8_t* payloadP, uint16_t length)
+bool ThyoneI_Handle_TransmitMulticastExtended(ThyoneI_Handle_t* handle, uint8_t groupID, uint8_t* payloadP, uint16_t length)
 {
     if ((payloadP == NULL) || (length > MAX_RADIO_PAYLOAD_LENGTH))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_EX_REQ;
-    txPacket.Length = length + 1;
-    txPacket.Data[0] = groupID;
+    handle->txPacket.Cmd = THYONEI_CMD_MULTICAST_DATA_EX_REQ;
+    handle->txPacket.Length = length + 1;
+    handle->txPacket.Data[0] = groupID;
 
-    memcpy(&txPacket.Data[1], payloadP, length);
+    memcpy(&handle->txPacket.Data[1], payloadP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
 }
 
-bool ThyoneI_TransmitUnicastExtended(uint32_t address, uint8_t* payloadP, uint16_t length)
+bool ThyoneI_Handle_TransmitUnicastExtended(ThyoneI_Handle_t* handle, uint32_t address, uint8_t* payloadP, uint16_t length)
 {
     if ((payloadP == NULL) || (length > MAX_RADIO_PAYLOAD_LENGTH))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_EX_REQ;
-    txPacket.Length = length + 4;
+    handle->txPacket.Cmd = THYONEI_CMD_UNICAST_DATA_EX_REQ;
+    handle->txPacket.Length = length + 4;
 
-    memcpy(&txPacket.Data[0], &address, 4);
-    memcpy(&txPacket.Data[4], payloadP, length);
+    memcpy(&handle->txPacket.Data[0], &address, 4);
+    memcpy(&handle->txPacket.Data[4], payloadP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_DATA_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_TXCOMPLETE_RSP, CMD_Status_Success, false);
 }
 
-bool ThyoneI_SetRam(ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* valueP, uint8_t length)
+bool ThyoneI_Handle_SetRam(ThyoneI_Handle_t* handle, ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_SETRAM_REQ;
-    txPacket.Length = 1 + length;
-    txPacket.Data[0] = runtimeSetting;
-    memcpy(&txPacket.Data[1], valueP, length);
+    handle->txPacket.Cmd = THYONEI_CMD_SETRAM_REQ;
+    handle->txPacket.Length = 1 + length;
+    handle->txPacket.Data[0] = runtimeSetting;
+    memcpy(&handle->txPacket.Data[1], valueP, length);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_SETRAM_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_SETRAM_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_FactoryReset()
+bool ThyoneI_Handle_FactoryReset(ThyoneI_Handle_t* handle)
 {
-    txPacket.Cmd = THYONEI_CMD_FACTORYRESET_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = THYONEI_CMD_FACTORYRESET_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for reset after factory reset */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, true);
 }
 
-bool ThyoneI_CheckNSet(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+bool ThyoneI_Handle_CheckNSet(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
@@ -780,7 +800,7 @@ bool ThyoneI_CheckNSet(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint
     uint8_t current_value[length];
     uint16_t current_length = length;
 
-    if (!ThyoneI_Get(userSetting, current_value, &current_length))
+    if (!ThyoneI_Handle_Get(handle, userSetting, current_value, &current_length))
     {
         return false;
     }
@@ -792,40 +812,63 @@ bool ThyoneI_CheckNSet(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint
     }
 
     /* value differs, and thus must be set */
-    return ThyoneI_Set(userSetting, valueP, length);
+    return ThyoneI_Handle_Set(handle, userSetting, valueP, length);
 }
 
-bool ThyoneI_Set(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+/**
+ * @brief Prepares a CMD_SET_REQ in handle->txPacket.
+ */
+static bool PrepareSetRequest(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
 {
     if (valueP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_SET_REQ;
-    txPacket.Length = 1 + length;
-    txPacket.Data[0] = userSetting;
-    memcpy(&txPacket.Data[1], valueP, length);
+    handle->txPacket.Cmd = THYONEI_CMD_SET_REQ;
+    handle->txPacket.Length = 1 + length;
+    handle->txPacket.Data[0] = userSetting;
+    memcpy(&handle->txPacket.Data[1], valueP, length);
+    return true;
+}
+
+bool ThyoneI_Handle_Set(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length)
+{
+    if (!PrepareSetRequest(handle, userSetting, valueP, length))
+    {
+        return false;
+    }
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_SET_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_SET_CNF, CMD_Status_Success, true))
+    {
+        return false;
+    }
+
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, false);
+}
+
+bool ThyoneI_Handle_SetAsync(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ThyoneI_AsyncCallback_t cb)
+{
+    if (!PrepareSetRequest(handle, userSetting, valueP, length))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_START_IND, CMD_Status_NoStatus, false);
+    /* The module's restart (CMD_START_IND) following the CMD_SET_CNF is not waited for */
+    return SendAsyncRequest(handle, THYONEI_CMD_SET_CNF, cb);
 }
 
-bool ThyoneI_SetTXPower(ThyoneI_TXPower_t txPower) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_RF_TX_POWER, (uint8_t*)&txPower, 1); }
+bool ThyoneI_Handle_SetTXPower(ThyoneI_Handle_t* handle, ThyoneI_TXPower_t txPower) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_RF_TX_POWER, (uint8_t*)&txPower, 1); }
 
-bool ThyoneI_SetBaudrateIndex(ThyoneI_BaudRateIndex_t baudrate, ThyoneI_UartParity_t parity, bool flowcontrolEnable)
+bool ThyoneI_Handle_SetBaudrateIndex(ThyoneI_Handle_t* handle, ThyoneI_BaudRateIndex_t baudrate, ThyoneI_UartParity_t parity, bool flowcontrolEnable)
 {
     uint8_t baudrateIndex = (uint8_t)baudrate;
 
@@ -841,10 +884,10 @@ bool ThyoneI_SetBaudrateIndex(ThyoneI_BaudRateIndex_t baudrate, ThyoneI_UartPari
         baudrateIndex += 64;
     }
 
-    return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_UART_CONFIG, (uint8_t*)&baudrateIndex, 1);
+    return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_UART_CONFIG, (uint8_t*)&baudrateIndex, 1);
 }
 
-bool ThyoneI_SetRFChannel(uint8_t channel)
+bool ThyoneI_Handle_SetRFChannel(ThyoneI_Handle_t* handle, uint8_t channel)
 {
     /* permissible value for channel: 0-38 */
     if (channel > 38)
@@ -852,10 +895,10 @@ bool ThyoneI_SetRFChannel(uint8_t channel)
         return false;
     }
 
-    return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_RF_CHANNEL, (uint8_t*)&channel, 1);
+    return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_RF_CHANNEL, (uint8_t*)&channel, 1);
 }
 
-bool ThyoneI_SetRFChannelRuntime(uint8_t channel)
+bool ThyoneI_Handle_SetRFChannelRuntime(ThyoneI_Handle_t* handle, uint8_t channel)
 {
     /* permissible value for channel: 0-38 */
     if (channel > 38)
@@ -863,127 +906,143 @@ bool ThyoneI_SetRFChannelRuntime(uint8_t channel)
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_SETCHANNEL_REQ;
-    txPacket.Length = 1;
-    txPacket.Data[0] = channel;
+    handle->txPacket.Cmd = THYONEI_CMD_SETCHANNEL_REQ;
+    handle->txPacket.Length = 1;
+    handle->txPacket.Data[0] = channel;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_SETCHANNEL_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_SETCHANNEL_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_SetEncryptionMode(ThyoneI_EncryptionMode_t encryptionMode) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_ENCRYPTION_MODE, (uint8_t*)&encryptionMode, 1); }
+bool ThyoneI_Handle_SetEncryptionMode(ThyoneI_Handle_t* handle, ThyoneI_EncryptionMode_t encryptionMode) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_ENCRYPTION_MODE, (uint8_t*)&encryptionMode, 1); }
 
-bool ThyoneI_SetRfProfile(ThyoneI_Profile_t profile) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_RF_PROFILE, (uint8_t*)&profile, 1); }
+bool ThyoneI_Handle_SetRfProfile(ThyoneI_Handle_t* handle, ThyoneI_Profile_t profile) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_RF_PROFILE, (uint8_t*)&profile, 1); }
 
-bool ThyoneI_SetNumRetries(uint8_t numRetries) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_RF_NUM_RETRIES, (uint8_t*)&numRetries, 1); }
+bool ThyoneI_Handle_SetNumRetries(ThyoneI_Handle_t* handle, uint8_t numRetries) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_RF_NUM_RETRIES, (uint8_t*)&numRetries, 1); }
 
-bool ThyoneI_SetRpNumSlots(uint8_t numSlots) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_RF_RP_NUM_SLOTS, (uint8_t*)&numSlots, 1); }
+bool ThyoneI_Handle_SetRpNumSlots(ThyoneI_Handle_t* handle, uint8_t numSlots) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_RF_RP_NUM_SLOTS, (uint8_t*)&numSlots, 1); }
 
-bool ThyoneI_SetSourceAddress(uint32_t sourceAddress) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MAC_SOURCE_ADDRESS, (uint8_t*)&sourceAddress, 4); }
+bool ThyoneI_Handle_SetSourceAddress(ThyoneI_Handle_t* handle, uint32_t sourceAddress) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MAC_SOURCE_ADDRESS, (uint8_t*)&sourceAddress, 4); }
 
-bool ThyoneI_SetDestinationAddress(uint32_t destinationAddress) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MAC_DESTINATION_ADDRESS, (uint8_t*)&destinationAddress, 4); }
+bool ThyoneI_Handle_SetDestinationAddress(ThyoneI_Handle_t* handle, uint32_t destinationAddress) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MAC_DESTINATION_ADDRESS, (uint8_t*)&destinationAddress, 4); }
 
-bool ThyoneI_SetGroupID(uint8_t groupId) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MAC_GROUP_ID, (uint8_t*)&groupId, 1); }
+bool ThyoneI_Handle_SetGroupID(ThyoneI_Handle_t* handle, uint8_t groupId) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MAC_GROUP_ID, (uint8_t*)&groupId, 1); }
 
-bool ThyoneI_SetEncryptionKey(uint8_t* keyP) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MAC_ENCRYPTION_KEY, keyP, 16); }
+bool ThyoneI_Handle_SetEncryptionKey(ThyoneI_Handle_t* handle, uint8_t* keyP) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MAC_ENCRYPTION_KEY, keyP, 16); }
 
-bool ThyoneI_SetTimeToLive(uint8_t ttl) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MAC_TLL, &ttl, 1); }
+bool ThyoneI_Handle_SetTimeToLive(ThyoneI_Handle_t* handle, uint8_t ttl) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MAC_TLL, &ttl, 1); }
 
-bool ThyoneI_SetCCAMode(uint8_t ccaMode) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_CCA_MODE, &ccaMode, 1); }
+bool ThyoneI_Handle_SetCCAMode(ThyoneI_Handle_t* handle, uint8_t ccaMode) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_CCA_MODE, &ccaMode, 1); }
 
-bool ThyoneI_SetCCAThreshold(uint8_t ccaThreshold) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_CCA_THRESHOLD, &ccaThreshold, 1); }
+bool ThyoneI_Handle_SetCCAThreshold(ThyoneI_Handle_t* handle, uint8_t ccaThreshold) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_CCA_THRESHOLD, &ccaThreshold, 1); }
 
-bool ThyoneI_SetGPIOBlockRemoteConfig(uint8_t remoteConfig) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_REMOTE_GPIO_CONFIG, &remoteConfig, 1); }
+bool ThyoneI_Handle_SetGPIOBlockRemoteConfig(ThyoneI_Handle_t* handle, uint8_t remoteConfig) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_REMOTE_GPIO_CONFIG, &remoteConfig, 1); }
 
-bool ThyoneI_SetModuleMode(ThyoneI_ModuleMode_t moduleMode) { return ThyoneI_Set(ThyoneI_USERSETTING_INDEX_MODULE_MODE, (uint8_t*)&moduleMode, 1); }
+bool ThyoneI_Handle_SetModuleMode(ThyoneI_Handle_t* handle, ThyoneI_ModuleMode_t moduleMode) { return ThyoneI_Handle_Set(handle, ThyoneI_USERSETTING_INDEX_MODULE_MODE, (uint8_t*)&moduleMode, 1); }
 
-bool ThyoneI_GetRam(ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* ResponseP, uint16_t* Response_LengthP)
+bool ThyoneI_Handle_GetRam(ThyoneI_Handle_t* handle, ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* ResponseP, uint16_t* Response_LengthP)
 {
     if (ResponseP == NULL || Response_LengthP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GETRAM_REQ;
-    txPacket.Length = 1;
-    txPacket.Data[0] = runtimeSetting;
+    handle->txPacket.Cmd = THYONEI_CMD_GETRAM_REQ;
+    handle->txPacket.Length = 1;
+    handle->txPacket.Data[0] = runtimeSetting;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GETRAM_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GETRAM_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GETRAM_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
-    memcpy(ResponseP, &rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response*/
+    uint16_t length = handle->rxPacket.Length;
+    memcpy(ResponseP, &handle->rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response*/
     *Response_LengthP = length - 1;
 
     return true;
 }
 
-bool ThyoneI_Get(ThyoneI_UserSettings_t userSetting, uint8_t* ResponseP, uint16_t* Response_LengthP)
+/**
+ * @brief Prepares a CMD_GET_REQ in handle->txPacket.
+ */
+static void PrepareGetRequest(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting)
+{
+    handle->txPacket.Cmd = THYONEI_CMD_GET_REQ;
+    handle->txPacket.Length = 1;
+    handle->txPacket.Data[0] = userSetting;
+}
+
+bool ThyoneI_Handle_Get(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* ResponseP, uint16_t* Response_LengthP)
 {
     if (ResponseP == NULL || Response_LengthP == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GET_REQ;
-    txPacket.Length = 1;
-    txPacket.Data[0] = userSetting;
+    PrepareGetRequest(handle, userSetting);
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GET_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GET_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GET_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
-    memcpy(ResponseP, &rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response*/
+    uint16_t length = handle->rxPacket.Length;
+    memcpy(ResponseP, &handle->rxPacket.Data[1], length - 1); /* First Data byte is status, following bytes response*/
     *Response_LengthP = length - 1;
 
     return true;
 }
 
-bool ThyoneI_GetSerialNumber(uint8_t* serialNumberP)
+bool ThyoneI_Handle_GetAsync(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, ThyoneI_AsyncCallback_t cb)
+{
+    PrepareGetRequest(handle, userSetting);
+    return SendAsyncRequest(handle, THYONEI_CMD_GET_CNF, cb);
+}
+
+bool ThyoneI_Handle_GetSerialNumber(ThyoneI_Handle_t* handle, uint8_t* serialNumberP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_SERIAL_NUMBER, serialNumberP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_SERIAL_NUMBER, serialNumberP, &length);
 }
 
-bool ThyoneI_GetFWVersion(uint8_t* versionP)
+bool ThyoneI_Handle_GetFWVersion(ThyoneI_Handle_t* handle, uint8_t* versionP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_FW_VERSION, versionP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_FW_VERSION, versionP, &length);
 }
 
-bool ThyoneI_GetTXPower(ThyoneI_TXPower_t* txpowerP)
+bool ThyoneI_Handle_GetTXPower(ThyoneI_Handle_t* handle, ThyoneI_TXPower_t* txpowerP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_RF_TX_POWER, (uint8_t*)txpowerP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_RF_TX_POWER, (uint8_t*)txpowerP, &length);
 }
 
-bool ThyoneI_GetBaudrateIndex(ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartParity_t* parityP, bool* flowcontrolEnableP)
+bool ThyoneI_Handle_GetBaudrateIndex(ThyoneI_Handle_t* handle, ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartParity_t* parityP, bool* flowcontrolEnableP)
 {
     if ((baudrateP == NULL) || (parityP == NULL) || (flowcontrolEnableP == NULL))
     {
@@ -993,7 +1052,7 @@ bool ThyoneI_GetBaudrateIndex(ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartPa
     uint16_t length;
     uint8_t uartIndex;
 
-    if (!ThyoneI_Get(ThyoneI_USERSETTING_INDEX_UART_CONFIG, (uint8_t*)&uartIndex, &length))
+    if (!ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_UART_CONFIG, (uint8_t*)&uartIndex, &length))
     {
         return false;
     }
@@ -1028,112 +1087,113 @@ bool ThyoneI_GetBaudrateIndex(ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartPa
     return true;
 }
 
-bool ThyoneI_GetEncryptionMode(ThyoneI_EncryptionMode_t* encryptionModeP)
+bool ThyoneI_Handle_GetEncryptionMode(ThyoneI_Handle_t* handle, ThyoneI_EncryptionMode_t* encryptionModeP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_ENCRYPTION_MODE, (uint8_t*)encryptionModeP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_ENCRYPTION_MODE, (uint8_t*)encryptionModeP, &length);
 }
 
-bool ThyoneI_GetRfProfile(ThyoneI_Profile_t* profileP)
+bool ThyoneI_Handle_GetRfProfile(ThyoneI_Handle_t* handle, ThyoneI_Profile_t* profileP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_RF_PROFILE, (uint8_t*)profileP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_RF_PROFILE, (uint8_t*)profileP, &length);
 }
 
-bool ThyoneI_GetRFChannel(uint8_t* channelP)
+bool ThyoneI_Handle_GetRFChannel(ThyoneI_Handle_t* handle, uint8_t* channelP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_RF_CHANNEL, (uint8_t*)channelP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_RF_CHANNEL, (uint8_t*)channelP, &length);
 }
 
-bool ThyoneI_GetNumRetries(uint8_t* numRetriesP)
+bool ThyoneI_Handle_GetNumRetries(ThyoneI_Handle_t* handle, uint8_t* numRetriesP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_RF_NUM_RETRIES, numRetriesP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_RF_NUM_RETRIES, numRetriesP, &length);
 }
 
-bool ThyoneI_GetRpNumSlots(uint8_t* numSlotsP)
+bool ThyoneI_Handle_GetRpNumSlots(ThyoneI_Handle_t* handle, uint8_t* numSlotsP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_RF_RP_NUM_SLOTS, numSlotsP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_RF_RP_NUM_SLOTS, numSlotsP, &length);
 }
 
-bool ThyoneI_GetSourceAddress(uint32_t* sourceAddressP)
+bool ThyoneI_Handle_GetSourceAddress(ThyoneI_Handle_t* handle, uint32_t* sourceAddressP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_MAC_SOURCE_ADDRESS, (uint8_t*)sourceAddressP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_MAC_SOURCE_ADDRESS, (uint8_t*)sourceAddressP, &length);
 }
 
-bool ThyoneI_GetDestinationAddress(uint32_t* destinationAddressP)
+bool ThyoneI_Handle_GetDestinationAddress(ThyoneI_Handle_t* handle, uint32_t* destinationAddressP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_MAC_DESTINATION_ADDRESS, (uint8_t*)destinationAddressP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_MAC_DESTINATION_ADDRESS, (uint8_t*)destinationAddressP, &length);
 }
 
-bool ThyoneI_GetGroupID(uint8_t* groupIdP)
+bool ThyoneI_Handle_GetGroupID(ThyoneI_Handle_t* handle, uint8_t* groupIdP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_MAC_GROUP_ID, groupIdP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_MAC_GROUP_ID, groupIdP, &length);
 }
 
-bool ThyoneI_GetTimeToLive(uint8_t* ttlP)
+bool ThyoneI_Handle_GetTimeToLive(ThyoneI_Handle_t* handle, uint8_t* ttlP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_MAC_TLL, ttlP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_MAC_TLL, ttlP, &length);
 }
 
-bool ThyoneI_GetCCAMode(uint8_t* ccaModeP)
+bool ThyoneI_Handle_GetCCAMode(ThyoneI_Handle_t* handle, uint8_t* ccaModeP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_CCA_MODE, ccaModeP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_CCA_MODE, ccaModeP, &length);
 }
 
-bool ThyoneI_GetCCAThreshold(uint8_t* ccaThresholdP)
+bool ThyoneI_Handle_GetCCAThreshold(ThyoneI_Handle_t* handle, uint8_t* ccaThresholdP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_CCA_THRESHOLD, ccaThresholdP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_CCA_THRESHOLD, ccaThresholdP, &length);
 }
 
-bool ThyoneI_GetGPIOBlockRemoteConfig(uint8_t* remoteConfigP)
+bool ThyoneI_Handle_GetGPIOBlockRemoteConfig(ThyoneI_Handle_t* handle, uint8_t* remoteConfigP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_REMOTE_GPIO_CONFIG, remoteConfigP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_REMOTE_GPIO_CONFIG, remoteConfigP, &length);
 }
 
-bool ThyoneI_GetModuleMode(ThyoneI_ModuleMode_t* moduleModeP)
+bool ThyoneI_Handle_GetModuleMode(ThyoneI_Handle_t* handle, ThyoneI_ModuleMode_t* moduleModeP)
 {
     uint16_t length;
-    return ThyoneI_Get(ThyoneI_USERSETTING_INDEX_MODULE_MODE, (uint8_t*)moduleModeP, &length);
+    return ThyoneI_Handle_Get(handle, ThyoneI_USERSETTING_INDEX_MODULE_MODE, (uint8_t*)moduleModeP, &length);
 }
 
-bool ThyoneI_GetState(ThyoneI_States_t* state)
+bool ThyoneI_Handle_GetState(ThyoneI_Handle_t* handle, ThyoneI_States_t* state)
 {
     if (state == NULL)
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GETSTATE_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = THYONEI_CMD_GETSTATE_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GETSTATE_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GETSTATE_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GETSTATE_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    *state = rxPacket.Data[1];
+    *state = handle->rxPacket.Data[1];
     return true;
 }
 
-bool ThyoneI_GPIOLocalSetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls)
+bool ThyoneI_Handle_GPIOLocalSetConfig(ThyoneI_Handle_t* handle, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls)
 {
     if ((configP == NULL) || (numberOfControls == 0))
     {
@@ -1148,38 +1208,38 @@ bool ThyoneI_GPIOLocalSetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t num
         {
             case ThyoneI_GPIO_IO_Disconnected:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = 0x00;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = 0x00;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_Input:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.input;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.input;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_Output:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.output;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.output;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_PWM:
             {
-                txPacket.Data[length] = 5;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                memcpy(&txPacket.Data[length + 3], &configP->value.pwm.period, 2);
-                txPacket.Data[length + 5] = configP->value.pwm.ratio;
+                handle->txPacket.Data[length] = 5;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                memcpy(&handle->txPacket.Data[length + 3], &configP->value.pwm.period, 2);
+                handle->txPacket.Data[length + 5] = configP->value.pwm.ratio;
                 length += 6;
             }
             break;
@@ -1191,49 +1251,50 @@ bool ThyoneI_GPIOLocalSetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t num
         configP++;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_SETCONFIG_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_SETCONFIG_REQ;
+    handle->txPacket.Length = length;
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_SETCONFIG_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_SETCONFIG_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_GPIOLocalGetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP)
+bool ThyoneI_Handle_GPIOLocalGetConfig(ThyoneI_Handle_t* handle, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP)
 {
     if ((configP == NULL) || (numberOfControlsP == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_GETCONFIG_REQ;
-    txPacket.Length = 0;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_GETCONFIG_REQ;
+    handle->txPacket.Length = 0;
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GPIO_LOCAL_GETCONFIG_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_GETCONFIG_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_GETCONFIG_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
+    uint16_t length = handle->rxPacket.Length;
 
     *numberOfControlsP = 0;
-    uint8_t* uartP = &rxPacket.Data[1];
+    uint8_t* uartP = &handle->rxPacket.Data[1];
     ThyoneI_GPIOConfigBlock_t* configP_running = configP;
-    while (uartP < &rxPacket.Data[length])
+    while (uartP < &handle->rxPacket.Data[length])
     {
         switch (*(uartP + 2))
         {
@@ -1299,7 +1360,10 @@ bool ThyoneI_GPIOLocalGetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t* nu
     return true;
 }
 
-bool ThyoneI_GPIOLocalWrite(ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls)
+/**
+ * @brief Prepares a CMD_GPIO_LOCAL_WRITE_REQ in handle->txPacket.
+ */
+static bool PrepareGPIOLocalWriteRequest(ThyoneI_Handle_t* handle, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls)
 {
     if ((controlP == NULL) || (number_of_controls == 0))
     {
@@ -1310,58 +1374,79 @@ bool ThyoneI_GPIOLocalWrite(ThyoneI_GPIOControlBlock_t* controlP, uint16_t numbe
 
     for (uint16_t i = 0; i < number_of_controls; i++)
     {
-        txPacket.Data[length] = 2;
-        txPacket.Data[length + 1] = controlP->GPIO_ID;
-        txPacket.Data[length + 2] = controlP->value.output;
+        handle->txPacket.Data[length] = 2;
+        handle->txPacket.Data[length + 1] = controlP->GPIO_ID;
+        handle->txPacket.Data[length + 2] = controlP->value.output;
         length += 3;
         controlP++;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_WRITE_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_WRITE_REQ;
+    handle->txPacket.Length = length;
+    return true;
+}
 
-    FillChecksum(&txPacket);
+bool ThyoneI_Handle_GPIOLocalWrite(ThyoneI_Handle_t* handle, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls)
+{
+    if (!PrepareGPIOLocalWriteRequest(handle, controlP, number_of_controls))
+    {
+        return false;
+    }
+
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_WRITE_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_WRITE_CNF, CMD_Status_Success, true);
+}
+
+bool ThyoneI_Handle_GPIOLocalWriteAsync(ThyoneI_Handle_t* handle, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls, ThyoneI_AsyncCallback_t cb)
+{
+    if (!PrepareGPIOLocalWriteRequest(handle, controlP, number_of_controls))
+    {
+        return false;
+    }
+    return SendAsyncRequest(handle, THYONEI_CMD_GPIO_LOCAL_WRITE_CNF, cb);
 }
 
-bool ThyoneI_GPIOLocalRead(uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls)
+void ThyoneI_Handle_CheckAsyncTimeouts(ThyoneI_Handle_t* handle) { CMDFrame_AsyncQueue_CheckTimeouts(&handle->asyncQueue); }
+
+bool ThyoneI_Handle_GPIOLocalRead(ThyoneI_Handle_t* handle, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls)
 {
     if ((GPIOToReadP == NULL) || (amountGPIOToRead == 0) || (controlP == NULL) || (numberOfControls == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_READ_REQ;
-    txPacket.Length = amountGPIOToRead + 1;
-    txPacket.Data[0] = amountGPIOToRead;
-    memcpy(&txPacket.Data[1], GPIOToReadP, amountGPIOToRead);
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_LOCAL_READ_REQ;
+    handle->txPacket.Length = amountGPIOToRead + 1;
+    handle->txPacket.Data[0] = amountGPIOToRead;
+    memcpy(&handle->txPacket.Data[1], GPIOToReadP, amountGPIOToRead);
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GPIO_LOCAL_READ_CNF);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_READ_CNF, CMD_Status_Success, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_LOCAL_READ_CNF, CMD_Status_Success, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
+    uint16_t length = handle->rxPacket.Length;
 
     *numberOfControls = 0;
-    uint8_t* uartP = &rxPacket.Data[1];
+    uint8_t* uartP = &handle->rxPacket.Data[1];
     ThyoneI_GPIOControlBlock_t* controlP_running = controlP;
-    while (uartP < &rxPacket.Data[length])
+    while (uartP < &handle->rxPacket.Data[length])
     {
         if (*uartP == 2)
         {
@@ -1376,7 +1461,7 @@ bool ThyoneI_GPIOLocalRead(uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, Thyon
     return true;
 }
 
-bool ThyoneI_GPIORemoteSetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls)
+bool ThyoneI_Handle_GPIORemoteSetConfig(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls)
 {
     if ((configP == NULL) || (numberOfControls == 0))
     {
@@ -1391,38 +1476,38 @@ bool ThyoneI_GPIORemoteSetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t
         {
             case ThyoneI_GPIO_IO_Disconnected:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = 0x00;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = 0x00;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_Input:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.input;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.input;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_Output:
             {
-                txPacket.Data[length] = 3;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                txPacket.Data[length + 3] = configP->value.output;
+                handle->txPacket.Data[length] = 3;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                handle->txPacket.Data[length + 3] = configP->value.output;
                 length += 4;
             }
             break;
             case ThyoneI_GPIO_IO_PWM:
             {
-                txPacket.Data[length] = 5;
-                txPacket.Data[length + 1] = configP->GPIO_ID;
-                txPacket.Data[length + 2] = configP->function;
-                memcpy(&txPacket.Data[length + 3], &configP->value.pwm.period, 2);
-                txPacket.Data[length + 5] = configP->value.pwm.ratio;
+                handle->txPacket.Data[length] = 5;
+                handle->txPacket.Data[length + 1] = configP->GPIO_ID;
+                handle->txPacket.Data[length + 2] = configP->function;
+                memcpy(&handle->txPacket.Data[length + 3], &configP->value.pwm.period, 2);
+                handle->txPacket.Data[length + 5] = configP->value.pwm.ratio;
                 length += 6;
             }
             break;
@@ -1434,52 +1519,53 @@ bool ThyoneI_GPIORemoteSetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t
         configP++;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_SETCONFIG_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_SETCONFIG_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], &destAddress, 4);
+    memcpy(&handle->txPacket.Data[0], &destAddress, 4);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_SETCONFIG_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_SETCONFIG_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_GPIORemoteGetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP)
+bool ThyoneI_Handle_GPIORemoteGetConfig(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP)
 {
     if ((configP == NULL) || (numberOfControlsP == NULL))
     {
         return false;
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_GETCONFIG_REQ;
-    txPacket.Length = 4;
-    memcpy(&txPacket.Data[0], &destAddress, 4);
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_GETCONFIG_REQ;
+    handle->txPacket.Length = 4;
+    memcpy(&handle->txPacket.Data[0], &destAddress, 4);
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GPIO_REMOTE_GETCONFIG_RSP);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_GETCONFIG_RSP, CMD_Status_NoStatus, true))
+    if (!Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_GETCONFIG_RSP, CMD_Status_NoStatus, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
+    uint16_t length = handle->rxPacket.Length;
 
     *numberOfControlsP = 0;
-    uint8_t* uartP = &rxPacket.Data[1 + 4];
+    uint8_t* uartP = &handle->rxPacket.Data[1 + 4];
     ThyoneI_GPIOConfigBlock_t* configP_running = configP;
-    while (uartP < &rxPacket.Data[length])
+    while (uartP < &handle->rxPacket.Data[length])
     {
         switch (*(uartP + 2))
         {
@@ -1545,7 +1631,7 @@ bool ThyoneI_GPIORemoteGetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t
     return true;
 }
 
-bool ThyoneI_GPIORemoteWrite(uint32_t destAddress, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls)
+bool ThyoneI_Handle_GPIORemoteWrite(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls)
 {
     if ((controlP == NULL) || (number_of_controls == 0))
     {
@@ -1556,30 +1642,30 @@ bool ThyoneI_GPIORemoteWrite(uint32_t destAddress, ThyoneI_GPIOControlBlock_t* c
 
     for (uint16_t i = 0; i < number_of_controls; i++)
     {
-        txPacket.Data[length] = 2;
-        txPacket.Data[length + 1] = controlP->GPIO_ID;
-        txPacket.Data[length + 2] = controlP->value.output;
+        handle->txPacket.Data[length] = 2;
+        handle->txPacket.Data[length + 1] = controlP->GPIO_ID;
+        handle->txPacket.Data[length + 2] = controlP->value.output;
         length += 3;
         controlP += sizeof(ThyoneI_GPIOControlBlock_t);
     }
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_WRITE_REQ;
-    txPacket.Length = length;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_WRITE_REQ;
+    handle->txPacket.Length = length;
 
-    memcpy(&txPacket.Data[0], &destAddress, 4);
+    memcpy(&handle->txPacket.Data[0], &destAddress, 4);
 
-    FillChecksum(&txPacket);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    return Wait4CNF(CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_WRITE_CNF, CMD_Status_Success, true);
+    return Wait4CNF(handle, CMD_WAIT_TIME, THYONEI_CMD_GPIO_REMOTE_WRITE_CNF, CMD_Status_Success, true);
 }
 
-bool ThyoneI_GPIORemoteRead(uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls)
+bool ThyoneI_Handle_GPIORemoteRead(ThyoneI_Handle_t* handle, uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls)
 {
     if ((GPIOToReadP == NULL) || (amountGPIOToRead == 0) || (controlP == NULL) || (numberOfControls == NULL))
     {
@@ -1589,32 +1675,33 @@ bool ThyoneI_GPIORemoteRead(uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t
     /* payload is 4-byte destination address + pin configuration*/
     uint16_t commandLength = 1 + amountGPIOToRead + 4;
 
-    txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_READ_REQ;
-    txPacket.Length = commandLength;
+    handle->txPacket.Cmd = THYONEI_CMD_GPIO_REMOTE_READ_REQ;
+    handle->txPacket.Length = commandLength;
 
-    memcpy(&txPacket.Data[0], &destAddress, 4);
-    txPacket.Data[4] = amountGPIOToRead;
-    memcpy(&txPacket.Data[5], GPIOToReadP, amountGPIOToRead);
+    memcpy(&handle->txPacket.Data[0], &destAddress, 4);
+    handle->txPacket.Data[4] = amountGPIOToRead;
+    memcpy(&handle->txPacket.Data[5], GPIOToReadP, amountGPIOToRead);
 
-    FillChecksum(&txPacket);
+    ExpectResponse(handle, THYONEI_CMD_GPIO_REMOTE_READ_RSP);
+    FillChecksum(&handle->txPacket);
 
-    if (!ThyoneI_Transparent_Transmit((uint8_t*)&txPacket, txPacket.Length + LENGTH_CMD_OVERHEAD))
+    if (!ThyoneI_Handle_Transparent_Transmit(handle, (uint8_t*)&handle->txPacket, handle->txPacket.Length + LENGTH_CMD_OVERHEAD))
     {
         return false;
     }
 
     /* wait for cnf */
-    if (!Wait4CNF(1000, THYONEI_CMD_GPIO_REMOTE_READ_RSP, CMD_Status_NoStatus, true))
+    if (!Wait4CNF(handle, 1000, THYONEI_CMD_GPIO_REMOTE_READ_RSP, CMD_Status_NoStatus, true))
     {
         return false;
     }
 
-    uint16_t length = rxPacket.Length;
+    uint16_t length = handle->rxPacket.Length;
 
     *numberOfControls = 0;
-    uint8_t* uartP = &rxPacket.Data[1 + 4];
+    uint8_t* uartP = &handle->rxPacket.Data[1 + 4];
     ThyoneI_GPIOControlBlock_t* controlP_running = controlP;
-    while (uartP < &rxPacket.Data[length])
+    while (uartP < &handle->rxPacket.Data[length])
     {
         if (*uartP == 2)
         {
@@ -1629,7 +1716,7 @@ bool ThyoneI_GPIORemoteRead(uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t
     return true;
 }
 
-bool ThyoneI_IsTransparentModeBusy(bool* busyStateP)
+bool ThyoneI_Handle_IsTransparentModeBusy(ThyoneI_Handle_t* handle, bool* busyStateP)
 {
     if (busyStateP == NULL)
     {
@@ -1638,7 +1725,7 @@ bool ThyoneI_IsTransparentModeBusy(bool* busyStateP)
 
     WE_Pin_Level_t pin_level;
 
-    if (!WE_GetPinLevel(ThyoneI_pinsP->ThyoneI_Pin_Busy, &pin_level))
+    if (!WE_GetPinLevel(handle->pinsP->ThyoneI_Pin_Busy, &pin_level))
     {
         return false;
     }
@@ -1647,3 +1734,149 @@ bool ThyoneI_IsTransparentModeBusy(bool* busyStateP)
 
     return true;
 }
+
+ThyoneI_Handle_t* ThyoneI_GetHandle(uint8_t index) { return (index < THYONEI_MAX_INSTANCES) ? &instances[index] : NULL; }
+
+/**************************************
+ *   Functions for default instance   *
+ **************************************/
+
+bool ThyoneI_Transparent_Transmit(const uint8_t* data, uint16_t dataLength) { return ThyoneI_Handle_Transparent_Transmit(DEFAULT_HANDLE, data, dataLength); }
+
+bool ThyoneI_Init(WE_UART_t* uartP, ThyoneI_Pins_t* pinoutP, ThyoneI_OperationMode_t opMode, void (*RXcb)(uint8_t*, uint16_t, uint32_t, int8_t)) { return ThyoneI_Handle_Init(DEFAULT_HANDLE, uartP, pinoutP, opMode, RXcb); }
+
+bool ThyoneI_Deinit() { return ThyoneI_Handle_Deinit(DEFAULT_HANDLE); }
+
+bool ThyoneI_PinWakeup() { return ThyoneI_Handle_PinWakeup(DEFAULT_HANDLE); }
+
+bool ThyoneI_PinReset() { return ThyoneI_Handle_PinReset(DEFAULT_HANDLE); }
+
+bool ThyoneI_Reset() { return ThyoneI_Handle_Reset(DEFAULT_HANDLE); }
+
+bool ThyoneI_Sleep() { return ThyoneI_Handle_Sleep(DEFAULT_HANDLE); }
+
+bool ThyoneI_TransmitBroadcast(uint8_t* payloadP, uint16_t length) { return ThyoneI_Handle_TransmitBroadcast(DEFAULT_HANDLE, payloadP, length); }
+
+bool ThyoneI_TransmitMulticast(uint8_t* payloadP, uint16_t length) { return ThyoneI_Handle_TransmitMulticast(DEFAULT_HANDLE, payloadP, length); }
+
+bool ThyoneI_TransmitUnicast(uint8_t* payloadP, uint16_t length) { return ThyoneI_Handle_TransmitUnicast(DEFAULT_HANDLE, payloadP, length); }
+
+bool ThyoneI_TransmitMulticastExtended(uint8_t groupID, uint8_t* payloadP, uint16_t length) { return ThyoneI_Handle_TransmitMulticastExtended(DEFAULT_HANDLE, groupID, payloadP, length); }
+
+bool ThyoneI_TransmitUnicastExtended(uint32_t address, uint8_t* payloadP, uint16_t length) { return ThyoneI_Handle_TransmitUnicastExtended(DEFAULT_HANDLE, address, payloadP, length); }
+
+bool ThyoneI_SetRam(ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* valueP, uint8_t length) { return ThyoneI_Handle_SetRam(DEFAULT_HANDLE, runtimeSetting, valueP, length); }
+
+bool ThyoneI_FactoryReset() { return ThyoneI_Handle_FactoryReset(DEFAULT_HANDLE); }
+
+bool ThyoneI_CheckNSet(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return ThyoneI_Handle_CheckNSet(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool ThyoneI_Set(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length) { return ThyoneI_Handle_Set(DEFAULT_HANDLE, userSetting, valueP, length); }
+
+bool ThyoneI_SetAsync(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ThyoneI_AsyncCallback_t cb) { return ThyoneI_Handle_SetAsync(DEFAULT_HANDLE, userSetting, valueP, length, cb); }
+
+bool ThyoneI_SetTXPower(ThyoneI_TXPower_t txPower) { return ThyoneI_Handle_SetTXPower(DEFAULT_HANDLE, txPower); }
+
+bool ThyoneI_SetBaudrateIndex(ThyoneI_BaudRateIndex_t baudrate, ThyoneI_UartParity_t parity, bool flowcontrolEnable) { return ThyoneI_Handle_SetBaudrateIndex(DEFAULT_HANDLE, baudrate, parity, flowcontrolEnable); }
+
+bool ThyoneI_SetRFChannel(uint8_t channel) { return ThyoneI_Handle_SetRFChannel(DEFAULT_HANDLE, channel); }
+
+bool ThyoneI_SetRFChannelRuntime(uint8_t channel) { return ThyoneI_Handle_SetRFChannelRuntime(DEFAULT_HANDLE, channel); }
+
+bool ThyoneI_SetEncryptionMode(ThyoneI_EncryptionMode_t encryptionMode) { return ThyoneI_Handle_SetEncryptionMode(DEFAULT_HANDLE, encryptionMode); }
+
+bool ThyoneI_SetRfProfile(ThyoneI_Profile_t profile) { return ThyoneI_Handle_SetRfProfile(DEFAULT_HANDLE, profile); }
+
+bool ThyoneI_SetNumRetries(uint8_t numRetries) { return ThyoneI_Handle_SetNumRetries(DEFAULT_HANDLE, numRetries); }
+
+bool ThyoneI_SetRpNumSlots(uint8_t numSlots) { return ThyoneI_Handle_SetRpNumSlots(DEFAULT_HANDLE, numSlots); }
+
+bool ThyoneI_SetSourceAddress(uint32_t sourceAddress) { return ThyoneI_Handle_SetSourceAddress(DEFAULT_HANDLE, sourceAddress); }
+
+bool ThyoneI_SetDestinationAddress(uint32_t destinationAddress) { return ThyoneI_Handle_SetDestinationAddress(DEFAULT_HANDLE, destinationAddress); }
+
+bool ThyoneI_SetGroupID(uint8_t groupId) { return ThyoneI_Handle_SetGroupID(DEFAULT_HANDLE, groupId); }
+
+bool ThyoneI_SetEncryptionKey(uint8_t* keyP) { return ThyoneI_Handle_SetEncryptionKey(DEFAULT_HANDLE, keyP); }
+
+bool ThyoneI_SetTimeToLive(uint8_t ttl) { return ThyoneI_Handle_SetTimeToLive(DEFAULT_HANDLE, ttl); }
+
+bool ThyoneI_SetCCAMode(uint8_t ccaMode) { return ThyoneI_Handle_SetCCAMode(DEFAULT_HANDLE, ccaMode); }
+
+bool ThyoneI_SetCCAThreshold(uint8_t ccaThreshold) { return ThyoneI_Handle_SetCCAThreshold(DEFAULT_HANDLE, ccaThreshold); }
+
+bool ThyoneI_SetGPIOBlockRemoteConfig(uint8_t remoteConfig) { return ThyoneI_Handle_SetGPIOBlockRemoteConfig(DEFAULT_HANDLE, remoteConfig); }
+
+bool ThyoneI_SetModuleMode(ThyoneI_ModuleMode_t moduleMode) { return ThyoneI_Handle_SetModuleMode(DEFAULT_HANDLE, moduleMode); }
+
+bool ThyoneI_GetRam(ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* ResponseP, uint16_t* Response_LengthP) { return ThyoneI_Handle_GetRam(DEFAULT_HANDLE, runtimeSetting, ResponseP, Response_LengthP); }
+
+bool ThyoneI_Get(ThyoneI_UserSettings_t userSetting, uint8_t* ResponseP, uint16_t* Response_LengthP) { return ThyoneI_Handle_Get(DEFAULT_HANDLE, userSetting, ResponseP, Response_LengthP); }
+
+bool ThyoneI_GetAsync(ThyoneI_UserSettings_t userSetting, ThyoneI_AsyncCallback_t cb) { return ThyoneI_Handle_GetAsync(DEFAULT_HANDLE, userSetting, cb); }
+
+bool ThyoneI_GetSerialNumber(uint8_t* serialNumberP) { return ThyoneI_Handle_GetSerialNumber(DEFAULT_HANDLE, serialNumberP); }
+
+bool ThyoneI_GetFWVersion(uint8_t* versionP) { return ThyoneI_Handle_GetFWVersion(DEFAULT_HANDLE, versionP); }
+
+bool ThyoneI_GetTXPower(ThyoneI_TXPower_t* txpowerP) { return ThyoneI_Handle_GetTXPower(DEFAULT_HANDLE, txpowerP); }
+
+bool ThyoneI_GetBaudrateIndex(ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartParity_t* parityP, bool* flowcontrolEnableP) { return ThyoneI_Handle_GetBaudrateIndex(DEFAULT_HANDLE, baudrateP, parityP, flowcontrolEnableP); }
+
+bool ThyoneI_GetEncryptionMode(ThyoneI_EncryptionMode_t* encryptionModeP) { return ThyoneI_Handle_GetEncryptionMode(DEFAULT_HANDLE, encryptionModeP); }
+
+bool ThyoneI_GetRfProfile(ThyoneI_Profile_t* profileP) { return ThyoneI_Handle_GetRfProfile(DEFAULT_HANDLE, profileP); }
+
+bool ThyoneI_GetRFChannel(uint8_t* channelP) { return ThyoneI_Handle_GetRFChannel(DEFAULT_HANDLE, channelP); }
+
+bool ThyoneI_GetNumRetries(uint8_t* numRetriesP) { return ThyoneI_Handle_GetNumRetries(DEFAULT_HANDLE, numRetriesP); }
+
+bool ThyoneI_GetRpNumSlots(uint8_t* numSlotsP) { return ThyoneI_Handle_GetRpNumSlots(DEFAULT_HANDLE, numSlotsP); }
+
+bool ThyoneI_GetSourceAddress(uint32_t* sourceAddressP) { return ThyoneI_Handle_GetSourceAddress(DEFAULT_HANDLE, sourceAddressP); }
+
+bool ThyoneI_GetDestinationAddress(uint32_t* destinationAddressP) { return ThyoneI_Handle_GetDestinationAddress(DEFAULT_HANDLE, destinationAddressP); }
+
+bool ThyoneI_GetGroupID(uint8_t* groupIdP) { return ThyoneI_Handle_GetGroupID(DEFAULT_HANDLE, groupIdP); }
+
+bool ThyoneI_GetTimeToLive(uint8_t* ttlP) { return ThyoneI_Handle_GetTimeToLive(DEFAULT_HANDLE, ttlP); }
+
+bool ThyoneI_GetCCAMode(uint8_t* ccaModeP) { return ThyoneI_Handle_GetCCAMode(DEFAULT_HANDLE, ccaModeP); }
+
+bool ThyoneI_GetCCAThreshold(uint8_t* ccaThresholdP) { return ThyoneI_Handle_GetCCAThreshold(DEFAULT_HANDLE, ccaThresholdP); }
+
+bool ThyoneI_GetGPIOBlockRemoteConfig(uint8_t* remoteConfigP) { return ThyoneI_Handle_GetGPIOBlockRemoteConfig(DEFAULT_HANDLE, remoteConfigP); }
+
+bool ThyoneI_GetModuleMode(ThyoneI_ModuleMode_t* moduleModeP) { return ThyoneI_Handle_GetModuleMode(DEFAULT_HANDLE, moduleModeP); }
+
+bool ThyoneI_GetState(ThyoneI_States_t* state) { return ThyoneI_Handle_GetState(DEFAULT_HANDLE, state); }
+
+bool ThyoneI_GPIOLocalSetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls) { return ThyoneI_Handle_GPIOLocalSetConfig(DEFAULT_HANDLE, configP, numberOfControls); }
+
+bool ThyoneI_GPIOLocalGetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP) { return ThyoneI_Handle_GPIOLocalGetConfig(DEFAULT_HANDLE, configP, numberOfControlsP); }
+
+bool ThyoneI_GPIOLocalWrite(ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls) { return ThyoneI_Handle_GPIOLocalWrite(DEFAULT_HANDLE, controlP, number_of_controls); }
+
+bool ThyoneI_GPIOLocalWriteAsync(ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls, ThyoneI_AsyncCallback_t cb) { return ThyoneI_Handle_GPIOLocalWriteAsync(DEFAULT_HANDLE, controlP, number_of_controls, cb); }
+
+void ThyoneI_CheckAsyncTimeouts() { ThyoneI_Handle_CheckAsyncTimeouts(DEFAULT_HANDLE); }
+
+bool ThyoneI_GPIOLocalRead(uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls) { return ThyoneI_Handle_GPIOLocalRead(DEFAULT_HANDLE, GPIOToReadP, amountGPIOToRead, controlP, numberOfControls); }
+
+bool ThyoneI_GPIORemoteSetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls) { return ThyoneI_Handle_GPIORemoteSetConfig(DEFAULT_HANDLE, destAddress, configP, numberOfControls); }
+
+bool ThyoneI_GPIORemoteGetConfig(uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP) { return ThyoneI_Handle_GPIORemoteGetConfig(DEFAULT_HANDLE, destAddress, configP, numberOfControlsP); }
+
+bool ThyoneI_GPIORemoteWrite(uint32_t destAddress, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls) { return ThyoneI_Handle_GPIORemoteWrite(DEFAULT_HANDLE, destAddress, controlP, number_of_controls); }
+
+bool ThyoneI_GPIORemoteRead(uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls) { return ThyoneI_Handle_GPIORemoteRead(DEFAULT_HANDLE, destAddress, GPIOToReadP, amountGPIOToRead, controlP, numberOfControls); }
+
+bool ThyoneI_IsTransparentModeBusy(bool* busyStateP) { return ThyoneI_Handle_IsTransparentModeBusy(DEFAULT_HANDLE, busyStateP); }
+
+uint32_t ThyoneI_GetConfirmationOverflowCount() { return ThyoneI_Handle_GetConfirmationOverflowCount(DEFAULT_HANDLE); }
+
+#if defined(WE_STATS_ENABLED)
+bool ThyoneI_GetStatistics(WE_Stats_t* statsP) { return ThyoneI_Handle_GetStatistics(DEFAULT_HANDLE, statsP); }
+
+void ThyoneI_ResetStatistics() { ThyoneI_Handle_ResetStatistics(DEFAULT_HANDLE); }
+#endif
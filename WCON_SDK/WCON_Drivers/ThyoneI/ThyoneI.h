@@ -37,6 +37,7 @@ extern "C"
 #define THYONEI_H_INCLUDED
 
 #include <global/global_types.h>
+#include <global/stats.h>
 #include <stdbool.h>
 
 /** Boot-up time */
@@ -299,6 +300,47 @@ typedef enum ThyoneI_AddressMode_t
     ThyoneI_AddressMode_Unicast = (uint8_t)2,
 } ThyoneI_AddressMode_t;
 
+/**
+ * @brief Is called when a request sent using one of the *Async() functions has been completed.
+ *
+ * Is called from the context processing the received data, or from ThyoneI_CheckAsyncTimeouts()
+ * in case of a timeout.
+ *
+ * @param[in] success: True if the confirmation has been received with status success, false otherwise (e.g. timeout)
+ * @param[in] dataP: Payload of the confirmation (status byte followed by the response data, NULL on timeout)
+ * @param[in] length: Length of the payload
+ *
+ * @return None
+ */
+typedef void (*ThyoneI_AsyncCallback_t)(bool success, uint8_t* dataP, uint16_t length);
+
+#ifndef THYONEI_MAX_INSTANCES
+/**
+ * @brief Max. number of Thyone-I modules that can be driven at the same time (see ThyoneI_GetHandle()).
+ */
+#define THYONEI_MAX_INSTANCES 1
+#endif
+
+/**
+ * @brief Handle of a driver instance (opaque).
+ *
+ * Each instance holds its own state (UART, pins, callbacks, receive buffers), so
+ * several Thyone-I modules connected to different UARTs can be used at the same time.
+ * The functions without handle parameter operate on the instance with index 0.
+ * Note that callbacks don't receive the handle - use different callback functions
+ * for each instance if needed.
+ */
+typedef struct ThyoneI_Handle_t ThyoneI_Handle_t;
+
+/**
+ * @brief Returns the handle of a driver instance.
+ *
+ * @param[in] index: Index of instance (0 to THYONEI_MAX_INSTANCES - 1, 0 is the default instance)
+ *
+ * @return Handle of the instance or NULL if index is out of range
+ */
+extern ThyoneI_Handle_t* ThyoneI_GetHandle(uint8_t index);
+
 /**
  * @brief Initialize the ThyoneI interface for serial interface
  *
@@ -468,6 +510,29 @@ extern bool ThyoneI_GPIOLocalGetConfig(ThyoneI_GPIOConfigBlock_t* configP, uint1
  */
 extern bool ThyoneI_GPIOLocalWrite(ThyoneI_GPIOControlBlock_t* controlP, uint16_t numberOfControls);
 
+/**
+ * @brief Set the output value of the local pin without waiting for the confirmation.
+ * See ThyoneI_GPIOLocalWrite
+ *
+ * @param[in] controlP: Pointer to one or more pin controls
+ * @param[in] numberOfControls: Number of entries in controlP array
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise (e.g. too many pending asynchronous requests)
+ */
+extern bool ThyoneI_GPIOLocalWriteAsync(ThyoneI_GPIOControlBlock_t* controlP, uint16_t numberOfControls, ThyoneI_AsyncCallback_t cb);
+
+/**
+ * @brief Completes pending asynchronous requests that haven't been confirmed in time
+ *
+ * Timeouts are also checked whenever a request is sent or a confirmation is received,
+ * so this function only needs to be called periodically if no further requests are sent.
+ *
+ * @return None
+ */
+extern void ThyoneI_CheckAsyncTimeouts();
+
 /**
  * @brief Read the input of the pin. Pin has to be configured first.
  * See ThyoneI_GPIOLocalWriteConfig
@@ -581,6 +646,20 @@ extern bool ThyoneI_FactoryReset();
  */
 extern bool ThyoneI_Set(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
 
+/**
+ * @brief Set a special user setting without waiting for the confirmation.
+ * See ThyoneI_Set
+ *
+ * @param[in] userSetting: User setting to be updated
+ * @param[in] valueP: Pointer to the new settings value
+ * @param[in] length: Length of the value
+ * @param[in] cb: Function called when the confirmation has been received (may be NULL)
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+ */
+extern bool ThyoneI_SetAsync(ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ThyoneI_AsyncCallback_t cb);
+
 /**
  * @brief Set a special user setting, but checks first if the value is already ok
  *
@@ -784,6 +863,17 @@ extern bool ThyoneI_SetModuleMode(ThyoneI_ModuleMode_t moduleMode);
  */
 extern bool ThyoneI_Get(ThyoneI_UserSettings_t userSetting, uint8_t* responseP, uint16_t* lengthP);
 
+/**
+ * @brief Request the current user settings without waiting for the response
+ *
+ * @param[in] userSetting: user setting to be requested
+ * @param[in] cb: Function called with the requested content when the response has been received
+ *
+ * @return True if request has been sent,
+ *         false otherwise
+ */
+extern bool ThyoneI_GetAsync(ThyoneI_UserSettings_t userSetting, ThyoneI_AsyncCallback_t cb);
+
 /**
  * @brief Request the 4 byte serial number
  *
@@ -967,6 +1057,111 @@ extern bool ThyoneI_GetModuleMode(ThyoneI_ModuleMode_t* moduleModeP);
  */
 extern bool ThyoneI_GetState(ThyoneI_States_t* stateP);
 
+/**
+ * @brief Returns how often a confirmation received from the module has been discarded before
+ * having been evaluated, as too many confirmations were pending (see CMDFRAME_CONFIRMATION_QUEUE_LENGTH).
+ *
+ * @return Number of discarded confirmations
+ */
+extern uint32_t ThyoneI_GetConfirmationOverflowCount();
+
+#if defined(WE_STATS_ENABLED)
+/**
+ * @brief Copies the driver's performance counters and latency histograms (see global/stats.h).
+ *
+ * @param[out] statsP: Statistics
+ *
+ * @return True if request succeeded,
+ *         false otherwise
+ */
+extern bool ThyoneI_GetStatistics(WE_Stats_t* statsP);
+
+/**
+ * @brief Resets the driver's performance counters and latency histograms.
+ */
+extern void ThyoneI_ResetStatistics();
+#endif
+
+/**
+ * @name Functions operating on a specific driver instance
+ *
+ * Same as the corresponding functions without handle parameter (e.g. ThyoneI_Handle_Init() is
+ * the same as ThyoneI_Init()), but for the driver instance referenced by handle (see ThyoneI_GetHandle()).
+ * @{
+ */
+extern bool ThyoneI_Handle_Init(ThyoneI_Handle_t* handle, WE_UART_t* uartP, ThyoneI_Pins_t* pinoutP, ThyoneI_OperationMode_t opMode, void (*RXcb)(uint8_t*, uint16_t, uint32_t, int8_t));
+extern bool ThyoneI_Handle_Deinit(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_PinReset(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_Reset(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_Sleep(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_PinWakeup(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_IsTransparentModeBusy(ThyoneI_Handle_t* handle, bool* busyStateP);
+extern bool ThyoneI_Handle_TransmitBroadcast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length);
+extern bool ThyoneI_Handle_TransmitMulticast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length);
+extern bool ThyoneI_Handle_TransmitUnicast(ThyoneI_Handle_t* handle, uint8_t* payloadP, uint16_t length);
+extern bool ThyoneI_Handle_Transparent_Transmit(ThyoneI_Handle_t* handle, const uint8_t* data, uint16_t dataLength);
+extern bool ThyoneI_Handle_TransmitMulticastExtended(ThyoneI_Handle_t* handle, uint8_t groupID, uint8_t* payloadP, uint16_t length);
+extern bool ThyoneI_Handle_TransmitUnicastExtended(ThyoneI_Handle_t* handle, uint32_t address, uint8_t* payloadP, uint16_t length);
+extern bool ThyoneI_Handle_GPIOLocalSetConfig(ThyoneI_Handle_t* handle, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls);
+extern bool ThyoneI_Handle_GPIOLocalGetConfig(ThyoneI_Handle_t* handle, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP);
+extern bool ThyoneI_Handle_GPIOLocalWrite(ThyoneI_Handle_t* handle, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls);
+extern bool ThyoneI_Handle_GPIOLocalWriteAsync(ThyoneI_Handle_t* handle, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls, ThyoneI_AsyncCallback_t cb);
+extern void ThyoneI_Handle_CheckAsyncTimeouts(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_GPIOLocalRead(ThyoneI_Handle_t* handle, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls);
+extern bool ThyoneI_Handle_GPIORemoteSetConfig(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t numberOfControls);
+extern bool ThyoneI_Handle_GPIORemoteGetConfig(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOConfigBlock_t* configP, uint16_t* numberOfControlsP);
+extern bool ThyoneI_Handle_GPIORemoteWrite(ThyoneI_Handle_t* handle, uint32_t destAddress, ThyoneI_GPIOControlBlock_t* controlP, uint16_t number_of_controls);
+extern bool ThyoneI_Handle_GPIORemoteRead(ThyoneI_Handle_t* handle, uint32_t destAddress, uint8_t* GPIOToReadP, uint8_t amountGPIOToRead, ThyoneI_GPIOControlBlock_t* controlP, uint16_t* numberOfControls);
+extern bool ThyoneI_Handle_SetRam(ThyoneI_Handle_t* handle, ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* valueP, uint8_t length);
+extern bool ThyoneI_Handle_GetRam(ThyoneI_Handle_t* handle, ThyoneI_RuntimeSettings_t runtimeSetting, uint8_t* ResponseP, uint16_t* Response_LengthP);
+extern bool ThyoneI_Handle_FactoryReset(ThyoneI_Handle_t* handle);
+extern bool ThyoneI_Handle_Set(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool ThyoneI_Handle_SetAsync(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length, ThyoneI_AsyncCallback_t cb);
+extern bool ThyoneI_Handle_CheckNSet(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* valueP, uint8_t length);
+extern bool ThyoneI_Handle_SetBaudrateIndex(ThyoneI_Handle_t* handle, ThyoneI_BaudRateIndex_t baudrate, ThyoneI_UartParity_t parity, bool flowcontrolEnable);
+extern bool ThyoneI_Handle_SetEncryptionMode(ThyoneI_Handle_t* handle, ThyoneI_EncryptionMode_t encryptionMode);
+extern bool ThyoneI_Handle_SetRfProfile(ThyoneI_Handle_t* handle, ThyoneI_Profile_t profile);
+extern bool ThyoneI_Handle_SetRFChannel(ThyoneI_Handle_t* handle, uint8_t channel);
+extern bool ThyoneI_Handle_SetRFChannelRuntime(ThyoneI_Handle_t* handle, uint8_t channel);
+extern bool ThyoneI_Handle_SetNumRetries(ThyoneI_Handle_t* handle, uint8_t numRetries);
+extern bool ThyoneI_Handle_SetTXPower(ThyoneI_Handle_t* handle, ThyoneI_TXPower_t txPower);
+extern bool ThyoneI_Handle_SetRpNumSlots(ThyoneI_Handle_t* handle, uint8_t numSlots);
+extern bool ThyoneI_Handle_SetSourceAddress(ThyoneI_Handle_t* handle, uint32_t sourceAddress);
+extern bool ThyoneI_Handle_SetDestinationAddress(ThyoneI_Handle_t* handle, uint32_t destinationAddress);
+extern bool ThyoneI_Handle_SetGroupID(ThyoneI_Handle_t* handle, uint8_t groupId);
+extern bool ThyoneI_Handle_SetEncryptionKey(ThyoneI_Handle_t* handle, uint8_t* keyP);
+extern bool ThyoneI_Handle_SetTimeToLive(ThyoneI_Handle_t* handle, uint8_t ttl);
+extern bool ThyoneI_Handle_SetCCAMode(ThyoneI_Handle_t* handle, uint8_t ccaMode);
+extern bool ThyoneI_Handle_SetCCAThreshold(ThyoneI_Handle_t* handle, uint8_t ccaThreshold);
+extern bool ThyoneI_Handle_SetGPIOBlockRemoteConfig(ThyoneI_Handle_t* handle, uint8_t remoteConfig);
+extern bool ThyoneI_Handle_SetModuleMode(ThyoneI_Handle_t* handle, ThyoneI_ModuleMode_t moduleMode);
+extern bool ThyoneI_Handle_Get(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, uint8_t* ResponseP, uint16_t* Response_LengthP);
+extern bool ThyoneI_Handle_GetAsync(ThyoneI_Handle_t* handle, ThyoneI_UserSettings_t userSetting, ThyoneI_AsyncCallback_t cb);
+extern bool ThyoneI_Handle_GetSerialNumber(ThyoneI_Handle_t* handle, uint8_t* serialNumberP);
+extern bool ThyoneI_Handle_GetFWVersion(ThyoneI_Handle_t* handle, uint8_t* versionP);
+extern bool ThyoneI_Handle_GetBaudrateIndex(ThyoneI_Handle_t* handle, ThyoneI_BaudRateIndex_t* baudrateP, ThyoneI_UartParity_t* parityP, bool* flowcontrolEnableP);
+extern bool ThyoneI_Handle_GetEncryptionMode(ThyoneI_Handle_t* handle, ThyoneI_EncryptionMode_t* encryptionModeP);
+extern bool ThyoneI_Handle_GetRfProfile(ThyoneI_Handle_t* handle, ThyoneI_Profile_t* profileP);
+extern bool ThyoneI_Handle_GetRFChannel(ThyoneI_Handle_t* handle, uint8_t* channelP);
+extern bool ThyoneI_Handle_GetNumRetries(ThyoneI_Handle_t* handle, uint8_t* numRetriesP);
+extern bool ThyoneI_Handle_GetTXPower(ThyoneI_Handle_t* handle, ThyoneI_TXPower_t* txpowerP);
+extern bool ThyoneI_Handle_GetRpNumSlots(ThyoneI_Handle_t* handle, uint8_t* numSlotsP);
+extern bool ThyoneI_Handle_GetSourceAddress(ThyoneI_Handle_t* handle, uint32_t* sourceAddressP);
+extern bool ThyoneI_Handle_GetDestinationAddress(ThyoneI_Handle_t* handle, uint32_t* destinationAddressP);
+extern bool ThyoneI_Handle_GetGroupID(ThyoneI_Handle_t* handle, uint8_t* groupIdP);
+extern bool ThyoneI_Handle_GetTimeToLive(ThyoneI_Handle_t* handle, uint8_t* ttlP);
+extern bool ThyoneI_Handle_GetCCAMode(ThyoneI_Handle_t* handle, uint8_t* ccaModeP);
+extern bool ThyoneI_Handle_GetCCAThreshold(ThyoneI_Handle_t* handle, uint8_t* ccaThresholdP);
+extern bool ThyoneI_Handle_GetGPIOBlockRemoteConfig(ThyoneI_Handle_t* handle, uint8_t* remoteConfigP);
+extern bool ThyoneI_Handle_GetModuleMode(ThyoneI_Handle_t* handle, ThyoneI_ModuleMode_t* moduleModeP);
+extern bool ThyoneI_Handle_GetState(ThyoneI_Handle_t* handle, ThyoneI_States_t* state);
+extern uint32_t ThyoneI_Handle_GetConfirmationOverflowCount(ThyoneI_Handle_t* handle);
+#if defined(WE_STATS_ENABLED)
+extern bool ThyoneI_Handle_GetStatistics(ThyoneI_Handle_t* handle, WE_Stats_t* statsP);
+extern void ThyoneI_Handle_ResetStatistics(ThyoneI_Handle_t* handle);
+#endif
+/** @} */
+
 #endif // THYONEI_H_INCLUDED
 
 #ifdef __cplusplus
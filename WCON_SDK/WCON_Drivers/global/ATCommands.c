@@ -29,6 +29,7 @@
  */
 
 #include <global/ATCommands.h>
+#include <global/global.h>
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -37,48 +38,87 @@
 
 char AT_commandBuffer[AT_MAX_COMMAND_BUFFER_SIZE];
 
+/**
+ * @brief Chunk of received data queued for an AT command driver's receive task.
+ */
+typedef struct ATCommand_RxChunk_t
+{
+    uint8_t length;
+    uint8_t data[ATCOMMAND_RX_CHUNK_SIZE];
+} ATCommand_RxChunk_t;
+
 static const char* ATCommand_BooleanValueStrings[ATCommand_BooleanValue_NumberOfValues] = {"false", "true"};
 
+static const char ATCommand_HexDigits[] = "0123456789abcdef";
+static const char ATCommand_HexDigitsUpperCase[] = "0123456789ABCDEF";
+
 /**
- * @brief Converts an integer to string.
+ * @brief Formats an integer without using the printf family of functions.
  *
- * @param[out] outString Number converted to string
+ * @param[out] outString Number converted to string (at least 12 characters incl. termination)
  * @param[in] number Integer value to convert to string
  * @param[in] intFlags Formatting flags
  *
- * @return true if successful, false otherwise
+ * @return Length of the resulting string, 0 if the formatting flags are invalid
  */
-bool ATCommand_IntToString(char* outString, uint32_t number, uint16_t intFlags)
+static uint8_t ATCommand_FormatInt(char* outString, uint32_t number, uint16_t intFlags)
 {
     if ((0 == (intFlags & ATCOMMAND_INTFLAGS_SIGN)) || (0 == (intFlags & ATCOMMAND_INTFLAGS_NOTATION)))
     {
-        return false;
+        return 0;
     }
 
+    /* Digits are generated least significant first */
+    char digits[10];
+    uint8_t digitCount = 0;
+    uint8_t length = 0;
+
     if (ATCOMMAND_INTFLAGS_NOTATION_HEX == (intFlags & ATCOMMAND_INTFLAGS_NOTATION))
     {
         /* HEX */
-        sprintf(outString, "0x%" PRIx32, number);
+        outString[length++] = '0';
+        outString[length++] = 'x';
+        do
+        {
+            digits[digitCount++] = ATCommand_HexDigits[number & 0x0F];
+            number >>= 4;
+        } while (number != 0);
     }
     else
     {
         /* DEC */
-
-        if (ATCOMMAND_INTFLAGS_UNSIGNED == (intFlags & ATCOMMAND_INTFLAGS_SIGN))
+        if ((ATCOMMAND_INTFLAGS_SIGNED == (intFlags & ATCOMMAND_INTFLAGS_SIGN)) && ((int32_t)number < 0))
         {
-            /* UNSIGNED */
-            sprintf(outString, "%" PRIu32, number);
+            outString[length++] = '-';
+            number = 0 - number;
         }
-        else
+        do
         {
-            /* SIGNED */
-            sprintf(outString, "%" PRId32, (int32_t)number);
-        }
+            digits[digitCount++] = (char)('0' + (number % 10));
+            number /= 10;
+        } while (number != 0);
     }
 
-    return true;
+    while (digitCount > 0)
+    {
+        outString[length++] = digits[--digitCount];
+    }
+    outString[length] = ATCOMMAND_STRING_TERMINATE;
+
+    return length;
 }
 
+/**
+ * @brief Converts an integer to string.
+ *
+ * @param[out] outString Number converted to string
+ * @param[in] number Integer value to convert to string
+ * @param[in] intFlags Formatting flags
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_IntToString(char* outString, uint32_t number, uint16_t intFlags) { return ATCommand_FormatInt(outString, number, intFlags) != 0; }
+
 /**
  * @brief Parses string to integer
  *
@@ -161,616 +201,1450 @@ bool ATCommand_StringToInt(void* number, const char* inString, uint16_t intFlags
 }
 
 /**
- * @brief Appends a byte array argument to the end of an AT command.
+ * @brief Initializes a cursor at the start of a null-terminated AT command line.
  *
- * @param[out] pOutString  AT command after appending argument
- * @param[in] pInArgument Pointer to byte array to be added
- * @param[in] numBytes    Number of bytes to add
- * @param[in] delimiter   Delimiter to append after argument
+ * @param[out] pCursor Cursor to initialize
+ * @param[in] line Line to read the arguments from
+ */
+void ATCommand_Cursor_Init(ATCommand_Cursor_t* pCursor, char* line) { ATCommand_Cursor_InitLength(pCursor, line, (NULL == line) ? 0 : strlen(line)); }
+
+/**
+ * @brief Initializes a cursor over a part of an AT command line of known length.
  *
- * @return true if successful, false otherwise
+ * Can be used to split a single argument (e.g. a time stamp "hh:mm:ss") into its components.
+ *
+ * @param[out] pCursor Cursor to initialize
+ * @param[in] data Start of the part to read the arguments from
+ * @param[in] length Length of the part
  */
-bool ATCommand_AppendArgumentBytes(char* pOutString, const char* pInArgument, uint16_t numBytes, char delimiter)
+void ATCommand_Cursor_InitLength(ATCommand_Cursor_t* pCursor, char* data, size_t length)
 {
-    if (NULL == pOutString)
-    {
-        return false;
-    }
-
-    size_t strLength = strlen(pOutString);
-    if (NULL != pInArgument)
-    {
-        memcpy(&pOutString[strLength], pInArgument, numBytes);
-        strLength += numBytes;
-    }
-
-    pOutString[strLength] = delimiter;
+    pCursor->pos = data;
+    pCursor->remaining = (NULL == data) ? 0 : length;
+}
 
-    return true;
+/**
+ * @brief Initializes a cursor for the char** based argument getters.
+ *
+ * The length of the remaining input is not known, scanning stops at the termination character.
+ *
+ * @param[out] pCursor Cursor to initialize
+ * @param[in] line Null-terminated line to read the arguments from
+ */
+static void ATCommand_Cursor_InitUnbounded(ATCommand_Cursor_t* pCursor, char* line)
+{
+    pCursor->pos = line;
+    pCursor->remaining = SIZE_MAX;
 }
 
 /**
- * @brief Appends a string argument to the end of an AT command.
+ * @brief Finds the next argument without moving the cursor.
  *
- * The supplied delimiter is appended after the argument. A null byte ('\0')
- * is appended after the delimiter, if the delimiter itself is not a null byte.
+ * Delimiters enclosed in quotation marks are ignored. If the delimiter is the termination
+ * character, the argument extends to the end of the input.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInArgument Argument to be added
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in] pCursor Cursor to read from
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[out] pToken Argument found
+ * @param[out] pConsumed Number of characters to skip to move behind the argument and its delimiter
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentString(char* pOutString, const char* pInArgument, char delimiter)
+static bool ATCommand_Cursor_Peek(const ATCommand_Cursor_t* pCursor, char delimiter, ATCommand_Token_t* pToken, size_t* pConsumed)
 {
-    if (NULL == pOutString)
-    {
-        return false;
-    }
+    char* pos = pCursor->pos;
+    bool quoted = false;
+    size_t length = 0;
 
-    size_t outStrLength = strlen(pOutString);
-    if (NULL != pInArgument)
+    for (; (length < pCursor->remaining) && (pos[length] != ATCOMMAND_STRING_TERMINATE); length++)
     {
-        size_t inStrLength = strlen(pInArgument);
-        strcpy(&pOutString[outStrLength], pInArgument);
-        outStrLength += inStrLength;
+        if ((pos[length] == delimiter) && !quoted)
+        {
+            pToken->data = pos;
+            pToken->length = length;
+            *pConsumed = length + 1;
+            return true;
+        }
+        if (pos[length] == '"')
+        {
+            quoted = !quoted;
+        }
     }
-    pOutString[outStrLength] = delimiter;
-    if (delimiter != '\0')
+
+    if ((delimiter != ATCOMMAND_STRING_TERMINATE) || quoted)
     {
-        pOutString[outStrLength + 1] = '\0';
+        return false;
     }
 
+    pToken->data = pos;
+    pToken->length = length;
+
+    /* Skip the termination character as well, unless the input is exhausted */
+    *pConsumed = ((length < pCursor->remaining) && (length > 0)) ? (length + 1) : length;
     return true;
 }
 
 /**
- * @brief Appends a string argument to the end of an AT command, which is embedded into quotation marks
+ * @brief Moves the cursor forward.
  *
- * The supplied delimiter is appended after the argument. A null byte ('\0')
- * is appended after the delimiter, if the delimiter itself is not a null byte.
- * The string will be embedded into quotation marks
+ * @param[in,out] pCursor Cursor to move
+ * @param[in] count Number of characters to skip
+ */
+static void ATCommand_Cursor_Advance(ATCommand_Cursor_t* pCursor, size_t count)
+{
+    pCursor->pos += count;
+    pCursor->remaining -= count;
+}
+
+/**
+ * @brief Gets the next argument as a view into the line and moves the cursor behind its delimiter.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInArgument Argument to be added
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[out] pToken Argument
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentStringQuotationMarks(char* pOutString, const char* pInArgument, char delimiter)
+bool ATCommand_Cursor_NextToken(ATCommand_Cursor_t* pCursor, char delimiter, ATCommand_Token_t* pToken)
 {
-    if (NULL == pOutString)
+    if ((NULL == pCursor) || (NULL == pToken))
     {
         return false;
     }
 
-    size_t outStrLength = strlen(pOutString);
-    if (NULL != pInArgument)
-    {
-        pOutString[outStrLength++] = '\"';
-        size_t inStrLength = strlen(pInArgument);
-        strcpy(&pOutString[outStrLength], pInArgument);
-        outStrLength += inStrLength;
-        pOutString[outStrLength++] = '\"';
-    }
-    pOutString[outStrLength] = delimiter;
-    if (delimiter != '\0')
+    size_t consumed;
+    if (!ATCommand_Cursor_Peek(pCursor, delimiter, pToken, &consumed))
     {
-        pOutString[outStrLength + 1] = '\0';
+        return false;
     }
 
+    ATCommand_Cursor_Advance(pCursor, consumed);
     return true;
 }
 
 /**
- * @brief Appends bitmask strings to the supplied string.
+ * @brief Gets the next length bytes as a view into the line, regardless of their content.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
- * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
- * @param[in] bitmask Input bitmask
- * @param[in] delimiter Delimiter to append after argument
- * @param[in] maxStringLength Max. length of output string
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[in] length Number of bytes to get
+ * @param[out] pToken Bytes
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentBitmask(char* pOutString, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+bool ATCommand_Cursor_NextBytes(ATCommand_Cursor_t* pCursor, size_t length, ATCommand_Token_t* pToken)
 {
-    size_t outStrLength = strlen(pOutString) + 1;
-    bool empty = true;
-    for (uint8_t i = 0; i < numStrings; i++)
+    if ((NULL == pCursor) || (NULL == pToken) || (length > pCursor->remaining))
     {
-        if (0 != (bitmask & (1 << i)))
-        {
-            outStrLength += strlen(stringList[i]) + 1;
-            if (outStrLength > maxStringLength)
-            {
-                return false;
-            }
-            if (!ATCommand_AppendArgumentString(pOutString, stringList[i], ATCOMMAND_BITMASK_DELIM))
-            {
-                return false;
-            }
-            empty = false;
-        }
+        return false;
     }
-    pOutString[outStrLength - (empty ? 1 : 2)] = delimiter;
-    pOutString[outStrLength - (empty ? 0 : 1)] = '\0';
+
+    pToken->data = pCursor->pos;
+    pToken->length = length;
+    ATCommand_Cursor_Advance(pCursor, length);
     return true;
 }
 
 /**
- * @brief Appends a boolean string (true, false) to the supplied string.
+ * @brief Copies an argument to a null-terminated string.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] inBool Value to append
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in] pToken Argument to copy
+ * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string (including termination character)
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char delimiter) { return ATCommand_AppendArgumentString(pOutString, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter); }
+static bool ATCommand_Token_Copy(const ATCommand_Token_t* pToken, char* pOutArgument, size_t maxLength)
+{
+    if ((NULL == pOutArgument) || (pToken->length >= maxLength))
+    {
+        return false;
+    }
+
+    memcpy(pOutArgument, pToken->data, pToken->length);
+    pOutArgument[pToken->length] = ATCOMMAND_STRING_TERMINATE;
+    return true;
+}
 
 /**
- * @brief Gets the next string argument from the supplied AT command.
+ * @brief Gets the next string argument and copies it to the output buffer.
  *
- * @param[in,out] pInArguments AT command to get argument from
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
  * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string to get (including termination character)
  * @param[in] delimiter Delimiter which occurs after argument to get
- * @param[in] maxLength Max. length of string to get (including termination character).
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentString(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength)
+bool ATCommand_Cursor_NextString(ATCommand_Cursor_t* pCursor, char* pOutArgument, size_t maxLength, char delimiter)
 {
-    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxLength == 0))
+    ATCommand_Token_t token;
+    size_t consumed;
+
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_Copy(&token, pOutArgument, maxLength))
     {
         return false;
     }
 
-    size_t argumentLength = 0;
-    size_t inputStringLength = strlen(*pInArguments);
-    size_t quotationCharCount = 0;
-
-    while (true)
-    {
-        if (argumentLength > (size_t)(maxLength - 1))
-        {
-            return false;
-        }
-        else if (((*pInArguments)[argumentLength] == delimiter) && (quotationCharCount % 2 == 0))
-        {
-            /* If argument list is not empty, copy string to output arguments */
-            memcpy(pOutArgument, *pInArguments, argumentLength);
-
-            pOutArgument[argumentLength] = '\0';
-
-            if (argumentLength > 0 || **pInArguments != '\0')
-            {
-                *pInArguments = &((*pInArguments)[argumentLength + 1]);
-            }
-
-            return true;
-        }
-        else if (((*pInArguments)[argumentLength] == '"'))
-        {
-            quotationCharCount++;
-        }
-        else if (argumentLength > inputStringLength)
-        {
-            return false;
-        }
-        argumentLength++;
-    }
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
 }
 
 /**
- * @brief Gets the next string argument from the supplied AT command and removes the quotation marks
+ * @brief Gets the next string argument, removes the quotation marks and copies it to the output buffer.
  *
- * @param[in,out] pInArguments AT command to get argument from
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
  * @param[out] pOutArgument Argument as string
+ * @param[in] maxLength Max. length of string to get (including termination character)
  * @param[in] delimiter Delimiter which occurs after argument to get
- * @param[in] maxLength Max. length of string to get (including termination character).
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength)
+bool ATCommand_Cursor_NextStringWithoutQuotationMarks(ATCommand_Cursor_t* pCursor, char* pOutArgument, size_t maxLength, char delimiter)
 {
-    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxLength == 0))
+    ATCommand_Token_t token;
+    size_t consumed;
+
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_StripQuotationMarks(&token) || !ATCommand_Token_Copy(&token, pOutArgument, maxLength))
     {
         return false;
     }
 
-    size_t argumentLength = 0;
-    size_t inputStringLength = strlen(*pInArguments);
-    size_t quotationCharCount = 0;
-
-    while (true)
-    {
-        if (argumentLength > (size_t)(maxLength + 1))
-        {
-            return false;
-        }
-        else if (((*pInArguments)[argumentLength] == delimiter) && (quotationCharCount % 2 == 0))
-        {
-            if (((*pInArguments)[0] == '"') && ((*pInArguments)[argumentLength - 1] == '"') && (argumentLength >= 2))
-            {
-                memcpy(pOutArgument, *pInArguments + 1, argumentLength - 2);
-                pOutArgument[argumentLength - 2] = '\0';
-
-                if (argumentLength > 0 || **pInArguments != '\0')
-                {
-                    *pInArguments = &((*pInArguments)[argumentLength + 1]);
-                }
-
-                return true;
-            }
-            else
-            {
-                return false;
-            }
-        }
-        else if (((*pInArguments)[argumentLength] == '"'))
-        {
-            quotationCharCount++;
-        }
-        else if (argumentLength > inputStringLength)
-        {
-            return false;
-        }
-        argumentLength++;
-    }
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
 }
 
 /**
- * @brief Appends an integer argument to the end of an AT command
+ * @brief Gets the next integer argument, parsed in place.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInValue Argument to be added
- * @param[in] intFlags Integer formatting flags
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentInt(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+bool ATCommand_Cursor_NextInt(ATCommand_Cursor_t* pCursor, void* pOutArgument, uint16_t intFlags, char delimiter)
 {
-    if (NULL == pOutString)
-    {
-        return false;
-    }
+    ATCommand_Token_t token;
+    size_t consumed;
 
-    char tempString[12];
-
-    if (ATCommand_IntToString(tempString, pInValue, intFlags))
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_ToInt(&token, pOutArgument, intFlags))
     {
-        return ATCommand_AppendArgumentString(pOutString, tempString, delimiter);
+        return false;
     }
 
-    return false;
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
 }
 
 /**
- * @brief Appends an integer argument to the end of an AT command, which is embedded into quotation marks
+ * @brief Gets the next integer argument enclosed in quotation marks, parsed in place.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInValue Argument to be added
- * @param[in] intFlags Integer formatting flags
- * @param[in] delimiter Delimiter to append after argument
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_AppendArgumentIntQuotationMarks(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+bool ATCommand_Cursor_NextIntWithoutQuotationMarks(ATCommand_Cursor_t* pCursor, void* pOutArgument, uint16_t intFlags, char delimiter)
 {
-    if (NULL == pOutString)
+    ATCommand_Token_t token;
+    size_t consumed;
+
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_StripQuotationMarks(&token) || !ATCommand_Token_ToInt(&token, pOutArgument, intFlags))
     {
         return false;
     }
 
-    char tempString[12];
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
+}
 
-    if (ATCommand_IntToString(tempString, pInValue, intFlags))
-    {
-        return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
+/**
+ * @brief Gets the next double argument, parsed in place.
+ *
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Argument parsed as double
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_Cursor_NextDouble(ATCommand_Cursor_t* pCursor, double* pOutArgument, char delimiter)
+{
+    ATCommand_Token_t token;
+    size_t consumed;
+
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_ToDouble(&token, pOutArgument))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
+}
+
+/**
+ * @brief Gets the next float argument, parsed in place.
+ *
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Argument parsed as float
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_Cursor_NextFloat(ATCommand_Cursor_t* pCursor, float* pOutArgument, char delimiter)
+{
+    ATCommand_Token_t token;
+    size_t consumed;
+
+    if ((NULL == pCursor) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_ToFloat(&token, pOutArgument))
+    {
+        return false;
     }
 
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
+}
+
+/**
+ * @brief Looks up an argument in a list of strings (case insensitive).
+ *
+ * @param[in] pToken Argument to look up
+ * @param[out] pOutArgument Index of the matching string
+ * @param[in] stringList List of strings
+ * @param[in] numStrings Number of elements in stringList
+ *
+ * @return true if a matching string was found, false otherwise
+ */
+static bool ATCommand_Token_FindString(const ATCommand_Token_t* pToken, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings)
+{
+    for (uint8_t i = 0; i < numStrings; i++)
+    {
+        if (ATCommand_Token_Equals(pToken, stringList[i]))
+        {
+            *pOutArgument = i;
+            return true;
+        }
+    }
     return false;
 }
 
 /**
- * @brief Gets the next enumeration argument from the supplied AT command.
+ * @brief Gets the next enumeration argument without copying it.
  *
- * @param[in,out] pInArguments AT command to get argument from
- * @param[out] pOutArgument Enumeration value corresponding to the string read from the input AT command
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Enumeration value corresponding to the argument
  * @param[in] stringList List of strings containing the string representations of the enumeration's values
  * @param[in] numStrings Number of elements in stringList (number of elements in the enumeration)
- * @param[in] maxStringLength Max. length of individual enumeration value strings
  * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
+bool ATCommand_Cursor_NextEnum(ATCommand_Cursor_t* pCursor, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, char delimiter)
 {
-    char tempString[maxStringLength];
+    ATCommand_Token_t token;
+    size_t consumed;
 
-    if (!ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))
+    if ((NULL == pCursor) || (NULL == pOutArgument) || !ATCommand_Cursor_Peek(pCursor, delimiter, &token, &consumed) || !ATCommand_Token_FindString(&token, pOutArgument, stringList, numStrings))
     {
         return false;
     }
 
-    bool ok;
-    *pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
-    return ok;
+    ATCommand_Cursor_Advance(pCursor, consumed);
+    return true;
 }
 
 /**
- * @brief Gets the next string argument from the supplied AT command.
+ * @brief Gets the next boolean argument (true, false).
  *
- * @param[in,out]  pInArguments AT command to get argument from
- * @param[in] length Length of the argument to copy
- * @param[out] pOutArgument Argument as byte array
- * @param[in] maxLength Max. length of byte array
+ * @param[in,out] pCursor Cursor to read from, not moved on failure
+ * @param[out] pOutArgument Output boolean
+ * @param[in] delimiter Delimiter which occurs after argument to get
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentByteArray(char** pInArguments, uint16_t length, uint8_t* pOutArgument, uint16_t maxLength)
+bool ATCommand_Cursor_NextBoolean(ATCommand_Cursor_t* pCursor, bool* pOutArgument, char delimiter)
 {
-    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    uint8_t enumValue;
+    if (!ATCommand_Cursor_NextEnum(pCursor, &enumValue, ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, delimiter))
     {
         return false;
     }
-    if (length > maxLength)
+    *pOutArgument = (enumValue == 1) ? true : false;
+    return true;
+}
+
+/**
+ * @brief Removes the enclosing quotation marks from an argument.
+ *
+ * @param[in,out] pToken Argument, unchanged if it isn't enclosed in quotation marks
+ *
+ * @return true if the argument was enclosed in quotation marks, false otherwise
+ */
+bool ATCommand_Token_StripQuotationMarks(ATCommand_Token_t* pToken)
+{
+    if ((NULL == pToken) || (pToken->length < 2) || (pToken->data[0] != '"') || (pToken->data[pToken->length - 1] != '"'))
     {
-        /* target array to small */
         return false;
     }
 
-    memcpy(pOutArgument, *pInArguments, length);
-    *pInArguments += length;
+    pToken->data++;
+    pToken->length -= 2;
     return true;
 }
 
 /**
- * @brief Gets the next bitmask argument from the supplied AT command.
+ * @brief Compares an argument to a string (case insensitive).
  *
- * @param[in,out] pInArguments AT command to get argument from
- * @param[in] stringList List of strings containing the string representations of the bits in the output bitmask
- * @param[in] numStrings Number of elements in stringList (max. number of bits in output bitmask)
- * @param[in] maxStringLength Max. length of individual bitmask strings
- * @param[out] bitmask Output bitmask
- * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[in] pToken Argument
+ * @param[in] str Null-terminated string to compare to
+ *
+ * @return true if equal, false otherwise
+ */
+bool ATCommand_Token_Equals(const ATCommand_Token_t* pToken, const char* str)
+{
+    /* strncasecmp stops at the end of str, so a shorter str never reads past its termination character */
+    return (NULL != pToken) && (NULL != str) && (0 == strncasecmp(str, pToken->data, pToken->length)) && (str[pToken->length] == ATCOMMAND_STRING_TERMINATE);
+}
+
+/**
+ * @brief Parses an argument to integer in place.
+ *
+ * Accepts the same input as ATCommand_StringToInt(): optional leading spaces and sign,
+ * hexadecimal notation if requested by the flags or indicated by a "0x" prefix.
+ *
+ * @param[in] pToken Argument to parse
+ * @param[out] pOutInt Parsed integer value
+ * @param[in] intFlags Flags to determine how to parse
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, uint32_t* bitmask, char delimiter)
+bool ATCommand_Token_ToInt(const ATCommand_Token_t* pToken, void* pOutInt, uint16_t intFlags)
 {
-    bool ret = false;
-    char tempString[maxStringLength];
+    if ((NULL == pToken) || (NULL == pOutInt))
+    {
+        return false;
+    }
 
-    *bitmask = 0;
+    const char* pos = pToken->data;
+    const char* end = pToken->data + pToken->length;
 
-    while (**pInArguments != '\0' && ((ret = ATCommand_GetNextArgumentString(pInArguments, tempString, ATCOMMAND_BITMASK_DELIM, sizeof(tempString))) || (ret = ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))))
+    while ((pos < end) && (*pos == ' '))
     {
-        bool ok;
-        uint8_t flag = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
-        if (ok)
+        pos++;
+    }
+
+    bool negative = false;
+    if ((pos < end) && ((*pos == '-') || (*pos == '+')))
+    {
+        negative = (*pos == '-');
+        pos++;
+    }
+
+    bool hex = (intFlags & ATCOMMAND_INTFLAGS_NOTATION_HEX) != 0;
+    if (((end - pos) > 2) && (pos[0] == '0') && ((pos[1] == 'x') || (pos[1] == 'X')))
+    {
+        hex = true;
+        pos += 2;
+    }
+
+    if (pos == end)
+    {
+        return false;
+    }
+
+    uint64_t value = 0;
+    for (; pos < end; pos++)
+    {
+        uint8_t digit;
+        if ((*pos >= '0') && (*pos <= '9'))
         {
-            *bitmask |= (1 << flag);
+            digit = *pos - '0';
+        }
+        else if (hex && (*pos >= 'a') && (*pos <= 'f'))
+        {
+            digit = *pos - 'a' + 10;
+        }
+        else if (hex && (*pos >= 'A') && (*pos <= 'F'))
+        {
+            digit = *pos - 'A' + 10;
+        }
+        else
+        {
+            return false;
+        }
+        value = value * (hex ? 16 : 10) + digit;
+    }
+
+    if (negative)
+    {
+        value = (uint64_t)0 - value;
+    }
+
+    /* Two's complement: the truncated bit pattern is the same for signed and unsigned types */
+    if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8) != 0)
+    {
+        *((uint8_t*)pOutInt) = (uint8_t)value;
+    }
+    else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE16) != 0)
+    {
+        *((uint16_t*)pOutInt) = (uint16_t)value;
+    }
+    else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE32) != 0)
+    {
+        *((uint32_t*)pOutInt) = (uint32_t)value;
+    }
+    else if ((intFlags & ATCOMMAND_INTFLAGS_SIZE64) != 0)
+    {
+        *((uint64_t*)pOutInt) = value;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Parses an argument to double in place.
+ *
+ * @param[in] pToken Argument to parse
+ * @param[out] pOutDouble Parsed double value
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_Token_ToDouble(const ATCommand_Token_t* pToken, double* pOutDouble)
+{
+    if ((NULL == pToken) || (NULL == pOutDouble) || (pToken->length == 0))
+    {
+        return false;
+    }
+
+    char* endptr;
+    double doubleNr = strtod(pToken->data, &endptr);
+
+    if (endptr > pToken->data + pToken->length)
+    {
+        /* The characters following the argument continue the number (e.g. a '.' delimiter), parse a bounded copy */
+        char tempString[40];
+        if (pToken->length >= sizeof(tempString))
+        {
+            return false;
         }
+        memcpy(tempString, pToken->data, pToken->length);
+        tempString[pToken->length] = ATCOMMAND_STRING_TERMINATE;
+        return ATCommand_StringToDouble(pOutDouble, tempString);
+    }
+
+    if (endptr != pToken->data + pToken->length)
+    {
+        /* endptr did not move to end, thus conversion failed */
+        return false;
     }
+
+    *pOutDouble = doubleNr;
     return true;
 }
 
 /**
- * @brief Gets the next boolean argument (true, false) from the supplied AT command.
+ * @brief Parses an argument to float in place.
  *
- * @param[in,out] pInArguments AT command to get argument from
- * @param[out] outBool Output boolean
- * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[in] pToken Argument to parse
+ * @param[out] pOutFloat Parsed float value
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentBoolean(char** pInArguments, bool* outBool, char delimiter)
+bool ATCommand_Token_ToFloat(const ATCommand_Token_t* pToken, float* pOutFloat)
 {
-    uint8_t enumValue;
-    bool ok = ATCommand_GetNextArgumentEnum(pInArguments, &enumValue, ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, 6, delimiter);
-    if (ok)
+    if ((NULL == pToken) || (NULL == pOutFloat) || (pToken->length == 0))
     {
-        *outBool = (enumValue == 1) ? true : false;
+        return false;
     }
-    return ok;
+
+    char* endptr;
+    float floatNr = strtof(pToken->data, &endptr);
+
+    if (endptr > pToken->data + pToken->length)
+    {
+        /* The characters following the argument continue the number (e.g. a '.' delimiter), parse a bounded copy */
+        char tempString[40];
+        if (pToken->length >= sizeof(tempString))
+        {
+            return false;
+        }
+        memcpy(tempString, pToken->data, pToken->length);
+        tempString[pToken->length] = ATCOMMAND_STRING_TERMINATE;
+        return ATCommand_StringToFloat(pOutFloat, tempString);
+    }
+
+    if (endptr != pToken->data + pToken->length)
+    {
+        /* endptr did not move to end, thus conversion failed */
+        return false;
+    }
+
+    *pOutFloat = floatNr;
+    return true;
 }
 
 /**
- * @brief Gets the next integer argument from the supplied AT command.
+ * @brief Appends a byte array argument to the end of an AT command.
  *
- * @param[in,out] pInArguments AT command to get argument from
- * @param[out] pOutArgument Argument parsed as integer
- * @param[in] intFlags Flags to determine how to parse
- * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[out] pOutString  AT command after appending argument
+ * @param[in] pInArgument Pointer to byte array to be added
+ * @param[in] numBytes    Number of bytes to add
+ * @param[in] delimiter   Delimiter to append after argument
  *
  * @return true if successful, false otherwise
  */
-bool ATCommand_GetNextArgumentInt(char** pInArguments, void* pOutArgument, uint16_t intFlags, char delimiter)
+bool ATCommand_AppendArgumentBytes(char* pOutString, const char* pInArgument, uint16_t numBytes, char delimiter)
 {
-    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    if (NULL == pOutString)
     {
         return false;
     }
 
-    char tempString[40];
+    size_t strLength = strlen(pOutString);
+    if (NULL != pInArgument)
+    {
+        memcpy(&pOutString[strLength], pInArgument, numBytes);
+        strLength += numBytes;
+    }
 
-    char* tempstartlocation = *pInArguments;
+    pOutString[strLength] = delimiter;
 
-    ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
+    return true;
+}
 
-    if (!ATCommand_StringToInt(pOutArgument, tempString, intFlags))
+/**
+ * @brief Appends a string argument to the end of an AT command.
+ *
+ * The supplied delimiter is appended after the argument. A null byte ('\0')
+ * is appended after the delimiter, if the delimiter itself is not a null byte.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentString(char* pOutString, const char* pInArgument, char delimiter)
+{
+    if (NULL == pOutString)
     {
-        *pInArguments = tempstartlocation;
         return false;
     }
 
+    size_t outStrLength = strlen(pOutString);
+    if (NULL != pInArgument)
+    {
+        size_t inStrLength = strlen(pInArgument);
+        strcpy(&pOutString[outStrLength], pInArgument);
+        outStrLength += inStrLength;
+    }
+    pOutString[outStrLength] = delimiter;
+    if (delimiter != '\0')
+    {
+        pOutString[outStrLength + 1] = '\0';
+    }
+
     return true;
 }
 
 /**
- * @brief Gets the next integer argument from the supplied AT command and removes the quotation marks
+ * @brief Appends a string argument to the end of an AT command, which is embedded into quotation marks
  *
- * @param[in,out] pInArguments AT command to get argument from
- * @param[out] pOutArgument Argument parsed as integer
- * @param[in] intFlags Flags to determine how to parse
- * @param[in] delimiter Delimiter which occurs after argument to get
+ * The supplied delimiter is appended after the argument. A null byte ('\0')
+ * is appended after the delimiter, if the delimiter itself is not a null byte.
+ * The string will be embedded into quotation marks
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInArgument Argument to be added
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentStringQuotationMarks(char* pOutString, const char* pInArgument, char delimiter)
+{
+    if (NULL == pOutString)
+    {
+        return false;
+    }
+
+    size_t outStrLength = strlen(pOutString);
+    if (NULL != pInArgument)
+    {
+        pOutString[outStrLength++] = '\"';
+        size_t inStrLength = strlen(pInArgument);
+        strcpy(&pOutString[outStrLength], pInArgument);
+        outStrLength += inStrLength;
+        pOutString[outStrLength++] = '\"';
+    }
+    pOutString[outStrLength] = delimiter;
+    if (delimiter != '\0')
+    {
+        pOutString[outStrLength + 1] = '\0';
+    }
+
+    return true;
+}
+
+/**
+ * @brief Appends bitmask strings to the supplied string.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
+ * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
+ * @param[in] bitmask Input bitmask
+ * @param[in] delimiter Delimiter to append after argument
+ * @param[in] maxStringLength Max. length of output string
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBitmask(char* pOutString, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter, uint16_t maxStringLength)
+{
+    size_t outStrLength = strlen(pOutString) + 1;
+    bool empty = true;
+    for (uint8_t i = 0; i < numStrings; i++)
+    {
+        if (0 != (bitmask & (1 << i)))
+        {
+            outStrLength += strlen(stringList[i]) + 1;
+            if (outStrLength > maxStringLength)
+            {
+                return false;
+            }
+            if (!ATCommand_AppendArgumentString(pOutString, stringList[i], ATCOMMAND_BITMASK_DELIM))
+            {
+                return false;
+            }
+            empty = false;
+        }
+    }
+    pOutString[outStrLength - (empty ? 1 : 2)] = delimiter;
+    pOutString[outStrLength - (empty ? 0 : 1)] = '\0';
+    return true;
+}
+
+/**
+ * @brief Appends a boolean string (true, false) to the supplied string.
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] inBool Value to append
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char delimiter) { return ATCommand_AppendArgumentString(pOutString, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter); }
+
+/**
+ * @brief Gets the next string argument from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument as string
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentString(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxLength == 0))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
+
+    if (!ATCommand_Cursor_NextString(&cursor, pOutArgument, maxLength, delimiter))
+    {
+        return false;
+    }
+
+    *pInArguments = cursor.pos;
+    return true;
+}
+
+/**
+ * @brief Gets the next string argument from the supplied AT command and removes the quotation marks
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument as string
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ * @param[in] maxLength Max. length of string to get (including termination character).
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxLength == 0))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
+
+    if (!ATCommand_Cursor_NextStringWithoutQuotationMarks(&cursor, pOutArgument, maxLength, delimiter))
+    {
+        return false;
+    }
+
+    *pInArguments = cursor.pos;
+    return true;
+}
+
+/**
+ * @brief Appends an integer argument to the end of an AT command
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentInt(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+    if (NULL == pOutString)
+    {
+        return false;
+    }
+
+    char tempString[12];
+
+    if (ATCommand_IntToString(tempString, pInValue, intFlags))
+    {
+        return ATCommand_AppendArgumentString(pOutString, tempString, delimiter);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Appends an integer argument to the end of an AT command, which is embedded into quotation marks
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentIntQuotationMarks(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+    if (NULL == pOutString)
+    {
+        return false;
+    }
+
+    char tempString[12];
+
+    if (ATCommand_IntToString(tempString, pInValue, intFlags))
+    {
+        return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Gets the next enumeration argument from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Enumeration value corresponding to the string read from the input AT command
+ * @param[in] stringList List of strings containing the string representations of the enumeration's values
+ * @param[in] numStrings Number of elements in stringList (number of elements in the enumeration)
+ * @param[in] maxStringLength Max. length of individual enumeration value strings
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentEnum(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxStringLength == 0))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
+
+    ATCommand_Token_t token;
+    size_t consumed;
+    if (!ATCommand_Cursor_Peek(&cursor, delimiter, &token, &consumed) || (token.length >= maxStringLength))
+    {
+        return false;
+    }
+
+    /* The argument is consumed even if it doesn't match any of the strings */
+    *pInArguments += consumed;
+
+    if (!ATCommand_Token_FindString(&token, pOutArgument, stringList, numStrings))
+    {
+        *pOutArgument = 0;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Gets the next string argument from the supplied AT command.
+ *
+ * @param[in,out]  pInArguments AT command to get argument from
+ * @param[in] length Length of the argument to copy
+ * @param[out] pOutArgument Argument as byte array
+ * @param[in] maxLength Max. length of byte array
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentByteArray(char** pInArguments, uint16_t length, uint8_t* pOutArgument, uint16_t maxLength)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    {
+        return false;
+    }
+    if (length > maxLength)
+    {
+        /* target array to small */
+        return false;
+    }
+
+    memcpy(pOutArgument, *pInArguments, length);
+    *pInArguments += length;
+    return true;
+}
+
+/**
+ * @brief Gets the next bitmask argument from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[in] stringList List of strings containing the string representations of the bits in the output bitmask
+ * @param[in] numStrings Number of elements in stringList (max. number of bits in output bitmask)
+ * @param[in] maxStringLength Max. length of individual bitmask strings
+ * @param[out] bitmask Output bitmask
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentBitmask(char** pInArguments, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, uint32_t* bitmask, char delimiter)
+{
+    bool ret = false;
+    char tempString[maxStringLength];
+
+    *bitmask = 0;
+
+    while (**pInArguments != '\0' && ((ret = ATCommand_GetNextArgumentString(pInArguments, tempString, ATCOMMAND_BITMASK_DELIM, sizeof(tempString))) || (ret = ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString)))))
+    {
+        bool ok;
+        uint8_t flag = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
+        if (ok)
+        {
+            *bitmask |= (1 << flag);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Gets the next boolean argument (true, false) from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] outBool Output boolean
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentBoolean(char** pInArguments, bool* outBool, char delimiter)
+{
+    uint8_t enumValue;
+    bool ok = ATCommand_GetNextArgumentEnum(pInArguments, &enumValue, ATCommand_BooleanValueStrings, ATCommand_BooleanValue_NumberOfValues, 6, delimiter);
+    if (ok)
+    {
+        *outBool = (enumValue == 1) ? true : false;
+    }
+    return ok;
+}
+
+/**
+ * @brief Gets the next integer argument from the supplied AT command.
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentInt(char** pInArguments, void* pOutArgument, uint16_t intFlags, char delimiter)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
+
+    if (!ATCommand_Cursor_NextInt(&cursor, pOutArgument, intFlags, delimiter))
+    {
+        return false;
+    }
+
+    *pInArguments = cursor.pos;
+    return true;
+}
+
+/**
+ * @brief Gets the next integer argument from the supplied AT command and removes the quotation marks
+ *
+ * @param[in,out] pInArguments AT command to get argument from
+ * @param[out] pOutArgument Argument parsed as integer
+ * @param[in] intFlags Flags to determine how to parse
+ * @param[in] delimiter Delimiter which occurs after argument to get
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetNextArgumentIntWithoutQuotationMarks(char** pInArguments, void* pOutArgument, uint16_t intFlags, char delimiter)
+{
+    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
+
+    if (!ATCommand_Cursor_NextIntWithoutQuotationMarks(&cursor, pOutArgument, intFlags, delimiter))
+    {
+        return false;
+    }
+
+    *pInArguments = cursor.pos;
+    return true;
+}
+
+/**
+ * @brief Gets the command name from an AT command.
+ *
+ * @param[in,out] pInAtCmd AT command to get command name from
+ * @param[in] pCmdName Command name as string
+ * @param[in] CmdNameLen Length of the provided butter
+ * @param[in] delimiters Delimiters which occurs after command name
+ * @param[in] number_of_delimiters Number of delimiters
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_GetCmdName(char** pInAtCmd, char* pCmdName, size_t CmdNameLen, char* delimiters, uint8_t number_of_delimiters)
+{
+    if ((NULL == pInAtCmd) || (NULL == pCmdName))
+    {
+        return false;
+    }
+
+    size_t argumentLength = 0;
+
+    while (true)
+    {
+        if (argumentLength >= CmdNameLen)
+        {
+            return false;
+        }
+        for (uint8_t i = 0; i < number_of_delimiters; i++)
+        {
+            if ((*pInAtCmd)[argumentLength] == delimiters[i])
+            {
+                /* if argument list not empty*/
+                /* copy string to output arguments */
+                memcpy(pCmdName, *pInAtCmd, argumentLength);
+
+                pCmdName[argumentLength] = '\0';
+
+                if ((*pInAtCmd)[argumentLength] == ATCOMMAND_STRING_TERMINATE)
+                {
+                    /* string end, nothing follows */
+                    *pInAtCmd = &((*pInAtCmd)[argumentLength]);
+                }
+                else
+                {
+                    /* more arguments follow */
+                    *pInAtCmd = &((*pInAtCmd)[argumentLength + 1]);
+                }
+                return true;
+            }
+        }
+        if ((*pInAtCmd)[argumentLength] == '\0')
+        {
+            return false;
+        }
+        argumentLength++;
+    }
+}
+
+/**
+ * @brief Looks up a string in a list of strings (case insensitive) and returns the
+ * index of the string or the supplied default value, if the string is not found.
+ *
+ * @param[in] stringList List of strings to search in
+ * @param[in] numStrings Number of strings in stringList
+ * @param[in] str String to look for
+ * @param[in] defaultValue Value to return if the string is not found
+ * @param[out] ok Is set to true if the string is found. Optional.
+ *
+ * @return Index of the first occurrence of str in stringList or defaultValue, if string is not found
+ */
+uint8_t ATCommand_FindString(const char* stringList[], uint8_t numStrings, const char* str, uint8_t defaultValue, bool* ok)
+{
+    for (uint8_t i = 0; i < numStrings; i++)
+    {
+        if (0 == strcasecmp(stringList[i], str))
+        {
+            if (ok)
+            {
+                *ok = true;
+            }
+            return i;
+        }
+    }
+
+    if (ok)
+    {
+        *ok = false;
+    }
+    return defaultValue;
+}
+
+/**
+ * @brief Appends a bits argument to the end of an AT command, which is embedded into quotation marks
+ *
+ * The supplied delimiter is appended after the argument. A null byte ('\0')
+ * is appended after the delimiter, if the delimiter itself is not a null byte.
+ * The string will be embedded into quotation marks
+ *
+ * @param[out] pOutString AT command after appending argument
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_AppendArgumentBitsQuotationMarks(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+    if (NULL == pOutString)
+    {
+        return false;
+    }
+
+    char tempString[12];
+
+    if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8) != 0)
+    {
+        for (int i = 7; i >= 0; i--)
+        {
+            tempString[i] = pInValue & (1 << (7 - i)) ? '1' : '0';
+        }
+
+        tempString[8] = ATCOMMAND_STRING_TERMINATE;
+    }
+    else
+    {
+        return false;
+    }
+
+    return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
+}
+
+/**
+ * @brief Initializes an AT command builder.
+ *
+ * @param[out] pBuilder Builder to initialize
+ * @param[in] buffer Output buffer (usually AT_commandBuffer)
+ * @param[in] capacity Size of the output buffer including the termination character
+ * @param[in] command Initial content of the command (e.g. "AT+send="), may be NULL
+ */
+void ATCommand_Builder_Init(ATCommand_Builder_t* pBuilder, char* buffer, size_t capacity, const char* command)
+{
+    pBuilder->buffer = buffer;
+    pBuilder->capacity = capacity;
+    pBuilder->length = 0;
+    pBuilder->truncated = (0 == capacity);
+
+    if (capacity > 0)
+    {
+        buffer[0] = ATCOMMAND_STRING_TERMINATE;
+    }
+
+    if (NULL != command)
+    {
+        ATCommand_Builder_AppendString(pBuilder, command, ATCOMMAND_STRING_TERMINATE);
+    }
+}
+
+/**
+ * @brief Reserves space for the next argument.
+ *
+ * Once an argument didn't fit, the builder stays truncated and all further appends fail.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] count Number of characters to be appended (excl. termination character)
+ *
+ * @return Pointer to the current write position, NULL if the argument doesn't fit
+ */
+static char* ATCommand_Builder_Reserve(ATCommand_Builder_t* pBuilder, size_t count)
+{
+    if ((NULL == pBuilder) || pBuilder->truncated || (count >= pBuilder->capacity - pBuilder->length))
+    {
+        if (NULL != pBuilder)
+        {
+            pBuilder->truncated = true;
+        }
+        return NULL;
+    }
+
+    return &pBuilder->buffer[pBuilder->length];
+}
+
+/**
+ * @brief Appends an argument, optionally embedded into quotation marks, followed by the delimiter.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInArgument Argument to be added (may be NULL if argumentLength is 0)
+ * @param[in] argumentLength Length of the argument
+ * @param[in] quotationMarks Embed argument into quotation marks
+ * @param[in] delimiter Delimiter to append after argument (nothing is appended for ATCOMMAND_STRING_TERMINATE)
+ *
+ * @return true if successful, false if the argument didn't fit
+ */
+static bool ATCommand_Builder_Write(ATCommand_Builder_t* pBuilder, const char* pInArgument, size_t argumentLength, bool quotationMarks, char delimiter)
+{
+    size_t count = argumentLength + (quotationMarks ? 2 : 0) + ((ATCOMMAND_STRING_TERMINATE != delimiter) ? 1 : 0);
+    char* pOut = ATCommand_Builder_Reserve(pBuilder, count);
+    if (NULL == pOut)
+    {
+        return false;
+    }
+
+    if (quotationMarks)
+    {
+        *pOut++ = '\"';
+    }
+    if (argumentLength > 0)
+    {
+        memcpy(pOut, pInArgument, argumentLength);
+        pOut += argumentLength;
+    }
+    if (quotationMarks)
+    {
+        *pOut++ = '\"';
+    }
+    if (ATCOMMAND_STRING_TERMINATE != delimiter)
+    {
+        *pOut++ = delimiter;
+    }
+    *pOut = ATCOMMAND_STRING_TERMINATE;
+
+    pBuilder->length += count;
+    return true;
+}
+
+/**
+ * @brief Appends a string argument to the command.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInArgument Argument to be added (NULL appends the delimiter only)
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the argument didn't fit
+ */
+bool ATCommand_Builder_AppendString(ATCommand_Builder_t* pBuilder, const char* pInArgument, char delimiter) { return ATCommand_Builder_Write(pBuilder, pInArgument, (NULL == pInArgument) ? 0 : strlen(pInArgument), false, delimiter); }
+
+/**
+ * @brief Appends a string argument to the command, which is embedded into quotation marks.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInArgument Argument to be added (NULL appends the delimiter only)
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the argument didn't fit
+ */
+bool ATCommand_Builder_AppendStringQuotationMarks(ATCommand_Builder_t* pBuilder, const char* pInArgument, char delimiter)
+{
+    if (NULL == pInArgument)
+    {
+        return ATCommand_Builder_Write(pBuilder, NULL, 0, false, delimiter);
+    }
+    return ATCommand_Builder_Write(pBuilder, pInArgument, strlen(pInArgument), true, delimiter);
+}
+
+/**
+ * @brief Appends a byte array argument to the command.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInArgument Pointer to byte array to be added (NULL appends the delimiter only)
+ * @param[in] numBytes Number of bytes to add
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the argument didn't fit
+ */
+bool ATCommand_Builder_AppendBytes(ATCommand_Builder_t* pBuilder, const char* pInArgument, uint16_t numBytes, char delimiter) { return ATCommand_Builder_Write(pBuilder, pInArgument, (NULL == pInArgument) ? 0 : numBytes, false, delimiter); }
+
+/**
+ * @brief Appends a byte array as hexadecimal string (two upper case digits per byte) to the command.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] data Bytes to be added
+ * @param[in] length Number of bytes to add
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the argument didn't fit
+ */
+bool ATCommand_Builder_AppendHex(ATCommand_Builder_t* pBuilder, const uint8_t* data, uint16_t length, char delimiter)
+{
+    if ((NULL == data) && (length > 0))
+    {
+        return false;
+    }
+
+    size_t count = 2 * (size_t)length + ((ATCOMMAND_STRING_TERMINATE != delimiter) ? 1 : 0);
+    char* pOut = ATCommand_Builder_Reserve(pBuilder, count);
+    if (NULL == pOut)
+    {
+        return false;
+    }
+
+    for (uint16_t i = 0; i < length; i++)
+    {
+        *pOut++ = ATCommand_HexDigitsUpperCase[data[i] >> 4];
+        *pOut++ = ATCommand_HexDigitsUpperCase[data[i] & 0x0F];
+    }
+    if (ATCOMMAND_STRING_TERMINATE != delimiter)
+    {
+        *pOut++ = delimiter;
+    }
+    *pOut = ATCOMMAND_STRING_TERMINATE;
+
+    pBuilder->length += count;
+    return true;
+}
+
+/**
+ * @brief Appends an integer argument to the command.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the flags are invalid or the argument didn't fit
+ */
+bool ATCommand_Builder_AppendInt(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+    char tempString[12];
+    uint8_t length = ATCommand_FormatInt(tempString, pInValue, intFlags);
+    return (length != 0) && ATCommand_Builder_Write(pBuilder, tempString, length, false, delimiter);
+}
+
+/**
+ * @brief Appends an integer argument to the command, which is embedded into quotation marks.
+ *
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the flags are invalid or the argument didn't fit
+ */
+bool ATCommand_Builder_AppendIntQuotationMarks(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
+{
+    char tempString[12];
+    uint8_t length = ATCommand_FormatInt(tempString, pInValue, intFlags);
+    return (length != 0) && ATCommand_Builder_Write(pBuilder, tempString, length, true, delimiter);
+}
+
+/**
+ * @brief Appends the bits of an 8 bit value as string of '0'/'1' characters embedded into quotation marks.
  *
- * @return true if successful, false otherwise
+ * @param[in,out] pBuilder Builder
+ * @param[in] pInValue Argument to be added
+ * @param[in] intFlags Integer formatting flags (only ATCOMMAND_INTFLAGS_SIZE8 is supported)
+ * @param[in] delimiter Delimiter to append after argument
+ *
+ * @return true if successful, false if the flags are invalid or the argument didn't fit
  */
-bool ATCommand_GetNextArgumentIntWithoutQuotationMarks(char** pInArguments, void* pOutArgument, uint16_t intFlags, char delimiter)
+bool ATCommand_Builder_AppendBitsQuotationMarks(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter)
 {
-    if ((NULL == pInArguments) || (NULL == pOutArgument))
+    if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8) == 0)
     {
         return false;
     }
 
-    char tempString[40];
-
-    char* tempstartlocation = *pInArguments;
-
-    ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
-
-    if (!ATCommand_StringToInt(pOutArgument, tempString, intFlags))
+    char tempString[8];
+    for (int i = 7; i >= 0; i--)
     {
-        *pInArguments = tempstartlocation;
-        return false;
+        tempString[i] = pInValue & (1 << (7 - i)) ? '1' : '0';
     }
 
-    return true;
+    return ATCommand_Builder_Write(pBuilder, tempString, sizeof(tempString), true, delimiter);
 }
 
 /**
- * @brief Gets the command name from an AT command.
+ * @brief Appends a boolean string (true, false) to the command.
  *
- * @param[in,out] pInAtCmd AT command to get command name from
- * @param[in] pCmdName Command name as string
- * @param[in] CmdNameLen Length of the provided butter
- * @param[in] delimiters Delimiters which occurs after command name
- * @param[in] number_of_delimiters Number of delimiters
+ * @param[in,out] pBuilder Builder
+ * @param[in] inBool Value to append
+ * @param[in] delimiter Delimiter to append after argument
  *
- * @return true if successful, false otherwise
+ * @return true if successful, false if the argument didn't fit
  */
-bool ATCommand_GetCmdName(char** pInAtCmd, char* pCmdName, size_t CmdNameLen, char* delimiters, uint8_t number_of_delimiters)
-{
-    if ((NULL == pInAtCmd) || (NULL == pCmdName))
-    {
-        return false;
-    }
-
-    size_t argumentLength = 0;
-
-    while (true)
-    {
-        if (argumentLength >= CmdNameLen)
-        {
-            return false;
-        }
-        for (uint8_t i = 0; i < number_of_delimiters; i++)
-        {
-            if ((*pInAtCmd)[argumentLength] == delimiters[i])
-            {
-                /* if argument list not empty*/
-                /* copy string to output arguments */
-                memcpy(pCmdName, *pInAtCmd, argumentLength);
-
-                pCmdName[argumentLength] = '\0';
-
-                if ((*pInAtCmd)[argumentLength] == ATCOMMAND_STRING_TERMINATE)
-                {
-                    /* string end, nothing follows */
-                    *pInAtCmd = &((*pInAtCmd)[argumentLength]);
-                }
-                else
-                {
-                    /* more arguments follow */
-                    *pInAtCmd = &((*pInAtCmd)[argumentLength + 1]);
-                }
-                return true;
-            }
-        }
-        if ((*pInAtCmd)[argumentLength] == '\0')
-        {
-            return false;
-        }
-        argumentLength++;
-    }
-}
+bool ATCommand_Builder_AppendBoolean(ATCommand_Builder_t* pBuilder, bool inBool, char delimiter) { return ATCommand_Builder_AppendString(pBuilder, ATCommand_BooleanValueStrings[(inBool == true) ? 1 : 0], delimiter); }
 
 /**
- * @brief Looks up a string in a list of strings (case insensitive) and returns the
- * index of the string or the supplied default value, if the string is not found.
+ * @brief Appends bitmask strings delimited by ATCOMMAND_BITMASK_DELIM to the command.
  *
- * @param[in] stringList List of strings to search in
- * @param[in] numStrings Number of strings in stringList
- * @param[in] str String to look for
- * @param[in] defaultValue Value to return if the string is not found
- * @param[out] ok Is set to true if the string is found. Optional.
+ * @param[in,out] pBuilder Builder
+ * @param[in] stringList List of strings containing the string representations of the bits in the input bitmask
+ * @param[in] numStrings Number of elements in stringList (max. number of bits in input bitmask)
+ * @param[in] bitmask Input bitmask
+ * @param[in] delimiter Delimiter to append after argument
  *
- * @return Index of the first occurrence of str in stringList or defaultValue, if string is not found
+ * @return true if successful, false if the argument didn't fit
  */
-uint8_t ATCommand_FindString(const char* stringList[], uint8_t numStrings, const char* str, uint8_t defaultValue, bool* ok)
+bool ATCommand_Builder_AppendBitmask(ATCommand_Builder_t* pBuilder, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter)
 {
+    bool empty = true;
     for (uint8_t i = 0; i < numStrings; i++)
     {
-        if (0 == strcasecmp(stringList[i], str))
+        if (0 != (bitmask & (1 << i)))
         {
-            if (ok)
+            if (!empty && !ATCommand_Builder_Write(pBuilder, NULL, 0, false, ATCOMMAND_BITMASK_DELIM))
             {
-                *ok = true;
+                return false;
             }
-            return i;
+            if (!ATCommand_Builder_AppendString(pBuilder, stringList[i], ATCOMMAND_STRING_TERMINATE))
+            {
+                return false;
+            }
+            empty = false;
         }
     }
-
-    if (ok)
-    {
-        *ok = false;
-    }
-    return defaultValue;
+    return ATCommand_Builder_Write(pBuilder, NULL, 0, false, delimiter);
 }
 
 /**
- * @brief Appends a bits argument to the end of an AT command, which is embedded into quotation marks
- *
- * The supplied delimiter is appended after the argument. A null byte ('\0')
- * is appended after the delimiter, if the delimiter itself is not a null byte.
- * The string will be embedded into quotation marks
+ * @brief Removes characters from the end of the command.
  *
- * @param[out] pOutString AT command after appending argument
- * @param[in] pInValue Argument to be added
- * @param[in] intFlags Integer formatting flags
- * @param[in] delimiter Delimiter to append after argument
+ * Used to strip delimiters of trailing optional arguments that have been omitted.
  *
- * @return true if successful, false otherwise
+ * @param[in,out] pBuilder Builder
+ * @param[in] count Number of characters to remove
  */
-bool ATCommand_AppendArgumentBitsQuotationMarks(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter)
+void ATCommand_Builder_TrimEnd(ATCommand_Builder_t* pBuilder, size_t count)
 {
-    if (NULL == pOutString)
-    {
-        return false;
-    }
-
-    char tempString[12];
-
-    if ((intFlags & ATCOMMAND_INTFLAGS_SIZE8) != 0)
-    {
-        for (int i = 7; i >= 0; i--)
-        {
-            tempString[i] = pInValue & (1 << (7 - i)) ? '1' : '0';
-        }
-
-        tempString[8] = ATCOMMAND_STRING_TERMINATE;
-    }
-    else
+    pBuilder->length = (count < pBuilder->length) ? (pBuilder->length - count) : 0;
+    if (pBuilder->capacity > 0)
     {
-        return false;
+        pBuilder->buffer[pBuilder->length] = ATCOMMAND_STRING_TERMINATE;
     }
-
-    return ATCommand_AppendArgumentStringQuotationMarks(pOutString, tempString, delimiter);
 }
 
 /**
@@ -826,16 +1700,31 @@ bool ATCommand_GetNextArgumentBitsWithoutQuotationMarks(char** pInArguments, voi
  */
 bool ATCommand_GetNextArgumentEnumWithoutQuotationMarks(char** pInArguments, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, uint16_t maxStringLength, char delimiter)
 {
-    char tempString[maxStringLength];
+    if ((NULL == pInArguments) || (NULL == pOutArgument) || (maxStringLength == 0))
+    {
+        return false;
+    }
+
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
 
-    if (!ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString)))
+    ATCommand_Token_t token;
+    size_t consumed;
+    if (!ATCommand_Cursor_Peek(&cursor, delimiter, &token, &consumed) || (token.length > (size_t)(maxStringLength + 1)) || !ATCommand_Token_StripQuotationMarks(&token))
     {
         return false;
     }
 
-    bool ok;
-    *pOutArgument = ATCommand_FindString(stringList, numStrings, tempString, 0, &ok);
-    return ok;
+    /* The argument is consumed even if it doesn't match any of the strings */
+    *pInArguments += consumed;
+
+    if (!ATCommand_Token_FindString(&token, pOutArgument, stringList, numStrings))
+    {
+        *pOutArgument = 0;
+        return false;
+    }
+
+    return true;
 }
 
 /**
@@ -914,18 +1803,15 @@ bool ATCommand_GetNextArgumentDouble(char** pInArguments, void* pOutArgument, ch
         return false;
     }
 
-    char tempString[40];
-
-    char* tempstartlocation = *pInArguments;
-
-    ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
 
-    if (!ATCommand_StringToDouble(pOutArgument, tempString))
+    if (!ATCommand_Cursor_NextDouble(&cursor, (double*)pOutArgument, delimiter))
     {
-        *pInArguments = tempstartlocation;
         return false;
     }
 
+    *pInArguments = cursor.pos;
     return true;
 }
 
@@ -945,18 +1831,15 @@ bool ATCommand_GetNextArgumentFloat(char** pInArguments, void* pOutArgument, cha
         return false;
     }
 
-    char tempString[40];
-
-    char* tempstartlocation = *pInArguments;
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
 
-    ATCommand_GetNextArgumentString(pInArguments, tempString, delimiter, sizeof(tempString));
-
-    if (!ATCommand_StringToFloat(pOutArgument, tempString))
+    if (!ATCommand_Cursor_NextFloat(&cursor, (float*)pOutArgument, delimiter))
     {
-        *pInArguments = tempstartlocation;
         return false;
     }
 
+    *pInArguments = cursor.pos;
     return true;
 }
 
@@ -976,18 +1859,16 @@ bool ATCommand_GetNextArgumentDoubleWithoutQuotationMarks(char** pInArguments, v
         return false;
     }
 
-    char tempString[40];
-
-    char* tempstartlocation = *pInArguments;
-
-    ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
 
-    if (!ATCommand_StringToDouble(pOutArgument, tempString))
+    ATCommand_Token_t token;
+    if (!ATCommand_Cursor_NextToken(&cursor, delimiter, &token) || !ATCommand_Token_StripQuotationMarks(&token) || !ATCommand_Token_ToDouble(&token, (double*)pOutArgument))
     {
-        *pInArguments = tempstartlocation;
         return false;
     }
 
+    *pInArguments = cursor.pos;
     return true;
 }
 
@@ -1007,18 +1888,16 @@ bool ATCommand_GetNextArgumentFloatWithoutQuotationMarks(char** pInArguments, vo
         return false;
     }
 
-    char tempString[40];
-
-    char* tempstartlocation = *pInArguments;
-
-    ATCommand_GetNextArgumentStringWithoutQuotationMarks(pInArguments, tempString, delimiter, sizeof(tempString));
+    ATCommand_Cursor_t cursor;
+    ATCommand_Cursor_InitUnbounded(&cursor, *pInArguments);
 
-    if (!ATCommand_StringToFloat(pOutArgument, tempString))
+    ATCommand_Token_t token;
+    if (!ATCommand_Cursor_NextToken(&cursor, delimiter, &token) || !ATCommand_Token_StripQuotationMarks(&token) || !ATCommand_Token_ToFloat(&token, (float*)pOutArgument))
     {
-        *pInArguments = tempstartlocation;
         return false;
     }
 
+    *pInArguments = cursor.pos;
     return true;
 }
 
@@ -1061,49 +1940,195 @@ int ATCommand_CountArgs(char* stringP)
     return argscount;
 }
 
-bool ATCommand_ParseEventType(char** pAtCommand, const ATCommand_Event_t* pmoduleEvents, char* delimiters, uint8_t number_of_delimiters, uint16_t* pEvent)
+/**
+ * @brief Looks up an event name in an event table.
+ *
+ * The names are only compared for entries of matching length, which is stored in the table at
+ * compile time. Thus, an unsolicited line costs one byte comparison per entry and a single
+ * memcmp() in the common case.
+ *
+ * @param[in] pEvents Event table
+ * @param[in] name Event name (not null-terminated)
+ * @param[in] nameLength Length of the event name
+ *
+ * @return Matching entry, NULL if none
+ */
+static const ATCommand_Event_t* ATCommand_FindEvent(const ATCommand_Event_t* pEvents, const char* name, size_t nameLength)
 {
-    const ATCommand_Event_t* eventP = &pmoduleEvents[0];
-
-    char cmdName[32];
+    for (const ATCommand_Event_t* eventP = pEvents;; eventP++)
+    {
+        if ((eventP->eventName == NULL) || ((eventP->nameLength == nameLength) && (0 == memcmp(eventP->eventName, name, nameLength))))
+        {
+            return eventP;
+        }
+        if (eventP->last)
+        {
+            /* no next entry */
+            return NULL;
+        }
+    }
+}
 
-    if (!ATCommand_GetCmdName(pAtCommand, cmdName, sizeof(cmdName), delimiters, number_of_delimiters))
+/**
+ * @brief Determines the event of a received line.
+ *
+ * @param[in,out] pAtCommand Received line, moved behind the event name(s) if successful
+ * @param[in] pmoduleEvents Event table of the driver
+ * @param[in] delimiters Characters which may occur after the event name
+ * @param[in] number_of_delimiters Number of delimiters
+ * @param[out] pEvent ID of the event
+ *
+ * @return true if successful, false otherwise
+ */
+bool ATCommand_ParseEventType(char** pAtCommand, const ATCommand_Event_t* pmoduleEvents, char* delimiters, uint8_t number_of_delimiters, uint16_t* pEvent)
+{
+    if ((NULL == pAtCommand) || (NULL == pmoduleEvents) || (NULL == pEvent))
     {
         return false;
     }
 
-    while (eventP != NULL)
+    char* pos = *pAtCommand;
+    size_t nameLength = 0;
+
+    /* Find the end of the event name in place, the name isn't copied */
+    while (true)
     {
-        if ((eventP->eventName == NULL) || (strcmp(eventP->eventName, cmdName) == 0))
+        bool isDelimiter = false;
+        for (uint8_t i = 0; i < number_of_delimiters; i++)
         {
-            if (eventP->subEventsP != NULL)
-            {
-                if (!ATCommand_GetNextArgumentString(pAtCommand, cmdName, eventP->subDelimiter, sizeof(cmdName)))
-                {
-                    return false;
-                }
-                eventP = eventP->subEventsP;
-            }
-            else
+            if (pos[nameLength] == delimiters[i])
             {
-                *pEvent = eventP->eventID;
-                return true;
+                isDelimiter = true;
+                break;
             }
         }
-        else
+        if (isDelimiter)
         {
-            if (eventP->last)
-            {
-                /* no next entry */
-                return false;
-            }
-            else
-            {
-                /* go to next entry */
-                eventP += 1;
-            }
+            break;
+        }
+        if (pos[nameLength] == ATCOMMAND_STRING_TERMINATE)
+        {
+            return false;
         }
+        nameLength++;
     }
 
-    return false;
+    const ATCommand_Event_t* eventP = ATCommand_FindEvent(pmoduleEvents, pos, nameLength);
+
+    /* Skip the delimiter, unless it is the end of the string */
+    pos += (pos[nameLength] == ATCOMMAND_STRING_TERMINATE) ? nameLength : (nameLength + 1);
+
+    while ((eventP != NULL) && (eventP->subEventsP != NULL))
+    {
+        ATCommand_Cursor_t cursor;
+        ATCommand_Cursor_InitUnbounded(&cursor, pos);
+
+        ATCommand_Token_t subEventName;
+        size_t consumed;
+        if (!ATCommand_Cursor_Peek(&cursor, eventP->subDelimiter, &subEventName, &consumed))
+        {
+            return false;
+        }
+
+        eventP = ATCommand_FindEvent(eventP->subEventsP, subEventName.data, subEventName.length);
+        pos += consumed;
+    }
+
+    if (eventP == NULL)
+    {
+        return false;
+    }
+
+    *pAtCommand = pos;
+    *pEvent = eventP->eventID;
+    return true;
+}
+
+/**
+ * @brief Thread function of an AT command driver's receive task.
+ *
+ * @param[in] argument Receive task (ATCommand_RxTask_t)
+ */
+static void ATCommand_RxTask_Run(void* argument)
+{
+    ATCommand_RxTask_t* task = (ATCommand_RxTask_t*)argument;
+    ATCommand_RxChunk_t chunk;
+    while (1)
+    {
+        if (WE_Queue_Receive(task->queue, &chunk, WE_WAIT_FOREVER))
+        {
+            (*task->handlerP)(chunk.data, chunk.length);
+        }
+    }
+}
+
+/**
+ * @brief Starts the receive task of an AT command driver (if not already running).
+ *
+ * @param[in] task Receive task
+ * @param[in] handlerP Pointer to the driver's byte handler (is executed by the receive task)
+ * @param[in] name Name of the task
+ *
+ * @return true if the receive task is running, false if no task could be created (e.g. on bare metal platforms)
+ */
+bool ATCommand_RxTask_Start(ATCommand_RxTask_t* task, WE_UART_HandleRxByte_t* handlerP, const char* name)
+{
+    task->handlerP = handlerP;
+
+    if (NULL != task->thread)
+    {
+        /* Already running (the task is kept running when the driver is de-initialized) */
+        return true;
+    }
+
+    if (!WE_Queue_Create(&task->queue, sizeof(ATCommand_RxChunk_t), ATCOMMAND_RX_QUEUE_LENGTH))
+    {
+        return false;
+    }
+
+    if (!WE_Thread_Create(&task->thread, ATCommand_RxTask_Run, task, name, ATCOMMAND_RX_TASK_STACK_SIZE, WE_ThreadPriority_High))
+    {
+        WE_Queue_Delete(task->queue);
+        task->queue = NULL;
+        task->thread = NULL;
+        return false;
+    }
+
+    return true;
 }
+
+/**
+ * @brief Queues received data for the receive task of an AT command driver.
+ *
+ * Is used as byte handler of the UART (may be called from interrupt context). Data that doesn't fit
+ * into the queue is discarded (see ATCommand_RxTask_t::droppedBytes).
+ *
+ * @param[in] task Receive task
+ * @param[in] dataP Received data
+ * @param[in] size Number of received bytes
+ */
+void ATCommand_RxTask_Enqueue(ATCommand_RxTask_t* task, uint8_t* dataP, size_t size)
+{
+    ATCommand_RxChunk_t chunk;
+    while (size > 0)
+    {
+        chunk.length = (size > ATCOMMAND_RX_CHUNK_SIZE) ? ATCOMMAND_RX_CHUNK_SIZE : (uint8_t)size;
+        memcpy(chunk.data, dataP, chunk.length);
+        if (!WE_Queue_Send(task->queue, &chunk, 0))
+        {
+            task->droppedBytes += size;
+            return;
+        }
+        dataP += chunk.length;
+        size -= chunk.length;
+    }
+}
+
+/**
+ * @brief Checks if the caller is executed in the context in which the driver processes received data.
+ *
+ * @param[in] task Receive task
+ *
+ * @return true if called by the receive task or if the receive task is not running, false otherwise
+ */
+bool ATCommand_RxTask_IsCurrentContext(ATCommand_RxTask_t* task) { return (NULL == task->thread) || (WE_Thread_GetCurrent() == task->thread); }
@@ -31,6 +31,7 @@
 #ifndef GLOBAL_AT_COMMMANDS_H_INCLUDED
 #define GLOBAL_AT_COMMMANDS_H_INCLUDED
 
+#include <global/global_types.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -73,7 +74,9 @@
 #define ATCOMMAND_INTFLAGS_NOTATION_HEX (uint16_t)(0x40) /**< Hexadecimal notation */
 #define ATCOMMAND_INTFLAGS_NOTATION_DEC (uint16_t)(0x80) /**< Decimal notation */
 
-#define FULLEVENTENTRY(name, id, subevent, subdelimiter, l) {.eventName = name, .eventID = id, .subEventsP = subevent, .subDelimiter = subdelimiter, .last = l},
+#define ATCOMMAND_EVENT_NAME_LENGTH(name) (uint8_t)(sizeof(name) - 1) /**< Length of an event name literal, evaluated at compile time */
+
+#define FULLEVENTENTRY(name, id, subevent, subdelimiter, l) {.eventName = name, .nameLength = ATCOMMAND_EVENT_NAME_LENGTH(name), .eventID = id, .subEventsP = subevent, .subDelimiter = subdelimiter, .last = l},
 
 #define EVENTENTRY(name, id) FULLEVENTENTRY(name, id, NULL, ATCOMMAND_STRING_TERMINATE, false)
 #define LASTEVENTENTRY(name, id) FULLEVENTENTRY(name, id, NULL, ATCOMMAND_STRING_TERMINATE, true)
@@ -81,6 +84,27 @@
 #define PARENTEVENTENTRY(name, subevent, subdelimiter) FULLEVENTENTRY(name, 0, subevent, subdelimiter, false)
 #define LASTPARENTEVENTENTRY(name, subevent, subdelimiter) FULLEVENTENTRY(name, 0, subevent, subdelimiter, true)
 
+#ifndef ATCOMMAND_RX_CHUNK_SIZE
+/**
+ * @brief Maximum number of received bytes passed to an AT command driver's receive task at once (see ATCommand_RxTask_t).
+ */
+#define ATCOMMAND_RX_CHUNK_SIZE 32
+#endif
+
+#ifndef ATCOMMAND_RX_QUEUE_LENGTH
+/**
+ * @brief Number of chunks of received data that can be queued for an AT command driver's receive task.
+ */
+#define ATCOMMAND_RX_QUEUE_LENGTH 32
+#endif
+
+#ifndef ATCOMMAND_RX_TASK_STACK_SIZE
+/**
+ * @brief Stack size (bytes) of an AT command driver's receive task. Note that the event callbacks are executed by this task.
+ */
+#define ATCOMMAND_RX_TASK_STACK_SIZE 2048
+#endif
+
 /**
  * @brief Boolean value (true, false).
  */
@@ -93,15 +117,79 @@ typedef enum ATCommand_BooleanValue_t
     /** @endcond */
 } ATCommand_BooleanValue_t;
 
+/**
+ * @brief Entry of an event table, see EVENTENTRY() and PARENTEVENTENTRY().
+ *
+ * The length of the event name is stored in the entry when the table is compiled, so that
+ * ATCommand_ParseEventType() only compares the names of entries whose length matches.
+ */
 typedef struct ATCommand_Event_t
 {
-    uint16_t eventID;
-    const struct ATCommand_Event_t* subEventsP;
-    char* eventName;
-    char subDelimiter;
-    bool last;
+    uint16_t eventID;                           /**< Event ID returned if this entry matches (entries without sub events only) */
+    const struct ATCommand_Event_t* subEventsP; /**< Table of sub events, NULL if this entry has no sub events */
+    char* eventName;                            /**< Name of the event, NULL matches any name */
+    uint8_t nameLength;                         /**< Length of eventName (not used if eventName is NULL) */
+    char subDelimiter;                          /**< Delimiter which occurs after the name of the sub event */
+    bool last;                                  /**< True for the last entry of the table */
 } ATCommand_Event_t;
 
+/**
+ * @brief Receive task of an AT command driver.
+ *
+ * If WE_AT_RX_TASK is defined and threads are supported by the platform (see WE_Thread_Create()), the
+ * AT command drivers don't process received data in the context of the UART (i.e. in interrupt context
+ * on bare metal platforms). Instead, the data is queued for the driver's receive task, which parses the
+ * received lines, wakes up the thread waiting for the response and executes the event callback.
+ */
+typedef struct ATCommand_RxTask_t
+{
+    WE_Queue_t queue;                 /**< Queue of received data chunks */
+    WE_Thread_t thread;               /**< Receive task (NULL if not running) */
+    WE_UART_HandleRxByte_t* handlerP; /**< Pointer to the driver's byte handler, which is executed by the receive task */
+    volatile uint32_t droppedBytes;   /**< Number of received bytes discarded because the queue was full */
+} ATCommand_RxTask_t;
+
+/**
+ * @brief Builder for AT commands.
+ *
+ * Keeps track of the write position and the remaining capacity of the output buffer, so that
+ * appending an argument doesn't have to search for the end of the command built so far.
+ * If an argument doesn't fit into the buffer, nothing is written, the builder is marked as
+ * truncated and all further appends fail.
+ */
+typedef struct ATCommand_Builder_t
+{
+    char* buffer;    /**< Output buffer, always null-terminated */
+    size_t length;   /**< Length of the command built so far (excl. termination character) */
+    size_t capacity; /**< Size of the output buffer (incl. termination character) */
+    bool truncated;  /**< True if an argument didn't fit into the output buffer */
+} ATCommand_Builder_t;
+
+/**
+ * @brief Read position in a received AT command line.
+ *
+ * Arguments are read from the line in a single pass: each call scans the next argument once,
+ * returns it as a view into the line and moves the cursor behind the delimiter. The line itself
+ * isn't modified and arguments aren't copied unless explicitly requested.
+ * Scanning stops at the end of the remaining part or at a termination character, whichever comes first.
+ */
+typedef struct ATCommand_Cursor_t
+{
+    char* pos;        /**< Start of the remaining, not yet parsed part of the line */
+    size_t remaining; /**< Length of the remaining part of the line (excl. termination character) */
+} ATCommand_Cursor_t;
+
+/**
+ * @brief View of a single argument in a received AT command line.
+ *
+ * The argument is not null-terminated, it is only valid as long as the underlying line is.
+ */
+typedef struct ATCommand_Token_t
+{
+    char* data;    /**< Start of the argument in the line */
+    size_t length; /**< Length of the argument */
+} ATCommand_Token_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -128,6 +216,36 @@ extern bool ATCommand_AppendArgumentBoolean(char* pOutString, bool inBool, char
 
 extern bool ATCommand_AppendArgumentBitsQuotationMarks(char* pOutString, uint32_t pInValue, uint16_t intFlags, char delimiter);
 
+extern void ATCommand_Builder_Init(ATCommand_Builder_t* pBuilder, char* buffer, size_t capacity, const char* command);
+extern bool ATCommand_Builder_AppendString(ATCommand_Builder_t* pBuilder, const char* pInArgument, char delimiter);
+extern bool ATCommand_Builder_AppendStringQuotationMarks(ATCommand_Builder_t* pBuilder, const char* pInArgument, char delimiter);
+extern bool ATCommand_Builder_AppendBytes(ATCommand_Builder_t* pBuilder, const char* pInArgument, uint16_t numBytes, char delimiter);
+extern bool ATCommand_Builder_AppendHex(ATCommand_Builder_t* pBuilder, const uint8_t* data, uint16_t length, char delimiter);
+extern bool ATCommand_Builder_AppendInt(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+extern bool ATCommand_Builder_AppendIntQuotationMarks(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+extern bool ATCommand_Builder_AppendBitsQuotationMarks(ATCommand_Builder_t* pBuilder, uint32_t pInValue, uint16_t intFlags, char delimiter);
+extern bool ATCommand_Builder_AppendBoolean(ATCommand_Builder_t* pBuilder, bool inBool, char delimiter);
+extern bool ATCommand_Builder_AppendBitmask(ATCommand_Builder_t* pBuilder, const char* stringList[], uint8_t numStrings, uint32_t bitmask, char delimiter);
+extern void ATCommand_Builder_TrimEnd(ATCommand_Builder_t* pBuilder, size_t count);
+
+extern void ATCommand_Cursor_Init(ATCommand_Cursor_t* pCursor, char* line);
+extern void ATCommand_Cursor_InitLength(ATCommand_Cursor_t* pCursor, char* data, size_t length);
+extern bool ATCommand_Cursor_NextToken(ATCommand_Cursor_t* pCursor, char delimiter, ATCommand_Token_t* pToken);
+extern bool ATCommand_Cursor_NextBytes(ATCommand_Cursor_t* pCursor, size_t length, ATCommand_Token_t* pToken);
+extern bool ATCommand_Cursor_NextString(ATCommand_Cursor_t* pCursor, char* pOutArgument, size_t maxLength, char delimiter);
+extern bool ATCommand_Cursor_NextStringWithoutQuotationMarks(ATCommand_Cursor_t* pCursor, char* pOutArgument, size_t maxLength, char delimiter);
+extern bool ATCommand_Cursor_NextInt(ATCommand_Cursor_t* pCursor, void* pOutArgument, uint16_t intFlags, char delimiter);
+extern bool ATCommand_Cursor_NextIntWithoutQuotationMarks(ATCommand_Cursor_t* pCursor, void* pOutArgument, uint16_t intFlags, char delimiter);
+extern bool ATCommand_Cursor_NextDouble(ATCommand_Cursor_t* pCursor, double* pOutArgument, char delimiter);
+extern bool ATCommand_Cursor_NextFloat(ATCommand_Cursor_t* pCursor, float* pOutArgument, char delimiter);
+extern bool ATCommand_Cursor_NextEnum(ATCommand_Cursor_t* pCursor, uint8_t* pOutArgument, const char* stringList[], uint8_t numStrings, char delimiter);
+extern bool ATCommand_Cursor_NextBoolean(ATCommand_Cursor_t* pCursor, bool* pOutArgument, char delimiter);
+extern bool ATCommand_Token_StripQuotationMarks(ATCommand_Token_t* pToken);
+extern bool ATCommand_Token_Equals(const ATCommand_Token_t* pToken, const char* str);
+extern bool ATCommand_Token_ToInt(const ATCommand_Token_t* pToken, void* pOutInt, uint16_t intFlags);
+extern bool ATCommand_Token_ToDouble(const ATCommand_Token_t* pToken, double* pOutDouble);
+extern bool ATCommand_Token_ToFloat(const ATCommand_Token_t* pToken, float* pOutFloat);
+
 extern bool ATCommand_GetNextArgumentString(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength);
 
 extern bool ATCommand_GetNextArgumentStringWithoutQuotationMarks(char** pInArguments, char* pOutArgument, char delimiter, uint16_t maxLength);
@@ -170,6 +288,12 @@ extern int ATCommand_CountArgs(char* stringP);
 
 extern bool ATCommand_ParseEventType(char** pAtCommand, const ATCommand_Event_t* pmoduleEvents, char* delimiters, uint8_t number_of_delimiters, uint16_t* pEvent);
 
+extern bool ATCommand_RxTask_Start(ATCommand_RxTask_t* task, WE_UART_HandleRxByte_t* handlerP, const char* name);
+
+extern void ATCommand_RxTask_Enqueue(ATCommand_RxTask_t* task, uint8_t* dataP, size_t size);
+
+extern bool ATCommand_RxTask_IsCurrentContext(ATCommand_RxTask_t* task);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,612 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file CMDFrame.c
+ * @brief Shared handling of the binary command frames used by the radio modules with a
+ * command interface of the form STX | CMD | LENGTH | DATA | CS (XOR checksum).
+ */
+
+#include <global/CMDFrame.h>
+#include <global/global.h>
+#include <string.h>
+
+#if (CMDFRAME_CONFIRMATION_QUEUE_LENGTH < 1) || ((CMDFRAME_CONFIRMATION_QUEUE_LENGTH & (CMDFRAME_CONFIRMATION_QUEUE_LENGTH - 1)) != 0)
+#error "CMDFRAME_CONFIRMATION_QUEUE_LENGTH must be a power of two"
+#endif
+
+#if (CMDFRAME_ASYNC_QUEUE_LENGTH < 1) || (CMDFRAME_ASYNC_QUEUE_LENGTH > 128) || ((CMDFRAME_ASYNC_QUEUE_LENGTH & (CMDFRAME_ASYNC_QUEUE_LENGTH - 1)) != 0)
+#error "CMDFRAME_ASYNC_QUEUE_LENGTH must be a power of two in the range 1 to 128"
+#endif
+
+/**
+ * @brief Returns the size of the header of a frame (start byte, command byte and length field).
+ */
+static inline uint16_t CMDFrame_HeaderSize(const CMDFrame_Parser_t* parser) { return 2 + parser->lengthFieldSize; }
+
+/**
+ * @brief Reads the (little endian) payload length of a frame.
+ */
+static inline uint16_t CMDFrame_ReadLength(const CMDFrame_Parser_t* parser, const uint8_t* frameP)
+{
+    /* Read byte-wise, as frames are not necessarily aligned */
+    uint16_t length = frameP[2];
+    if (parser->lengthFieldSize > 1)
+    {
+        length |= (uint16_t)frameP[3] << 8;
+    }
+    return length;
+}
+
+/**
+ * @brief Passes a complete frame (with valid checksum) to the frame callback.
+ */
+static void CMDFrame_Deliver(CMDFrame_Parser_t* parser, uint8_t* frameP)
+{
+    CMDFrame_t frame;
+    frame.frameP = frameP;
+    frame.cmd = frameP[1];
+    frame.length = CMDFrame_ReadLength(parser, frameP);
+    frame.data = frameP + CMDFrame_HeaderSize(parser);
+    WE_STATS_ADD(parser->stats, rxFrames, 1);
+    parser->frameCb(parser->context, &frame);
+}
+
+/**
+ * @brief Checks if the received data starts with a complete frame having a valid checksum.
+ *
+ * @return Size of the frame or 0 if the data doesn't start with a complete and valid frame
+ */
+static uint16_t CMDFrame_GetCompleteFrameSize(const CMDFrame_Parser_t* parser, const uint8_t* dataP, size_t size)
+{
+    uint16_t headerSize = CMDFrame_HeaderSize(parser);
+    if ((size <= headerSize) || (dataP[0] != parser->stx))
+    {
+        return 0;
+    }
+
+    uint32_t frameSize = (uint32_t)CMDFrame_ReadLength(parser, dataP) + headerSize + 1;
+    if ((frameSize > size) || (frameSize > parser->bufferSize))
+    {
+        return 0;
+    }
+
+    /* The XOR over all bytes of a frame including the checksum is zero */
+    return (CMDFrame_Checksum(dataP, frameSize) == 0) ? (uint16_t)frameSize : 0;
+}
+
+/**
+ * @brief Initializes a parser assembling frames from received bytes.
+ *
+ * @param[out] parser Parser to be initialized
+ * @param[in] stx Start byte of frames
+ * @param[in] lengthFieldSize Size of the length field in bytes (1 or 2)
+ * @param[in] buffer Buffer used to assemble frames that are not received in one piece
+ * @param[in] bufferSize Size of buffer (frames exceeding this size are discarded)
+ * @param[in] frameCb Function called for each received frame
+ * @param[in] context Passed to frameCb (e.g. the driver's instance handle)
+ */
+void CMDFrame_Parser_Init(CMDFrame_Parser_t* parser, uint8_t stx, uint8_t lengthFieldSize, uint8_t* buffer, uint16_t bufferSize, CMDFrame_FrameCallback_t frameCb, void* context)
+{
+    parser->stx = stx;
+    parser->lengthFieldSize = lengthFieldSize;
+    parser->buffer = buffer;
+    parser->bufferSize = bufferSize;
+    parser->frameCb = frameCb;
+    parser->context = context;
+#if defined(WE_STATS_ENABLED)
+    parser->stats = NULL;
+#endif
+    CMDFrame_Parser_Reset(parser);
+}
+
+/**
+ * @brief Discards the partially received frame (if any).
+ *
+ * @param[in] parser Parser
+ */
+void CMDFrame_Parser_Reset(CMDFrame_Parser_t* parser)
+{
+    parser->rxByteCounter = 0;
+    parser->bytesToReceive = 0;
+    parser->checksum = 0;
+}
+
+/**
+ * @brief Handles bytes received via UART.
+ *
+ * Frames that have been received completely are passed to the parser's frame callback.
+ * If a frame is contained in dataP in one piece, it is passed to the callback directly
+ * (without being copied to the parser's buffer). Otherwise the frame is assembled in the
+ * parser's buffer, while the checksum is updated as the data arrives.
+ *
+ * @param[in] parser Parser
+ * @param[in] dataP Received bytes
+ * @param[in] size Number of received bytes
+ */
+void CMDFrame_Parser_HandleRxBytes(CMDFrame_Parser_t* parser, uint8_t* dataP, size_t size)
+{
+    const uint16_t headerSize = CMDFrame_HeaderSize(parser);
+
+    WE_STATS_ADD(parser->stats, rxBytes, size);
+
+    while (size > 0)
+    {
+        if (parser->rxByteCounter == 0)
+        {
+            uint16_t frameSize = CMDFrame_GetCompleteFrameSize(parser, dataP, size);
+            if (frameSize > 0)
+            {
+                /* Complete frame available in the receive buffer - evaluate it in place */
+                CMDFrame_Deliver(parser, dataP);
+                dataP += frameSize;
+                size -= frameSize;
+                continue;
+            }
+
+            if (*dataP != parser->stx)
+            {
+                /* Wait for start byte of frame */
+                uint8_t* stxP = memchr(dataP, parser->stx, size);
+                if (stxP == NULL)
+                {
+                    return;
+                }
+                size -= stxP - dataP;
+                dataP = stxP;
+                continue;
+            }
+        }
+
+        if (parser->rxByteCounter < headerSize)
+        {
+            /* Header (start byte, command, length field) */
+            parser->buffer[parser->rxByteCounter++] = *dataP;
+            parser->checksum ^= *dataP;
+            dataP++;
+            size--;
+
+            if (parser->rxByteCounter == headerSize)
+            {
+                uint32_t frameSize = (uint32_t)CMDFrame_ReadLength(parser, parser->buffer) + headerSize + 1;
+                if (frameSize > parser->bufferSize)
+                {
+                    /* Frame doesn't fit into buffer - discard it */
+                    WE_STATS_ADD(parser->stats, droppedFrames, 1);
+                    CMDFrame_Parser_Reset(parser);
+                    continue;
+                }
+                parser->bytesToReceive = (uint16_t)frameSize;
+            }
+            continue;
+        }
+
+        /* Payload and checksum - copy as much as is available */
+        size_t chunkSize = parser->bytesToReceive - parser->rxByteCounter;
+        if (chunkSize > size)
+        {
+            chunkSize = size;
+        }
+        memcpy(parser->buffer + parser->rxByteCounter, dataP, chunkSize);
+        parser->checksum ^= CMDFrame_Checksum(dataP, chunkSize);
+        parser->rxByteCounter += chunkSize;
+        dataP += chunkSize;
+        size -= chunkSize;
+
+        if (parser->rxByteCounter == parser->bytesToReceive)
+        {
+            if (parser->checksum == 0)
+            {
+                /* Received frame ok, interpret it now */
+                CMDFrame_Deliver(parser, parser->buffer);
+            }
+            else
+            {
+                WE_STATS_ADD(parser->stats, parseErrors, 1);
+            }
+            CMDFrame_Parser_Reset(parser);
+        }
+    }
+}
+
+/**
+ * @brief Calculates the XOR checksum of a block of data.
+ *
+ * The data is processed a word at a time.
+ *
+ * @param[in] dataP Data
+ * @param[in] length Number of bytes
+ *
+ * @return XOR of all bytes
+ */
+uint8_t CMDFrame_Checksum(const uint8_t* dataP, size_t length)
+{
+    uint32_t checksum32 = 0;
+    for (; length >= sizeof(uint32_t); length -= sizeof(uint32_t), dataP += sizeof(uint32_t))
+    {
+        uint32_t word;
+        memcpy(&word, dataP, sizeof(word));
+        checksum32 ^= word;
+    }
+    checksum32 ^= checksum32 >> 16;
+    checksum32 ^= checksum32 >> 8;
+
+    uint8_t checksum = (uint8_t)checksum32;
+    for (; length > 0; length--, dataP++)
+    {
+        checksum ^= *dataP;
+    }
+    return checksum;
+}
+
+/**
+ * @brief Appends the checksum to a frame to be sent.
+ *
+ * @param[in,out] frameP Frame (the checksum is written to frameP[length])
+ * @param[in] length Size of the frame without checksum (header and payload)
+ */
+void CMDFrame_FillChecksum(uint8_t* frameP, size_t length) { frameP[length] = CMDFrame_Checksum(frameP, length); }
+
+/**
+ * @brief Discards all confirmations received so far (e.g. before sending a new request).
+ *
+ * @param[in] queue Queue
+ */
+void CMDFrame_ConfirmationQueue_Reset(CMDFrame_ConfirmationQueue_t* queue) { queue->tail = queue->head; }
+
+/**
+ * @brief Registers the buffer the next confirmation having the command byte cmd is copied to.
+ *
+ * Must be called before the request is sent, as the confirmation might be received before the
+ * transmit function returns. The buffer is released when the confirmation has been copied or when
+ * CMDFrame_ConfirmationQueue_Wait() returns, whichever happens first.
+ *
+ * @param[in] queue Queue
+ * @param[in] cmd Expected confirmation (command byte)
+ * @param[out] responseP Buffer the complete frame of the confirmation is copied to
+ * @param[in] responseSize Size of responseP (longer frames are truncated)
+ */
+void CMDFrame_ConfirmationQueue_ExpectResponse(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd, void* responseP, uint16_t responseSize)
+{
+    uint32_t state = WE_EnterCritical();
+    queue->responseCmd = cmd;
+    queue->responseSize = responseSize;
+    queue->responseP = (uint8_t*)responseP;
+    WE_ExitCritical(state);
+}
+
+/**
+ * @brief Releases the response buffer registered for the confirmation cmd (if any).
+ */
+static void CMDFrame_ConfirmationQueue_ReleaseResponse(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd)
+{
+    uint32_t state = WE_EnterCritical();
+    if (queue->responseCmd == cmd)
+    {
+        queue->responseP = NULL;
+    }
+    WE_ExitCritical(state);
+}
+
+/**
+ * @brief Adds a received confirmation to the queue and wakes up the function waiting for it.
+ *
+ * Is called from the receive path, which also records the latency of the pending blocking request.
+ * If the confirmation is the expected response, the frame is copied to the registered response buffer.
+ *
+ * @param[in] queue Queue
+ * @param[in] confirmation Confirmation determined by the driver's command handler
+ * @param[in] frame Received frame
+ */
+void CMDFrame_ConfirmationQueue_Add(CMDFrame_ConfirmationQueue_t* queue, const CMDFrame_Confirmation_t* confirmation, const CMDFrame_t* frame)
+{
+    if (confirmation->cmd == CMDFRAME_CNF_INVALID)
+    {
+        return;
+    }
+
+    /* Critical section, so the buffer isn't released (and reused for the next request) during the copy */
+    uint32_t state = WE_EnterCritical();
+    if ((queue->responseP != NULL) && (queue->responseCmd == confirmation->cmd))
+    {
+        size_t frameSize = (size_t)(frame->data - frame->frameP) + frame->length + 1;
+        memcpy(queue->responseP, frame->frameP, (frameSize < queue->responseSize) ? frameSize : queue->responseSize);
+        queue->responseP = NULL;
+    }
+    WE_ExitCritical(state);
+
+    uint32_t head = queue->head;
+    volatile CMDFrame_Confirmation_t* entry = &queue->entries[head % CMDFRAME_CONFIRMATION_QUEUE_LENGTH];
+    if (((head - queue->tail) >= CMDFRAME_CONFIRMATION_QUEUE_LENGTH) && (entry->cmd != CMDFRAME_CNF_INVALID))
+    {
+        /* Queue is full - the oldest confirmation is overwritten before having been evaluated */
+        queue->overflowCount++;
+        WE_STATS_ADD(queue->stats, droppedFrames, 1);
+    }
+    entry->cmd = confirmation->cmd;
+    entry->status = confirmation->status;
+    queue->head = head + 1;
+
+#if defined(WE_STATS_ENABLED)
+    if (queue->requestPending)
+    {
+        WE_STATS_COMPLETE_REQUEST(queue->stats, confirmation->cmd, NULL, queue->requestStartUs);
+    }
+#endif
+
+    WE_SignalEvent(&queue->event);
+}
+
+/**
+ * @brief Removes the oldest confirmation having the command byte cmd from the queue.
+ *
+ * Runs in a critical section, as the receive path overwrites the oldest entry if the queue is full.
+ */
+static bool CMDFrame_ConfirmationQueue_Take(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd, uint8_t* statusP)
+{
+    uint32_t state = WE_EnterCritical();
+
+    uint32_t head = queue->head;
+    uint32_t tail = queue->tail;
+    if ((head - tail) > CMDFRAME_CONFIRMATION_QUEUE_LENGTH)
+    {
+        /* Older entries have been overwritten */
+        tail = head - CMDFRAME_CONFIRMATION_QUEUE_LENGTH;
+    }
+
+    bool found = false;
+    for (uint32_t seq = tail; seq != head; seq++)
+    {
+        volatile CMDFrame_Confirmation_t* entry = &queue->entries[seq % CMDFRAME_CONFIRMATION_QUEUE_LENGTH];
+        if (entry->cmd == cmd)
+        {
+            *statusP = entry->status;
+            entry->cmd = CMDFRAME_CNF_INVALID;
+            found = true;
+            break;
+        }
+    }
+
+    /* Skip entries that have already been evaluated, so they don't count as overflow when overwritten */
+    while ((tail != head) && (queue->entries[tail % CMDFRAME_CONFIRMATION_QUEUE_LENGTH].cmd == CMDFRAME_CNF_INVALID))
+    {
+        tail++;
+    }
+    queue->tail = tail;
+
+    WE_ExitCritical(state);
+
+    return found;
+}
+
+/**
+ * @brief Waits for a confirmation having the command byte cmd and removes it from the queue.
+ *
+ * If a response buffer has been registered for cmd, it contains the confirmation's frame on success.
+ *
+ * @param[in] queue Queue
+ * @param[in] cmd Expected confirmation (command byte)
+ * @param[in] maxTimeMs Max. time to wait for the confirmation
+ * @param[out] statusP Status of the confirmation
+ *
+ * @return True if the confirmation has been received in time, false otherwise
+ */
+bool CMDFrame_ConfirmationQueue_Wait(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd, uint32_t maxTimeMs, uint8_t* statusP)
+{
+    uint32_t t0 = WE_GetTick();
+    while (!CMDFrame_ConfirmationQueue_Take(queue, cmd, statusP))
+    {
+        uint32_t elapsed = WE_GetTick() - t0;
+        if (elapsed >= maxTimeMs)
+        {
+            /* A response received from now on must not overwrite the buffer */
+            CMDFrame_ConfirmationQueue_ReleaseResponse(queue, cmd);
+#if defined(WE_STATS_ENABLED)
+            /* Confirmations received from now on don't belong to the request */
+            queue->requestPending = false;
+            WE_STATS_ADD(queue->stats, timeouts, 1);
+#endif
+            return false;
+        }
+
+        /* wait (returns as soon as a confirmation has been received) */
+        WE_WaitEvent(&queue->event, maxTimeMs - elapsed);
+    }
+    CMDFrame_ConfirmationQueue_ReleaseResponse(queue, cmd);
+    return true;
+}
+
+/**
+ * @brief Selects the requests removed by CMDFrame_AsyncQueue_TakeOldest().
+ */
+typedef enum CMDFrame_AsyncQueue_Match_t
+{
+    CMDFrame_AsyncQueue_Match_Any,      /**< Any request */
+    CMDFrame_AsyncQueue_Match_TimedOut, /**< Request that has timed out */
+    CMDFrame_AsyncQueue_Match_Cnf       /**< Request waiting for a specific confirmation */
+} CMDFrame_AsyncQueue_Match_t;
+
+/**
+ * @brief Removes the oldest pending request if it matches.
+ *
+ * Requests are completed both from the receive path and from thread context (timeouts, abort), so the
+ * request is removed in a critical section. Its callback is to be called after the critical section
+ * has been left, using the copy returned in requestP.
+ *
+ * @return True if a request has been removed, false otherwise
+ */
+static bool CMDFrame_AsyncQueue_TakeOldest(CMDFrame_AsyncQueue_t* queue, CMDFrame_AsyncQueue_Match_t match, uint8_t cnf, CMDFrame_AsyncRequest_t* requestP)
+{
+    bool found = false;
+
+    uint32_t state = WE_EnterCritical();
+    if (queue->head != queue->tail)
+    {
+        CMDFrame_AsyncRequest_t* oldest = &queue->requests[queue->tail % CMDFRAME_ASYNC_QUEUE_LENGTH];
+        switch (match)
+        {
+            case CMDFrame_AsyncQueue_Match_Any:
+                found = true;
+                break;
+            case CMDFrame_AsyncQueue_Match_TimedOut:
+                found = ((WE_GetTick() - oldest->t0) >= oldest->timeoutMs);
+                break;
+            case CMDFrame_AsyncQueue_Match_Cnf:
+                found = (oldest->cnf == cnf);
+                break;
+        }
+        if (found)
+        {
+            *requestP = *oldest;
+            queue->tail++;
+        }
+    }
+    WE_ExitCritical(state);
+
+    return found;
+}
+
+/**
+ * @brief Adds an asynchronous request to the queue.
+ *
+ * Must be called before the request is sent, as the confirmation might be received before the
+ * transmit function returns. Requests that have timed out are completed first.
+ *
+ * @param[in] queue Queue
+ * @param[in] cnf Expected confirmation (command byte)
+ * @param[in] expectedStatus Status of the confirmation in case of success
+ * @param[in] timeoutMs Max. time to wait for the confirmation
+ * @param[in] cb Function called when the request has been completed (may be NULL)
+ *
+ * @return True if the request has been added, false if the queue is full
+ */
+bool CMDFrame_AsyncQueue_Add(CMDFrame_AsyncQueue_t* queue, uint8_t cnf, uint8_t expectedStatus, uint32_t timeoutMs, CMDFrame_AsyncCallback_t cb)
+{
+    CMDFrame_AsyncQueue_CheckTimeouts(queue);
+
+    /* head is only written by the sender, the receive path only increases tail */
+    if ((uint8_t)(queue->head - queue->tail) >= CMDFRAME_ASYNC_QUEUE_LENGTH)
+    {
+        return false;
+    }
+
+    CMDFrame_AsyncRequest_t* request = &queue->requests[queue->head % CMDFRAME_ASYNC_QUEUE_LENGTH];
+    request->cnf = cnf;
+    request->expectedStatus = expectedStatus;
+    request->t0 = WE_GetTick();
+    request->timeoutMs = timeoutMs;
+    request->cb = cb;
+    WE_STATS_START_REQUEST(request->t0Us);
+    queue->head++;
+    return true;
+}
+
+/**
+ * @brief Removes the most recently added request without calling its callback (e.g. if it couldn't be sent).
+ *
+ * @param[in] queue Queue
+ *
+ * @return True if the request has been removed, false if it has already been completed
+ *         (i.e. its callback has already been called)
+ */
+bool CMDFrame_AsyncQueue_Cancel(CMDFrame_AsyncQueue_t* queue)
+{
+    bool removed = false;
+
+    uint32_t state = WE_EnterCritical();
+    if (queue->head != queue->tail)
+    {
+        queue->head--;
+        removed = true;
+    }
+    WE_ExitCritical(state);
+
+    return removed;
+}
+
+/**
+ * @brief Completes the oldest pending request if the received confirmation belongs to it.
+ *
+ * Is called from the receive path for each received confirmation.
+ *
+ * @param[in] queue Queue
+ * @param[in] confirmation Confirmation determined by the driver's command handler
+ * @param[in] frame Received frame (its payload is passed to the request's callback)
+ *
+ * @return True if the confirmation has been consumed by an asynchronous request,
+ *         false if it is to be handled by the driver
+ */
+bool CMDFrame_AsyncQueue_Complete(CMDFrame_AsyncQueue_t* queue, const CMDFrame_Confirmation_t* confirmation, CMDFrame_t* frame)
+{
+    CMDFrame_AsyncQueue_CheckTimeouts(queue);
+
+    CMDFrame_AsyncRequest_t request;
+    if (!CMDFrame_AsyncQueue_TakeOldest(queue, CMDFrame_AsyncQueue_Match_Cnf, confirmation->cmd, &request))
+    {
+        return false;
+    }
+    WE_STATS_COMPLETE_REQUEST(queue->stats, confirmation->cmd, NULL, request.t0Us);
+
+    if (request.cb != NULL)
+    {
+        request.cb(confirmation->status == request.expectedStatus, frame->data, frame->length);
+    }
+    return true;
+}
+
+/**
+ * @brief Completes all pending requests that have timed out (with success = false).
+ *
+ * @param[in] queue Queue
+ */
+void CMDFrame_AsyncQueue_CheckTimeouts(CMDFrame_AsyncQueue_t* queue)
+{
+    CMDFrame_AsyncRequest_t request;
+    while (CMDFrame_AsyncQueue_TakeOldest(queue, CMDFrame_AsyncQueue_Match_TimedOut, 0, &request))
+    {
+        WE_STATS_ADD(queue->stats, timeouts, 1);
+        if (request.cb != NULL)
+        {
+            request.cb(false, NULL, 0);
+        }
+    }
+}
+
+/**
+ * @brief Completes all pending requests with success = false (e.g. if the module has been reset).
+ *
+ * @param[in] queue Queue
+ */
+void CMDFrame_AsyncQueue_Abort(CMDFrame_AsyncQueue_t* queue)
+{
+    CMDFrame_AsyncRequest_t request;
+    while (CMDFrame_AsyncQueue_TakeOldest(queue, CMDFrame_AsyncQueue_Match_Any, 0, &request))
+    {
+        if (request.cb != NULL)
+        {
+            request.cb(false, NULL, 0);
+        }
+    }
+}
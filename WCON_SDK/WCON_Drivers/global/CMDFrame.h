@@ -0,0 +1,278 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Shared handling of the binary command frames used by the radio modules with a
+ * command interface of the form STX | CMD | LENGTH | DATA | CS (XOR checksum).
+ */
+
+#ifndef GLOBAL_CMD_FRAME_H_INCLUDED
+#define GLOBAL_CMD_FRAME_H_INCLUDED
+
+#include <global/global_types.h>
+#include <global/stats.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of entries of a command handler table (one entry per possible command byte).
+ */
+#define CMDFRAME_HANDLER_TABLE_SIZE 256
+
+/**
+ * @brief Received frame (points into the receive buffer the frame has been received in).
+ */
+typedef struct CMDFrame_t
+{
+    uint8_t* frameP; /**< Start of the frame (start byte) */
+    uint8_t cmd;     /**< Command byte */
+    uint16_t length; /**< Length of the payload */
+    uint8_t* data;   /**< Payload */
+} CMDFrame_t;
+
+/**
+ * @brief Confirmation determined by a command handler (see CMDFrame_Handler_t).
+ */
+typedef struct CMDFrame_Confirmation_t
+{
+    uint8_t cmd;    /**< Confirmed command (left unchanged if the frame is not a confirmation) */
+    uint8_t status; /**< Status of the confirmed command */
+} CMDFrame_Confirmation_t;
+
+/**
+ * @brief Handles a received frame with a specific command byte.
+ *
+ * @param[in] context: Context passed to CMDFrame_Dispatch() (e.g. the driver's instance handle)
+ * @param[in] frame: Received frame
+ * @param[out] confirmation: Is set by the handler if the frame confirms a request
+ *
+ * @return None
+ */
+typedef void (*CMDFrame_Handler_t)(void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation);
+
+/**
+ * @brief Is called by the parser for each received frame having a valid checksum.
+ *
+ * The frame is only valid until the function returns.
+ *
+ * @param[in] context: Context passed to CMDFrame_Parser_Init()
+ * @param[in] frame: Received frame
+ *
+ * @return None
+ */
+typedef void (*CMDFrame_FrameCallback_t)(void* context, CMDFrame_t* frame);
+
+/**
+ * @brief State of the parser assembling frames from received bytes (see CMDFrame_Parser_Init()).
+ */
+typedef struct CMDFrame_Parser_t
+{
+    uint8_t stx;                       /**< Start byte of frames */
+    uint8_t lengthFieldSize;           /**< Size of the (little endian) length field in bytes (1 or 2) */
+    uint8_t* buffer;                   /**< Buffer frames are assembled in */
+    uint16_t bufferSize;               /**< Size of buffer (maximum frame size) */
+    uint16_t rxByteCounter;            /**< Number of bytes of the frame being received */
+    uint16_t bytesToReceive;           /**< Size of the frame being received (0 as long as the length field is incomplete) */
+    uint8_t checksum;                  /**< XOR of the bytes of the frame received so far */
+    CMDFrame_FrameCallback_t frameCb;  /**< Called for each received frame */
+    void* context;                     /**< Passed to frameCb */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t* stats; /**< Statistics updated by the parser (NULL if not used) */
+#endif
+} CMDFrame_Parser_t;
+
+/**
+ * @brief Command byte marking an invalid (or already evaluated) confirmation.
+ */
+#define CMDFRAME_CNF_INVALID 0xFF
+
+#ifndef CMDFRAME_CONFIRMATION_QUEUE_LENGTH
+/**
+ * @brief Max. number of received confirmations that can be buffered per driver instance (must be a power of two).
+ */
+#define CMDFRAME_CONFIRMATION_QUEUE_LENGTH 8
+#endif
+
+/**
+ * @brief Confirmations received from the module that haven't been evaluated yet.
+ *
+ * Confirmations are stored in the order they have been received, indexed by a running sequence
+ * number. A function waiting for a confirmation takes the oldest entry having the expected
+ * command byte, so back-to-back confirmations don't overwrite each other. If the queue is full,
+ * the oldest entry is overwritten and counted in overflowCount.
+ *
+ * Only the command byte and status are stored per entry. A request whose confirmation carries
+ * data registers a response buffer before it is sent (see CMDFrame_ConfirmationQueue_ExpectResponse()).
+ * The receive path copies the expected confirmation to that buffer once, so confirmations received
+ * later can't overwrite the data before the waiting function has evaluated it.
+ */
+typedef struct CMDFrame_ConfirmationQueue_t
+{
+    volatile CMDFrame_Confirmation_t entries[CMDFRAME_CONFIRMATION_QUEUE_LENGTH]; /**< Ring buffer of received confirmations */
+    volatile uint32_t head;                                                        /**< Sequence number of the next confirmation (written by the receiver only) */
+    volatile uint32_t tail;                                                        /**< Sequence number of the oldest confirmation not yet discarded (written by the waiting function only) */
+    volatile uint32_t overflowCount;                                               /**< Number of confirmations overwritten before having been evaluated */
+    WE_Event_t event;                                                              /**< Is signaled when a confirmation has been received */
+    uint8_t* volatile responseP;                                                   /**< Buffer the expected response is copied to (NULL if no response is expected) */
+    uint16_t responseSize;                                                         /**< Size of responseP */
+    uint8_t responseCmd;                                                           /**< Command byte of the expected response */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t* stats;            /**< Statistics updated by the queue (NULL if not used) */
+    uint32_t requestStartUs;      /**< Time the pending blocking request has been sent (see CMDFRAME_STATS_START_REQUEST()) */
+    volatile bool requestPending; /**< True if the latency of received confirmations is to be recorded */
+#endif
+} CMDFrame_ConfirmationQueue_t;
+
+#ifndef CMDFRAME_ASYNC_QUEUE_LENGTH
+/**
+ * @brief Max. number of asynchronous requests that may be pending per driver instance (must be a power of two).
+ */
+#define CMDFRAME_ASYNC_QUEUE_LENGTH 4
+#endif
+
+/**
+ * @brief Is called when an asynchronous request has been completed (see CMDFrame_AsyncQueue_t).
+ *
+ * @param[in] success: True if the confirmation has been received with the expected status, false otherwise (e.g. timeout)
+ * @param[in] dataP: Payload of the confirmation (NULL if no confirmation has been received), only valid until the function returns
+ * @param[in] length: Length of the payload
+ *
+ * @return None
+ */
+typedef void (*CMDFrame_AsyncCallback_t)(bool success, uint8_t* dataP, uint16_t length);
+
+/**
+ * @brief Asynchronous request waiting for its confirmation.
+ */
+typedef struct CMDFrame_AsyncRequest_t
+{
+    uint8_t cnf;                 /**< Expected confirmation (command byte) */
+    uint8_t expectedStatus;      /**< Status of the confirmation in case of success */
+    uint32_t t0;                 /**< Time the request has been sent (ms) */
+    uint32_t timeoutMs;          /**< Max. time to wait for the confirmation (ms) */
+    CMDFrame_AsyncCallback_t cb; /**< Is called when the request has been completed */
+#if defined(WE_STATS_ENABLED)
+    uint32_t t0Us; /**< Time the request has been sent (us, latency measurement) */
+#endif
+} CMDFrame_AsyncRequest_t;
+
+/**
+ * @brief Asynchronous requests that have been sent to the module, but not yet confirmed.
+ *
+ * As the module confirms requests in the order they have been sent, a received confirmation
+ * always belongs to the oldest pending request (if its command matches). Confirmations that
+ * don't match are left to the driver's blocking functions.
+ */
+typedef struct CMDFrame_AsyncQueue_t
+{
+    CMDFrame_AsyncRequest_t requests[CMDFRAME_ASYNC_QUEUE_LENGTH]; /**< Ring buffer of pending requests */
+    volatile uint8_t head;                                         /**< Number of requests added (written by the sender only) */
+    volatile uint8_t tail;                                         /**< Number of requests completed (written in a critical section only, see WE_EnterCritical()) */
+#if defined(WE_STATS_ENABLED)
+    WE_Stats_t* stats; /**< Statistics updated by the queue (NULL if not used) */
+#endif
+} CMDFrame_AsyncQueue_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+extern void CMDFrame_Parser_Init(CMDFrame_Parser_t* parser, uint8_t stx, uint8_t lengthFieldSize, uint8_t* buffer, uint16_t bufferSize, CMDFrame_FrameCallback_t frameCb, void* context);
+
+extern void CMDFrame_Parser_Reset(CMDFrame_Parser_t* parser);
+
+extern void CMDFrame_Parser_HandleRxBytes(CMDFrame_Parser_t* parser, uint8_t* dataP, size_t size);
+
+extern uint8_t CMDFrame_Checksum(const uint8_t* dataP, size_t length);
+
+extern void CMDFrame_FillChecksum(uint8_t* frameP, size_t length);
+
+extern void CMDFrame_ConfirmationQueue_Reset(CMDFrame_ConfirmationQueue_t* queue);
+
+extern void CMDFrame_ConfirmationQueue_ExpectResponse(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd, void* responseP, uint16_t responseSize);
+
+extern void CMDFrame_ConfirmationQueue_Add(CMDFrame_ConfirmationQueue_t* queue, const CMDFrame_Confirmation_t* confirmation, const CMDFrame_t* frame);
+
+extern bool CMDFrame_ConfirmationQueue_Wait(CMDFrame_ConfirmationQueue_t* queue, uint8_t cmd, uint32_t maxTimeMs, uint8_t* statusP);
+
+extern bool CMDFrame_AsyncQueue_Add(CMDFrame_AsyncQueue_t* queue, uint8_t cnf, uint8_t expectedStatus, uint32_t timeoutMs, CMDFrame_AsyncCallback_t cb);
+
+extern bool CMDFrame_AsyncQueue_Cancel(CMDFrame_AsyncQueue_t* queue);
+
+extern bool CMDFrame_AsyncQueue_Complete(CMDFrame_AsyncQueue_t* queue, const CMDFrame_Confirmation_t* confirmation, CMDFrame_t* frame);
+
+extern void CMDFrame_AsyncQueue_CheckTimeouts(CMDFrame_AsyncQueue_t* queue);
+
+extern void CMDFrame_AsyncQueue_Abort(CMDFrame_AsyncQueue_t* queue);
+
+/**
+ * @brief Calls the handler registered for the frame's command byte (if any).
+ *
+ * @param[in] handlers: Command handler table (CMDFRAME_HANDLER_TABLE_SIZE entries indexed by command byte, NULL for unhandled commands)
+ * @param[in] context: Passed to the handler
+ * @param[in] frame: Received frame
+ * @param[out] confirmation: Passed to the handler
+ *
+ * @return None
+ */
+static inline void CMDFrame_Dispatch(const CMDFrame_Handler_t* handlers, void* context, CMDFrame_t* frame, CMDFrame_Confirmation_t* confirmation)
+{
+    CMDFrame_Handler_t handler = handlers[frame->cmd];
+    if (handler != NULL)
+    {
+        handler(context, frame, confirmation);
+    }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @cond DOXYGEN_IGNORE */
+#if defined(WE_STATS_ENABLED)
+
+/* Is called when a request is sent whose confirmation is awaited using CMDFrame_ConfirmationQueue_Wait()
+ * (asynchronous requests and pipelined packets keep their send time per request instead) */
+#define CMDFRAME_STATS_START_REQUEST(queue, isRequest)                                                                                                                                                                                                                                                                                                                                                         \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        if (isRequest)                                                                                                                                                                                                                                                                                                                                                                                         \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            WE_STATS_START_REQUEST((queue)->requestStartUs);                                                                                                                                                                                                                                                                                                                                                   \
+            (queue)->requestPending = true;                                                                                                                                                                                                                                                                                                                                                                    \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+#else
+
+#define CMDFRAME_STATS_START_REQUEST(queue, isRequest)
+
+#endif /* WE_STATS_ENABLED */
+/** @endcond */
+
+#endif /* GLOBAL_CMD_FRAME_H_INCLUDED */
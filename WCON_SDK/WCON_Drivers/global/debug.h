@@ -51,6 +51,22 @@
 #if (WE_DEBUG_PRINT_LEVEL > WE_DEBUG_PRINT_LEVEL_OFF)
 /** @endcond*/
 
+#ifdef WE_TRACE_ENABLED
+
+#include "trace.h"
+
+/* Messages are recorded in the binary trace log (formatted on the host, see trace.h) */
+#define WE_DEBUG_PRINT(level, ...)                                                                                                                                                                                                                                                                                                                                                                             \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        if ((level) <= WE_DEBUG_PRINT_LEVEL)                                                                                                                                                                                                                                                                                                                                                                   \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            WE_TRACE_LEVEL(level, __VA_ARGS__);                                                                                                                                                                                                                                                                                                                                                                \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+#else
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -80,6 +96,8 @@ void WE_Debug_Print(unsigned int level, const char* file, const char* func, cons
         }                                                                                                                                                                                                                                                                                                                                                                                                      \
     } while (0)
 
+#endif /* WE_TRACE_ENABLED */
+
 /** @cond DOXYGEN_IGNORE */
 #else
 #define WE_DEBUG_PRINT(level, ...)
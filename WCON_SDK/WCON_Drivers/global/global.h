@@ -183,6 +183,209 @@ extern uint32_t WE_GetTick();
  */
 extern uint32_t WE_GetTickMicroseconds();
 
+/**
+ * @brief Waits until the event has been signaled using WE_SignalEvent() or the timeout has expired.
+ *
+ * Returns as soon as the event is signaled (the event is reset before returning). If WE_UART_RX_DEFERRED
+ * is defined, received data is processed while waiting (see WE_UART_Process()). On bare metal platforms,
+ * the CPU is put to sleep until the next interrupt.
+ *
+ * @param[in] event: Event to wait for
+ * @param[in] timeoutMs: Timeout in milliseconds
+ *
+ * @return True if the event has been signaled, false if the timeout has expired
+ */
+extern bool WE_WaitEvent(WE_Event_t* event, uint32_t timeoutMs);
+
+/**
+ * @brief Signals an event, waking up a function waiting for it in WE_WaitEvent().
+ *
+ * May be called from interrupt context (e.g. the drivers' byte handlers).
+ *
+ * @param[in] event: Event to be signaled
+ */
+extern void WE_SignalEvent(WE_Event_t* event);
+
+/**
+ * @brief Enters a short critical section, in which neither the receive path (interrupt, receive thread
+ * or task) nor other threads can run (e.g. to update state shared with the drivers' byte handlers).
+ *
+ * Critical sections may be nested. No blocking functions or callbacks may be called within a critical section.
+ *
+ * @return State to be passed to WE_ExitCritical()
+ */
+extern uint32_t WE_EnterCritical();
+
+/**
+ * @brief Leaves a critical section entered using WE_EnterCritical().
+ *
+ * @param[in] state: Value returned by WE_EnterCritical()
+ */
+extern void WE_ExitCritical(uint32_t state);
+
+/**
+ * @brief Timeout value for waiting without time limit (see WE_Mutex_Lock(), WE_Semaphore_Take(), WE_Queue_Send()
+ * and WE_Queue_Receive()).
+ */
+#define WE_WAIT_FOREVER 0xFFFFFFFFU
+
+/**
+ * @brief Creates a recursive mutex.
+ *
+ * Note that on bare metal platforms (no RTOS), mutexes don't have any effect.
+ *
+ * @param[out] mutexP: Created mutex
+ *
+ * @return True if the mutex has been created, false otherwise
+ */
+extern bool WE_Mutex_Create(WE_Mutex_t* mutexP);
+
+/**
+ * @brief Deletes a mutex created using WE_Mutex_Create().
+ *
+ * @param[in] mutex: Mutex to be deleted
+ */
+extern void WE_Mutex_Delete(WE_Mutex_t mutex);
+
+/**
+ * @brief Locks a mutex. The mutex may be locked several times by the same thread.
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in] mutex: Mutex to be locked
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the mutex has been locked, false if the timeout has expired
+ */
+extern bool WE_Mutex_Lock(WE_Mutex_t mutex, uint32_t timeoutMs);
+
+/**
+ * @brief Unlocks a mutex locked using WE_Mutex_Lock().
+ *
+ * @param[in] mutex: Mutex to be unlocked
+ */
+extern void WE_Mutex_Unlock(WE_Mutex_t mutex);
+
+/**
+ * @brief Creates a counting semaphore.
+ *
+ * @param[out] semaphoreP: Created semaphore
+ * @param[in] maxCount: Maximum count
+ * @param[in] initialCount: Initial count
+ *
+ * @return True if the semaphore has been created, false otherwise
+ */
+extern bool WE_Semaphore_Create(WE_Semaphore_t* semaphoreP, uint32_t maxCount, uint32_t initialCount);
+
+/**
+ * @brief Deletes a semaphore created using WE_Semaphore_Create().
+ *
+ * @param[in] semaphore: Semaphore to be deleted
+ */
+extern void WE_Semaphore_Delete(WE_Semaphore_t semaphore);
+
+/**
+ * @brief Waits until the semaphore's count is greater than zero and decrements it.
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in] semaphore: Semaphore
+ * @param[in] timeoutMs: Timeout in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the semaphore has been taken, false if the timeout has expired
+ */
+extern bool WE_Semaphore_Take(WE_Semaphore_t semaphore, uint32_t timeoutMs);
+
+/**
+ * @brief Increments the semaphore's count (if the maximum count has not been reached yet).
+ *
+ * May be called from interrupt context.
+ *
+ * @param[in] semaphore: Semaphore
+ */
+extern void WE_Semaphore_Give(WE_Semaphore_t semaphore);
+
+/**
+ * @brief Creates a queue of fixed size items. Items are copied into and out of the queue.
+ *
+ * @param[out] queueP: Created queue
+ * @param[in] itemSize: Size of one item in bytes
+ * @param[in] length: Maximum number of items in the queue
+ *
+ * @return True if the queue has been created, false otherwise
+ */
+extern bool WE_Queue_Create(WE_Queue_t* queueP, size_t itemSize, uint32_t length);
+
+/**
+ * @brief Deletes a queue created using WE_Queue_Create().
+ *
+ * @param[in] queue: Queue to be deleted
+ */
+extern void WE_Queue_Delete(WE_Queue_t queue);
+
+/**
+ * @brief Appends an item to a queue.
+ *
+ * May be called from interrupt context (timeoutMs must be 0 in this case).
+ *
+ * @param[in] queue: Queue
+ * @param[in] itemP: Item to be copied into the queue
+ * @param[in] timeoutMs: Time to wait for free space in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if the item has been added, false if the queue is full
+ */
+extern bool WE_Queue_Send(WE_Queue_t queue, const void* itemP, uint32_t timeoutMs);
+
+/**
+ * @brief Removes the oldest item from a queue.
+ *
+ * Must not be called from interrupt context.
+ *
+ * @param[in] queue: Queue
+ * @param[out] itemP: Buffer the item is copied to
+ * @param[in] timeoutMs: Time to wait for an item in milliseconds (WE_WAIT_FOREVER to wait without time limit)
+ *
+ * @return True if an item has been received, false if the timeout has expired
+ */
+extern bool WE_Queue_Receive(WE_Queue_t queue, void* itemP, uint32_t timeoutMs);
+
+/**
+ * @brief Creates and starts a thread.
+ *
+ * The thread function must not return. On bare metal platforms (no RTOS), no threads can be created
+ * and this function returns false.
+ *
+ * @param[out] threadP: Created thread
+ * @param[in] function: Thread function
+ * @param[in] argument: Argument passed to the thread function
+ * @param[in] name: Name of the thread (for debugging)
+ * @param[in] stackSize: Stack size in bytes (ignored on platforms that manage the stack size themselves)
+ * @param[in] priority: Priority of the thread
+ *
+ * @return True if the thread has been started, false otherwise
+ */
+extern bool WE_Thread_Create(WE_Thread_t* threadP, WE_ThreadFunction_t function, void* argument, const char* name, uint32_t stackSize, WE_ThreadPriority_t priority);
+
+/**
+ * @brief Returns the thread calling this function.
+ *
+ * @return Current thread (NULL on bare metal platforms)
+ */
+extern WE_Thread_t WE_Thread_GetCurrent();
+
+/**
+ * @brief Passes data received via UART to the radio module drivers.
+ *
+ * Note that WE_UART_RX_DEFERRED needs to be defined to enable deferred processing of received data.
+ * In this case, the UART interrupts only store received data in a ring buffer and the drivers'
+ * byte handlers (frame parsing, callbacks) are executed in the context calling this function.
+ * WE_Delay() and WE_DelayMicroseconds() call this function while waiting. If WE_UART_RX_DEFERRED
+ * is not defined, this function does nothing (data is processed in interrupt context).
+ * On an RTOS, WE_UART_RX_DEFERRED is always defined if WE_UART_DMA is used; a thread waiting in
+ * WE_WaitEvent() is woken up and processes the data as soon as it has been received.
+ */
+extern void WE_UART_Process();
+
 #ifdef __cplusplus
 }
 #endif
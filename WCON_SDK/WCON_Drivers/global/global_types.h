@@ -110,6 +110,54 @@ typedef enum WE_Parity_t
     WE_Parity_Even  /**< Even parity */
 } WE_Parity_t;
 
+/**
+ * @brief Event used for waking up a function waiting for a response from the radio module (see WE_WaitEvent() and WE_SignalEvent()).
+ */
+typedef struct WE_Event_t
+{
+    volatile bool signaled; /**< Is set by WE_SignalEvent() and reset by WE_WaitEvent() */
+    void* volatile waiter;  /**< Thread currently waiting for the event (only used if running on an RTOS) */
+} WE_Event_t;
+
+/**
+ * @brief Handle of a recursive mutex (see WE_Mutex_Create()).
+ */
+typedef void* WE_Mutex_t;
+
+/**
+ * @brief Handle of a counting semaphore (see WE_Semaphore_Create()).
+ */
+typedef void* WE_Semaphore_t;
+
+/**
+ * @brief Handle of a queue of fixed size items (see WE_Queue_Create()).
+ */
+typedef void* WE_Queue_t;
+
+/**
+ * @brief Handle of a thread (see WE_Thread_Create()).
+ */
+typedef void* WE_Thread_t;
+
+/**
+ * @brief Thread priority (mapped to the priorities of the underlying operating system).
+ */
+typedef enum WE_ThreadPriority_t
+{
+    WE_ThreadPriority_Low = (uint8_t)0,    /**< Lower than normal priority */
+    WE_ThreadPriority_Normal = (uint8_t)1, /**< Normal priority */
+    WE_ThreadPriority_High = (uint8_t)2    /**< Higher than normal priority (e.g. for threads processing received data) */
+} WE_ThreadPriority_t;
+
+/**
+ * @brief Function executed by a thread created using WE_Thread_Create().
+ *
+ * @param[in] argument: Argument passed to WE_Thread_Create()
+ *
+ * @return None
+ */
+typedef void (*WE_ThreadFunction_t)(void* argument);
+
 /**
  * @brief Handle one or several bytes received via UART.
  *
@@ -149,17 +197,52 @@ typedef bool (*WE_UART_DeInit_t)();
  */
 typedef bool (*WE_UART_Transmit_t)(const uint8_t* dataP, uint16_t length);
 
+/**
+ * @brief Is called when an asynchronous UART transmission has finished.
+ *
+ * @param[in] success: True if all bytes have been handed over to the UART, false in case of a transfer error
+ *
+ * @return None
+ */
+typedef void (*WE_UART_TransmitComplete_t)(bool success);
+
+/**
+ * @brief Start an asynchronous (non-blocking) transmission via UART.
+ *
+ * The function returns as soon as the transfer has been started. The buffer pointed to by dataP
+ * must remain valid and unchanged until completeCb has been called.
+ *
+ * @param[in] dataP: Pointer to buffer of data to be sent via UART
+ * @param[in] length: Number of bytes to be sent
+ * @param[in] completeCb: Function to be called when the transfer has finished (optional, may be NULL)
+ *
+ * @return True in case the transfer has been started, false otherwise (e.g. a transfer is still in progress)
+ */
+typedef bool (*WE_UART_TransmitAsync_t)(const uint8_t* dataP, uint16_t length, WE_UART_TransmitComplete_t completeCb);
+
+/**
+ * @brief Get the receive overflow counters of the UART.
+ *
+ * @param[out] droppedBytesP: Number of received bytes discarded as the receive ring buffer was full
+ * @param[out] dmaOverrunsP: Number of times the receive DMA has overwritten data that hadn't been processed yet
+ *
+ * @return None
+ */
+typedef void (*WE_UART_GetRxOverflowCounts_t)(uint32_t* droppedBytesP, uint32_t* dmaOverrunsP);
+
 /**
  * @brief Used to store pointers to UART functions and configuration.
  */
 typedef struct WE_UART_t
 {
-    WE_UART_Init_t uartInit;         /**< Pointer to UART initialization function */
-    WE_UART_DeInit_t uartDeinit;     /**< Pointer to UART de-initialization function */
-    WE_UART_Transmit_t uartTransmit; /**< Pointer to UART transmit function */
-    uint32_t baudrate;               /**< UART baud rate configuration */
-    WE_FlowControl_t flowControl;    /**< UART flow control setting */
-    WE_Parity_t parity;              /**< UART parity configuration */
+    WE_UART_Init_t uartInit;                               /**< Pointer to UART initialization function */
+    WE_UART_DeInit_t uartDeinit;                           /**< Pointer to UART de-initialization function */
+    WE_UART_Transmit_t uartTransmit;                       /**< Pointer to UART transmit function */
+    uint32_t baudrate;                                     /**< UART baud rate configuration */
+    WE_FlowControl_t flowControl;                          /**< UART flow control setting */
+    WE_Parity_t parity;                                    /**< UART parity configuration */
+    WE_UART_TransmitAsync_t uartTransmitAsync;             /**< Pointer to asynchronous UART transmit function (optional, NULL if not supported) */
+    WE_UART_GetRxOverflowCounts_t uartGetRxOverflowCounts; /**< Pointer to function returning the receive overflow counters (optional, NULL if not supported) */
 } WE_UART_t;
 
 #endif /* GLOBAL_TYPES_H_INCLUDED */
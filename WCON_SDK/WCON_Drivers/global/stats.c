@@ -0,0 +1,178 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file stats.c
+ * @brief Optional performance counters and latency histograms of the radio module drivers.
+ */
+
+#include <global/stats.h>
+#include <string.h>
+
+/**
+ * @brief Returns the histogram bucket of a latency (floor(log2(latencyUs)), 0 for latencies below 2 us).
+ *
+ * @param[in] latencyUs: Latency
+ *
+ * @return Bucket index
+ */
+static uint8_t WE_Stats_GetBucket(uint32_t latencyUs)
+{
+    uint8_t bucket = 0;
+    while ((latencyUs >>= 1) != 0 && bucket < (WE_STATS_HISTOGRAM_BUCKETS - 1))
+    {
+        bucket++;
+    }
+    return bucket;
+}
+
+void WE_Stats_Reset(WE_Stats_t* statsP)
+{
+    if (statsP == NULL)
+    {
+        return;
+    }
+    memset(statsP, 0, sizeof(WE_Stats_t));
+}
+
+bool WE_Stats_Snapshot(const WE_Stats_t* statsP, const WE_UART_t* uartP, WE_Stats_t* snapshotP)
+{
+    if ((statsP == NULL) || (snapshotP == NULL))
+    {
+        return false;
+    }
+    memcpy(snapshotP, statsP, sizeof(WE_Stats_t));
+
+    snapshotP->rxDroppedBytes = 0;
+    snapshotP->rxDmaOverruns = 0;
+    if ((uartP != NULL) && (uartP->uartGetRxOverflowCounts != NULL))
+    {
+        uartP->uartGetRxOverflowCounts(&snapshotP->rxDroppedBytes, &snapshotP->rxDmaOverruns);
+    }
+    return true;
+}
+
+void WE_Stats_RecordLatency(WE_Stats_t* statsP, uint32_t id, const char* name, uint32_t latencyUs)
+{
+    WE_Stats_Histogram_t* histogramP = NULL;
+    for (uint8_t i = 0; i < statsP->commandCount; i++)
+    {
+        if (statsP->latency[i].id == id)
+        {
+            histogramP = &statsP->latency[i];
+            break;
+        }
+    }
+
+    if (histogramP == NULL)
+    {
+        if (statsP->commandCount >= WE_STATS_MAX_COMMANDS)
+        {
+            statsP->untrackedConfirmations++;
+            return;
+        }
+
+        histogramP = &statsP->latency[statsP->commandCount];
+        memset(histogramP, 0, sizeof(WE_Stats_Histogram_t));
+        histogramP->id = id;
+        if (name != NULL)
+        {
+            strncpy(histogramP->name, name, WE_STATS_COMMAND_NAME_LENGTH - 1);
+        }
+        statsP->commandCount++;
+    }
+
+    histogramP->count++;
+    histogramP->buckets[WE_Stats_GetBucket(latencyUs)]++;
+    if (latencyUs > histogramP->maxUs)
+    {
+        histogramP->maxUs = latencyUs;
+    }
+}
+
+const WE_Stats_Histogram_t* WE_Stats_GetHistogram(const WE_Stats_t* statsP, uint32_t id)
+{
+    if (statsP == NULL)
+    {
+        return NULL;
+    }
+    for (uint8_t i = 0; i < statsP->commandCount; i++)
+    {
+        if (statsP->latency[i].id == id)
+        {
+            return &statsP->latency[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t WE_Stats_GetPercentileUs(const WE_Stats_Histogram_t* histogramP, uint8_t percent)
+{
+    if ((histogramP == NULL) || (histogramP->count == 0))
+    {
+        return 0;
+    }
+    if (percent > 100)
+    {
+        percent = 100;
+    }
+
+    /* Number of samples at or below the percentile (at least one) */
+    uint32_t rank = (uint32_t)(((uint64_t)histogramP->count * percent + 99) / 100);
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+
+    uint32_t samples = 0;
+    for (uint8_t bucket = 0; bucket < WE_STATS_HISTOGRAM_BUCKETS - 1; bucket++)
+    {
+        samples += histogramP->buckets[bucket];
+        if (samples >= rank)
+        {
+            /* Upper bound of the bucket, but never more than the max. latency seen */
+            uint32_t upperBoundUs = (1UL << (bucket + 1)) - 1;
+            return (upperBoundUs < histogramP->maxUs) ? upperBoundUs : histogramP->maxUs;
+        }
+    }
+    return histogramP->maxUs;
+}
+
+uint32_t WE_Stats_Hash(const char* name, size_t length)
+{
+    /* FNV-1a of the lower case name (AT command names are case insensitive) */
+    uint32_t hash = 2166136261UL;
+    for (size_t i = 0; i < length && name[i] != '\0'; i++)
+    {
+        char c = name[i];
+        if (c >= 'A' && c <= 'Z')
+        {
+            c = (char)(c - 'A' + 'a');
+        }
+        hash ^= (uint8_t)c;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
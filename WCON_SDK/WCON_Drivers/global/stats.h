@@ -0,0 +1,224 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file stats.h
+ * @brief Optional performance counters and latency histograms of the radio module drivers.
+ *
+ * @details If WE_STATS_ENABLED is defined, each driver instance keeps a WE_Stats_t block counting the bytes
+ * and frames (binary drivers) or lines (AT command drivers) sent and received, receive errors and timeouts,
+ * as well as a log2 histogram of the time between sending a request and receiving its confirmation per
+ * confirmation (command byte or AT command name). The send time is stored per outstanding request (blocking
+ * request, asynchronous request or pipelined packet) and the latency is recorded by the receive path as soon
+ * as the confirmation has been received. A copy can be obtained using the drivers' *_GetStatistics()
+ * functions, which also add the receive overflow counters of the UART. If WE_STATS_ENABLED is not defined,
+ * the counters are not compiled in.
+ */
+
+#ifndef GLOBAL_STATS_H_INCLUDED
+#define GLOBAL_STATS_H_INCLUDED
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <global/global_types.h>
+
+#ifndef WE_STATS_MAX_COMMANDS
+/**
+ * @brief Max. number of different commands a latency histogram is kept for (per driver instance).
+ */
+#define WE_STATS_MAX_COMMANDS 8
+#endif
+
+/**
+ * @brief Number of buckets of a latency histogram.
+ *
+ * Bucket 0 counts latencies below 2 us, bucket i (i > 0) counts latencies in the range [2^i, 2^(i+1)) us,
+ * the last bucket counts all latencies of 2^(WE_STATS_HISTOGRAM_BUCKETS - 1) us (~8.4 s) or more.
+ */
+#define WE_STATS_HISTOGRAM_BUCKETS 24
+
+/**
+ * @brief Max. length of the command name stored with a latency histogram (AT command drivers, including terminating '\0').
+ */
+#define WE_STATS_COMMAND_NAME_LENGTH 16
+
+/**
+ * @brief Request to confirmation latency histogram of one command.
+ */
+typedef struct WE_Stats_Histogram_t
+{
+    uint32_t id;                                  /**< Command ID (confirmation command byte or hash of the AT command name, see WE_Stats_Hash()) */
+    char name[WE_STATS_COMMAND_NAME_LENGTH];      /**< AT command name (empty for binary drivers) */
+    uint32_t count;                               /**< Number of confirmations received */
+    uint32_t maxUs;                               /**< Max. latency in us */
+    uint32_t buckets[WE_STATS_HISTOGRAM_BUCKETS]; /**< Number of confirmations per latency range (see WE_STATS_HISTOGRAM_BUCKETS) */
+} WE_Stats_Histogram_t;
+
+/**
+ * @brief Statistics of a driver instance.
+ *
+ * Counters are updated from the receive context (interrupt, receive task) and the calling thread. Each counter
+ * is consistent by itself, a snapshot taken while data is being transferred might however contain counters
+ * from slightly different points in time.
+ */
+typedef struct WE_Stats_t
+{
+    uint32_t rxBytes;                                    /**< Number of bytes received from the module */
+    uint32_t txBytes;                                    /**< Number of bytes sent to the module */
+    uint32_t rxFrames;                                   /**< Number of frames (binary drivers) or lines (AT command drivers) received */
+    uint32_t txFrames;                                   /**< Number of command frames (binary drivers) or AT commands sent */
+    uint32_t parseErrors;                                /**< Received frames with invalid checksum (binary drivers) or lines exceeding the line buffer (AT command drivers) */
+    uint32_t droppedFrames;                              /**< Received frames exceeding the receive buffer or confirmations that could not be evaluated */
+    uint32_t timeouts;                                   /**< Number of requests whose confirmation hasn't been received in time */
+    uint32_t untrackedConfirmations;                     /**< Confirmations not recorded in a histogram, as all WE_STATS_MAX_COMMANDS histograms are in use */
+    uint32_t rxDroppedBytes;                             /**< Received bytes discarded as a receive buffer or queue was full (only filled in snapshots, not reset by WE_Stats_Reset()) */
+    uint32_t rxDmaOverruns;                              /**< Number of times the UART's DMA has overwritten unprocessed data (only filled in snapshots, not reset by WE_Stats_Reset()) */
+    uint8_t commandCount;                                /**< Number of histograms in use */
+    WE_Stats_Histogram_t latency[WE_STATS_MAX_COMMANDS]; /**< Latency histograms */
+} WE_Stats_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Resets all counters and histograms.
+ *
+ * @param[out] statsP: Statistics
+ */
+extern void WE_Stats_Reset(WE_Stats_t* statsP);
+
+/**
+ * @brief Copies the statistics (e.g. to evaluate or transfer them while the driver keeps updating the original).
+ *
+ * The receive overflow counters are read from the UART (see WE_UART_t::uartGetRxOverflowCounts).
+ *
+ * @param[in] statsP: Statistics
+ * @param[in] uartP: UART used by the driver (may be NULL)
+ * @param[out] snapshotP: Copy of the statistics
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_Stats_Snapshot(const WE_Stats_t* statsP, const WE_UART_t* uartP, WE_Stats_t* snapshotP);
+
+/**
+ * @brief Records the latency of a received confirmation.
+ *
+ * @param[in,out] statsP: Statistics
+ * @param[in] id: Command ID (confirmation command byte or hash of the AT command name)
+ * @param[in] name: AT command name (NULL for binary drivers)
+ * @param[in] latencyUs: Time between sending the request and receiving the confirmation
+ */
+extern void WE_Stats_RecordLatency(WE_Stats_t* statsP, uint32_t id, const char* name, uint32_t latencyUs);
+
+/**
+ * @brief Returns the histogram of a command (NULL if no confirmation has been recorded for this command).
+ *
+ * @param[in] statsP: Statistics
+ * @param[in] id: Command ID (confirmation command byte or hash of the AT command name)
+ *
+ * @return Histogram or NULL
+ */
+extern const WE_Stats_Histogram_t* WE_Stats_GetHistogram(const WE_Stats_t* statsP, uint32_t id);
+
+/**
+ * @brief Estimates a percentile of the latency from a histogram.
+ *
+ * @param[in] histogramP: Histogram
+ * @param[in] percent: Percentile (0-100, e.g. 50 for the median)
+ *
+ * @return Upper bound of the bucket containing the percentile in us (0 if the histogram is empty)
+ */
+extern uint32_t WE_Stats_GetPercentileUs(const WE_Stats_Histogram_t* histogramP, uint8_t percent);
+
+/**
+ * @brief Returns the command ID of an AT command name (case insensitive hash).
+ *
+ * @param[in] name: AT command name
+ * @param[in] length: Length of the name
+ *
+ * @return Command ID
+ */
+extern uint32_t WE_Stats_Hash(const char* name, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @cond DOXYGEN_IGNORE */
+#if defined(WE_STATS_ENABLED)
+
+#include <global/global.h>
+
+/* Adds n to a counter of the statistics statsP (which may be NULL) */
+#define WE_STATS_ADD(statsP, counter, n)                                                                                                                                                                                                                                                                                                                                                                       \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        WE_Stats_t* weStatsP = (statsP);                                                                                                                                                                                                                                                                                                                                                                       \
+        if (weStatsP != NULL)                                                                                                                                                                                                                                                                                                                                                                                  \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            weStatsP->counter += (n);                                                                                                                                                                                                                                                                                                                                                                          \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+/* Is called for data sent to the module (isRequest: data is a command frame or AT command) */
+#define WE_STATS_TRANSMIT(statsP, length, isRequest)                                                                                                                                                                                                                                                                                                                                                           \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        WE_STATS_ADD(statsP, txBytes, length);                                                                                                                                                                                                                                                                                                                                                                 \
+        if (isRequest)                                                                                                                                                                                                                                                                                                                                                                                         \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            WE_STATS_ADD(statsP, txFrames, 1);                                                                                                                                                                                                                                                                                                                                                                 \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+/* Stores the time a request is sent in startUs (a uint32_t kept per outstanding request) */
+#define WE_STATS_START_REQUEST(startUs) ((startUs) = WE_GetTickMicroseconds())
+
+/* Records the latency of a request sent at startUs (is called from the receive path when the confirmation has been received) */
+#define WE_STATS_COMPLETE_REQUEST(statsP, id, name, startUs)                                                                                                                                                                                                                                                                                                                                                   \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        WE_Stats_t* weStatsP = (statsP);                                                                                                                                                                                                                                                                                                                                                                       \
+        if (weStatsP != NULL)                                                                                                                                                                                                                                                                                                                                                                                  \
+        {                                                                                                                                                                                                                                                                                                                                                                                                      \
+            WE_Stats_RecordLatency(weStatsP, (id), (name), WE_GetTickMicroseconds() - (startUs));                                                                                                                                                                                                                                                                                                              \
+        }                                                                                                                                                                                                                                                                                                                                                                                                      \
+    } while (0)
+
+#else
+
+#define WE_STATS_ADD(statsP, counter, n)
+#define WE_STATS_TRANSMIT(statsP, length, isRequest)
+#define WE_STATS_START_REQUEST(startUs)
+#define WE_STATS_COMPLETE_REQUEST(statsP, id, name, startUs)
+
+#endif /* WE_STATS_ENABLED */
+/** @endcond */
+
+#endif /* GLOBAL_STATS_H_INCLUDED */
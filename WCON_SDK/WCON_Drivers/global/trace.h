@@ -0,0 +1,263 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file trace.h
+ * @brief Binary trace log with deferred formatting.
+ *
+ * @details WE_TRACE() stores the address of a constant descriptor (format string, file,
+ * function and level), a microsecond timestamp and the raw argument values in a ring buffer.
+ * String arguments (char pointers) are copied into the record, as the buffers they point to are
+ * usually reused before the trace log is transferred. No formatting takes place on the target:
+ * the records are formatted on the host by Tools/we_trace_decode.py, which looks up the
+ * descriptors in the ELF file of the application. Recording a message thus only takes a few dozen
+ * cycles (plus copying the strings) and does not disturb the timing of the code being traced
+ * (e.g. receive callbacks).
+ *
+ * Define WE_TRACE_ENABLED to enable the trace log. In this case, WE_DEBUG_PRINT_X() output and
+ * WE_APP_PRINT() output (if WE_APP_PRINT_ENABLED is defined) are recorded in the trace log instead
+ * of being printed, so application and driver messages keep their order and timestamps. Call
+ * WE_Trace_Dump() from a non time critical context (e.g. the main loop) to transfer the recorded
+ * messages, or use WE_Trace_Read() to transfer them by other means.
+ *
+ * Restrictions compared to printf():
+ * - at most WE_TRACE_MAX_ARGUMENTS arguments per message,
+ * - the format string must be a string literal,
+ * - strings are truncated to WE_TRACE_MAX_STRING_LENGTH characters.
+ */
+
+#ifndef GLOBAL_TRACE_H_INCLUDED
+#define GLOBAL_TRACE_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Size of the trace ring buffer in 32-bit words (must be a power of two).
+ */
+#ifndef WE_TRACE_BUFFER_WORDS
+#define WE_TRACE_BUFFER_WORDS 1024
+#endif
+
+/**
+ * @brief Maximum number of arguments of a trace message (in addition to the format string).
+ */
+#define WE_TRACE_MAX_ARGUMENTS 16
+
+/**
+ * @brief Maximum number of characters recorded per string argument (longer strings are truncated).
+ */
+#ifndef WE_TRACE_MAX_STRING_LENGTH
+#define WE_TRACE_MAX_STRING_LENGTH 64
+#endif
+
+/**
+ * @brief Maximum number of words used by a string argument (length word and characters).
+ */
+#define WE_TRACE_STRING_WORDS (1 + ((WE_TRACE_MAX_STRING_LENGTH) + sizeof(uint32_t) - 1) / sizeof(uint32_t))
+
+/**
+ * @brief Flag set in the length word of a string argument if the string has been truncated.
+ */
+#define WE_TRACE_STRING_TRUNCATED 0x80000000UL
+
+/**
+ * @brief Prefix of the lines written by WE_Trace_Dump().
+ */
+#define WE_TRACE_DUMP_PREFIX "@WT"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Constant part of a trace message (one per WE_TRACE() statement, never copied to the ring buffer).
+ *
+ * @attention The layout of this struct is evaluated by Tools/we_trace_decode.py.
+ */
+typedef struct WE_Trace_Descriptor_t
+{
+    const char* format;       /**< printf-style format string */
+    const char* file;         /**< Source file */
+    const char* function;     /**< Function */
+    uint8_t level;            /**< Debug print level (see debug.h), 0 for messages without level */
+    uint16_t stringArguments; /**< Bit n is set if argument n is a string copied into the record */
+} WE_Trace_Descriptor_t;
+
+/**
+ * @brief Number of words used by the header of a record (descriptor address, timestamp and number of argument words).
+ */
+#define WE_TRACE_HEADER_WORDS ((sizeof(const WE_Trace_Descriptor_t*) / sizeof(uint32_t)) + 2)
+
+/**
+ * @brief Stores a message in the trace ring buffer.
+ *
+ * Is usually not called directly, see WE_TRACE().
+ *
+ * @param[in] descriptor: Descriptor of the message
+ * @param[in] arguments: Argument words
+ * @param[in] argumentWords: Number of argument words
+ *
+ * @return True if the message has been stored, false if the ring buffer is full (the message is dropped)
+ */
+extern bool WE_Trace_Write(const WE_Trace_Descriptor_t* descriptor, const uint32_t* arguments, uint32_t argumentWords);
+
+/**
+ * @brief Stores a string argument as length word followed by the characters (at most WE_TRACE_MAX_STRING_LENGTH).
+ *
+ * Is usually not called directly, see WE_TRACE().
+ *
+ * @param[out] words: Buffer receiving the string (at least WE_TRACE_STRING_WORDS words)
+ * @param[in] string: String to store (NULL is stored as "(null)")
+ *
+ * @return Number of words used
+ */
+extern uint32_t WE_Trace_PutString(uint32_t* words, const char* string);
+
+/**
+ * @brief Removes complete records from the trace ring buffer.
+ *
+ * Each record consists of WE_TRACE_HEADER_WORDS header words (descriptor address, timestamp, number of
+ * argument words) followed by the argument words. Must not be called concurrently with WE_Trace_Dump().
+ *
+ * @param[out] buffer: Buffer receiving the records
+ * @param[in] maxWords: Size of buffer in words
+ *
+ * @return Number of words copied to buffer
+ */
+extern uint32_t WE_Trace_Read(uint32_t* buffer, uint32_t maxWords);
+
+/**
+ * @brief Writes all recorded messages to stdout as hex encoded lines (to be decoded by Tools/we_trace_decode.py).
+ *
+ * The lines can be mixed with other print output, lines not starting with WE_TRACE_DUMP_PREFIX are passed
+ * through by the decoder. Must not be called concurrently with WE_Trace_Read().
+ */
+extern void WE_Trace_Dump(void);
+
+/**
+ * @brief Returns the number of messages that have been dropped because the ring buffer was full.
+ *
+ * @return Number of dropped messages
+ */
+extern uint32_t WE_Trace_GetDroppedCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @cond DOXYGEN_IGNORE */
+/* Type an argument is stored as (type after default argument promotion) */
+#define WE_TRACE_ARGUMENT_TYPE(x) __typeof__(_Generic((x) + 0, float: 0.0, default: (x) + 0))
+#define WE_TRACE_ARGUMENT_WORDS(x) ((sizeof(WE_TRACE_ARGUMENT_TYPE(x)) + sizeof(uint32_t) - 1) / sizeof(uint32_t))
+
+/* Strings (char pointers) are copied into the record */
+#define WE_TRACE_IS_STRING(x) _Generic((x) + 0, char*: 1, const char*: 1, default: 0)
+#define WE_TRACE_MAX_ARGUMENT_WORDS(x) (WE_TRACE_IS_STRING(x) ? WE_TRACE_STRING_WORDS : WE_TRACE_ARGUMENT_WORDS(x))
+
+#define WE_TRACE_ADD_WORDS(x) +WE_TRACE_MAX_ARGUMENT_WORDS(x)
+#define WE_TRACE_PUT_ARGUMENT(x)                                                                                                                                                                                                                                                                                                                                                                               \
+    if (WE_TRACE_IS_STRING(x))                                                                                                                                                                                                                                                                                                                                                                                 \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        weTraceCursor += WE_Trace_PutString(weTraceCursor, _Generic((x) + 0, char*: (x), const char*: (x), default: (const char*)NULL));                                                                                                                                                                                                                                                                       \
+    }                                                                                                                                                                                                                                                                                                                                                                                                          \
+    else                                                                                                                                                                                                                                                                                                                                                                                                       \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        WE_TRACE_ARGUMENT_TYPE(x) weTraceValue = (x);                                                                                                                                                                                                                                                                                                                                                          \
+        memcpy(weTraceCursor, &weTraceValue, sizeof(weTraceValue));                                                                                                                                                                                                                                                                                                                                            \
+        weTraceCursor += WE_TRACE_ARGUMENT_WORDS(x);                                                                                                                                                                                                                                                                                                                                                           \
+    }
+
+#define WE_TRACE_COUNT(...) WE_TRACE_COUNT_(0, ##__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+#define WE_TRACE_COUNT_(_0, _1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, N, ...) N
+#define WE_TRACE_CONCAT(a, b) WE_TRACE_CONCAT_(a, b)
+#define WE_TRACE_CONCAT_(a, b) a##b
+#define WE_TRACE_FOR_EACH(M, ...) WE_TRACE_CONCAT(WE_TRACE_FOR_EACH_, WE_TRACE_COUNT(__VA_ARGS__))(M, ##__VA_ARGS__)
+#define WE_TRACE_FOR_EACH_0(M)
+#define WE_TRACE_FOR_EACH_1(M, a) M(a)
+#define WE_TRACE_FOR_EACH_2(M, a, ...) M(a) WE_TRACE_FOR_EACH_1(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_3(M, a, ...) M(a) WE_TRACE_FOR_EACH_2(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_4(M, a, ...) M(a) WE_TRACE_FOR_EACH_3(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_5(M, a, ...) M(a) WE_TRACE_FOR_EACH_4(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_6(M, a, ...) M(a) WE_TRACE_FOR_EACH_5(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_7(M, a, ...) M(a) WE_TRACE_FOR_EACH_6(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_8(M, a, ...) M(a) WE_TRACE_FOR_EACH_7(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_9(M, a, ...) M(a) WE_TRACE_FOR_EACH_8(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_10(M, a, ...) M(a) WE_TRACE_FOR_EACH_9(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_11(M, a, ...) M(a) WE_TRACE_FOR_EACH_10(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_12(M, a, ...) M(a) WE_TRACE_FOR_EACH_11(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_13(M, a, ...) M(a) WE_TRACE_FOR_EACH_12(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_14(M, a, ...) M(a) WE_TRACE_FOR_EACH_13(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_15(M, a, ...) M(a) WE_TRACE_FOR_EACH_14(M, __VA_ARGS__)
+#define WE_TRACE_FOR_EACH_16(M, a, ...) M(a) WE_TRACE_FOR_EACH_15(M, __VA_ARGS__)
+
+/* Bit mask of the string arguments (bit 0 = first argument) */
+#define WE_TRACE_STRING_MASK(...) WE_TRACE_CONCAT(WE_TRACE_STRING_MASK_, WE_TRACE_COUNT(__VA_ARGS__))(__VA_ARGS__)
+#define WE_TRACE_STRING_MASK_0() 0
+#define WE_TRACE_STRING_MASK_1(a) WE_TRACE_IS_STRING(a)
+#define WE_TRACE_STRING_MASK_2(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_1(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_3(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_2(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_4(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_3(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_5(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_4(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_6(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_5(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_7(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_6(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_8(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_7(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_9(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_8(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_10(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_9(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_11(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_10(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_12(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_11(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_13(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_12(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_14(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_13(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_15(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_14(__VA_ARGS__) << 1))
+#define WE_TRACE_STRING_MASK_16(a, ...) (WE_TRACE_IS_STRING(a) | (WE_TRACE_STRING_MASK_15(__VA_ARGS__) << 1))
+/** @endcond */
+
+/**
+ * @brief Records a message with the given level in the trace log.
+ *
+ * @param[in] level: Debug print level (see debug.h)
+ * @param[in] format: Format string (printf-style string literal)
+ * @param[in] ...  Up to WE_TRACE_MAX_ARGUMENTS arguments for the format string
+ */
+#define WE_TRACE_LEVEL(level, format, ...)                                                                                                                                                                                                                                                                                                                                                                     \
+    do                                                                                                                                                                                                                                                                                                                                                                                                         \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+        static const WE_Trace_Descriptor_t weTraceDescriptor = {(format), __FILE__, __func__, (level), (WE_TRACE_STRING_MASK(__VA_ARGS__))};                                                                                                                                                                                                                                                                   \
+        uint32_t weTraceArguments[(0 WE_TRACE_FOR_EACH(WE_TRACE_ADD_WORDS, ##__VA_ARGS__)) + 1] = {0};                                                                                                                                                                                                                                                                                                         \
+        uint32_t* weTraceCursor = weTraceArguments;                                                                                                                                                                                                                                                                                                                                                            \
+        WE_TRACE_FOR_EACH(WE_TRACE_PUT_ARGUMENT, ##__VA_ARGS__)                                                                                                                                                                                                                                                                                                                                                \
+        WE_Trace_Write(&weTraceDescriptor, weTraceArguments, (uint32_t)(weTraceCursor - weTraceArguments));                                                                                                                                                                                                                                                                                                    \
+    } while (0)
+
+/**
+ * @brief Records a message without level in the trace log.
+ *
+ * @param[in] ...  Format string (printf-style string literal) and up to WE_TRACE_MAX_ARGUMENTS arguments.
+ */
+#define WE_TRACE(...) WE_TRACE_LEVEL(0, __VA_ARGS__)
+
+#endif /* GLOBAL_TRACE_H_INCLUDED */
@@ -30,6 +30,8 @@
 
 #include "base64.h"
 
+#include <string.h>
+
 /**
  * @brief Base64 encoding table
  */
@@ -37,10 +39,66 @@ static const uint8_t base64EncTable[64] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H
 
 /**
  * @brief Base64 decoding table
+ *
+ * Covers all 256 byte values, so that no range check is needed per character.
+ * Padding ('=') and characters outside the Base64 alphabet decode to 0.
  */
-static const uint8_t base64DecTable[123] = {0, 0, 0, 0, 0, 0, 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, /* 0-9 */
-                                            0, 0, 0, 0, 0, 0, 0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,                                                                                        /* A-Z */
-                                            0, 0, 0, 0, 0, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51};                                                                                           /* a-z */
+static const uint8_t base64DecTable[256] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0x00-0x0F */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0x10-0x1F */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 62,  0,  0,  0, 63, /* 0x20-0x2F */
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61,  0,  0,  0,  0,  0,  0, /* 0x30-0x3F */
+     0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, /* 0x40-0x4F */
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,  0,  0,  0,  0,  0, /* 0x50-0x5F */
+     0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, /* 0x60-0x6F */
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,  0,  0,  0,  0,  0, /* 0x70-0x7F */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0x80-0x8F */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0x90-0x9F */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0xA0-0xAF */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0xB0-0xBF */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0xC0-0xCF */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0xD0-0xDF */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* 0xE0-0xEF */
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0 /* 0xF0-0xFF */
+};
+
+/**
+ * @brief Encodes complete groups of 3 bytes to 4 characters each.
+ *
+ * Each group is assembled in a single 32 bit word, no bounds checks are done in the loop.
+ *
+ * @param[in] inputData Raw data
+ * @param[in] groupCount Number of 3 byte groups to encode
+ * @param[out] outputData Destination buffer, must have room for 4 * groupCount characters
+ */
+static void Base64_EncodeGroups(const uint8_t* inputData, uint32_t groupCount, uint8_t* outputData)
+{
+    for (; groupCount > 0; groupCount--)
+    {
+        uint32_t group = ((uint32_t)inputData[0] << 16) | ((uint32_t)inputData[1] << 8) | inputData[2];
+        uint8_t encoded[4] = {base64EncTable[(group >> 18) & 0x3F], base64EncTable[(group >> 12) & 0x3F], base64EncTable[(group >> 6) & 0x3F], base64EncTable[group & 0x3F]};
+        memcpy(outputData, encoded, sizeof(encoded));
+        inputData += 3;
+        outputData += 4;
+    }
+}
+
+/**
+ * @brief Encodes the final 1 or 2 bytes of the input including padding.
+ *
+ * @param[in] inputData Raw data
+ * @param[in] inputLength Number of bytes (1 or 2)
+ * @param[out] outputData Destination buffer, must have room for 4 characters
+ */
+static void Base64_EncodeTail(const uint8_t* inputData, uint32_t inputLength, uint8_t* outputData)
+{
+    uint32_t group = ((uint32_t)inputData[0] << 16) | ((inputLength > 1) ? ((uint32_t)inputData[1] << 8) : 0);
+
+    outputData[0] = base64EncTable[(group >> 18) & 0x3F];
+    outputData[1] = base64EncTable[(group >> 12) & 0x3F];
+    outputData[2] = (inputLength > 1) ? base64EncTable[(group >> 6) & 0x3F] : '=';
+    outputData[3] = '=';
+}
 
 bool Base64_GetDecBufSize(uint8_t* inputData, uint32_t inputLength, uint32_t* outputLengthP)
 {
@@ -88,49 +146,46 @@ bool Base64_Decode(uint8_t* inputData, uint32_t inputLength, uint8_t* outputData
         return false;
     }
 
-    uint32_t decode_value;
-    uint32_t nibble6_1, nibble6_2, nibble6_3, nibble6_4;
-    uint32_t i, j;
-
     if (inputLength % 4 != 0)
     {
         return false;
     }
 
-    uint32_t decoded_buffer_length;
+    uint32_t decodedLength;
 
-    if (!Base64_GetDecBufSize(inputData, inputLength, &decoded_buffer_length))
+    if (!Base64_GetDecBufSize(inputData, inputLength, &decodedLength))
     {
         return false;
     }
 
-    if (*outputLength < decoded_buffer_length)
+    if (*outputLength < decodedLength)
     {
         return false;
     }
 
-    *outputLength = decoded_buffer_length;
+    *outputLength = decodedLength;
 
-    for (i = 0, j = 0; i < inputLength;)
+    /* All groups but the padded last one decode to 3 bytes, no bounds checks are needed in the loop */
+    const uint8_t* in = inputData;
+    uint8_t* out = outputData;
+    for (uint32_t groupCount = decodedLength / 3; groupCount > 0; groupCount--)
     {
-        nibble6_1 = inputData[i] == '=' ? 0 & i++ : base64DecTable[inputData[i++]];
-        nibble6_2 = inputData[i] == '=' ? 0 & i++ : base64DecTable[inputData[i++]];
-        nibble6_3 = inputData[i] == '=' ? 0 & i++ : base64DecTable[inputData[i++]];
-        nibble6_4 = inputData[i] == '=' ? 0 & i++ : base64DecTable[inputData[i++]];
-
-        decode_value = (nibble6_1 << 3 * 6) + (nibble6_2 << 2 * 6) + (nibble6_3 << 1 * 6) + (nibble6_4 << 0 * 6);
+        uint32_t group = ((uint32_t)base64DecTable[in[0]] << 18) | ((uint32_t)base64DecTable[in[1]] << 12) | ((uint32_t)base64DecTable[in[2]] << 6) | base64DecTable[in[3]];
+        out[0] = (uint8_t)(group >> 16);
+        out[1] = (uint8_t)(group >> 8);
+        out[2] = (uint8_t)group;
+        in += 4;
+        out += 3;
+    }
 
-        if (j < *outputLength)
-        {
-            outputData[j++] = (decode_value >> 2 * 8) & 0xFF;
-        }
-        if (j < *outputLength)
-        {
-            outputData[j++] = (decode_value >> 1 * 8) & 0xFF;
-        }
-        if (j < *outputLength)
+    uint32_t tailLength = decodedLength % 3;
+    if (tailLength > 0)
+    {
+        uint32_t group = ((uint32_t)base64DecTable[in[0]] << 18) | ((uint32_t)base64DecTable[in[1]] << 12) | ((uint32_t)base64DecTable[in[2]] << 6);
+        out[0] = (uint8_t)(group >> 16);
+        if (tailLength > 1)
         {
-            outputData[j++] = (decode_value >> 0 * 8) & 0xFF;
+            out[1] = (uint8_t)(group >> 8);
         }
     }
 
@@ -144,10 +199,6 @@ bool Base64_Encode(uint8_t* inputData, uint32_t inputLength, uint8_t* outputData
         return false;
     }
 
-    uint32_t encodeValue;
-    uint32_t nibble6_1, nibble6_2, nibble6_3;
-    uint32_t i, j;
-
     uint32_t encoded_buffer_length;
 
     if (!Base64_GetEncBufSize(inputLength, &encoded_buffer_length))
@@ -162,27 +213,92 @@ bool Base64_Encode(uint8_t* inputData, uint32_t inputLength, uint8_t* outputData
 
     *outputLength = encoded_buffer_length;
 
-    for (i = 0, j = 0; i < inputLength;)
+    uint32_t groupCount = inputLength / 3;
+    Base64_EncodeGroups(inputData, groupCount, outputData);
+
+    if (inputLength % 3 != 0)
     {
-        nibble6_1 = i < inputLength ? inputData[i++] : 0;
-        nibble6_2 = i < inputLength ? inputData[i++] : 0;
-        nibble6_3 = i < inputLength ? inputData[i++] : 0;
+        Base64_EncodeTail(inputData + 3 * groupCount, inputLength % 3, outputData + 4 * groupCount);
+    }
 
-        encodeValue = (nibble6_1 << 0x10) + (nibble6_2 << 0x08) + nibble6_3;
+    return true;
+}
 
-        outputData[j++] = base64EncTable[(encodeValue >> 3 * 6) & 0x3F];
-        outputData[j++] = base64EncTable[(encodeValue >> 2 * 6) & 0x3F];
-        outputData[j++] = base64EncTable[(encodeValue >> 1 * 6) & 0x3F];
-        outputData[j++] = base64EncTable[(encodeValue >> 0 * 6) & 0x3F];
+void Base64_EncodeInit(Base64_Encoder_t* encoderP)
+{
+    if (encoderP != NULL)
+    {
+        encoderP->pendingLength = 0;
+    }
+}
+
+bool Base64_EncodeUpdate(Base64_Encoder_t* encoderP, const uint8_t* inputData, uint32_t inputLength, uint8_t* outputData, uint32_t* outputLength)
+{
+    if ((encoderP == NULL) || ((inputData == NULL) && (inputLength > 0)) || (outputData == NULL) || (outputLength == NULL))
+    {
+        return false;
+    }
+
+    uint32_t totalLength = encoderP->pendingLength + inputLength;
+    uint32_t encodedLength = 4 * (totalLength / 3);
+
+    if (*outputLength < encodedLength)
+    {
+        return false;
+    }
+
+    *outputLength = encodedLength;
+
+    if (totalLength < 3)
+    {
+        /* Not enough data for a complete group, keep it for the next call */
+        memcpy(&encoderP->pending[encoderP->pendingLength], inputData, inputLength);
+        encoderP->pendingLength = (uint8_t)totalLength;
+        return true;
+    }
+
+    if (encoderP->pendingLength > 0)
+    {
+        /* Complete the group started by the previous call */
+        uint8_t group[3];
+        uint32_t fill = 3 - encoderP->pendingLength;
+        memcpy(group, encoderP->pending, encoderP->pendingLength);
+        memcpy(&group[encoderP->pendingLength], inputData, fill);
+        Base64_EncodeGroups(group, 1, outputData);
+        inputData += fill;
+        inputLength -= fill;
+        outputData += 4;
+    }
+
+    uint32_t groupCount = inputLength / 3;
+    Base64_EncodeGroups(inputData, groupCount, outputData);
+
+    encoderP->pendingLength = (uint8_t)(inputLength % 3);
+    memcpy(encoderP->pending, inputData + 3 * groupCount, encoderP->pendingLength);
+
+    return true;
+}
+
+bool Base64_EncodeFinal(Base64_Encoder_t* encoderP, uint8_t* outputData, uint32_t* outputLength)
+{
+    if ((encoderP == NULL) || (outputData == NULL) || (outputLength == NULL))
+    {
+        return false;
     }
 
-    if (inputLength % 3 >= 1)
+    uint32_t encodedLength = (encoderP->pendingLength > 0) ? 4 : 0;
+
+    if (*outputLength < encodedLength)
     {
-        outputData[*outputLength - 1] = '=';
+        return false;
     }
-    if (inputLength % 3 == 1)
+
+    *outputLength = encodedLength;
+
+    if (encoderP->pendingLength > 0)
     {
-        outputData[*outputLength - 2] = '=';
+        Base64_EncodeTail(encoderP->pending, encoderP->pendingLength, outputData);
+        encoderP->pendingLength = 0;
     }
 
     return true;
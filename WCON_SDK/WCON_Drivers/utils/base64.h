@@ -35,6 +35,18 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+/**
+ * @brief State of an incremental Base64 encoder.
+ *
+ * Allows encoding data that is not available in one piece (e.g. data that is written
+ * to the UART chunk by chunk) without buffering the complete input or output.
+ */
+typedef struct Base64_Encoder_t
+{
+    uint8_t pending[2];    /**< Input bytes that do not yet form a complete 3 byte group */
+    uint8_t pendingLength; /**< Number of bytes in pending */
+} Base64_Encoder_t;
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -104,6 +116,44 @@ extern bool Base64_Decode(uint8_t* inputData, uint32_t inputLength, uint8_t* out
  */
 extern bool Base64_Encode(uint8_t* inputData, uint32_t inputLength, uint8_t* outputData, uint32_t* outputLength);
 
+/**
+ * @brief Initializes an incremental Base64 encoder.
+ *
+ * @param[out] encoderP: Encoder to initialize
+ */
+extern void Base64_EncodeInit(Base64_Encoder_t* encoderP);
+
+/**
+ * @brief Encodes the next piece of raw data.
+ *
+ * Only complete 3 byte groups are encoded, up to 2 remaining bytes are kept in the encoder
+ * and prepended to the data of the next call. Thus, the output of all calls concatenated
+ * equals the output of Base64_Encode() for the concatenated input.
+ * The output is not null-terminated.
+ *
+ * @param[in,out] encoderP: Encoder
+ * @param[in] inputData: Raw data
+ * @param[in] inputLength: Length of the raw data
+ * @param[out] outputData: Destination buffer, @ref Base64_GetEncBufSize(inputLength) is always sufficient
+ * @param[in,out] outputLength: As input it is the size of the buffer allocated for outputData and it will
+ * 				  be updated with the actual output length
+ *
+ * @return True if successful, false otherwise (nothing is consumed in this case)
+ */
+extern bool Base64_EncodeUpdate(Base64_Encoder_t* encoderP, const uint8_t* inputData, uint32_t inputLength, uint8_t* outputData, uint32_t* outputLength);
+
+/**
+ * @brief Encodes the bytes remaining in the encoder including padding.
+ *
+ * @param[in,out] encoderP: Encoder, can be reused for new data afterwards
+ * @param[out] outputData: Destination buffer, 4 characters are sufficient
+ * @param[in,out] outputLength: As input it is the size of the buffer allocated for outputData and it will
+ * 				  be updated with the actual output length (0 or 4)
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool Base64_EncodeFinal(Base64_Encoder_t* encoderP, uint8_t* outputData, uint32_t* outputLength);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,823 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Incremental (pull) JSON reader source file.
+ */
+
+#include "json-reader.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @brief Values of JsonReader_t::state (what is expected next).
+ */
+typedef enum JsonReader_State_t
+{
+    JsonReader_State_Value,       /**< Any value */
+    JsonReader_State_ValueOrEnd,  /**< First element of an array or ']' */
+    JsonReader_State_Key,         /**< Key of the next object member */
+    JsonReader_State_KeyOrEnd,    /**< Key of the first object member or '}' */
+    JsonReader_State_Colon,       /**< ':' following a key */
+    JsonReader_State_CommaOrEnd,  /**< ',' or end of the current object or array */
+    JsonReader_State_Done         /**< Root value is complete */
+} JsonReader_State_t;
+
+/**
+ * @brief Values of JsonReader_t::token (type of the token being parsed).
+ */
+typedef enum JsonReader_Token_t
+{
+    JsonReader_Token_None,
+    JsonReader_Token_Key,
+    JsonReader_Token_String,
+    JsonReader_Token_Number,
+    JsonReader_Token_True,
+    JsonReader_Token_False,
+    JsonReader_Token_Null
+} JsonReader_Token_t;
+
+/**
+ * @brief Values of JsonReader_t::tokenState while parsing strings.
+ *
+ * While parsing a \\u escape sequence, tokenState - JsonReader_Escape_Unicode is the number of hex digits read so far.
+ */
+typedef enum JsonReader_Escape_t
+{
+    JsonReader_Escape_None,
+    JsonReader_Escape_Backslash,
+    JsonReader_Escape_Unicode
+} JsonReader_Escape_t;
+
+/**
+ * @brief Literals, indexed by token - JsonReader_Token_True.
+ */
+static const char* const JsonReader_literals[] = {"true", "false", "null"};
+
+static JsonReader_Status_t JsonReader_Fail(JsonReader_t* readerP);
+static JsonReader_Status_t JsonReader_Emit(JsonReader_t* readerP, JsonReader_Event_t* eventP, JsonReader_EventType_t type, uint8_t depth);
+static JsonReader_Status_t JsonReader_EmitToken(JsonReader_t* readerP, JsonReader_Event_t* eventP, JsonReader_EventType_t type, bool partial);
+static JsonReader_Status_t JsonReader_EndContainer(JsonReader_t* readerP, JsonReader_Event_t* eventP, bool isObject);
+static JsonReader_Status_t JsonReader_BeginContainer(JsonReader_t* readerP, JsonReader_Event_t* eventP, bool isObject);
+static JsonReader_Status_t JsonReader_ContinueString(JsonReader_t* readerP, JsonReader_Event_t* eventP);
+static JsonReader_Status_t JsonReader_ContinueNumber(JsonReader_t* readerP, JsonReader_Event_t* eventP);
+static JsonReader_Status_t JsonReader_ContinueLiteral(JsonReader_t* readerP, JsonReader_Event_t* eventP);
+static bool JsonReader_ParseNumber(const char* text, size_t length, JsonReader_Event_t* eventP);
+static void JsonReader_ValueDone(JsonReader_t* readerP);
+static void JsonReader_AppendCodePoint(JsonReader_t* readerP, uint32_t codePoint);
+static int8_t JsonReader_HexValue(char c);
+
+bool JsonReader_Init(JsonReader_t* readerP, char* tokenBuffer, size_t tokenBufferSize)
+{
+    memset(readerP, 0, sizeof(*readerP));
+    readerP->tokenBuffer = tokenBuffer;
+    readerP->tokenBufferSize = tokenBufferSize;
+
+    if ((NULL == tokenBuffer) || (tokenBufferSize < JSONREADER_MIN_TOKEN_BUFFER_SIZE))
+    {
+        readerP->error = true;
+        return false;
+    }
+    return true;
+}
+
+bool JsonReader_Feed(JsonReader_t* readerP, const char* data, size_t length)
+{
+    if (readerP->error || readerP->finished || (readerP->dataLength > 0) || ((NULL == data) && (length > 0)))
+    {
+        return false;
+    }
+    readerP->data = data;
+    readerP->dataLength = length;
+    return true;
+}
+
+void JsonReader_Finish(JsonReader_t* readerP) { readerP->finished = true; }
+
+JsonReader_Status_t JsonReader_Next(JsonReader_t* readerP, JsonReader_Event_t* eventP)
+{
+    if (readerP->error)
+    {
+        return JsonReader_Status_Error;
+    }
+
+    if (readerP->tokenEmitted)
+    {
+        /* Part of a string has been returned by the previous call */
+        readerP->tokenLength = 0;
+        readerP->tokenEmitted = false;
+    }
+
+    while (true)
+    {
+        if (JsonReader_Token_None != readerP->token)
+        {
+            JsonReader_Status_t status;
+            switch (readerP->token)
+            {
+                case JsonReader_Token_Key:
+                case JsonReader_Token_String:
+                    status = JsonReader_ContinueString(readerP, eventP);
+                    break;
+                case JsonReader_Token_Number:
+                    status = JsonReader_ContinueNumber(readerP, eventP);
+                    break;
+                default:
+                    status = JsonReader_ContinueLiteral(readerP, eventP);
+                    break;
+            }
+            if ((JsonReader_Status_NeedData == status) && readerP->finished)
+            {
+                /* Document ends within a token */
+                return JsonReader_Fail(readerP);
+            }
+            return status;
+        }
+
+        if (0 == readerP->dataLength)
+        {
+            if (!readerP->finished)
+            {
+                return JsonReader_Status_NeedData;
+            }
+            return (JsonReader_State_Done == readerP->state) ? JsonReader_Status_Done : JsonReader_Fail(readerP);
+        }
+
+        char c = *readerP->data;
+        if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'))
+        {
+            readerP->data++;
+            readerP->dataLength--;
+            continue;
+        }
+
+        switch (readerP->state)
+        {
+            case JsonReader_State_ValueOrEnd:
+                if (c == ']')
+                {
+                    return JsonReader_EndContainer(readerP, eventP, false);
+                }
+                /* no break */
+                // fall through
+            case JsonReader_State_Value:
+                switch (c)
+                {
+                    case '{':
+                        return JsonReader_BeginContainer(readerP, eventP, true);
+                    case '[':
+                        return JsonReader_BeginContainer(readerP, eventP, false);
+                    case '"':
+                        readerP->data++;
+                        readerP->dataLength--;
+                        readerP->token = JsonReader_Token_String;
+                        break;
+                    case 't':
+                        readerP->token = JsonReader_Token_True;
+                        break;
+                    case 'f':
+                        readerP->token = JsonReader_Token_False;
+                        break;
+                    case 'n':
+                        readerP->token = JsonReader_Token_Null;
+                        break;
+                    default:
+                        if ((c != '-') && ((c < '0') || (c > '9')))
+                        {
+                            return JsonReader_Fail(readerP);
+                        }
+                        readerP->token = JsonReader_Token_Number;
+                        break;
+                }
+                readerP->tokenLength = 0;
+                readerP->tokenState = 0;
+                readerP->highSurrogate = 0;
+                break;
+
+            case JsonReader_State_KeyOrEnd:
+                if (c == '}')
+                {
+                    return JsonReader_EndContainer(readerP, eventP, true);
+                }
+                /* no break */
+                // fall through
+            case JsonReader_State_Key:
+                if (c != '"')
+                {
+                    return JsonReader_Fail(readerP);
+                }
+                readerP->data++;
+                readerP->dataLength--;
+                readerP->token = JsonReader_Token_Key;
+                readerP->tokenLength = 0;
+                readerP->tokenState = JsonReader_Escape_None;
+                readerP->highSurrogate = 0;
+                break;
+
+            case JsonReader_State_Colon:
+                if (c != ':')
+                {
+                    return JsonReader_Fail(readerP);
+                }
+                readerP->data++;
+                readerP->dataLength--;
+                readerP->state = JsonReader_State_Value;
+                break;
+
+            case JsonReader_State_CommaOrEnd:
+                if (c == '}')
+                {
+                    return JsonReader_EndContainer(readerP, eventP, true);
+                }
+                if (c == ']')
+                {
+                    return JsonReader_EndContainer(readerP, eventP, false);
+                }
+                if (c != ',')
+                {
+                    return JsonReader_Fail(readerP);
+                }
+                readerP->data++;
+                readerP->dataLength--;
+                readerP->state = (0 != (readerP->objectMask & ((uint32_t)1 << readerP->depth))) ? JsonReader_State_Key : JsonReader_State_Value;
+                break;
+
+            default:
+                /* Trailing garbage */
+                return JsonReader_Fail(readerP);
+        }
+    }
+}
+
+/**
+ * @brief Marks the reader as failed.
+ *
+ * @param[in,out] readerP Reader
+ *
+ * @return JsonReader_Status_Error
+ */
+static JsonReader_Status_t JsonReader_Fail(JsonReader_t* readerP)
+{
+    readerP->error = true;
+    return JsonReader_Status_Error;
+}
+
+/**
+ * @brief Fills in an event without text.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ * @param[in] type Type of the event
+ * @param[in] depth Nesting depth of the event
+ *
+ * @return JsonReader_Status_Event
+ */
+static JsonReader_Status_t JsonReader_Emit(JsonReader_t* readerP, JsonReader_Event_t* eventP, JsonReader_EventType_t type, uint8_t depth)
+{
+    (void)readerP;
+    memset(eventP, 0, sizeof(*eventP));
+    eventP->type = type;
+    eventP->depth = depth;
+    return JsonReader_Status_Event;
+}
+
+/**
+ * @brief Fills in an event containing the token buffer.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ * @param[in] type Type of the event
+ * @param[in] partial true if this is only a part of a string
+ *
+ * @return JsonReader_Status_Event
+ */
+static JsonReader_Status_t JsonReader_EmitToken(JsonReader_t* readerP, JsonReader_Event_t* eventP, JsonReader_EventType_t type, bool partial)
+{
+    JsonReader_Emit(readerP, eventP, type, readerP->depth);
+    readerP->tokenBuffer[readerP->tokenLength] = '\0';
+    eventP->text = readerP->tokenBuffer;
+    eventP->length = readerP->tokenLength;
+    eventP->partial = partial;
+    if (partial)
+    {
+        readerP->tokenEmitted = true;
+    }
+    else
+    {
+        readerP->token = JsonReader_Token_None;
+    }
+    return JsonReader_Status_Event;
+}
+
+/**
+ * @brief Starts an object or array.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ * @param[in] isObject true for objects, false for arrays
+ *
+ * @return Status
+ */
+static JsonReader_Status_t JsonReader_BeginContainer(JsonReader_t* readerP, JsonReader_Event_t* eventP, bool isObject)
+{
+    if (readerP->depth >= JSONREADER_MAX_DEPTH)
+    {
+        return JsonReader_Fail(readerP);
+    }
+
+    readerP->data++;
+    readerP->dataLength--;
+    JsonReader_Emit(readerP, eventP, isObject ? JsonReader_EventType_BeginObject : JsonReader_EventType_BeginArray, readerP->depth);
+
+    readerP->depth++;
+    uint32_t bit = (uint32_t)1 << readerP->depth;
+    if (isObject)
+    {
+        readerP->objectMask |= bit;
+        readerP->state = JsonReader_State_KeyOrEnd;
+    }
+    else
+    {
+        readerP->objectMask &= ~bit;
+        readerP->state = JsonReader_State_ValueOrEnd;
+    }
+    return JsonReader_Status_Event;
+}
+
+/**
+ * @brief Ends the current object or array.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ * @param[in] isObject true for objects, false for arrays
+ *
+ * @return Status
+ */
+static JsonReader_Status_t JsonReader_EndContainer(JsonReader_t* readerP, JsonReader_Event_t* eventP, bool isObject)
+{
+    if ((0 == readerP->depth) || (isObject != (0 != (readerP->objectMask & ((uint32_t)1 << readerP->depth)))))
+    {
+        return JsonReader_Fail(readerP);
+    }
+
+    readerP->data++;
+    readerP->dataLength--;
+    readerP->depth--;
+    JsonReader_ValueDone(readerP);
+    return JsonReader_Emit(readerP, eventP, isObject ? JsonReader_EventType_EndObject : JsonReader_EventType_EndArray, readerP->depth);
+}
+
+/**
+ * @brief Continues parsing a key or string.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ *
+ * @return Status
+ */
+static JsonReader_Status_t JsonReader_ContinueString(JsonReader_t* readerP, JsonReader_Event_t* eventP)
+{
+    bool isKey = (JsonReader_Token_Key == readerP->token);
+
+    while (readerP->dataLength > 0)
+    {
+        char c = *readerP->data;
+
+        /* Space required in the token buffer by this character (including the terminator) */
+        size_t needed = 0;
+        if (JsonReader_Escape_None == readerP->tokenState)
+        {
+            needed = ((c == '"') || (c == '\\')) ? 0 : 2;
+        }
+        else if (JsonReader_Escape_Backslash == readerP->tokenState)
+        {
+            needed = (c == 'u') ? 0 : 2;
+        }
+        else if ((JsonReader_Escape_Unicode + 3) == readerP->tokenState)
+        {
+            /* Last hex digit, up to 4 bytes UTF-8 */
+            needed = 5;
+        }
+
+        if ((readerP->tokenLength + needed) > readerP->tokenBufferSize)
+        {
+            if (isKey)
+            {
+                return JsonReader_Fail(readerP);
+            }
+            return JsonReader_EmitToken(readerP, eventP, JsonReader_EventType_String, true);
+        }
+
+        if (JsonReader_Escape_None == readerP->tokenState)
+        {
+            if ((c == '"') || (c == '\\'))
+            {
+                /* A high surrogate must be followed by an escaped low surrogate */
+                if ((c == '"') && (0 != readerP->highSurrogate))
+                {
+                    return JsonReader_Fail(readerP);
+                }
+                readerP->data++;
+                readerP->dataLength--;
+                if (c == '\\')
+                {
+                    readerP->tokenState = JsonReader_Escape_Backslash;
+                    continue;
+                }
+                if (isKey)
+                {
+                    readerP->state = JsonReader_State_Colon;
+                    return JsonReader_EmitToken(readerP, eventP, JsonReader_EventType_Key, false);
+                }
+                JsonReader_ValueDone(readerP);
+                return JsonReader_EmitToken(readerP, eventP, JsonReader_EventType_String, false);
+            }
+
+            if (0 != readerP->highSurrogate)
+            {
+                return JsonReader_Fail(readerP);
+            }
+
+            /* Copy a run of plain characters at once */
+            size_t space = readerP->tokenBufferSize - 1 - readerP->tokenLength;
+            size_t count = 0;
+            while ((count < readerP->dataLength) && (count < space))
+            {
+                c = readerP->data[count];
+                if ((c == '"') || (c == '\\') || ((unsigned char)c < 0x20))
+                {
+                    break;
+                }
+                count++;
+            }
+            if (0 == count)
+            {
+                /* Unescaped control character */
+                return JsonReader_Fail(readerP);
+            }
+            memcpy(readerP->tokenBuffer + readerP->tokenLength, readerP->data, count);
+            readerP->tokenLength += count;
+            readerP->data += count;
+            readerP->dataLength -= count;
+            continue;
+        }
+
+        readerP->data++;
+        readerP->dataLength--;
+
+        if (JsonReader_Escape_Backslash == readerP->tokenState)
+        {
+            if ((0 != readerP->highSurrogate) && (c != 'u'))
+            {
+                return JsonReader_Fail(readerP);
+            }
+
+            readerP->tokenState = JsonReader_Escape_None;
+            switch (c)
+            {
+                case '"':
+                case '\\':
+                case '/':
+                    break;
+                case 'b':
+                    c = '\b';
+                    break;
+                case 'f':
+                    c = '\f';
+                    break;
+                case 'n':
+                    c = '\n';
+                    break;
+                case 'r':
+                    c = '\r';
+                    break;
+                case 't':
+                    c = '\t';
+                    break;
+                case 'u':
+                    readerP->tokenState = JsonReader_Escape_Unicode;
+                    readerP->codeUnit = 0;
+                    continue;
+                default:
+                    return JsonReader_Fail(readerP);
+            }
+            readerP->tokenBuffer[readerP->tokenLength++] = c;
+            continue;
+        }
+
+        /* \u escape sequence */
+        int8_t value = JsonReader_HexValue(c);
+        if (value < 0)
+        {
+            return JsonReader_Fail(readerP);
+        }
+        readerP->codeUnit = (uint16_t)((readerP->codeUnit << 4) | (uint16_t)value);
+        if (++readerP->tokenState < (JsonReader_Escape_Unicode + 4))
+        {
+            continue;
+        }
+        readerP->tokenState = JsonReader_Escape_None;
+
+        uint16_t codeUnit = readerP->codeUnit;
+        if (0 != readerP->highSurrogate)
+        {
+            if ((codeUnit & 0xFC00) != 0xDC00)
+            {
+                return JsonReader_Fail(readerP);
+            }
+            JsonReader_AppendCodePoint(readerP, 0x10000 + (((uint32_t)(readerP->highSurrogate & 0x3FF)) << 10) + (codeUnit & 0x3FF));
+            readerP->highSurrogate = 0;
+        }
+        else if ((codeUnit & 0xFC00) == 0xD800)
+        {
+            readerP->highSurrogate = codeUnit;
+        }
+        else if ((codeUnit & 0xFC00) == 0xDC00)
+        {
+            return JsonReader_Fail(readerP);
+        }
+        else
+        {
+            JsonReader_AppendCodePoint(readerP, codeUnit);
+        }
+    }
+
+    return JsonReader_Status_NeedData;
+}
+
+/**
+ * @brief Continues parsing a number.
+ *
+ * The end of a number is only known when the next character (or the end of the document) is reached.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ *
+ * @return Status
+ */
+static JsonReader_Status_t JsonReader_ContinueNumber(JsonReader_t* readerP, JsonReader_Event_t* eventP)
+{
+    while (readerP->dataLength > 0)
+    {
+        char c = *readerP->data;
+        if (!(((c >= '0') && (c <= '9')) || (c == '-') || (c == '+') || (c == '.') || (c == 'e') || (c == 'E')))
+        {
+            break;
+        }
+        if ((readerP->tokenLength + 2) > readerP->tokenBufferSize)
+        {
+            return JsonReader_Fail(readerP);
+        }
+        readerP->tokenBuffer[readerP->tokenLength++] = c;
+        readerP->data++;
+        readerP->dataLength--;
+    }
+
+    if ((0 == readerP->dataLength) && !readerP->finished)
+    {
+        return JsonReader_Status_NeedData;
+    }
+
+    JsonReader_EmitToken(readerP, eventP, JsonReader_EventType_Number, false);
+    if (!JsonReader_ParseNumber(readerP->tokenBuffer, readerP->tokenLength, eventP))
+    {
+        return JsonReader_Fail(readerP);
+    }
+    JsonReader_ValueDone(readerP);
+    return JsonReader_Status_Event;
+}
+
+/**
+ * @brief Continues parsing true, false or null.
+ *
+ * @param[in,out] readerP Reader
+ * @param[out] eventP Event
+ *
+ * @return Status
+ */
+static JsonReader_Status_t JsonReader_ContinueLiteral(JsonReader_t* readerP, JsonReader_Event_t* eventP)
+{
+    const char* literal = JsonReader_literals[readerP->token - JsonReader_Token_True];
+
+    while (readerP->dataLength > 0)
+    {
+        if (*readerP->data != literal[readerP->tokenState])
+        {
+            return JsonReader_Fail(readerP);
+        }
+        readerP->data++;
+        readerP->dataLength--;
+
+        if ('\0' == literal[++readerP->tokenState])
+        {
+            JsonReader_Token_t token = (JsonReader_Token_t)readerP->token;
+            readerP->token = JsonReader_Token_None;
+            JsonReader_ValueDone(readerP);
+            if (JsonReader_Token_Null == token)
+            {
+                return JsonReader_Emit(readerP, eventP, JsonReader_EventType_Null, readerP->depth);
+            }
+            JsonReader_Emit(readerP, eventP, JsonReader_EventType_Boolean, readerP->depth);
+            eventP->boolean = (JsonReader_Token_True == token);
+            return JsonReader_Status_Event;
+        }
+    }
+
+    return JsonReader_Status_NeedData;
+}
+
+/**
+ * @brief Checks the syntax of a number and converts it.
+ *
+ * @param[in] text Number text (null terminated)
+ * @param[in] length Length of the number text
+ * @param[out] eventP Event receiving the value
+ *
+ * @return true if the number is valid, false otherwise
+ */
+static bool JsonReader_ParseNumber(const char* text, size_t length, JsonReader_Event_t* eventP)
+{
+    size_t i = 0;
+    bool negative = false;
+    bool isInteger = true;
+
+    if ((i < length) && (text[i] == '-'))
+    {
+        negative = true;
+        i++;
+    }
+
+    /* Integer part without leading zeros */
+    if ((i < length) && (text[i] == '0'))
+    {
+        i++;
+    }
+    else if ((i < length) && (text[i] >= '1') && (text[i] <= '9'))
+    {
+        while ((i < length) && (text[i] >= '0') && (text[i] <= '9'))
+        {
+            i++;
+        }
+    }
+    else
+    {
+        return false;
+    }
+    size_t integerEnd = i;
+
+    if ((i < length) && (text[i] == '.'))
+    {
+        isInteger = false;
+        i++;
+        if (!((i < length) && (text[i] >= '0') && (text[i] <= '9')))
+        {
+            return false;
+        }
+        while ((i < length) && (text[i] >= '0') && (text[i] <= '9'))
+        {
+            i++;
+        }
+    }
+
+    if ((i < length) && ((text[i] == 'e') || (text[i] == 'E')))
+    {
+        isInteger = false;
+        i++;
+        if ((i < length) && ((text[i] == '+') || (text[i] == '-')))
+        {
+            i++;
+        }
+        if (!((i < length) && (text[i] >= '0') && (text[i] <= '9')))
+        {
+            return false;
+        }
+        while ((i < length) && (text[i] >= '0') && (text[i] <= '9'))
+        {
+            i++;
+        }
+    }
+
+    if (i != length)
+    {
+        return false;
+    }
+
+    eventP->number = strtod(text, NULL);
+
+    if (isInteger)
+    {
+        /* Accumulate the magnitude, INT64_MIN has no positive counterpart */
+        uint64_t limit = negative ? ((uint64_t)INT64_MAX + 1) : (uint64_t)INT64_MAX;
+        uint64_t magnitude = 0;
+        for (i = negative ? 1 : 0; i < integerEnd; i++)
+        {
+            uint8_t digit = (uint8_t)(text[i] - '0');
+            if (magnitude > ((limit - digit) / 10))
+            {
+                isInteger = false;
+                break;
+            }
+            magnitude = (magnitude * 10) + digit;
+        }
+        if (isInteger)
+        {
+            eventP->integer = negative ? (int64_t)((uint64_t)0 - magnitude) : (int64_t)magnitude;
+        }
+    }
+    eventP->isInteger = isInteger;
+
+    return true;
+}
+
+/**
+ * @brief Updates the state after a complete value has been parsed.
+ *
+ * @param[in,out] readerP Reader
+ */
+static void JsonReader_ValueDone(JsonReader_t* readerP) { readerP->state = (0 == readerP->depth) ? JsonReader_State_Done : JsonReader_State_CommaOrEnd; }
+
+/**
+ * @brief Appends a code point to the token buffer as UTF-8 (space has been checked by the caller).
+ *
+ * @param[in,out] readerP Reader
+ * @param[in] codePoint Code point
+ */
+static void JsonReader_AppendCodePoint(JsonReader_t* readerP, uint32_t codePoint)
+{
+    char* out = readerP->tokenBuffer + readerP->tokenLength;
+
+    if (codePoint < 0x80)
+    {
+        out[0] = (char)codePoint;
+        readerP->tokenLength += 1;
+    }
+    else if (codePoint < 0x800)
+    {
+        out[0] = (char)(0xC0 | (codePoint >> 6));
+        out[1] = (char)(0x80 | (codePoint & 0x3F));
+        readerP->tokenLength += 2;
+    }
+    else if (codePoint < 0x10000)
+    {
+        out[0] = (char)(0xE0 | (codePoint >> 12));
+        out[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (codePoint & 0x3F));
+        readerP->tokenLength += 3;
+    }
+    else
+    {
+        out[0] = (char)(0xF0 | (codePoint >> 18));
+        out[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (codePoint & 0x3F));
+        readerP->tokenLength += 4;
+    }
+}
+
+/**
+ * @brief Returns the value of a hex digit.
+ *
+ * @param[in] c Character
+ *
+ * @return Value of the digit, -1 if the character is not a hex digit
+ */
+static int8_t JsonReader_HexValue(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return (int8_t)(c - '0');
+    }
+    if ((c >= 'a') && (c <= 'f'))
+    {
+        return (int8_t)(c - 'a' + 10);
+    }
+    if ((c >= 'A') && (c <= 'F'))
+    {
+        return (int8_t)(c - 'A' + 10);
+    }
+    return -1;
+}
@@ -0,0 +1,176 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file json-reader.h
+ * @brief Incremental (pull) JSON reader header file.
+ *
+ * Parses a JSON document that is supplied in chunks of arbitrary size (e.g. HTTP
+ * response body chunks or MQTT payloads) and reports its contents as a sequence of
+ * events (begin/end of objects and arrays, keys and values). Memory usage is constant:
+ * besides the reader state, only a caller-supplied token buffer holding the current key,
+ * string or number is used. Strings longer than the token buffer are reported in pieces.
+ *
+ * Usage: Supply a chunk using JsonReader_Feed(), then call JsonReader_Next() until it
+ * returns JsonReader_Status_NeedData, supply the next chunk and so on. After the last
+ * chunk, call JsonReader_Finish() and continue calling JsonReader_Next() until it returns
+ * JsonReader_Status_Done (or JsonReader_Status_Error).
+ */
+
+#ifndef JSON_READER_H_INCLUDED
+#define JSON_READER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Max. nesting depth of objects and arrays.
+ */
+#define JSONREADER_MAX_DEPTH 31
+
+/**
+ * @brief Min. size of the token buffer.
+ */
+#define JSONREADER_MIN_TOKEN_BUFFER_SIZE 8
+
+/**
+ * @brief Result of JsonReader_Next().
+ */
+typedef enum JsonReader_Status_t
+{
+    JsonReader_Status_Event,    /**< An event has been returned */
+    JsonReader_Status_NeedData, /**< The current chunk has been consumed, supply the next chunk or call JsonReader_Finish() */
+    JsonReader_Status_Done,     /**< The document is complete */
+    JsonReader_Status_Error     /**< Syntax error, or token too long for the token buffer */
+} JsonReader_Status_t;
+
+/**
+ * @brief Types of events.
+ */
+typedef enum JsonReader_EventType_t
+{
+    JsonReader_EventType_BeginObject,
+    JsonReader_EventType_EndObject,
+    JsonReader_EventType_BeginArray,
+    JsonReader_EventType_EndArray,
+    JsonReader_EventType_Key,     /**< Key of an object member, the member's value follows */
+    JsonReader_EventType_String,  /**< String value (possibly in several pieces, see JsonReader_Event_t::partial) */
+    JsonReader_EventType_Number,  /**< Number value */
+    JsonReader_EventType_Boolean, /**< true or false */
+    JsonReader_EventType_Null     /**< null */
+} JsonReader_EventType_t;
+
+/**
+ * @brief Event returned by JsonReader_Next().
+ *
+ * The text is stored in the reader's token buffer and is valid until the next call of JsonReader_Next().
+ */
+typedef struct JsonReader_Event_t
+{
+    JsonReader_EventType_t type; /**< Type of the event */
+    uint8_t depth;               /**< Nesting depth of the value (0: root value, 1: members of the root object or array, ...) */
+    const char* text;            /**< Decoded key, string or number text (null terminated), NULL for other events */
+    size_t length;               /**< Length of the text */
+    bool partial;                /**< String value continues in the next event */
+    bool boolean;                /**< Value of boolean events */
+    bool isInteger;              /**< Number is an integer that fits into integer */
+    int64_t integer;             /**< Value of integer numbers */
+    double number;               /**< Value of numbers */
+} JsonReader_Event_t;
+
+/**
+ * @brief State of a JSON reader.
+ */
+typedef struct JsonReader_t
+{
+    char* tokenBuffer;      /**< Buffer holding the current key, string or number */
+    size_t tokenBufferSize; /**< Size of the token buffer */
+    size_t tokenLength;     /**< Number of characters in the token buffer */
+    const char* data;       /**< Remaining data of the current chunk */
+    size_t dataLength;      /**< Number of remaining characters of the current chunk */
+    uint32_t objectMask;    /**< Bit n is set if the container at depth n is an object */
+    uint16_t codeUnit;      /**< Code unit of the \u escape sequence being parsed */
+    uint16_t highSurrogate; /**< Pending high surrogate of a surrogate pair */
+    uint8_t depth;          /**< Current nesting depth */
+    uint8_t state;          /**< What is expected next */
+    uint8_t token;          /**< Type of the token being parsed */
+    uint8_t tokenState;     /**< Escape state (strings) or number of matched characters (literals) */
+    bool tokenEmitted;      /**< The token buffer has been returned as partial string and has to be cleared */
+    bool finished;          /**< JsonReader_Finish() has been called */
+    bool error;             /**< An error has occurred */
+} JsonReader_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Initializes a reader.
+ *
+ * @param[out] readerP: Reader
+ * @param[in] tokenBuffer: Buffer for keys, strings and numbers. Keys and numbers must fit into the buffer (including a null terminator).
+ * @param[in] tokenBufferSize: Size of the token buffer, at least JSONREADER_MIN_TOKEN_BUFFER_SIZE
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonReader_Init(JsonReader_t* readerP, char* tokenBuffer, size_t tokenBufferSize);
+
+/**
+ * @brief Supplies the next chunk of the document.
+ *
+ * The chunk is not copied, it has to remain valid until JsonReader_Next() returns JsonReader_Status_NeedData.
+ *
+ * @param[in,out] readerP: Reader
+ * @param[in] data: Chunk
+ * @param[in] length: Length of the chunk
+ *
+ * @return True if successful, false if the previous chunk has not been consumed yet or JsonReader_Finish() has been called
+ */
+extern bool JsonReader_Feed(JsonReader_t* readerP, const char* data, size_t length);
+
+/**
+ * @brief Signals that the complete document has been supplied.
+ *
+ * @param[in,out] readerP: Reader
+ */
+extern void JsonReader_Finish(JsonReader_t* readerP);
+
+/**
+ * @brief Parses the supplied data until the next event.
+ *
+ * @param[in,out] readerP: Reader
+ * @param[out] eventP: Event (valid if JsonReader_Status_Event is returned)
+ *
+ * @return Status
+ */
+extern JsonReader_Status_t JsonReader_Next(JsonReader_t* readerP, JsonReader_Event_t* eventP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSON_READER_H_INCLUDED */
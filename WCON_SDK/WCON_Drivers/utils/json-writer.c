@@ -0,0 +1,411 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Streaming JSON writer source file.
+ */
+
+#include "json-writer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static bool JsonWriter_Fail(JsonWriter_t* writerP);
+static bool JsonWriter_Put(JsonWriter_t* writerP, const char* data, size_t length);
+static bool JsonWriter_PutEscaped(JsonWriter_t* writerP, const char* data, size_t length);
+static bool JsonWriter_BeginValue(JsonWriter_t* writerP);
+static bool JsonWriter_BeginContainer(JsonWriter_t* writerP, bool isObject, char open);
+static bool JsonWriter_EndContainer(JsonWriter_t* writerP, bool isObject, char close);
+
+void JsonWriter_Init(JsonWriter_t* writerP, char* buffer, size_t size) { JsonWriter_InitStream(writerP, buffer, size, NULL, NULL); }
+
+void JsonWriter_InitStream(JsonWriter_t* writerP, char* buffer, size_t size, JsonWriter_Flush_t flush, void* context)
+{
+    memset(writerP, 0, sizeof(*writerP));
+    writerP->buffer = buffer;
+    writerP->size = size;
+    writerP->flush = flush;
+    writerP->flushContext = context;
+
+    /* One character is reserved for the null terminator */
+    if ((NULL == buffer) || (size < ((NULL == flush) ? 1 : 2)))
+    {
+        writerP->error = true;
+    }
+}
+
+bool JsonWriter_BeginObject(JsonWriter_t* writerP) { return JsonWriter_BeginContainer(writerP, true, '{'); }
+
+bool JsonWriter_EndObject(JsonWriter_t* writerP) { return JsonWriter_EndContainer(writerP, true, '}'); }
+
+bool JsonWriter_BeginArray(JsonWriter_t* writerP) { return JsonWriter_BeginContainer(writerP, false, '['); }
+
+bool JsonWriter_EndArray(JsonWriter_t* writerP) { return JsonWriter_EndContainer(writerP, false, ']'); }
+
+bool JsonWriter_Key(JsonWriter_t* writerP, const char* key)
+{
+    uint32_t bit = (uint32_t)1 << writerP->depth;
+
+    if (writerP->error || (NULL == key) || writerP->afterKey || (0 == (writerP->objectMask & bit)))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+
+    if ((0 != (writerP->elementMask & bit)) && !JsonWriter_Put(writerP, ",", 1))
+    {
+        return false;
+    }
+    writerP->elementMask |= bit;
+    writerP->afterKey = true;
+
+    return JsonWriter_Put(writerP, "\"", 1) && JsonWriter_PutEscaped(writerP, key, strlen(key)) && JsonWriter_Put(writerP, "\":", 2);
+}
+
+bool JsonWriter_String(JsonWriter_t* writerP, const char* value)
+{
+    if (NULL == value)
+    {
+        return JsonWriter_Fail(writerP);
+    }
+    return JsonWriter_StringLength(writerP, value, strlen(value));
+}
+
+bool JsonWriter_StringLength(JsonWriter_t* writerP, const char* value, size_t length)
+{
+    if ((NULL == value) && (length > 0))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+    return JsonWriter_BeginValue(writerP) && JsonWriter_Put(writerP, "\"", 1) && JsonWriter_PutEscaped(writerP, value, length) && JsonWriter_Put(writerP, "\"", 1);
+}
+
+bool JsonWriter_Int(JsonWriter_t* writerP, int64_t value)
+{
+    char digits[20];
+    uint8_t count = 0;
+
+    /* Work with the magnitude as unsigned to support INT64_MIN */
+    uint64_t magnitude = (value < 0) ? ((uint64_t)0 - (uint64_t)value) : (uint64_t)value;
+    do
+    {
+        digits[sizeof(digits) - 1 - count++] = (char)('0' + (magnitude % 10));
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    if (!JsonWriter_BeginValue(writerP))
+    {
+        return false;
+    }
+    if ((value < 0) && !JsonWriter_Put(writerP, "-", 1))
+    {
+        return false;
+    }
+    return JsonWriter_Put(writerP, digits + sizeof(digits) - count, count);
+}
+
+bool JsonWriter_Double(JsonWriter_t* writerP, double value)
+{
+    if (!isfinite(value))
+    {
+        return JsonWriter_Null(writerP);
+    }
+
+    char text[32];
+    int length = snprintf(text, sizeof(text) - 2, "%g", value);
+    if ((length <= 0) || (length >= (int)sizeof(text) - 2))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+
+    /* Same formatting as json_serialize(): decimal point independent of locale, ".0" appended to integral values */
+    char* comma = strchr(text, ',');
+    if (NULL != comma)
+    {
+        *comma = '.';
+    }
+    else if ((NULL == strchr(text, '.')) && (NULL == strchr(text, 'e')))
+    {
+        text[length++] = '.';
+        text[length++] = '0';
+    }
+
+    return JsonWriter_BeginValue(writerP) && JsonWriter_Put(writerP, text, (size_t)length);
+}
+
+bool JsonWriter_Bool(JsonWriter_t* writerP, bool value) { return JsonWriter_BeginValue(writerP) && (value ? JsonWriter_Put(writerP, "true", 4) : JsonWriter_Put(writerP, "false", 5)); }
+
+bool JsonWriter_Null(JsonWriter_t* writerP) { return JsonWriter_BeginValue(writerP) && JsonWriter_Put(writerP, "null", 4); }
+
+bool JsonWriter_Finish(JsonWriter_t* writerP, size_t* lengthP)
+{
+    if (writerP->error || (writerP->depth != 0) || (0 == (writerP->elementMask & 1)))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+
+    /* Space for the terminator is always reserved */
+    writerP->buffer[writerP->length] = '\0';
+
+    if ((NULL != writerP->flush) && (writerP->length > 0))
+    {
+        if (!writerP->flush(writerP->buffer, writerP->length, writerP->flushContext))
+        {
+            return JsonWriter_Fail(writerP);
+        }
+        writerP->flushedLength += writerP->length;
+        writerP->length = 0;
+    }
+
+    if (NULL != lengthP)
+    {
+        *lengthP = writerP->flushedLength + writerP->length;
+    }
+    return true;
+}
+
+/**
+ * @brief Marks the writer as failed.
+ *
+ * @param[in,out] writerP Writer
+ *
+ * @return false
+ */
+static bool JsonWriter_Fail(JsonWriter_t* writerP)
+{
+    writerP->error = true;
+    return false;
+}
+
+/**
+ * @brief Appends raw characters to the output, flushing the buffer if necessary.
+ *
+ * @param[in,out] writerP Writer
+ * @param[in] data Characters to append
+ * @param[in] length Number of characters
+ *
+ * @return true if successful, false otherwise
+ */
+static bool JsonWriter_Put(JsonWriter_t* writerP, const char* data, size_t length)
+{
+    if (writerP->error)
+    {
+        return false;
+    }
+
+    while (length > 0)
+    {
+        size_t space = writerP->size - 1 - writerP->length;
+        if (0 == space)
+        {
+            if ((NULL == writerP->flush) || !writerP->flush(writerP->buffer, writerP->length, writerP->flushContext))
+            {
+                return JsonWriter_Fail(writerP);
+            }
+            writerP->flushedLength += writerP->length;
+            writerP->length = 0;
+            continue;
+        }
+
+        size_t chunk = (length < space) ? length : space;
+        memcpy(writerP->buffer + writerP->length, data, chunk);
+        writerP->length += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Appends string contents to the output, escaping characters as required by JSON.
+ *
+ * Runs of characters that don't need escaping are appended at once.
+ *
+ * @param[in,out] writerP Writer
+ * @param[in] data String
+ * @param[in] length Length of the string
+ *
+ * @return true if successful, false otherwise
+ */
+static bool JsonWriter_PutEscaped(JsonWriter_t* writerP, const char* data, size_t length)
+{
+    size_t runStart = 0;
+
+    for (size_t i = 0; i < length; i++)
+    {
+        unsigned char c = (unsigned char)data[i];
+        if ((c >= 0x20) && (c != '"') && (c != '\\'))
+        {
+            continue;
+        }
+
+        if (!JsonWriter_Put(writerP, data + runStart, i - runStart))
+        {
+            return false;
+        }
+        runStart = i + 1;
+
+        char escaped[6] = {'\\', (char)c, 0, 0, 0, 0};
+        size_t escapedLength = 2;
+        switch (c)
+        {
+            case '"':
+            case '\\':
+                break;
+            case '\b':
+                escaped[1] = 'b';
+                break;
+            case '\f':
+                escaped[1] = 'f';
+                break;
+            case '\n':
+                escaped[1] = 'n';
+                break;
+            case '\r':
+                escaped[1] = 'r';
+                break;
+            case '\t':
+                escaped[1] = 't';
+                break;
+            default:
+                /* Other control characters */
+                escaped[1] = 'u';
+                escaped[2] = '0';
+                escaped[3] = '0';
+                escaped[4] = "0123456789abcdef"[c >> 4];
+                escaped[5] = "0123456789abcdef"[c & 0x0F];
+                escapedLength = 6;
+                break;
+        }
+
+        if (!JsonWriter_Put(writerP, escaped, escapedLength))
+        {
+            return false;
+        }
+    }
+
+    return JsonWriter_Put(writerP, data + runStart, length - runStart);
+}
+
+/**
+ * @brief Checks that a value may be written at the current position and writes the separator, if required.
+ *
+ * @param[in,out] writerP Writer
+ *
+ * @return true if successful, false otherwise
+ */
+static bool JsonWriter_BeginValue(JsonWriter_t* writerP)
+{
+    uint32_t bit = (uint32_t)1 << writerP->depth;
+
+    if (writerP->error)
+    {
+        return false;
+    }
+
+    if (0 != (writerP->objectMask & bit))
+    {
+        /* Object members need a key, the separator has been written together with the key */
+        if (!writerP->afterKey)
+        {
+            return JsonWriter_Fail(writerP);
+        }
+        writerP->afterKey = false;
+        return true;
+    }
+
+    if (0 != (writerP->elementMask & bit))
+    {
+        /* Only a single root value is allowed */
+        if (0 == writerP->depth)
+        {
+            return JsonWriter_Fail(writerP);
+        }
+        if (!JsonWriter_Put(writerP, ",", 1))
+        {
+            return false;
+        }
+    }
+    writerP->elementMask |= bit;
+    return true;
+}
+
+/**
+ * @brief Starts an object or array.
+ *
+ * @param[in,out] writerP Writer
+ * @param[in] isObject true for objects, false for arrays
+ * @param[in] open Opening bracket
+ *
+ * @return true if successful, false otherwise
+ */
+static bool JsonWriter_BeginContainer(JsonWriter_t* writerP, bool isObject, char open)
+{
+    if (!writerP->error && (writerP->depth >= JSONWRITER_MAX_DEPTH))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+    if (!JsonWriter_BeginValue(writerP) || !JsonWriter_Put(writerP, &open, 1))
+    {
+        return false;
+    }
+
+    writerP->depth++;
+    uint32_t bit = (uint32_t)1 << writerP->depth;
+    writerP->elementMask &= ~bit;
+    if (isObject)
+    {
+        writerP->objectMask |= bit;
+    }
+    else
+    {
+        writerP->objectMask &= ~bit;
+    }
+    return true;
+}
+
+/**
+ * @brief Ends the current object or array.
+ *
+ * @param[in,out] writerP Writer
+ * @param[in] isObject true for objects, false for arrays
+ * @param[in] close Closing bracket
+ *
+ * @return true if successful, false otherwise
+ */
+static bool JsonWriter_EndContainer(JsonWriter_t* writerP, bool isObject, char close)
+{
+    uint32_t bit = (uint32_t)1 << writerP->depth;
+
+    if (writerP->error || (0 == writerP->depth) || writerP->afterKey || (isObject != (0 != (writerP->objectMask & bit))))
+    {
+        return JsonWriter_Fail(writerP);
+    }
+
+    writerP->depth--;
+    return JsonWriter_Put(writerP, &close, 1);
+}
@@ -0,0 +1,228 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file json-writer.h
+ * @brief Streaming JSON writer header file.
+ *
+ * Serializes JSON in a single pass directly into a bounded buffer, without building
+ * a json_value tree and without using the heap. Optionally, the buffer is handed to
+ * a flush function whenever it is full, so that documents larger than the buffer can
+ * be streamed (e.g. to an AT command builder or the UART).
+ *
+ * Errors (buffer overflow, invalid nesting) are sticky: once an error has occurred,
+ * all further calls fail, so that it is sufficient to check the result of JsonWriter_Finish().
+ */
+
+#ifndef JSON_WRITER_H_INCLUDED
+#define JSON_WRITER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/**
+ * @brief Max. nesting depth of objects and arrays.
+ */
+#define JSONWRITER_MAX_DEPTH 31
+
+/**
+ * @brief Function receiving the serialized data if the writer's buffer is full or the document is finished.
+ *
+ * @param[in] data: Serialized data
+ * @param[in] length: Number of characters
+ * @param[in] context: Context as passed to JsonWriter_InitStream()
+ *
+ * @return True if successful, false otherwise (aborts serialization)
+ */
+typedef bool (*JsonWriter_Flush_t)(const char* data, size_t length, void* context);
+
+/**
+ * @brief State of a JSON writer.
+ */
+typedef struct JsonWriter_t
+{
+    char* buffer;             /**< Output buffer */
+    size_t size;              /**< Size of the output buffer */
+    size_t length;            /**< Number of characters currently in the output buffer */
+    size_t flushedLength;     /**< Number of characters already passed to the flush function */
+    JsonWriter_Flush_t flush; /**< Flush function (NULL if writing to the buffer only) */
+    void* flushContext;       /**< Context passed to the flush function */
+    uint32_t objectMask;      /**< Bit n is set if the container at depth n is an object */
+    uint32_t elementMask;     /**< Bit n is set if the container at depth n already has an element (bit 0: root value) */
+    uint8_t depth;            /**< Current nesting depth */
+    bool afterKey;            /**< A key has been written, which is awaiting its value */
+    bool error;               /**< An error has occurred */
+} JsonWriter_t;
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Initializes a writer serializing into the supplied buffer.
+ *
+ * @param[out] writerP: Writer
+ * @param[in] buffer: Output buffer, will be null terminated by JsonWriter_Finish()
+ * @param[in] size: Size of the output buffer (including the null terminator)
+ */
+extern void JsonWriter_Init(JsonWriter_t* writerP, char* buffer, size_t size);
+
+/**
+ * @brief Initializes a writer passing its buffer to the supplied flush function whenever it is full.
+ *
+ * @param[out] writerP: Writer
+ * @param[in] buffer: Intermediate buffer
+ * @param[in] size: Size of the intermediate buffer
+ * @param[in] flush: Function receiving the serialized data
+ * @param[in] context: Context passed to the flush function
+ */
+extern void JsonWriter_InitStream(JsonWriter_t* writerP, char* buffer, size_t size, JsonWriter_Flush_t flush, void* context);
+
+/**
+ * @brief Starts an object (as value of the previous key, element of an array or root value).
+ *
+ * @param[in,out] writerP: Writer
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_BeginObject(JsonWriter_t* writerP);
+
+/**
+ * @brief Ends the current object.
+ *
+ * @param[in,out] writerP: Writer
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_EndObject(JsonWriter_t* writerP);
+
+/**
+ * @brief Starts an array (as value of the previous key, element of an array or root value).
+ *
+ * @param[in,out] writerP: Writer
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_BeginArray(JsonWriter_t* writerP);
+
+/**
+ * @brief Ends the current array.
+ *
+ * @param[in,out] writerP: Writer
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_EndArray(JsonWriter_t* writerP);
+
+/**
+ * @brief Writes the key of the next member of the current object.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] key: Null terminated key (is escaped)
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_Key(JsonWriter_t* writerP, const char* key);
+
+/**
+ * @brief Writes a string value.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] value: Null terminated string (is escaped)
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_String(JsonWriter_t* writerP, const char* value);
+
+/**
+ * @brief Writes a string value of the given length.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] value: String (is escaped, may contain null characters)
+ * @param[in] length: Length of the string
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_StringLength(JsonWriter_t* writerP, const char* value, size_t length);
+
+/**
+ * @brief Writes an integer value.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] value: Value
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_Int(JsonWriter_t* writerP, int64_t value);
+
+/**
+ * @brief Writes a floating point value (formatted like json_serialize(), non-finite values are written as null).
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] value: Value
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_Double(JsonWriter_t* writerP, double value);
+
+/**
+ * @brief Writes a boolean value.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[in] value: Value
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_Bool(JsonWriter_t* writerP, bool value);
+
+/**
+ * @brief Writes a null value.
+ *
+ * @param[in,out] writerP: Writer
+ *
+ * @return True if successful, false otherwise
+ */
+extern bool JsonWriter_Null(JsonWriter_t* writerP);
+
+/**
+ * @brief Finishes the document.
+ *
+ * Checks that the root value is complete, null terminates the buffer and (if a
+ * flush function is used) passes the remaining data to the flush function.
+ *
+ * @param[in,out] writerP: Writer
+ * @param[out] lengthP: Total length of the document (excluding the null terminator), optional
+ *
+ * @return True if the document has been serialized completely, false otherwise
+ */
+extern bool JsonWriter_Finish(JsonWriter_t* writerP, size_t* lengthP);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* JSON_WRITER_H_INCLUDED */
@@ -109,6 +109,57 @@ static void default_free(void* ptr, void* user_data)
     free(ptr);
 }
 
+/* Alignment of arena allocations, sufficient for json_int_t and double */
+#define JSON_ARENA_ALIGNMENT 8
+
+static void* arena_alloc(size_t size, int zero, void* user_data)
+{
+    json_arena* arena = (json_arena*)user_data;
+    size_t offset = (arena->used + (JSON_ARENA_ALIGNMENT - 1)) & ~((size_t)JSON_ARENA_ALIGNMENT - 1);
+
+    if (offset > arena->size || (arena->size - offset) < size)
+        return 0;
+
+    arena->used = offset + size;
+
+    if (arena->used > arena->peak_used)
+        arena->peak_used = arena->used;
+
+    if (zero)
+        memset(arena->buffer + offset, 0, size);
+
+    return arena->buffer + offset;
+}
+
+static void arena_free(void* ptr, void* user_data)
+{
+    UNUSED(ptr);
+    UNUSED(user_data);
+}
+
+void json_arena_init(json_arena* arena, void* buffer, size_t size)
+{
+    /* Align the start of the buffer, so that offsets can be aligned instead of addresses */
+    size_t skip = (JSON_ARENA_ALIGNMENT - ((uintptr_t)buffer & (JSON_ARENA_ALIGNMENT - 1))) & (JSON_ARENA_ALIGNMENT - 1);
+
+    if (skip > size)
+        skip = size;
+
+    arena->buffer = (unsigned char*)buffer + skip;
+    arena->size = size - skip;
+    arena->used = 0;
+    arena->peak_used = 0;
+}
+
+void json_arena_reset(json_arena* arena) { arena->used = 0; }
+
+void json_arena_settings(json_settings* settings, json_arena* arena)
+{
+    settings->mem_alloc = arena_alloc;
+    settings->mem_free = arena_free;
+    settings->user_data = arena;
+}
+
 static void* json_alloc(json_state* state, unsigned long size, int zero)
 {
     if ((state->ulong_max - state->used_memory) < size)
@@ -144,6 +195,7 @@ static int new_value(json_state* state, json_value** top, json_value** root, jso
 
                 if (!(value->u.array.values = (json_value**)json_alloc(state, value->u.array.length * sizeof(json_value*), 0)))
                 {
+                    value->u.array.length = 0; /* nothing to free */
                     return 0;
                 }
 
@@ -159,6 +211,7 @@ static int new_value(json_state* state, json_value** top, json_value** root, jso
 
                 if (!(value->u.object.values = (json_object_entry*)json_alloc(state, values_size + ((unsigned long)value->u.object.values), 0)))
                 {
+                    value->u.object.length = 0; /* nothing to free */
                     return 0;
                 }
 
@@ -169,6 +222,13 @@ static int new_value(json_state* state, json_value** top, json_value** root, jso
 
             case json_string:
 
+                if (state->settings.settings & json_in_situ)
+                {
+                    /* Pointer into the source is set when the string starts */
+                    value->u.string.length = 0;
+                    break;
+                }
+
                 if (!(value->u.string.ptr = (json_char*)json_alloc(state, (value->u.string.length + 1) * sizeof(json_char), 0)))
                 {
                     return 0;
@@ -405,6 +465,8 @@ json_value* json_parse_ex(json_settings* settings, const json_char* json, size_t
 
                 if (b == '"')
                 {
+                    json_char* string_start = string;
+
                     if (!state.first_pass)
                         string[string_length] = 0;
 
@@ -423,7 +485,16 @@ json_value* json_parse_ex(json_settings* settings, const json_char* json, size_t
                         case json_object:
 
                             if (state.first_pass)
-                                (*(json_char**)&top->u.object.values) += string_length + 1;
+                            {
+                                if (!(state.settings.settings & json_in_situ))
+                                    (*(json_char**)&top->u.object.values) += string_length + 1;
+                            }
+                            else if (state.settings.settings & json_in_situ)
+                            {
+                                top->u.object.values[top->u.object.length].name = string_start;
+
+                                top->u.object.values[top->u.object.length].name_length = string_length;
+                            }
                             else
                             {
                                 top->u.object.values[top->u.object.length].name = (json_char*)top->_reserved.object_mem;
@@ -608,6 +679,9 @@ json_value* json_parse_ex(json_settings* settings, const json_char* json, size_t
 
                                 flags |= flag_string;
 
+                                if (!state.first_pass && (state.settings.settings & json_in_situ))
+                                    top->u.string.ptr = (json_char*)state.ptr + 1;
+
                                 string = top->u.string.ptr;
                                 string_length = 0;
 
@@ -722,7 +796,10 @@ json_value* json_parse_ex(json_settings* settings, const json_char* json, size_t
 
                                 flags |= flag_string;
 
-                                string = (json_char*)top->_reserved.object_mem;
+                                if (state.settings.settings & json_in_situ)
+                                    string = (json_char*)state.ptr + 1;
+                                else
+                                    string = (json_char*)top->_reserved.object_mem;
                                 string_length = 0;
 
                                 break;
@@ -993,10 +1070,13 @@ json_value* json_parse(const json_char* json, size_t length)
 void json_value_free_ex(json_settings* settings, json_value* value)
 {
     json_value* cur_value;
+    void (*mem_free)(void*, void* user_data);
 
     if (!value)
         return;
 
+    mem_free = settings->mem_free ? settings->mem_free : default_free;
+
     value->parent = 0;
 
     while (value)
@@ -1007,7 +1087,7 @@ void json_value_free_ex(json_settings* settings, json_value* value)
 
                 if (!value->u.array.length)
                 {
-                    settings->mem_free(value->u.array.values, settings->user_data);
+                    mem_free(value->u.array.values, settings->user_data);
                     break;
                 }
 
@@ -1018,7 +1098,7 @@ void json_value_free_ex(json_settings* settings, json_value* value)
 
                 if (!value->u.object.length)
                 {
-                    settings->mem_free(value->u.object.values, settings->user_data);
+                    mem_free(value->u.object.values, settings->user_data);
                     break;
                 }
 
@@ -1027,7 +1107,8 @@ void json_value_free_ex(json_settings* settings, json_value* value)
 
             case json_string:
 
-                settings->mem_free(value->u.string.ptr, settings->user_data);
+                if (!(settings->settings & json_in_situ))
+                    mem_free(value->u.string.ptr, settings->user_data);
                 break;
 
             default:
@@ -1036,7 +1117,7 @@ void json_value_free_ex(json_settings* settings, json_value* value)
 
         cur_value = value;
         value = value->parent;
-        settings->mem_free(cur_value, settings->user_data);
+        mem_free(cur_value, settings->user_data);
     }
 }
 
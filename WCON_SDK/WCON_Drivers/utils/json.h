@@ -73,6 +73,14 @@ typedef struct
 
 #define json_enable_comments 0x01
 
+/* Strings and object names point into the (writable) source buffer instead of
+ * being copied. Escape sequences are decoded in place and the closing quotes
+ * are replaced by null terminators, so the source buffer is modified and has
+ * to outlive the parsed value. Values parsed in this mode must be freed using
+ * json_value_free_ex() with the same settings.
+ */
+#define json_in_situ 0x02
+
 typedef enum
 {
     json_none,
@@ -253,6 +261,27 @@ void json_value_free(json_value*);
  */
 void json_value_free_ex(json_settings* settings, json_value*);
 
+/* Bounded arena allocator, to be plugged into json_settings using
+ * json_arena_settings(). All values allocated from the arena are released at
+ * once by json_arena_reset(), json_value_free_ex() is a no-op for them.
+ */
+typedef struct
+{
+    unsigned char* buffer;
+    size_t size;
+    size_t used;      /* bytes currently allocated */
+    size_t peak_used; /* high-water mark since json_arena_init() */
+
+} json_arena;
+
+void json_arena_init(json_arena* arena, void* buffer, size_t size);
+
+/* Releases everything allocated from the arena in O(1) */
+void json_arena_reset(json_arena* arena);
+
+/* Sets mem_alloc, mem_free and user_data of the settings to use the arena */
+void json_arena_settings(json_settings* settings, json_arena* arena);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
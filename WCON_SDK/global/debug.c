@@ -38,7 +38,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
-#if (WE_DEBUG_PRINT_LEVEL > WE_DEBUG_PRINT_LEVEL_OFF)
+#if (WE_DEBUG_PRINT_LEVEL > WE_DEBUG_PRINT_LEVEL_OFF) && !defined(WE_TRACE_ENABLED)
 
 static const char* we_debug_level_string[] = {
     [WE_DEBUG_PRINT_LEVEL_ERROR] = "ERROR",
@@ -343,7 +343,61 @@ bool WE_GetPinLevel(WE_Pin_t pin, WE_Pin_Level_t* pin_levelP)
     return true;
 }
 
+#if defined(WE_OS_RTOS)
+/* WE_Delay() is implemented in global_os.c */
+#elif defined(WE_UART_RX_DEFERRED)
+void WE_Delay(uint32_t delay)
+{
+    /* Process received data while waiting, so that blocking driver functions receive their responses */
+    uint32_t startTick = HAL_GetTick();
+    do
+    {
+        WE_UART_Process();
+    } while ((HAL_GetTick() - startTick) < delay);
+}
+#else
 void WE_Delay(uint32_t delay) { HAL_Delay(delay); }
+#endif
+
+__weak bool WE_WaitEvent(WE_Event_t* event, uint32_t timeoutMs)
+{
+    uint32_t startTick = HAL_GetTick();
+    while (1)
+    {
+        WE_UART_Process();
+
+        /* Check the event with interrupts masked, so that an interrupt signaling the event
+         * after the check still wakes up the CPU from __WFI() (pending interrupts end WFI
+         * regardless of PRIMASK). The SysTick interrupt ends WFI at least every millisecond. */
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        if (event->signaled)
+        {
+            event->signaled = false;
+            __set_PRIMASK(primask);
+            return true;
+        }
+        if ((HAL_GetTick() - startTick) >= timeoutMs)
+        {
+            __set_PRIMASK(primask);
+            return false;
+        }
+        __WFI();
+        __set_PRIMASK(primask);
+    }
+}
+
+__weak void WE_SignalEvent(WE_Event_t* event) { event->signaled = true; }
+
+uint32_t WE_EnterCritical()
+{
+    /* Masking all interrupts also keeps the RTOS scheduler (if any) from switching tasks */
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+void WE_ExitCritical(uint32_t state) { __set_PRIMASK(state); }
 
 __weak void WE_DelayMicroseconds(uint32_t delay)
 {
@@ -0,0 +1,556 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Operating system abstraction (mutexes, semaphores, queues and threads) for the Wireless Connectivity SDK for STM32.
+ *
+ * @details The implementation is selected using the following defines:
+ * - WE_OS_FREERTOS: FreeRTOS (requires configUSE_RECURSIVE_MUTEXES and configUSE_COUNTING_SEMAPHORES)
+ * - WE_OS_CMSIS_RTOS2: CMSIS-RTOS2 (e.g. FreeRTOS with the CMSIS-RTOS2 wrapper generated by STM32CubeMX)
+ * - None of the above: bare metal implementation (no threads, mutexes don't have any effect, waiting
+ *   for semaphores and queues puts the CPU to sleep until the next interrupt)
+ *
+ * If an RTOS is used, WE_Delay(), WE_WaitEvent() and WE_SignalEvent() are implemented using the RTOS as well,
+ * so that waiting for responses from the radio module doesn't block other threads. WE_SignalEvent() uses
+ * task notifications (FreeRTOS) or thread flags (CMSIS-RTOS2) to wake up the waiting thread.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global_platform.h"
+#include <global/global.h>
+
+#if defined(WE_OS_FREERTOS)
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "semphr.h"
+#include "task.h"
+#elif defined(WE_OS_CMSIS_RTOS2)
+#include "cmsis_os2.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(WE_OS_RTOS)
+
+/**
+ * @brief Returns true if called from interrupt context.
+ */
+static inline bool WE_OS_IsInterruptContext() { return __get_IPSR() != 0; }
+
+#endif /* WE_OS_RTOS */
+
+#if defined(WE_OS_FREERTOS)
+
+/**
+ * @brief Converts a timeout in milliseconds to RTOS ticks (rounding up).
+ */
+static TickType_t WE_OS_MsToTicks(uint32_t timeoutMs)
+{
+    if (WE_WAIT_FOREVER == timeoutMs)
+    {
+        return portMAX_DELAY;
+    }
+    return (TickType_t)((((uint64_t)timeoutMs * configTICK_RATE_HZ) + 999) / 1000);
+}
+
+bool WE_Mutex_Create(WE_Mutex_t* mutexP)
+{
+    *mutexP = xSemaphoreCreateRecursiveMutex();
+    return *mutexP != NULL;
+}
+
+void WE_Mutex_Delete(WE_Mutex_t mutex) { vSemaphoreDelete((SemaphoreHandle_t)mutex); }
+
+bool WE_Mutex_Lock(WE_Mutex_t mutex, uint32_t timeoutMs) { return pdTRUE == xSemaphoreTakeRecursive((SemaphoreHandle_t)mutex, WE_OS_MsToTicks(timeoutMs)); }
+
+void WE_Mutex_Unlock(WE_Mutex_t mutex) { xSemaphoreGiveRecursive((SemaphoreHandle_t)mutex); }
+
+bool WE_Semaphore_Create(WE_Semaphore_t* semaphoreP, uint32_t maxCount, uint32_t initialCount)
+{
+    *semaphoreP = xSemaphoreCreateCounting(maxCount, initialCount);
+    return *semaphoreP != NULL;
+}
+
+void WE_Semaphore_Delete(WE_Semaphore_t semaphore) { vSemaphoreDelete((SemaphoreHandle_t)semaphore); }
+
+bool WE_Semaphore_Take(WE_Semaphore_t semaphore, uint32_t timeoutMs) { return pdTRUE == xSemaphoreTake((SemaphoreHandle_t)semaphore, WE_OS_MsToTicks(timeoutMs)); }
+
+void WE_Semaphore_Give(WE_Semaphore_t semaphore)
+{
+    if (WE_OS_IsInterruptContext())
+    {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        xSemaphoreGiveFromISR((SemaphoreHandle_t)semaphore, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+    else
+    {
+        xSemaphoreGive((SemaphoreHandle_t)semaphore);
+    }
+}
+
+bool WE_Queue_Create(WE_Queue_t* queueP, size_t itemSize, uint32_t length)
+{
+    *queueP = xQueueCreate(length, itemSize);
+    return *queueP != NULL;
+}
+
+void WE_Queue_Delete(WE_Queue_t queue) { vQueueDelete((QueueHandle_t)queue); }
+
+bool WE_Queue_Send(WE_Queue_t queue, const void* itemP, uint32_t timeoutMs)
+{
+    if (WE_OS_IsInterruptContext())
+    {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        BaseType_t ret = xQueueSendToBackFromISR((QueueHandle_t)queue, itemP, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+        return pdTRUE == ret;
+    }
+    return pdTRUE == xQueueSendToBack((QueueHandle_t)queue, itemP, WE_OS_MsToTicks(timeoutMs));
+}
+
+bool WE_Queue_Receive(WE_Queue_t queue, void* itemP, uint32_t timeoutMs) { return pdTRUE == xQueueReceive((QueueHandle_t)queue, itemP, WE_OS_MsToTicks(timeoutMs)); }
+
+bool WE_Thread_Create(WE_Thread_t* threadP, WE_ThreadFunction_t function, void* argument, const char* name, uint32_t stackSize, WE_ThreadPriority_t priority)
+{
+    UBaseType_t taskPriority;
+    switch (priority)
+    {
+        case WE_ThreadPriority_Low:
+            taskPriority = tskIDLE_PRIORITY + 1;
+            break;
+        case WE_ThreadPriority_High:
+            taskPriority = configMAX_PRIORITIES - 1;
+            break;
+        case WE_ThreadPriority_Normal:
+        default:
+            taskPriority = configMAX_PRIORITIES / 2;
+            break;
+    }
+
+    TaskHandle_t task = NULL;
+    if (pdPASS != xTaskCreate(function, name, (configSTACK_DEPTH_TYPE)(stackSize / sizeof(StackType_t)), argument, taskPriority, &task))
+    {
+        return false;
+    }
+    *threadP = task;
+    return true;
+}
+
+WE_Thread_t WE_Thread_GetCurrent() { return xTaskGetCurrentTaskHandle(); }
+
+void WE_Delay(uint32_t delay) { vTaskDelay(WE_OS_MsToTicks(delay)); }
+
+/**
+ * @brief Blocks the calling thread until it is notified using WE_OS_NotifyThread() or the timeout has expired.
+ */
+static void WE_OS_WaitForNotification(uint32_t timeoutMs) { ulTaskNotifyTake(pdTRUE, WE_OS_MsToTicks(timeoutMs)); }
+
+/**
+ * @brief Wakes up a thread blocked in WE_OS_WaitForNotification().
+ */
+static void WE_OS_NotifyThread(WE_Thread_t thread)
+{
+    if (WE_OS_IsInterruptContext())
+    {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR((TaskHandle_t)thread, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+    else
+    {
+        xTaskNotifyGive((TaskHandle_t)thread);
+    }
+}
+
+#elif defined(WE_OS_CMSIS_RTOS2)
+
+/**
+ * @brief Thread flag used by WE_SignalEvent() to wake up a thread waiting in WE_WaitEvent().
+ */
+#define WE_OS_EVENT_THREAD_FLAG 0x40000000U
+
+/**
+ * @brief Converts a timeout in milliseconds to RTOS ticks (rounding up).
+ */
+static uint32_t WE_OS_MsToTicks(uint32_t timeoutMs)
+{
+    if (WE_WAIT_FOREVER == timeoutMs)
+    {
+        return osWaitForever;
+    }
+    return (uint32_t)((((uint64_t)timeoutMs * osKernelGetTickFreq()) + 999) / 1000);
+}
+
+bool WE_Mutex_Create(WE_Mutex_t* mutexP)
+{
+    const osMutexAttr_t attributes = {.attr_bits = osMutexRecursive | osMutexPrioInherit};
+    *mutexP = osMutexNew(&attributes);
+    return *mutexP != NULL;
+}
+
+void WE_Mutex_Delete(WE_Mutex_t mutex) { osMutexDelete((osMutexId_t)mutex); }
+
+bool WE_Mutex_Lock(WE_Mutex_t mutex, uint32_t timeoutMs) { return osOK == osMutexAcquire((osMutexId_t)mutex, WE_OS_MsToTicks(timeoutMs)); }
+
+void WE_Mutex_Unlock(WE_Mutex_t mutex) { osMutexRelease((osMutexId_t)mutex); }
+
+bool WE_Semaphore_Create(WE_Semaphore_t* semaphoreP, uint32_t maxCount, uint32_t initialCount)
+{
+    *semaphoreP = osSemaphoreNew(maxCount, initialCount, NULL);
+    return *semaphoreP != NULL;
+}
+
+void WE_Semaphore_Delete(WE_Semaphore_t semaphore) { osSemaphoreDelete((osSemaphoreId_t)semaphore); }
+
+bool WE_Semaphore_Take(WE_Semaphore_t semaphore, uint32_t timeoutMs) { return osOK == osSemaphoreAcquire((osSemaphoreId_t)semaphore, WE_OS_MsToTicks(timeoutMs)); }
+
+void WE_Semaphore_Give(WE_Semaphore_t semaphore) { osSemaphoreRelease((osSemaphoreId_t)semaphore); }
+
+bool WE_Queue_Create(WE_Queue_t* queueP, size_t itemSize, uint32_t length)
+{
+    *queueP = osMessageQueueNew(length, itemSize, NULL);
+    return *queueP != NULL;
+}
+
+void WE_Queue_Delete(WE_Queue_t queue) { osMessageQueueDelete((osMessageQueueId_t)queue); }
+
+bool WE_Queue_Send(WE_Queue_t queue, const void* itemP, uint32_t timeoutMs) { return osOK == osMessageQueuePut((osMessageQueueId_t)queue, itemP, 0, WE_OS_IsInterruptContext() ? 0 : WE_OS_MsToTicks(timeoutMs)); }
+
+bool WE_Queue_Receive(WE_Queue_t queue, void* itemP, uint32_t timeoutMs) { return osOK == osMessageQueueGet((osMessageQueueId_t)queue, itemP, NULL, WE_OS_MsToTicks(timeoutMs)); }
+
+bool WE_Thread_Create(WE_Thread_t* threadP, WE_ThreadFunction_t function, void* argument, const char* name, uint32_t stackSize, WE_ThreadPriority_t priority)
+{
+    osThreadAttr_t attributes = {.name = name, .stack_size = stackSize};
+    switch (priority)
+    {
+        case WE_ThreadPriority_Low:
+            attributes.priority = osPriorityBelowNormal;
+            break;
+        case WE_ThreadPriority_High:
+            attributes.priority = osPriorityHigh;
+            break;
+        case WE_ThreadPriority_Normal:
+        default:
+            attributes.priority = osPriorityNormal;
+            break;
+    }
+
+    osThreadId_t thread = osThreadNew(function, argument, &attributes);
+    if (NULL == thread)
+    {
+        return false;
+    }
+    *threadP = thread;
+    return true;
+}
+
+WE_Thread_t WE_Thread_GetCurrent() { return osThreadGetId(); }
+
+void WE_Delay(uint32_t delay) { osDelay(WE_OS_MsToTicks(delay)); }
+
+/**
+ * @brief Blocks the calling thread until it is notified using WE_OS_NotifyThread() or the timeout has expired.
+ */
+static void WE_OS_WaitForNotification(uint32_t timeoutMs) { osThreadFlagsWait(WE_OS_EVENT_THREAD_FLAG, osFlagsWaitAny, WE_OS_MsToTicks(timeoutMs)); }
+
+/**
+ * @brief Wakes up a thread blocked in WE_OS_WaitForNotification().
+ */
+static void WE_OS_NotifyThread(WE_Thread_t thread) { osThreadFlagsSet((osThreadId_t)thread, WE_OS_EVENT_THREAD_FLAG); }
+
+#else /* Bare metal */
+
+/**
+ * @brief Counting semaphore (bare metal implementation).
+ */
+typedef struct WE_OS_Semaphore_t
+{
+    volatile uint32_t count;
+    uint32_t maxCount;
+} WE_OS_Semaphore_t;
+
+/**
+ * @brief Queue (bare metal implementation, ring buffer of items).
+ */
+typedef struct WE_OS_Queue_t
+{
+    uint8_t* items;
+    size_t itemSize;
+    uint32_t length;
+    volatile uint32_t count;
+    uint32_t readIndex;
+} WE_OS_Queue_t;
+
+/**
+ * @brief Function checking (and consuming) the condition waited for by WE_OS_WaitFor().
+ * Is called with interrupts disabled.
+ */
+typedef bool (*WE_OS_TryFunction_t)(void* object, void* argument);
+
+/**
+ * @brief Waits until tryFunction returns true or the timeout has expired.
+ *
+ * The CPU is put to sleep until the next interrupt between the checks (see WE_WaitEvent()).
+ */
+static bool WE_OS_WaitFor(WE_OS_TryFunction_t tryFunction, void* object, void* argument, uint32_t timeoutMs)
+{
+    uint32_t startTick = HAL_GetTick();
+    while (1)
+    {
+        WE_UART_Process();
+
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        if (tryFunction(object, argument))
+        {
+            __set_PRIMASK(primask);
+            return true;
+        }
+        if ((WE_WAIT_FOREVER != timeoutMs) && ((HAL_GetTick() - startTick) >= timeoutMs))
+        {
+            __set_PRIMASK(primask);
+            return false;
+        }
+        __WFI();
+        __set_PRIMASK(primask);
+    }
+}
+
+/* Mutexes are not required without threads */
+
+bool WE_Mutex_Create(WE_Mutex_t* mutexP)
+{
+    *mutexP = NULL;
+    return true;
+}
+
+void WE_Mutex_Delete(WE_Mutex_t mutex) { UNUSED(mutex); }
+
+bool WE_Mutex_Lock(WE_Mutex_t mutex, uint32_t timeoutMs)
+{
+    UNUSED(mutex);
+    UNUSED(timeoutMs);
+    return true;
+}
+
+void WE_Mutex_Unlock(WE_Mutex_t mutex) { UNUSED(mutex); }
+
+bool WE_Semaphore_Create(WE_Semaphore_t* semaphoreP, uint32_t maxCount, uint32_t initialCount)
+{
+    WE_OS_Semaphore_t* semaphore = malloc(sizeof(WE_OS_Semaphore_t));
+    if (NULL == semaphore)
+    {
+        return false;
+    }
+    semaphore->count = initialCount;
+    semaphore->maxCount = maxCount;
+    *semaphoreP = semaphore;
+    return true;
+}
+
+void WE_Semaphore_Delete(WE_Semaphore_t semaphore) { free(semaphore); }
+
+static bool WE_OS_TryTakeSemaphore(void* object, void* argument)
+{
+    UNUSED(argument);
+    WE_OS_Semaphore_t* semaphore = object;
+    if (semaphore->count == 0)
+    {
+        return false;
+    }
+    semaphore->count--;
+    return true;
+}
+
+bool WE_Semaphore_Take(WE_Semaphore_t semaphore, uint32_t timeoutMs) { return WE_OS_WaitFor(WE_OS_TryTakeSemaphore, semaphore, NULL, timeoutMs); }
+
+void WE_Semaphore_Give(WE_Semaphore_t semaphore)
+{
+    WE_OS_Semaphore_t* s = semaphore;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (s->count < s->maxCount)
+    {
+        s->count++;
+    }
+    __set_PRIMASK(primask);
+}
+
+bool WE_Queue_Create(WE_Queue_t* queueP, size_t itemSize, uint32_t length)
+{
+    WE_OS_Queue_t* queue = malloc(sizeof(WE_OS_Queue_t) + itemSize * length);
+    if (NULL == queue)
+    {
+        return false;
+    }
+    queue->items = (uint8_t*)(queue + 1);
+    queue->itemSize = itemSize;
+    queue->length = length;
+    queue->count = 0;
+    queue->readIndex = 0;
+    *queueP = queue;
+    return true;
+}
+
+void WE_Queue_Delete(WE_Queue_t queue) { free(queue); }
+
+static bool WE_OS_TrySendToQueue(void* object, void* argument)
+{
+    WE_OS_Queue_t* queue = object;
+    if (queue->count >= queue->length)
+    {
+        return false;
+    }
+    uint32_t writeIndex = (queue->readIndex + queue->count) % queue->length;
+    memcpy(&queue->items[writeIndex * queue->itemSize], argument, queue->itemSize);
+    queue->count++;
+    return true;
+}
+
+static bool WE_OS_TryReceiveFromQueue(void* object, void* argument)
+{
+    WE_OS_Queue_t* queue = object;
+    if (queue->count == 0)
+    {
+        return false;
+    }
+    memcpy(argument, &queue->items[queue->readIndex * queue->itemSize], queue->itemSize);
+    queue->readIndex = (queue->readIndex + 1) % queue->length;
+    queue->count--;
+    return true;
+}
+
+bool WE_Queue_Send(WE_Queue_t queue, const void* itemP, uint32_t timeoutMs) { return WE_OS_WaitFor(WE_OS_TrySendToQueue, queue, (void*)itemP, timeoutMs); }
+
+bool WE_Queue_Receive(WE_Queue_t queue, void* itemP, uint32_t timeoutMs) { return WE_OS_WaitFor(WE_OS_TryReceiveFromQueue, queue, itemP, timeoutMs); }
+
+bool WE_Thread_Create(WE_Thread_t* threadP, WE_ThreadFunction_t function, void* argument, const char* name, uint32_t stackSize, WE_ThreadPriority_t priority)
+{
+    /* No threads without an RTOS */
+    UNUSED(threadP);
+    UNUSED(function);
+    UNUSED(argument);
+    UNUSED(name);
+    UNUSED(stackSize);
+    UNUSED(priority);
+    return false;
+}
+
+WE_Thread_t WE_Thread_GetCurrent() { return NULL; }
+
+#endif
+
+#if defined(WE_OS_RTOS)
+
+#if defined(WE_UART_RX_DEFERRED)
+/**
+ * @brief Thread waiting in WE_WaitEvent() that is woken up when data has been received (NULL if none).
+ */
+static volatile WE_Thread_t rxWaiter = NULL;
+
+void WE_OS_NotifyDataReceived(void)
+{
+    WE_Thread_t waiter = rxWaiter;
+    if (NULL != waiter)
+    {
+        WE_OS_NotifyThread(waiter);
+    }
+}
+#endif
+
+bool WE_WaitEvent(WE_Event_t* event, uint32_t timeoutMs)
+{
+    uint32_t startTick = WE_GetTick();
+    WE_Thread_t self = WE_Thread_GetCurrent();
+    event->waiter = self;
+#if defined(WE_UART_RX_DEFERRED)
+    /* Only one thread is woken up on reception - any other waiting thread falls back to polling */
+    uint32_t criticalState = WE_EnterCritical();
+    bool isRxWaiter = (NULL == rxWaiter);
+    if (isRxWaiter)
+    {
+        rxWaiter = self;
+    }
+    WE_ExitCritical(criticalState);
+#endif
+    while (1)
+    {
+        /* The receive waiter is registered before processing, so that data arriving after
+         * WE_UART_Process() has returned wakes up WE_OS_WaitForNotification() */
+        WE_UART_Process();
+
+        /* The waiter is registered before checking the flag, so that a signal arriving after
+         * the check wakes up WE_OS_WaitForNotification() */
+        bool signaled = event->signaled;
+        uint32_t elapsed = WE_GetTick() - startTick;
+        if (signaled || (elapsed >= timeoutMs))
+        {
+            if (signaled)
+            {
+                event->signaled = false;
+            }
+            event->waiter = NULL;
+#if defined(WE_UART_RX_DEFERRED)
+            if (isRxWaiter)
+            {
+                rxWaiter = NULL;
+            }
+#endif
+            return signaled;
+        }
+
+#if defined(WE_UART_RX_DEFERRED)
+        /* Received data is only passed to the drivers by WE_UART_Process() - the receive waiter is woken up
+         * by WE_OS_NotifyDataReceived(), any other thread checks again after one tick */
+        WE_OS_WaitForNotification(isRxWaiter ? (timeoutMs - elapsed) : 1);
+#else
+        WE_OS_WaitForNotification(timeoutMs - elapsed);
+#endif
+    }
+}
+
+void WE_SignalEvent(WE_Event_t* event)
+{
+    event->signaled = true;
+    WE_Thread_t waiter = event->waiter;
+    if (NULL != waiter)
+    {
+        WE_OS_NotifyThread(waiter);
+    }
+}
+
+#endif /* WE_OS_RTOS */
+
+#ifdef __cplusplus
+}
+#endif
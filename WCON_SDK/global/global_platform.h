@@ -41,15 +41,47 @@
 #include "global_F4xx.h"
 #endif
 
+#if defined(WE_OS_FREERTOS) || defined(WE_OS_CMSIS_RTOS2)
+/**
+ * @brief Is defined if the SDK is running on top of an RTOS (see global_os.c).
+ */
+#define WE_OS_RTOS
+#endif
+
+#if defined(WE_OS_RTOS) && defined(WE_UART_DMA) && !defined(WE_UART_RX_DEFERRED)
+/**
+ * @brief Data received via DMA is always processed in thread context if running on top of an RTOS
+ * (the DMA/IDLE interrupts only copy it to the receive ring buffer and wake up the waiting thread).
+ */
+#define WE_UART_RX_DEFERRED
+#endif
+
+#ifndef WE_PRIORITY_BASE
+#if defined(WE_OS_RTOS) && defined(STM32F401xE)
+/**
+ * @brief Highest interrupt priority used by the SDK.
+ *
+ * Interrupts calling RTOS functions (e.g. WE_SignalEvent(), WE_Queue_Send()) must not have a higher priority
+ * than configMAX_SYSCALL_INTERRUPT_PRIORITY (5 in the default STM32CubeMX configuration).
+ */
+#define WE_PRIORITY_BASE 5
+#else
+/**
+ * @brief Highest interrupt priority used by the SDK.
+ */
+#define WE_PRIORITY_BASE 0
+#endif
+#endif
+
 /**
  * @brief Priority for UART interrupts (used for communicating with radio module)
  */
-#define WE_PRIORITY_UART_RX 0
+#define WE_PRIORITY_UART_RX (WE_PRIORITY_BASE + 0)
 
 /**
  * @brief Priority for (asynchronous) processing of data received from radio module.
  */
-#define WE_PRIORITY_RX_DATA_PROCESSING 1
+#define WE_PRIORITY_RX_DATA_PROCESSING (WE_PRIORITY_BASE + 1)
 
 /**
  * @brief Configuration of a STM32 pin.
@@ -72,4 +104,12 @@ extern void WE_Platform_Init(void);
 */
 extern void WE_Error_Handler(void);
 
+#if defined(WE_OS_RTOS) && defined(WE_UART_RX_DEFERRED)
+/**
+* @brief Is called from interrupt context when data has been added to a UART's receive ring buffer
+* (wakes up the thread waiting in WE_WaitEvent(), which processes the data using WE_UART_Process()).
+*/
+extern void WE_OS_NotifyDataReceived(void);
+#endif
+
 #endif /* GLOBAL_PLATFORM_TYPES_H_ */
@@ -44,13 +44,28 @@
 /**
  * @brief Priority for UART interface used for debugging.
  */
-#define WE_PRIORITY_UART_PRINT 2
+#define WE_PRIORITY_UART_PRINT (WE_PRIORITY_BASE + 2)
 
 /**
  * @brief Print ring buffer size.
  */
 #define WE_PRINT_BUFFER_SIZE 2048
 
+/**
+ * @brief Baud rate of the UART used for print output.
+ */
+#ifndef WE_PRINT_BAUDRATE
+#define WE_PRINT_BAUDRATE 115200
+#endif
+
+#if defined(STM32F401xE) || defined(STM32L073xx)
+/**
+ * @brief Is defined if the print output is transferred via DMA (one interrupt per contiguous
+ * segment of the ring buffer instead of one interrupt per character).
+ */
+#define WE_PRINT_DMA
+#endif
+
 /**
  * @brief UART used for printf output.
  */
@@ -73,8 +88,20 @@ static uint16_t printBufferWritePos = 0;
  */
 static uint16_t printBufferReadPos = 0;
 
+/**
+ * @brief Is true while characters are being transferred.
+ */
 static volatile bool transferRunning = false;
 
+#if defined(WE_PRINT_DMA)
+/**
+ * @brief Number of characters of the current DMA transfer (starting at printBufferReadPos).
+ */
+static uint16_t printTransferLength = 0;
+
+static void WE_Print_StartTransfer(void);
+#endif
+
 /**
  * @brief Initializes UART2 and connects this interface to printf.
  *
@@ -137,7 +164,7 @@ void WE_Print_Init()
     LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_USART2);
 
     LL_USART_InitTypeDef uartInitStruct = {0};
-    uartInitStruct.BaudRate = 115200;
+    uartInitStruct.BaudRate = WE_PRINT_BAUDRATE;
     uartInitStruct.DataWidth = LL_USART_DATAWIDTH_8B;
     uartInitStruct.StopBits = LL_USART_STOPBITS_1;
     uartInitStruct.Parity = LL_USART_PARITY_NONE;
@@ -149,10 +176,51 @@ void WE_Print_Init()
     LL_USART_ConfigAsyncMode(uartPrint);
     LL_USART_Enable(uartPrint);
 
+#if defined(WE_PRINT_DMA)
+    /* DMA controller clock enable */
+    LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
+
+#if defined(STM32L073xx)
+    /* USART2_TX DMA1, channel 4, request 4 */
+    NVIC_SetPriority(DMA1_Channel4_5_6_7_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_PRINT, 0));
+    NVIC_EnableIRQ(DMA1_Channel4_5_6_7_IRQn);
+
+    LL_DMA_SetPeriphRequest(DMA1, LL_DMA_CHANNEL_4, LL_DMA_REQUEST_4);
+    LL_DMA_SetDataTransferDirection(DMA1, LL_DMA_CHANNEL_4, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetChannelPriorityLevel(DMA1, LL_DMA_CHANNEL_4, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(DMA1, LL_DMA_CHANNEL_4, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(DMA1, LL_DMA_CHANNEL_4, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(DMA1, LL_DMA_CHANNEL_4, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(DMA1, LL_DMA_CHANNEL_4, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(DMA1, LL_DMA_CHANNEL_4, LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_CHANNEL_4, (uint32_t)&USART2->TDR);
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_CHANNEL_4);
+#elif defined(STM32F401xE)
+    /* USART2_TX DMA1, stream 6, channel 4 */
+    NVIC_SetPriority(DMA1_Stream6_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_PRINT, 0));
+    NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+    LL_DMA_SetChannelSelection(DMA1, LL_DMA_STREAM_6, LL_DMA_CHANNEL_4);
+    LL_DMA_SetDataTransferDirection(DMA1, LL_DMA_STREAM_6, LL_DMA_DIRECTION_MEMORY_TO_PERIPH);
+    LL_DMA_SetStreamPriorityLevel(DMA1, LL_DMA_STREAM_6, LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetMode(DMA1, LL_DMA_STREAM_6, LL_DMA_MODE_NORMAL);
+    LL_DMA_SetPeriphIncMode(DMA1, LL_DMA_STREAM_6, LL_DMA_PERIPH_NOINCREMENT);
+    LL_DMA_SetMemoryIncMode(DMA1, LL_DMA_STREAM_6, LL_DMA_MEMORY_INCREMENT);
+    LL_DMA_SetPeriphSize(DMA1, LL_DMA_STREAM_6, LL_DMA_PDATAALIGN_BYTE);
+    LL_DMA_SetMemorySize(DMA1, LL_DMA_STREAM_6, LL_DMA_MDATAALIGN_BYTE);
+    LL_DMA_DisableFifoMode(DMA1, LL_DMA_STREAM_6);
+    LL_DMA_SetPeriphAddress(DMA1, LL_DMA_STREAM_6, (uint32_t)&USART2->DR);
+    LL_DMA_EnableIT_TC(DMA1, LL_DMA_STREAM_6);
+#endif
+
+    /* DMA channel/stream is enabled per segment in WE_Print_StartTransfer() */
+    LL_USART_EnableDMAReq_TX(uartPrint);
+#else
     /* Enable transfer complete interrupt */
     LL_USART_EnableIT_TC(uartPrint);
     NVIC_SetPriority(USART2_IRQn, NVIC_EncodePriority(NVIC_GetPriorityGrouping(), WE_PRIORITY_UART_PRINT, 0));
     NVIC_EnableIRQ(USART2_IRQn);
+#endif
 
     /* No I/O buffering for STDOUT stream - transmit characters as soon as they are printed */
     setvbuf(stdout, NULL, _IONBF, 0);
@@ -163,11 +231,119 @@ void WE_Print_Init()
  */
 void WE_Print_Flush()
 {
+#if defined(WE_OS_RTOS)
     while (transferRunning)
     {
     }
+#else
+    while (1)
+    {
+        /* Sleep until the transfer complete interrupt (see WE_WaitEvent()) */
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        if (!transferRunning)
+        {
+            __set_PRIMASK(primask);
+            break;
+        }
+        __WFI();
+        __set_PRIMASK(primask);
+    }
+#endif
+
+#if defined(WE_PRINT_DMA)
+    /* DMA transfer complete only means that the last character has been written to the UART */
+    while ((uartPrint != NULL) && !LL_USART_IsActiveFlag_TC(uartPrint))
+    {
+    }
+#endif
 }
 
+#if defined(WE_PRINT_DMA)
+/**
+ * @brief Transfers the next contiguous segment of the ring buffer (if any) via DMA.
+ *
+ * Is called from _write() if no transfer is running and from the DMA interrupt handler.
+ */
+static void WE_Print_StartTransfer(void)
+{
+    uint16_t readPos = printBufferReadPos;
+    uint16_t writePos = printBufferWritePos;
+
+    if (readPos == writePos)
+    {
+        transferRunning = false;
+        return;
+    }
+
+    /* Transfer up to the write position or up to the end of the buffer (the rest is transferred next) */
+    printTransferLength = (writePos > readPos) ? (writePos - readPos) : (WE_PRINT_BUFFER_SIZE - readPos);
+    transferRunning = true;
+
+    /* Cleared here and set by the UART after the last character of the segment, see WE_Print_Flush() */
+    LL_USART_ClearFlag_TC(uartPrint);
+
+#if defined(STM32L073xx)
+    LL_DMA_DisableChannel(DMA1, LL_DMA_CHANNEL_4);
+    LL_DMA_ClearFlag_GI4(DMA1);
+    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_CHANNEL_4, (uint32_t)(printBuffer + readPos));
+    LL_DMA_SetDataLength(DMA1, LL_DMA_CHANNEL_4, printTransferLength);
+    LL_DMA_EnableChannel(DMA1, LL_DMA_CHANNEL_4);
+#elif defined(STM32F401xE)
+    LL_DMA_DisableStream(DMA1, LL_DMA_STREAM_6);
+    while (LL_DMA_IsEnabledStream(DMA1, LL_DMA_STREAM_6))
+    {
+    }
+
+    /* Stream flags must be cleared before the stream can be re-enabled */
+    LL_DMA_ClearFlag_TC6(DMA1);
+    LL_DMA_ClearFlag_HT6(DMA1);
+    LL_DMA_ClearFlag_TE6(DMA1);
+    LL_DMA_ClearFlag_DME6(DMA1);
+    LL_DMA_ClearFlag_FE6(DMA1);
+    LL_DMA_SetMemoryAddress(DMA1, LL_DMA_STREAM_6, (uint32_t)(printBuffer + readPos));
+    LL_DMA_SetDataLength(DMA1, LL_DMA_STREAM_6, printTransferLength);
+    LL_DMA_EnableStream(DMA1, LL_DMA_STREAM_6);
+#endif
+}
+
+/**
+ * @brief Is called when a segment of the ring buffer has been transferred.
+ */
+static void WE_Print_OnTransferComplete(void)
+{
+    uint16_t readPos = printBufferReadPos + printTransferLength;
+    if (readPos >= WE_PRINT_BUFFER_SIZE)
+    {
+        readPos -= WE_PRINT_BUFFER_SIZE;
+    }
+    printBufferReadPos = readPos;
+
+    WE_Print_StartTransfer();
+}
+
+#if defined(STM32L073xx)
+void DMA1_Channel4_5_6_7_IRQHandler(void)
+{
+    if (LL_DMA_IsEnabledIT_TC(DMA1, LL_DMA_CHANNEL_4) && LL_DMA_IsActiveFlag_TC4(DMA1))
+    {
+        LL_DMA_ClearFlag_TC4(DMA1);
+        WE_Print_OnTransferComplete();
+    }
+}
+#elif defined(STM32F401xE)
+void DMA1_Stream6_IRQHandler(void)
+{
+    if (LL_DMA_IsEnabledIT_TC(DMA1, LL_DMA_STREAM_6) && LL_DMA_IsActiveFlag_TC6(DMA1))
+    {
+        LL_DMA_ClearFlag_TC6(DMA1);
+        WE_Print_OnTransferComplete();
+    }
+}
+#endif
+
+#else
+
 void USART2_IRQHandler(void)
 {
     if (LL_USART_IsEnabledIT_TC(USART2) && LL_USART_IsActiveFlag_TC(USART2))
@@ -198,6 +374,8 @@ void USART2_IRQHandler(void)
     }
 }
 
+#endif /* WE_PRINT_DMA */
+
 int _write(int fd, char* ptr, int len)
 {
     /* Note that it is not safe to call this function from different contexts! */
@@ -254,11 +432,18 @@ int _write(int fd, char* ptr, int len)
         printBufferWritePos = writePos;
 
         /* Start transfer if not already running */
+#if defined(WE_PRINT_DMA)
+        if (!transferRunning)
+        {
+            WE_Print_StartTransfer();
+        }
+#else
         if (!transferRunning && LL_USART_IsActiveFlag_TXE(uartPrint))
         {
             transferRunning = true;
             LL_USART_TransmitData8(uartPrint, *(printBuffer + printBufferReadPos));
         }
+#endif
 
         lock = false;
 
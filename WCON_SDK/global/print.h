@@ -31,7 +31,11 @@
 #ifndef PRINT_H_INCLUDED
 #define PRINT_H_INCLUDED
 
-#ifdef WE_APP_PRINT_ENABLED
+#if defined(WE_APP_PRINT_ENABLED) && defined(WE_TRACE_ENABLED)
+#include <global/trace.h>
+/* Recorded in the trace log like the driver's debug messages (see trace.h) */
+#define WE_APP_PRINT(...) WE_TRACE(__VA_ARGS__)
+#elif defined(WE_APP_PRINT_ENABLED)
 #define WE_APP_PRINT(...) printf(__VA_ARGS__)
 #else
 #define WE_APP_PRINT(...)
@@ -0,0 +1,106 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Lock-free single-producer/single-consumer byte ring buffer.
+ */
+
+#include <string.h>
+
+#include "ringbuffer.h"
+
+/*
+ * The indices are accessed using acquire/release semantics, so that the payload written
+ * by the producer is visible to the consumer before the new write index is (and vice versa
+ * for the read index). Aligned 32 bit loads and stores are atomic on all supported cores.
+ */
+#define WE_RINGBUFFER_LOAD(index) __atomic_load_n(&(index), __ATOMIC_ACQUIRE)
+#define WE_RINGBUFFER_STORE(index, value) __atomic_store_n(&(index), (value), __ATOMIC_RELEASE)
+
+bool WE_RingBuffer_Init(WE_RingBuffer_t* ringBuffer, uint8_t* buffer, uint32_t size)
+{
+    if ((ringBuffer == NULL) || (buffer == NULL) || (size == 0) || ((size & (size - 1)) != 0))
+    {
+        return false;
+    }
+
+    ringBuffer->buffer = buffer;
+    ringBuffer->size = size;
+    ringBuffer->writeIndex = 0;
+    ringBuffer->readIndex = 0;
+    ringBuffer->droppedBytes = 0;
+    return true;
+}
+
+uint32_t WE_RingBuffer_Write(WE_RingBuffer_t* ringBuffer, const uint8_t* data, uint32_t length)
+{
+    uint32_t writeIndex = ringBuffer->writeIndex;
+    uint32_t readIndex = WE_RINGBUFFER_LOAD(ringBuffer->readIndex);
+    uint32_t free = ringBuffer->size - (writeIndex - readIndex);
+
+    if (length > free)
+    {
+        ringBuffer->droppedBytes += length - free;
+        length = free;
+    }
+
+    uint32_t offset = writeIndex & (ringBuffer->size - 1);
+    uint32_t chunkSize = ringBuffer->size - offset;
+    if (chunkSize > length)
+    {
+        chunkSize = length;
+    }
+    memcpy(ringBuffer->buffer + offset, data, chunkSize);
+    if (length > chunkSize)
+    {
+        /* Wrap around */
+        memcpy(ringBuffer->buffer, data + chunkSize, length - chunkSize);
+    }
+
+    WE_RINGBUFFER_STORE(ringBuffer->writeIndex, writeIndex + length);
+    return length;
+}
+
+uint32_t WE_RingBuffer_Peek(WE_RingBuffer_t* ringBuffer, uint8_t** dataP)
+{
+    uint32_t readIndex = ringBuffer->readIndex;
+    uint32_t available = WE_RINGBUFFER_LOAD(ringBuffer->writeIndex) - readIndex;
+
+    uint32_t offset = readIndex & (ringBuffer->size - 1);
+    uint32_t chunkSize = ringBuffer->size - offset;
+    if (chunkSize > available)
+    {
+        chunkSize = available;
+    }
+
+    *dataP = ringBuffer->buffer + offset;
+    return chunkSize;
+}
+
+void WE_RingBuffer_Release(WE_RingBuffer_t* ringBuffer, uint32_t length) { WE_RINGBUFFER_STORE(ringBuffer->readIndex, ringBuffer->readIndex + length); }
+
+uint32_t WE_RingBuffer_GetCount(WE_RingBuffer_t* ringBuffer) { return WE_RINGBUFFER_LOAD(ringBuffer->writeIndex) - WE_RINGBUFFER_LOAD(ringBuffer->readIndex); }
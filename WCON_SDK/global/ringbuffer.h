@@ -0,0 +1,122 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+
+/**
+ * @file
+ * @brief Lock-free single-producer/single-consumer byte ring buffer.
+ *
+ * @details Used to hand over data received via UART from interrupt context (producer)
+ * to thread context (consumer), see WE_UART_Process(). Exactly one context may write
+ * to a ring buffer and exactly one context may read from it - no locking is required
+ * in this case.
+ */
+
+#ifndef RINGBUFFER_H_INCLUDED
+#define RINGBUFFER_H_INCLUDED
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Single-producer/single-consumer ring buffer.
+ *
+ * Read and write index are free running (i.e. they are never wrapped) and are masked
+ * when accessing the buffer, so the buffer size must be a power of two.
+ */
+typedef struct WE_RingBuffer_t
+{
+    uint8_t* buffer;                /**< Storage of ring buffer */
+    uint32_t size;                  /**< Size of storage (power of two) */
+    volatile uint32_t writeIndex;   /**< Write index (modified by producer only) */
+    volatile uint32_t readIndex;    /**< Read index (modified by consumer only) */
+    volatile uint32_t droppedBytes; /**< Number of bytes dropped because the ring buffer was full (modified by producer only) */
+} WE_RingBuffer_t;
+
+/**
+ * @brief Initializes a ring buffer.
+ *
+ * Must not be called while producer or consumer are accessing the ring buffer.
+ *
+ * @param[in] ringBuffer: Ring buffer to be initialized
+ * @param[in] buffer: Storage to be used by the ring buffer
+ * @param[in] size: Size of storage in bytes (must be a power of two)
+ *
+ * @return True if request succeeded, false otherwise
+ */
+extern bool WE_RingBuffer_Init(WE_RingBuffer_t* ringBuffer, uint8_t* buffer, uint32_t size);
+
+/**
+ * @brief Appends data to the ring buffer (producer side).
+ *
+ * Bytes that don't fit into the ring buffer are dropped and counted in droppedBytes.
+ *
+ * @param[in] ringBuffer: Ring buffer
+ * @param[in] data: Data to be appended
+ * @param[in] length: Number of bytes to be appended
+ *
+ * @return Number of bytes that have been appended
+ */
+extern uint32_t WE_RingBuffer_Write(WE_RingBuffer_t* ringBuffer, const uint8_t* data, uint32_t length);
+
+/**
+ * @brief Returns the oldest contiguous block of data stored in the ring buffer (consumer side).
+ *
+ * The data is not removed from the ring buffer until WE_RingBuffer_Release() is called.
+ *
+ * @param[in] ringBuffer: Ring buffer
+ * @param[out] dataP: Pointer to start of data block
+ *
+ * @return Number of bytes in data block (0 if the ring buffer is empty)
+ */
+extern uint32_t WE_RingBuffer_Peek(WE_RingBuffer_t* ringBuffer, uint8_t** dataP);
+
+/**
+ * @brief Removes data from the ring buffer (consumer side).
+ *
+ * @param[in] ringBuffer: Ring buffer
+ * @param[in] length: Number of bytes to be removed (must not exceed the length returned by WE_RingBuffer_Peek())
+ */
+extern void WE_RingBuffer_Release(WE_RingBuffer_t* ringBuffer, uint32_t length);
+
+/**
+ * @brief Returns the number of bytes currently stored in the ring buffer.
+ *
+ * @param[in] ringBuffer: Ring buffer
+ *
+ * @return Number of bytes stored in ring buffer
+ */
+extern uint32_t WE_RingBuffer_GetCount(WE_RingBuffer_t* ringBuffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RINGBUFFER_H_INCLUDED */
@@ -0,0 +1,228 @@
+/*
+ ***************************************************************************************************
+ * This file is part of WIRELESS CONNECTIVITY SDK for STM32:
+ *
+ *
+ * THE SOFTWARE INCLUDING THE SOURCE CODE IS PROVIDED “AS IS”. YOU ACKNOWLEDGE THAT WÜRTH ELEKTRONIK
+ * EISOS MAKES NO REPRESENTATIONS AND WARRANTIES OF ANY KIND RELATED TO, BUT NOT LIMITED
+ * TO THE NON-INFRINGEMENT OF THIRD PARTIES’ INTELLECTUAL PROPERTY RIGHTS OR THE
+ * MERCHANTABILITY OR FITNESS FOR YOUR INTENDED PURPOSE OR USAGE. WÜRTH ELEKTRONIK EISOS DOES NOT
+ * WARRANT OR REPRESENT THAT ANY LICENSE, EITHER EXPRESS OR IMPLIED, IS GRANTED UNDER ANY PATENT
+ * RIGHT, COPYRIGHT, MASK WORK RIGHT, OR OTHER INTELLECTUAL PROPERTY RIGHT RELATING TO ANY
+ * COMBINATION, MACHINE, OR PROCESS IN WHICH THE PRODUCT IS USED. INFORMATION PUBLISHED BY
+ * WÜRTH ELEKTRONIK EISOS REGARDING THIRD-PARTY PRODUCTS OR SERVICES DOES NOT CONSTITUTE A LICENSE
+ * FROM WÜRTH ELEKTRONIK EISOS TO USE SUCH PRODUCTS OR SERVICES OR A WARRANTY OR ENDORSEMENT
+ * THEREOF
+ *
+ * THIS SOURCE CODE IS PROTECTED BY A LICENSE.
+ * FOR MORE INFORMATION PLEASE CAREFULLY READ THE LICENSE AGREEMENT FILE LOCATED
+ * IN THE ROOT DIRECTORY OF THIS DRIVER PACKAGE.
+ *
+ * COPYRIGHT (c) 2025 Würth Elektronik eiSos GmbH & Co. KG
+ *
+ ***************************************************************************************************
+ */
+
+/**
+ * @file
+ * @brief Binary trace log with deferred formatting (see trace.h).
+ */
+
+#include <global/trace.h>
+
+#ifdef WE_TRACE_ENABLED
+
+#include <stdio.h>
+
+#include <global/global.h>
+#include "print.h"
+#if !defined(__linux__)
+#include "global_platform.h"
+#endif
+
+#if (WE_TRACE_BUFFER_WORDS & (WE_TRACE_BUFFER_WORDS - 1)) != 0
+#error "WE_TRACE_BUFFER_WORDS must be a power of two"
+#endif
+
+/**
+ * @brief Number of words used by a descriptor address.
+ */
+#define WE_TRACE_DESCRIPTOR_WORDS (sizeof(const WE_Trace_Descriptor_t*) / sizeof(uint32_t))
+
+/**
+ * @brief Trace ring buffer.
+ */
+static uint32_t traceBuffer[WE_TRACE_BUFFER_WORDS];
+
+/**
+ * @brief Write index (free running, modified by WE_Trace_Write() only).
+ */
+static volatile uint32_t traceWriteIndex = 0;
+
+/**
+ * @brief Read index (free running, modified by WE_Trace_Read() and WE_Trace_Dump() only).
+ */
+static volatile uint32_t traceReadIndex = 0;
+
+/**
+ * @brief Number of dropped messages.
+ */
+static volatile uint32_t traceDroppedCount = 0;
+
+#if defined(__linux__)
+/**
+ * @brief Protects the write index against concurrent writers (threads).
+ */
+static volatile bool traceLock = false;
+#define WE_TRACE_LOCK()                                                                                                                                                                                                                                                                                                                                                                                        \
+    while (__atomic_test_and_set(&traceLock, __ATOMIC_ACQUIRE))                                                                                                                                                                                                                                                                                                                                                \
+    {                                                                                                                                                                                                                                                                                                                                                                                                          \
+    }
+#define WE_TRACE_UNLOCK() __atomic_clear(&traceLock, __ATOMIC_RELEASE)
+#else
+/* Concurrent writers are interrupt handlers and (RTOS) threads -> briefly disable interrupts */
+#define WE_TRACE_LOCK()                                                                                                                                                                                                                                                                                                                                                                                        \
+    uint32_t primask = __get_PRIMASK();                                                                                                                                                                                                                                                                                                                                                                        \
+    __disable_irq()
+#define WE_TRACE_UNLOCK() __set_PRIMASK(primask)
+#endif
+
+#if defined(__linux__)
+#define WE_TRACE_PRINT_FLUSH() fflush(stdout)
+#elif ((WE_DEBUG_PRINT_LEVEL > WE_DEBUG_PRINT_LEVEL_OFF) || defined(WE_APP_PRINT_ENABLED))
+#define WE_TRACE_PRINT_FLUSH() WE_Print_Flush()
+#else
+#define WE_TRACE_PRINT_FLUSH()
+#endif
+
+static uint32_t WE_Trace_GetRecordWords(uint32_t index);
+
+bool WE_Trace_Write(const WE_Trace_Descriptor_t* descriptor, const uint32_t* arguments, uint32_t argumentWords)
+{
+    uint32_t header[WE_TRACE_HEADER_WORDS];
+    memcpy(header, &descriptor, sizeof(descriptor));
+    header[WE_TRACE_DESCRIPTOR_WORDS] = WE_GetTickMicroseconds();
+    header[WE_TRACE_DESCRIPTOR_WORDS + 1] = argumentWords;
+
+    uint32_t recordWords = WE_TRACE_HEADER_WORDS + argumentWords;
+
+    WE_TRACE_LOCK();
+
+    uint32_t writeIndex = traceWriteIndex;
+    if ((WE_TRACE_BUFFER_WORDS - (writeIndex - traceReadIndex)) < recordWords)
+    {
+        traceDroppedCount++;
+        WE_TRACE_UNLOCK();
+        return false;
+    }
+
+    for (uint32_t i = 0; i < WE_TRACE_HEADER_WORDS; i++)
+    {
+        traceBuffer[(writeIndex++) & (WE_TRACE_BUFFER_WORDS - 1)] = header[i];
+    }
+    for (uint32_t i = 0; i < argumentWords; i++)
+    {
+        traceBuffer[(writeIndex++) & (WE_TRACE_BUFFER_WORDS - 1)] = arguments[i];
+    }
+    traceWriteIndex = writeIndex;
+
+    WE_TRACE_UNLOCK();
+
+    return true;
+}
+
+uint32_t WE_Trace_PutString(uint32_t* words, const char* string)
+{
+    if (string == NULL)
+    {
+        string = "(null)";
+    }
+
+    uint32_t length = 0;
+    while ((length < WE_TRACE_MAX_STRING_LENGTH) && (string[length] != '\0'))
+    {
+        length++;
+    }
+
+    words[0] = length;
+    if (string[length] != '\0')
+    {
+        words[0] |= WE_TRACE_STRING_TRUNCATED;
+    }
+
+    /* Zero the last word, so the padding bytes are defined */
+    uint32_t dataWords = (length + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    if (dataWords > 0)
+    {
+        words[dataWords] = 0;
+    }
+    memcpy(&words[1], string, length);
+
+    return 1 + dataWords;
+}
+
+uint32_t WE_Trace_Read(uint32_t* buffer, uint32_t maxWords)
+{
+    uint32_t readIndex = traceReadIndex;
+    uint32_t wordsCopied = 0;
+
+    while (readIndex != traceWriteIndex)
+    {
+        uint32_t recordWords = WE_Trace_GetRecordWords(readIndex);
+        if ((wordsCopied + recordWords) > maxWords)
+        {
+            break;
+        }
+        for (uint32_t i = 0; i < recordWords; i++)
+        {
+            buffer[wordsCopied++] = traceBuffer[(readIndex++) & (WE_TRACE_BUFFER_WORDS - 1)];
+        }
+        traceReadIndex = readIndex;
+    }
+
+    return wordsCopied;
+}
+
+void WE_Trace_Dump(void)
+{
+    static uint32_t droppedCountReported = 0;
+
+    uint32_t readIndex = traceReadIndex;
+    uint32_t droppedCount = traceDroppedCount;
+    if ((readIndex == traceWriteIndex) && (droppedCount == droppedCountReported))
+    {
+        return;
+    }
+
+    /* The address of this function allows the decoder to determine the load address of position independent executables */
+    printf(WE_TRACE_DUMP_PREFIX "B %p %lu\r\n", (void*)&WE_Trace_Dump, (unsigned long)droppedCount);
+    droppedCountReported = droppedCount;
+
+    while (readIndex != traceWriteIndex)
+    {
+        uint32_t recordWords = WE_Trace_GetRecordWords(readIndex);
+        printf(WE_TRACE_DUMP_PREFIX);
+        for (uint32_t i = 0; i < recordWords; i++)
+        {
+            printf(" %08lx", (unsigned long)traceBuffer[(readIndex++) & (WE_TRACE_BUFFER_WORDS - 1)]);
+        }
+        printf("\r\n");
+        traceReadIndex = readIndex;
+
+        /* Wait for the line to be transmitted, so that the print ring buffer doesn't overflow */
+        WE_TRACE_PRINT_FLUSH();
+    }
+}
+
+uint32_t WE_Trace_GetDroppedCount(void) { return traceDroppedCount; }
+
+/**
+ * @brief Returns the size of the record starting at the given index.
+ *
+ * @param[in] index Index of the first word of the record
+ *
+ * @return Size of the record in words
+ */
+static uint32_t WE_Trace_GetRecordWords(uint32_t index) { return WE_TRACE_HEADER_WORDS + traceBuffer[(index + WE_TRACE_DESCRIPTOR_WORDS + 1) & (WE_TRACE_BUFFER_WORDS - 1)]; }
+
+#endif /* WE_TRACE_ENABLED */